@@ -80,6 +80,9 @@ namespace FirstEngineEditor.Services
         [DllImport("FirstEngine_Core.dll", CallingConvention = CallingConvention.Cdecl)]
         private static extern void EditorAPI_SetRenderConfig(IntPtr engine, int width, int height, float renderScale);
 
+        [DllImport("FirstEngine_Core.dll", CallingConvention = CallingConvention.Cdecl, CharSet = CharSet.Ansi)]
+        private static extern void EditorAPI_ExportFrameGraph(IntPtr engine, string filePath);
+
         // Console output redirection
         [DllImport("FirstEngine_Core.dll", CallingConvention = CallingConvention.Cdecl)]
         private static extern void EditorAPI_SetOutputCallback(IntPtr callback);
@@ -310,6 +313,15 @@ namespace FirstEngineEditor.Services
             }
         }
 
+        // Writes the compiled FrameGraph after the next rendered frame (".json" for JSON, Graphviz otherwise)
+        public void ExportFrameGraph(string filePath)
+        {
+            if (_initialized && _globalEngineHandle.HasValue && _globalEngineHandle.Value != IntPtr.Zero)
+            {
+                EditorAPI_ExportFrameGraph(_globalEngineHandle.Value, filePath);
+            }
+        }
+
         public void Dispose()
         {
             if (_viewportHandle != IntPtr.Zero)
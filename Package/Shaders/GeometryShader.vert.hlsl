@@ -1,11 +1,21 @@
 // GeometryShader Vertex Shader
 // HLSL syntax for geometry pass in deferred rendering
+// OCTAHEDRAL_NORMALS: meshes cooked with ResourceImport --octahedral-normals (normal/tangent as snorm16x2)
+// @keywords OCTAHEDRAL_NORMALS
 
 struct VertexInput {
     float3 position : POSITION;
+#ifdef OCTAHEDRAL_NORMALS
+    float2 normal : NORMAL;
+#else
     float3 normal : NORMAL;
+#endif
     float2 texCoord : TEXCOORD0;
+#ifdef OCTAHEDRAL_NORMALS
+    float2 tangent : TANGENT;
+#else
     float4 tangent : TANGENT;
+#endif
 };
 
 struct VertexOutput {
@@ -30,8 +40,34 @@ struct VertexOutput {
     float4x4 viewProjectionMatrix;
 };
 
+#ifdef OCTAHEDRAL_NORMALS
+// Octahedral normal (snorm16x2) back to a unit vector
+float3 DecodeOctahedral(float2 e) {
+    float3 n = float3(e, 1.0 - abs(e.x) - abs(e.y));
+    float t = saturate(-n.z);
+    n.x += n.x >= 0.0 ? -t : t;
+    n.y += n.y >= 0.0 ? -t : t;
+    return normalize(n);
+}
+
+// Octahedral tangent: y keeps 15 bits, its low bit is the handedness (set = -1)
+float4 DecodeOctahedralTangent(float2 e) {
+    int y = int(round(e.y * 32767.0));
+    float w = (y & 1) ? -1.0 : 1.0;
+    return float4(DecodeOctahedral(float2(e.x, float(y >> 1) / 16383.0)), w);
+}
+#endif
+
 VertexOutput main(VertexInput input) {
     VertexOutput output;
+
+#ifdef OCTAHEDRAL_NORMALS
+    float3 normal = DecodeOctahedral(input.normal);
+    float4 tangent = DecodeOctahedralTangent(input.tangent);
+#else
+    float3 normal = input.normal;
+    float4 tangent = input.tangent;
+#endif
     
     // Transform position to world space
     float4 worldPos = mul(float4(input.position, 1.0), modelMatrix);
@@ -41,13 +77,13 @@ VertexOutput main(VertexInput input) {
     output.position = mul(worldPos, viewProjectionMatrix);
     
     // Transform normal to world space
-    output.normal = normalize(mul(input.normal, (float3x3)normalMatrix));
+    output.normal = normalize(mul(normal, (float3x3)normalMatrix));
     
     // Transform tangent to world space
-    output.tangent = normalize(mul(input.tangent.xyz, (float3x3)normalMatrix));
+    output.tangent = normalize(mul(tangent.xyz, (float3x3)normalMatrix));
     
     // Calculate bitangent
-    output.bitangent = cross(output.normal, output.tangent) * input.tangent.w;
+    output.bitangent = cross(output.normal, output.tangent) * tangent.w;
     
     // Pass through texture coordinates
     output.texCoord = input.texCoord;
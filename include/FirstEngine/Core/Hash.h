@@ -0,0 +1,462 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#if defined(__AVX2__)
+    #include <immintrin.h>
+    #define FE_HASH_AVX2 1
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+    #include <emmintrin.h>
+    #define FE_HASH_SSE2 1
+#endif
+
+#if defined(_MSC_VER) && defined(_M_X64)
+    #include <intrin.h>
+#endif
+
+// Header-only so every module (including Shader, which doesn't link Core) can use it
+namespace FirstEngine {
+    namespace Core {
+
+        // 128-bit hash value, usable directly as a map key
+        struct Hash128 {
+            uint64_t low = 0;
+            uint64_t high = 0;
+
+            bool operator==(const Hash128& other) const { return low == other.low && high == other.high; }
+            bool operator!=(const Hash128& other) const { return !(*this == other); }
+            bool operator<(const Hash128& other) const {
+                return high != other.high ? high < other.high : low < other.low;
+            }
+
+            bool IsZero() const { return low == 0 && high == 0; }
+
+            // 32 hex characters (high word first), e.g. for file names
+            std::string ToString() const {
+                static const char kDigits[] = "0123456789abcdef";
+                std::string result(32, '0');
+                for (int i = 0; i < 16; ++i) {
+                    result[15 - i] = kDigits[(high >> (i * 4)) & 0xF];
+                    result[31 - i] = kDigits[(low >> (i * 4)) & 0xF];
+                }
+                return result;
+            }
+        };
+
+        // Hash functor for unordered containers (the value is already well mixed)
+        struct Hash128Hasher {
+            size_t operator()(const Hash128& hash) const { return static_cast<size_t>(hash.low); }
+        };
+
+        namespace HashDetail {
+
+            // Fast non-cryptographic hash in the XXH3 family: 8 x 64-bit lanes fed 64-byte stripes with
+            // 32x32->64 multiplies (SSE2/AVX2 when available), scrambled every 1 KiB block, with dedicated
+            // paths for short inputs. Values are stable across runs and platforms (little-endian loads),
+            // so they can be stored on disk. Not suitable where an attacker controls the input.
+
+            constexpr size_t kStripeSize = 64;
+            constexpr size_t kSecretSize = 192;
+            constexpr size_t kStripesPerBlock = (kSecretSize - kStripeSize) / 8;  // 16
+            constexpr size_t kBlockSize = kStripesPerBlock * kStripeSize;       // 1024
+            constexpr size_t kShortMax = 128;
+            constexpr size_t kLastStripeSecretOffset = kSecretSize - kStripeSize - 7;
+            constexpr size_t kMergeSecretOffset = 11;
+
+            constexpr uint64_t kPrime32_1 = 0x9E3779B1ull;
+            constexpr uint64_t kPrime32_2 = 0x85EBCA77ull;
+            constexpr uint64_t kPrime32_3 = 0xC2B2AE3Dull;
+            constexpr uint64_t kPrime64_1 = 0x9E3779B185EBCA87ull;
+            constexpr uint64_t kPrime64_2 = 0xC2B2AE3D27D4EB4Full;
+            constexpr uint64_t kPrime64_3 = 0x165667B19E3779F9ull;
+            constexpr uint64_t kPrime64_4 = 0x85EBCA77C2B2AE63ull;
+            constexpr uint64_t kPrime64_5 = 0x27D4EB2F165667C5ull;
+
+            // Pseudo-random key material (splitmix64 output)
+            alignas(64) static constexpr uint8_t kSecret[kSecretSize] = {
+                0xe2, 0xd3, 0xc6, 0x19, 0x6f, 0x83, 0x8a, 0x40, 0x4e, 0xa5, 0xd3, 0xac, 0x0a, 0x26, 0xa1, 0x2c,
+                0x12, 0x00, 0x04, 0xe1, 0xed, 0x3f, 0xcc, 0x20, 0xbd, 0xc9, 0xec, 0xf4, 0x39, 0x2c, 0x88, 0xb6,
+                0x3d, 0xfc, 0xf6, 0xf7, 0x7f, 0xdb, 0xd5, 0x37, 0x0b, 0xd7, 0x28, 0x68, 0x1e, 0x35, 0x84, 0x10,
+                0xb0, 0xfe, 0x98, 0xc0, 0xed, 0x65, 0x4e, 0x2f, 0x9a, 0x84, 0xdc, 0x47, 0xbf, 0x13, 0x97, 0xd8,
+                0xe7, 0x05, 0xc8, 0x38, 0x8d, 0x86, 0x20, 0xa8, 0x1f, 0x4b, 0x58, 0xde, 0x3a, 0xdb, 0x77, 0x54,
+                0xd5, 0x13, 0x7c, 0x9c, 0x8f, 0x8f, 0x60, 0x08, 0xcb, 0x20, 0x56, 0x3b, 0xfe, 0x31, 0xbb, 0x4c,
+                0xa5, 0xfc, 0x11, 0x9c, 0x67, 0x2d, 0x7b, 0xe6, 0x55, 0x84, 0x4e, 0x27, 0x4b, 0x98, 0x48, 0x31,
+                0xeb, 0x7c, 0x58, 0xef, 0x42, 0xd6, 0xca, 0xbd, 0x29, 0x82, 0x62, 0x27, 0x67, 0xff, 0xb3, 0x10,
+                0xee, 0x5b, 0x98, 0xb2, 0xca, 0xc9, 0x06, 0xb6, 0x05, 0xb0, 0xaa, 0x48, 0xb5, 0xcf, 0xd3, 0xed,
+                0x26, 0x94, 0x82, 0x15, 0x79, 0x91, 0x09, 0x84, 0xe3, 0x6d, 0xf0, 0xbe, 0xae, 0x24, 0xf9, 0x3b,
+                0x1a, 0xa9, 0xe6, 0x0d, 0xdf, 0x42, 0x3f, 0x57, 0x5d, 0xca, 0xbf, 0x9f, 0x2a, 0xff, 0xae, 0x2a,
+                0xa6, 0xcf, 0xa4, 0x39, 0xa5, 0xb0, 0xcc, 0x8a, 0xda, 0xc7, 0x94, 0x2a, 0x5a, 0xaa, 0x75, 0x7a,
+            };
+
+            inline uint64_t Read64(const uint8_t* p) {
+                uint64_t value;
+                std::memcpy(&value, p, sizeof(value));
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+                value = __builtin_bswap64(value);
+#endif
+                return value;
+            }
+
+            inline uint32_t Read32(const uint8_t* p) {
+                uint32_t value;
+                std::memcpy(&value, p, sizeof(value));
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+                value = __builtin_bswap32(value);
+#endif
+                return value;
+            }
+
+            // 64x64->128 multiply, folded to 64 bits
+            inline uint64_t MulFold64(uint64_t a, uint64_t b) {
+#if defined(__SIZEOF_INT128__)
+                __uint128_t product = static_cast<__uint128_t>(a) * b;
+                return static_cast<uint64_t>(product) ^ static_cast<uint64_t>(product >> 64);
+#elif defined(_MSC_VER) && defined(_M_X64)
+                uint64_t high;
+                uint64_t low = _umul128(a, b, &high);
+                return low ^ high;
+#else
+                uint64_t aLo = a & 0xFFFFFFFFull, aHi = a >> 32;
+                uint64_t bLo = b & 0xFFFFFFFFull, bHi = b >> 32;
+                uint64_t loLo = aLo * bLo, hiLo = aHi * bLo, loHi = aLo * bHi, hiHi = aHi * bHi;
+                uint64_t cross = (loLo >> 32) + (hiLo & 0xFFFFFFFFull) + loHi;
+                uint64_t high = hiHi + (hiLo >> 32) + (cross >> 32);
+                uint64_t low = (cross << 32) | (loLo & 0xFFFFFFFFull);
+                return low ^ high;
+#endif
+            }
+
+            inline uint64_t Avalanche(uint64_t h) {
+                h ^= h >> 37;
+                h *= 0x165667919E3779F9ull;
+                h ^= h >> 32;
+                return h;
+            }
+
+            inline uint64_t Mix16(const uint8_t* p, const uint8_t* secret, uint64_t seed) {
+                return MulFold64(Read64(p) ^ (Read64(secret) + seed), Read64(p + 8) ^ (Read64(secret + 8) - seed));
+            }
+
+            // 0..16 bytes
+            inline Hash128 HashUpTo16(const uint8_t* p, size_t size, uint64_t seed) {
+                uint64_t a;
+                uint64_t b;
+                if (size >= 8) {
+                    a = Read64(p);
+                    b = Read64(p + size - 8);
+                } else if (size >= 4) {
+                    a = (static_cast<uint64_t>(Read32(p)) << 32) | Read32(p + size - 4);
+                    b = (a << 17) | (a >> 47);
+                } else if (size > 0) {
+                    a = (static_cast<uint64_t>(p[0]) << 16) | (static_cast<uint64_t>(p[size >> 1]) << 24) |
+                        p[size - 1] | (static_cast<uint64_t>(size) << 8);
+                    b = ~a;
+                } else {
+                    a = 0;
+                    b = 0;
+                }
+                uint64_t lo = MulFold64(a ^ (Read64(kSecret) + seed), b ^ (Read64(kSecret + 8) - seed) ^ size);
+                uint64_t hi = MulFold64(b ^ (Read64(kSecret + 16) - seed), a ^ (Read64(kSecret + 24) + seed) ^ (size * kPrime64_5));
+                Hash128 result;
+                result.low = Avalanche(lo + size * kPrime64_1);
+                result.high = Avalanche(hi ^ (size * kPrime64_2) ^ lo);
+                return result;
+            }
+
+            // 17..128 bytes: pairs of 16-byte chunks from both ends
+            inline Hash128 HashUpTo128(const uint8_t* p, size_t size, uint64_t seed) {
+                uint64_t accLo = size * kPrime64_1;
+                uint64_t accHi = 0;
+                size_t rounds = (size - 1) / 32 + 1;
+                for (size_t i = 0; i < rounds; ++i) {
+                    const uint8_t* front = p + 16 * i;
+                    const uint8_t* back = p + size - 16 * (i + 1);
+                    accLo += Mix16(front, kSecret + 32 * i, seed);
+                    accLo ^= Read64(back) + Read64(back + 8);
+                    accHi += Mix16(back, kSecret + 32 * i + 16, seed);
+                    accHi ^= Read64(front) + Read64(front + 8);
+                }
+                Hash128 result;
+                result.low = Avalanche(accLo + accHi);
+                result.high = 0 - Avalanche(accLo * kPrime64_1 + accHi * kPrime64_4 + (size - seed) * kPrime64_2);
+                return result;
+            }
+
+            inline void InitAccumulators(uint64_t acc[8], uint64_t seed) {
+                acc[0] = kPrime32_3 + seed;
+                acc[1] = kPrime64_1 - seed;
+                acc[2] = kPrime64_2 + seed;
+                acc[3] = kPrime64_3 - seed;
+                acc[4] = kPrime64_4 + seed;
+                acc[5] = kPrime32_2 - seed;
+                acc[6] = kPrime64_5 + seed;
+                acc[7] = kPrime32_1 - seed;
+            }
+
+            // acc[i ^ 1] += data[i]; acc[i] += lo32(data[i] ^ key[i]) * hi32(data[i] ^ key[i])
+            inline void AccumulateStripe(uint64_t acc[8], const uint8_t* p, const uint8_t* secret) {
+#if defined(FE_HASH_AVX2)
+                auto* xacc = reinterpret_cast<__m256i*>(acc);
+                for (int i = 0; i < 2; ++i) {
+                    __m256i data = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p) + i);
+                    __m256i key = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(secret) + i);
+                    __m256i dataKey = _mm256_xor_si256(data, key);
+                    __m256i dataKeyHi = _mm256_shuffle_epi32(dataKey, _MM_SHUFFLE(0, 3, 0, 1));
+                    __m256i product = _mm256_mul_epu32(dataKey, dataKeyHi);
+                    __m256i dataSwap = _mm256_shuffle_epi32(data, _MM_SHUFFLE(1, 0, 3, 2));
+                    __m256i a = _mm256_loadu_si256(xacc + i);
+                    _mm256_storeu_si256(xacc + i, _mm256_add_epi64(product, _mm256_add_epi64(a, dataSwap)));
+                }
+#elif defined(FE_HASH_SSE2)
+                auto* xacc = reinterpret_cast<__m128i*>(acc);
+                for (int i = 0; i < 4; ++i) {
+                    __m128i data = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p) + i);
+                    __m128i key = _mm_loadu_si128(reinterpret_cast<const __m128i*>(secret) + i);
+                    __m128i dataKey = _mm_xor_si128(data, key);
+                    __m128i dataKeyHi = _mm_shuffle_epi32(dataKey, _MM_SHUFFLE(0, 3, 0, 1));
+                    __m128i product = _mm_mul_epu32(dataKey, dataKeyHi);
+                    __m128i dataSwap = _mm_shuffle_epi32(data, _MM_SHUFFLE(1, 0, 3, 2));
+                    __m128i a = _mm_loadu_si128(xacc + i);
+                    _mm_storeu_si128(xacc + i, _mm_add_epi64(product, _mm_add_epi64(a, dataSwap)));
+                }
+#else
+                for (int i = 0; i < 8; ++i) {
+                    uint64_t data = Read64(p + 8 * i);
+                    uint64_t dataKey = data ^ Read64(secret + 8 * i);
+                    acc[i ^ 1] += data;
+                    acc[i] += (dataKey & 0xFFFFFFFFull) * (dataKey >> 32);
+                }
+#endif
+            }
+
+            inline void ScrambleAccumulators(uint64_t acc[8], const uint8_t* secret) {
+#if defined(FE_HASH_AVX2)
+                auto* xacc = reinterpret_cast<__m256i*>(acc);
+                const __m256i prime = _mm256_set1_epi32(static_cast<int>(kPrime32_1));
+                for (int i = 0; i < 2; ++i) {
+                    __m256i a = _mm256_loadu_si256(xacc + i);
+                    a = _mm256_xor_si256(a, _mm256_srli_epi64(a, 47));
+                    a = _mm256_xor_si256(a, _mm256_loadu_si256(reinterpret_cast<const __m256i*>(secret) + i));
+                    __m256i aHi = _mm256_shuffle_epi32(a, _MM_SHUFFLE(0, 3, 0, 1));
+                    __m256i productLo = _mm256_mul_epu32(a, prime);
+                    __m256i productHi = _mm256_mul_epu32(aHi, prime);
+                    _mm256_storeu_si256(xacc + i, _mm256_add_epi64(productLo, _mm256_slli_epi64(productHi, 32)));
+                }
+#elif defined(FE_HASH_SSE2)
+                auto* xacc = reinterpret_cast<__m128i*>(acc);
+                const __m128i prime = _mm_set1_epi32(static_cast<int>(kPrime32_1));
+                for (int i = 0; i < 4; ++i) {
+                    __m128i a = _mm_loadu_si128(xacc + i);
+                    a = _mm_xor_si128(a, _mm_srli_epi64(a, 47));
+                    a = _mm_xor_si128(a, _mm_loadu_si128(reinterpret_cast<const __m128i*>(secret) + i));
+                    __m128i aHi = _mm_shuffle_epi32(a, _MM_SHUFFLE(0, 3, 0, 1));
+                    __m128i productLo = _mm_mul_epu32(a, prime);
+                    __m128i productHi = _mm_mul_epu32(aHi, prime);
+                    _mm_storeu_si128(xacc + i, _mm_add_epi64(productLo, _mm_slli_epi64(productHi, 32)));
+                }
+#else
+                for (int i = 0; i < 8; ++i) {
+                    uint64_t a = acc[i];
+                    a ^= a >> 47;
+                    a ^= Read64(secret + 8 * i);
+                    acc[i] = a * kPrime32_1;
+                }
+#endif
+            }
+
+            // Feed whole stripes; stripeInBlock tracks the position inside the current 1 KiB block
+            inline void ConsumeStripes(uint64_t acc[8], size_t& stripeInBlock, const uint8_t* p, size_t stripes) {
+                for (size_t i = 0; i < stripes; ++i) {
+                    AccumulateStripe(acc, p + i * kStripeSize, kSecret + stripeInBlock * 8);
+                    if (++stripeInBlock == kStripesPerBlock) {
+                        ScrambleAccumulators(acc, kSecret + kSecretSize - kStripeSize);
+                        stripeInBlock = 0;
+                    }
+                }
+            }
+
+            inline uint64_t MergeAccumulators(const uint64_t acc[8], const uint8_t* secret, uint64_t start) {
+                uint64_t result = start;
+                for (int i = 0; i < 4; ++i) {
+                    result += MulFold64(acc[2 * i] ^ Read64(secret + 16 * i), acc[2 * i + 1] ^ Read64(secret + 16 * i + 8));
+                }
+                return Avalanche(result);
+            }
+
+            // Finish a long (> 128 byte) input; lastStripe = the final 64 bytes of the input
+            inline Hash128 FinishLong(uint64_t acc[8], const uint8_t* lastStripe, uint64_t totalSize) {
+                AccumulateStripe(acc, lastStripe, kSecret + kLastStripeSecretOffset);
+                Hash128 result;
+                result.low = MergeAccumulators(acc, kSecret + kMergeSecretOffset, totalSize * kPrime64_1);
+                result.high = MergeAccumulators(acc, kSecret + kSecretSize - kStripeSize - kMergeSecretOffset,
+                                                ~(totalSize * kPrime64_2));
+                return result;
+            }
+
+        } // namespace HashDetail
+
+        // One-shot 128-bit hash of a byte range
+        inline Hash128 HashBytes128(const void* data, size_t size, uint64_t seed = 0) {
+            const auto* p = static_cast<const uint8_t*>(data);
+            if (size <= 16) {
+                return HashDetail::HashUpTo16(p, size, seed);
+            }
+            if (size <= HashDetail::kShortMax) {
+                return HashDetail::HashUpTo128(p, size, seed);
+            }
+
+            alignas(32) uint64_t acc[8];
+            HashDetail::InitAccumulators(acc, seed);
+            size_t stripeInBlock = 0;
+            // Always leave at least one byte for the (overlapping) last stripe
+            HashDetail::ConsumeStripes(acc, stripeInBlock, p, (size - 1) / HashDetail::kStripeSize);
+            return HashDetail::FinishLong(acc, p + size - HashDetail::kStripeSize, size);
+        }
+
+        // 64-bit convenience (low half of the 128-bit hash)
+        inline uint64_t HashBytes64(const void* data, size_t size, uint64_t seed = 0) {
+            return HashBytes128(data, size, seed).low;
+        }
+
+        inline Hash128 HashBytes128(const std::vector<uint32_t>& words, uint64_t seed = 0) {
+            return HashBytes128(words.data(), words.size() * sizeof(uint32_t), seed);
+        }
+
+        inline Hash128 HashBytes128(const std::string& value, uint64_t seed = 0) {
+            return HashBytes128(value.data(), value.size(), seed);
+        }
+
+        // Hasher128 - incremental version of HashBytes128
+        // Feeding the same bytes in any number of Update calls gives the same result as one HashBytes128 call.
+        // Meant for composite keys (pipeline state, descriptor layouts, cooked asset inputs):
+        //     Hasher128 hasher;
+        //     hasher.UpdateValue(desc.topology).UpdateString(desc.name).Update(blob.data(), blob.size());
+        //     Hash128 key = hasher.Finalize();
+        class Hasher128 {
+        public:
+            explicit Hasher128(uint64_t seed = 0) { Reset(seed); }
+
+            void Reset(uint64_t seed = 0) {
+                m_Seed = seed;
+                m_TotalSize = 0;
+                m_BufferSize = 0;
+                m_StripeInBlock = 0;
+                HashDetail::InitAccumulators(m_Acc, seed);
+            }
+
+            Hasher128& Update(const void* data, size_t size) {
+                const auto* p = static_cast<const uint8_t*>(data);
+                m_TotalSize += size;
+
+                // Stripes are only consumed once more input follows them, so the buffer always holds the tail
+                if (m_BufferSize + size <= kBufferSize) {
+                    if (size > 0) {
+                        std::memcpy(m_Buffer + m_BufferSize, p, size);
+                    }
+                    m_BufferSize += size;
+                    return *this;
+                }
+
+                if (m_BufferSize > 0) {
+                    size_t fill = kBufferSize - m_BufferSize;
+                    std::memcpy(m_Buffer + m_BufferSize, p, fill);
+                    p += fill;
+                    size -= fill;
+                    Consume(m_Buffer, kBufferSize / HashDetail::kStripeSize);
+                    m_BufferSize = 0;
+                }
+
+                if (size > kBufferSize) {
+                    size_t stripes = (size - 1) / HashDetail::kStripeSize;
+                    Consume(p, stripes);
+                    p += stripes * HashDetail::kStripeSize;
+                    size -= stripes * HashDetail::kStripeSize;
+                }
+
+                std::memcpy(m_Buffer, p, size);
+                m_BufferSize = size;
+                return *this;
+            }
+
+            // Trivially copyable values (enums, PODs without padding, handles)
+            template <typename T>
+            Hasher128& UpdateValue(const T& value) {
+                static_assert(std::is_trivially_copyable<T>::value, "UpdateValue needs a trivially copyable type");
+                return Update(&value, sizeof(T));
+            }
+
+            // Length-prefixed, so ("ab", "c") and ("a", "bc") hash differently
+            Hasher128& UpdateString(const std::string& value) {
+                UpdateValue(static_cast<uint64_t>(value.size()));
+                return Update(value.data(), value.size());
+            }
+
+            template <typename T>
+            Hasher128& UpdateArray(const std::vector<T>& values) {
+                static_assert(std::is_trivially_copyable<T>::value, "UpdateArray needs a trivially copyable type");
+                UpdateValue(static_cast<uint64_t>(values.size()));
+                return Update(values.data(), values.size() * sizeof(T));
+            }
+
+            Hasher128& UpdateHash(const Hash128& hash) {
+                return UpdateValue(hash.low).UpdateValue(hash.high);
+            }
+
+            // Hash of everything fed so far (the hasher can keep being updated afterwards)
+            Hash128 Finalize() const {
+                if (m_TotalSize <= HashDetail::kShortMax) {
+                    // Short inputs never leave the buffer
+                    return m_TotalSize <= 16
+                        ? HashDetail::HashUpTo16(m_Buffer, static_cast<size_t>(m_TotalSize), m_Seed)
+                        : HashDetail::HashUpTo128(m_Buffer, static_cast<size_t>(m_TotalSize), m_Seed);
+                }
+
+                alignas(32) uint64_t acc[8];
+                std::memcpy(acc, m_Acc, sizeof(acc));
+                size_t stripeInBlock = m_StripeInBlock;
+                HashDetail::ConsumeStripes(acc, stripeInBlock, m_Buffer, (m_BufferSize - 1) / HashDetail::kStripeSize);
+
+                // The last stripe may reach back into bytes that were already consumed
+                uint8_t lastStripe[HashDetail::kStripeSize];
+                if (m_BufferSize >= HashDetail::kStripeSize) {
+                    std::memcpy(lastStripe, m_Buffer + m_BufferSize - HashDetail::kStripeSize, HashDetail::kStripeSize);
+                } else {
+                    size_t history = HashDetail::kStripeSize - m_BufferSize;
+                    std::memcpy(lastStripe, m_History + HashDetail::kStripeSize - history, history);
+                    std::memcpy(lastStripe + history, m_Buffer, m_BufferSize);
+                }
+                return HashDetail::FinishLong(acc, lastStripe, m_TotalSize);
+            }
+
+        private:
+            static constexpr size_t kBufferSize = 4 * HashDetail::kStripeSize;
+
+            void Consume(const uint8_t* p, size_t stripes) {
+                HashDetail::ConsumeStripes(m_Acc, m_StripeInBlock, p, stripes);
+                std::memcpy(m_History, p + (stripes - 1) * HashDetail::kStripeSize, HashDetail::kStripeSize);
+            }
+
+            alignas(32) uint64_t m_Acc[8];
+            uint8_t m_Buffer[kBufferSize];
+            uint8_t m_History[HashDetail::kStripeSize];  // Last consumed stripe
+            uint64_t m_Seed = 0;
+            uint64_t m_TotalSize = 0;
+            size_t m_BufferSize = 0;
+            size_t m_StripeInBlock = 0;
+        };
+
+    } // namespace Core
+} // namespace FirstEngine
+
+namespace std {
+    template <>
+    struct hash<FirstEngine::Core::Hash128> {
+        size_t operator()(const FirstEngine::Core::Hash128& hash) const { return static_cast<size_t>(hash.low); }
+    };
+}
@@ -18,7 +18,10 @@ namespace FirstEngine {
         public:
             static ThreadManager& GetInstance();
             static void Initialize();
+            // Start only the worker pool; a later Initialize() adds the dedicated engine threads
+            static void InitializeWorkerPool();
             static void Shutdown();
+            static bool IsInitialized();
 
             // Non-copyable
             ThreadManager(const ThreadManager&) = delete;
@@ -40,6 +43,18 @@ namespace FirstEngine {
             template<typename T>
             Future<T> InvokeOnThread(ThreadType type, std::function<T()> task, TaskPriority priority = TaskPriority::Normal);
 
+            // Invoke task on the worker pool
+            // Worker threads run generic parallel jobs (pipeline compilation, asset cooking, etc.)
+            // The task is queued on the worker with the fewest pending tasks
+            Future<void> InvokeOnWorker(std::function<void()> task, TaskPriority priority = TaskPriority::Normal);
+
+            // Invoke task on the worker pool with return value
+            template<typename T>
+            Future<T> InvokeOnWorker(std::function<T()> task, TaskPriority priority = TaskPriority::Normal);
+
+            // Get number of worker threads in the pool
+            size_t GetWorkerCount() const;
+
             // Wait for all threads to finish their current tasks
             void WaitForAllThreads();
 
@@ -65,9 +80,19 @@ namespace FirstEngine {
             ThreadManager();
             ~ThreadManager();
 
+            // Create and start the Device/Game/IO/Python/Render threads that do not exist yet
+            void CreateEngineThreads();
+
+            // Create worker pool threads (count = 0 uses hardware concurrency)
+            void CreateWorkerThreads(size_t count);
+
+            // Pick the worker with the fewest pending tasks
+            Thread* GetLeastBusyWorker() const;
+
             mutable std::mutex m_Mutex;
             std::unordered_map<ThreadType, std::unique_ptr<Thread>> m_Threads;
             std::unordered_map<std::string, Thread*> m_ThreadsByName;
+            std::vector<std::unique_ptr<Thread>> m_WorkerThreads;
             bool m_Initialized;
         };
 
@@ -81,5 +106,14 @@ namespace FirstEngine {
             return thread->Invoke(task, priority);
         }
 
+        template<typename T>
+        Future<T> ThreadManager::InvokeOnWorker(std::function<T()> task, TaskPriority priority) {
+            Thread* worker = GetLeastBusyWorker();
+            if (!worker) {
+                throw std::runtime_error("No worker threads available");
+            }
+            return worker->Invoke(task, priority);
+        }
+
     } // namespace Core
 } // namespace FirstEngine
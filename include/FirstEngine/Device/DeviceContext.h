@@ -7,6 +7,8 @@
 namespace FirstEngine {
     namespace Device {
 
+        class MemoryManager;
+
         // Device context - provides basic Vulkan device-related information
         class FE_DEVICE_API DeviceContext {
         public:
@@ -25,6 +27,9 @@ namespace FirstEngine {
             uint32_t GetGraphicsQueueFamily() const { return m_GraphicsQueueFamily; }
             uint32_t GetPresentQueueFamily() const { return m_PresentQueueFamily; }
 
+            // Device memory allocator shared by all buffers and images of this device
+            MemoryManager* GetMemoryManager() const { return m_MemoryManager.get(); }
+
         private:
             VkInstance m_Instance;
             VkDevice m_Device;
@@ -34,6 +39,7 @@ namespace FirstEngine {
             VkCommandPool m_CommandPool;
             uint32_t m_GraphicsQueueFamily;
             uint32_t m_PresentQueueFamily;
+            std::unique_ptr<MemoryManager> m_MemoryManager;
         };
 
     } // namespace Device
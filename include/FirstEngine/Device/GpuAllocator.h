@@ -0,0 +1,202 @@
+#pragma once
+
+#include "FirstEngine/Device/Export.h"
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+// No Vulkan types in here: the allocator only sees memory type indices and opaque memory handles,
+// so it can be driven by a fake backend without a GPU
+namespace FirstEngine {
+    namespace Device {
+
+        // TlsfAllocator - two-level segregated fit allocator over an offset range [0, size)
+        // O(1) allocate/free with immediate coalescing. Manages offsets only; the memory itself lives elsewhere.
+        // The O(1) search skips the size class the request falls in; only when nothing larger is free are that
+        // class's ranges checked one by one, so an exact fit is still found before a block counts as full.
+        class FE_DEVICE_API TlsfAllocator {
+        public:
+            static constexpr uint32_t kInvalidNode = 0xFFFFFFFFu;
+
+            explicit TlsfAllocator(uint64_t size);
+
+            // Returns the allocation's node (kInvalidNode if no free range fits) and its aligned offset
+            // alignment must be a power of two
+            uint32_t Allocate(uint64_t size, uint64_t alignment, uint64_t& outOffset);
+            void Free(uint32_t node);
+
+            uint64_t GetSize() const { return m_Size; }
+            uint64_t GetConsumedBytes() const { return m_ConsumedBytes; }  // Including absorbed padding
+            uint32_t GetAllocationCount() const { return m_AllocationCount; }
+            bool IsEmpty() const { return m_AllocationCount == 0; }
+            uint64_t GetLargestFreeRange() const;
+
+            // Visit live allocations in address order: callback(node, rangeOffset, rangeSize)
+            void ForEachAllocation(const std::function<void(uint32_t, uint64_t, uint64_t)>& callback) const;
+
+        private:
+            static constexpr uint32_t kSecondLevelBits = 5;
+            static constexpr uint32_t kSecondLevelCount = 1u << kSecondLevelBits;
+            static constexpr uint32_t kSmallRangeBits = 8;  // Ranges < 256 bytes share the first level linearly
+            static constexpr uint32_t kFirstLevelCount = 64 - kSmallRangeBits + 1;
+            static constexpr uint64_t kMinFreeRange = 64;   // Smaller leftovers are absorbed into the allocation
+
+            struct Node {
+                uint64_t offset = 0;
+                uint64_t size = 0;
+                uint32_t prevPhysical = kInvalidNode;
+                uint32_t nextPhysical = kInvalidNode;
+                uint32_t prevFree = kInvalidNode;
+                uint32_t nextFree = kInvalidNode;
+                bool free = false;
+            };
+
+            static void Mapping(uint64_t size, uint32_t& firstLevel, uint32_t& secondLevel);
+            uint32_t FindFree(uint64_t size) const;
+            uint32_t FindFit(uint64_t size, uint64_t alignment) const;
+            void InsertFree(uint32_t node);
+            void RemoveFree(uint32_t node);
+            uint32_t NewNode();
+            void ReleaseNode(uint32_t node);
+            // Split 'size' bytes off the front of 'node'; the remainder becomes a new free node after it
+            void SplitFront(uint32_t node, uint64_t size);
+
+            uint64_t m_Size;
+            uint64_t m_ConsumedBytes = 0;
+            uint32_t m_AllocationCount = 0;
+            std::vector<Node> m_Nodes;
+            std::vector<uint32_t> m_UnusedNodes;
+            uint64_t m_FirstLevelBitmap = 0;
+            uint32_t m_SecondLevelBitmap[kFirstLevelCount] = {};
+            uint32_t m_FreeHeads[kFirstLevelCount][kSecondLevelCount];
+        };
+
+        // IGpuMemoryBackend - where GpuAllocator gets its device memory blocks from
+        // Implemented on top of vkAllocateMemory by MemoryManager; tests can implement it with plain host memory.
+        class FE_DEVICE_API IGpuMemoryBackend {
+        public:
+            virtual ~IGpuMemoryBackend() = default;
+
+            // Allocate one block of device memory; outMemory is an opaque non-zero handle
+            virtual bool AllocateDeviceMemory(uint32_t memoryTypeIndex, uint64_t size, uint64_t& outMemory) = 0;
+            virtual void FreeDeviceMemory(uint32_t memoryTypeIndex, uint64_t memory) = 0;
+
+            // Map a whole block (nullptr if the memory type isn't host visible)
+            virtual void* MapDeviceMemory(uint64_t memory) = 0;
+            virtual void UnmapDeviceMemory(uint64_t memory) = 0;
+        };
+
+        // Resources that must not share a bufferImageGranularity page with each other
+        enum class GpuResourceKind : uint32_t {
+            Linear,     // Buffers, linear-tiling images
+            Optimal     // Optimal-tiling images
+        };
+
+        struct GpuAllocationRequest {
+            uint64_t size = 0;
+            uint64_t alignment = 1;
+            uint32_t memoryTypeIndex = 0;
+            GpuResourceKind kind = GpuResourceKind::Linear;
+            bool dedicated = false;     // Own device memory (large render targets); also used for oversized requests
+            void* userData = nullptr;   // Owner, handed to defragmentation callbacks
+        };
+
+        class GpuMemoryBlock;
+
+        // A sub-allocation (or a dedicated allocation) handed out by GpuAllocator
+        struct GpuAllocation {
+            uint64_t memory = 0;        // Backend memory handle (VkDeviceMemory for the Vulkan backend)
+            uint64_t offset = 0;        // Offset inside 'memory', aligned as requested
+            uint64_t size = 0;          // Requested size
+            uint32_t memoryTypeIndex = 0;
+            void* userData = nullptr;
+
+            // Allocator bookkeeping
+            GpuMemoryBlock* block = nullptr;
+            uint32_t node = TlsfAllocator::kInvalidNode;
+
+            bool IsValid() const { return block != nullptr; }
+            bool IsDedicated() const { return node == TlsfAllocator::kInvalidNode && block != nullptr; }
+        };
+
+        // Statistics of one heap (memory type + resource kind)
+        struct GpuHeapStats {
+            uint32_t memoryTypeIndex = 0;
+            GpuResourceKind kind = GpuResourceKind::Linear;
+            uint32_t blockCount = 0;
+            uint32_t dedicatedCount = 0;
+            uint32_t allocationCount = 0;   // Including dedicated allocations
+            uint64_t bytesAllocated = 0;    // Device memory held (blocks + dedicated)
+            uint64_t bytesUsed = 0;         // Requested by live allocations
+            uint64_t bytesWasted = 0;       // Alignment padding and leftovers absorbed into allocations
+        };
+
+        // GpuAllocator - sub-allocates device memory from per-memory-type block heaps
+        // Each heap owns a list of blocks (growing from blockSize / 8 up to blockSize) carved up with a
+        // TlsfAllocator, so thousands of buffers and textures share a handful of device allocations.
+        // Requests larger than half a block, or flagged dedicated, get their own device memory.
+        // When bufferImageGranularity > 1, linear and optimal resources live in separate heaps, so they can
+        // never share a granularity page. Thread-safe.
+        class FE_DEVICE_API GpuAllocator {
+        public:
+            static constexpr uint64_t kDefaultBlockSize = 256ull * 1024 * 1024;
+            static constexpr uint32_t kMaxMemoryTypes = 32;
+
+            // Called by Defragment for each planned move; copy the contents from 'from' to 'to' and rebind the
+            // resource, then return true (or false to keep the old location). Must not call into the allocator.
+            using MoveCallback = std::function<bool(const GpuAllocation& from, const GpuAllocation& to)>;
+
+            GpuAllocator(IGpuMemoryBackend* backend, uint64_t bufferImageGranularity = 1);
+            ~GpuAllocator();
+
+            GpuAllocator(const GpuAllocator&) = delete;
+            GpuAllocator& operator=(const GpuAllocator&) = delete;
+
+            // Maximum block size of a memory type (e.g. heap size / 8 for small heaps); default kDefaultBlockSize
+            void SetBlockSize(uint32_t memoryTypeIndex, uint64_t blockSize);
+            uint64_t GetBlockSize(uint32_t memoryTypeIndex) const;
+
+            bool Allocate(const GpuAllocationRequest& request, GpuAllocation& outAllocation);
+            void Free(GpuAllocation& allocation);
+
+            // Pointer to the allocation's first byte (nullptr if the memory isn't host visible)
+            // A block is mapped on first use and stays mapped until it is released, so this is cheap to call
+            void* Map(const GpuAllocation& allocation);
+
+            // Size of the device memory the allocation lives in (the whole block, or the dedicated allocation)
+            uint64_t GetMemorySize(const GpuAllocation& allocation) const;
+
+            // Compact heaps by moving allocations out of their emptiest blocks, then release the emptied blocks
+            // Returns the number of bytes moved (at most maxBytesToMove)
+            uint64_t Defragment(const MoveCallback& move, uint64_t maxBytesToMove = UINT64_MAX);
+
+            // Release blocks that have no allocations left (one empty block per heap is kept otherwise)
+            void ReleaseEmptyBlocks();
+
+            std::vector<GpuHeapStats> GetStats() const;
+            GpuHeapStats GetTotalStats() const;
+
+        private:
+            struct Heap {
+                std::vector<std::unique_ptr<GpuMemoryBlock>> blocks;
+                std::vector<std::unique_ptr<GpuMemoryBlock>> dedicated;
+            };
+
+            uint32_t GetHeapIndex(uint32_t memoryTypeIndex, GpuResourceKind kind) const;
+            GpuMemoryBlock* CreateBlock(uint32_t heapIndex, uint32_t memoryTypeIndex, uint64_t size, bool dedicated);
+            void DestroyBlock(GpuMemoryBlock* block);
+            bool AllocateFromBlock(GpuMemoryBlock* block, const GpuAllocationRequest& request, GpuAllocation& out);
+            void FreeLocked(GpuAllocation& allocation, bool keepEmptyBlock);
+            void ReleaseEmptyBlocksLocked();
+
+            IGpuMemoryBackend* m_Backend;
+            uint64_t m_BufferImageGranularity;
+            uint64_t m_BlockSizes[kMaxMemoryTypes];
+            Heap m_Heaps[kMaxMemoryTypes * 2];
+            mutable std::mutex m_Mutex;
+        };
+
+    } // namespace Device
+} // namespace FirstEngine
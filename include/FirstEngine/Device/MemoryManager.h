@@ -2,6 +2,7 @@
 
 #include "FirstEngine/Device/Export.h"
 #include "FirstEngine/Device/DeviceContext.h"
+#include "FirstEngine/Device/GpuAllocator.h"
 #include <vulkan/vulkan.h>
 #include <memory>
 #include <vector>
@@ -10,11 +11,13 @@ namespace FirstEngine {
     namespace Device {
 
         // Memory allocation information
+        // memory/offset are what to bind; the memory is usually shared with other resources (sub-allocated)
         FE_DEVICE_API struct MemoryAllocation {
             VkDeviceMemory memory;
             VkDeviceSize offset;
             VkDeviceSize size;
             uint32_t memoryTypeIndex;
+            GpuAllocation gpuAllocation;
         };
 
         // Buffer wrapper
@@ -25,17 +28,27 @@ namespace FirstEngine {
 
             // Create buffer
             bool Create(VkDeviceSize size, VkBufferUsageFlags usage, VkMemoryPropertyFlags properties);
+
+            // Create a buffer bound at 'offset' inside memory owned by someone else (a transient aliasing heap)
+            // Destroy() leaves that memory alone; placed buffers are never mapped
+            bool CreatePlaced(VkDeviceSize size, VkBufferUsageFlags usage, VkDeviceMemory memory, VkDeviceSize offset);
             
             // Destroy buffer
             void Destroy();
 
-            // Map memory (for CPU access)
+            // Host-visible buffers are mapped once in Create() and stay mapped until Destroy()
+            // Map returns the persistent pointer; Unmap keeps the mapping and flushes the whole buffer
             void* Map(VkDeviceSize offset = 0, VkDeviceSize size = VK_WHOLE_SIZE);
             void Unmap();
 
-            // Update data
+            // Make host writes in [offset, offset + size) visible to the device (no-op on coherent memory)
+            void Flush(VkDeviceSize offset = 0, VkDeviceSize size = VK_WHOLE_SIZE);
+
+            // Update data (memcpy into the persistent mapping + flush)
             void UpdateData(const void* data, VkDeviceSize size, VkDeviceSize offset = 0);
 
+            void* GetMappedPointer() const { return m_MappedData; }
+            bool IsHostCoherent() const { return m_HostCoherent; }
             VkBuffer GetBuffer() const { return m_Buffer; }
             VkDeviceSize GetSize() const { return m_Size; }
             const MemoryAllocation& GetAllocation() const { return m_Allocation; }
@@ -45,7 +58,8 @@ namespace FirstEngine {
             VkBuffer m_Buffer;
             VkDeviceSize m_Size;
             MemoryAllocation m_Allocation;
-            void* m_MappedData;
+            void* m_MappedData;               // Start of the buffer's memory (persistent, host-visible only)
+            bool m_HostCoherent;              // Memory type actually picked is HOST_COHERENT
             VkMemoryPropertyFlags m_MemoryProperties; // Store memory properties to check if mapping is allowed
         };
 
@@ -61,6 +75,17 @@ namespace FirstEngine {
                        VkImageTiling tiling, VkImageUsageFlags usage,
                        VkMemoryPropertyFlags properties);
 
+            // Create an image bound at 'offset' inside memory owned by someone else (a transient aliasing heap)
+            bool CreatePlaced(uint32_t width, uint32_t height, uint32_t mipLevels,
+                              VkSampleCountFlagBits numSamples, VkFormat format,
+                              VkImageTiling tiling, VkImageUsageFlags usage,
+                              VkDeviceMemory memory, VkDeviceSize offset);
+
+            // Create only the VkImage, with no memory bound (Create/CreatePlaced bind it afterwards)
+            bool CreateHandle(uint32_t width, uint32_t height, uint32_t mipLevels,
+                              VkSampleCountFlagBits numSamples, VkFormat format,
+                              VkImageTiling tiling, VkImageUsageFlags usage);
+
             // Create image view
             bool CreateImageView(VkImageViewType viewType, VkFormat format,
                                 VkImageAspectFlags aspectFlags);
@@ -88,6 +113,9 @@ namespace FirstEngine {
         };
 
         // Memory manager
+        // Owned by DeviceContext (one per device). Buffers and images are sub-allocated from per-memory-type
+        // blocks by a GpuAllocator instead of getting a vkAllocateMemory each, which keeps the allocation count
+        // far below maxMemoryAllocationCount and avoids per-resource driver overhead.
         class FE_DEVICE_API MemoryManager {
         public:
             MemoryManager(DeviceContext* context);
@@ -97,11 +125,28 @@ namespace FirstEngine {
             uint32_t FindMemoryType(uint32_t typeFilter, VkMemoryPropertyFlags properties);
 
             // Allocate memory
+            // kind: Optimal for optimal-tiling images (kept off pages shared with buffers, see bufferImageGranularity)
+            // dedicated: give the resource its own VkDeviceMemory (large render targets)
             bool AllocateMemory(VkMemoryRequirements requirements, VkMemoryPropertyFlags properties,
-                               MemoryAllocation& allocation);
+                               MemoryAllocation& allocation, GpuResourceKind kind = GpuResourceKind::Linear,
+                               bool dedicated = false);
 
             // Free memory
-            void FreeMemory(const MemoryAllocation& allocation);
+            void FreeMemory(MemoryAllocation& allocation);
+
+            // Host pointer to the allocation's first byte (nullptr if not host visible)
+            // Blocks stay mapped once mapped, so there is no unmap
+            void* MapMemory(const MemoryAllocation& allocation);
+
+            // Flush host writes to non-coherent memory; offset/size are relative to the allocation and are widened
+            // to nonCoherentAtomSize (non-coherent allocations are atom aligned, so neighbours are never touched)
+            void FlushMemory(const MemoryAllocation& allocation, VkDeviceSize offset, VkDeviceSize size);
+            bool IsHostCoherent(const MemoryAllocation& allocation) const;
+
+            // Allocator access (statistics, defragmentation)
+            GpuAllocator& GetAllocator() { return *m_Allocator; }
+            std::vector<GpuHeapStats> GetStats() const { return m_Allocator->GetStats(); }
+            void PrintStats() const;
 
             // Create buffer
             std::unique_ptr<Buffer> CreateBuffer(VkDeviceSize size, VkBufferUsageFlags usage,
@@ -113,8 +158,19 @@ namespace FirstEngine {
                                               VkImageTiling tiling, VkImageUsageFlags usage,
                                               VkMemoryPropertyFlags properties);
 
+            // Memory requirements of a buffer/image without keeping it around
+            // (used to size heaps that several aliased resources are placed into)
+            VkMemoryRequirements GetBufferMemoryRequirements(VkDeviceSize size, VkBufferUsageFlags usage);
+            VkMemoryRequirements GetImageMemoryRequirements(uint32_t width, uint32_t height, uint32_t mipLevels,
+                                                            VkSampleCountFlagBits numSamples, VkFormat format,
+                                                            VkImageTiling tiling, VkImageUsageFlags usage);
+
         private:
             DeviceContext* m_Context;
+            VkPhysicalDeviceMemoryProperties m_MemoryProperties;
+            VkDeviceSize m_NonCoherentAtomSize;
+            std::unique_ptr<IGpuMemoryBackend> m_Backend;
+            std::unique_ptr<GpuAllocator> m_Allocator;
         };
 
     } // namespace Device
@@ -4,6 +4,9 @@
 #include "FirstEngine/RHI/IDevice.h"
 #include "FirstEngine/Device/VulkanRenderer.h"
 #include <memory>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
 
 namespace FirstEngine {
     namespace Device {
@@ -19,6 +22,7 @@ namespace FirstEngine {
             void Shutdown() override;
 
             std::unique_ptr<RHI::ICommandBuffer> CreateCommandBuffer() override;
+            std::unique_ptr<RHI::ICommandBuffer> CreateSecondaryCommandBuffer() override;
             std::unique_ptr<RHI::IRenderPass> CreateRenderPass(const RHI::RenderPassDescription& desc) override;
             std::unique_ptr<RHI::IFramebuffer> CreateFramebuffer(
                 RHI::IRenderPass* renderPass,
@@ -31,6 +35,15 @@ namespace FirstEngine {
             std::unique_ptr<RHI::IBuffer> CreateBuffer(
                 uint64_t size, RHI::BufferUsageFlags usage, RHI::MemoryPropertyFlags properties) override;
             std::unique_ptr<RHI::IImage> CreateImage(const RHI::ImageDescription& desc) override;
+            RHI::MemoryRequirements GetImageMemoryRequirements(const RHI::ImageDescription& desc) override;
+            RHI::MemoryRequirements GetBufferMemoryRequirements(uint64_t size, RHI::BufferUsageFlags usage) override;
+            RHI::MemoryHeapHandle CreateMemoryHeap(uint64_t size, uint32_t memoryTypeBits,
+                                                   RHI::MemoryPropertyFlags properties) override;
+            void DestroyMemoryHeap(RHI::MemoryHeapHandle heap) override;
+            std::unique_ptr<RHI::IImage> CreatePlacedImage(const RHI::ImageDescription& desc,
+                                                           RHI::MemoryHeapHandle heap, uint64_t offset) override;
+            std::unique_ptr<RHI::IBuffer> CreatePlacedBuffer(uint64_t size, RHI::BufferUsageFlags usage,
+                                                             RHI::MemoryHeapHandle heap, uint64_t offset) override;
             std::unique_ptr<RHI::ISwapchain> CreateSwapchain(
                 void* windowHandle, const RHI::SwapchainDescription& desc) override;
             std::unique_ptr<RHI::IShaderModule> CreateShaderModule(
@@ -50,6 +63,7 @@ namespace FirstEngine {
 
             void WaitForFence(RHI::FenceHandle fence, uint64_t timeout = UINT64_MAX) override;
             void ResetFence(RHI::FenceHandle fence) override;
+            bool IsFenceSignaled(RHI::FenceHandle fence) override;
 
             RHI::QueueHandle GetGraphicsQueue() const override;
             RHI::QueueHandle GetPresentQueue() const override;
@@ -87,10 +101,18 @@ namespace FirstEngine {
             void* GetDefaultSampler();
 
         private:
+            // Command pool of the calling thread (created on first use); VK_NULL_HANDLE on failure
+            VkCommandPool GetThreadCommandPool();
+            void DestroyThreadCommandPools();
+
             std::unique_ptr<VulkanRenderer> m_Renderer;
             std::unique_ptr<Core::Window> m_Window;
             RHI::DeviceInfo m_DeviceInfo;
             VkSampler m_DefaultSampler = VK_NULL_HANDLE; // Cached default sampler
+
+            // Vulkan command pools are externally synchronized: each recording thread gets its own
+            std::mutex m_ThreadCommandPoolsMutex;
+            std::unordered_map<std::thread::id, VkCommandPool> m_ThreadCommandPools;
         };
 
     } // namespace Device
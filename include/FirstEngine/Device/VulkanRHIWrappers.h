@@ -30,20 +30,26 @@ namespace FirstEngine {
         VkPrimitiveTopology ConvertPrimitiveTopology(RHI::PrimitiveTopology topology);
         VkCullModeFlags ConvertCullMode(RHI::CullMode cullMode);
         VkCompareOp ConvertCompareOp(RHI::CompareOp compareOp);
-        VkImageLayout ConvertImageLayout(RHI::Format format); // Temporary: should use dedicated Layout enum later
+        VkImageLayout ConvertImageLayout(RHI::ImageLayout layout);
         VkDescriptorType ConvertDescriptorType(RHI::DescriptorType type);
 
         // Vulkan implementation of RHI interface wrapper classes
         class FE_DEVICE_API VulkanCommandBuffer : public RHI::ICommandBuffer {
         public:
-            VulkanCommandBuffer(DeviceContext* context);
+            // commandPool: VK_NULL_HANDLE allocates from the device context's pool
+            VulkanCommandBuffer(DeviceContext* context, VkCommandPool commandPool = VK_NULL_HANDLE,
+                                VkCommandBufferLevel level = VK_COMMAND_BUFFER_LEVEL_PRIMARY);
             ~VulkanCommandBuffer() override;
 
             void Begin() override;
             void End() override;
+            void BeginSecondary(RHI::IRenderPass* renderPass, RHI::IFramebuffer* framebuffer) override;
+            bool IsSecondary() const override { return m_Level == VK_COMMAND_BUFFER_LEVEL_SECONDARY; }
             void BeginRenderPass(RHI::IRenderPass* renderPass, RHI::IFramebuffer* framebuffer,
-                               const std::vector<float>& clearColors, float clearDepth, uint32_t clearStencil) override;
+                               const std::vector<float>& clearColors, float clearDepth, uint32_t clearStencil,
+                               RHI::SubpassContents contents) override;
             void EndRenderPass() override;
+            void ExecuteCommands(const std::vector<RHI::ICommandBuffer*>& commandBuffers) override;
             void BindPipeline(RHI::IPipeline* pipeline) override;
             void BindVertexBuffers(uint32_t firstBinding, const std::vector<RHI::IBuffer*>& buffers,
                                   const std::vector<uint64_t>& offsets) override;
@@ -55,9 +61,12 @@ namespace FirstEngine {
                            int32_t vertexOffset, uint32_t firstInstance) override;
             void SetViewport(float x, float y, float width, float height, float minDepth, float maxDepth) override;
             void SetScissor(int32_t x, int32_t y, uint32_t width, uint32_t height) override;
-            void TransitionImageLayout(RHI::IImage* image, RHI::Format oldLayout, RHI::Format newLayout, uint32_t mipLevels) override;
-            void CopyBuffer(RHI::IBuffer* src, RHI::IBuffer* dst, uint64_t size) override;
-            void CopyBufferToImage(RHI::IBuffer* buffer, RHI::IImage* image, uint32_t width, uint32_t height) override;
+            void TransitionImageLayout(RHI::IImage* image, RHI::ImageLayout newLayout, uint32_t mipLevels) override;
+            void PipelineBarrier(const RHI::PipelineBarrierDescription& barrier) override;
+            void CopyBuffer(RHI::IBuffer* src, RHI::IBuffer* dst, uint64_t size,
+                            uint64_t srcOffset, uint64_t dstOffset) override;
+            void CopyBufferToImage(RHI::IBuffer* buffer, RHI::IImage* image, uint32_t width, uint32_t height,
+                                   uint64_t bufferOffset, uint32_t mipLevel) override;
             void PushConstants(RHI::IPipeline* pipeline, RHI::ShaderStage stageFlags, uint32_t offset, uint32_t size, const void* data) override;
 
             VkCommandBuffer GetVkCommandBuffer() const { return m_VkCommandBuffer; }
@@ -65,6 +74,8 @@ namespace FirstEngine {
 
         private:
             DeviceContext* m_Context;
+            VkCommandPool m_CommandPool;
+            VkCommandBufferLevel m_Level;
             VkCommandBuffer m_VkCommandBuffer;
             bool m_IsRecording;
             VkPipelineLayout m_CurrentPipelineLayout; // Track current pipeline layout for descriptor set binding
@@ -125,6 +136,8 @@ namespace FirstEngine {
             void* Map() override;
             void Unmap() override;
             void UpdateData(const void* data, uint64_t size, uint64_t offset = 0) override;
+            void* GetMappedPointer() const override;
+            void FlushMappedRange(uint64_t offset, uint64_t size) override;
 
             VkBuffer GetVkBuffer() const;
 
@@ -154,6 +167,7 @@ namespace FirstEngine {
             uint32_t GetWidth() const override;
             uint32_t GetHeight() const override;
             RHI::Format GetFormat() const override;
+            uint32_t GetMipLevels() const override;
             RHI::IImageView* CreateImageView() override;
             void DestroyImageView(RHI::IImageView* imageView) override;
 
@@ -37,6 +37,7 @@ namespace FirstEngine {
             uint32_t GetPresentQueueFamily() const { return m_PresentQueueFamily; }
             DeviceContext* GetDeviceContext() const { return m_DeviceContext.get(); }
             bool IsDescriptorIndexingSupported() const { return m_DescriptorIndexingSupported; }
+            bool IsTextureCompressionBCSupported() const { return m_TextureCompressionBCSupported; }
 
         private:
             void CreateInstance();
@@ -85,6 +86,9 @@ namespace FirstEngine {
             // Track if descriptor indexing extension and features are supported
             bool m_DescriptorIndexingSupported = false;
 
+            // BC1-BC7 textures (cooked .fetex); without it RenderTexture falls back to uncompressed uploads
+            bool m_TextureCompressionBCSupported = false;
+
             static VKAPI_ATTR VkBool32 VKAPI_CALL DebugCallback(
                 VkDebugUtilsMessageSeverityFlagBitsEXT messageSeverity,
                 VkDebugUtilsMessageTypeFlagsEXT messageType,
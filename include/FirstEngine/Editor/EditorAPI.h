@@ -56,6 +56,9 @@ FE_CORE_API void EditorAPI_UnloadResource(void* engine, const char* resourcePath
 // Configuration
 FE_CORE_API void EditorAPI_SetRenderConfig(void* engine, int width, int height, float renderScale);
 
+// Debug: write the compiled FrameGraph after the next render (".json" for JSON, Graphviz otherwise)
+FE_CORE_API void EditorAPI_ExportFrameGraph(void* engine, const char* filePath);
+
 // Console output redirection
 // Callback function type: void callback(const char* message, int isError)
 // message: The output message
@@ -7,6 +7,9 @@ namespace FirstEngine {
     namespace RHI {
 
         // Buffer interface
+        // Host-visible buffers are mapped once at creation and stay mapped for their lifetime:
+        // write through GetMappedPointer() and call FlushMappedRange() for the bytes written
+        // (a no-op on host-coherent memory). Map()/Unmap() remain for existing callers; Unmap() flushes.
         class FE_RHI_API IBuffer {
         public:
             virtual ~IBuffer() = default;
@@ -14,6 +17,10 @@ namespace FirstEngine {
             virtual void* Map() = 0;
             virtual void Unmap() = 0;
             virtual void UpdateData(const void* data, uint64_t size, uint64_t offset = 0) = 0;
+
+            // Persistent mapping (nullptr for device-local buffers)
+            virtual void* GetMappedPointer() const = 0;
+            virtual void FlushMappedRange(uint64_t offset, uint64_t size) = 0;
         };
 
     } // namespace RHI
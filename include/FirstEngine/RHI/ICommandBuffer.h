@@ -23,15 +23,25 @@ namespace FirstEngine {
             virtual void Begin() = 0;
             virtual void End() = 0;
 
+            // Begin recording a secondary command buffer that continues subpass 0 of renderPass on framebuffer
+            // Secondary buffers inherit no dynamic state: set viewport/scissor and bind everything they use
+            virtual void BeginSecondary(IRenderPass* renderPass, IFramebuffer* framebuffer) = 0;
+            virtual bool IsSecondary() const = 0;
+
             // Render pass
+            // With SubpassContents::SecondaryCommandBuffers the pass may only contain ExecuteCommands
             virtual void BeginRenderPass(
                 IRenderPass* renderPass,
                 IFramebuffer* framebuffer,
                 const std::vector<float>& clearColors,
                 float clearDepth = 1.0f,
-                uint32_t clearStencil = 0) = 0;
+                uint32_t clearStencil = 0,
+                SubpassContents contents = SubpassContents::Inline) = 0;
             virtual void EndRenderPass() = 0;
 
+            // Run recorded secondary command buffers, in order (primary command buffers only)
+            virtual void ExecuteCommands(const std::vector<ICommandBuffer*>& commandBuffers) = 0;
+
             // Pipeline binding
             virtual void BindPipeline(IPipeline* pipeline) = 0;
 
@@ -60,18 +70,20 @@ namespace FirstEngine {
                                     float minDepth = 0.0f, float maxDepth = 1.0f) = 0;
             virtual void SetScissor(int32_t x, int32_t y, uint32_t width, uint32_t height) = 0;
 
-            // Image layout transition
-            // accessMode: Read -> SHADER_READ_ONLY_OPTIMAL, Write -> COLOR_ATTACHMENT_OPTIMAL or DEPTH_STENCIL_ATTACHMENT_OPTIMAL
-            virtual void TransitionImageLayout(
-                IImage* image,
-                Format oldLayout,
-                Format newLayout,
-                uint32_t mipLevels = 1,
-                ImageAccessMode accessMode = ImageAccessMode::Read) = 0;
-
-            // Buffer copy
-            virtual void CopyBuffer(IBuffer* src, IBuffer* dst, uint64_t size) = 0;
-            virtual void CopyBufferToImage(IBuffer* buffer, IImage* image, uint32_t width, uint32_t height) = 0;
+            // Image layout transition from the image's last known layout (one barrier per call)
+            virtual void TransitionImageLayout(IImage* image, ImageLayout newLayout, uint32_t mipLevels = 1) = 0;
+
+            // Record all transitions and the optional memory dependency as a single pipeline barrier
+            // Not allowed inside a render pass.
+            virtual void PipelineBarrier(const PipelineBarrierDescription& barrier) = 0;
+
+            // Buffer copy (offsets let many copies share one staging buffer)
+            virtual void CopyBuffer(IBuffer* src, IBuffer* dst, uint64_t size,
+                                    uint64_t srcOffset = 0, uint64_t dstOffset = 0) = 0;
+            // Copies tightly packed texels (or 4x4 blocks for BC formats) into one mip level; width/height are
+            // that level's size
+            virtual void CopyBufferToImage(IBuffer* buffer, IImage* image, uint32_t width, uint32_t height,
+                                           uint64_t bufferOffset = 0, uint32_t mipLevel = 0) = 0;
 
             // Push constants
             virtual void PushConstants(
@@ -33,6 +33,11 @@ namespace FirstEngine {
             // Command buffer creation
             virtual std::unique_ptr<ICommandBuffer> CreateCommandBuffer() = 0;
 
+            // Secondary command buffer for recording on the calling thread (any thread)
+            // It comes from a command pool owned by the calling thread, so record it on that thread only; it may be
+            // destroyed on another thread as long as the owning thread isn't allocating or recording at that time
+            virtual std::unique_ptr<ICommandBuffer> CreateSecondaryCommandBuffer() = 0;
+
             // Render pass creation
             virtual std::unique_ptr<IRenderPass> CreateRenderPass(const RenderPassDescription& desc) = 0;
 
@@ -56,6 +61,22 @@ namespace FirstEngine {
             virtual std::unique_ptr<IImage> CreateImage(
                 const ImageDescription& desc) = 0;
 
+            // Memory aliasing: resources placed into a heap don't own memory, so resources that are never alive
+            // at the same time can share bytes. The heap must outlive everything placed in it, and the first use
+            // of a resource that takes over bytes from another needs a PipelineBarrier with memoryBarrier set
+            // (images start from ImageLayout::Undefined).
+            virtual MemoryRequirements GetImageMemoryRequirements(const ImageDescription& desc) = 0;
+            virtual MemoryRequirements GetBufferMemoryRequirements(uint64_t size, BufferUsageFlags usage) = 0;
+            // memoryTypeBits: intersection of the requirements of everything that will be placed in the heap
+            virtual MemoryHeapHandle CreateMemoryHeap(uint64_t size, uint32_t memoryTypeBits,
+                                                      MemoryPropertyFlags properties) = 0;
+            virtual void DestroyMemoryHeap(MemoryHeapHandle heap) = 0;
+            // offset must be aligned to the resource's MemoryRequirements::alignment
+            virtual std::unique_ptr<IImage> CreatePlacedImage(const ImageDescription& desc,
+                                                              MemoryHeapHandle heap, uint64_t offset) = 0;
+            virtual std::unique_ptr<IBuffer> CreatePlacedBuffer(uint64_t size, BufferUsageFlags usage,
+                                                                MemoryHeapHandle heap, uint64_t offset) = 0;
+
             // Swapchain creation
             virtual std::unique_ptr<ISwapchain> CreateSwapchain(
                 void* windowHandle, const SwapchainDescription& desc) = 0;
@@ -82,6 +103,8 @@ namespace FirstEngine {
             // Fence operations
             virtual void WaitForFence(FenceHandle fence, uint64_t timeout = UINT64_MAX) = 0;
             virtual void ResetFence(FenceHandle fence) = 0;
+            // Non-blocking poll; true once the fence has been signaled
+            virtual bool IsFenceSignaled(FenceHandle fence) = 0;
 
             // Get queues
             virtual QueueHandle GetGraphicsQueue() const = 0;
@@ -19,6 +19,7 @@ namespace FirstEngine {
             virtual uint32_t GetWidth() const = 0;
             virtual uint32_t GetHeight() const = 0;
             virtual Format GetFormat() const = 0;
+            virtual uint32_t GetMipLevels() const = 0;
             virtual IImageView* CreateImageView() = 0;
             virtual void DestroyImageView(IImageView* imageView) = 0;
         };
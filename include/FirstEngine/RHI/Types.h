@@ -24,6 +24,7 @@ namespace FirstEngine {
         using DescriptorSetLayoutHandle = void*;
         using DescriptorSetHandle = void*;
         using DescriptorPoolHandle = void*;
+        using MemoryHeapHandle = void*;
 
         // Enum types
         enum class ShaderStage : uint32_t {
@@ -63,11 +64,22 @@ namespace FirstEngine {
             TransferDst = 0x00000080,
         };
 
-        // Image access mode for layout transitions
-        // Used by FrameGraph to automatically determine layout transitions based on resource access
-        enum class ImageAccessMode : uint32_t {
-            Read,   // Image is read by shaders -> SHADER_READ_ONLY_OPTIMAL
-            Write,  // Image is written as attachment -> COLOR_ATTACHMENT_OPTIMAL or DEPTH_STENCIL_ATTACHMENT_OPTIMAL
+        // Image layouts (what an image is currently set up for)
+        // FrameGraph derives them from AddReadResource/AddWriteResource when it compiles
+        enum class ImageLayout : uint32_t {
+            Undefined,                  // Contents may be discarded
+            ColorAttachment,
+            DepthStencilAttachment,
+            ShaderReadOnly,
+            TransferSrc,
+            TransferDst,
+            Present,                    // Swapchain images only
+        };
+
+        // How the commands of a render pass are provided
+        enum class SubpassContents : uint32_t {
+            Inline,                     // Recorded directly into the primary command buffer
+            SecondaryCommandBuffers,    // Recorded into secondary command buffers, run with ExecuteCommands
         };
 
         // Descriptor types
@@ -78,6 +90,7 @@ namespace FirstEngine {
             StorageImage = 3,
             StorageBuffer = 4,
             Sampler = 5,                // Sampler only (used with separate image)
+            UniformBufferDynamic = 6,   // Uniform buffer whose offset is given when the set is bound
         };
 
         enum class Format : uint32_t {
@@ -155,6 +168,15 @@ namespace FirstEngine {
             // Depth formats
             D32_SFLOAT = 126,
             D24_UNORM_S8_UINT = 130,
+
+            // Block-compressed formats (4x4 texel blocks, 8 or 16 bytes each)
+            BC1_RGBA_UNORM = 133,         // 8 bytes per block, 1-bit alpha
+            BC1_RGBA_SRGB = 134,
+            BC3_UNORM = 137,              // 16 bytes per block, BC1 color + interpolated alpha
+            BC3_SRGB = 138,
+            BC5_UNORM = 141,              // 16 bytes per block, two BC4 channels (normal map XY)
+            BC7_UNORM = 145,              // 16 bytes per block, RGBA
+            BC7_SRGB = 146,
         };
 
         enum class PrimitiveTopology : uint32_t {
@@ -189,6 +211,7 @@ namespace FirstEngine {
             uint32_t driverVersion;
             uint64_t deviceMemory;
             uint64_t hostMemory;
+            bool textureCompressionBC = false;    // BC1-BC7 images can be sampled
         };
 
         struct AttachmentDescription {
@@ -198,8 +221,8 @@ namespace FirstEngine {
             bool storeOpStore = true;
             bool stencilLoadOpClear = false;
             bool stencilStoreOpStore = false;
-            Format initialLayout = Format::Undefined;
-            Format finalLayout = Format::Undefined;
+            ImageLayout initialLayout = ImageLayout::Undefined;    // Undefined: contents are not loaded
+            ImageLayout finalLayout = ImageLayout::Undefined;      // Undefined: stays in the attachment layout
         };
 
         struct RenderPassDescription {
@@ -219,6 +242,32 @@ namespace FirstEngine {
             MemoryPropertyFlags memoryProperties;
         };
 
+        // What a resource needs from the memory it is placed into (see IDevice::CreatePlacedImage)
+        struct MemoryRequirements {
+            uint64_t size = 0;
+            uint64_t alignment = 1;
+            uint32_t memoryTypeBits = 0;    // Bit i set: memory type i can back the resource
+        };
+
+        // Layout transition of one image in a pipeline barrier
+        // oldLayout is taken as given (Undefined discards the contents); the caller tracks layouts
+        struct ImageBarrier {
+            IImage* image = nullptr;
+            ImageLayout oldLayout = ImageLayout::Undefined;
+            ImageLayout newLayout = ImageLayout::Undefined;
+            uint32_t mipLevels = 1;
+        };
+
+        // Everything that has to be synchronized at one point of a command buffer, recorded as one barrier
+        struct PipelineBarrierDescription {
+            std::vector<ImageBarrier> imageBarriers;
+            // Global memory dependency: all earlier writes are finished and visible before any later access.
+            // Needed for buffer hazards and for memory handed over between aliased resources.
+            bool memoryBarrier = false;
+
+            bool IsEmpty() const { return imageBarriers.empty() && !memoryBarrier; }
+        };
+
         struct SwapchainDescription {
             uint32_t width;
             uint32_t height;
@@ -3,14 +3,26 @@
 #include "FirstEngine/Renderer/Export.h"
 #include "FirstEngine/Renderer/RenderCommandList.h"
 #include "FirstEngine/RHI/ICommandBuffer.h"
+#include <cstddef>
+#include <memory>
+#include <vector>
 
 namespace FirstEngine {
+    namespace RHI {
+        class IDevice;
+    }
+
     namespace Renderer {
 
         // Command recorder - converts RenderCommandList to actual CommandBuffer commands
         // This provides the bridge between data structures and GPU command recording
         class FE_RENDERER_API CommandRecorder {
         public:
+            // Render passes with fewer draws are recorded inline (a secondary buffer isn't worth it)
+            static constexpr uint32_t kMinDrawsForSecondary = 64;
+            // Target number of draws per secondary command buffer
+            static constexpr uint32_t kDrawsPerSecondary = 512;
+
             CommandRecorder();
             ~CommandRecorder();
 
@@ -21,6 +33,20 @@ namespace FirstEngine {
                 const RenderCommandList& commandList
             );
 
+            // Record a RenderCommandList, recording the contents of large render passes into secondary command
+            // buffers on the worker pool (passes split into draw ranges); the primary runs them in list order
+            // Falls back to RecordCommands when there is no worker pool or parallel recording is disabled
+            // outSecondaryBuffers receives the secondaries; keep them alive until the primary has finished executing
+            void RecordCommandsParallel(
+                RHI::IDevice* device,
+                RHI::ICommandBuffer* commandBuffer,
+                const RenderCommandList& commandList,
+                std::vector<std::unique_ptr<RHI::ICommandBuffer>>& outSecondaryBuffers
+            );
+
+            void SetParallelRecordingEnabled(bool enabled) { m_ParallelRecordingEnabled = enabled; }
+            bool IsParallelRecordingEnabled() const { return m_ParallelRecordingEnabled; }
+
             // Record a single command
             // renderPassDepth: current depth of active render passes (for validation)
             // Returns true if command was successfully recorded, false otherwise
@@ -31,6 +57,39 @@ namespace FirstEngine {
             );
 
         private:
+            // A slice of one render pass's commands, recorded into one secondary command buffer
+            struct SecondaryRange {
+                size_t beginRenderPass = 0;         // Index of the pass's BeginRenderPass command
+                size_t first = 0;                   // [first, last) commands recorded into the secondary
+                size_t last = 0;
+                // State bound by earlier commands of the pass, re-bound at the start of the secondary
+                std::vector<size_t> inheritedState;
+            };
+
+            // Record commands [first, last) into cmd, tracking render pass nesting across calls
+            void RecordCommandRange(
+                RHI::ICommandBuffer* commandBuffer,
+                const std::vector<RenderCommand>& commands,
+                size_t first, size_t last,
+                int& renderPassDepth,
+                bool& skipUntilEndRenderPass
+            );
+
+            // Split the pass starting at beginIndex into ranges (appended to outRanges); returns the EndRenderPass index
+            static size_t PlanRenderPass(
+                const std::vector<RenderCommand>& commands,
+                size_t beginIndex,
+                size_t workerCount,
+                std::vector<SecondaryRange>& outRanges
+            );
+
+            // Runs on a worker thread; returns nullptr on failure
+            static std::unique_ptr<RHI::ICommandBuffer> RecordSecondary(
+                RHI::IDevice* device,
+                const std::vector<RenderCommand>& commands,
+                const SecondaryRange& range
+            );
+
             // Helper methods for each command type
             void RecordBindPipeline(RHI::ICommandBuffer* cmd, const RenderCommand::BindPipelineParams& params);
             void RecordBindDescriptorSets(RHI::ICommandBuffer* cmd, const RenderCommand::BindDescriptorSetsParams& params);
@@ -40,12 +99,16 @@ namespace FirstEngine {
             void RecordDrawIndexed(RHI::ICommandBuffer* cmd, const RenderCommand::DrawIndexedParams& params);
             void RecordTransitionImageLayout(RHI::ICommandBuffer* cmd, const RenderCommand::TransitionImageLayoutParams& params);
             // Returns true if BeginRenderPass succeeded, false otherwise
-            bool RecordBeginRenderPass(RHI::ICommandBuffer* cmd, const RenderCommand::BeginRenderPassParams& params);
+            // With SecondaryCommandBuffers contents the viewport/scissor are left to the secondaries
+            bool RecordBeginRenderPass(RHI::ICommandBuffer* cmd, const RenderCommand::BeginRenderPassParams& params,
+                                       RHI::SubpassContents contents = RHI::SubpassContents::Inline);
             void RecordEndRenderPass(RHI::ICommandBuffer* cmd, const RenderCommand::EndRenderPassParams& params);
             void RecordPushConstants(RHI::ICommandBuffer* cmd, const RenderCommand::PushConstantsParams& params);
             
             // Track current bound pipeline for PushConstants
             RHI::IPipeline* m_CurrentPipeline = nullptr;
+
+            bool m_ParallelRecordingEnabled = true;
         };
 
     } // namespace Renderer
@@ -41,6 +41,28 @@ namespace FirstEngine {
         class FrameGraphResource;
         class FrameGraphBuilder;
 
+        // Dense integer handles into the FrameGraph's resource and node arrays, handed out when a resource or node
+        // is declared. Resource handles stay valid for the lifetime of the FrameGraph (resources persist across
+        // frames); node handles are positions in declaration order and valid until the next Clear().
+        // Names are only kept for lookups at declaration time, debugging and serialization.
+        struct FGResourceHandle {
+            static constexpr uint32_t kInvalid = 0xFFFFFFFF;
+            uint32_t index = kInvalid;
+
+            bool IsValid() const { return index != kInvalid; }
+            bool operator==(const FGResourceHandle& other) const { return index == other.index; }
+            bool operator!=(const FGResourceHandle& other) const { return index != other.index; }
+        };
+
+        struct FGNodeHandle {
+            static constexpr uint32_t kInvalid = 0xFFFFFFFF;
+            uint32_t index = kInvalid;
+
+            bool IsValid() const { return index != kInvalid; }
+            bool operator==(const FGNodeHandle& other) const { return index == other.index; }
+            bool operator!=(const FGNodeHandle& other) const { return index != other.index; }
+        };
+
         // FrameGraph resource description base class
         // Concrete resource types (AttachmentResource, BufferResource) inherit from this
         class FE_RENDERER_API ResourceDescription {
@@ -62,11 +84,17 @@ namespace FirstEngine {
             RHI::BufferUsageFlags GetBufferUsage() const { return m_BufferUsage; }
             
             // Resource lifecycle
+            // After FrameGraph::Compile these are positions in the execution order (UINT32_MAX: unused this frame)
             uint32_t GetFirstPass() const { return m_FirstPass; }
             uint32_t GetLastPass() const { return m_LastPass; }
             void SetFirstPass(uint32_t pass) { m_FirstPass = pass; }
             void SetLastPass(uint32_t pass) { m_LastPass = pass; }
 
+            // Transient resources are written and consumed within one frame, so their memory may be shared with
+            // other transient resources. Clear it for contents that must survive the frame.
+            bool IsTransient() const { return m_Transient; }
+            void SetTransient(bool transient) { m_Transient = transient; }
+
         protected:
             ResourceType m_Type;
             std::string m_Name;
@@ -84,6 +112,7 @@ namespace FirstEngine {
             // Resource lifecycle
             uint32_t m_FirstPass = 0;
             uint32_t m_LastPass = 0;
+            bool m_Transient = true;
         };
 
         // Attachment resource (for G-Buffer, final output, etc.)
@@ -121,17 +150,21 @@ namespace FirstEngine {
             const std::string& GetName() const { return m_Name; }
             uint32_t GetIndex() const { return m_Index; }
             void SetIndex(uint32_t index) { m_Index = index; }
+            FGNodeHandle GetHandle() const { return FGNodeHandle{ m_Index }; }
 
             // Set FrameGraph reference (for automatic resource management)
             void SetFrameGraph(FrameGraph* frameGraph) { m_FrameGraph = frameGraph; }
             FrameGraph* GetFrameGraph() const { return m_FrameGraph; }
 
             // Resource access
-            // If FrameGraph is set, these methods will automatically add and allocate resources
-            void AddReadResource(const std::string& resourceName, const ResourceDescription* resourceDesc = nullptr);
-            void AddWriteResource(const std::string& resourceName, const ResourceDescription* resourceDesc = nullptr);
-            const std::vector<std::string>& GetReadResources() const { return m_ReadResources; }
-            const std::vector<std::string>& GetWriteResources() const { return m_WriteResources; }
+            // If FrameGraph is set, these methods will automatically add resources (Compile allocates them)
+            // The returned handle can be kept and used with FrameGraphBuilder in OnDraw instead of the name
+            FGResourceHandle AddReadResource(const std::string& resourceName, const ResourceDescription* resourceDesc = nullptr);
+            FGResourceHandle AddWriteResource(const std::string& resourceName, const ResourceDescription* resourceDesc = nullptr);
+            void AddReadResource(FGResourceHandle resource);
+            void AddWriteResource(FGResourceHandle resource);
+            const std::vector<FGResourceHandle>& GetReadResources() const { return m_ReadResources; }
+            const std::vector<FGResourceHandle>& GetWriteResources() const { return m_WriteResources; }
             
             // Clear resource lists (called at the start of each frame's OnBuild)
             void ClearResources() {
@@ -147,6 +180,14 @@ namespace FirstEngine {
             void AddDependency(uint32_t nodeIndex);
             const std::vector<uint32_t>& GetDependencies() const { return m_Dependencies; }
 
+            // Passes with side effects outside the graph (readbacks, external writes) are never culled
+            void SetSideEffects(bool sideEffects) { m_SideEffects = sideEffects; }
+            bool HasSideEffects() const { return m_SideEffects; }
+
+            // Set by FrameGraph::BuildExecutionPlan: nothing this pass writes reaches an output
+            bool IsCulled() const { return m_Culled; }
+            void SetCulled(bool culled) { m_Culled = culled; }
+
             // Execution callback - now returns RenderCommandList instead of writing to CommandBuffer
             // The second parameter is optional scene render commands (for geometry/forward passes)
             using ExecuteCallback = std::function<RenderCommandList(FrameGraphBuilder&, const RenderCommandList*)>;
@@ -179,13 +220,23 @@ namespace FirstEngine {
             void SetCachedRenderPassDescription(const RHI::RenderPassDescription& desc) { m_CachedRenderPassDesc = desc; }
             const RHI::RenderPassDescription* GetCachedRenderPassDescription() const { return m_CachedRenderPassDesc.has_value() ? &m_CachedRenderPassDesc.value() : nullptr; }
 
+            // Hash of everything the render pass and framebuffer depend on (attachments and their layouts), set by
+            // FrameGraph::Compile, and the hash the current ones were created for. While both match, Execute
+            // reuses them without building and comparing a RenderPassDescription.
+            void SetCompiledHash(uint64_t hash) { m_CompiledHash = hash; }
+            uint64_t GetCompiledHash() const { return m_CompiledHash; }
+            void SetFramebufferHash(uint64_t hash) { m_FramebufferHash = hash; }
+            uint64_t GetFramebufferHash() const { return m_FramebufferHash; }
+
         protected:
             std::string m_Name;
             uint32_t m_Index;
             RenderPassType m_Type; // Node type using enum
-            std::vector<std::string> m_ReadResources;
-            std::vector<std::string> m_WriteResources;
+            std::vector<FGResourceHandle> m_ReadResources;
+            std::vector<FGResourceHandle> m_WriteResources;
             std::vector<uint32_t> m_Dependencies;
+            bool m_SideEffects = false;
+            bool m_Culled = false;
             ExecuteCallback m_ExecuteCallback;
             FrameGraph* m_FrameGraph = nullptr; // Reference to FrameGraph for automatic resource management
             
@@ -198,6 +249,8 @@ namespace FirstEngine {
             
             // Cached render pass description for comparison (to avoid unnecessary recreation)
             std::optional<RHI::RenderPassDescription> m_CachedRenderPassDesc;
+            uint64_t m_CompiledHash = 0;
+            uint64_t m_FramebufferHash = 0;
         };
 
         // FrameGraph resource
@@ -214,17 +267,27 @@ namespace FirstEngine {
             void* GetHandle() const { return m_Handle; }
 
             // Actual resource object (set after compilation)
-            void SetRHIResource(RHI::IImage* image) { m_RHIImage = image; }
+            void SetRHIResource(RHI::IImage* image) { m_RHIImage = image; m_Layout = RHI::ImageLayout::Undefined; }
             void SetRHIResource(RHI::IBuffer* buffer) { m_RHIBuffer = buffer; }
             RHI::IImage* GetRHIImage() const { return m_RHIImage; }
             RHI::IBuffer* GetRHIBuffer() const { return m_RHIBuffer; }
 
+            // Placed in a transient heap, sharing memory with other resources
+            bool IsAliased() const { return m_Aliased; }
+            void SetAliased(bool aliased) { m_Aliased = aliased; }
+
+            // Layout the image was left in by the passes executed so far (Undefined for a new image)
+            RHI::ImageLayout GetLayout() const { return m_Layout; }
+            void SetLayout(RHI::ImageLayout layout) { m_Layout = layout; }
+
         private:
             std::string m_Name;
             ResourceDescription m_Description;
             void* m_Handle = nullptr;
             RHI::IImage* m_RHIImage = nullptr;
             RHI::IBuffer* m_RHIBuffer = nullptr;
+            bool m_Aliased = false;
+            RHI::ImageLayout m_Layout = RHI::ImageLayout::Undefined;
         };
 
         class FE_RENDERER_API FrameGraphBuilder {
@@ -232,16 +295,20 @@ namespace FirstEngine {
             FrameGraphBuilder(FrameGraph* graph, RHI::IRenderPass* renderPass = nullptr, RHI::IFramebuffer* framebuffer = nullptr);
 
             // Read resources
+            RHI::IImage* ReadTexture(FGResourceHandle handle);
+            RHI::IBuffer* ReadBuffer(FGResourceHandle handle);
             RHI::IImage* ReadTexture(const std::string& name);
             RHI::IBuffer* ReadBuffer(const std::string& name);
 
             // Write resources
+            RHI::IImage* WriteTexture(FGResourceHandle handle);
+            RHI::IBuffer* WriteBuffer(FGResourceHandle handle);
             RHI::IImage* WriteTexture(const std::string& name);
             RHI::IBuffer* WriteBuffer(const std::string& name);
 
             // Create temporary resources
-            std::string CreateTexture(const std::string& name, const ResourceDescription& desc);
-            std::string CreateBuffer(const std::string& name, const ResourceDescription& desc);
+            FGResourceHandle CreateTexture(const std::string& name, const ResourceDescription& desc);
+            FGResourceHandle CreateBuffer(const std::string& name, const ResourceDescription& desc);
 
             // Get current render pass (for pipeline creation)
             RHI::IRenderPass* GetRenderPass() const { return m_RenderPass; }
@@ -271,12 +338,25 @@ namespace FirstEngine {
             // If the node is an IRenderPass, automatically sets execute callback from OnDraw()
             FrameGraphNode* AddNode(FrameGraphNode* node);
 
-            // Add resource
-            FrameGraphResource* AddResource(const std::string& name, const ResourceDescription& desc);
+            // Add resource (replaces it if it exists with a different description; the handle stays the same)
+            FGResourceHandle AddResource(const std::string& name, const ResourceDescription& desc);
+
+            // Handle of a resource by name, reserving one if the resource hasn't been added yet (a pass may
+            // declare a read before the writer adds the resource with its description)
+            FGResourceHandle DeclareResource(const std::string& name);
+            // Invalid handle if no resource of that name was declared
+            FGResourceHandle FindResource(const std::string& name) const;
 
             // Allocate a single resource (for per-pass resource allocation)
             // Returns true if allocation succeeded
-            bool AllocateResource(const std::string& resourceName);
+            bool AllocateResource(FGResourceHandle handle);
+
+            // Outputs of the frame (presented, read back, or kept for the next frame); cleared by Clear()
+            // BuildExecutionPlan culls every pass that doesn't contribute to an output, so a disabled feature
+            // costs nothing: culled passes are not executed and their resources are not allocated.
+            // While no output is marked, nothing is culled.
+            void MarkOutput(FGResourceHandle handle);
+            bool IsOutput(FGResourceHandle handle) const;
 
             // Build execution plan (creates intermediate structure without CommandBuffer/Device dependencies)
             // This should be called before OnRender() to determine what scene resources need to be collected
@@ -286,6 +366,13 @@ namespace FirstEngine {
             // Note: This now allocates resources based on the execution plan
             bool Compile(const FrameGraphExecutionPlan& plan);
 
+            // Structural hash of the declared graph: nodes in declaration order, their read/write edges and the
+            // descriptions of the resources they use. While it matches the last successful Compile, the execution
+            // plan, resource assignments, barriers and framebuffers from then are still valid, so
+            // BuildExecutionPlan and Compile can be skipped.
+            uint64_t ComputeStructureHash() const;
+            bool IsCompiledFor(uint64_t structureHash) const { return m_CompiledHash != 0 && m_CompiledHash == structureHash; }
+
             // Execute FrameGraph (generate render command list from execution plan, no CommandBuffer dependency)
             // Returns a RenderCommandList that can be recorded to CommandBuffer later
             // scene: Scene to render (passed to Passes with SceneRenderer)
@@ -296,13 +383,24 @@ namespace FirstEngine {
 
             RenderCommandList Execute(const FrameGraphExecutionPlan& plan, Resources::Scene* scene, const RenderConfig& renderConfig);
 
-            // Get resource
-            FrameGraphResource* GetResource(const std::string& name);
-            const FrameGraphResource* GetResource(const std::string& name) const;
+            // Get resource (nullptr for a handle whose resource was declared but not added)
+            FrameGraphResource* GetResource(FGResourceHandle handle) {
+                return handle.index < m_Resources.size() ? m_Resources[handle.index].get() : nullptr;
+            }
+            const FrameGraphResource* GetResource(FGResourceHandle handle) const {
+                return handle.index < m_Resources.size() ? m_Resources[handle.index].get() : nullptr;
+            }
+            // Name lookup, for debugging and tools
+            FrameGraphResource* GetResource(const std::string& name) { return GetResource(FindResource(name)); }
+            const FrameGraphResource* GetResource(const std::string& name) const { return GetResource(FindResource(name)); }
+            const std::string& GetResourceName(FGResourceHandle handle) const;
+            uint32_t GetResourceCount() const { return static_cast<uint32_t>(m_Resources.size()); }
 
             // Get node
             FrameGraphNode* GetNode(uint32_t index);
             const FrameGraphNode* GetNode(uint32_t index) const;
+            FrameGraphNode* GetNode(FGNodeHandle handle) { return GetNode(handle.index); }
+            const FrameGraphNode* GetNode(FGNodeHandle handle) const { return GetNode(handle.index); }
             uint32_t GetNodeCount() const { return static_cast<uint32_t>(m_Nodes.size()); }
 
             // Clear (for next frame)
@@ -326,12 +424,75 @@ namespace FirstEngine {
             // Get device
             RHI::IDevice* GetDevice() const { return m_Device; }
 
+            // Transient memory aliasing (on by default)
+            // Transient attachments and buffers are not created by AllocateResource; Compile places them into
+            // shared heaps instead, so resources whose lifetimes in the execution order don't overlap use the
+            // same memory. Resources first read before being written, or never read, keep their own memory.
+            void SetTransientAliasing(bool enabled);
+            bool IsTransientAliasingEnabled() const { return m_TransientAliasing; }
+
+            // Transient memory of the current layout (recomputed when the graph's resources or lifetimes change)
+            struct TransientMemoryStats {
+                uint32_t resourceCount = 0;         // Transient resources eligible for aliasing
+                uint32_t aliasedCount = 0;          // Of those, placed in a shared heap
+                uint32_t heapCount = 0;
+                uint64_t bytesWithoutAliasing = 0;  // One allocation per resource, all alive at once
+                uint64_t bytesWithAliasing = 0;     // Heaps plus resources that kept their own allocation
+                uint64_t peakLiveBytes = 0;         // Lower bound: most bytes alive during a single pass
+            };
+            const TransientMemoryStats& GetTransientMemoryStats() const { return m_TransientStats; }
+
+            // Synchronization derived by Compile from the passes' read/write resources
+            // Every pass gets at most one PipelineBarrier command; attachment transitions are folded into the
+            // render passes (cleared attachments start from UNDEFINED, the first sampled read after a write
+            // becomes the writer's finalLayout).
+            struct BarrierStats {
+                uint32_t pipelineBarriers = 0;      // Passes that need a barrier before them
+                uint32_t imageBarriers = 0;         // Explicit layout transitions (upper bound, see Execute)
+                uint32_t memoryBarriers = 0;        // Buffer hazards and aliased memory hand-overs
+                uint32_t foldedTransitions = 0;     // Transitions done by render pass initial/final layouts
+            };
+            const BarrierStats& GetBarrierStats() const { return m_BarrierStats; }
+
+            // Per-pass cost of the compiled graph, by execution position
+            struct PassStats {
+                double cpuRecordMs = 0.0;           // Last Execute: render target setup, scene rendering and OnDraw
+                uint64_t estimatedBytes = 0;        // Attachments stored plus resources read, each touched once
+            };
+            const std::vector<PassStats>& GetPassStats() const { return m_PassStats; }
+
+            // The compiled graph for diagnostics: executed and culled passes with their PassStats, and resources
+            // with their lifetimes (execution positions), aliasing and output flags
+            std::string ExportGraphviz() const;
+            std::string ExportJson() const;
+            // Format by extension: ".json", Graphviz otherwise
+            bool ExportToFile(const std::string& path) const;
+
         private:
             // Analyze dependencies
             void AnalyzeDependencies();
 
             // Allocate resources
             bool AllocateResources();
+            bool AllocateDedicated(FrameGraphResource* resource);
+            bool IsDeferredTransient(const FrameGraphResource* resource) const;
+
+            // Transient aliasing (see SetTransientAliasing)
+            void ComputeLifetimes(const FrameGraphExecutionPlan& plan);
+            void PlaceTransientResources(const FrameGraphExecutionPlan& plan);
+            // Drop every placed resource and heap; deferred: wait until in-flight frames are done with them
+            void ReleaseTransientPlacement(bool deferred);
+
+            // Reference-count the passes back from the outputs and flag the ones nothing needs (see MarkOutput)
+            void CullPasses();
+
+            // Derive per-pass resource states and the barriers between them (see GetBarrierStats)
+            void BuildBarriers(const FrameGraphExecutionPlan& plan);
+            void EstimatePassBandwidth(const FrameGraphExecutionPlan& plan);
+            // Layout a render pass leaves the attachment in (folded transition), attachment layout otherwise
+            RHI::ImageLayout GetAttachmentFinalLayout(uint32_t position, FGResourceHandle handle) const;
+            // What the render pass and framebuffer of the node at 'position' depend on (see SetCompiledHash)
+            uint64_t ComputeAttachmentHash(uint32_t position, const FrameGraphNode* node) const;
 
             // Topological sort
             std::vector<uint32_t> TopologicalSort();
@@ -341,9 +502,38 @@ namespace FirstEngine {
             
             RHI::IDevice* m_Device;
             std::vector<NodePtr> m_Nodes;
-            std::unordered_map<std::string, std::unique_ptr<FrameGraphResource>> m_Resources;
+            // Indexed by FGResourceHandle; slots are never reused, so handles stay valid across frames
+            std::vector<std::unique_ptr<FrameGraphResource>> m_Resources;
+            std::vector<std::string> m_ResourceNames;
             std::unordered_map<std::string, uint32_t> m_ResourceNameToIndex;
             std::unordered_map<std::string, uint32_t> m_NodeNameToIndex;
+            std::vector<FGResourceHandle> m_Outputs;
+
+            bool m_TransientAliasing = true;
+            std::string m_TransientLayoutKey;                   // Resources and lifetimes the placement was made for
+            std::vector<RHI::MemoryHeapHandle> m_TransientHeaps;
+            std::vector<FGResourceHandle> m_AliasedResources;
+            TransientMemoryStats m_TransientStats;
+
+            // Barriers of the compiled graph, by execution position
+            struct CompiledTransition {
+                FGResourceHandle resource;
+                RHI::ImageLayout oldLayout = RHI::ImageLayout::Undefined;
+                RHI::ImageLayout newLayout = RHI::ImageLayout::Undefined;
+                bool fromCurrentLayout = false;     // First use this frame: start from where the last frame left it
+            };
+            struct PassBarriers {
+                std::vector<CompiledTransition> transitions;    // Recorded as one PipelineBarrier before the pass
+                bool memoryBarrier = false;
+                // Layouts the pass's attachments are in after the render pass
+                std::vector<std::pair<FGResourceHandle, RHI::ImageLayout>> attachmentLayouts;
+            };
+            std::vector<PassBarriers> m_PassBarriers;
+            BarrierStats m_BarrierStats;
+            std::vector<PassStats> m_PassStats;
+            std::vector<uint32_t> m_ExecutionOrder;     // Of the last Compile, for the exports
+
+            uint64_t m_CompiledHash = 0;    // Structure hash of the last successful Compile (0: none)
             
             // Note: Framebuffers and RenderPasses are now stored in FrameGraphNode
             // They are managed through IRenderResource lifecycle (FramebufferResource and RenderPassResource)
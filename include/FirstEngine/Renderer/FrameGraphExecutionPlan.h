@@ -36,6 +36,7 @@ namespace FirstEngine {
                 std::vector<std::string> readResources;
                 std::vector<std::string> writeResources;
                 std::vector<uint32_t> dependencies; // Dependent node indices
+                bool culled = false;                // Contributes to no output, left out of the execution order
             };
 
             // Resource information in execution plan
@@ -60,7 +61,7 @@ namespace FirstEngine {
             void AddResourcePlan(const ResourcePlan& resourcePlan);
             void AddResourcePlan(ResourcePlan&& resourcePlan);
 
-            // Get execution order (topologically sorted node indices)
+            // Get execution order (topologically sorted node indices, culled nodes left out)
             const std::vector<uint32_t>& GetExecutionOrder() const { return m_ExecutionOrder; }
             void SetExecutionOrder(const std::vector<uint32_t>& order) { m_ExecutionOrder = order; }
 
@@ -0,0 +1,84 @@
+#pragma once
+
+#include "FirstEngine/Renderer/Export.h"
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace FirstEngine {
+    namespace RHI {
+        class IDevice;
+        class IBuffer;
+    }
+
+    namespace Renderer {
+
+        // FrameUniformRing - per-frame transient uniform data in persistently mapped buffers
+        // Each frame slot has its own segment buffer. RenderContext calls BeginFrame(slot) once the slot's fence
+        // has signaled, so everything allocated from that segment the last time around is no longer read by the
+        // GPU and the segment can simply be rewound. A frame that asks for more than its segment holds gets
+        // nullptr for the allocations that don't fit; each slot's segment is then regrown (to 1.5x the demand)
+        // the next time the slot begins, which is also the only time its buffer is known to be unused.
+        class FE_RENDERER_API FrameUniformRing {
+        public:
+            static constexpr uint64_t kDefaultSegmentSize = 4ull * 1024 * 1024;
+            // Upper bound of minUniformBufferOffsetAlignment on current hardware
+            static constexpr uint64_t kAlignment = 256;
+
+            FrameUniformRing() = default;
+            ~FrameUniformRing();
+
+            FrameUniformRing(const FrameUniformRing&) = delete;
+            FrameUniformRing& operator=(const FrameUniformRing&) = delete;
+
+            bool Initialize(RHI::IDevice* device, uint32_t segmentCount, uint64_t segmentSize = kDefaultSegmentSize);
+            void Cleanup();
+            bool IsInitialized() const { return !m_Segments.empty(); }
+
+            // Rewind the segment of a frame slot (the slot's previous GPU work must have completed), growing it
+            // first if an earlier frame overflowed
+            void BeginFrame(uint32_t frameIndex);
+
+            // Make this frame's writes visible to the GPU (no-op on coherent memory); call before submitting
+            void FlushFrame();
+
+            // Reserve 'size' bytes in the current segment
+            // Returns the mapped pointer to write to and the offset to bind, or nullptr if the segment is full
+            // (logged once per frame)
+            void* Allocate(uint64_t size, uint64_t& outOffset);
+
+            // Buffer of the current frame slot's segment, and of any slot's (descriptor sets are per slot)
+            RHI::IBuffer* GetBuffer() const { return GetSegmentBuffer(m_FrameSlot); }
+            RHI::IBuffer* GetSegmentBuffer(uint32_t frameSlot) const;
+            uint64_t GetSegmentSize() const { return m_Segments.empty() ? 0 : m_Segments[m_FrameSlot].size; }
+
+            // Frame slots the ring cycles through, and the one being recorded (its previous GPU work is done)
+            uint32_t GetSegmentCount() const { return static_cast<uint32_t>(m_Segments.size()); }
+            uint32_t GetFrameSlot() const { return m_FrameSlot; }
+            uint64_t GetFrameBytesUsed() const { return m_Cursor; }
+
+            // Increments with every BeginFrame; offsets handed out under another serial are stale
+            uint64_t GetFrameSerial() const { return m_FrameSerial; }
+
+        private:
+            struct Segment {
+                std::unique_ptr<RHI::IBuffer> buffer;
+                uint8_t* data = nullptr;
+                uint64_t size = 0;
+            };
+
+            bool CreateSegment(Segment& segment, uint64_t size);
+
+            RHI::IDevice* m_Device = nullptr;
+            std::vector<Segment> m_Segments;
+            uint32_t m_FrameSlot = 0;
+            uint64_t m_FrameSerial = 0;
+            uint64_t m_Cursor = 0;          // Into the current segment
+            uint64_t m_FlushedUpTo = 0;
+            uint64_t m_FrameDemand = 0;     // Bytes this frame asked for, including allocations that failed
+            uint64_t m_TargetSize = 0;      // Size every segment grows to when its slot next begins
+            bool m_OverflowLogged = false;
+        };
+
+    } // namespace Renderer
+} // namespace FirstEngine
@@ -11,6 +11,7 @@
 #include "FirstEngine/Renderer/RenderConfig.h"
 #include "FirstEngine/Renderer/RenderFlags.h"
 #include "FirstEngine/Renderer/FrameGraph.h"
+#include "FirstEngine/Shader/ShaderKeywords.h"
 
 // Forward declarations
 namespace FirstEngine {
@@ -33,7 +34,7 @@ namespace FirstEngine {
         // This allows Pass to directly manage its resources through AddReadResource/AddWriteResource
         // Each render pass is responsible for:
         // 1. Adding itself to the FrameGraph in OnBuild()
-        // 2. Adding and allocating resources via AddReadResource/AddWriteResource (with ResourceDescription)
+        // 2. Adding resources via AddReadResource/AddWriteResource (with ResourceDescription)
         // 3. Configuring itself (type, execute callback)
         // 4. Optionally creating a SceneRenderer if it needs to render scene objects
         class FE_RENDERER_API IRenderPass : public FrameGraphNode {
@@ -48,7 +49,7 @@ namespace FirstEngine {
             // This method will:
             //   - Call frameGraph.AddNode(this) to add itself as a node (automatically sets execute callback)
             //   - Add resources via AddReadResource/AddWriteResource (with ResourceDescription)
-            //   - Resources are automatically allocated by AddReadResource/AddWriteResource
+            //   - Resources are allocated by FrameGraph::Compile, unless the pass gets culled
             virtual void OnBuild(FrameGraph& frameGraph, IRenderPipeline* pipeline) = 0;
 
             // Draw pass: Generate render commands for this pass
@@ -84,6 +85,11 @@ namespace FirstEngine {
             void SetRenderFlags(RenderObjectFlag flags) { m_RenderFlags = flags; }
             RenderObjectFlag GetRenderFlags() const { return m_RenderFlags; }
 
+            // Shader keywords added by this pass to every material it draws (e.g. DEPTH_ONLY)
+            // Combined with material keywords to select shader variants; must not change the shader resource interface
+            void SetShaderKeywords(const Shader::ShaderKeywordSet& keywords) { m_ShaderKeywords = keywords; }
+            const Shader::ShaderKeywordSet& GetShaderKeywords() const { return m_ShaderKeywords; }
+
         protected:
             // SceneRenderer owned by this pass (nullptr if pass doesn't render scene objects)
             std::unique_ptr<SceneRenderer> m_SceneRenderer;
@@ -94,6 +100,9 @@ namespace FirstEngine {
 
             // Render flags for filtering objects
             RenderObjectFlag m_RenderFlags = RenderObjectFlag::All;
+
+            // Pass shader keywords
+            Shader::ShaderKeywordSet m_ShaderKeywords;
         };
 
     } // namespace Renderer
@@ -21,8 +21,15 @@ namespace FirstEngine {
             // Resource names (using enum)
             static constexpr FrameGraphResourceName GBUFFER_ALBEDO = FrameGraphResourceName::GBufferAlbedo;
             static constexpr FrameGraphResourceName GBUFFER_NORMAL = FrameGraphResourceName::GBufferNormal;
+            static constexpr FrameGraphResourceName GBUFFER_MATERIAL = FrameGraphResourceName::GBufferMaterial;
             static constexpr FrameGraphResourceName GBUFFER_DEPTH = FrameGraphResourceName::GBufferDepth;
             static constexpr FrameGraphResourceName FINAL_OUTPUT = FrameGraphResourceName::FinalOutput;
+
+            // Handles of the G-Buffer inputs, declared in OnBuild
+            FGResourceHandle m_GBufferAlbedo;
+            FGResourceHandle m_GBufferNormal;
+            FGResourceHandle m_GBufferMaterial;
+            FGResourceHandle m_GBufferDepth;
         };
 
     } // namespace Renderer
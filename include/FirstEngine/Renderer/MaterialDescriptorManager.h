@@ -17,6 +17,7 @@ namespace FirstEngine {
     namespace Renderer {
 
         // Forward declarations
+        class FrameUniformRing;
         class ShadingMaterial;
 
         // ============================================================================
@@ -33,6 +34,12 @@ namespace FirstEngine {
         // - Storing Shader parameters (CPU-side data)
         // - Recording CPU to GPU parameter transfer
         // - Not directly interacting with RHI
+        //
+        // Materials staged in a FrameUniformRing get one copy of every descriptor set per frame slot of the ring.
+        // Binding changes (texture uploads, streaming residency swaps) are written to the current slot's copy
+        // only: its previous frame has completed and this frame is not recorded yet, while the copies of the
+        // frames still in flight are left untouched. Without a ring there is a single copy, and a set is not
+        // rewritten once it has been updated.
         // ============================================================================
         class FE_RENDERER_API MaterialDescriptorManager {
         public:
@@ -60,7 +67,7 @@ namespace FirstEngine {
 
             // Get descriptor set (for binding during rendering)
             // setIndex: Descriptor set index
-            // Returns: Descriptor set handle, returns nullptr if doesn't exist
+            // Returns: Descriptor set handle of the current frame slot, returns nullptr if doesn't exist
             RHI::DescriptorSetHandle GetDescriptorSet(uint32_t setIndex) const;
 
             // Get descriptor set layout (for creating pipeline layout)
@@ -99,11 +106,20 @@ namespace FirstEngine {
             bool AllocateDescriptorSets(RHI::IDevice* device);
 
             // Update descriptor set bindings (write uniform buffers and textures)
+            // frameSlot: Which copy of the descriptor sets to write
             // updateUniformBuffers: If true, update uniform buffer bindings (for Initialize).
             //                      If false, skip uniform buffer bindings (for UpdateBindings, to avoid validation warnings).
             // forceUpdateAllBindings: If true, force update all bindings even if descriptor set was already updated.
             //                        Use with caution - only when descriptor sets are guaranteed not to be in use.
-            void WriteDescriptorSets(ShadingMaterial* material, RHI::IDevice* device, bool updateUniformBuffers = true, bool forceUpdateAllBindings = false);
+            void WriteDescriptorSets(ShadingMaterial* material, RHI::IDevice* device, uint32_t frameSlot,
+                                     bool updateUniformBuffers = true, bool forceUpdateAllBindings = false);
+
+            // Copies of the descriptor sets, and the one the frame being recorded uses
+            uint32_t GetFrameSlotCount() const { return static_cast<uint32_t>(m_DescriptorSets.size()); }
+            uint32_t GetFrameSlot() const;
+
+            // Descriptor set of a given frame slot; nullptr if it doesn't exist
+            RHI::DescriptorSetHandle FindDescriptorSet(uint32_t frameSlot, uint32_t setIndex) const;
 
             // Internal state
             bool m_Initialized = false;
@@ -115,12 +131,19 @@ namespace FirstEngine {
             // Descriptor pool (shared for all descriptor sets)
             RHI::DescriptorPoolHandle m_DescriptorPool = nullptr;
 
-            // Descriptor sets (one per set index)
-            std::unordered_map<uint32_t, RHI::DescriptorSetHandle> m_DescriptorSets;
+            // Ring whose frame slot selects the descriptor set copy (nullptr: one copy)
+            const FrameUniformRing* m_UniformRing = nullptr;
+
+            // Descriptor sets (per frame slot, one per set index)
+            std::vector<std::unordered_map<uint32_t, RHI::DescriptorSetHandle>> m_DescriptorSets;
             
-            // Cache last texture pointers to avoid unnecessary updates
+            // Cache last texture pointers written to each frame slot's sets to avoid unnecessary updates
             // Key: {set, binding}, Value: texture pointer
-            std::map<std::pair<uint32_t, uint32_t>, RHI::IImage*> m_LastTexturePointers;
+            std::vector<std::map<std::pair<uint32_t, uint32_t>, RHI::IImage*>> m_LastTexturePointers;
+
+            // Uniform buffers written to each frame slot's sets (a ring segment is replaced when it grows)
+            // Key: {set, binding}, Value: buffer pointer
+            std::vector<std::map<std::pair<uint32_t, uint32_t>, RHI::IBuffer*>> m_LastUniformBuffers;
             
             // Track which descriptor sets have been updated this frame
             // This prevents updating descriptor sets that are already in use by command buffers
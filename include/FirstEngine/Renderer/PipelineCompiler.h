@@ -0,0 +1,109 @@
+#pragma once
+
+#include "FirstEngine/Renderer/Export.h"
+#include "FirstEngine/RHI/IPipeline.h"
+#include "FirstEngine/RHI/Types.h"
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+
+namespace FirstEngine {
+    namespace RHI {
+        class IDevice;
+    }
+
+    namespace Renderer {
+
+        // PipelineCompiler - compiles graphics pipelines on worker threads
+        // Pipeline creation (driver shader compilation) can take tens of milliseconds, so
+        // ShadingState submits a request here and polls it each frame instead of blocking the render thread.
+        // Uses Core::ThreadManager worker pool; falls back to synchronous compilation if
+        // ThreadManager is not initialized or async compilation is disabled.
+        class FE_RENDERER_API PipelineCompiler {
+        public:
+            // A single pipeline compile request (shared between render thread and worker)
+            struct CompileRequest {
+                RHI::IDevice* device = nullptr;
+                RHI::GraphicsPipelineDescription description;
+
+                // Written by the worker before 'completed' is set, read by the render thread after
+                std::unique_ptr<RHI::IPipeline> pipeline;
+                bool succeeded = false;
+
+                std::atomic<bool> completed{false};
+                std::chrono::steady_clock::time_point submitTime;
+
+                bool IsCompleted() const { return completed.load(std::memory_order_acquire); }
+            };
+
+            // Compile metrics
+            struct Stats {
+                uint32_t pendingCompiles = 0;     // Requests queued or compiling right now
+                uint64_t completedCompiles = 0;   // Requests finished successfully
+                uint64_t failedCompiles = 0;      // Requests that returned no pipeline
+                double lastLatencyMs = 0.0;       // Submit-to-ready time of the last request
+                double averageLatencyMs = 0.0;    // Average submit-to-ready time
+                double maxLatencyMs = 0.0;        // Worst submit-to-ready time
+            };
+
+            // Get singleton instance
+            static PipelineCompiler& GetInstance();
+            static void Shutdown();
+            static bool IsInitialized() { return s_Instance != nullptr; }
+
+            // Submit a pipeline for compilation
+            // Returns a request that can be polled with IsCompleted(); never returns nullptr
+            std::shared_ptr<CompileRequest> Submit(RHI::IDevice* device, const RHI::GraphicsPipelineDescription& description);
+
+            // Enable/disable worker thread compilation (disabled = compile inline in Submit)
+            void SetAsyncEnabled(bool enabled) { m_AsyncEnabled = enabled; }
+            bool IsAsyncEnabled() const { return m_AsyncEnabled; }
+
+            // Block until all submitted requests are completed (used by pre-warm and shutdown)
+            void WaitForAll();
+
+            // Block until one request is completed
+            void Wait(const std::shared_ptr<CompileRequest>& request);
+
+            // Block until no request compiles against renderPass; call before destroying it
+            void WaitForRenderPass(RHI::IRenderPass* renderPass);
+
+            // Number of requests queued or compiling
+            uint32_t GetPendingCount() const { return m_PendingCount.load(); }
+
+            // Get compile metrics
+            Stats GetStats() const;
+            void ResetStats();
+
+        private:
+            PipelineCompiler() = default;
+            ~PipelineCompiler() = default;
+            PipelineCompiler(const PipelineCompiler&) = delete;
+            PipelineCompiler& operator=(const PipelineCompiler&) = delete;
+
+            static PipelineCompiler* s_Instance;
+
+            // Compile a request (runs on worker thread or inline)
+            void Compile(const std::shared_ptr<CompileRequest>& request);
+
+            bool m_AsyncEnabled = true;
+            std::atomic<uint32_t> m_PendingCount{0};
+
+            mutable std::mutex m_StatsMutex;
+            std::condition_variable m_IdleCondition;
+            uint64_t m_CompletedCount = 0;
+            uint64_t m_FailedCount = 0;
+            double m_TotalLatencyMs = 0.0;
+            double m_LastLatencyMs = 0.0;
+            double m_MaxLatencyMs = 0.0;
+
+            // Requests queued or compiling per render pass (guarded by m_StatsMutex)
+            std::unordered_map<RHI::IRenderPass*, uint32_t> m_RenderPassUsers;
+        };
+
+    } // namespace Renderer
+} // namespace FirstEngine
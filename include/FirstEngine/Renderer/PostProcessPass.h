@@ -33,6 +33,7 @@ namespace FirstEngine {
         private:
             // Resource names (using enum)
             static constexpr FrameGraphResourceName FINAL_OUTPUT = FrameGraphResourceName::FinalOutput;
+            FGResourceHandle m_InputTexture;    // FINAL_OUTPUT, declared in OnBuild
             
             // Element system for fullscreen quad rendering
             std::unique_ptr<Resources::BuiltinGeometry> m_QuadGeometry;
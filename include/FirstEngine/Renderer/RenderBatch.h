@@ -37,6 +37,22 @@ namespace FirstEngine {
                 uint32_t firstVertex = 0;
                 uint64_t vertexBufferOffset = 0;
                 uint64_t indexBufferOffset = 0;
+                bool indexIs32Bit = true;
+
+                // Levels of detail (index ranges of indexBuffer, finest first); SceneRenderer picks one per frame
+                // and writes it to firstIndex/indexCount. lodCount <= 1 means there is nothing to choose from.
+                static constexpr uint32_t kMaxLods = 8;
+                struct Lod {
+                    uint32_t firstIndex = 0;
+                    uint32_t indexCount = 0;
+                    float error = 0.0f;    // Relative to boundsRadius
+                } lods[kMaxLods];
+                uint32_t lodCount = 0;
+                uint32_t lodIndex = 0;
+
+                // Object-space bounding sphere
+                glm::vec3 boundsCenter = glm::vec3(0.0f);
+                float boundsRadius = 0.0f;
             } geometryData;
 
             // Material data (from MaterialResource::RenderData)
@@ -41,7 +41,7 @@ namespace FirstEngine {
             ClearDepthStencilImage,
             Dispatch,
             DispatchIndirect,
-            PipelineBarrier,
+            PipelineBarrier,    // All transitions at a pass boundary, generated by FrameGraph::Compile
             PushConstants,
         };
 
@@ -91,10 +91,8 @@ namespace FirstEngine {
 
             struct TransitionImageLayoutParams {
                 RHI::IImage* image;
-                RHI::Format formatOld;
-                RHI::Format formatNew;
+                RHI::ImageLayout newLayout;     // From the image's last known layout
                 uint32_t mipLevels;
-                RHI::ImageAccessMode accessMode; // Read or Write - determines target layout
             };
 
             struct BeginRenderPassParams {
@@ -119,6 +117,10 @@ namespace FirstEngine {
                 const void* data;
             };
 
+            struct PipelineBarrierParams {
+                RHI::PipelineBarrierDescription barrier;
+            };
+
             // Storage for command parameters (using struct instead of union to support std::vector)
             // Only the relevant field should be used based on 'type'
             struct {
@@ -132,6 +134,7 @@ namespace FirstEngine {
                 BeginRenderPassParams beginRenderPass;
                 EndRenderPassParams endRenderPass;
                 PushConstantsParams pushConstants;
+                PipelineBarrierParams pipelineBarrier;
             } params;
 
             RenderCommand() = default;
@@ -8,6 +8,7 @@
 #include "FirstEngine/Renderer/RenderConfig.h"
 #include "FirstEngine/Renderer/IRenderPipeline.h"
 #include "FirstEngine/Renderer/DeferredRenderPipeline.h"
+#include "FirstEngine/Renderer/FrameUniformRing.h"
 #include "FirstEngine/Device/VulkanDevice.h"
 #include "FirstEngine/RHI/IDevice.h"
 #include "FirstEngine/RHI/ISwapchain.h"
@@ -15,6 +16,7 @@
 #include "FirstEngine/RHI/Types.h"
 #include "FirstEngine/Resources/Scene.h"  // SceneLoader is defined in Scene.h
 #include "FirstEngine/Resources/ResourceProvider.h"  // ResourceManager is defined in ResourceProvider.h
+#include <functional>
 #include <memory>
 #include <string>
 #include <unordered_map>
@@ -32,6 +34,10 @@ namespace FirstEngine {
                 RHI::ISwapchain* swapchain = nullptr;  // Must be provided, as each viewport may have different swapchain
             };
 
+            // Upper bound of SetFramesInFlight
+            static constexpr uint32_t kMaxFramesInFlight = 3;
+            static constexpr uint32_t kDefaultFramesInFlight = 2;
+
             RenderContext();
             ~RenderContext();
 
@@ -66,15 +72,24 @@ namespace FirstEngine {
             // Returns: whether successful
             bool SubmitFrame(const RenderParams& params);
 
-            // Get internally managed sync objects (if using internal management)
-            RHI::FenceHandle GetInFlightFence() const { return m_InFlightFence; }
-            RHI::SemaphoreHandle GetImageAvailableSemaphore() const { return m_ImageAvailableSemaphore; }
-            RHI::SemaphoreHandle GetRenderFinishedSemaphore() const { return m_RenderFinishedSemaphore; }
+            // Number of frames the CPU may record ahead of the GPU (clamped to 1..kMaxFramesInFlight)
+            // Changing it on a running context waits for the GPU and recreates the per-frame objects
+            void SetFramesInFlight(uint32_t count);
+            uint32_t GetFramesInFlight() const { return m_FramesInFlight; }
+            uint32_t GetCurrentFrameIndex() const { return m_FrameIndex; }
+
+            // Get the current frame's internally managed sync objects
+            RHI::FenceHandle GetInFlightFence() const { return m_Frames[m_FrameIndex].inFlightFence; }
+            RHI::SemaphoreHandle GetImageAvailableSemaphore() const { return m_Frames[m_FrameIndex].imageAvailableSemaphore; }
+            RHI::SemaphoreHandle GetRenderFinishedSemaphore() const { return m_Frames[m_FrameIndex].renderFinishedSemaphore; }
+
+            // Transient uniform data for the frame being recorded (rewound when the frame slot comes around again)
+            FrameUniformRing& GetFrameUniformRing() { return m_UniformRing; }
 
-            // Create internally managed sync objects (if not provided externally)
+            // Create sync objects for every frame in flight (if not provided externally)
             bool CreateSyncObjects(RHI::IDevice* device);
             
-            // Destroy internally managed sync objects
+            // Destroy every frame's sync objects and command buffer (the frames must have completed)
             void DestroySyncObjects(RHI::IDevice* device);
 
             // Get render command list (for debugging or custom processing)
@@ -85,6 +100,10 @@ namespace FirstEngine {
             const FrameGraphExecutionPlan& GetExecutionPlan() const { return m_ExecutionPlan; }
             FrameGraphExecutionPlan& GetExecutionPlan() { return m_ExecutionPlan; }
 
+            // Debug: write the compiled FrameGraph to 'path' after the next ExecuteFrameGraph, so the export
+            // includes that frame's pass timings. Format by extension (see FrameGraph::ExportToFile).
+            void RequestFrameGraphExport(const std::string& path) { m_FrameGraphExportPath = path; }
+
             // ========== Rendering Engine State Management (for EditorAPI) ==========
             
             // Initialize rendering engine (EditorAPI: uses hidden GLFW window)
@@ -121,6 +140,11 @@ namespace FirstEngine {
             
             void UnloadScene();
 
+            // Pre-warm pipelines for all scene materials against every scene pass (call after loading a level)
+            // waitForCompletion: block until all queued pipeline compiles have finished
+            // Returns the number of pipelines that were not ready when the call started
+            size_t PrewarmPipelines(bool waitForCompletion = false);
+
         private:
             bool m_EngineInitialized = false;
             RHI::IDevice* m_Device = nullptr;
@@ -129,20 +153,46 @@ namespace FirstEngine {
             Resources::Scene* m_Scene = nullptr;
             RenderConfig m_RenderConfig;
             
-            RHI::FenceHandle m_InFlightFence = nullptr;
-            RHI::SemaphoreHandle m_ImageAvailableSemaphore = nullptr;
-            RHI::SemaphoreHandle m_RenderFinishedSemaphore = nullptr;
-            
-            std::unique_ptr<RHI::ICommandBuffer> m_CommandBuffer;
+            // Everything a submitted frame still owns until its fence signals
+            struct FrameContext {
+                std::unique_ptr<RHI::ICommandBuffer> commandBuffer;
+                // Render pass contents recorded on worker threads, executed by commandBuffer
+                std::vector<std::unique_ptr<RHI::ICommandBuffer>> secondaryCommandBuffers;
+                RHI::FenceHandle inFlightFence = nullptr;
+                RHI::SemaphoreHandle imageAvailableSemaphore = nullptr;
+                RHI::SemaphoreHandle renderFinishedSemaphore = nullptr;
+                // GPU objects released while this frame was being recorded or earlier
+                std::vector<std::function<void()>> deferredDestructions;
+            };
+
+            // Wait until the current frame slot's previous submission has completed, then recycle the slot
+            // (runs its deferred destructions and rewinds its uniform segment). Once per frame.
+            void AcquireFrameSlot();
+            static void RunDeferredDestructions(FrameContext& frame);
+            // Run every frame's deferred destructions (the device must be idle)
+            void ReleaseAllFrames();
+
+            FrameContext m_Frames[kMaxFramesInFlight];
+            uint32_t m_FramesInFlight = kDefaultFramesInFlight;
+            uint32_t m_FrameIndex = 0;
+            bool m_FrameSlotAcquired = false;
+            FrameUniformRing m_UniformRing;
+
             CommandRecorder m_CommandRecorder;
             
             FrameGraphExecutionPlan m_ExecutionPlan;
             
             RenderCommandList m_RenderCommands;
+
+            // Pending RequestFrameGraphExport (empty: none)
+            std::string m_FrameGraphExportPath;
             
             uint32_t m_CurrentImageIndex = 0;
             
             void* m_WindowHandle = nullptr;
+
+            // ThreadManager was initialized by this context (and is shut down with it)
+            bool m_OwnsThreadManager = false;
             
 #ifdef _WIN32
             void* m_HiddenGLFWWindow = nullptr;
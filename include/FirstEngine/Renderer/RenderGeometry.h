@@ -42,10 +42,15 @@ namespace FirstEngine {
             // Get geometry data
             uint32_t GetVertexCount() const { return m_VertexCount; }
             uint32_t GetIndexCount() const { return m_IndexCount; }
+            uint32_t GetIndexSize() const { return m_IndexSize; }
             uint32_t GetVertexStride() const { return m_VertexStride; }
             uint32_t GetFirstIndex() const { return m_FirstIndex; }
             uint32_t GetFirstVertex() const { return m_FirstVertex; }
 
+            // True once created and the vertex/index data has landed on the GPU
+            // (uploads are batched by UploadManager and complete asynchronously)
+            bool IsReady() const;
+
             // Get source mesh resource
             Resources::MeshHandle GetMeshResource() const { return m_MeshResource; }
 
@@ -60,12 +65,17 @@ namespace FirstEngine {
             // Geometry data
             uint32_t m_VertexCount = 0;
             uint32_t m_IndexCount = 0;
+            uint32_t m_IndexSize = sizeof(uint32_t);
             uint32_t m_VertexStride = 0;
             uint32_t m_FirstIndex = 0;
             uint32_t m_FirstVertex = 0;
 
+            // UploadManager ticket of the last queued buffer upload (0 = nothing pending)
+            uint64_t m_UploadTicket = 0;
+
             // Helper method to create GPU buffers
             bool CreateBuffers(RHI::IDevice* device);
+            void WaitForUpload();
         };
 
     } // namespace Renderer
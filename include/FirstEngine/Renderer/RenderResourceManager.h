@@ -4,6 +4,7 @@
 #include "FirstEngine/Renderer/IRenderResource.h"
 #include "FirstEngine/RHI/IDevice.h"
 #include <vector>
+#include <functional>
 #include <mutex>
 #include <memory>
 #include <cstdint>
@@ -18,6 +19,8 @@ namespace FirstEngine {
 namespace FirstEngine {
     namespace Renderer {
 
+        class FrameUniformRing;
+
         // RenderResourceManager - manages all IRenderResources
         // Thread-safe collection and processing of render resources
         // Supports frame-by-frame resource creation for performance
@@ -28,6 +31,7 @@ namespace FirstEngine {
             static RenderResourceManager& GetInstance();
             static void Initialize();
             static void Shutdown();
+            static bool HasInstance() { return s_Instance != nullptr; }
 
             // Register a resource (thread-safe)
             // Resources should register themselves when created
@@ -41,8 +45,35 @@ namespace FirstEngine {
             // Processes a limited number of resources per frame for performance
             // maxResourcesPerFrame: Maximum number of resources to process this frame (0 = unlimited)
             // Returns number of resources processed
+            // Data uploads queued by the processed resources are submitted as one UploadManager batch at the end;
+            // the resources report IsReady() once that batch completes
             uint32_t ProcessScheduledResources(RHI::IDevice* device, uint32_t maxResourcesPerFrame = 0);
 
+            // Deferred destruction of GPU objects that a frame still in flight may reference
+            // Queued destructions are collected by RenderContext after each submit and run once that frame's
+            // fence has signaled. Without a manager instance (e.g. after shutdown) they run immediately.
+            static void DeferDestruction(std::function<void()> destroy);
+
+            template <typename T>
+            static void DeferDelete(std::unique_ptr<T> object) {
+                if (object) {
+                    T* raw = object.release();
+                    DeferDestruction([raw]() { delete raw; });
+                }
+            }
+
+            // Hand the destructions queued since the last call to the caller (the frame that just submitted)
+            std::vector<std::function<void()>> TakeDeferredDestructions();
+
+            // Run every queued destruction now (the device must be idle)
+            void FlushDeferredDestructions();
+
+            // Uniform ring of the RenderContext (nullptr without one)
+            // Materials created while it is set stage their uniform data in it every frame instead of owning
+            // uniform buffers that the frames in flight would share
+            void SetFrameUniformRing(FrameUniformRing* ring) { m_FrameUniformRing = ring; }
+            FrameUniformRing* GetFrameUniformRing() const { return m_FrameUniformRing; }
+
             // Get all registered resources (for debugging/inspection)
             std::vector<IRenderResource*> GetAllResources() const;
 
@@ -91,6 +122,11 @@ namespace FirstEngine {
             mutable std::mutex m_ResourcesMutex;
             std::vector<IRenderResource*> m_Resources;
 
+            std::mutex m_DeferredMutex;
+            std::vector<std::function<void()>> m_DeferredDestructions;
+
+            FrameUniformRing* m_FrameUniformRing = nullptr;
+
             // Package resource management
             std::string m_CurrentPackagePath;
 
@@ -4,7 +4,9 @@
 #include "FirstEngine/Renderer/IRenderResource.h"
 #include "FirstEngine/RHI/IImage.h"
 #include "FirstEngine/RHI/Types.h"
+#include "FirstEngine/Resources/TextureCompressor.h"
 #include <memory>
+#include <vector>
 
 namespace FirstEngine {
     namespace Resources {
@@ -15,6 +17,11 @@ namespace FirstEngine {
 
         // RenderTexture - GPU texture resource (IRenderResource)
         // Created from TextureResource data and stored in TextureResource handle
+        // Cooked textures are created with their full mip chain in their block-compressed format and every level
+        // is uploaded straight from the TextureResource's mapping; source images get a single RGBA8 level.
+        // With TextureStreamer enabled, cooked textures start with only their tail levels resident; a residency
+        // change builds a new image holding levels [firstMip, mipCount) next to the current one and swaps it in
+        // once its upload has completed, so the old image keeps being sampled meanwhile.
         class FE_RENDERER_API RenderTexture : public IRenderResource {
         public:
             RenderTexture();
@@ -30,12 +37,37 @@ namespace FirstEngine {
             bool DoUpdate(RHI::IDevice* device) override;
             void DoDestroy() override;
 
-            // Get GPU texture image
+            // Get GPU texture image (holds levels [GetResidentMip(), GetMipCount()))
             RHI::IImage* GetImage() const { return m_Image.get(); }
 
+            // True once created and the pixel data has landed on the GPU
+            // (uploads are batched by UploadManager and complete asynchronously)
+            bool IsReady() const;
+
             // Get source texture resource
             Resources::TextureResource* GetTextureResource() const { return m_TextureResource; }
 
+            uint32_t GetWidth() const { return m_Width; }
+            uint32_t GetHeight() const { return m_Height; }
+            uint32_t GetMipCount() const { return static_cast<uint32_t>(m_Mips.size()); }
+
+            // Streaming residency (driven by TextureStreamer)
+            // Levels from GetTailMip() down are always resident; GetTargetMip() is the pending residency if any
+            bool IsStreamed() const { return m_TailMip > 0; }
+            uint32_t GetResidentMip() const { return m_ResidentMip; }
+            uint32_t GetTailMip() const { return m_TailMip; }
+            uint32_t GetTargetMip() const { return m_PendingImage ? m_PendingMip : m_ResidentMip; }
+            bool IsResidencyChangePending() const { return m_PendingImage != nullptr; }
+
+            // GPU bytes of levels [firstMip, mipCount)
+            uint64_t GetMipChainBytes(uint32_t firstMip) const;
+
+            // Queue an image with levels [firstMip, mipCount); returns the bytes queued for upload (0 = not started)
+            uint64_t RequestResidency(uint32_t firstMip);
+
+            // Swap in the pending image once its upload has completed; returns true if it was swapped
+            bool UpdateResidency();
+
         private:
             // Source texture resource (logical resource, not GPU resource)
             Resources::TextureResource* m_TextureResource = nullptr;
@@ -43,16 +75,34 @@ namespace FirstEngine {
             // GPU texture image
             std::unique_ptr<RHI::IImage> m_Image;
             
-            // Texture data (copied from TextureResource for GPU upload)
+            // Texture data (copied from TextureResource for GPU upload; cooked textures aren't copied, or are
+            // decoded here when the device can't sample their block format)
             std::vector<uint8_t> m_TextureData;
             uint32_t m_Width = 0;
             uint32_t m_Height = 0;
             uint32_t m_Channels = 0;
             RHI::Format m_Format = RHI::Format::R8G8B8A8_UNORM;
+
+            // Levels to upload, largest first (into m_TextureData or the TextureResource's mapping)
+            std::vector<Resources::TextureMip> m_Mips;
+            Resources::TextureEncoding m_Encoding = Resources::TextureEncoding::RGBA8;
+
+            // UploadManager ticket of the last queued upload (0 = nothing pending)
+            uint64_t m_UploadTicket = 0;
+
+            // Streaming: m_Image holds levels [m_ResidentMip, mipCount); m_TailMip is 0 for non-streamed textures
+            RHI::IDevice* m_Device = nullptr;
+            uint32_t m_ResidentMip = 0;
+            uint32_t m_TailMip = 0;
+            std::unique_ptr<RHI::IImage> m_PendingImage;
+            uint32_t m_PendingMip = 0;
+            uint64_t m_PendingTicket = 0;
             
             // Helper methods
-            bool CreateImage(RHI::IDevice* device);
-            bool UploadTextureData(RHI::IDevice* device);
+            std::unique_ptr<RHI::IImage> CreateImage(RHI::IDevice* device, uint32_t firstMip) const;
+            bool DecodeForDevice(RHI::IDevice* device);
+            uint64_t UploadTextureData(RHI::IDevice* device, RHI::IImage* image, uint32_t firstMip);
+            void WaitForUpload();
         };
 
     } // namespace Renderer
@@ -7,8 +7,10 @@
 #include "FirstEngine/Renderer/RenderFlags.h"
 #include "FirstEngine/RHI/IDevice.h"
 #include "FirstEngine/RHI/IRenderPass.h"
+#include "FirstEngine/Shader/ShaderKeywords.h"
 #include <glm/glm.hpp>
 #include <memory>
+#include <unordered_map>
 #include <vector>
 
 // Forward declarations
@@ -16,10 +18,12 @@ namespace FirstEngine {
     namespace Resources {
         class Scene;
         class Entity;
+        class Component;
     }
     namespace Renderer {
         class IRenderPass;
         class RenderConfig;
+        class ShadingMaterial;
     }
 }
 
@@ -69,8 +73,17 @@ namespace FirstEngine {
             // Convert render queue to render command list (data structure, no CommandBuffer dependency)
             // This method generates render commands as data, not GPU commands
             // renderPass: Optional render pass for pipeline creation (if nullptr, pipelines must be created elsewhere)
+            // Items whose material pipeline is still compiling are skipped until it is ready
             RenderCommandList SubmitRenderQueue(const RenderQueue& renderQueue, RHI::IRenderPass* renderPass = nullptr);
 
+            // Pre-warm pipelines for all materials in the scene (e.g. during level loading)
+            // Queues asynchronous compilation for every ShadingMaterial against renderPass
+            // Use PipelineCompiler::WaitForAll() to block until they are ready
+            // passKeywords: shader keywords of the pass (selects the shader variants to compile)
+            // Returns the number of materials whose pipeline is not ready yet
+            size_t PrewarmPipelines(Resources::Scene* scene, RHI::IRenderPass* renderPass,
+                                    const Shader::ShaderKeywordSet& passKeywords = Shader::ShaderKeywordSet());
+
             // Enable/disable features
             void SetFrustumCullingEnabled(bool enabled) { m_FrustumCullingEnabled = enabled; }
             bool IsFrustumCullingEnabled() const { return m_FrustumCullingEnabled; }
@@ -78,10 +91,29 @@ namespace FirstEngine {
             void SetOcclusionCullingEnabled(bool enabled) { m_OcclusionCullingEnabled = enabled; }
             bool IsOcclusionCullingEnabled() const { return m_OcclusionCullingEnabled; }
 
+            // Level of detail: items with cooked LODs draw the coarsest level whose error, scaled by the projected
+            // bounding sphere radius, stays within lodBias pixels (1 = one pixel, larger = coarser sooner, 0 = LOD 0)
+            // Switching to a coarser level needs the error to be lodHysteresis (a fraction) further below the
+            // threshold, so objects sitting at a switching distance don't pop back and forth
+            void SetLodEnabled(bool enabled) { m_LodEnabled = enabled; }
+            bool IsLodEnabled() const { return m_LodEnabled; }
+            void SetLodBias(float bias) { m_LodBias = bias; }
+            float GetLodBias() const { return m_LodBias; }
+            void SetLodHysteresis(float hysteresis) { m_LodHysteresis = hysteresis; }
+            float GetLodHysteresis() const { return m_LodHysteresis; }
+
+            // Texture streaming feedback: after culling, each visible material reports the largest projected
+            // diameter (pixels) of the items drawn with it to TextureStreamer for every texture it binds
+            void SetTextureStreamingFeedbackEnabled(bool enabled) { m_TextureStreamingFeedback = enabled; }
+            bool IsTextureStreamingFeedbackEnabled() const { return m_TextureStreamingFeedback; }
+
             // Get statistics
             size_t GetVisibleEntityCount() const { return m_VisibleEntityCount; }
             size_t GetCulledEntityCount() const { return m_CulledEntityCount; }
             size_t GetDrawCallCount() const { return m_DrawCallCount; }
+            size_t GetSkippedDrawCount() const { return m_SkippedDrawCount; }   // Pipeline or uniform data not ready
+            size_t GetTriangleCount() const { return m_TriangleCount; }                     // After LOD selection
+            size_t GetFullDetailTriangleCount() const { return m_FullDetailTriangleCount; } // Same items at LOD 0
 
         private:
             // Build render queue from scene (uses stored camera config)
@@ -108,8 +140,14 @@ namespace FirstEngine {
             // Components now handle their own CreateRenderItem and MatchesRenderFlags
             // No need for these methods in SceneRenderer anymore
 
-            // Convert render queue to render command list (internal helper)
-            RenderCommandList SubmitRenderQueue(const RenderQueue& renderQueue);
+            // Projected radius of the item's bounding sphere in pixels (infinity if the camera is inside it)
+            float ProjectedRadius(const RenderItem& item) const;
+
+            // LOD for an item given the one it used last frame (UINT32_MAX if none)
+            uint32_t SelectLod(const RenderItem& item, float projectedRadius, uint32_t currentLod) const;
+
+            // Report this frame's material screen sizes to TextureStreamer
+            void RequestTextureMips();
 
             RHI::IDevice* m_Device;
             IRenderPass* m_CurrentRenderPass = nullptr; // Current render pass (set during Render())
@@ -118,6 +156,18 @@ namespace FirstEngine {
             CullingSystem m_CullingSystem;
             bool m_FrustumCullingEnabled = true;
             bool m_OcclusionCullingEnabled = false;
+            bool m_LodEnabled = true;
+            float m_LodBias = 1.0f;
+            float m_LodHysteresis = 0.25f;
+            float m_LodProjectionScale = 0.0f;  // Pixels per unit of tan(angle): viewport height / (2 tan(fov / 2))
+
+            // LOD each component drew last frame (hysteresis); rebuilt every frame from the visible items
+            std::unordered_map<const Resources::Component*, uint32_t> m_LodState;
+            std::unordered_map<const Resources::Component*, uint32_t> m_NextLodState;
+
+            // Largest projected diameter (pixels) per material this frame, for texture streaming
+            bool m_TextureStreamingFeedback = true;
+            std::unordered_map<ShadingMaterial*, float> m_MaterialScreenSize;
 
             // Generated render commands (stored internally after Render() call)
             RenderCommandList m_SceneRenderCommands;
@@ -126,6 +176,9 @@ namespace FirstEngine {
             size_t m_VisibleEntityCount = 0;
             size_t m_CulledEntityCount = 0;
             size_t m_DrawCallCount = 0;
+            size_t m_SkippedDrawCount = 0;
+            size_t m_TriangleCount = 0;
+            size_t m_FullDetailTriangleCount = 0;
             
             // Cached camera matrices (computed once per frame in BuildRenderQueueFromEntities)
             glm::mat4 m_CachedViewMatrix = glm::mat4(1.0f);
@@ -1,9 +1,12 @@
 #pragma once
 
 #include "FirstEngine/Renderer/Export.h"
+#include "FirstEngine/Core/Hash.h"
+#include "FirstEngine/Renderer/ShaderLayout.h"
 #include "FirstEngine/RHI/IShaderModule.h"
 #include "FirstEngine/RHI/Types.h"
 #include "FirstEngine/Shader/ShaderCompiler.h"  // For ShaderReflection complete definition
+#include "FirstEngine/Shader/ShaderKeywords.h"
 #include <string>
 #include <unordered_map>
 #include <memory>
@@ -55,19 +58,34 @@ namespace FirstEngine {
 
             // Get SPIR-V code for a specific stage (for creating shader modules)
             const std::vector<uint32_t>* GetSPIRVCode(ShaderStage stage) const;
-            void SetSPIRVCode(ShaderStage stage, const std::vector<uint32_t>& spirvCode);
+            // Takes the code by value: pass the shader cache's buffer with std::move to keep it copy-free
+            void SetSPIRVCode(ShaderStage stage, std::vector<uint32_t> spirvCode);
 
-            // Get MD5 hash for a specific stage (computed from SPIR-V code)
-            const std::string& GetMD5Hash(ShaderStage stage) const;
-            void SetMD5Hash(ShaderStage stage, const std::string& hash);
+            // 128-bit hash of a stage's SPIR-V code (computed by SetSPIRVCode; zero if the stage has no code)
+            Core::Hash128 GetCodeHash(ShaderStage stage) const;
 
             // Shader reflection (parsed during shader loading)
             const Shader::ShaderReflection* GetShaderReflection() const { return m_ShaderReflection.get(); }
+            // Also derives the material layout, so this is the only place reflection gets parsed
             void SetShaderReflection(std::unique_ptr<Shader::ShaderReflection> reflection);
 
+            // Material layout derived from the reflection (nullptr without reflection)
+            // Shared by all materials using this collection
+            std::shared_ptr<const ShaderLayout> GetLayout() const { return m_Layout; }
+
             // Check if collection is valid (has at least vertex and fragment shaders with SPIR-V code)
             bool IsValid() const;
 
+            // Permutation info: base shader name (e.g. "PBR") and keywords this variant was compiled with
+            // For the base collection, base name == name and keywords are empty
+            const std::string& GetBaseName() const { return m_BaseName.empty() ? m_Name : m_BaseName; }
+            const Shader::ShaderKeywordSet& GetKeywords() const { return m_Keywords; }
+            void SetVariantInfo(const std::string& baseName, const Shader::ShaderKeywordSet& keywords) {
+                m_BaseName = baseName;
+                m_Keywords = keywords;
+            }
+            bool IsVariant() const { return !m_Keywords.IsEmpty(); }
+
         private:
             std::string m_Name;
             uint64_t m_ID;
@@ -78,11 +96,16 @@ namespace FirstEngine {
             // SPIR-V code by stage (stored separately for lazy module creation)
             std::unordered_map<ShaderStage, std::vector<uint32_t>> m_SPIRVCode;
 
-            // MD5 hash by stage (computed from SPIR-V code for cache lookup)
-            std::unordered_map<ShaderStage, std::string> m_MD5Hashes;
+            // SPIR-V code hash by stage (shader module cache lookup)
+            std::unordered_map<ShaderStage, Core::Hash128> m_CodeHashes;
 
             // Shader reflection data (parsed once during loading, cached for reuse)
             std::unique_ptr<Shader::ShaderReflection> m_ShaderReflection;
+            std::shared_ptr<const ShaderLayout> m_Layout;
+
+            // Permutation info (empty for base collections)
+            std::string m_BaseName;
+            Shader::ShaderKeywordSet m_Keywords;
         };
 
     } // namespace Renderer
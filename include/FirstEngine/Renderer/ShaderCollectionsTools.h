@@ -2,10 +2,14 @@
 
 #include "FirstEngine/Renderer/Export.h"
 #include "FirstEngine/Renderer/ShaderCollection.h"
-#include "FirstEngine/Renderer/ShaderHash.h"
+#include "FirstEngine/Shader/ShaderKeywords.h"
+#include "FirstEngine/Shader/ShaderCache.h"
 #include <string>
 #include <unordered_map>
+#include <unordered_set>
 #include <memory>
+#include <mutex>
+#include <condition_variable>
 #include <vector>
 
 namespace FirstEngine {
@@ -13,7 +17,9 @@ namespace FirstEngine {
 
         // ShaderCollectionsTools - utility class for managing shader collections
         // Loads all shaders from Package/Shaders directory, compiles HLSL to SPIR-V,
-        // stores SPIR-V code, computes MD5 hashes, and stores ShaderReflection
+        // stores SPIR-V code, computes SPIR-V code hashes, and stores ShaderReflection
+        // Compiled SPIR-V and reflection are cached on disk (see Shader::ShaderCache); cache misses
+        // are compiled in parallel on Core::ThreadManager worker threads
         // Does NOT manage Device or ShaderModule creation (handled by ShaderModuleTools)
         class FE_RENDERER_API ShaderCollectionsTools {
         public:
@@ -23,8 +29,13 @@ namespace FirstEngine {
 
             // Initialize shader collections tools (loads all shaders from directory)
             // shaderDirectory: path to shaders directory (e.g., "build/Package/Shaders")
+            // Uses "<shaderDirectory>/Cache" as shader cache unless SetShaderCacheDirectory was called before
             bool Initialize(const std::string& shaderDirectory);
 
+            // Shader compile cache directory (empty = disable the on-disk cache)
+            void SetShaderCacheDirectory(const std::string& directory);
+            const Shader::ShaderCache& GetShaderCache() const { return m_ShaderCache; }
+
             // Shutdown and cleanup
             void Cleanup();
 
@@ -44,6 +55,7 @@ namespace FirstEngine {
 
             // Load all shaders from directory
             // Automatically detects shader pairs (e.g., PBR.vert.hlsl + PBR.frag.hlsl)
+            // Shaders are built in parallel on worker threads when ThreadManager is initialized
             bool LoadAllShadersFromDirectory(const std::string& shaderDirectory);
 
             // Get all collection IDs
@@ -55,8 +67,36 @@ namespace FirstEngine {
             // Get shader reflection by collection ID (for Material access)
             const Shader::ShaderReflection* GetShaderReflection(uint64_t collectionID) const;
 
-            // Get MD5 hash for a specific shader stage in a collection
-            std::string GetShaderMD5(uint64_t collectionID, ShaderStage stage) const;
+            // Get the SPIR-V code hash for a specific shader stage in a collection (zero if not found)
+            Core::Hash128 GetShaderCodeHash(uint64_t collectionID, ShaderStage stage) const;
+
+            // ========== Shader permutations ==========
+
+            // Get (or compile) a permutation of a base collection
+            // Keywords the shader doesn't declare (// @keywords ...) are ignored, so an empty
+            // effective set returns the base collection itself
+            // Variants are cached by (source hash, keyword set); compiles synchronously on first request
+            // Returns the variant collection ID, or 0 on failure
+            uint64_t GetOrCreateVariant(uint64_t baseCollectionID, const Shader::ShaderKeywordSet& keywords);
+
+            // Non-blocking variant lookup: queues compilation on worker threads on first request
+            // Returns the variant collection ID once compiled, 0 while it is still compiling or on failure
+            uint64_t RequestVariant(uint64_t baseCollectionID, const Shader::ShaderKeywordSet& keywords);
+
+            // Compile all permutations listed in a manifest in parallel (ahead of time, e.g. at load)
+            // Returns the number of variants that are available afterwards
+            size_t PrecompileVariants(const Shader::ShaderPermutationManifest& manifest);
+
+            // Load the package permutation manifest
+            // Once loaded, permutations not listed in it are stripped: requests for them resolve to the base collection
+            bool LoadPermutationManifest(const std::string& filepath);
+            const Shader::ShaderPermutationManifest& GetPermutationManifest() const { return m_PermutationManifest; }
+
+            // Keywords declared by the collection's shader sources
+            Shader::ShaderKeywordSet GetDeclaredKeywords(uint64_t collectionID) const;
+
+            // Default manifest file name inside the shader directory
+            static constexpr const char* kPermutationManifestFile = "ShaderPermutations.txt";
 
         private:
             ShaderCollectionsTools() = default;
@@ -78,11 +118,87 @@ namespace FirstEngine {
             // Next available ID
             uint64_t m_NextID = 1;
 
+            // Guards collection maps and variant caches (variants are added from worker threads)
+            mutable std::recursive_mutex m_Mutex;
+
+            // Shader source info per base shader name (for compiling permutations)
+            struct ShaderSourceInfo {
+                std::string directory;
+                uint64_t sourceHash = 0;                   // Hash of all stage sources and the files they include
+                Shader::ShaderKeywordSet declaredKeywords; // Keywords declared in the sources
+            };
+            std::unordered_map<std::string, ShaderSourceInfo> m_SourceInfos;
+
+            // Variant cache key: (source hash, keyword set hash)
+            struct VariantKey {
+                uint64_t sourceHash;
+                uint64_t keywordHash;
+
+                bool operator==(const VariantKey& other) const {
+                    return sourceHash == other.sourceHash && keywordHash == other.keywordHash;
+                }
+            };
+
+            struct VariantKeyHash {
+                size_t operator()(const VariantKey& key) const {
+                    return std::hash<uint64_t>()(key.sourceHash) ^ (std::hash<uint64_t>()(key.keywordHash) << 1);
+                }
+            };
+
+            // Compiled variants (key -> collection ID, 0 = compile failed)
+            std::unordered_map<VariantKey, uint64_t, VariantKeyHash> m_VariantCache;
+
+            // Variants currently compiling on worker threads; m_VariantCondition (used with m_Mutex) is notified
+            // whenever one is removed
+            std::unordered_set<VariantKey, VariantKeyHash> m_PendingVariants;
+            std::condition_variable_any m_VariantCondition;
+
+            // Package permutation manifest (empty = no stripping)
+            Shader::ShaderPermutationManifest m_PermutationManifest;
+
+            // On-disk SPIR-V + reflection cache (thread-safe)
+            mutable Shader::ShaderCache m_ShaderCache;
+            bool m_ShaderCacheConfigured = false;
+
+            // Helper: Hash sources and parse declared keywords of a base shader (thread-safe)
+            ShaderSourceInfo BuildSourceInfo(const std::string& shaderName, const std::string& shaderDirectory) const;
+
+            // Helper: Register a built base collection with its source info
+            uint64_t RegisterBaseCollection(const std::string& shaderName, const ShaderSourceInfo& sourceInfo,
+                                            std::unique_ptr<ShaderCollection> collection);
+
+            // Helper: Build (compile + reflect) a collection without registering it
+            // Thread-safe: touches no shared state, so it can run on worker threads
+            std::unique_ptr<ShaderCollection> BuildCollection(
+                const std::string& shaderName,
+                const std::string& shaderDirectory,
+                const Shader::ShaderKeywordSet& keywords) const;
+
+            // Helper: Resolve the effective keyword set and cache key for a variant request
+            // Returns false if the base collection is unknown; effectiveKeywords may end up empty (use base)
+            bool ResolveVariant(
+                uint64_t baseCollectionID,
+                const Shader::ShaderKeywordSet& keywords,
+                std::string& outBaseName,
+                Shader::ShaderKeywordSet& outEffectiveKeywords,
+                VariantKey& outKey) const;
+
+            // Helper: Register a compiled variant (called with m_Mutex held)
+            uint64_t RegisterVariant(const VariantKey& key, std::unique_ptr<ShaderCollection> variant);
+
+            // Helper: Register a worker's result, remove its key from m_PendingVariants and wake the waiters
+            void FinishPendingVariant(const VariantKey& key, std::unique_ptr<ShaderCollection> variant);
+
             // Helper: Detect shader stage from filename
             ShaderStage DetectShaderStage(const std::string& filename) const;
 
-            // Helper: Compile HLSL to SPIR-V
-            std::vector<uint32_t> CompileHLSLToSPIRV(const std::string& filepath, ShaderStage stage) const;
+            // Helper: Compile HLSL to SPIR-V + reflection (through the shader cache)
+            // defines: Preprocessor defines (permutation keywords)
+            bool CompileHLSLToSPIRV(
+                const std::string& filepath,
+                ShaderStage stage,
+                const std::vector<std::pair<std::string, std::string>>& defines,
+                Shader::ShaderCacheEntry& outEntry) const;
 
             // Helper: Load shader file content
             std::string LoadShaderFile(const std::string& filepath) const;
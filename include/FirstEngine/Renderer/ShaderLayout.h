@@ -0,0 +1,85 @@
+#pragma once
+
+#include "FirstEngine/Renderer/Export.h"
+#include "FirstEngine/RHI/Types.h"
+#include "FirstEngine/Shader/ShaderCompiler.h"
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace FirstEngine {
+    namespace Renderer {
+
+        // ShaderLayout - material layout derived from a ShaderCollection's reflection
+        // Vertex inputs (with offsets and stride), uniform buffer sizes and member offsets, texture slots and
+        // the push constant size. Built once per collection when its reflection is set and shared (read-only)
+        // by every ShadingMaterial using that collection, so instantiating a material only allocates its
+        // per-instance data instead of re-parsing reflection.
+        class FE_RENDERER_API ShaderLayout {
+        public:
+            // Vertex attribute (offsets are packed in location order of the reflection)
+            struct VertexInput {
+                uint32_t location;
+                std::string name;
+                RHI::Format format;
+                uint32_t offset;
+                uint32_t binding;
+            };
+
+            struct UniformBufferMember {
+                std::string name;
+                uint32_t offset;  // Reflection offset, or std140 estimate when the compiler didn't provide one
+                uint32_t size;
+            };
+
+            struct UniformBuffer {
+                uint32_t set;
+                uint32_t binding;
+                std::string name;
+                uint32_t size;
+                std::vector<UniformBufferMember> members;
+            };
+
+            struct TextureSlot {
+                uint32_t set;
+                uint32_t binding;
+                std::string name;
+                RHI::DescriptorType descriptorType;
+            };
+
+            // Where a named material/render parameter is written
+            struct ParameterLocation {
+                uint32_t uniformBuffer;  // Index into GetUniformBuffers()
+                uint32_t offset;
+                bool wholeBuffer;        // Name matched the buffer itself rather than a member
+            };
+
+            // Derive the layout from (merged vertex + fragment) reflection
+            static std::shared_ptr<const ShaderLayout> Build(const Shader::ShaderReflection& reflection);
+
+            const std::vector<VertexInput>& GetVertexInputs() const { return m_VertexInputs; }
+            uint32_t GetVertexStride() const { return m_VertexStride; }
+            uint32_t GetPushConstantSize() const { return m_PushConstantSize; }
+            const std::vector<UniformBuffer>& GetUniformBuffers() const { return m_UniformBuffers; }
+            const std::vector<TextureSlot>& GetTextureSlots() const { return m_TextureSlots; }
+
+            // Look up a parameter by buffer or member name (first match in reflection order)
+            // Returns nullptr if no uniform buffer declares it
+            const ParameterLocation* FindParameter(const std::string& name) const;
+
+            // Byte size of a vertex attribute format
+            static uint32_t GetFormatSize(RHI::Format format);
+
+        private:
+            std::vector<VertexInput> m_VertexInputs;
+            uint32_t m_VertexStride = 0;
+            uint32_t m_PushConstantSize = 0;
+            std::vector<UniformBuffer> m_UniformBuffers;
+            std::vector<TextureSlot> m_TextureSlots;
+            std::unordered_map<std::string, ParameterLocation> m_Parameters;
+        };
+
+    } // namespace Renderer
+} // namespace FirstEngine
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "FirstEngine/Renderer/Export.h"
+#include "FirstEngine/Core/Hash.h"
 #include "FirstEngine/RHI/IDevice.h"
 #include "FirstEngine/RHI/IShaderModule.h"
 #include "FirstEngine/RHI/Types.h"
@@ -20,7 +21,7 @@ namespace FirstEngine {
 
         // ShaderModuleTools - utility class for managing GPU shader modules
         // Manages Device and creates ShaderModules from SPIR-V code
-        // Uses shaderID + MD5 hash as cache key to avoid duplicate module creation
+        // Uses shaderID + stage + SPIR-V code hash as cache key to avoid duplicate module creation
         class FE_RENDERER_API ShaderModuleTools {
         public:
             // Get singleton instance
@@ -33,24 +34,24 @@ namespace FirstEngine {
             // Shutdown and cleanup
             void Cleanup();
 
-            // Get or create shader module by shaderID and MD5 hash
+            // Get or create shader module by shaderID and code hash
             // shaderID: Collection ID
-            // md5Hash: MD5 hash of the SPIR-V code for this stage
+            // codeHash: 128-bit hash of the SPIR-V code for this stage (Core::HashBytes128)
             // spirvCode: SPIR-V code (used if module doesn't exist in cache)
             // stage: Shader stage
             // Returns the shader module, or nullptr on failure
             RHI::IShaderModule* GetOrCreateShaderModule(
                 uint64_t shaderID,
-                const std::string& md5Hash,
+                const Core::Hash128& codeHash,
                 const std::vector<uint32_t>& spirvCode,
                 ShaderStage stage
             );
 
             // Get shader module from cache (returns nullptr if not found)
-            RHI::IShaderModule* GetShaderModule(uint64_t shaderID, const std::string& md5Hash, ShaderStage stage) const;
+            RHI::IShaderModule* GetShaderModule(uint64_t shaderID, const Core::Hash128& codeHash, ShaderStage stage) const;
 
             // Check if shader module exists in cache
-            bool HasShaderModule(uint64_t shaderID, const std::string& md5Hash, ShaderStage stage) const;
+            bool HasShaderModule(uint64_t shaderID, const Core::Hash128& codeHash, ShaderStage stage) const;
 
             // Clear cache (useful for device recreation)
             void ClearCache();
@@ -68,26 +69,27 @@ namespace FirstEngine {
 
             RHI::IDevice* m_Device = nullptr;
 
-            // Cache key: shaderID + stage + md5Hash -> ShaderModule
+            // Cache key: shaderID + stage + codeHash -> ShaderModule
             struct CacheKey {
                 uint64_t shaderID;
                 uint32_t stage;  // Renderer::ShaderStage as uint32_t
-                std::string md5Hash;
+                Core::Hash128 codeHash;
 
                 bool operator==(const CacheKey& other) const {
-                    return shaderID == other.shaderID && stage == other.stage && md5Hash == other.md5Hash;
+                    return shaderID == other.shaderID && stage == other.stage && codeHash == other.codeHash;
                 }
             };
 
             struct CacheKeyHash {
                 size_t operator()(const CacheKey& key) const {
-                    return std::hash<uint64_t>()(key.shaderID) ^
-                           (std::hash<uint32_t>()(key.stage) << 1) ^
-                           (std::hash<std::string>()(key.md5Hash) << 2);
+                    // The code hash is already well mixed; no string hashing on lookup
+                    return static_cast<size_t>(key.codeHash.low) ^
+                           std::hash<uint64_t>()(key.shaderID) ^
+                           (std::hash<uint32_t>()(key.stage) << 1);
                 }
             };
 
-            // Shader module cache: (shaderID, stage, md5Hash) -> ShaderModule
+            // Shader module cache: (shaderID, stage, codeHash) -> ShaderModule
             std::unordered_map<CacheKey, std::unique_ptr<RHI::IShaderModule>, CacheKeyHash> m_ShaderCache;
 
             // Helper: Map Renderer::ShaderStage (as uint32_t) to RHI::ShaderStage
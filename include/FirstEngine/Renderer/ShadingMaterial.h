@@ -3,8 +3,10 @@
 #include "FirstEngine/Renderer/Export.h"
 #include "FirstEngine/Renderer/ShadingState.h"
 #include "FirstEngine/Renderer/IRenderResource.h"
+#include "FirstEngine/Renderer/ShaderLayout.h"
 #include "FirstEngine/Core/MathTypes.h"
 #include "FirstEngine/Shader/ShaderCompiler.h"
+#include "FirstEngine/Shader/ShaderKeywords.h"
 #include "FirstEngine/RHI/IBuffer.h"
 #include "FirstEngine/RHI/IImage.h"
 #include "FirstEngine/RHI/IShaderModule.h"
@@ -25,9 +27,11 @@ namespace FirstEngine {
     }
 
     namespace Renderer {
+        class FrameUniformRing;
         class MaterialDescriptorManager;
         class RenderParameterCollector;
         class RenderGeometry;
+        class RenderTexture;
         struct RenderParameterValue;
     }
 
@@ -62,15 +66,18 @@ namespace FirstEngine {
             ShadingState& GetShadingState() { return m_ShadingState; }
             const ShadingState& GetShadingState() const { return m_ShadingState; }
 
-            // Geometry information (parsed from shader stage inputs)
-            struct VertexInput {
-                uint32_t location;
-                std::string name;
-                RHI::Format format;
-                uint32_t offset;
-                uint32_t binding;
-            };
-            const std::vector<VertexInput>& GetVertexInputs() const { return m_VertexInputs; }
+            // Geometry information (parsed from shader stage inputs, shared with the collection's layout)
+            using VertexInput = ShaderLayout::VertexInput;
+            const std::vector<VertexInput>& GetVertexInputs() const;
+
+            // Layout shared by all materials using the same ShaderCollection (nullptr before initialization)
+            const ShaderLayout* GetLayout() const { return m_Layout.get(); }
+
+            // Vertex buffer layout the pipeline reads (binding 0)
+            // Defaults to the shader inputs packed as floats in declaration order; geometry stored in other
+            // formats (quantized meshes) overrides it with its own stride, offsets and formats
+            void SetVertexLayout(uint32_t stride, const std::vector<RHI::VertexInputAttribute>& attributes);
+            uint32_t GetVertexStride() const;
 
             // Push constant data
             void SetPushConstantData(const void* data, uint32_t size);
@@ -78,17 +85,35 @@ namespace FirstEngine {
             uint32_t GetPushConstantSize() const { return static_cast<uint32_t>(m_PushConstantData.size()); }
 
             // Uniform buffers (by binding/set)
+            // With a frame uniform ring (RenderResourceManager::GetFrameUniformRing) each flush copies the CPU data
+            // into the ring and the binding's dynamic offset points at that copy, so frames in flight keep reading
+            // their own data; without one the material owns 'buffer' and binds it at offset 0
             struct UniformBufferBinding {
                 uint32_t set;
                 uint32_t binding;
                 std::string name;
                 uint32_t size;
-                std::unique_ptr<RHI::IBuffer> buffer; // GPU buffer
+                std::unique_ptr<RHI::IBuffer> buffer; // GPU buffer (only without a frame uniform ring)
                 std::vector<uint8_t> data; // CPU data
+                uint32_t dynamicOffset = 0; // Offset of the last flushed copy in the bound buffer
             };
             UniformBufferBinding* GetUniformBuffer(uint32_t set, uint32_t binding);
             const std::vector<UniformBufferBinding>& GetUniformBuffers() const { return m_UniformBuffers; }
 
+            // Buffer the descriptor of a uniform buffer binding refers to in a frame slot's descriptor sets
+            // (that slot's ring segment, or the binding's own buffer)
+            RHI::IBuffer* GetDescriptorBuffer(const UniformBufferBinding& ub, uint32_t frameSlot) const;
+
+            // Dynamic offsets to pass when binding this material's descriptor sets, ordered by set then binding
+            const std::vector<uint32_t>& GetDynamicOffsets() const { return m_DynamicOffsets; }
+
+            // False if the dynamic offsets don't point at this frame's data (not flushed this frame, or the ring
+            // segment overflowed); the material must not be drawn then
+            bool HasFrameUniforms() const;
+
+            // Ring the uniform data is staged in; its frame slot also selects the descriptor sets (nullptr: none)
+            FrameUniformRing* GetFrameUniformRing() const { return m_UniformRing; }
+
             // Textures/Samplers (by binding/set)
             struct TextureBinding {
                 uint32_t set;
@@ -96,6 +121,7 @@ namespace FirstEngine {
                 std::string name;
                 RHI::IImage* texture = nullptr; // Texture reference (not owned)
                 RHI::DescriptorType descriptorType = RHI::DescriptorType::CombinedImageSampler; // Descriptor type from shader reflection
+                RenderTexture* renderTexture = nullptr; // Source of texture when bound from a TextureResource (not owned)
             };
             TextureBinding* GetTextureBinding(uint32_t set, uint32_t binding);
             const std::vector<TextureBinding>& GetTextureBindings() const { return m_TextureBindings; }
@@ -103,6 +129,12 @@ namespace FirstEngine {
             // Set texture for a binding
             void SetTexture(uint32_t set, uint32_t binding, RHI::IImage* texture);
 
+            // Bind a RenderTexture: the binding follows its current image (which changes when it finishes
+            // uploading or when TextureStreamer swaps its mip residency) on every RefreshTextureBindings()
+            // The new image is written to the current frame slot's descriptor sets only (see MaterialDescriptorManager)
+            void BindRenderTexture(uint32_t set, uint32_t binding, RenderTexture* renderTexture);
+            void RefreshTextureBindings();
+
             // Descriptor sets (accessed through MaterialDescriptorManager)
             // Returns descriptor set handle for the given set index
             void* GetDescriptorSet(uint32_t set) const;
@@ -116,17 +148,31 @@ namespace FirstEngine {
             std::vector<void*> GetAllDescriptorSetLayouts() const;
 
             // Get shader reflection data
-            const Shader::ShaderReflection& GetShaderReflection() const { return m_ShaderReflection; }
+            // References the ShaderCollection's reflection (materials don't keep a copy)
+            const Shader::ShaderReflection& GetShaderReflection() const;
 
             // Get source material resource
             Resources::MaterialResource* GetMaterialResource() const { return m_MaterialResource; }
 
-            // Ensure pipeline is created (lazy creation)
-            // This will create the pipeline if it doesn't exist yet
+            // Ensure pipeline is created (lazy, asynchronous creation)
+            // The first call queues compilation on worker threads (see PipelineCompiler), later calls poll it
             // renderPass: The render pass to use for pipeline creation
-            // Returns true if pipeline is ready, false otherwise
+            // Returns true if pipeline is ready, false while it is still compiling or on failure
+            // Callers should skip the draw (or use a fallback material) while this returns false
             bool EnsurePipelineCreated(RHI::IDevice* device, RHI::IRenderPass* renderPass);
 
+            // Same as above, for the shader variant selected by render pass keywords
+            // Returns false while the variant shaders or its pipeline are still compiling
+            bool EnsurePipelineCreated(RHI::IDevice* device, RHI::IRenderPass* renderPass, const Shader::ShaderKeywordSet& passKeywords);
+
+            // Get the shading state for render pass keywords (the base state if they don't select a variant)
+            // Variant states share this material's vertex inputs and descriptor sets; only shaders and pipeline differ
+            // Returns nullptr while the variant shaders are still compiling
+            ShadingState* GetShadingStateForKeywords(const Shader::ShaderKeywordSet& passKeywords);
+
+            // Check if pipeline is ready for the given render pass (does not start compilation)
+            bool IsPipelineReady(RHI::IRenderPass* renderPass) const { return m_ShadingState.IsPipelineReady(renderPass); }
+
             // ============================================================================
             // Per-frame update interfaces
             // ============================================================================
@@ -295,11 +341,9 @@ namespace FirstEngine {
             // Shading state (pipeline state + shaders)
             ShadingState m_ShadingState;
 
-            // Shader reflection data (parsed from shader)
-            Shader::ShaderReflection m_ShaderReflection;
-
-            // Geometry information (from shader stage inputs)
-            std::vector<VertexInput> m_VertexInputs;
+            // Shader reflection and derived layout, owned by the ShaderCollection
+            const Shader::ShaderReflection* m_ShaderReflection = nullptr;
+            std::shared_ptr<const ShaderLayout> m_Layout;
 
             // Push constant data
             std::vector<uint8_t> m_PushConstantData;
@@ -308,6 +352,14 @@ namespace FirstEngine {
             // These store CPU-side data and GPU buffer references
             std::vector<UniformBufferBinding> m_UniformBuffers;
 
+            // Ring the uniform data is staged in (nullptr: m_UniformBuffers own their buffers)
+            FrameUniformRing* m_UniformRing = nullptr;
+            // m_UniformBuffers indices in dynamic offset order, and the offsets of the last flush
+            std::vector<size_t> m_DynamicOffsetOrder;
+            std::vector<uint32_t> m_DynamicOffsets;
+            // Ring frame serial m_DynamicOffsets were written in (0: none)
+            uint64_t m_DynamicOffsetsFrame = 0;
+
             // Texture bindings (indexed by set and binding)
             // These store texture references (not owned)
             std::vector<TextureBinding> m_TextureBindings;
@@ -315,6 +367,14 @@ namespace FirstEngine {
             // Descriptor manager - handles all device-specific descriptor operations
             std::unique_ptr<MaterialDescriptorManager> m_DescriptorManager;
 
+            // Geometry-provided vertex layout (SetVertexLayout); used instead of m_Layout's when set
+            bool m_HasVertexLayout = false;
+            uint32_t m_VertexLayoutStride = 0;
+            std::vector<RHI::VertexInputAttribute> m_VertexLayoutAttributes;
+
+            // Shading states for render pass keyword variants (variant collection ID -> state)
+            std::unordered_map<uint64_t, std::unique_ptr<ShadingState>> m_PassVariantStates;
+
             // Owned shader modules (keep them alive)
             std::vector<std::unique_ptr<RHI::IShaderModule>> m_OwnedShaderModules;
 
@@ -323,13 +383,17 @@ namespace FirstEngine {
             RenderParameters m_RenderParameters;
 
             // Helper methods
-            void ParseShaderReflection(const Shader::ShaderReflection& reflection);
-            void BuildVertexInputsFromShader();
+            bool ApplyShaderLayout(void* shaderCollection);
+            bool CreateShaderModules(void* shaderCollection, uint64_t collectionID, ShadingState& state);
             bool CreateUniformBuffers(RHI::IDevice* device);
             
             // Initialize textures and buffers from MaterialResource
             void InitializeFromMaterialResource(Resources::MaterialResource* materialResource);
 
+            // Write a parameter into CPU-side uniform buffer data at the offset the layout has for its name
+            // Returns false if no uniform buffer declares the name or the data doesn't fit
+            bool WriteUniformParameter(const std::string& name, const void* data, uint32_t size);
+
             // Internal helper: Apply a single render parameter to CPU-side data
             // includeTextures: If true, also update texture bindings; if false, skip textures
             // Returns true if parameter was applied successfully
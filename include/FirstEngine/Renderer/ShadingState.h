@@ -2,6 +2,7 @@
 
 #include "FirstEngine/Renderer/Export.h"
 #include "FirstEngine/Renderer/PipelineState.h"
+#include "FirstEngine/Renderer/PipelineCompiler.h"
 #include "FirstEngine/RHI/IShaderModule.h"
 #include "FirstEngine/RHI/IPipeline.h"
 #include <vector>
@@ -35,7 +36,7 @@ namespace FirstEngine {
 
             // Check if pipeline needs to be recreated
             bool IsPipelineDirty() const { return m_PipelineDirty; }
-            void MarkPipelineDirty() { m_PipelineDirty = true; }
+            void MarkPipelineDirty() { m_PipelineDirty = true; m_PipelineCompileFailed = false; }
             void ClearPipelineDirty() { m_PipelineDirty = false; }
 
             // Create pipeline from this state (called by device)
@@ -52,9 +53,46 @@ namespace FirstEngine {
                 const std::vector<RHI::DescriptorSetLayoutHandle>& descriptorSetLayouts = {}
             );
 
+            // Asynchronous variant of CreatePipeline
+            // First call queues compilation on PipelineCompiler worker threads, later calls poll the request
+            // Returns true once the pipeline is ready for renderPass, false while compiling or after a failure
+            bool CreatePipelineAsync(
+                RHI::IDevice* device,
+                RHI::IRenderPass* renderPass,
+                const std::vector<RHI::VertexInputBinding>& vertexBindings,
+                const std::vector<RHI::VertexInputAttribute>& vertexAttributes,
+                const std::vector<RHI::DescriptorSetLayoutHandle>& descriptorSetLayouts = {}
+            );
+
+            // Pipeline is created, up to date and compatible with renderPass
+            bool IsPipelineReady(RHI::IRenderPass* renderPass) const {
+                return m_Pipeline && !m_PipelineDirty && m_PipelineRenderPass == renderPass;
+            }
+
+            // Check if an asynchronous compile is in flight
+            bool IsPipelineCompiling() const { return m_PendingCompile != nullptr; }
+
+            // Check if the last compile failed (cleared by MarkPipelineDirty)
+            bool HasPipelineCompileFailed() const { return m_PipelineCompileFailed; }
+
         private:
+            // Build GraphicsPipelineDescription from pipelineState + shaderModules
+            RHI::GraphicsPipelineDescription BuildPipelineDescription(
+                RHI::IRenderPass* renderPass,
+                const std::vector<RHI::VertexInputBinding>& vertexBindings,
+                const std::vector<RHI::VertexInputAttribute>& vertexAttributes,
+                const std::vector<RHI::DescriptorSetLayoutHandle>& descriptorSetLayouts
+            ) const;
+
             std::unique_ptr<RHI::IPipeline> m_Pipeline;
             bool m_PipelineDirty = true;
+
+            // Render pass the current pipeline was compiled against
+            RHI::IRenderPass* m_PipelineRenderPass = nullptr;
+
+            // In-flight asynchronous compile (nullptr if none)
+            std::shared_ptr<PipelineCompiler::CompileRequest> m_PendingCompile;
+            bool m_PipelineCompileFailed = false;
         };
 
     } // namespace Renderer
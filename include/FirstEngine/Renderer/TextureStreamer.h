@@ -0,0 +1,107 @@
+#pragma once
+
+#include "FirstEngine/Renderer/Export.h"
+#include <cstdint>
+#include <mutex>
+#include <unordered_map>
+
+namespace FirstEngine {
+    namespace Renderer {
+        class RenderTexture;
+
+        // TextureStreamer - keeps cooked textures' mip residency within a VRAM budget
+        // Streamed textures are created with only their tail levels (largest side <= tail size). During culling
+        // SceneRenderer reports how many pixels each visible material covers; Update() turns that into a wanted
+        // mip per texture (about one texel per pixel, assuming the material's UVs span the mesh once), evicts
+        // levels of the least recently used textures while the wanted residency exceeds the budget, and starts
+        // transitions through the UploadManager. A transition builds a new image next to the current one and
+        // is swapped in by RenderTexture once its upload has completed, so nothing waits on the GPU.
+        class FE_RENDERER_API TextureStreamer {
+        public:
+            static constexpr uint64_t kDefaultBudget = 512ull * 1024 * 1024;
+            static constexpr uint64_t kDefaultMaxUploadBytesPerFrame = 16ull * 1024 * 1024;
+            static constexpr uint32_t kDefaultTailSize = 64;
+
+            // Get singleton instance
+            static TextureStreamer& GetInstance();
+            static void Shutdown();
+            static bool HasInstance() { return s_Instance != nullptr; }
+
+            // Disabled: textures created afterwards keep every level resident
+            void SetEnabled(bool enabled) { m_Enabled = enabled; }
+            bool IsEnabled() const { return m_Enabled; }
+
+            // VRAM for streamed textures (resident levels, excluding images still being uploaded)
+            void SetBudget(uint64_t bytes) { m_Budget = bytes; }
+            uint64_t GetBudget() const { return m_Budget; }
+
+            // Levels whose largest side is at most this many texels are loaded with the texture and never evicted
+            void SetTailSize(uint32_t texels) { m_TailSize = texels; }
+            uint32_t GetTailSize() const { return m_TailSize; }
+
+            // Upload bytes of new transitions per Update (one transition always starts, however large)
+            void SetMaxUploadBytesPerFrame(uint64_t bytes) { m_MaxUploadBytesPerFrame = bytes; }
+            uint64_t GetMaxUploadBytesPerFrame() const { return m_MaxUploadBytesPerFrame; }
+
+            // Added to the mip chosen from texel density (positive = blurrier and smaller, negative = sharper)
+            void SetMipBias(float bias) { m_MipBias = bias; }
+            float GetMipBias() const { return m_MipBias; }
+
+            // First tail level of a width x height texture with mipCount levels (0 = too small to stream)
+            uint32_t GetTailMip(uint32_t width, uint32_t height, uint32_t mipCount) const;
+
+            // Called by RenderTexture when a streamed texture is created / destroyed
+            void Register(RenderTexture* texture);
+            void Unregister(RenderTexture* texture);
+
+            // Culling feedback: the texture is drawn this frame across about screenPixels pixels
+            // (the largest coverage over all requests of the frame wins)
+            void RequestScreenSize(RenderTexture* texture, float screenPixels);
+
+            // Once per frame, before the frame's uploads are flushed: swap in finished transitions,
+            // evict to the budget and start new transitions for the requests since the last Update
+            void Update();
+
+            struct Statistics {
+                uint32_t streamedTextures = 0;
+                uint32_t requestedTextures = 0;     // Drawn in the last frame
+                uint32_t pendingTransitions = 0;
+                uint32_t texturesBelowWanted = 0;   // Resident mip coarser than the one their density asks for
+                uint64_t residentBytes = 0;
+                uint64_t wantedBytes = 0;           // Residency if every texture had its wanted mip
+                uint64_t budgetBytes = 0;
+                uint64_t bytesStreamed = 0;         // Uploaded by transitions since startup
+                uint64_t promotions = 0;            // Transitions to a finer mip since startup
+                uint64_t evictions = 0;             // Transitions to a coarser mip since startup
+            };
+            Statistics GetStatistics() const;
+
+        private:
+            TextureStreamer() = default;
+            ~TextureStreamer() = default;
+            TextureStreamer(const TextureStreamer&) = delete;
+            TextureStreamer& operator=(const TextureStreamer&) = delete;
+
+            struct Entry {
+                uint64_t lastRequestFrame = 0;  // LRU key; 0 = never drawn
+                uint32_t requestedMip = 0;      // Finest mip requested during m_Frame
+                uint32_t wantedMip = 0;         // Last evaluated density mip (statistics)
+            };
+
+            static TextureStreamer* s_Instance;
+
+            bool m_Enabled = true;
+            uint64_t m_Budget = kDefaultBudget;
+            uint32_t m_TailSize = kDefaultTailSize;
+            uint64_t m_MaxUploadBytesPerFrame = kDefaultMaxUploadBytesPerFrame;
+            float m_MipBias = 0.0f;
+
+            std::unordered_map<RenderTexture*, Entry> m_Entries;
+            uint64_t m_Frame = 1;               // Requests are collected for this frame until the next Update
+            Statistics m_Stats;
+
+            mutable std::mutex m_Mutex;
+        };
+
+    } // namespace Renderer
+} // namespace FirstEngine
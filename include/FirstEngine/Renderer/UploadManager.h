@@ -0,0 +1,140 @@
+#pragma once
+
+#include "FirstEngine/Renderer/Export.h"
+#include "FirstEngine/RHI/Types.h"
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace FirstEngine {
+    namespace RHI {
+        class IDevice;
+        class IBuffer;
+        class IImage;
+        class ICommandBuffer;
+    }
+
+    namespace Renderer {
+
+        // UploadManager - batches CPU -> GPU copies through a persistently mapped staging ring
+        // Upload* copies the data into the ring right away and queues the GPU copy; Flush() records every
+        // queued copy into one command buffer and submits it with a fence. Nothing waits on the GPU:
+        // each upload returns a ticket, and IsComplete(ticket) turns true once its batch's fence has signaled
+        // (polled in Update()), at which point the batch's ring space is reused.
+        // Render resources keep their ticket and report themselves ready only after completion.
+        class FE_RENDERER_API UploadManager {
+        public:
+            static constexpr uint64_t kDefaultRingSize = 64ull * 1024 * 1024;
+
+            // Get singleton instance
+            static UploadManager& GetInstance();
+            static void Shutdown();
+            static bool HasInstance() { return s_Instance != nullptr; }
+
+            // Create the staging ring (called again with the same device is a no-op)
+            bool Initialize(RHI::IDevice* device, uint64_t ringSize = kDefaultRingSize);
+
+            // Wait for in-flight uploads and release the ring (must run before the device is destroyed)
+            void Cleanup();
+
+            bool IsInitialized() const { return m_Device != nullptr; }
+
+            // Queue a copy into a buffer / into one mip level of an image (leaving it shader-readable)
+            // width/height are the level's size; queue every level of an image before the next Flush so
+            // none of them is sampled before it has been written
+            // Returns the upload's ticket, 0 on failure
+            // Uploads over half the ring get a staging buffer of their own, released with their batch
+            uint64_t UploadBuffer(RHI::IBuffer* dst, const void* data, uint64_t size, uint64_t dstOffset = 0);
+            uint64_t UploadImage(RHI::IImage* dst, const void* data, uint64_t size,
+                                 uint32_t width, uint32_t height, RHI::Format format, uint32_t mipLevel = 0);
+
+            // Submit the queued copies as one batch; returns the batch's ticket (0 if nothing was queued)
+            uint64_t Flush();
+
+            // Retire batches whose fences have signaled and reclaim their ring space
+            void Update();
+
+            // Ticket 0 (no upload) is always complete
+            bool IsComplete(uint64_t ticket) const;
+
+            // Block until the ticket's batch has completed (flushing it first if still queued)
+            void WaitForTicket(uint64_t ticket);
+            void WaitIdle();
+
+            struct Statistics {
+                uint64_t bytesUploaded = 0;
+                uint32_t copiesRecorded = 0;
+                uint32_t submissions = 0;
+                uint32_t ringStalls = 0;        // Times an upload had to wait for ring space
+                uint32_t oversizedUploads = 0;
+                uint32_t batchesInFlight = 0;
+            };
+            Statistics GetStatistics() const;
+
+        private:
+            UploadManager() = default;
+            ~UploadManager();
+            UploadManager(const UploadManager&) = delete;
+            UploadManager& operator=(const UploadManager&) = delete;
+
+            enum class CopyType {
+                Buffer,
+                Image
+            };
+
+            struct PendingCopy {
+                CopyType type = CopyType::Buffer;
+                RHI::IBuffer* src = nullptr;
+                uint64_t srcOffset = 0;
+                RHI::IBuffer* dstBuffer = nullptr;
+                uint64_t dstOffset = 0;
+                uint64_t size = 0;
+                RHI::IImage* dstImage = nullptr;
+                uint32_t width = 0;
+                uint32_t height = 0;
+                RHI::Format format = RHI::Format::Undefined;
+                uint32_t mipLevel = 0;
+            };
+
+            struct Batch {
+                uint64_t ticket = 0;
+                uint64_t ringEnd = 0;           // Ring head when the batch was submitted
+                std::unique_ptr<RHI::ICommandBuffer> commandBuffer;
+                RHI::FenceHandle fence = nullptr;
+                std::vector<std::unique_ptr<RHI::IBuffer>> oversizedBuffers;
+            };
+
+            // Reserve ring space; returns false (with ring space untouched) if the ring is full
+            bool TryAllocateRing(uint64_t size, uint64_t alignment, uint64_t& outOffset);
+            // Reserve staging space, flushing and waiting on old batches if needed
+            bool AllocateStaging(const void* data, uint64_t size, uint64_t alignment, PendingCopy& copy);
+            uint64_t FlushLocked();
+            void RetireLocked(bool wait);
+            RHI::FenceHandle AcquireFence();
+
+            static UploadManager* s_Instance;
+
+            RHI::IDevice* m_Device = nullptr;
+            std::unique_ptr<RHI::IBuffer> m_RingBuffer;
+            uint8_t* m_RingData = nullptr;
+            uint64_t m_RingSize = 0;
+            // Monotonic byte counters; ring position = counter % m_RingSize
+            uint64_t m_RingHead = 0;
+            uint64_t m_RingTail = 0;
+
+            std::vector<PendingCopy> m_Pending;
+            std::vector<std::unique_ptr<RHI::IBuffer>> m_PendingOversized;
+            std::deque<Batch> m_InFlight;
+            std::vector<RHI::FenceHandle> m_FreeFences;
+
+            uint64_t m_CurrentTicket = 1;       // Ticket handed to uploads queued for the next Flush
+            uint64_t m_CompletedTicket = 0;
+            Statistics m_Stats;
+
+            mutable std::mutex m_Mutex;
+        };
+
+    } // namespace Renderer
+} // namespace FirstEngine
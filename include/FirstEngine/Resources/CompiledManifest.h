@@ -0,0 +1,74 @@
+#pragma once
+
+#include "FirstEngine/Resources/Export.h"
+#include "FirstEngine/Resources/CompiledManifestFormat.h"
+#include "FirstEngine/Resources/MappedFile.h"
+#include "FirstEngine/Resources/ResourceID.h"
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace FirstEngine {
+    namespace Resources {
+
+        // One resource of a compiled manifest (CompiledManifest::Write)
+        struct CompiledManifestResource {
+            ResourceID id = InvalidResourceID;
+            std::string path;
+            std::string virtualPath;    // Empty means the path
+            ResourceType type = ResourceType::Unknown;
+        };
+
+        // CompiledManifest - read-only view of a mapped .femanifest
+        // Opening only checks the header, so it costs the same for any number of resources. Lookups by ID,
+        // path or virtual path are one perfect hash probe plus a key compare on the mapping; paths are
+        // normalized while they are hashed and compared, so a lookup allocates nothing.
+        class FE_RESOURCES_API CompiledManifest {
+        public:
+            static constexpr uint32_t kInvalidEntry = 0xFFFFFFFFu;
+
+            CompiledManifest() = default;
+            CompiledManifest(const CompiledManifest&) = delete;
+            CompiledManifest& operator=(const CompiledManifest&) = delete;
+
+            bool Open(const std::string& filepath);
+            bool Open(std::shared_ptr<MappedFile> file, const std::string& name);
+            void Close();
+            bool IsOpen() const { return m_Header != nullptr; }
+
+            uint32_t GetEntryCount() const { return m_Header ? m_Header->entryCount : 0; }
+            ResourceID GetNextID() const { return m_Header ? m_Header->nextID : 1; }
+
+            // Entries are sorted by ID
+            ResourceID GetID(uint32_t index) const { return m_Entries[index].id; }
+            ResourceType GetType(uint32_t index) const { return static_cast<ResourceType>(m_Entries[index].type); }
+            std::string GetPath(uint32_t index) const;
+            std::string GetVirtualPath(uint32_t index) const;
+
+            // Entry of an ID, path or virtual path; kInvalidEntry if the manifest does not have it
+            uint32_t FindID(ResourceID id) const;
+            uint32_t FindPath(const std::string& path) const;
+            uint32_t FindVirtualPath(const std::string& virtualPath) const;
+
+            // Write a compiled manifest (through a temp file renamed over filepath); false if two resources share
+            // an ID, normalized path or normalized virtual path
+            static bool Write(const std::string& filepath, std::vector<CompiledManifestResource> resources, ResourceID nextID);
+
+        private:
+            uint32_t Probe(const uint32_t* index, uint64_t hash) const;
+            uint32_t FindString(const uint32_t* index, const std::string& key, bool virtualPath) const;
+            std::string GetString(uint32_t offset, uint32_t length) const;
+
+            std::string m_Name;
+            std::shared_ptr<MappedFile> m_File;
+            const CompiledManifestHeader* m_Header = nullptr;
+            const CompiledManifestEntry* m_Entries = nullptr;
+            const uint32_t* m_IDIndex = nullptr;
+            const uint32_t* m_PathIndex = nullptr;
+            const uint32_t* m_VirtualPathIndex = nullptr;
+            const char* m_Strings = nullptr;
+        };
+
+    } // namespace Resources
+} // namespace FirstEngine
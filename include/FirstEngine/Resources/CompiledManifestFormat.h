@@ -0,0 +1,62 @@
+#pragma once
+
+#include <cstdint>
+
+namespace FirstEngine {
+    namespace Resources {
+
+        // .femanifest - compiled resource manifest, written next to resource_manifest.json and memory mapped
+        // at runtime
+        // Layout (little-endian):
+        //   CompiledManifestHeader
+        //   CompiledManifestEntry[entryCount]     sorted by ResourceID
+        //   index idIndex                         ResourceID -> entry
+        //   index pathIndex                       normalized path -> entry
+        //   index virtualPathIndex                normalized virtual path -> entry
+        //   char strings[stringsSize]             paths and virtual paths as registered, not terminated
+        // Each index is a perfect hash table: uint32_t displacement[bucketCount] then uint32_t slot[slotCount].
+        // A key's 64-bit hash picks its bucket, the bucket's displacement picks the slot and the slot holds the
+        // entry index (kEmptySlot if unused); the entry's key is compared to reject keys that are not present.
+        // Paths are normalized as ResourceIDManager does: '\\' read as '/', repeated separators collapsed,
+        // ASCII lower case. Offsets are from the start of the file.
+        namespace CompiledManifestFormat {
+            constexpr uint32_t kMagic = 0x4E414D46;    // "FMAN"
+            constexpr uint32_t kVersion = 1;
+            constexpr uint32_t kEmptySlot = 0xFFFFFFFFu;
+            constexpr uint32_t kKeysPerBucket = 4;     // Average bucket size
+            constexpr const char* kExtension = ".femanifest";
+        }
+
+        struct CompiledManifestHeader {
+            uint32_t magic;
+            uint32_t version;
+            uint32_t entryCount;
+            uint32_t bucketCount;      // Per index
+            uint32_t slotCount;        // Per index, about entryCount / 0.8
+            uint32_t reserved;
+            uint64_t seed;             // Hash seed the indices were built with
+            uint64_t nextID;
+            uint64_t entriesOffset;
+            uint64_t idIndexOffset;
+            uint64_t pathIndexOffset;
+            uint64_t virtualPathIndexOffset;
+            uint64_t stringsOffset;
+            uint64_t stringsSize;
+            uint64_t fileSize;
+        };
+
+        struct CompiledManifestEntry {
+            uint64_t id;
+            uint32_t pathOffset;           // Into the string pool
+            uint32_t pathLength;
+            uint32_t virtualPathOffset;    // Same range as the path when the virtual path is the path
+            uint32_t virtualPathLength;
+            uint32_t type;                 // ResourceType
+            uint32_t reserved;
+        };
+
+        static_assert(sizeof(CompiledManifestHeader) % 16 == 0, "CompiledManifestHeader must keep the entries aligned");
+        static_assert(sizeof(CompiledManifestEntry) % 16 == 0, "CompiledManifestEntry must keep the indices aligned");
+
+    } // namespace Resources
+} // namespace FirstEngine
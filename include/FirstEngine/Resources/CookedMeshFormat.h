@@ -0,0 +1,82 @@
+#pragma once
+
+#include <cstdint>
+
+namespace FirstEngine {
+    namespace Resources {
+
+        // .femesh - cooked mesh written by ResourceImport and memory mapped at runtime
+        // Layout (little-endian, every section starts on a 16-byte boundary):
+        //   CookedMeshHeader
+        //   CookedMeshAttribute[attributeCount]   vertex format descriptor
+        //   CookedMeshLod[lodCount]               index range per level of detail, LOD 0 first
+        //   vertex data                           interleaved, vertexCount * vertexStride bytes, GPU-ready;
+        //                                         attributes may be quantized (Unorm16 positions span the bounds)
+        //   index data                            uint16_t or uint32_t[indexCount] (kFlagIndex16), every LOD
+        //                                         back to back; all LODs index the same vertices
+        //   CookedMeshBone[boneCount]
+        //   bone names                            UTF-8, referenced by offset/length, not null-terminated
+        // Offsets are from the start of the file, so sections can be used in place without any parsing.
+        namespace CookedMesh {
+            constexpr uint32_t kMagic = 0x48534D46;    // "FMSH"
+            constexpr uint32_t kVersion = 3;    // 2: per-attribute encoding, 3: LOD table
+            constexpr uint64_t kAlignment = 16;
+            constexpr const char* kExtension = ".femesh";
+            constexpr uint32_t kMaxLods = 8;
+
+            // CookedMeshHeader::flags
+            constexpr uint32_t kFlagIndex16 = 1u << 0;    // Indices are uint16_t (vertexCount <= 65535)
+        }
+
+        struct CookedMeshHeader {
+            uint32_t magic;
+            uint32_t version;
+            uint32_t vertexCount;
+            uint32_t indexCount;
+            uint32_t vertexStride;
+            uint32_t attributeCount;
+            uint32_t boneCount;
+            uint32_t flags;
+            float boundsMin[3];
+            float boundsMax[3];
+            uint32_t lodCount;    // >= 1
+            uint32_t reserved[3];
+            uint64_t attributesOffset;
+            uint64_t lodsOffset;
+            uint64_t vertexDataOffset;
+            uint64_t indexDataOffset;
+            uint64_t bonesOffset;
+            uint64_t boneNamesOffset;
+            uint64_t fileSize;
+        };
+
+        struct CookedMeshAttribute {
+            uint32_t type;        // VertexAttributeType
+            uint32_t offset;
+            uint16_t size;
+            uint16_t encoding;    // VertexAttributeEncoding
+            uint32_t location;
+        };
+
+        struct CookedMeshLod {
+            uint32_t firstIndex;
+            uint32_t indexCount;
+            float error;          // Deviation from LOD 0 relative to the bounding sphere radius
+            uint32_t reserved;
+        };
+
+        struct CookedMeshBone {
+            float offsetMatrix[16];    // Column-major, as glm::mat4
+            int32_t parentIndex;
+            uint32_t nameOffset;       // Into the bone name section
+            uint32_t nameLength;
+            uint32_t reserved;
+        };
+
+        static_assert(sizeof(CookedMeshHeader) % 16 == 0, "CookedMeshHeader must keep sections 16-byte aligned");
+        static_assert(sizeof(CookedMeshAttribute) % 16 == 0, "CookedMeshAttribute must keep sections 16-byte aligned");
+        static_assert(sizeof(CookedMeshLod) % 16 == 0, "CookedMeshLod must keep sections 16-byte aligned");
+        static_assert(sizeof(CookedMeshBone) % 16 == 0, "CookedMeshBone must keep sections 16-byte aligned");
+
+    } // namespace Resources
+} // namespace FirstEngine
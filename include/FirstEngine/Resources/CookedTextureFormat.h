@@ -0,0 +1,53 @@
+#pragma once
+
+#include <cstdint>
+
+namespace FirstEngine {
+    namespace Resources {
+
+        // .fetex - cooked texture written by ResourceImport and memory mapped at runtime
+        // Layout (little-endian, every section starts on a 16-byte boundary):
+        //   CookedTextureHeader
+        //   CookedTextureMip[mipCount]            one entry per level, largest first
+        //   mip data                              GPU-ready: RGBA8 texels or 4x4 blocks (TextureEncoding),
+        //                                         rows tightly packed, so each level is one buffer-to-image copy
+        // Offsets are from the start of the file, so levels can be uploaded straight from the mapping.
+        namespace CookedTexture {
+            constexpr uint32_t kMagic = 0x58455446;    // "FTEX"
+            constexpr uint32_t kVersion = 1;
+            constexpr uint64_t kAlignment = 16;
+            constexpr const char* kExtension = ".fetex";
+            constexpr uint32_t kMaxMips = 16;          // Up to 32768x32768
+
+            // CookedTextureHeader::flags
+            constexpr uint32_t kFlagSRGB = 1u << 0;     // Color data; mips were filtered in linear light
+            constexpr uint32_t kFlagAlpha = 1u << 1;    // Source had an alpha channel
+        }
+
+        struct CookedTextureHeader {
+            uint32_t magic;
+            uint32_t version;
+            uint32_t width;
+            uint32_t height;
+            uint32_t mipCount;
+            uint32_t encoding;    // TextureEncoding
+            uint32_t flags;
+            uint32_t channels;    // Channels of the source image
+            uint64_t mipsOffset;
+            uint64_t fileSize;
+            uint32_t reserved[4];
+        };
+
+        struct CookedTextureMip {
+            uint64_t offset;
+            uint64_t size;
+            uint32_t width;
+            uint32_t height;
+            uint32_t reserved[2];
+        };
+
+        static_assert(sizeof(CookedTextureHeader) % 16 == 0, "CookedTextureHeader must keep sections 16-byte aligned");
+        static_assert(sizeof(CookedTextureMip) % 16 == 0, "CookedTextureMip must keep sections 16-byte aligned");
+
+    } // namespace Resources
+} // namespace FirstEngine
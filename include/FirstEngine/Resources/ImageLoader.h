@@ -29,6 +29,8 @@ namespace FirstEngine {
         class FE_RESOURCES_API ImageLoader {
         public:
             static ImageData LoadFromFile(const std::string& filepath);
+            // Encoded image already in memory (a mapped or archived file); sourceName is only used in errors
+            static ImageData LoadFromMemory(const uint8_t* data, size_t size, const std::string& sourceName);
 
             static ImageFormat DetectFormat(const std::string& filepath);
             static ImageFormat DetectFormat(const uint8_t* data, size_t size);
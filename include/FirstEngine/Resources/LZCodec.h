@@ -0,0 +1,28 @@
+#pragma once
+
+#include "FirstEngine/Resources/Export.h"
+#include <cstddef>
+#include <cstdint>
+
+namespace FirstEngine {
+    namespace Resources {
+
+        // LZCodec - byte-oriented LZ77 compression in the LZ4 block format
+        // Used for package archive entries: decoding is a loop of literal and match copies with no entropy
+        // stage, so it runs at memory speed on the loader threads. The encoder is a greedy single-probe hash
+        // matcher with a 64 KiB window; it trades ratio for import speed. Blocks carry no header - the caller
+        // stores the compressed and decompressed sizes.
+        class FE_RESOURCES_API LZCodec {
+        public:
+            // Worst case output for incompressible input
+            static size_t GetMaxCompressedSize(size_t sourceSize);
+
+            // Compress into dst (at least GetMaxCompressedSize(sourceSize) bytes); returns the compressed size
+            static size_t Compress(const uint8_t* source, size_t sourceSize, uint8_t* dst, size_t dstCapacity);
+
+            // Decode a block that expands to exactly dstSize bytes; false if it is corrupt or truncated
+            static bool Decompress(const uint8_t* source, size_t sourceSize, uint8_t* dst, size_t dstSize);
+        };
+
+    } // namespace Resources
+} // namespace FirstEngine
@@ -0,0 +1,52 @@
+#pragma once
+
+#include "FirstEngine/Resources/Export.h"
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace FirstEngine {
+    namespace Resources {
+
+        // MappedFile - read-only memory mapping of a whole file
+        // Cooked resources point straight into the mapping, so loading them costs page faults instead of
+        // read + parse + copy; the OS page cache is shared between runs and processes.
+        // Files read from a package archive are either a view into the archive's mapping (stored entries) or
+        // a decoded copy in memory (compressed entries); users see the same interface either way.
+        class FE_RESOURCES_API MappedFile {
+        public:
+            MappedFile() = default;
+            ~MappedFile();
+
+            MappedFile(const MappedFile&) = delete;
+            MappedFile& operator=(const MappedFile&) = delete;
+
+            bool Open(const std::string& filepath);
+
+            // Range of another mapping, which the view keeps alive
+            bool OpenView(std::shared_ptr<const MappedFile> source, uint64_t offset, uint64_t size);
+
+            // Bytes already in memory
+            bool OpenBuffer(std::vector<uint8_t> bytes);
+
+            void Close();
+            bool IsOpen() const { return m_Data != nullptr; }
+
+            const uint8_t* GetData() const { return m_Data; }
+            uint64_t GetSize() const { return m_Size; }
+
+        private:
+            const uint8_t* m_Data = nullptr;
+            uint64_t m_Size = 0;
+            std::shared_ptr<const MappedFile> m_Source;    // OpenView
+            std::vector<uint8_t> m_Buffer;                 // OpenBuffer
+            bool m_Mapped = false;
+#ifdef _WIN32
+            void* m_File = nullptr;       // HANDLE
+            void* m_Mapping = nullptr;    // HANDLE
+#endif
+        };
+
+    } // namespace Resources
+} // namespace FirstEngine
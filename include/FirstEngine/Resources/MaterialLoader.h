@@ -25,6 +25,7 @@ namespace FirstEngine {
             // Loader only loads current resource data, dependencies are handled by Resource::Load
             struct LoadResult {
                 std::string shaderName;                                    // Handle data
+                std::vector<std::string> keywords;                         // Handle data (shader permutation keywords)
                 std::unordered_map<std::string, MaterialParameterValue> parameters; // Handle data
                 ResourceMetadata metadata;                                 // Metadata (name, ID, dependencies, etc.)
                 bool success = false;
@@ -41,7 +42,8 @@ namespace FirstEngine {
                            const std::string& shaderName,
                            const std::unordered_map<std::string, MaterialParameterValue>& parameters,
                            const std::unordered_map<std::string, ResourceID>& textureSlots,
-                           const std::vector<ResourceDependency>& dependencies);
+                           const std::vector<ResourceDependency>& dependencies,
+                           const std::vector<std::string>& keywords = {});
 
             // Check if format is supported
             static bool IsFormatSupported(const std::string& filepath);
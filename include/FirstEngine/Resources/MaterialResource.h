@@ -36,6 +36,9 @@ namespace FirstEngine {
             const std::string& GetShaderName() const override { return m_ShaderName; }
             void SetShaderName(const std::string& name) override { m_ShaderName = name; }
 
+            // Shader permutation keywords (each becomes a #define when the shader variant is compiled)
+            const std::vector<std::string>& GetShaderKeywords() const { return m_ShaderKeywords; }
+
             void SetTexture(const std::string& slot, TextureHandle texture) override;
             TextureHandle GetTexture(const std::string& slot) const override;
 
@@ -117,6 +120,7 @@ namespace FirstEngine {
         private:
             ResourceMetadata m_Metadata;
             std::string m_ShaderName; // Shader name (used to find ShaderCollection)
+            std::vector<std::string> m_ShaderKeywords; // Permutation keywords (select the ShaderCollection variant)
             
             // ShaderCollection (stored as void* to avoid circular dependency)
             // Points to Renderer::ShaderCollection*
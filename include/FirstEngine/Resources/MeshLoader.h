@@ -4,6 +4,8 @@
 #include "FirstEngine/Resources/ResourceTypes.h"
 #include "FirstEngine/Resources/ResourceID.h"
 #include "FirstEngine/Resources/VertexFormat.h"
+#include "FirstEngine/Resources/VertexQuantizer.h"
+#include "FirstEngine/Resources/MappedFile.h"
 #include <string>
 #include <vector>
 #include <memory>
@@ -27,7 +29,26 @@ namespace FirstEngine {
         class ResourceManager;
         struct ResourceMetadata;
 
+        // One level of detail: a range of the mesh index buffer over the shared vertex buffer
+        struct MeshLod {
+            uint32_t firstIndex = 0;
+            uint32_t indexCount = 0;
+            float error = 0.0f;    // Deviation from LOD 0 relative to the bounding sphere radius (half the AABB diagonal)
+        };
+
+        // Import-time settings for MeshLoader::Cook
+        struct MeshCookOptions {
+            bool optimize = true;                     // MeshOptimizer stages + 16-bit indices
+            bool quantize = true;                     // Compress attributes with VertexQuantizer
+            VertexQuantizer::Options quantization;
+            uint32_t lodLevels = 4;                   // Simplified levels below LOD 0 (MeshSimplifier), 0 = none
+            float lodRatio = 0.5f;                    // Triangle ratio between consecutive levels
+            float lodMaxError = 0.1f;                 // Relative to the bounding sphere radius
+        };
+
         // Mesh loader - loads actual mesh geometry data (vertices, indices, bones) from XML and binary files
+        // At runtime geometry comes from the cooked .femesh (see CookedMeshFormat.h), which is memory mapped and
+        // used in place; Assimp only runs when ResourceImport cooks the source file.
         // ResourceManager is used internally for caching, not exposed to Resource classes
         class FE_RESOURCES_API MeshLoader {
         public:
@@ -39,10 +60,25 @@ namespace FirstEngine {
                 std::vector<Bone> bones;           // Handle data: bone/skeleton data
                 VertexFormat vertexFormat;         // Handle data: vertex format descriptor
                 uint32_t vertexCount = 0;          // Handle data: number of vertices
+                uint32_t indexCount = 0;           // Handle data: number of indices
+                uint32_t indexSize = sizeof(uint32_t);  // Bytes per index in GetIndexData() (2 or 4)
+                glm::vec3 boundsMin = glm::vec3(0.0f);
+                glm::vec3 boundsMax = glm::vec3(0.0f);
+                std::vector<MeshLod> lods;         // Index ranges per level, finest first; empty = one level, all indices
                 std::string meshFile;              // Source mesh file path (for saving)
+                std::string cookedFile;            // Cooked .femesh path (for saving)
                 ResourceMetadata metadata;         // Metadata (name, ID, dependencies, etc.)
                 bool success = false;
 
+                // Cooked meshes leave vertexData/indices empty and point into the mapped file instead;
+                // the mapping must outlive whoever holds these pointers
+                std::shared_ptr<MappedFile> mappedFile;
+                const uint8_t* mappedVertexData = nullptr;
+                const void* mappedIndexData = nullptr;
+
+                const uint8_t* GetVertexData() const { return mappedFile ? mappedVertexData : vertexData.data(); }
+                const void* GetIndexData() const { return mappedFile ? mappedIndexData : indices.data(); }
+
                 // Legacy support: Convert to old Vertex format (if format matches)
                 // NOTE: This method is kept for backward compatibility. New code should use vertexData and vertexFormat directly.
                 // TODO: Consider deprecating this in a future version
@@ -54,12 +90,26 @@ namespace FirstEngine {
             static LoadResult Load(ResourceID id);
 
             // Save mesh to XML file (similar to TextureLoader::Save)
-            // XML contains metadata and source mesh file path (fbx, obj, etc.)
+            // XML contains metadata, source mesh file path (fbx, obj, etc.) and the cooked .femesh path
             // Note: vertexStride is calculated from mesh file, not stored in XML
             static bool Save(const std::string& xmlFilePath,
                            const std::string& name,
                            ResourceID id,
-                           const std::string& meshFile);
+                           const std::string& meshFile,
+                           const std::string& cookedFile = "");
+
+            // Import-time: run Assimp on a source file (first mesh only), optimize it with MeshOptimizer
+            // (printing before/after statistics), generate LODs, quantize the vertices and write it as a cooked .femesh
+            static bool Cook(const std::string& sourcePath, const std::string& cookedPath,
+                             const MeshCookOptions& options = MeshCookOptions());
+
+            // Import the first mesh of a source file with Assimp (geometry only, no metadata)
+            static bool ImportFromSource(const std::string& sourcePath, LoadResult& outResult);
+
+            // Write / map a cooked .femesh (geometry only, no metadata)
+            // Indices are stored as uint16_t when allowed and every vertex can be addressed that way
+            static bool WriteCooked(const std::string& cookedPath, const LoadResult& mesh, bool allow16BitIndices = true);
+            static bool ReadCooked(const std::string& cookedPath, LoadResult& outResult);
 
             // Check if format is supported
             static bool IsFormatSupported(const std::string& filepath);
@@ -0,0 +1,67 @@
+#pragma once
+
+#include "FirstEngine/Resources/Export.h"
+#include "FirstEngine/Resources/MeshLoader.h"
+#include <cstdint>
+#include <vector>
+
+namespace FirstEngine {
+    namespace Resources {
+
+        // MeshOptimizer - import-time reordering of an indexed triangle list for the GPU
+        // Run by MeshLoader::Cook before the .femesh is written; none of it is needed at runtime.
+        // Pipeline: weld identical vertices -> vertex cache order (Forsyth) -> overdraw-aware cluster order
+        // -> vertex fetch order. 16-bit indices are chosen when the .femesh is written.
+        class FE_RESOURCES_API MeshOptimizer {
+        public:
+            // Transform cache efficiency, measured with a FIFO post-transform cache
+            struct Statistics {
+                uint32_t vertexCount = 0;
+                uint32_t triangleCount = 0;
+                float acmr = 0.0f;    // Average cache miss ratio: transformed vertices per triangle (0.5 .. 3)
+                float atvr = 0.0f;    // Average transform to vertex ratio: transformed / unique vertices (1 = ideal)
+            };
+
+            struct Options {
+                bool weld = true;
+                bool optimizeVertexCache = true;
+                bool optimizeOverdraw = true;
+                bool optimizeVertexFetch = true;
+                bool allow16BitIndices = true;
+                // Overdraw ordering may cost this much ACMR (1.05 = up to 5% worse) to split into more clusters
+                float overdrawThreshold = 1.05f;
+            };
+
+            struct Report {
+                Statistics before;
+                Statistics after;
+            };
+
+            static constexpr uint32_t kStatisticsCacheSize = 16;
+
+            // Run the enabled stages on an in-memory mesh (not a mapped .femesh) and fill 'report' if given
+            static bool Optimize(MeshLoader::LoadResult& mesh, const Options& options, Report* report = nullptr);
+
+            static Statistics Analyze(const std::vector<uint32_t>& indices, uint32_t vertexCount,
+                                      uint32_t cacheSize = kStatisticsCacheSize);
+
+            // Merge byte-identical vertices; returns the new vertex count
+            static uint32_t WeldVertices(std::vector<uint8_t>& vertexData, uint32_t vertexStride,
+                                         std::vector<uint32_t>& indices);
+
+            // Reorder triangles for the post-transform vertex cache (Forsyth's linear-speed algorithm)
+            static void OptimizeVertexCache(std::vector<uint32_t>& indices, uint32_t vertexCount);
+
+            // Split the cache-optimized order into clusters and sort them outside-in to reduce overdraw
+            // (Sander et al., "Fast Triangle Reordering for Vertex Locality and Reduced Overdraw")
+            static void OptimizeOverdraw(std::vector<uint32_t>& indices, const uint8_t* vertexData, uint32_t vertexCount,
+                                         uint32_t vertexStride, uint32_t positionOffset, float threshold);
+
+            // Renumber vertices in first-use order so vertex fetch walks memory linearly; drops unused vertices
+            // Returns the new vertex count
+            static uint32_t OptimizeVertexFetch(std::vector<uint8_t>& vertexData, uint32_t vertexStride,
+                                                std::vector<uint32_t>& indices);
+        };
+
+    } // namespace Resources
+} // namespace FirstEngine
@@ -33,10 +33,21 @@ namespace FirstEngine {
             // IMesh interface
             uint32_t GetVertexCount() const override { return m_VertexCount; }
             uint32_t GetIndexCount() const override { return m_IndexCount; }
-            const void* GetVertexData() const override { return m_VertexData.data(); }
-            const void* GetIndexData() const override { return m_IndexData.data(); }
+            const void* GetVertexData() const override { return m_VertexPtr; }
+            const void* GetIndexData() const override { return m_IndexPtr; }
+            uint32_t GetIndexSize() const override { return m_IndexSize; }
             uint32_t GetVertexStride() const override { return m_VertexStride; }
-            bool IsIndexed() const override { return !m_IndexData.empty(); }
+            bool IsIndexed() const override { return m_IndexCount > 0 && m_IndexPtr != nullptr; }
+
+            // Layout and encodings of GetVertexData() (quantized for cooked meshes, see VertexQuantizer)
+            const VertexFormat& GetVertexFormat() const { return m_VertexFormat; }
+
+            // Object-space bounds (precomputed in the cooked mesh)
+            const glm::vec3& GetBoundsMin() const { return m_BoundsMin; }
+            const glm::vec3& GetBoundsMax() const { return m_BoundsMax; }
+
+            // Levels of detail, finest first, as index ranges of GetIndexData(); empty = one level over all indices
+            const std::vector<MeshLod>& GetLods() const { return m_Lods; }
 
             // Save resource to XML file
             bool Save(const std::string& xmlFilePath) const;
@@ -60,20 +71,35 @@ namespace FirstEngine {
                 void* vertexBuffer = nullptr;
                 void* indexBuffer = nullptr;
                 uint32_t vertexCount = 0;
-                uint32_t indexCount = 0;
+                uint32_t indexCount = 0;   // LOD 0
                 uint32_t firstIndex = 0;
                 uint32_t firstVertex = 0;
                 uint32_t vertexStride = 0; // Vertex stride for validation
+                uint32_t indexSize = sizeof(uint32_t);
+                const MeshLod* lods = nullptr;  // All levels (owned by the mesh), lodCount entries
+                uint32_t lodCount = 0;
             };
             bool GetRenderData(RenderData& outData) const;
 
         private:
             ResourceMetadata m_Metadata;
             std::string m_SourceMeshFile;  // Source mesh file path (fbx, obj, etc.) - similar to TextureResource
-            std::vector<uint8_t> m_VertexData;
+            std::string m_CookedMeshFile;  // Cooked .femesh path
+            std::vector<uint8_t> m_VertexData;  // Owned copy; stays empty for cooked meshes
             std::vector<uint8_t> m_IndexData;
+
+            // Cooked meshes are used in place: the pointers below point into the mapping, which lives as long as
+            // the resource, so GPU upload copies straight from the mapped file into the staging ring
+            std::shared_ptr<MappedFile> m_MappedFile;
+            const void* m_VertexPtr = nullptr;
+            const void* m_IndexPtr = nullptr;
+            VertexFormat m_VertexFormat;
+            glm::vec3 m_BoundsMin = glm::vec3(0.0f);
+            glm::vec3 m_BoundsMax = glm::vec3(0.0f);
+            std::vector<MeshLod> m_Lods;
             uint32_t m_VertexCount = 0;
             uint32_t m_IndexCount = 0;
+            uint32_t m_IndexSize = sizeof(uint32_t);
             uint32_t m_VertexStride = 0;
             
             // GPU render resource (stored in Handle, not Component)
@@ -0,0 +1,34 @@
+#pragma once
+
+#include "FirstEngine/Resources/Export.h"
+#include "FirstEngine/Resources/MeshLoader.h"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace FirstEngine {
+    namespace Resources {
+
+        // MeshSimplifier - import-time level-of-detail generation
+        // Quadric error metric edge collapse (Garland & Heckbert, "Surface Simplification Using Quadric Error
+        // Metrics"). Collapses move a vertex onto a neighbour, so every LOD indexes the same vertex buffer and only
+        // adds an index range to the .femesh. Vertices on borders, non-manifold edges and attribute seams (several
+        // vertices at one position) stay put, which keeps meshes closed and UVs intact.
+        class FE_RESOURCES_API MeshSimplifier {
+        public:
+            // Simplify a triangle list toward targetIndexCount without exceeding maxError
+            // Errors are distances relative to the bounding sphere radius of the positions (half the AABB diagonal)
+            // Returns the error of the result; outIndices references the input vertices
+            static float Simplify(const std::vector<uint32_t>& indices, const uint8_t* vertexData, uint32_t vertexCount,
+                                  uint32_t vertexStride, uint32_t positionOffset, size_t targetIndexCount,
+                                  float maxError, std::vector<uint32_t>& outIndices);
+
+            // Append up to 'levels' simplified LODs to an in-memory mesh with float positions
+            // LOD n targets ratio^n of the LOD 0 triangles; generation stops early once a level stops shrinking
+            // (error limit or locked vertices). Each level is vertex cache optimized; mesh.lods gets one entry per
+            // level including LOD 0 and mesh.indices holds all of them back to back.
+            static bool GenerateLods(MeshLoader::LoadResult& mesh, uint32_t levels, float ratio, float maxError);
+        };
+
+    } // namespace Resources
+} // namespace FirstEngine
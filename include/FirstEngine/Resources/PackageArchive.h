@@ -0,0 +1,84 @@
+#pragma once
+
+#include "FirstEngine/Resources/Export.h"
+#include "FirstEngine/Resources/MappedFile.h"
+#include "FirstEngine/Resources/PackageArchiveFormat.h"
+#include "FirstEngine/Resources/ResourceID.h"
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace FirstEngine {
+    namespace Resources {
+
+        // One file to pack (ResourceImport pack)
+        struct PackageArchiveFile {
+            std::string path;                           // Package-relative path stored in the archive
+            std::string sourcePath;                     // File on disk
+            ResourceID resourceID = InvalidResourceID;  // Set for the descriptor of a manifest resource
+            bool allowCompression = true;               // Cooked payloads are stored so they map zero-copy
+        };
+
+        struct PackageWriteOptions {
+            bool compress = true;
+            float maxCompressedRatio = 0.9f;    // Keep an entry compressed only if it shrinks to at most this
+        };
+
+        // PackageArchive - read-only view of a mapped .fepak
+        // Opening maps the file and validates the tables; lookups are binary searches over the mapped
+        // indices, so nothing is allocated or read from disk per entry. Safe to use from any thread once open.
+        class FE_RESOURCES_API PackageArchive {
+        public:
+            static constexpr uint32_t kInvalidEntry = 0xFFFFFFFFu;
+
+            struct WriteReport {
+                uint32_t entryCount = 0;
+                uint32_t compressedCount = 0;
+                uint64_t sourceBytes = 0;
+                uint64_t archiveBytes = 0;
+            };
+
+            PackageArchive() = default;
+            PackageArchive(const PackageArchive&) = delete;
+            PackageArchive& operator=(const PackageArchive&) = delete;
+
+            bool Open(const std::string& archivePath);
+            void Close();
+            bool IsOpen() const { return m_Header != nullptr; }
+            const std::string& GetPath() const { return m_Path; }
+
+            uint32_t GetEntryCount() const { return m_Header ? m_Header->entryCount : 0; }
+            const PackageArchiveEntry& GetEntry(uint32_t index) const { return m_Entries[index]; }
+            std::string GetEntryPath(uint32_t index) const;
+
+            // Entry of a package-relative path (case-insensitive, either separator) or of a resource's
+            // descriptor; kInvalidEntry if the archive does not have it
+            uint32_t FindPath(const std::string& path) const;
+            uint32_t FindResource(ResourceID id) const;
+
+            // Contents of an entry: a view into the mapping if stored, a decoded copy if compressed
+            std::shared_ptr<MappedFile> OpenEntry(uint32_t index) const;
+
+            // FNV-1a of the lower case path with '\\' read as '/'
+            static uint64_t HashPath(const char* path, size_t length);
+
+            // Write an archive; entries keep the order of 'files' (keep related files next to each other)
+            // The archive is written to '<archivePath>.tmp' and renamed over archivePath only once complete
+            static bool Write(const std::string& archivePath, const std::vector<PackageArchiveFile>& files,
+                              const PackageWriteOptions& options, WriteReport* report = nullptr);
+
+        private:
+            bool PathEquals(uint32_t index, const char* path, size_t length) const;
+
+            std::string m_Path;
+            std::shared_ptr<MappedFile> m_File;
+            const PackageArchiveHeader* m_Header = nullptr;
+            const PackageArchiveEntry* m_Entries = nullptr;
+            const uint32_t* m_IDIndex = nullptr;
+            const uint32_t* m_PathIndex = nullptr;
+            const char* m_Paths = nullptr;
+        };
+
+    } // namespace Resources
+} // namespace FirstEngine
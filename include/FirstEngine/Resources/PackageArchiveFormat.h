@@ -0,0 +1,59 @@
+#pragma once
+
+#include <cstdint>
+
+namespace FirstEngine {
+    namespace Resources {
+
+        // .fepak - whole package in one file, written by ResourceImport pack and memory mapped at runtime
+        // Layout (little-endian):
+        //   PackageArchiveHeader
+        //   entry data                            every entry starts on a kAlignment boundary, in TOC order
+        //   PackageArchiveEntry[entryCount]       table of contents, sorted by offset
+        //   uint32_t idIndex[idCount]             TOC indices of resource descriptors, sorted by ResourceID
+        //   uint32_t pathIndex[entryCount]        TOC indices sorted by path hash (then path)
+        //   char paths[pathsSize]                 package-relative paths, '/' separated, not terminated
+        // Offsets are from the start of the file. Stored entries are used in place through the mapping, and
+        // since cooked files are aligned inside to less than kAlignment their sections stay aligned too.
+        namespace PackageArchiveFormat {
+            constexpr uint32_t kMagic = 0x4B415046;    // "FPAK"
+            constexpr uint32_t kVersion = 1;
+            constexpr uint64_t kAlignment = 64;
+            constexpr const char* kExtension = ".fepak";
+        }
+
+        enum class PackageCompression : uint32_t {
+            None = 0,    // Stored; read zero-copy from the mapping
+            LZ = 1       // LZCodec block, decoded into memory when opened
+        };
+
+        struct PackageArchiveHeader {
+            uint32_t magic;
+            uint32_t version;
+            uint32_t entryCount;
+            uint32_t idCount;
+            uint64_t tocOffset;
+            uint64_t idIndexOffset;
+            uint64_t pathIndexOffset;
+            uint64_t pathsOffset;
+            uint64_t pathsSize;
+            uint64_t fileSize;
+        };
+
+        struct PackageArchiveEntry {
+            uint64_t offset;
+            uint64_t storedSize;      // Bytes in the archive
+            uint64_t size;            // Bytes once decoded
+            uint64_t pathHash;        // PackageArchive::HashPath of the path
+            uint64_t resourceID;      // Resource described by this file, InvalidResourceID for payloads
+            uint32_t pathOffset;      // Into the path pool
+            uint32_t pathLength;
+            uint32_t compression;     // PackageCompression
+            uint32_t reserved[3];
+        };
+
+        static_assert(sizeof(PackageArchiveHeader) % 16 == 0, "PackageArchiveHeader must keep the data aligned");
+        static_assert(sizeof(PackageArchiveEntry) % 16 == 0, "PackageArchiveEntry must keep the indices aligned");
+
+    } // namespace Resources
+} // namespace FirstEngine
@@ -0,0 +1,93 @@
+#pragma once
+
+#include "FirstEngine/Resources/Export.h"
+#include "FirstEngine/Resources/ResourceID.h"
+#include "FirstEngine/Resources/ResourceTypes.h"
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <shared_mutex>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace FirstEngine {
+    namespace Resources {
+
+        // ResourceCache - concurrent ResourceID -> resource map behind ResourceManager
+        // Split into shards by ID, each with its own reader/writer lock: lookups of loaded resources only take
+        // a shared lock on one shard, so Load/Get from many threads rarely contend.
+        //
+        // Publication protocol:
+        // 1. Claim() inserts the resource before Resource::Load runs; the claiming thread is its loader.
+        // 2. Until Publish(), only the loader sees the entry (it needs it to resolve circular dependencies).
+        //    Other threads calling Acquire() block until the entry is published or abandoned, so a resource is
+        //    never observed half-loaded and two threads never decode the same ID.
+        // 3. Publish() marks the entry loaded and wakes the waiters; Abandon() removes it after a failed load.
+        // Waits that would close a cycle between loader threads (X waits on Y's loader, which waits on X) return
+        // the unpublished resource instead, as a circular dependency on one thread does.
+        class FE_RESOURCES_API ResourceCache {
+        public:
+            static constexpr uint32_t kShardCount = 32;
+
+            ResourceCache() = default;
+            ResourceCache(const ResourceCache&) = delete;
+            ResourceCache& operator=(const ResourceCache&) = delete;
+
+            // Published resource (or one the calling thread is loading); no reference is taken
+            ResourceHandle Find(ResourceID id) const;
+
+            // Same lookup as Find, never waiting, but optionally taking a reference under the shard lock
+            // Returns false if the ID is not cached or another thread is still loading it
+            bool TryAcquire(ResourceID id, bool addRef, ResourceHandle& outHandle);
+
+            // Look up a resource, waiting for it if another thread is loading it, and optionally take a reference
+            // Returns false if the ID is not cached (including a load that failed while waiting)
+            bool Acquire(ResourceID id, bool addRef, ResourceHandle& outHandle);
+
+            // Insert an unpublished resource owned by the calling thread; false if the ID is already cached
+            bool Claim(ResourceID id, ResourceType type, IResource* resource, ResourceHandle handle);
+            void Publish(ResourceID id);
+            void Abandon(ResourceID id);
+
+            // Drop one reference of a published resource (a resource without references is left alone)
+            // Returns the resource if that was the last one; it is out of the cache and the caller deletes it
+            // evictUnreferenced = false keeps it cached at zero references instead, as a prefetch leaves it
+            IResource* Release(ResourceID id, bool evictUnreferenced = true);
+
+            // Empty the cache and return every resource for deletion
+            std::vector<IResource*> TakeAll();
+
+            size_t GetCount(ResourceType type) const;
+
+        private:
+            struct Entry {
+                IResource* resource = nullptr;
+                ResourceHandle handle;
+                ResourceType type = ResourceType::Unknown;
+                bool published = false;
+                std::thread::id loader;     // Thread running Resource::Load until published
+            };
+
+            // One cache line each so neighbouring shard locks don't false-share
+            struct alignas(64) Shard {
+                mutable std::shared_mutex mutex;
+                std::condition_variable_any publishedCondition;
+                std::unordered_map<ResourceID, Entry> entries;
+            };
+
+            Shard& GetShard(ResourceID id) const;
+            static bool IsVisible(const Entry& entry);
+
+            // Wait-for graph of threads blocked in Acquire; false if waiting on 'loader' would deadlock
+            bool BeginWait(std::thread::id loader);
+            void EndWait();
+
+            mutable Shard m_Shards[kShardCount];
+
+            std::mutex m_WaitMutex;
+            std::unordered_map<std::thread::id, std::thread::id> m_WaitingFor;
+        };
+
+    } // namespace Resources
+} // namespace FirstEngine
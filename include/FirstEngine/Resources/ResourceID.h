@@ -3,6 +3,7 @@
 #include "FirstEngine/Resources/Export.h"
 #include "FirstEngine/Resources/ResourceTypeEnum.h"
 #include <cstdint>
+#include <memory>
 #include <string>
 #include <unordered_map>
 #include <vector>
@@ -14,8 +15,14 @@ namespace FirstEngine {
         using ResourceID = uint64_t;
         constexpr ResourceID InvalidResourceID = 0;
 
+        class CompiledManifest;
+        class MappedFile;
+        struct CompiledManifestResource;
+
         // Resource ID Manager - manages mapping between resource IDs and file paths
         // Handles ID allocation, path resolution, and ID lookup
+        // A compiled manifest is used in place from its mapping; resources registered afterwards are kept in
+        // the maps below, which are only consulted when they are not empty.
 
         class FE_RESOURCES_API ResourceIDManager {
         public:
@@ -25,6 +32,7 @@ namespace FirstEngine {
             // Register a resource with a path and get/assign an ID
             // If the path is already registered, returns the existing ID
             // virtualPath: optional virtual path (logical path), if empty, uses filepath as virtual path
+            // Returns InvalidResourceID if the virtual path is already registered to another resource
 
             ResourceID RegisterResource(const std::string& filepath, ResourceType type, const std::string& virtualPath = "");
 
@@ -66,11 +74,23 @@ namespace FirstEngine {
             ResourceID GenerateID();
 
             // Load resource ID mappings from a manifest file (JSON format)
+            // Loads the compiled manifest next to it instead when that is at least as new
             bool LoadManifest(const std::string& manifestPath);
+            bool LoadManifestFromString(const std::string& content);
 
-            // Save resource ID mappings to a manifest file (JSON format)
+            // Save resource ID mappings to a manifest file (JSON format), and the compiled manifest next to it
+            // Only the JSON decides success; a compiled manifest that fails to write is logged and removed
             bool SaveManifest(const std::string& manifestPath) const;
 
+            // Compiled manifest (.femanifest): sorted IDs, a string pool and perfect hash indices, mapped
+            // and used without parsing
+            bool LoadCompiledManifest(const std::string& compiledPath);
+            bool LoadCompiledManifest(std::shared_ptr<MappedFile> file, const std::string& name);
+            bool SaveCompiledManifest(const std::string& compiledPath) const;
+
+            // resource_manifest.json -> resource_manifest.femanifest
+            static std::string GetCompiledManifestPath(const std::string& manifestPath);
+
             // Clear all registrations
             void Clear();
 
@@ -81,6 +101,9 @@ namespace FirstEngine {
             // Next available ID (auto-increment)
             ResourceID m_NextID;
 
+            // Loaded compiled manifest, if any
+            std::unique_ptr<CompiledManifest> m_Compiled;
+
             // ID -> Path mapping (physical file path)
             std::unordered_map<ResourceID, std::string> m_IDToPath;
 
@@ -98,6 +121,9 @@ namespace FirstEngine {
 
             // Normalize path for consistent lookup
             std::string NormalizePath(const std::string& path) const;
+
+            // Every registration, compiled manifest first
+            void CollectResources(std::vector<CompiledManifestResource>& resources) const;
         };
 
     } // namespace Resources
@@ -11,8 +11,14 @@
 #include "FirstEngine/Resources/Export.h"
 #include "FirstEngine/Resources/ResourceID.h"
 #include "FirstEngine/Resources/ResourceTypes.h" 
+#include "FirstEngine/Resources/ResourceCache.h"
 #include <string>
+#include <atomic>
+#include <condition_variable>
+#include <functional>
 #include <memory>
+#include <mutex>
+#include <shared_mutex>
 #include <vector>
 #include <unordered_map>
 
@@ -20,6 +26,9 @@ namespace FirstEngine {
     namespace Resources {
 
         class ResourceManager;
+        class MappedFile;
+        class PackageArchive;
+        class ResourceXMLParser;
 
         class FE_RESOURCES_API IResourceProvider {
         public:
@@ -39,6 +48,42 @@ namespace FirstEngine {
             virtual void LoadDependencies() = 0;
         };
 
+        // One asynchronous load, shared by ResourceManager, the threads running it and every ResourceFuture
+        struct AsyncResourceLoad {
+            ResourceID id = InvalidResourceID;
+
+            // Written by the worker before the load is queued for publishing, read on the main thread after
+            ResourceHandle handle;
+
+            // Guarded by ResourceManager's async mutex
+            uint32_t requesters = 0;                // LoadAsync callers; each owns one reference once published
+            uint32_t pendingDependencies = 0;       // Dependency loads this one still waits for
+            std::vector<ResourceID> waitingOn;
+            std::vector<std::shared_ptr<AsyncResourceLoad>> dependents;
+            std::vector<std::function<void(ResourceHandle)>> callbacks;
+            bool decoded = false;
+
+            std::atomic<bool> published{false};
+        };
+
+        // ResourceFuture - result of ResourceManager::LoadAsync
+        // Becomes ready on the main thread, when ResourceManager::ProcessAsyncLoads publishes the finished load
+        class FE_RESOURCES_API ResourceFuture {
+        public:
+            ResourceFuture() = default;
+            explicit ResourceFuture(std::shared_ptr<AsyncResourceLoad> load) : m_Load(std::move(load)) {}
+
+            bool IsValid() const { return m_Load != nullptr; }
+            bool IsReady() const { return m_Load && m_Load->published.load(std::memory_order_acquire); }
+            ResourceID GetResourceID() const { return m_Load ? m_Load->id : InvalidResourceID; }
+
+            // Loaded resource; empty until ready, or if the load failed
+            ResourceHandle GetHandle() const { return IsReady() ? m_Load->handle : ResourceHandle(); }
+
+        private:
+            std::shared_ptr<AsyncResourceLoad> m_Load;
+        };
+
         // Resource manager - manages providers and loaded resources with dependency support
         // Singleton pattern - Resource classes access it globally without needing it as a parameter
 
@@ -48,6 +93,7 @@ namespace FirstEngine {
             static ResourceManager& GetInstance();
             static void Initialize();
             static void Shutdown();
+            static bool HasInstance() { return s_Instance != nullptr; }
 
             // Prevent copying
             ResourceManager(const ResourceManager&) = delete;
@@ -66,6 +112,7 @@ namespace FirstEngine {
             ResourceType GetTypeFromID(ResourceID id) const;
             bool IsRegistered(ResourceID id) const;
             bool IsPathRegistered(const std::string& filepath) const;
+            std::vector<ResourceID> GetIDsByType(ResourceType type) const;
             bool LoadManifest(const std::string& manifestPath);
             bool SaveManifest(const std::string& manifestPath) const;
 
@@ -81,20 +128,59 @@ namespace FirstEngine {
             ResourceHandle Get(const std::string& filepath) const;
             ResourceHandle Get(ResourceType type, const std::string& filepath) const;
 
+            // Asynchronous load
+            // The resource descriptor is read on the IO thread, its dependencies are requested in parallel and each
+            // resource is decoded on the worker pool once everything it depends on is in the cache. Concurrent
+            // requests for the same ID share one load. The future (and onLoaded) completes on the main thread in
+            // ProcessAsyncLoads, and the caller owns one reference, exactly as with Load.
+            // Falls back to Load if ThreadManager is not initialized or async loading is disabled.
+            // Resources must be registered (manifest loaded, search paths set) before loads are in flight.
+            ResourceFuture LoadAsync(ResourceID id, std::function<void(ResourceHandle)> onLoaded = nullptr);
+
+            // Load in the background without taking a reference; a later Load(id) picks up the cached resource
+            ResourceFuture Prefetch(ResourceID id);
+
+            // Publish finished asynchronous loads (main thread, once per frame)
+            void ProcessAsyncLoads();
+
+            // Block until a load (or every load in flight) is published; main thread only
+            ResourceHandle Wait(const ResourceFuture& future);
+            void WaitForAsyncLoads();
+
+            uint32_t GetAsyncLoadCount() const;
+
+            void SetAsyncEnabled(bool enabled) { m_AsyncEnabled = enabled; }
+            bool IsAsyncEnabled() const { return m_AsyncEnabled; }
+
             // Detect resource type from file extension
             ResourceType DetectResourceType(const std::string& filepath) const;
 
             // Resolve resource path (handles relative paths and search paths)
             std::string ResolveResourcePath(const std::string& path, const std::string& basePath = "") const;
 
+            // Package archive (.fepak, written by ResourceImport pack)
+            // While one is mounted, files under packageRoot come from the archive: paths resolve against its
+            // table of contents and descriptors and payloads are read from its mapping, so loading a resource
+            // does not touch the file system. Files the archive does not have are still read from disk.
+            // Mount before resources are loaded; the archive is read without locking.
+            bool MountArchive(const std::string& archivePath, const std::string& packageRoot);
+            void UnmountArchive();
+            bool IsArchiveMounted() const { return m_Archive != nullptr; }
+
+            // Contents of a resolved file path, from the mounted archive or mapped from disk; nullptr if missing
+            std::shared_ptr<MappedFile> OpenFile(const std::string& path) const;
+
+            // Parse an XML descriptor through OpenFile
+            bool ParseDescriptor(const std::string& xmlFilePath, ResourceXMLParser& parser) const;
+
             // Clear all resources
             void Clear();
 
             // Get statistics
-            size_t GetLoadedMeshCount() const { return m_LoadedMeshes.size(); }
-            size_t GetLoadedMaterialCount() const { return m_LoadedMaterials.size(); }
-            size_t GetLoadedTextureCount() const { return m_LoadedTextures.size(); }
-            size_t GetLoadedModelCount() const { return m_LoadedModels.size(); }
+            size_t GetLoadedMeshCount() const { return m_Cache.GetCount(ResourceType::Mesh); }
+            size_t GetLoadedMaterialCount() const { return m_Cache.GetCount(ResourceType::Material); }
+            size_t GetLoadedTextureCount() const { return m_Cache.GetCount(ResourceType::Texture); }
+            size_t GetLoadedModelCount() const { return m_Cache.GetCount(ResourceType::Model); }
 
             // Internal helper methods for Resource classes (hide path handling)
             // These methods are used by Resource classes to get path information without exposing path handling
@@ -106,7 +192,31 @@ namespace FirstEngine {
             ResourceManager();
 
             // Internal load method by ID
-            ResourceHandle LoadInternal(ResourceID id);
+            // addRef = false leaves the new resource unowned (asynchronous loads hand out references when published)
+            ResourceHandle LoadInternal(ResourceID id, bool addRef = true);
+
+            // ID of a resolved path, from the path cache or the ID manager
+            ResourceID GetCachedPathID(const std::string& resolvedPath) const;
+
+            // Path relative to the mounted archive's root ("" if the path is outside it)
+            std::string GetArchiveRelativePath(const std::string& path) const;
+
+            // ResolveResourcePath against the mounted archive ("" if the archive does not have the file)
+            std::string ResolveArchivePath(const std::string& path, const std::string& basePath) const;
+
+            // Asynchronous load stages
+            // IO thread: read the descriptor and request its dependencies; worker: decode once they are cached
+            ResourceFuture RequestAsync(ResourceID id, bool takeReference, std::function<void(ResourceHandle)> onLoaded);
+            void StartScan(const std::shared_ptr<AsyncResourceLoad>& load);
+            void ScanDependencies(const std::shared_ptr<AsyncResourceLoad>& load);
+            void StartDecode(const std::shared_ptr<AsyncResourceLoad>& load);
+            void DecodeAsync(const std::shared_ptr<AsyncResourceLoad>& load);
+            void DependencyFinished(const std::shared_ptr<AsyncResourceLoad>& load);
+
+            // m_AsyncMutex must be held
+            void RequestDependencyLocked(const std::shared_ptr<AsyncResourceLoad>& parent, ResourceID id,
+                                         std::vector<std::shared_ptr<AsyncResourceLoad>>& outStarted);
+            bool WaitsOnLocked(ResourceID from, ResourceID target) const;
 
             // Singleton instance
             static std::unique_ptr<ResourceManager> s_Instance;
@@ -114,18 +224,28 @@ namespace FirstEngine {
             // Resource ID Manager
             ResourceIDManager m_IDManager;
 
-            std::unordered_map<ResourceID, IMesh*> m_LoadedMeshes;
-            std::unordered_map<ResourceID, IMaterial*> m_LoadedMaterials;
-            std::unordered_map<ResourceID, ITexture*> m_LoadedTextures;
-            std::unordered_map<ResourceID, IModel*> m_LoadedModels;
+            // Loaded resources of every type; safe to use from any thread
+            ResourceCache m_Cache;
 
             // Legacy path-based cache (for backward compatibility)
             // NOTE: This cache is kept for backward compatibility with path-based API.
             // TODO: Consider removing this in a future version when all code migrates to ResourceID-based API
             std::unordered_map<std::string, ResourceID> m_PathToIDCache;
+            mutable std::shared_mutex m_PathCacheMutex;
 
             // Resource search paths (for resolving relative paths)
             std::vector<std::string> m_SearchPaths;
+
+            // Mounted package archive and the directory it stands in for (absolute, '/' separated, ends with '/')
+            std::unique_ptr<PackageArchive> m_Archive;
+            std::string m_ArchiveRoot;
+
+            // In-flight asynchronous loads and the ones finished but not yet published
+            bool m_AsyncEnabled = true;
+            mutable std::mutex m_AsyncMutex;
+            std::condition_variable m_AsyncCondition;
+            std::unordered_map<ResourceID, std::shared_ptr<AsyncResourceLoad>> m_AsyncLoads;
+            std::vector<std::shared_ptr<AsyncResourceLoad>> m_FinishedLoads;
         };
 
     } // namespace Resources
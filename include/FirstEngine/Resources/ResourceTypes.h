@@ -4,6 +4,7 @@
 #include "FirstEngine/Resources/ResourceID.h"
 #include "FirstEngine/Resources/ResourceTypeEnum.h"
 #include "FirstEngine/Resources/ResourceDependency.h"
+#include <atomic>
 #include <string>
 #include <memory>
 #include <cstdint>
@@ -47,6 +48,24 @@ namespace FirstEngine {
             UnknownError = 4
         };
 
+        // Reference count of a resource
+        // Dependencies are loaded on worker threads (ResourceManager::LoadAsync), so a shared texture can be
+        // referenced from several loads at once. Copying takes a snapshot, which keeps ResourceMetadata copyable.
+        class ResourceRefCount {
+        public:
+            ResourceRefCount(uint32_t value = 0) : m_Value(value) {}
+            ResourceRefCount(const ResourceRefCount& other) : m_Value(other.m_Value.load()) {}
+            ResourceRefCount& operator=(const ResourceRefCount& other) { m_Value.store(other.m_Value.load()); return *this; }
+            ResourceRefCount& operator=(uint32_t value) { m_Value.store(value); return *this; }
+
+            uint32_t operator++(int) { return m_Value.fetch_add(1); }
+            uint32_t operator--(int) { return m_Value.fetch_sub(1); }
+            operator uint32_t() const { return m_Value.load(); }
+
+        private:
+            std::atomic<uint32_t> m_Value;
+        };
+
         // Resource metadata
         // Note: filePath is kept for internal use by ResourceManager only
         // Resource classes should NOT access filePath directly - use resourceID instead
@@ -58,7 +77,7 @@ namespace FirstEngine {
             uint64_t fileSize = 0;
             uint64_t loadTime = 0; // in milliseconds
             bool isLoaded = false;
-            uint32_t refCount = 0;
+            ResourceRefCount refCount = 0;
             
             std::vector<ResourceDependency> dependencies;
         };
@@ -82,6 +101,7 @@ namespace FirstEngine {
             virtual uint32_t GetIndexCount() const = 0;
             virtual const void* GetVertexData() const = 0;
             virtual const void* GetIndexData() const = 0;
+            virtual uint32_t GetIndexSize() const = 0;    // Bytes per index: 2 (uint16_t) or 4 (uint32_t)
             virtual uint32_t GetVertexStride() const = 0;
             virtual bool IsIndexed() const = 0;
         };
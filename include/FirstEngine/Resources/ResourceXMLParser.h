@@ -23,6 +23,8 @@ namespace FirstEngine {
             // Parse XML file and extract resource metadata
             bool ParseFromFile(const std::string& xmlFilePath);
             bool ParseFromString(const std::string& xmlContent);
+            // XML already in memory (a mapped or archived file); sourceName is only used in errors
+            bool ParseFromMemory(const void* data, size_t size, const std::string& sourceName);
 
             // Get metadata from parsed XML
             std::string GetName() const;
@@ -36,6 +38,7 @@ namespace FirstEngine {
             // Texture-specific data
             struct TextureData {
                 std::string imageFile;
+                std::string cookedFile;  // Cooked .fetex loaded at runtime (empty in packages imported before it existed)
                 uint32_t width = 0;
                 uint32_t height = 0;
                 uint32_t channels = 0;
@@ -46,6 +49,7 @@ namespace FirstEngine {
             // Material-specific data
             struct MaterialData {
                 std::string shaderName;
+                std::vector<std::string> keywords; // Shader permutation keywords (<Keywords>ALPHA_TEST SKINNED</Keywords>)
                 std::unordered_map<std::string, MaterialParameterValue> parameters;
                 std::vector<std::pair<std::string, ResourceID>> textureSlots; // slot name -> ResourceID
             };
@@ -54,6 +58,7 @@ namespace FirstEngine {
             // Mesh-specific data
             struct MeshData {
                 std::string meshFile;  // Source mesh file (fbx, obj, etc.) - similar to TextureData::imageFile
+                std::string cookedFile;  // Cooked .femesh loaded at runtime (empty in packages imported before it existed)
                 // Note: vertexStride is no longer stored in XML - it's calculated from mesh file data
             };
             bool GetMeshData(MeshData& outData) const;
@@ -0,0 +1,88 @@
+#pragma once
+
+#include "FirstEngine/Resources/Export.h"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace FirstEngine {
+    namespace Resources {
+
+        // Pixel encoding of a cooked texture (stored in the .fetex header)
+        enum class TextureEncoding : uint32_t {
+            RGBA8 = 0,    // Uncompressed, 4 bytes per texel
+            BC1 = 1,      // RGB + 1-bit alpha, 8 bytes per 4x4 block (8:1)
+            BC3 = 2,      // RGBA, BC1 color + BC4 alpha, 16 bytes per block (4:1)
+            BC5 = 3,      // Two channels (normal map XY), two BC4 blocks, 16 bytes per block (4:1)
+            BC7 = 4,      // RGBA, 16 bytes per block (4:1); the encoder writes mode 6 only
+            Auto = 0xFF   // Import option only: BC1 for opaque images, BC7 when alpha is used
+        };
+
+        enum class MipFilter : uint32_t {
+            Box = 0,      // 2x2 average
+            Kaiser = 1    // Kaiser-windowed sinc, 6 taps per axis; sharper than box without visible ringing
+        };
+
+        // Import-time settings for TextureLoader::Cook
+        struct TextureCookOptions {
+            TextureEncoding encoding = TextureEncoding::Auto;
+            bool srgb = true;                       // Color data: mips are filtered in linear light (ignored for BC5)
+            bool generateMips = true;               // Full chain down to 1x1
+            MipFilter mipFilter = MipFilter::Kaiser;
+            uint32_t threadCount = 0;               // Encoder/filter threads, 0 = every hardware thread
+        };
+
+        // One level of a texture, either owned pixels (cooking) or a view into a mapped .fetex (runtime)
+        struct TextureMip {
+            const uint8_t* data = nullptr;
+            uint64_t size = 0;
+            uint32_t width = 0;
+            uint32_t height = 0;
+        };
+
+        // TextureCompressor - import-time mip generation and block compression
+        // Everything works on RGBA8 and is deterministic for a given thread count. The block kernels fit
+        // endpoints along the principal axis of each block, then pick indices with an SSE2 distance search
+        // (scalar fallback elsewhere); images are split into block rows encoded on all cores.
+        class FE_RESOURCES_API TextureCompressor {
+        public:
+            struct Level {
+                std::vector<uint8_t> data;
+                uint32_t width = 0;
+                uint32_t height = 0;
+            };
+
+            // Expand 1 (gray), 2 (gray + alpha), 3 (RGB) or 4 channel pixels to RGBA8
+            static bool ExpandToRGBA8(const uint8_t* pixels, uint32_t width, uint32_t height, uint32_t channels,
+                                      std::vector<uint8_t>& outRGBA);
+
+            // Auto encoding for an RGBA8 image: BC7 if any texel is not fully opaque, BC1 otherwise
+            static TextureEncoding ChooseEncoding(const uint8_t* rgba, uint32_t width, uint32_t height);
+
+            // Level 0 (a copy of the input) followed by every smaller level down to 1x1
+            // sRGB images are decoded to linear before filtering and re-encoded afterwards; alpha is always linear
+            static void GenerateMips(const uint8_t* rgba, uint32_t width, uint32_t height, bool srgb, MipFilter filter,
+                                     uint32_t threadCount, std::vector<Level>& outLevels);
+
+            // Encode / decode a whole RGBA8 level; partial edge blocks repeat the last row/column
+            // Decode handles exactly what Encode writes (BC7 mode 6) and fails on other BC7 modes
+            static bool Encode(const uint8_t* rgba, uint32_t width, uint32_t height, TextureEncoding encoding,
+                               uint32_t threadCount, std::vector<uint8_t>& outData);
+            static bool Decode(const uint8_t* data, uint32_t width, uint32_t height, TextureEncoding encoding,
+                               std::vector<uint8_t>& outRGBA);
+
+            static uint32_t GetBlockBytes(TextureEncoding encoding);    // 0 for RGBA8
+            static uint64_t GetEncodedSize(uint32_t width, uint32_t height, TextureEncoding encoding);
+            static uint32_t GetMipCount(uint32_t width, uint32_t height);
+            static const char* GetEncodingName(TextureEncoding encoding);
+
+            // Block kernels over 16 RGBA8 texels in row-major order
+            // BC1 switches to 3-color + transparent mode when allowAlpha is set and a texel has alpha < 128
+            static void EncodeBC1Block(const uint8_t* rgba, uint8_t* block, bool allowAlpha);
+            static void EncodeBC3Block(const uint8_t* rgba, uint8_t* block);
+            static void EncodeBC5Block(const uint8_t* rgba, uint8_t* block);
+            static void EncodeBC7Block(const uint8_t* rgba, uint8_t* block);
+        };
+
+    } // namespace Resources
+} // namespace FirstEngine
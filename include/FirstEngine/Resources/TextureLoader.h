@@ -4,6 +4,8 @@
 #include "FirstEngine/Resources/ResourceTypes.h"
 #include "FirstEngine/Resources/ResourceID.h"
 #include "FirstEngine/Resources/ImageLoader.h"
+#include "FirstEngine/Resources/TextureCompressor.h"
+#include "FirstEngine/Resources/MappedFile.h"
 #include <string>
 #include <vector>
 #include <memory>
@@ -16,6 +18,8 @@ namespace FirstEngine {
         struct ResourceMetadata;
 
         // Texture loader - loads texture metadata from XML and image data from image files
+        // Textures imported with a cooked .fetex (see CookedTextureFormat.h) are memory mapped instead: the full
+        // mip chain, already block compressed, is uploaded from the mapping without decoding anything.
         // ResourceManager is used internally for caching, not exposed to Resource classes
         class FE_RESOURCES_API TextureLoader {
         public:
@@ -23,7 +27,15 @@ namespace FirstEngine {
             struct LoadResult {
                 ImageData imageData;           // Handle data (actual image data)
                 ResourceMetadata metadata;     // Metadata (name, ID, dependencies, etc.)
+                std::string cookedFile;        // Cooked .fetex path (for saving)
                 bool success = false;
+
+                // Cooked textures leave imageData.data empty (width/height/channels/hasAlpha are still set)
+                // and point into the mapped file instead; the mapping must outlive whoever holds these pointers
+                std::shared_ptr<MappedFile> mappedFile;
+                TextureEncoding encoding = TextureEncoding::RGBA8;
+                bool srgb = false;
+                std::vector<TextureMip> mips;  // Largest first
             };
 
             // Load texture by ResourceID
@@ -38,7 +50,18 @@ namespace FirstEngine {
                             uint32_t width,
                             uint32_t height,
                             uint32_t channels,
-                            bool hasAlpha);
+                            bool hasAlpha,
+                            const std::string& cookedFile = "");
+
+            // Import-time: load a source image, generate its mip chain, block compress every level and write
+            // a cooked .fetex (printing the encoding and size reduction)
+            static bool Cook(const std::string& sourcePath, const std::string& cookedPath,
+                             const TextureCookOptions& options = TextureCookOptions());
+
+            // Write / map a cooked .fetex; levels hold data already encoded as 'encoding', largest first
+            static bool WriteCooked(const std::string& cookedPath, const std::vector<TextureCompressor::Level>& levels,
+                                    TextureEncoding encoding, bool srgb, uint32_t channels, bool hasAlpha);
+            static bool ReadCooked(const std::string& cookedPath, LoadResult& outResult);
 
             // Check if format is supported
             static bool IsFormatSupported(const std::string& filepath);
@@ -3,8 +3,11 @@
 #include "FirstEngine/Resources/Export.h"
 #include "FirstEngine/Resources/ResourceTypes.h"
 #include "FirstEngine/Resources/ResourceProvider.h"
+#include "FirstEngine/Resources/TextureCompressor.h"
+#include "FirstEngine/Resources/MappedFile.h"
 #include <vector>
 #include <cstdint>
+#include <memory>
 
 // Forward declarations
 namespace FirstEngine {
@@ -40,14 +43,27 @@ namespace FirstEngine {
             // Initialize from image data
             bool Initialize(const std::vector<uint8_t>& data, uint32_t width, uint32_t height, uint32_t channels, bool hasAlpha);
 
+            // Initialize from a cooked .fetex mapping (mips point into mappedFile, largest first)
+            bool InitializeCooked(std::shared_ptr<MappedFile> mappedFile, const std::vector<TextureMip>& mips,
+                                  TextureEncoding encoding, bool srgb, uint32_t channels, bool hasAlpha);
+
             // ITexture interface
+            // Cooked textures return mip 0 in its cooked encoding (see GetEncoding)
             uint32_t GetWidth() const override { return m_Width; }
             uint32_t GetHeight() const override { return m_Height; }
             uint32_t GetChannels() const override { return m_Channels; }
-            const void* GetData() const override { return m_Data.data(); }
-            uint32_t GetDataSize() const override { return static_cast<uint32_t>(m_Data.size()); }
+            const void* GetData() const override { return m_Mips.empty() ? m_Data.data() : m_Mips[0].data; }
+            uint32_t GetDataSize() const override {
+                return static_cast<uint32_t>(m_Mips.empty() ? m_Data.size() : m_Mips[0].size);
+            }
             bool HasAlpha() const override { return m_HasAlpha; }
 
+            // Cooked mip chain (empty for textures loaded from a source image, which hold channel-interleaved
+            // 8-bit pixels in GetData)
+            const std::vector<TextureMip>& GetMips() const { return m_Mips; }
+            TextureEncoding GetEncoding() const { return m_Encoding; }
+            bool IsSRGB() const { return m_SRGB; }
+
             // Save resource to XML file
             bool Save(const std::string& xmlFilePath) const;
 
@@ -66,8 +82,8 @@ namespace FirstEngine {
             // Check if GPU texture is ready for rendering
             bool IsRenderTextureReady() const;
             
-            // Get GPU texture for rendering (does not expose IRenderResource)
-            void* GetRenderTexture() const; // Returns RHI::IImage* cast to void*
+            // Get GPU texture for binding to materials, ready or not (see RenderTexture::IsReady)
+            void* GetRenderTexture() const { return m_RenderTexture; } // Returns Renderer::RenderTexture* cast to void*
             
             // Get render data for creating RenderItem (does not expose RenderTexture)
             struct RenderData {
@@ -82,6 +98,13 @@ namespace FirstEngine {
             uint32_t m_Height = 0;
             uint32_t m_Channels = 0;
             bool m_HasAlpha = false;
+
+            // Cooked texture data (views into the mapping, which stays open while the resource lives)
+            std::shared_ptr<MappedFile> m_MappedFile;
+            std::vector<TextureMip> m_Mips;
+            TextureEncoding m_Encoding = TextureEncoding::RGBA8;
+            bool m_SRGB = false;
+            std::string m_CookedFile;
             
             // GPU render resource (stored in Handle, not Component)
             // Using void* to avoid including Renderer headers (breaks circular dependency)
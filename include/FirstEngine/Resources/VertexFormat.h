@@ -20,12 +20,27 @@ namespace FirstEngine {
             // Add more as needed
         };
 
+        // How an attribute is stored in the vertex buffer
+        // Everything except Float and Octahedral is read by the vertex fetch unit as floats, so shaders declared
+        // with float inputs work unchanged. Octahedral needs the OCTAHEDRAL_NORMALS shader keyword to decode.
+        enum class VertexAttributeEncoding : uint32_t {
+            Float = 0,         // 32-bit floats, sizes as listed on VertexAttributeType
+            Snorm16 = 1,       // Normal/Tangent: snorm16x4 (normal w = 0), 8 bytes
+            Octahedral = 2,    // Normal: octahedral snorm16x2, 4 bytes
+                               // Tangent: same, handedness in the low bit of y, 4 bytes
+            Half = 3,          // TexCoord: float16x2, 4 bytes
+            Unorm16 = 4,       // TexCoord in [0, 1]: unorm16x2, 4 bytes
+                               // Position: unorm16x4 across the mesh bounds (w = 0), 8 bytes
+            Unorm8 = 5,        // Color0: unorm8x4, 4 bytes
+        };
+
         // Vertex attribute description
         struct VertexAttribute {
             VertexAttributeType type;
             uint32_t offset;      // Offset in bytes from vertex start
             uint32_t size;        // Size in bytes
             uint32_t location;    // Shader location (for matching)
+            VertexAttributeEncoding encoding = VertexAttributeEncoding::Float;
         };
 
         // Vertex format descriptor - describes the layout of a vertex
@@ -35,7 +50,9 @@ namespace FirstEngine {
             ~VertexFormat() = default;
 
             // Add an attribute to the format
-            void AddAttribute(VertexAttributeType type, uint32_t location = UINT32_MAX);
+            // Returns false if the encoding can't store this attribute type
+            bool AddAttribute(VertexAttributeType type, uint32_t location = UINT32_MAX,
+                              VertexAttributeEncoding encoding = VertexAttributeEncoding::Float);
 
             // Check if format has a specific attribute
             bool HasAttribute(VertexAttributeType type) const;
@@ -52,6 +69,9 @@ namespace FirstEngine {
             // Get attribute count
             size_t GetAttributeCount() const { return m_Attributes.size(); }
 
+            // True if any attribute is stored in a compressed encoding (see VertexQuantizer)
+            bool IsQuantized() const;
+
             // Check if this format matches shader requirements
             // Returns true if format has all required attributes for the shader
             bool MatchesShaderInputs(const std::vector<VertexAttributeType>& requiredAttributes) const;
@@ -87,8 +107,12 @@ namespace FirstEngine {
         // Helper: Get attribute type name
         FE_RESOURCES_API const char* GetVertexAttributeTypeName(VertexAttributeType type);
 
-        // Helper: Get attribute size in bytes
-        FE_RESOURCES_API uint32_t GetVertexAttributeSize(VertexAttributeType type);
+        // Helper: Get encoding name
+        FE_RESOURCES_API const char* GetVertexAttributeEncodingName(VertexAttributeEncoding encoding);
+
+        // Helper: Get attribute size in bytes (0 if the encoding doesn't apply to the type)
+        FE_RESOURCES_API uint32_t GetVertexAttributeSize(VertexAttributeType type,
+                                                         VertexAttributeEncoding encoding = VertexAttributeEncoding::Float);
 
     } // namespace Resources
 } // namespace FirstEngine
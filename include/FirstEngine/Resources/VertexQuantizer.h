@@ -0,0 +1,54 @@
+#pragma once
+
+#include "FirstEngine/Resources/Export.h"
+#include "FirstEngine/Resources/VertexFormat.h"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include <glm/glm.hpp>
+
+namespace FirstEngine {
+    namespace Resources {
+
+        // VertexQuantizer - import-time re-encoding of float vertex attributes into compact GPU formats
+        // Run by MeshLoader::Cook after MeshOptimizer (which needs float positions). The default options only
+        // pick encodings the vertex fetch unit expands back to floats, so existing shaders read them unchanged;
+        // the pipeline gets the matching formats from VertexShaderMatcher::BuildVertexInputs.
+        class FE_RESOURCES_API VertexQuantizer {
+        public:
+            struct Options {
+                bool compressNormals = true;       // Normal/Tangent -> Snorm16
+                bool octahedralNormals = false;    // Normal/Tangent -> Octahedral (shader needs OCTAHEDRAL_NORMALS)
+                bool compressTexCoords = true;     // TexCoord -> Unorm16 if every UV is in [0, 1], else Half
+                bool compressColors = true;        // Color0 -> Unorm8
+                // Position -> Unorm16 across the mesh bounds; the renderer folds the bounds into the model matrix
+                bool quantizePositions = false;
+            };
+
+            // Pick an encoding per attribute of a float vertex format (same attribute order and locations)
+            static VertexFormat ChooseFormat(const VertexFormat& source, const uint8_t* vertexData,
+                                             uint32_t vertexCount, const Options& options);
+
+            // Re-encode interleaved float vertices laid out as 'source' into the layout of 'target'
+            // boundsMin/boundsMax are the range Unorm16 positions are quantized over
+            static bool Encode(const VertexFormat& source, const uint8_t* vertexData, uint32_t vertexCount,
+                               const VertexFormat& target, const glm::vec3& boundsMin, const glm::vec3& boundsMax,
+                               std::vector<uint8_t>& outVertexData);
+
+            // Scale and offset that turn a Unorm16 position back into object space: p = q * scale + offset
+            static void GetPositionDequantization(const glm::vec3& boundsMin, const glm::vec3& boundsMax,
+                                                  glm::vec3& outScale, glm::vec3& outOffset);
+
+            // Encode kernels over contiguous float arrays (SSE2 where available, scalar otherwise)
+            // Inputs are clamped to the representable range; rounding is to nearest
+            static void EncodeSnorm16(const float* source, int16_t* destination, size_t count);
+            static void EncodeUnorm16(const float* source, uint16_t* destination, size_t count);
+            static void EncodeUnorm8(const float* source, uint8_t* destination, size_t count);
+            static void EncodeHalf(const float* source, uint16_t* destination, size_t count);
+
+            // Octahedral projection of 'count' xyz vectors (any length) onto [-1, 1]^2 xy pairs
+            static void EncodeOctahedral(const float* xyz, float* destinationXY, size_t count);
+        };
+
+    } // namespace Resources
+} // namespace FirstEngine
@@ -3,6 +3,7 @@
 #include "FirstEngine/Resources/Export.h"
 #include "FirstEngine/Resources/VertexFormat.h"
 #include "FirstEngine/Shader/ShaderCompiler.h"
+#include "FirstEngine/RHI/Types.h"
 #include <vector>
 #include <string>
 
@@ -37,6 +38,18 @@ namespace FirstEngine {
             static VertexAttributeType InferAttributeTypeFromShaderResource(
                 const Shader::ShaderResource& resource);
 
+            // Vertex fetch format of an attribute as stored in the vertex buffer (type + encoding)
+            static RHI::Format GetAttributeFormat(const VertexAttribute& attribute);
+
+            // Pipeline vertex inputs that read the shader's stage inputs from a buffer laid out as vertexFormat
+            // (binding 0, stride = vertexFormat.GetStride()). Used instead of the layout derived from shader
+            // reflection when a mesh is stored quantized; the shader keeps its float inputs.
+            // Returns false (with missing attributes in outResult) if the mesh lacks an input the shader reads
+            static bool BuildVertexInputs(const VertexFormat& vertexFormat,
+                                          const Shader::ShaderReflection& shaderReflection,
+                                          std::vector<RHI::VertexInputAttribute>& outAttributes,
+                                          MatchResult* outResult = nullptr);
+
         private:
             // Helper: Check if shader input name matches attribute type
             static bool NameMatchesAttributeType(const std::string& name, VertexAttributeType type);
@@ -0,0 +1,83 @@
+#pragma once
+
+#include "FirstEngine/Shader/Export.h"
+#include "FirstEngine/Core/Hash.h"
+#include "FirstEngine/Shader/ShaderCompiler.h"
+#include "FirstEngine/Shader/ShaderReflectionSerializer.h"
+#include "FirstEngine/Shader/ShaderSourceCompiler.h"
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace FirstEngine {
+    namespace Shader {
+
+        // Cached compile output of one shader stage: SPIR-V + reflection
+        // 'spirv' is the buffer the code was read into; move it on rather than copying it. Reflection stays
+        // in its cooked form: 'reflection' reads records from 'reflectionData', which the entry keeps alive
+        // (copies of the entry share it). Materialize a ShaderReflection only where one is needed.
+        struct ShaderCacheEntry {
+            std::vector<uint32_t> spirv;
+            std::shared_ptr<const std::vector<uint32_t>> reflectionData;
+            ShaderReflectionView reflection;
+            bool hasReflection = false;
+        };
+
+        // ShaderCache - content-addressed on-disk cache of compiled shaders
+        // Key = hash of (preprocessed source, defines, compile options, compiler version); the preprocessed
+        // source already contains every #include, so editing an include invalidates all users of it.
+        // One file per key (<key>.fesc) holds SPIR-V and serialized reflection, so a warm start neither
+        // compiles nor runs SPIRV-Cross. Files are written to a temp name and renamed, so any number of
+        // threads (or processes) can use the same cache directory.
+        class FE_SHADER_API ShaderCache {
+        public:
+            struct Stats {
+                uint64_t hits = 0;          // Loaded from disk
+                uint64_t misses = 0;        // Compiled
+                uint64_t compileErrors = 0; // Compile failed (not cached)
+                uint64_t writeErrors = 0;   // Compiled but could not be written
+            };
+
+            ShaderCache() = default;
+            explicit ShaderCache(const std::string& directory);
+
+            // Cache directory (created on first store); empty = caching disabled, always compile
+            void SetDirectory(const std::string& directory);
+            const std::string& GetDirectory() const { return m_Directory; }
+            bool IsEnabled() const { return !m_Directory.empty(); }
+
+            // Compile a shader file through the cache
+            // Thread-safe; returns false (with error message) if the shader fails to preprocess or compile
+            bool CompileFile(const std::string& filepath, const CompileOptions& options,
+                             ShaderCacheEntry& outEntry, std::string* outError = nullptr);
+
+            // Compile options the engine uses for HLSL stage sources (<Name>.vert.hlsl etc.)
+            // Shared by the runtime and the ShaderManager cook command, so cooked entries are cache hits at runtime
+            static CompileOptions GetEngineCompileOptions(ShaderStage stage,
+                                                          const std::vector<std::pair<std::string, std::string>>& defines = {});
+
+            // Compute the (128-bit) cache key of already preprocessed source
+            static Core::Hash128 ComputeKey(const std::string& preprocessedSource, const CompileOptions& options);
+
+            // Raw cache access
+            bool Load(const Core::Hash128& key, ShaderCacheEntry& outEntry) const;
+            bool Store(const Core::Hash128& key, const ShaderCacheEntry& entry) const;
+
+            Stats GetStats() const;
+            void ResetStats();
+
+        private:
+            std::string GetEntryPath(const Core::Hash128& key) const;
+
+            std::string m_Directory;
+
+            std::atomic<uint64_t> m_Hits{0};
+            std::atomic<uint64_t> m_Misses{0};
+            std::atomic<uint64_t> m_CompileErrors{0};
+            mutable std::atomic<uint64_t> m_WriteErrors{0};
+        };
+
+    } // namespace Shader
+} // namespace FirstEngine
@@ -0,0 +1,90 @@
+#pragma once
+
+#include "FirstEngine/Shader/Export.h"
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <utility>
+
+namespace FirstEngine {
+    namespace Shader {
+
+        // ShaderKeywordSet - a sorted, duplicate-free set of shader keywords (e.g. SKINNED, ALPHA_TEST)
+        // Each keyword becomes a "#define KEYWORD 1" when a shader variant is compiled
+        // Sorted storage makes the set order-independent, so {A, B} and {B, A} select the same variant
+        class FE_SHADER_API ShaderKeywordSet {
+        public:
+            ShaderKeywordSet() = default;
+            ShaderKeywordSet(const std::vector<std::string>& keywords);
+
+            // Add/remove keywords (empty strings are ignored)
+            void Add(const std::string& keyword);
+            void Remove(const std::string& keyword);
+            bool Has(const std::string& keyword) const;
+
+            // Add all keywords from another set
+            void Merge(const ShaderKeywordSet& other);
+
+            // Keep only keywords that are also in 'allowed' (used to drop keywords a shader doesn't declare)
+            ShaderKeywordSet Filtered(const ShaderKeywordSet& allowed) const;
+
+            const std::vector<std::string>& GetKeywords() const { return m_Keywords; }
+            bool IsEmpty() const { return m_Keywords.empty(); }
+            size_t GetCount() const { return m_Keywords.size(); }
+            void Clear() { m_Keywords.clear(); }
+
+            // Convert to CompileOptions::defines ("KEYWORD" = "1")
+            std::vector<std::pair<std::string, std::string>> ToDefines() const;
+
+            // Stable 64-bit hash (Core::Hasher128), identical across runs and platforms
+            // Used as part of the variant cache key and in permutation manifests
+            uint64_t GetHash() const;
+
+            // Space separated keyword list (e.g. "ALPHA_TEST SKINNED")
+            std::string ToString() const;
+            static ShaderKeywordSet FromString(const std::string& str);
+
+            bool operator==(const ShaderKeywordSet& other) const { return m_Keywords == other.m_Keywords; }
+            bool operator!=(const ShaderKeywordSet& other) const { return m_Keywords != other.m_Keywords; }
+
+        private:
+            std::vector<std::string> m_Keywords;
+        };
+
+        // Parse the keywords a shader source declares
+        // Shaders list the keywords they react to in a comment line:
+        //     // @keywords SKINNED ALPHA_TEST NO_NORMAL_MAP
+        // Keywords that a shader does not declare are dropped from variant requests,
+        // so unrelated material/pass keywords never create duplicate variants
+        FE_SHADER_API ShaderKeywordSet ParseDeclaredKeywords(const std::string& sourceCode);
+
+        // ShaderPermutationManifest - list of (shader name, keyword set) permutations used by a package
+        // Generated at package build time (ShaderManager "permutations" command) from materials and passes;
+        // only listed permutations are precompiled, every other permutation is stripped
+        // File format: one permutation per line, "ShaderName: KEYWORD_A KEYWORD_B" ('#' starts a comment)
+        class FE_SHADER_API ShaderPermutationManifest {
+        public:
+            struct Entry {
+                std::string shaderName;
+                ShaderKeywordSet keywords;
+            };
+
+            // Add a permutation (duplicates are ignored)
+            void Add(const std::string& shaderName, const ShaderKeywordSet& keywords);
+
+            // Check if a permutation is listed
+            bool Contains(const std::string& shaderName, const ShaderKeywordSet& keywords) const;
+
+            const std::vector<Entry>& GetEntries() const { return m_Entries; }
+            bool IsEmpty() const { return m_Entries.empty(); }
+            void Clear() { m_Entries.clear(); }
+
+            bool LoadFromFile(const std::string& filepath);
+            bool SaveToFile(const std::string& filepath) const;
+
+        private:
+            std::vector<Entry> m_Entries;
+        };
+
+    } // namespace Shader
+} // namespace FirstEngine
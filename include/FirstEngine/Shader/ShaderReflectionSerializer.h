@@ -0,0 +1,108 @@
+#pragma once
+
+#include "FirstEngine/Shader/Export.h"
+#include "FirstEngine/Shader/ShaderCompiler.h"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace FirstEngine {
+    namespace Shader {
+
+        // ShaderReflectionView - zero-copy view over a cooked reflection blob
+        // The blob is a flat image: header, fixed-size record tables and a string table, all 4-byte aligned.
+        // Open() validates every offset once; after that the accessors read straight from the buffer
+        // (no allocation, no parsing), so a blob can be used directly from a loaded or mapped file.
+        // The buffer must stay alive (and unchanged) while the view is used.
+        class FE_SHADER_API ShaderReflectionView {
+        public:
+            // Record types as stored in the blob (names are offsets into the string table)
+            struct Resource {
+                uint32_t name;
+                uint32_t id;
+                uint32_t type_id;
+                uint32_t base_type_id;
+                uint32_t set;
+                uint32_t binding;
+                uint32_t size;
+                uint32_t offset;
+                uint32_t location;
+                uint32_t component;
+                uint32_t basetype;
+                uint32_t width;
+                uint32_t vecsize;
+                uint32_t columns;
+                uint32_t arrayFirst;    // Index into the array size table
+                uint32_t arrayCount;
+            };
+
+            struct UniformBuffer {
+                uint32_t name;
+                uint32_t id;
+                uint32_t set;
+                uint32_t binding;
+                uint32_t size;
+                uint32_t memberFirst;   // Index into the member table
+                uint32_t memberCount;
+            };
+
+            // Resource lists of ShaderReflection, in declaration order
+            enum class ResourceList : uint32_t {
+                Samplers,
+                Images,
+                StorageBuffers,
+                StageInputs,
+                StageOutputs,
+                SampledImages,
+                SeparateImages,
+                SeparateSamplers,
+                Count
+            };
+
+            ShaderReflectionView() = default;
+
+            // Validate and attach to a blob written by ShaderReflectionSerializer::Serialize
+            // Returns false if the data is truncated, corrupt, misaligned or from another format version
+            bool Open(const void* data, size_t size);
+            bool IsValid() const { return m_Data != nullptr; }
+
+            ShaderLanguage GetLanguage() const;
+            const char* GetEntryPoint() const;
+            uint32_t GetPushConstantSize() const;
+
+            uint32_t GetUniformBufferCount() const;
+            const UniformBuffer& GetUniformBuffer(uint32_t index) const;
+            const Resource& GetMember(const UniformBuffer& buffer, uint32_t index) const;
+
+            uint32_t GetResourceCount(ResourceList list) const;
+            const Resource& GetResource(ResourceList list, uint32_t index) const;
+
+            const char* GetString(uint32_t offset) const;
+            const uint32_t* GetArraySizes(const Resource& resource) const;
+
+            // Materialize a full ShaderReflection (allocates; for code that needs the classic structure)
+            void ToReflection(ShaderReflection& out) const;
+
+        private:
+            const uint8_t* m_Data = nullptr;
+            size_t m_Size = 0;
+        };
+
+        // Binary serialization of ShaderReflection
+        // Lets reflection be stored next to SPIR-V (shader cache) so SPIRV-Cross doesn't have to run again on load
+        // The format is native little-endian and versioned; data written by another version fails to load
+        class FE_SHADER_API ShaderReflectionSerializer {
+        public:
+            // Format version (bump when ShaderReflection/ShaderResource/UniformBuffer or the blob layout change)
+            static constexpr uint32_t kVersion = 2;
+
+            // Append serialized reflection to 'out'
+            static void Serialize(const ShaderReflection& reflection, std::vector<uint8_t>& out);
+
+            // Read reflection from a buffer written by Serialize (any alignment)
+            // Returns false if the data is truncated, corrupt or from another format version
+            static bool Deserialize(const uint8_t* data, size_t size, ShaderReflection& out);
+        };
+
+    } // namespace Shader
+} // namespace FirstEngine
@@ -71,6 +71,14 @@ namespace FirstEngine {
             // Auto-detect language from file extension and compile
             CompileResult CompileFromFileAuto(const std::string& filepath, const CompileOptions& options = CompileOptions());
             
+            // Run only the preprocessor (expands #include and defines, strips comments)
+            // Used to key the shader cache: edits that don't change the preprocessed source don't invalidate it
+            bool Preprocess(const std::string& source_code, const CompileOptions& options,
+                            std::string& out_preprocessed, std::string* out_error = nullptr);
+            
+            // Compiler identification (part of the shader cache key, so a compiler upgrade invalidates the cache)
+            static std::string GetCompilerVersion();
+            
             // Save compiled SPIR-V to file
             static bool SaveSPIRV(const std::vector<uint32_t>& spirv, const std::string& output_filepath);
             
@@ -13,6 +13,9 @@ namespace FirstEngine {
             Compile,
             Convert,
             Reflect,
+            Permutations,
+            Cook,
+            BenchHash,
             Help,
             Unknown
         };
@@ -51,6 +54,24 @@ namespace FirstEngine {
             bool show_storage_buffers = true;
         };
         
+        struct PermutationOptions {
+            std::string shader_directory;             // Directory with <Name>.vert.hlsl / <Name>.frag.hlsl
+            std::string material_directory;           // Directory with material XML files
+            std::string output_file;                  // Default: <shader_directory>/ShaderPermutations.txt
+            std::vector<std::string> pass_keywords;   // Keyword set of each render pass (e.g. "DEPTH_ONLY")
+        };
+        
+        struct CookOptions {
+            std::string shader_directory;             // Directory with <Name>.vert.hlsl / <Name>.frag.hlsl
+            std::string cache_directory;              // Default: <shader_directory>/Cache (what the engine reads)
+            std::string manifest_file;                // Default: <shader_directory>/ShaderPermutations.txt (if present)
+        };
+        
+        struct BenchHashOptions {
+            std::vector<std::string> inputs;          // SPIR-V files (.spv), cache entries (.fesc) or directories of them
+            int iterations = 200;                     // Passes over the whole input set per hash function
+        };
+        
         class ShaderManager {
         public:
             ShaderManager();
@@ -70,11 +91,17 @@ namespace FirstEngine {
             CompileOptions m_CompileOptions;
             ConvertOptions m_ConvertOptions;
             ReflectOptions m_ReflectOptions;
+            PermutationOptions m_PermutationOptions;
+            CookOptions m_CookOptions;
+            BenchHashOptions m_BenchHashOptions;
             
             // Command execution
             int ExecuteCompile();
             int ExecuteConvert();
             int ExecuteReflect();
+            int ExecutePermutations();
+            int ExecuteCook();
+            int ExecuteBenchHash();
             
             // Helper functions
             FirstEngine::Shader::ShaderStage ParseStage(const std::string& stage_str);
@@ -31,6 +31,8 @@ namespace FirstEngine {
         private:
             enum class Command {
                 Import,
+                Pack,
+                BenchCache,
                 Help,
                 Unknown
             };
@@ -51,10 +53,33 @@ namespace FirstEngine {
                 std::string name;
                 bool overwrite = false;
                 bool update_manifest = true;
+                bool optimize_mesh = true;
+                bool quantize_mesh = true;
+                bool quantize_positions = false;
+                bool octahedral_normals = false;
+                uint32_t mesh_lods = 4;    // Simplified LOD levels below LOD 0
+                std::string texture_format = "auto";    // auto, rgba8, bc1, bc3, bc5, bc7
+                bool texture_srgb = true;
+                bool texture_mips = true;
+                std::string mip_filter = "kaiser";       // box, kaiser
+            };
+
+            struct PackOptions {
+                std::string package_dir = "build/Package";
+                std::string output_file;    // Default: <package_dir>.fepak
+                bool compress = true;
+            };
+
+            struct BenchCacheOptions {
+                std::string package_dir = "build/Package";
+                uint32_t threads = 16;
+                double seconds = 3.0;
             };
 
             Command m_Command;
             ImportOptions m_Options;
+            PackOptions m_PackOptions;
+            BenchCacheOptions m_BenchCacheOptions;
 
             // Helper methods
             void PrintHelp() const;
@@ -69,6 +94,12 @@ namespace FirstEngine {
             bool ImportModel(const std::string& inputPath, const ImportOptions& options);
             bool ImportMaterial(const std::string& inputPath, const ImportOptions& options);
 
+            // Pack a package directory into a single .fepak archive
+            int ExecutePack();
+
+            // ResourceManager cache stress benchmark (Load/Get/Unload from many threads)
+            int ExecuteBenchCache();
+
             // Resource ID management
 
             bool LoadManifest(const std::string& manifestPath);
@@ -1,6 +1,8 @@
 #include "FirstEngine/Core/ThreadManager.h"
 #include <stdexcept>
 #include <iostream>
+#include <algorithm>
+#include <thread>
 
 namespace FirstEngine {
     namespace Core {
@@ -15,12 +17,23 @@ namespace FirstEngine {
         }
 
         void ThreadManager::Initialize() {
+            if (!s_Instance) {
+                s_Instance = new ThreadManager();
+            }
+            s_Instance->CreateEngineThreads();
+        }
+
+        void ThreadManager::InitializeWorkerPool() {
             if (s_Instance) {
                 return; // Already initialized
             }
             s_Instance = new ThreadManager();
         }
 
+        bool ThreadManager::IsInitialized() {
+            return s_Instance != nullptr;
+        }
+
         void ThreadManager::Shutdown() {
             if (s_Instance) {
                 s_Instance->ShutdownAll();
@@ -30,21 +43,37 @@ namespace FirstEngine {
         }
 
         ThreadManager::ThreadManager() : m_Initialized(false) {
-            // Create default engine threads
-            CreateThread(ThreadType::Device, "DeviceThread", ThreadPriority::High);
-            CreateThread(ThreadType::Game, "GameThread", ThreadPriority::Normal);
-            CreateThread(ThreadType::IO, "IOThread", ThreadPriority::Low);
-            CreateThread(ThreadType::Python, "PythonThread", ThreadPriority::Normal);
-            CreateThread(ThreadType::Render, "RenderThread", ThreadPriority::Critical);
-
-            // Start all threads
-            for (auto& pair : m_Threads) {
-                pair.second->Start();
+            // Create generic worker pool
+            CreateWorkerThreads(0);
+            for (auto& worker : m_WorkerThreads) {
+                worker->Start();
             }
 
             m_Initialized = true;
         }
 
+        void ThreadManager::CreateEngineThreads() {
+            struct EngineThread {
+                ThreadType type;
+                const char* name;
+                ThreadPriority priority;
+            };
+            static const EngineThread engineThreads[] = {
+                { ThreadType::Device, "DeviceThread", ThreadPriority::High },
+                { ThreadType::Game, "GameThread", ThreadPriority::Normal },
+                { ThreadType::IO, "IOThread", ThreadPriority::Low },
+                { ThreadType::Python, "PythonThread", ThreadPriority::Normal },
+                { ThreadType::Render, "RenderThread", ThreadPriority::Critical },
+            };
+
+            for (const EngineThread& engineThread : engineThreads) {
+                if (GetThread(engineThread.type)) {
+                    continue;
+                }
+                CreateThread(engineThread.type, engineThread.name, engineThread.priority)->Start();
+            }
+        }
+
         ThreadManager::~ThreadManager() {
             ShutdownAll();
         }
@@ -67,6 +96,49 @@ namespace FirstEngine {
             return threadPtr;
         }
 
+        void ThreadManager::CreateWorkerThreads(size_t count) {
+            if (count == 0) {
+                // Leave room for the dedicated engine threads, but always keep at least one worker
+                size_t hardwareThreads = std::thread::hardware_concurrency();
+                count = hardwareThreads > 4 ? hardwareThreads - 4 : 1;
+            }
+
+            std::lock_guard<std::mutex> lock(m_Mutex);
+            for (size_t i = 0; i < count; ++i) {
+                std::string name = "WorkerThread" + std::to_string(m_WorkerThreads.size());
+                auto worker = std::make_unique<Thread>(ThreadType::Worker, name, ThreadPriority::Normal);
+                m_ThreadsByName[name] = worker.get();
+                m_WorkerThreads.push_back(std::move(worker));
+            }
+        }
+
+        Thread* ThreadManager::GetLeastBusyWorker() const {
+            std::lock_guard<std::mutex> lock(m_Mutex);
+            Thread* best = nullptr;
+            size_t bestPending = 0;
+            for (const auto& worker : m_WorkerThreads) {
+                size_t pending = worker->GetPendingTaskCount();
+                if (!best || pending < bestPending) {
+                    best = worker.get();
+                    bestPending = pending;
+                }
+            }
+            return best;
+        }
+
+        Future<void> ThreadManager::InvokeOnWorker(std::function<void()> task, TaskPriority priority) {
+            Thread* worker = GetLeastBusyWorker();
+            if (!worker) {
+                throw std::runtime_error("No worker threads available");
+            }
+            return worker->Invoke(task, priority);
+        }
+
+        size_t ThreadManager::GetWorkerCount() const {
+            std::lock_guard<std::mutex> lock(m_Mutex);
+            return m_WorkerThreads.size();
+        }
+
         Thread* ThreadManager::GetThread(ThreadType type) {
             std::lock_guard<std::mutex> lock(m_Mutex);
             auto it = m_Threads.find(type);
@@ -92,6 +164,9 @@ namespace FirstEngine {
             for (auto& pair : m_Threads) {
                 pair.second->WaitForAllTasks();
             }
+            for (auto& worker : m_WorkerThreads) {
+                worker->WaitForAllTasks();
+            }
         }
 
         void ThreadManager::WaitForThread(ThreadType type) {
@@ -110,10 +185,17 @@ namespace FirstEngine {
             for (auto& pair : m_Threads) {
                 pair.second->Stop();
             }
+            for (auto& worker : m_WorkerThreads) {
+                worker->Stop();
+            }
             for (auto& pair : m_Threads) {
                 pair.second->Join();
             }
+            for (auto& worker : m_WorkerThreads) {
+                worker->Join();
+            }
             m_Threads.clear();
+            m_WorkerThreads.clear();
             m_ThreadsByName.clear();
             m_Initialized = false;
         }
@@ -121,7 +203,7 @@ namespace FirstEngine {
         std::vector<ThreadManager::ThreadStats> ThreadManager::GetThreadStats() const {
             std::lock_guard<std::mutex> lock(m_Mutex);
             std::vector<ThreadStats> stats;
-            stats.reserve(m_Threads.size());
+            stats.reserve(m_Threads.size() + m_WorkerThreads.size());
 
             for (const auto& pair : m_Threads) {
                 ThreadStats stat;
@@ -132,6 +214,15 @@ namespace FirstEngine {
                 stats.push_back(stat);
             }
 
+            for (const auto& worker : m_WorkerThreads) {
+                ThreadStats stat;
+                stat.name = worker->GetName();
+                stat.type = worker->GetType();
+                stat.pendingTasks = worker->GetPendingTaskCount();
+                stat.tasksProcessed = worker->GetProcessedTaskCount();
+                stats.push_back(stat);
+            }
+
             return stats;
         }
 
@@ -1,4 +1,5 @@
 #include "FirstEngine/Device/DeviceContext.h"
+#include "FirstEngine/Device/MemoryManager.h"
 
 namespace FirstEngine {
     namespace Device {
@@ -11,10 +12,12 @@ namespace FirstEngine {
               m_GraphicsQueue(graphicsQueue), m_PresentQueue(presentQueue),
               m_CommandPool(commandPool), m_GraphicsQueueFamily(graphicsQueueFamily),
               m_PresentQueueFamily(presentQueueFamily) {
+            m_MemoryManager = std::make_unique<MemoryManager>(this);
         }
 
         DeviceContext::~DeviceContext() {
-            // DeviceContext不拥有这些资源，只是引用
+            // DeviceContext不拥有这些资源，只是引用（内存管理器除外，它在设备销毁前释放所有内存块）
+            m_MemoryManager.reset();
         }
 
     } // namespace Device
@@ -0,0 +1,698 @@
+#include "FirstEngine/Device/GpuAllocator.h"
+#include <algorithm>
+#include <iostream>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+namespace FirstEngine {
+    namespace Device {
+
+        namespace {
+
+            uint32_t HighestBit(uint64_t value) {
+#if defined(_MSC_VER)
+                unsigned long index;
+                _BitScanReverse64(&index, value);
+                return static_cast<uint32_t>(index);
+#else
+                return 63u - static_cast<uint32_t>(__builtin_clzll(value));
+#endif
+            }
+
+            uint32_t LowestBit(uint64_t value) {
+#if defined(_MSC_VER)
+                unsigned long index;
+                _BitScanForward64(&index, value);
+                return static_cast<uint32_t>(index);
+#else
+                return static_cast<uint32_t>(__builtin_ctzll(value));
+#endif
+            }
+
+            uint64_t AlignUp(uint64_t value, uint64_t alignment) {
+                return (value + alignment - 1) & ~(alignment - 1);
+            }
+
+        } // namespace
+
+        // ========== TlsfAllocator ==========
+
+        TlsfAllocator::TlsfAllocator(uint64_t size) : m_Size(size) {
+            for (auto& row : m_FreeHeads) {
+                for (uint32_t& head : row) {
+                    head = kInvalidNode;
+                }
+            }
+            uint32_t node = NewNode();
+            m_Nodes[node].offset = 0;
+            m_Nodes[node].size = size;
+            InsertFree(node);
+        }
+
+        void TlsfAllocator::Mapping(uint64_t size, uint32_t& firstLevel, uint32_t& secondLevel) {
+            if (size < (1ull << kSmallRangeBits)) {
+                firstLevel = 0;
+                secondLevel = static_cast<uint32_t>(size >> (kSmallRangeBits - kSecondLevelBits));
+            } else {
+                uint32_t bit = HighestBit(size);
+                firstLevel = bit - kSmallRangeBits + 1;
+                secondLevel = static_cast<uint32_t>(size >> (bit - kSecondLevelBits)) & (kSecondLevelCount - 1);
+            }
+        }
+
+        uint32_t TlsfAllocator::FindFree(uint64_t size) const {
+            // Round up to the next class boundary, so every range in the class found is large enough
+            if (size < (1ull << kSmallRangeBits)) {
+                size += (1ull << (kSmallRangeBits - kSecondLevelBits)) - 1;
+            } else {
+                size += (1ull << (HighestBit(size) - kSecondLevelBits)) - 1;
+            }
+
+            uint32_t firstLevel;
+            uint32_t secondLevel;
+            Mapping(size, firstLevel, secondLevel);
+            if (firstLevel >= kFirstLevelCount) {
+                return kInvalidNode;
+            }
+
+            uint32_t secondMap = m_SecondLevelBitmap[firstLevel] & (~0u << secondLevel);
+            if (secondMap == 0) {
+                uint64_t firstMap = firstLevel + 1 < 64 ? (m_FirstLevelBitmap & (~0ull << (firstLevel + 1))) : 0;
+                if (firstMap == 0) {
+                    return kInvalidNode;
+                }
+                firstLevel = LowestBit(firstMap);
+                secondMap = m_SecondLevelBitmap[firstLevel];
+            }
+            return m_FreeHeads[firstLevel][LowestBit(secondMap)];
+        }
+
+        uint32_t TlsfAllocator::FindFit(uint64_t size, uint64_t alignment) const {
+            // The classes FindFree rounds past: from the one 'size' falls in up to the one of the worst case
+            // with padding. Their ranges may or may not fit, so each is checked
+            uint32_t firstLevel;
+            uint32_t secondLevel;
+            uint32_t lastFirstLevel;
+            uint32_t lastSecondLevel;
+            Mapping(size, firstLevel, secondLevel);
+            Mapping(size + alignment - 1, lastFirstLevel, lastSecondLevel);
+            lastFirstLevel = std::min(lastFirstLevel, kFirstLevelCount - 1);
+
+            for (uint32_t fl = firstLevel; fl <= lastFirstLevel; ++fl) {
+                if ((m_FirstLevelBitmap & (1ull << fl)) == 0) {
+                    continue;
+                }
+                uint32_t firstSecond = fl == firstLevel ? secondLevel : 0;
+                uint32_t lastSecond = fl == lastFirstLevel ? lastSecondLevel : kSecondLevelCount - 1;
+                for (uint32_t sl = firstSecond; sl <= lastSecond; ++sl) {
+                    if ((m_SecondLevelBitmap[fl] & (1u << sl)) == 0) {
+                        continue;
+                    }
+                    for (uint32_t node = m_FreeHeads[fl][sl]; node != kInvalidNode; node = m_Nodes[node].nextFree) {
+                        const Node& entry = m_Nodes[node];
+                        if (AlignUp(entry.offset, alignment) - entry.offset + size <= entry.size) {
+                            return node;
+                        }
+                    }
+                }
+            }
+            return kInvalidNode;
+        }
+
+        void TlsfAllocator::InsertFree(uint32_t node) {
+            uint32_t firstLevel;
+            uint32_t secondLevel;
+            Mapping(m_Nodes[node].size, firstLevel, secondLevel);
+
+            Node& entry = m_Nodes[node];
+            entry.free = true;
+            entry.prevFree = kInvalidNode;
+            entry.nextFree = m_FreeHeads[firstLevel][secondLevel];
+            if (entry.nextFree != kInvalidNode) {
+                m_Nodes[entry.nextFree].prevFree = node;
+            }
+            m_FreeHeads[firstLevel][secondLevel] = node;
+            m_FirstLevelBitmap |= 1ull << firstLevel;
+            m_SecondLevelBitmap[firstLevel] |= 1u << secondLevel;
+        }
+
+        void TlsfAllocator::RemoveFree(uint32_t node) {
+            uint32_t firstLevel;
+            uint32_t secondLevel;
+            Mapping(m_Nodes[node].size, firstLevel, secondLevel);
+
+            Node& entry = m_Nodes[node];
+            if (entry.prevFree != kInvalidNode) {
+                m_Nodes[entry.prevFree].nextFree = entry.nextFree;
+            } else {
+                m_FreeHeads[firstLevel][secondLevel] = entry.nextFree;
+                if (entry.nextFree == kInvalidNode) {
+                    m_SecondLevelBitmap[firstLevel] &= ~(1u << secondLevel);
+                    if (m_SecondLevelBitmap[firstLevel] == 0) {
+                        m_FirstLevelBitmap &= ~(1ull << firstLevel);
+                    }
+                }
+            }
+            if (entry.nextFree != kInvalidNode) {
+                m_Nodes[entry.nextFree].prevFree = entry.prevFree;
+            }
+            entry.free = false;
+            entry.prevFree = kInvalidNode;
+            entry.nextFree = kInvalidNode;
+        }
+
+        uint32_t TlsfAllocator::NewNode() {
+            if (!m_UnusedNodes.empty()) {
+                uint32_t node = m_UnusedNodes.back();
+                m_UnusedNodes.pop_back();
+                m_Nodes[node] = Node();
+                return node;
+            }
+            m_Nodes.emplace_back();
+            return static_cast<uint32_t>(m_Nodes.size() - 1);
+        }
+
+        void TlsfAllocator::ReleaseNode(uint32_t node) {
+            m_UnusedNodes.push_back(node);
+        }
+
+        void TlsfAllocator::SplitFront(uint32_t node, uint64_t size) {
+            uint32_t rest = NewNode();
+            // NewNode may reallocate m_Nodes, so index afresh
+            Node& entry = m_Nodes[node];
+            Node& remainder = m_Nodes[rest];
+            remainder.offset = entry.offset + size;
+            remainder.size = entry.size - size;
+            remainder.prevPhysical = node;
+            remainder.nextPhysical = entry.nextPhysical;
+            if (entry.nextPhysical != kInvalidNode) {
+                m_Nodes[entry.nextPhysical].prevPhysical = rest;
+            }
+            entry.nextPhysical = rest;
+            entry.size = size;
+            InsertFree(rest);
+        }
+
+        uint32_t TlsfAllocator::Allocate(uint64_t size, uint64_t alignment, uint64_t& outOffset) {
+            if (size == 0) {
+                size = 1;
+            }
+            if (alignment == 0) {
+                alignment = 1;
+            }
+
+            // Worst-case padding is included in the search, so the first range found always fits; failing that,
+            // the ranges of the classes it skipped are checked for an exact fit
+            uint32_t node = FindFree(size + alignment - 1);
+            if (node == kInvalidNode) {
+                node = FindFit(size, alignment);
+            }
+            if (node == kInvalidNode) {
+                return kInvalidNode;
+            }
+            RemoveFree(node);
+
+            // Front padding: a free range of its own if it's worth tracking, otherwise part of the allocation
+            uint64_t padding = AlignUp(m_Nodes[node].offset, alignment) - m_Nodes[node].offset;
+            if (padding >= kMinFreeRange) {
+                SplitFront(node, padding);
+                uint32_t padNode = node;
+                node = m_Nodes[padNode].nextPhysical;
+                RemoveFree(node);
+                InsertFree(padNode);
+                padding = 0;
+            }
+
+            // Tail: back to the free lists unless it's too small to be useful
+            uint64_t needed = padding + size;
+            if (m_Nodes[node].size - needed >= kMinFreeRange) {
+                SplitFront(node, needed);
+            }
+
+            m_ConsumedBytes += m_Nodes[node].size;
+            m_AllocationCount++;
+            outOffset = m_Nodes[node].offset + padding;
+            return node;
+        }
+
+        void TlsfAllocator::Free(uint32_t node) {
+            if (node >= m_Nodes.size() || m_Nodes[node].free) {
+                return;
+            }
+            m_ConsumedBytes -= m_Nodes[node].size;
+            m_AllocationCount--;
+
+            // Coalesce with free neighbours (free ranges are never adjacent to each other)
+            uint32_t prev = m_Nodes[node].prevPhysical;
+            if (prev != kInvalidNode && m_Nodes[prev].free) {
+                RemoveFree(prev);
+                m_Nodes[prev].size += m_Nodes[node].size;
+                m_Nodes[prev].nextPhysical = m_Nodes[node].nextPhysical;
+                if (m_Nodes[node].nextPhysical != kInvalidNode) {
+                    m_Nodes[m_Nodes[node].nextPhysical].prevPhysical = prev;
+                }
+                ReleaseNode(node);
+                node = prev;
+            }
+
+            uint32_t next = m_Nodes[node].nextPhysical;
+            if (next != kInvalidNode && m_Nodes[next].free) {
+                RemoveFree(next);
+                m_Nodes[node].size += m_Nodes[next].size;
+                m_Nodes[node].nextPhysical = m_Nodes[next].nextPhysical;
+                if (m_Nodes[next].nextPhysical != kInvalidNode) {
+                    m_Nodes[m_Nodes[next].nextPhysical].prevPhysical = node;
+                }
+                ReleaseNode(next);
+            }
+
+            InsertFree(node);
+        }
+
+        uint64_t TlsfAllocator::GetLargestFreeRange() const {
+            if (m_FirstLevelBitmap == 0) {
+                return 0;
+            }
+            // The largest ranges sit in the highest class; scan only that list
+            uint32_t firstLevel = HighestBit(m_FirstLevelBitmap);
+            uint32_t secondLevel = HighestBit(m_SecondLevelBitmap[firstLevel]);
+            uint64_t largest = 0;
+            for (uint32_t node = m_FreeHeads[firstLevel][secondLevel]; node != kInvalidNode; node = m_Nodes[node].nextFree) {
+                largest = std::max(largest, m_Nodes[node].size);
+            }
+            return largest;
+        }
+
+        void TlsfAllocator::ForEachAllocation(const std::function<void(uint32_t, uint64_t, uint64_t)>& callback) const {
+            // Node 0 is the first range created and never released (it is always the lowest offset)
+            for (uint32_t node = 0; node != kInvalidNode; node = m_Nodes[node].nextPhysical) {
+                if (!m_Nodes[node].free) {
+                    callback(node, m_Nodes[node].offset, m_Nodes[node].size);
+                }
+            }
+        }
+
+        // ========== GpuMemoryBlock ==========
+
+        // One device memory allocation: a TLSF-managed block, or a single dedicated allocation
+        class GpuMemoryBlock {
+        public:
+            // What each live sub-allocation was asked for (indexed by TLSF node), for stats and defragmentation
+            struct Record {
+                uint64_t offset = 0;
+                uint64_t size = 0;
+                uint64_t alignment = 1;
+                void* userData = nullptr;
+            };
+
+            uint32_t heapIndex = 0;
+            uint32_t memoryTypeIndex = 0;
+            uint64_t memory = 0;
+            uint64_t size = 0;
+            void* mapped = nullptr;
+            uint64_t usedBytes = 0;
+            std::unique_ptr<TlsfAllocator> tlsf;   // nullptr for dedicated allocations
+            std::vector<Record> records;
+
+            bool IsDedicated() const { return tlsf == nullptr; }
+            uint32_t GetAllocationCount() const { return tlsf ? tlsf->GetAllocationCount() : 1; }
+            uint64_t GetConsumedBytes() const { return tlsf ? tlsf->GetConsumedBytes() : size; }
+        };
+
+        // ========== GpuAllocator ==========
+
+        GpuAllocator::GpuAllocator(IGpuMemoryBackend* backend, uint64_t bufferImageGranularity)
+            : m_Backend(backend), m_BufferImageGranularity(std::max<uint64_t>(bufferImageGranularity, 1)) {
+            for (uint64_t& blockSize : m_BlockSizes) {
+                blockSize = kDefaultBlockSize;
+            }
+        }
+
+        GpuAllocator::~GpuAllocator() {
+            uint32_t leaked = 0;
+            for (auto& heap : m_Heaps) {
+                for (auto& block : heap.blocks) {
+                    leaked += block->GetAllocationCount();
+                    if (block->mapped) {
+                        m_Backend->UnmapDeviceMemory(block->memory);
+                    }
+                    m_Backend->FreeDeviceMemory(block->memoryTypeIndex, block->memory);
+                }
+                for (auto& block : heap.dedicated) {
+                    leaked++;
+                    if (block->mapped) {
+                        m_Backend->UnmapDeviceMemory(block->memory);
+                    }
+                    m_Backend->FreeDeviceMemory(block->memoryTypeIndex, block->memory);
+                }
+            }
+            if (leaked > 0) {
+                std::cerr << "GpuAllocator: " << leaked << " allocation(s) still alive at shutdown" << std::endl;
+            }
+        }
+
+        void GpuAllocator::SetBlockSize(uint32_t memoryTypeIndex, uint64_t blockSize) {
+            std::lock_guard<std::mutex> lock(m_Mutex);
+            if (memoryTypeIndex < kMaxMemoryTypes && blockSize > 0) {
+                m_BlockSizes[memoryTypeIndex] = blockSize;
+            }
+        }
+
+        uint64_t GpuAllocator::GetBlockSize(uint32_t memoryTypeIndex) const {
+            std::lock_guard<std::mutex> lock(m_Mutex);
+            return memoryTypeIndex < kMaxMemoryTypes ? m_BlockSizes[memoryTypeIndex] : kDefaultBlockSize;
+        }
+
+        uint32_t GpuAllocator::GetHeapIndex(uint32_t memoryTypeIndex, GpuResourceKind kind) const {
+            // With a granularity of 1 there is nothing to keep apart, so both kinds share a heap
+            uint32_t kindIndex = (m_BufferImageGranularity > 1 && kind == GpuResourceKind::Optimal) ? 1u : 0u;
+            return memoryTypeIndex * 2 + kindIndex;
+        }
+
+        GpuMemoryBlock* GpuAllocator::CreateBlock(uint32_t heapIndex, uint32_t memoryTypeIndex, uint64_t size, bool dedicated) {
+            uint64_t memory = 0;
+            if (!m_Backend->AllocateDeviceMemory(memoryTypeIndex, size, memory)) {
+                return nullptr;
+            }
+
+            auto block = std::make_unique<GpuMemoryBlock>();
+            block->heapIndex = heapIndex;
+            block->memoryTypeIndex = memoryTypeIndex;
+            block->memory = memory;
+            block->size = size;
+            if (!dedicated) {
+                block->tlsf = std::make_unique<TlsfAllocator>(size);
+            }
+
+            GpuMemoryBlock* result = block.get();
+            auto& list = dedicated ? m_Heaps[heapIndex].dedicated : m_Heaps[heapIndex].blocks;
+            list.push_back(std::move(block));
+            return result;
+        }
+
+        void GpuAllocator::DestroyBlock(GpuMemoryBlock* block) {
+            auto& heap = m_Heaps[block->heapIndex];
+            auto& list = block->IsDedicated() ? heap.dedicated : heap.blocks;
+            auto it = std::find_if(list.begin(), list.end(),
+                                   [block](const std::unique_ptr<GpuMemoryBlock>& entry) { return entry.get() == block; });
+            if (it == list.end()) {
+                return;
+            }
+            if (block->mapped) {
+                m_Backend->UnmapDeviceMemory(block->memory);
+            }
+            m_Backend->FreeDeviceMemory(block->memoryTypeIndex, block->memory);
+            list.erase(it);
+        }
+
+        bool GpuAllocator::AllocateFromBlock(GpuMemoryBlock* block, const GpuAllocationRequest& request, GpuAllocation& out) {
+            uint64_t offset = 0;
+            uint32_t node = block->tlsf->Allocate(request.size, request.alignment, offset);
+            if (node == TlsfAllocator::kInvalidNode) {
+                return false;
+            }
+
+            if (block->records.size() <= node) {
+                block->records.resize(node + 1);
+            }
+            GpuMemoryBlock::Record& record = block->records[node];
+            record.offset = offset;
+            record.size = request.size;
+            record.alignment = request.alignment;
+            record.userData = request.userData;
+            block->usedBytes += request.size;
+
+            out.memory = block->memory;
+            out.offset = offset;
+            out.size = request.size;
+            out.memoryTypeIndex = block->memoryTypeIndex;
+            out.userData = request.userData;
+            out.block = block;
+            out.node = node;
+            return true;
+        }
+
+        bool GpuAllocator::Allocate(const GpuAllocationRequest& request, GpuAllocation& outAllocation) {
+            if (request.size == 0 || request.memoryTypeIndex >= kMaxMemoryTypes ||
+                (request.alignment & (request.alignment - 1)) != 0) {
+                return false;
+            }
+
+            std::lock_guard<std::mutex> lock(m_Mutex);
+            uint32_t heapIndex = GetHeapIndex(request.memoryTypeIndex, request.kind);
+            uint64_t maxBlockSize = m_BlockSizes[request.memoryTypeIndex];
+            uint64_t alignment = std::max<uint64_t>(request.alignment, 1);
+
+            // Dedicated: the device memory is the allocation
+            if (request.dedicated || request.size > maxBlockSize / 2) {
+                GpuMemoryBlock* block = CreateBlock(heapIndex, request.memoryTypeIndex, request.size, true);
+                if (!block) {
+                    return false;
+                }
+                block->usedBytes = request.size;
+                block->records.resize(1);
+                block->records[0].size = request.size;
+                block->records[0].alignment = alignment;
+                block->records[0].userData = request.userData;
+
+                outAllocation = GpuAllocation();
+                outAllocation.memory = block->memory;
+                outAllocation.size = request.size;
+                outAllocation.memoryTypeIndex = request.memoryTypeIndex;
+                outAllocation.userData = request.userData;
+                outAllocation.block = block;
+                return true;
+            }
+
+            GpuAllocationRequest aligned = request;
+            aligned.alignment = alignment;
+
+            // Newest blocks first: they are the largest and the most likely to have room
+            auto& blocks = m_Heaps[heapIndex].blocks;
+            for (auto it = blocks.rbegin(); it != blocks.rend(); ++it) {
+                if (AllocateFromBlock(it->get(), aligned, outAllocation)) {
+                    return true;
+                }
+            }
+
+            // New block: start at 1/8 of the maximum and double with each block, so small scenes stay small
+            uint64_t largest = 0;
+            for (const auto& block : blocks) {
+                largest = std::max(largest, block->size);
+            }
+            uint64_t required = request.size + alignment - 1;
+            uint64_t blockSize = std::max<uint64_t>(std::min(maxBlockSize, std::max(maxBlockSize / 8, largest * 2)), 1);
+            while (blockSize < required) {
+                blockSize *= 2;
+            }
+
+            // On failure (out of memory) give back idle blocks first: none of them could take the request, and
+            // the spare each heap keeps holds device memory the new block needs. Then retry with smaller blocks
+            // down to what the request needs
+            GpuMemoryBlock* block = CreateBlock(heapIndex, request.memoryTypeIndex, blockSize, false);
+            if (!block) {
+                ReleaseEmptyBlocksLocked();
+                for (uint64_t size = blockSize; !block; size /= 2) {
+                    if (size < required) {
+                        return false;
+                    }
+                    block = CreateBlock(heapIndex, request.memoryTypeIndex, size, false);
+                }
+            }
+            return AllocateFromBlock(block, aligned, outAllocation);
+        }
+
+        void GpuAllocator::FreeLocked(GpuAllocation& allocation, bool keepEmptyBlock) {
+            GpuMemoryBlock* block = allocation.block;
+            if (!block) {
+                return;
+            }
+
+            if (block->IsDedicated()) {
+                DestroyBlock(block);
+            } else {
+                block->usedBytes -= block->records[allocation.node].size;
+                block->records[allocation.node] = GpuMemoryBlock::Record();
+                block->tlsf->Free(allocation.node);
+
+                // Keep at most one empty block per heap, so alloc/free patterns don't thrash vkAllocateMemory
+                if (block->tlsf->IsEmpty() && !keepEmptyBlock) {
+                    for (const auto& other : m_Heaps[block->heapIndex].blocks) {
+                        if (other.get() != block && other->tlsf->IsEmpty()) {
+                            DestroyBlock(block);
+                            break;
+                        }
+                    }
+                }
+            }
+            allocation = GpuAllocation();
+        }
+
+        void GpuAllocator::Free(GpuAllocation& allocation) {
+            std::lock_guard<std::mutex> lock(m_Mutex);
+            FreeLocked(allocation, false);
+        }
+
+        void* GpuAllocator::Map(const GpuAllocation& allocation) {
+            GpuMemoryBlock* block = allocation.block;
+            if (!block) {
+                return nullptr;
+            }
+
+            std::lock_guard<std::mutex> lock(m_Mutex);
+            if (!block->mapped) {
+                block->mapped = m_Backend->MapDeviceMemory(block->memory);
+                if (!block->mapped) {
+                    return nullptr;
+                }
+            }
+            return static_cast<uint8_t*>(block->mapped) + allocation.offset;
+        }
+
+        uint64_t GpuAllocator::GetMemorySize(const GpuAllocation& allocation) const {
+            // A block's size never changes while allocations live in it
+            return allocation.block ? allocation.block->size : 0;
+        }
+
+        uint64_t GpuAllocator::Defragment(const MoveCallback& move, uint64_t maxBytesToMove) {
+            std::lock_guard<std::mutex> lock(m_Mutex);
+            uint64_t moved = 0;
+
+            for (auto& heap : m_Heaps) {
+                if (heap.blocks.size() < 2) {
+                    continue;
+                }
+
+                // Drain the emptiest blocks into the fullest ones
+                std::vector<GpuMemoryBlock*> blocks;
+                for (const auto& block : heap.blocks) {
+                    blocks.push_back(block.get());
+                }
+                std::sort(blocks.begin(), blocks.end(), [](const GpuMemoryBlock* a, const GpuMemoryBlock* b) {
+                    return a->usedBytes < b->usedBytes;
+                });
+
+                for (size_t source = 0; source + 1 < blocks.size() && moved < maxBytesToMove; ++source) {
+                    GpuMemoryBlock* from = blocks[source];
+
+                    std::vector<uint32_t> nodes;
+                    from->tlsf->ForEachAllocation([&nodes](uint32_t node, uint64_t, uint64_t) {
+                        nodes.push_back(node);
+                    });
+
+                    for (uint32_t node : nodes) {
+                        const GpuMemoryBlock::Record record = from->records[node];
+                        if (moved + record.size > maxBytesToMove) {
+                            break;
+                        }
+
+                        GpuAllocationRequest request;
+                        request.size = record.size;
+                        request.alignment = record.alignment;
+                        request.memoryTypeIndex = from->memoryTypeIndex;
+                        request.userData = record.userData;
+
+                        GpuAllocation target;
+                        bool placed = false;
+                        for (size_t destination = blocks.size() - 1; destination > source && !placed; --destination) {
+                            placed = AllocateFromBlock(blocks[destination], request, target);
+                        }
+                        if (!placed) {
+                            continue;
+                        }
+
+                        GpuAllocation current;
+                        current.memory = from->memory;
+                        current.offset = record.offset;
+                        current.size = record.size;
+                        current.memoryTypeIndex = from->memoryTypeIndex;
+                        current.userData = record.userData;
+                        current.block = from;
+                        current.node = node;
+
+                        if (move(current, target)) {
+                            FreeLocked(current, true);
+                            moved += record.size;
+                        } else {
+                            FreeLocked(target, true);
+                        }
+                    }
+                }
+            }
+
+            // Blocks emptied by the moves go back to the device (keeping one spare per heap)
+            for (auto& heap : m_Heaps) {
+                bool keptOne = false;
+                for (size_t i = heap.blocks.size(); i-- > 0;) {
+                    if (!heap.blocks[i]->tlsf->IsEmpty()) {
+                        continue;
+                    }
+                    if (!keptOne) {
+                        keptOne = true;
+                        continue;
+                    }
+                    DestroyBlock(heap.blocks[i].get());
+                }
+            }
+            return moved;
+        }
+
+        void GpuAllocator::ReleaseEmptyBlocks() {
+            std::lock_guard<std::mutex> lock(m_Mutex);
+            ReleaseEmptyBlocksLocked();
+        }
+
+        void GpuAllocator::ReleaseEmptyBlocksLocked() {
+            for (auto& heap : m_Heaps) {
+                for (size_t i = heap.blocks.size(); i-- > 0;) {
+                    if (heap.blocks[i]->tlsf->IsEmpty()) {
+                        DestroyBlock(heap.blocks[i].get());
+                    }
+                }
+            }
+        }
+
+        std::vector<GpuHeapStats> GpuAllocator::GetStats() const {
+            std::lock_guard<std::mutex> lock(m_Mutex);
+            std::vector<GpuHeapStats> result;
+            for (uint32_t heapIndex = 0; heapIndex < kMaxMemoryTypes * 2; ++heapIndex) {
+                const Heap& heap = m_Heaps[heapIndex];
+                if (heap.blocks.empty() && heap.dedicated.empty()) {
+                    continue;
+                }
+
+                GpuHeapStats stats;
+                stats.memoryTypeIndex = heapIndex / 2;
+                stats.kind = (heapIndex % 2) ? GpuResourceKind::Optimal : GpuResourceKind::Linear;
+                stats.blockCount = static_cast<uint32_t>(heap.blocks.size());
+                stats.dedicatedCount = static_cast<uint32_t>(heap.dedicated.size());
+                for (const auto& list : {&heap.blocks, &heap.dedicated}) {
+                    for (const auto& block : *list) {
+                        stats.allocationCount += block->GetAllocationCount();
+                        stats.bytesAllocated += block->size;
+                        stats.bytesUsed += block->usedBytes;
+                        stats.bytesWasted += block->GetConsumedBytes() - block->usedBytes;
+                    }
+                }
+                result.push_back(stats);
+            }
+            return result;
+        }
+
+        GpuHeapStats GpuAllocator::GetTotalStats() const {
+            GpuHeapStats total;
+            for (const auto& stats : GetStats()) {
+                total.blockCount += stats.blockCount;
+                total.dedicatedCount += stats.dedicatedCount;
+                total.allocationCount += stats.allocationCount;
+                total.bytesAllocated += stats.bytesAllocated;
+                total.bytesUsed += stats.bytesUsed;
+                total.bytesWasted += stats.bytesWasted;
+            }
+            return total;
+        }
+
+    } // namespace Device
+} // namespace FirstEngine
@@ -1,5 +1,6 @@
 #include "FirstEngine/Device/MemoryManager.h"
 #include "FirstEngine/Device/DeviceContext.h"
+#include <algorithm>
 #include <stdexcept>
 #include <cstring>
 #include <iostream>
@@ -7,9 +8,66 @@
 namespace FirstEngine {
     namespace Device {
 
+        namespace {
+
+            // Attachments at least this large get their own VkDeviceMemory: they are few, big, and
+            // recreated on resize, so keeping them out of the blocks avoids fragmenting them
+            constexpr VkDeviceSize kDedicatedAttachmentSize = 4ull * 1024 * 1024;
+
+            // Non-dispatchable handles are pointers on 64-bit and uint64_t on 32-bit targets; both fit in uint64_t
+            uint64_t ToHandle(VkDeviceMemory memory) {
+                return (uint64_t)(memory);
+            }
+
+            VkDeviceMemory ToDeviceMemory(uint64_t handle) {
+                return (VkDeviceMemory)(handle);
+            }
+
+            // GpuAllocator backend on top of vkAllocateMemory
+            class VulkanMemoryBackend : public IGpuMemoryBackend {
+            public:
+                explicit VulkanMemoryBackend(VkDevice device) : m_Device(device) {}
+
+                bool AllocateDeviceMemory(uint32_t memoryTypeIndex, uint64_t size, uint64_t& outMemory) override {
+                    VkMemoryAllocateInfo allocInfo{};
+                    allocInfo.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
+                    allocInfo.allocationSize = size;
+                    allocInfo.memoryTypeIndex = memoryTypeIndex;
+
+                    VkDeviceMemory memory = VK_NULL_HANDLE;
+                    if (vkAllocateMemory(m_Device, &allocInfo, nullptr, &memory) != VK_SUCCESS) {
+                        return false;
+                    }
+                    outMemory = ToHandle(memory);
+                    return true;
+                }
+
+                void FreeDeviceMemory(uint32_t, uint64_t memory) override {
+                    vkFreeMemory(m_Device, ToDeviceMemory(memory), nullptr);
+                }
+
+                void* MapDeviceMemory(uint64_t memory) override {
+                    void* data = nullptr;
+                    if (vkMapMemory(m_Device, ToDeviceMemory(memory), 0, VK_WHOLE_SIZE, 0, &data) != VK_SUCCESS) {
+                        return nullptr;
+                    }
+                    return data;
+                }
+
+                void UnmapDeviceMemory(uint64_t memory) override {
+                    vkUnmapMemory(m_Device, ToDeviceMemory(memory));
+                }
+
+            private:
+                VkDevice m_Device;
+            };
+
+        } // namespace
+
         // Buffer implementation
         Buffer::Buffer(DeviceContext* context) 
-            : m_Context(context), m_Buffer(VK_NULL_HANDLE), m_Size(0), m_MappedData(nullptr), m_MemoryProperties(0) {
+            : m_Context(context), m_Buffer(VK_NULL_HANDLE), m_Size(0), m_MappedData(nullptr), m_HostCoherent(true),
+              m_MemoryProperties(0) {
             m_Allocation.memory = VK_NULL_HANDLE;
             m_Allocation.offset = 0;
             m_Allocation.size = 0;
@@ -36,7 +94,7 @@ namespace FirstEngine {
             VkMemoryRequirements memRequirements;
             vkGetBufferMemoryRequirements(m_Context->GetDevice(), m_Buffer, &memRequirements);
 
-            MemoryManager memoryManager(m_Context);
+            MemoryManager& memoryManager = *m_Context->GetMemoryManager();
             if (!memoryManager.AllocateMemory(memRequirements, properties, m_Allocation)) {
                 vkDestroyBuffer(m_Context->GetDevice(), m_Buffer, nullptr);
                 m_Buffer = VK_NULL_HANDLE;
@@ -53,63 +111,101 @@ namespace FirstEngine {
                 return false;
             }
 
+            // Host-visible buffers (uniform, dynamic, staging) are mapped once here and written directly
+            // from then on, instead of a map/unmap pair per update
+            if (properties & VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT) {
+                m_MappedData = memoryManager.MapMemory(m_Allocation);
+                if (!m_MappedData) {
+                    std::cerr << "Error: Buffer::Create(): Failed to map host-visible memory" << std::endl;
+                    Destroy();
+                    return false;
+                }
+                m_HostCoherent = memoryManager.IsHostCoherent(m_Allocation);
+            }
+
             return true;
         }
 
-        void Buffer::Destroy() {
-            if (m_MappedData) {
-                Unmap();
+        bool Buffer::CreatePlaced(VkDeviceSize size, VkBufferUsageFlags usage, VkDeviceMemory memory, VkDeviceSize offset) {
+            m_Size = size;
+
+            VkBufferCreateInfo bufferInfo{};
+            bufferInfo.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
+            bufferInfo.size = size;
+            bufferInfo.usage = usage;
+            bufferInfo.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+
+            if (vkCreateBuffer(m_Context->GetDevice(), &bufferInfo, nullptr, &m_Buffer) != VK_SUCCESS) {
+                return false;
             }
 
+            // m_Allocation stays empty: the memory belongs to the heap, not to this buffer
+            if (vkBindBufferMemory(m_Context->GetDevice(), m_Buffer, memory, offset) != VK_SUCCESS) {
+                vkDestroyBuffer(m_Context->GetDevice(), m_Buffer, nullptr);
+                m_Buffer = VK_NULL_HANDLE;
+                return false;
+            }
+
+            return true;
+        }
+
+        void Buffer::Destroy() {
+            // The block mapping belongs to the allocator; just drop the pointer
+            m_MappedData = nullptr;
+
             if (m_Buffer != VK_NULL_HANDLE) {
                 vkDestroyBuffer(m_Context->GetDevice(), m_Buffer, nullptr);
                 m_Buffer = VK_NULL_HANDLE;
             }
 
             if (m_Allocation.memory != VK_NULL_HANDLE) {
-                MemoryManager memoryManager(m_Context);
-                memoryManager.FreeMemory(m_Allocation);
-                m_Allocation.memory = VK_NULL_HANDLE;
+                m_Context->GetMemoryManager()->FreeMemory(m_Allocation);
             }
         }
 
         void* Buffer::Map(VkDeviceSize offset, VkDeviceSize size) {
-            if (m_MappedData) {
-                return m_MappedData;
-            }
-
-            // Check if memory has HOST_VISIBLE property before mapping
-            if (!(m_MemoryProperties & VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT)) {
+            (void)size;
+            if (!m_MappedData) {
+                // Only host-visible buffers are mapped (in Create)
                 std::cerr << "Error: Buffer::Map(): Attempting to map memory without VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT. "
                           << "Memory has properties: " << std::hex << m_MemoryProperties << std::dec << std::endl;
                 return nullptr;
             }
-
-            if (size == VK_WHOLE_SIZE) {
-                size = m_Size - offset;
-            }
-
-            if (vkMapMemory(m_Context->GetDevice(), m_Allocation.memory, 
-                           m_Allocation.offset + offset, size, 0, &m_MappedData) != VK_SUCCESS) {
-                return nullptr;
-            }
-
-            return m_MappedData;
+            return static_cast<uint8_t*>(m_MappedData) + offset;
         }
 
         void Buffer::Unmap() {
-            if (m_MappedData) {
-                vkUnmapMemory(m_Context->GetDevice(), m_Allocation.memory);
-                m_MappedData = nullptr;
+            // The mapping is persistent; callers that wrote through Map() expect their writes to be visible now
+            Flush(0, VK_WHOLE_SIZE);
+        }
+
+        void Buffer::Flush(VkDeviceSize offset, VkDeviceSize size) {
+            if (!m_MappedData || m_HostCoherent || offset >= m_Size) {
+                return;
+            }
+            if (size == VK_WHOLE_SIZE || offset + size > m_Size) {
+                size = m_Size - offset;
             }
+            m_Context->GetMemoryManager()->FlushMemory(m_Allocation, offset, size);
         }
 
         void Buffer::UpdateData(const void* data, VkDeviceSize size, VkDeviceSize offset) {
-            void* mapped = Map(offset, size);
-            if (mapped) {
-                memcpy(mapped, data, size);
-                Unmap();
+            if (!data || size == 0) {
+                return;
             }
+            if (!m_MappedData) {
+                std::cerr << "Error: Buffer::UpdateData(): Buffer is not host visible "
+                          << "(memory properties 0x" << std::hex << m_MemoryProperties << std::dec << ")" << std::endl;
+                return;
+            }
+            if (offset + size > m_Size) {
+                std::cerr << "Error: Buffer::UpdateData(): Write of " << size << " bytes at offset " << offset
+                          << " exceeds buffer size " << m_Size << std::endl;
+                return;
+            }
+
+            memcpy(static_cast<uint8_t*>(m_MappedData) + offset, data, size);
+            Flush(offset, size);
         }
 
         // Image implementation
@@ -126,10 +222,9 @@ namespace FirstEngine {
             Destroy();
         }
 
-        bool Image::Create(uint32_t width, uint32_t height, uint32_t mipLevels,
-                          VkSampleCountFlagBits numSamples, VkFormat format,
-                          VkImageTiling tiling, VkImageUsageFlags usage,
-                          VkMemoryPropertyFlags properties) {
+        bool Image::CreateHandle(uint32_t width, uint32_t height, uint32_t mipLevels,
+                                 VkSampleCountFlagBits numSamples, VkFormat format,
+                                 VkImageTiling tiling, VkImageUsageFlags usage) {
             m_Width = width;
             m_Height = height;
             m_MipLevels = mipLevels;
@@ -150,15 +245,26 @@ namespace FirstEngine {
             imageInfo.samples = numSamples;
             imageInfo.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
 
-            if (vkCreateImage(m_Context->GetDevice(), &imageInfo, nullptr, &m_Image) != VK_SUCCESS) {
+            return vkCreateImage(m_Context->GetDevice(), &imageInfo, nullptr, &m_Image) == VK_SUCCESS;
+        }
+
+        bool Image::Create(uint32_t width, uint32_t height, uint32_t mipLevels,
+                          VkSampleCountFlagBits numSamples, VkFormat format,
+                          VkImageTiling tiling, VkImageUsageFlags usage,
+                          VkMemoryPropertyFlags properties) {
+            if (!CreateHandle(width, height, mipLevels, numSamples, format, tiling, usage)) {
                 return false;
             }
 
             VkMemoryRequirements memRequirements;
             vkGetImageMemoryRequirements(m_Context->GetDevice(), m_Image, &memRequirements);
 
-            MemoryManager memoryManager(m_Context);
-            if (!memoryManager.AllocateMemory(memRequirements, properties, m_Allocation)) {
+            GpuResourceKind kind = tiling == VK_IMAGE_TILING_OPTIMAL ? GpuResourceKind::Optimal : GpuResourceKind::Linear;
+            bool isAttachment = (usage & (VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT | VK_IMAGE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT)) != 0;
+            bool dedicated = isAttachment && memRequirements.size >= kDedicatedAttachmentSize;
+
+            MemoryManager& memoryManager = *m_Context->GetMemoryManager();
+            if (!memoryManager.AllocateMemory(memRequirements, properties, m_Allocation, kind, dedicated)) {
                 vkDestroyImage(m_Context->GetDevice(), m_Image, nullptr);
                 m_Image = VK_NULL_HANDLE;
                 return false;
@@ -174,6 +280,24 @@ namespace FirstEngine {
             return true;
         }
 
+        bool Image::CreatePlaced(uint32_t width, uint32_t height, uint32_t mipLevels,
+                                 VkSampleCountFlagBits numSamples, VkFormat format,
+                                 VkImageTiling tiling, VkImageUsageFlags usage,
+                                 VkDeviceMemory memory, VkDeviceSize offset) {
+            if (!CreateHandle(width, height, mipLevels, numSamples, format, tiling, usage)) {
+                return false;
+            }
+
+            // m_Allocation stays empty: the memory belongs to the heap, not to this image
+            if (vkBindImageMemory(m_Context->GetDevice(), m_Image, memory, offset) != VK_SUCCESS) {
+                vkDestroyImage(m_Context->GetDevice(), m_Image, nullptr);
+                m_Image = VK_NULL_HANDLE;
+                return false;
+            }
+
+            return true;
+        }
+
         bool Image::CreateImageView(VkImageViewType viewType, VkFormat format,
                                    VkImageAspectFlags aspectFlags) {
             VkImageViewCreateInfo viewInfo{};
@@ -206,26 +330,40 @@ namespace FirstEngine {
             }
 
             if (m_Allocation.memory != VK_NULL_HANDLE) {
-                MemoryManager memoryManager(m_Context);
-                memoryManager.FreeMemory(m_Allocation);
-                m_Allocation.memory = VK_NULL_HANDLE;
+                m_Context->GetMemoryManager()->FreeMemory(m_Allocation);
             }
         }
 
         // MemoryManager implementation
         MemoryManager::MemoryManager(DeviceContext* context) : m_Context(context) {
+            vkGetPhysicalDeviceMemoryProperties(m_Context->GetPhysicalDevice(), &m_MemoryProperties);
+
+            VkPhysicalDeviceProperties deviceProperties;
+            vkGetPhysicalDeviceProperties(m_Context->GetPhysicalDevice(), &deviceProperties);
+            m_NonCoherentAtomSize = deviceProperties.limits.nonCoherentAtomSize > 0
+                                        ? deviceProperties.limits.nonCoherentAtomSize : 1;
+
+            m_Backend = std::make_unique<VulkanMemoryBackend>(m_Context->GetDevice());
+            m_Allocator = std::make_unique<GpuAllocator>(m_Backend.get(), deviceProperties.limits.bufferImageGranularity);
+
+            // Large heaps get 256 MB blocks; small ones (e.g. the 256 MB host-visible VRAM window) 1/8 of the heap
+            for (uint32_t i = 0; i < m_MemoryProperties.memoryTypeCount && i < GpuAllocator::kMaxMemoryTypes; i++) {
+                VkDeviceSize heapSize = m_MemoryProperties.memoryHeaps[m_MemoryProperties.memoryTypes[i].heapIndex].size;
+                if (heapSize <= 1024ull * 1024 * 1024) {
+                    m_Allocator->SetBlockSize(i, heapSize / 8);
+                }
+            }
         }
 
         MemoryManager::~MemoryManager() {
+            // Destroying the allocator frees every block (and reports leaked allocations)
+            m_Allocator.reset();
         }
 
         uint32_t MemoryManager::FindMemoryType(uint32_t typeFilter, VkMemoryPropertyFlags properties) {
-            VkPhysicalDeviceMemoryProperties memProperties;
-            vkGetPhysicalDeviceMemoryProperties(m_Context->GetPhysicalDevice(), &memProperties);
-
-            for (uint32_t i = 0; i < memProperties.memoryTypeCount; i++) {
+            for (uint32_t i = 0; i < m_MemoryProperties.memoryTypeCount; i++) {
                 if ((typeFilter & (1 << i)) && 
-                    (memProperties.memoryTypes[i].propertyFlags & properties) == properties) {
+                    (m_MemoryProperties.memoryTypes[i].propertyFlags & properties) == properties) {
                     return i;
                 }
             }
@@ -234,28 +372,83 @@ namespace FirstEngine {
         }
 
         bool MemoryManager::AllocateMemory(VkMemoryRequirements requirements, VkMemoryPropertyFlags properties,
-                                          MemoryAllocation& allocation) {
+                                          MemoryAllocation& allocation, GpuResourceKind kind, bool dedicated) {
             uint32_t memoryTypeIndex = FindMemoryType(requirements.memoryTypeBits, properties);
 
-            VkMemoryAllocateInfo allocInfo{};
-            allocInfo.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
-            allocInfo.allocationSize = requirements.size;
-            allocInfo.memoryTypeIndex = memoryTypeIndex;
+            GpuAllocationRequest request;
+            request.size = requirements.size;
+            request.alignment = requirements.alignment;
+            request.memoryTypeIndex = memoryTypeIndex;
+
+            // Flushes of non-coherent memory are widened to whole atoms; atom-aligned allocations keep a flush
+            // from spilling into a neighbour's bytes
+            VkMemoryPropertyFlags typeFlags = m_MemoryProperties.memoryTypes[memoryTypeIndex].propertyFlags;
+            if ((typeFlags & VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT) && !(typeFlags & VK_MEMORY_PROPERTY_HOST_COHERENT_BIT)) {
+                request.alignment = std::max<uint64_t>(request.alignment, m_NonCoherentAtomSize);
+                request.size = (request.size + m_NonCoherentAtomSize - 1) / m_NonCoherentAtomSize * m_NonCoherentAtomSize;
+            }
+            request.kind = kind;
+            request.dedicated = dedicated;
 
-            if (vkAllocateMemory(m_Context->GetDevice(), &allocInfo, nullptr, &allocation.memory) != VK_SUCCESS) {
+            if (!m_Allocator->Allocate(request, allocation.gpuAllocation)) {
                 return false;
             }
 
-            allocation.offset = 0;
+            allocation.memory = ToDeviceMemory(allocation.gpuAllocation.memory);
+            allocation.offset = allocation.gpuAllocation.offset;
             allocation.size = requirements.size;
             allocation.memoryTypeIndex = memoryTypeIndex;
 
             return true;
         }
 
-        void MemoryManager::FreeMemory(const MemoryAllocation& allocation) {
+        void MemoryManager::FreeMemory(MemoryAllocation& allocation) {
             if (allocation.memory != VK_NULL_HANDLE) {
-                vkFreeMemory(m_Context->GetDevice(), allocation.memory, nullptr);
+                m_Allocator->Free(allocation.gpuAllocation);
+                allocation.memory = VK_NULL_HANDLE;
+                allocation.offset = 0;
+                allocation.size = 0;
+            }
+        }
+
+        void* MemoryManager::MapMemory(const MemoryAllocation& allocation) {
+            return m_Allocator->Map(allocation.gpuAllocation);
+        }
+
+        bool MemoryManager::IsHostCoherent(const MemoryAllocation& allocation) const {
+            return (m_MemoryProperties.memoryTypes[allocation.memoryTypeIndex].propertyFlags &
+                    VK_MEMORY_PROPERTY_HOST_COHERENT_BIT) != 0;
+        }
+
+        void MemoryManager::FlushMemory(const MemoryAllocation& allocation, VkDeviceSize offset, VkDeviceSize size) {
+            if (allocation.memory == VK_NULL_HANDLE || size == 0 || IsHostCoherent(allocation)) {
+                return;
+            }
+
+            VkDeviceSize begin = allocation.offset + offset;
+            VkDeviceSize end = begin + size;
+            begin = begin / m_NonCoherentAtomSize * m_NonCoherentAtomSize;
+            end = (end + m_NonCoherentAtomSize - 1) / m_NonCoherentAtomSize * m_NonCoherentAtomSize;
+
+            VkMappedMemoryRange range{};
+            range.sType = VK_STRUCTURE_TYPE_MAPPED_MEMORY_RANGE;
+            range.memory = allocation.memory;
+            range.offset = begin;
+            // A range may only run past an atom boundary at the very end of the memory object
+            range.size = end >= m_Allocator->GetMemorySize(allocation.gpuAllocation) ? VK_WHOLE_SIZE : end - begin;
+            vkFlushMappedMemoryRanges(m_Context->GetDevice(), 1, &range);
+        }
+
+        void MemoryManager::PrintStats() const {
+            for (const auto& heap : m_Allocator->GetStats()) {
+                VkMemoryPropertyFlags flags = m_MemoryProperties.memoryTypes[heap.memoryTypeIndex].propertyFlags;
+                std::cout << "Memory type " << heap.memoryTypeIndex << " (flags 0x" << std::hex << flags << std::dec << ")"
+                          << (heap.kind == GpuResourceKind::Optimal ? " images" : "")
+                          << ": " << heap.blockCount << " blocks, " << heap.dedicatedCount << " dedicated, "
+                          << heap.allocationCount << " allocations, "
+                          << heap.bytesAllocated / 1024 << " KB allocated, "
+                          << heap.bytesUsed / 1024 << " KB used, "
+                          << heap.bytesWasted / 1024 << " KB wasted" << std::endl;
             }
         }
 
@@ -279,5 +472,36 @@ namespace FirstEngine {
             return image;
         }
 
+        VkMemoryRequirements MemoryManager::GetBufferMemoryRequirements(VkDeviceSize size, VkBufferUsageFlags usage) {
+            VkMemoryRequirements requirements{};
+
+            VkBufferCreateInfo bufferInfo{};
+            bufferInfo.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
+            bufferInfo.size = size;
+            bufferInfo.usage = usage;
+            bufferInfo.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+
+            VkBuffer buffer = VK_NULL_HANDLE;
+            if (vkCreateBuffer(m_Context->GetDevice(), &bufferInfo, nullptr, &buffer) != VK_SUCCESS) {
+                return requirements;
+            }
+            vkGetBufferMemoryRequirements(m_Context->GetDevice(), buffer, &requirements);
+            vkDestroyBuffer(m_Context->GetDevice(), buffer, nullptr);
+            return requirements;
+        }
+
+        VkMemoryRequirements MemoryManager::GetImageMemoryRequirements(uint32_t width, uint32_t height, uint32_t mipLevels,
+                                                                       VkSampleCountFlagBits numSamples, VkFormat format,
+                                                                       VkImageTiling tiling, VkImageUsageFlags usage) {
+            VkMemoryRequirements requirements{};
+
+            // An unbound image is enough to query; it never gets memory
+            Image image(m_Context);
+            if (image.CreateHandle(width, height, mipLevels, numSamples, format, tiling, usage)) {
+                vkGetImageMemoryRequirements(m_Context->GetDevice(), image.GetImage(), &requirements);
+            }
+            return requirements;
+        }
+
     } // namespace Device
 } // namespace FirstEngine
@@ -27,7 +27,7 @@ namespace FirstEngine {
             m_ColorFormat = colorFormat;
             m_DepthFormat = depthFormat;
 
-            MemoryManager memoryManager(m_Context);
+            MemoryManager& memoryManager = *m_Context->GetMemoryManager();
 
             // 创建颜色附件
             auto colorImage = memoryManager.CreateImage(
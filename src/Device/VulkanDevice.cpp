@@ -32,6 +32,48 @@
 namespace FirstEngine {
     namespace Device {
 
+        namespace {
+            bool IsDepthFormat(RHI::Format format) {
+                return format == RHI::Format::D32_SFLOAT || format == RHI::Format::D24_UNORM_S8_UINT;
+            }
+
+            // For depth formats, ensure usage flags don't include COLOR_ATTACHMENT_BIT
+            // and do include DEPTH_STENCIL_ATTACHMENT_BIT
+            RHI::ImageUsageFlags CorrectImageUsage(const RHI::ImageDescription& desc) {
+                RHI::ImageUsageFlags correctedUsage = desc.usage;
+                if (IsDepthFormat(desc.format)) {
+                    // Remove COLOR_ATTACHMENT_BIT if present (depth formats can't be color attachments)
+                    correctedUsage = static_cast<RHI::ImageUsageFlags>(
+                        static_cast<uint32_t>(correctedUsage) & ~static_cast<uint32_t>(RHI::ImageUsageFlags::ColorAttachment)
+                    );
+                    // Ensure DEPTH_STENCIL_ATTACHMENT_BIT is set
+                    correctedUsage = static_cast<RHI::ImageUsageFlags>(
+                        static_cast<uint32_t>(correctedUsage) | static_cast<uint32_t>(RHI::ImageUsageFlags::DepthStencilAttachment)
+                    );
+                }
+                return correctedUsage;
+            }
+
+            // Determine aspect flags based on format, not just usage
+            // Depth formats must use VK_IMAGE_ASPECT_DEPTH_BIT
+            VkImageAspectFlags GetImageAspectFlags(const RHI::ImageDescription& desc) {
+                if (IsDepthFormat(desc.format)) {
+                    if (desc.format == RHI::Format::D24_UNORM_S8_UINT) {
+                        // Depth-stencil format needs both aspects
+                        return VK_IMAGE_ASPECT_DEPTH_BIT | VK_IMAGE_ASPECT_STENCIL_BIT;
+                    }
+                    // Depth-only format (D32_SFLOAT)
+                    return VK_IMAGE_ASPECT_DEPTH_BIT;
+                }
+                if (static_cast<uint32_t>(desc.usage) & static_cast<uint32_t>(RHI::ImageUsageFlags::DepthStencilAttachment)) {
+                    // Fallback: if usage indicates depth but format doesn't match known depth formats,
+                    // still use depth aspect (might be a custom depth format)
+                    return VK_IMAGE_ASPECT_DEPTH_BIT;
+                }
+                return VK_IMAGE_ASPECT_COLOR_BIT;
+            }
+        }
+
         VulkanDevice::VulkanDevice() : m_DefaultSampler(VK_NULL_HANDLE) {
         }
 
@@ -64,6 +106,7 @@ namespace FirstEngine {
             m_DeviceInfo.driverVersion = 0;
             m_DeviceInfo.deviceMemory = 0; // Can be obtained from physical device
             m_DeviceInfo.hostMemory = 0;
+            m_DeviceInfo.textureCompressionBC = m_Renderer->IsTextureCompressionBCSupported();
 
             return true;
         }
@@ -77,6 +120,7 @@ namespace FirstEngine {
                     m_DefaultSampler = VK_NULL_HANDLE;
                 }
             }
+            DestroyThreadCommandPools();
             m_Renderer.reset();
             m_Window.reset();
         }
@@ -93,6 +137,58 @@ namespace FirstEngine {
             }
         }
 
+        std::unique_ptr<RHI::ICommandBuffer> VulkanDevice::CreateSecondaryCommandBuffer() {
+            auto* context = m_Renderer ? m_Renderer->GetDeviceContext() : nullptr;
+            if (!context) {
+                return nullptr;
+            }
+            VkCommandPool commandPool = GetThreadCommandPool();
+            if (commandPool == VK_NULL_HANDLE) {
+                return nullptr;
+            }
+            try {
+                return std::make_unique<VulkanCommandBuffer>(const_cast<DeviceContext*>(context), commandPool,
+                                                             VK_COMMAND_BUFFER_LEVEL_SECONDARY);
+            } catch (...) {
+                return nullptr;
+            }
+        }
+
+        VkCommandPool VulkanDevice::GetThreadCommandPool() {
+            auto* context = m_Renderer->GetDeviceContext();
+
+            std::lock_guard<std::mutex> lock(m_ThreadCommandPoolsMutex);
+            auto it = m_ThreadCommandPools.find(std::this_thread::get_id());
+            if (it != m_ThreadCommandPools.end()) {
+                return it->second;
+            }
+
+            VkCommandPoolCreateInfo poolInfo{};
+            poolInfo.sType = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO;
+            poolInfo.flags = VK_COMMAND_POOL_CREATE_TRANSIENT_BIT;
+            poolInfo.queueFamilyIndex = context->GetGraphicsQueueFamily();
+
+            VkCommandPool commandPool = VK_NULL_HANDLE;
+            if (vkCreateCommandPool(context->GetDevice(), &poolInfo, nullptr, &commandPool) != VK_SUCCESS) {
+                std::cerr << "VulkanDevice: Failed to create per-thread command pool" << std::endl;
+                return VK_NULL_HANDLE;
+            }
+            m_ThreadCommandPools.emplace(std::this_thread::get_id(), commandPool);
+            return commandPool;
+        }
+
+        void VulkanDevice::DestroyThreadCommandPools() {
+            std::lock_guard<std::mutex> lock(m_ThreadCommandPoolsMutex);
+            auto* context = m_Renderer ? m_Renderer->GetDeviceContext() : nullptr;
+            if (context) {
+                // Destroying a pool frees the command buffers still allocated from it
+                for (auto& entry : m_ThreadCommandPools) {
+                    vkDestroyCommandPool(context->GetDevice(), entry.second, nullptr);
+                }
+            }
+            m_ThreadCommandPools.clear();
+        }
+
         std::unique_ptr<RHI::IRenderPass> VulkanDevice::CreateRenderPass(const RHI::RenderPassDescription& desc) {
             auto* context = m_Renderer->GetDeviceContext();
             if (!context) {
@@ -111,6 +207,7 @@ namespace FirstEngine {
 
             // Convert attachment descriptions
             std::vector<VkAttachmentDescription> attachments;
+            bool sampledAfterPass = false;  // Some attachment ends in SHADER_READ_ONLY_OPTIMAL
             for (uint32_t i = 0; i < colorAttachmentCount; ++i) {
                 const auto& colorAttach = desc.colorAttachments[i];
                 VkAttachmentDescription attachment{};
@@ -121,19 +218,18 @@ namespace FirstEngine {
                 attachment.stencilLoadOp = colorAttach.stencilLoadOpClear ? VK_ATTACHMENT_LOAD_OP_CLEAR : VK_ATTACHMENT_LOAD_OP_LOAD;
                 attachment.stencilStoreOp = colorAttach.stencilStoreOpStore ? VK_ATTACHMENT_STORE_OP_STORE : VK_ATTACHMENT_STORE_OP_DONT_CARE;
                 
-                // initialLayout: If undefined, use UNDEFINED (allowed)
-                VkImageLayout initialLayout = ConvertImageLayout(colorAttach.initialLayout);
-                if (initialLayout == VK_IMAGE_LAYOUT_UNDEFINED && colorAttach.initialLayout != RHI::Format::Undefined) {
-                    initialLayout = VK_IMAGE_LAYOUT_UNDEFINED; // Keep UNDEFINED
-                }
-                attachment.initialLayout = initialLayout;
+                // initialLayout: UNDEFINED is allowed (contents are discarded)
+                attachment.initialLayout = ConvertImageLayout(colorAttach.initialLayout);
                 
                 // finalLayout: Cannot be UNDEFINED, use default COLOR_ATTACHMENT_OPTIMAL
                 VkImageLayout finalLayout = ConvertImageLayout(colorAttach.finalLayout);
-                if (finalLayout == VK_IMAGE_LAYOUT_UNDEFINED || colorAttach.finalLayout == RHI::Format::Undefined) {
+                if (finalLayout == VK_IMAGE_LAYOUT_UNDEFINED) {
                     finalLayout = VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL;
                 }
                 attachment.finalLayout = finalLayout;
+                if (finalLayout == VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL) {
+                    sampledAfterPass = true;
+                }
                 
                 attachments.push_back(attachment);
             }
@@ -147,19 +243,18 @@ namespace FirstEngine {
                 depthAttachment.stencilLoadOp = desc.depthAttachment.stencilLoadOpClear ? VK_ATTACHMENT_LOAD_OP_CLEAR : VK_ATTACHMENT_LOAD_OP_LOAD;
                 depthAttachment.stencilStoreOp = desc.depthAttachment.stencilStoreOpStore ? VK_ATTACHMENT_STORE_OP_STORE : VK_ATTACHMENT_STORE_OP_DONT_CARE;
                 
-                // initialLayout: If undefined, use UNDEFINED (allowed)
-                VkImageLayout initialLayout = ConvertImageLayout(desc.depthAttachment.initialLayout);
-                if (initialLayout == VK_IMAGE_LAYOUT_UNDEFINED && desc.depthAttachment.initialLayout != RHI::Format::Undefined) {
-                    initialLayout = VK_IMAGE_LAYOUT_UNDEFINED; // Keep UNDEFINED
-                }
-                depthAttachment.initialLayout = initialLayout;
+                // initialLayout: UNDEFINED is allowed (contents are discarded)
+                depthAttachment.initialLayout = ConvertImageLayout(desc.depthAttachment.initialLayout);
                 
                 // finalLayout: Cannot be UNDEFINED, use default DEPTH_STENCIL_ATTACHMENT_OPTIMAL
                 VkImageLayout finalLayout = ConvertImageLayout(desc.depthAttachment.finalLayout);
-                if (finalLayout == VK_IMAGE_LAYOUT_UNDEFINED || desc.depthAttachment.finalLayout == RHI::Format::Undefined) {
+                if (finalLayout == VK_IMAGE_LAYOUT_UNDEFINED) {
                     finalLayout = VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL;
                 }
                 depthAttachment.finalLayout = finalLayout;
+                if (finalLayout == VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL) {
+                    sampledAfterPass = true;
+                }
                 
                 attachments.push_back(depthAttachment);
             }
@@ -199,6 +294,22 @@ namespace FirstEngine {
             dependency.dstAccessMask = VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT | VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_WRITE_BIT;
             dependency.dependencyFlags = 0;
 
+            // Attachments handed to later passes through finalLayout are sampled next: make the attachment
+            // writes visible to fragment shaders here, so no separate barrier is needed after the pass
+            VkSubpassDependency outgoingDependency{};
+            outgoingDependency.srcSubpass = 0;
+            outgoingDependency.dstSubpass = VK_SUBPASS_EXTERNAL;
+            outgoingDependency.srcStageMask = VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT | VK_PIPELINE_STAGE_LATE_FRAGMENT_TESTS_BIT;
+            outgoingDependency.srcAccessMask = VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT | VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_WRITE_BIT;
+            outgoingDependency.dstStageMask = VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT;
+            outgoingDependency.dstAccessMask = VK_ACCESS_SHADER_READ_BIT;
+            outgoingDependency.dependencyFlags = 0;
+
+            std::vector<VkSubpassDependency> dependencies = {dependency};
+            if (sampledAfterPass) {
+                dependencies.push_back(outgoingDependency);
+            }
+
             // Create render pass
             VkRenderPassCreateInfo renderPassInfo{};
             renderPassInfo.sType = VK_STRUCTURE_TYPE_RENDER_PASS_CREATE_INFO;
@@ -208,8 +319,8 @@ namespace FirstEngine {
             renderPassInfo.pAttachments = attachments.empty() ? nullptr : attachments.data();
             renderPassInfo.subpassCount = 1;
             renderPassInfo.pSubpasses = &subpass;
-            renderPassInfo.dependencyCount = 1;
-            renderPassInfo.pDependencies = &dependency;
+            renderPassInfo.dependencyCount = static_cast<uint32_t>(dependencies.size());
+            renderPassInfo.pDependencies = dependencies.data();
 
             VkRenderPass renderPass = VK_NULL_HANDLE;
             VkResult result = vkCreateRenderPass(context->GetDevice(), &renderPassInfo, nullptr, &renderPass);
@@ -549,7 +660,7 @@ namespace FirstEngine {
                 return nullptr;
             }
 
-            MemoryManager memoryManager(context);
+            MemoryManager& memoryManager = *context->GetMemoryManager();
             auto buffer = memoryManager.CreateBuffer(
                 size,
                 ConvertBufferUsage(usage),
@@ -570,24 +681,9 @@ namespace FirstEngine {
             }
 
             VkFormat vkFormat = ConvertFormat(desc.format);
-            
-            // For depth formats, ensure usage flags don't include COLOR_ATTACHMENT_BIT
-            // and do include DEPTH_STENCIL_ATTACHMENT_BIT
-            RHI::ImageUsageFlags correctedUsage = desc.usage;
-            bool isDepthFormat = (desc.format == RHI::Format::D32_SFLOAT || desc.format == RHI::Format::D24_UNORM_S8_UINT);
-            
-            if (isDepthFormat) {
-                // Remove COLOR_ATTACHMENT_BIT if present (depth formats can't be color attachments)
-                correctedUsage = static_cast<RHI::ImageUsageFlags>(
-                    static_cast<uint32_t>(correctedUsage) & ~static_cast<uint32_t>(RHI::ImageUsageFlags::ColorAttachment)
-                );
-                // Ensure DEPTH_STENCIL_ATTACHMENT_BIT is set
-                correctedUsage = static_cast<RHI::ImageUsageFlags>(
-                    static_cast<uint32_t>(correctedUsage) | static_cast<uint32_t>(RHI::ImageUsageFlags::DepthStencilAttachment)
-                );
-            }
-
-            MemoryManager memoryManager(context);
+            RHI::ImageUsageFlags correctedUsage = CorrectImageUsage(desc);
+
+            MemoryManager& memoryManager = *context->GetMemoryManager();
             auto image = memoryManager.CreateImage(
                 desc.width,
                 desc.height,
@@ -603,32 +699,119 @@ namespace FirstEngine {
                 return nullptr;
             }
 
-            // Determine aspect flags based on format, not just usage
-            // Depth formats must use VK_IMAGE_ASPECT_DEPTH_BIT
-            VkImageAspectFlags aspectFlags = VK_IMAGE_ASPECT_COLOR_BIT;
-            
-            // Check if format is a depth or depth-stencil format
-            if (isDepthFormat) {
-                if (desc.format == RHI::Format::D24_UNORM_S8_UINT) {
-                    // Depth-stencil format needs both aspects
-                    aspectFlags = VK_IMAGE_ASPECT_DEPTH_BIT | VK_IMAGE_ASPECT_STENCIL_BIT;
-                } else {
-                    // Depth-only format (D32_SFLOAT)
-                    aspectFlags = VK_IMAGE_ASPECT_DEPTH_BIT;
-                }
-            } else if (static_cast<uint32_t>(desc.usage) & static_cast<uint32_t>(RHI::ImageUsageFlags::DepthStencilAttachment)) {
-                // Fallback: if usage indicates depth but format doesn't match known depth formats,
-                // still use depth aspect (might be a custom depth format)
-                aspectFlags = VK_IMAGE_ASPECT_DEPTH_BIT;
+            if (!image->CreateImageView(VK_IMAGE_VIEW_TYPE_2D, vkFormat, GetImageAspectFlags(desc))) {
+                return nullptr;
             }
-            
-            if (!image->CreateImageView(VK_IMAGE_VIEW_TYPE_2D, vkFormat, aspectFlags)) {
+
+            return std::make_unique<VulkanImage>(context, image.release());
+        }
+
+        RHI::MemoryRequirements VulkanDevice::GetImageMemoryRequirements(const RHI::ImageDescription& desc) {
+            RHI::MemoryRequirements result;
+            auto* context = m_Renderer->GetDeviceContext();
+            if (!context) {
+                return result;
+            }
+
+            VkMemoryRequirements requirements = context->GetMemoryManager()->GetImageMemoryRequirements(
+                desc.width, desc.height, desc.mipLevels, VK_SAMPLE_COUNT_1_BIT, ConvertFormat(desc.format),
+                VK_IMAGE_TILING_OPTIMAL, ConvertImageUsage(CorrectImageUsage(desc)));
+            result.size = requirements.size;
+            result.alignment = requirements.alignment;
+            result.memoryTypeBits = requirements.memoryTypeBits;
+            return result;
+        }
+
+        RHI::MemoryRequirements VulkanDevice::GetBufferMemoryRequirements(uint64_t size, RHI::BufferUsageFlags usage) {
+            RHI::MemoryRequirements result;
+            auto* context = m_Renderer->GetDeviceContext();
+            if (!context) {
+                return result;
+            }
+
+            VkMemoryRequirements requirements =
+                context->GetMemoryManager()->GetBufferMemoryRequirements(size, ConvertBufferUsage(usage));
+            result.size = requirements.size;
+            result.alignment = requirements.alignment;
+            result.memoryTypeBits = requirements.memoryTypeBits;
+            return result;
+        }
+
+        RHI::MemoryHeapHandle VulkanDevice::CreateMemoryHeap(uint64_t size, uint32_t memoryTypeBits,
+                                                             RHI::MemoryPropertyFlags properties) {
+            auto* context = m_Renderer->GetDeviceContext();
+            if (!context || size == 0 || memoryTypeBits == 0) {
+                return nullptr;
+            }
+
+            VkMemoryRequirements requirements{};
+            requirements.size = size;
+            requirements.alignment = 1;
+            requirements.memoryTypeBits = memoryTypeBits;
+
+            // A heap is its own device memory (never shares a page with other resources); callers keep images
+            // and buffers in separate heaps, so bufferImageGranularity is never an issue inside one either
+            auto* allocation = new MemoryAllocation();
+            if (!context->GetMemoryManager()->AllocateMemory(requirements, ConvertMemoryProperties(properties),
+                                                             *allocation, GpuResourceKind::Optimal, true)) {
+                std::cerr << "VulkanDevice::CreateMemoryHeap: Failed to allocate " << size << " bytes" << std::endl;
+                delete allocation;
+                return nullptr;
+            }
+            return allocation;
+        }
+
+        void VulkanDevice::DestroyMemoryHeap(RHI::MemoryHeapHandle heap) {
+            if (!heap) {
+                return;
+            }
+            auto* allocation = static_cast<MemoryAllocation*>(heap);
+            auto* context = m_Renderer ? m_Renderer->GetDeviceContext() : nullptr;
+            if (context) {
+                context->GetMemoryManager()->FreeMemory(*allocation);
+            }
+            delete allocation;
+        }
+
+        std::unique_ptr<RHI::IImage> VulkanDevice::CreatePlacedImage(const RHI::ImageDescription& desc,
+                                                                    RHI::MemoryHeapHandle heap, uint64_t offset) {
+            auto* context = m_Renderer->GetDeviceContext();
+            if (!context || !heap) {
+                return nullptr;
+            }
+
+            const auto* allocation = static_cast<const MemoryAllocation*>(heap);
+            VkFormat vkFormat = ConvertFormat(desc.format);
+            auto image = std::make_unique<Image>(context);
+            if (!image->CreatePlaced(desc.width, desc.height, desc.mipLevels, VK_SAMPLE_COUNT_1_BIT, vkFormat,
+                                     VK_IMAGE_TILING_OPTIMAL, ConvertImageUsage(CorrectImageUsage(desc)),
+                                     allocation->memory, allocation->offset + offset)) {
+                return nullptr;
+            }
+
+            if (!image->CreateImageView(VK_IMAGE_VIEW_TYPE_2D, vkFormat, GetImageAspectFlags(desc))) {
                 return nullptr;
             }
 
             return std::make_unique<VulkanImage>(context, image.release());
         }
 
+        std::unique_ptr<RHI::IBuffer> VulkanDevice::CreatePlacedBuffer(uint64_t size, RHI::BufferUsageFlags usage,
+                                                                      RHI::MemoryHeapHandle heap, uint64_t offset) {
+            auto* context = m_Renderer->GetDeviceContext();
+            if (!context || !heap) {
+                return nullptr;
+            }
+
+            const auto* allocation = static_cast<const MemoryAllocation*>(heap);
+            auto buffer = std::make_unique<Buffer>(context);
+            if (!buffer->CreatePlaced(size, ConvertBufferUsage(usage), allocation->memory, allocation->offset + offset)) {
+                return nullptr;
+            }
+
+            return std::make_unique<VulkanBuffer>(context, buffer.release());
+        }
+
         std::unique_ptr<RHI::ISwapchain> VulkanDevice::CreateSwapchain(
             void* windowHandle, const RHI::SwapchainDescription& desc) {
             auto* context = m_Renderer->GetDeviceContext();
@@ -905,6 +1088,16 @@ namespace FirstEngine {
             }
         }
 
+        bool VulkanDevice::IsFenceSignaled(RHI::FenceHandle fence) {
+            if (!fence) return true;
+
+            auto* context = m_Renderer->GetDeviceContext();
+            if (!context) {
+                return true;
+            }
+            return vkGetFenceStatus(context->GetDevice(), static_cast<VkFence>(fence)) == VK_SUCCESS;
+        }
+
         RHI::QueueHandle VulkanDevice::GetGraphicsQueue() const {
             if (m_Renderer && m_Renderer->GetDeviceContext()) {
                 return reinterpret_cast<RHI::QueueHandle>(m_Renderer->GetDeviceContext()->GetGraphicsQueue());
@@ -1324,6 +1517,7 @@ namespace FirstEngine {
                     }
                     // For SAMPLER type, imageView should be VK_NULL_HANDLE (it's not used)
                 } else if (vkWrite.descriptorType == VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER ||
+                           vkWrite.descriptorType == VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC ||
                            vkWrite.descriptorType == VK_DESCRIPTOR_TYPE_STORAGE_BUFFER) {
                     if (!vkWrite.pBufferInfo || vkWrite.pBufferInfo[0].buffer == VK_NULL_HANDLE) {
                         std::cerr << "Error: VulkanDevice::UpdateDescriptorSets: Invalid buffer for binding " 
@@ -1369,7 +1563,7 @@ namespace FirstEngine {
             samplerInfo.compareEnable = VK_FALSE;
             samplerInfo.compareOp = VK_COMPARE_OP_ALWAYS;
             samplerInfo.minLod = 0.0f;
-            samplerInfo.maxLod = 0.0f; // Use all mip levels
+            samplerInfo.maxLod = VK_LOD_CLAMP_NONE; // Use all mip levels
             samplerInfo.borderColor = VK_BORDER_COLOR_INT_OPAQUE_BLACK;
             samplerInfo.unnormalizedCoordinates = VK_FALSE;
 
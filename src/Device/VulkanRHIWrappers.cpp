@@ -88,6 +88,15 @@ namespace FirstEngine {
                 // Depth formats
                 case RHI::Format::D32_SFLOAT: return VK_FORMAT_D32_SFLOAT;
                 case RHI::Format::D24_UNORM_S8_UINT: return VK_FORMAT_D24_UNORM_S8_UINT;
+
+                // Block-compressed formats
+                case RHI::Format::BC1_RGBA_UNORM: return VK_FORMAT_BC1_RGBA_UNORM_BLOCK;
+                case RHI::Format::BC1_RGBA_SRGB: return VK_FORMAT_BC1_RGBA_SRGB_BLOCK;
+                case RHI::Format::BC3_UNORM: return VK_FORMAT_BC3_UNORM_BLOCK;
+                case RHI::Format::BC3_SRGB: return VK_FORMAT_BC3_SRGB_BLOCK;
+                case RHI::Format::BC5_UNORM: return VK_FORMAT_BC5_UNORM_BLOCK;
+                case RHI::Format::BC7_UNORM: return VK_FORMAT_BC7_UNORM_BLOCK;
+                case RHI::Format::BC7_SRGB: return VK_FORMAT_BC7_SRGB_BLOCK;
                 
                 default: return VK_FORMAT_UNDEFINED;
             }
@@ -186,15 +195,81 @@ namespace FirstEngine {
             }
         }
 
-        VkImageLayout ConvertImageLayout(RHI::Format format) {
-            // Temporary implementation: infer layout from format
-            // TODO: Create dedicated Layout enum and use it instead of Format enum
-            // This is a design issue - Format and Layout are different concepts
-            if (format == RHI::Format::Undefined) {
-                return VK_IMAGE_LAYOUT_UNDEFINED;
+        VkImageLayout ConvertImageLayout(RHI::ImageLayout layout) {
+            switch (layout) {
+                case RHI::ImageLayout::Undefined: return VK_IMAGE_LAYOUT_UNDEFINED;
+                case RHI::ImageLayout::ColorAttachment: return VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL;
+                case RHI::ImageLayout::DepthStencilAttachment: return VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL;
+                case RHI::ImageLayout::ShaderReadOnly: return VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+                case RHI::ImageLayout::TransferSrc: return VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL;
+                case RHI::ImageLayout::TransferDst: return VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+                case RHI::ImageLayout::Present: return VK_IMAGE_LAYOUT_PRESENT_SRC_KHR;
+                default: return VK_IMAGE_LAYOUT_GENERAL;
+            }
+        }
+
+        namespace {
+            // Accesses and stages an image in 'layout' is used with: what a barrier leaving the layout waits
+            // for, and what a barrier entering it makes the contents available to
+            void GetLayoutAccess(VkImageLayout layout, VkAccessFlags& access, VkPipelineStageFlags& stages) {
+                switch (layout) {
+                    case VK_IMAGE_LAYOUT_UNDEFINED:
+                        access = 0;
+                        stages = VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT;
+                        break;
+                    case VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL:
+                        access = VK_ACCESS_COLOR_ATTACHMENT_READ_BIT | VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT;
+                        stages = VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT;
+                        break;
+                    case VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL:
+                        access = VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_READ_BIT | VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_WRITE_BIT;
+                        stages = VK_PIPELINE_STAGE_EARLY_FRAGMENT_TESTS_BIT | VK_PIPELINE_STAGE_LATE_FRAGMENT_TESTS_BIT;
+                        break;
+                    case VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL:
+                        access = VK_ACCESS_SHADER_READ_BIT;
+                        stages = VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT;
+                        break;
+                    case VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL:
+                        access = VK_ACCESS_TRANSFER_READ_BIT;
+                        stages = VK_PIPELINE_STAGE_TRANSFER_BIT;
+                        break;
+                    case VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL:
+                        access = VK_ACCESS_TRANSFER_WRITE_BIT;
+                        stages = VK_PIPELINE_STAGE_TRANSFER_BIT;
+                        break;
+                    case VK_IMAGE_LAYOUT_PRESENT_SRC_KHR:
+                        // The presentation engine synchronizes through the semaphores
+                        access = 0;
+                        stages = VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT;
+                        break;
+                    default:
+                        access = VK_ACCESS_MEMORY_READ_BIT | VK_ACCESS_MEMORY_WRITE_BIT;
+                        stages = VK_PIPELINE_STAGE_ALL_COMMANDS_BIT;
+                        break;
+                }
+            }
+
+            RHI::ImageLayout ToRHIImageLayout(VkImageLayout layout) {
+                switch (layout) {
+                    case VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL: return RHI::ImageLayout::ColorAttachment;
+                    case VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL: return RHI::ImageLayout::DepthStencilAttachment;
+                    case VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL: return RHI::ImageLayout::ShaderReadOnly;
+                    case VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL: return RHI::ImageLayout::TransferSrc;
+                    case VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL: return RHI::ImageLayout::TransferDst;
+                    case VK_IMAGE_LAYOUT_PRESENT_SRC_KHR: return RHI::ImageLayout::Present;
+                    default: return RHI::ImageLayout::Undefined;
+                }
+            }
+
+            VkImageAspectFlags GetImageAspectMask(RHI::Format format) {
+                if (format == RHI::Format::D32_SFLOAT) {
+                    return VK_IMAGE_ASPECT_DEPTH_BIT;
+                }
+                if (format == RHI::Format::D24_UNORM_S8_UINT) {
+                    return VK_IMAGE_ASPECT_DEPTH_BIT | VK_IMAGE_ASPECT_STENCIL_BIT;
+                }
+                return VK_IMAGE_ASPECT_COLOR_BIT;
             }
-            // Default to general layout
-            return VK_IMAGE_LAYOUT_GENERAL;
         }
 
         VkShaderStageFlags ConvertShaderStageFlags(RHI::ShaderStage stage) {
@@ -234,19 +309,22 @@ namespace FirstEngine {
                     return VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
                 case RHI::DescriptorType::Sampler:
                     return VK_DESCRIPTOR_TYPE_SAMPLER;
+                case RHI::DescriptorType::UniformBufferDynamic:
+                    return VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC;
                 default:
                     return VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER;
             }
         }
 
         // VulkanCommandBuffer implementation
-        VulkanCommandBuffer::VulkanCommandBuffer(DeviceContext* context)
-            : m_Context(context), m_VkCommandBuffer(VK_NULL_HANDLE), m_IsRecording(false), 
+        VulkanCommandBuffer::VulkanCommandBuffer(DeviceContext* context, VkCommandPool commandPool, VkCommandBufferLevel level)
+            : m_Context(context), m_CommandPool(commandPool != VK_NULL_HANDLE ? commandPool : context->GetCommandPool()),
+              m_Level(level), m_VkCommandBuffer(VK_NULL_HANDLE), m_IsRecording(false), 
               m_CurrentPipelineLayout(VK_NULL_HANDLE), m_CurrentPipeline(nullptr) {
             VkCommandBufferAllocateInfo allocInfo{};
             allocInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
-            allocInfo.commandPool = context->GetCommandPool();
-            allocInfo.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+            allocInfo.commandPool = m_CommandPool;
+            allocInfo.level = level;
             allocInfo.commandBufferCount = 1;
 
             if (vkAllocateCommandBuffers(context->GetDevice(), &allocInfo, &m_VkCommandBuffer) != VK_SUCCESS) {
@@ -259,7 +337,7 @@ namespace FirstEngine {
                 // Note: Command buffers should only be freed after GPU has finished using them
                 // This is typically handled by waiting for a fence before destroying the command buffer
                 // For now, we assume the caller has ensured GPU completion (via WaitForFence or WaitIdle)
-                vkFreeCommandBuffers(m_Context->GetDevice(), m_Context->GetCommandPool(), 1, &m_VkCommandBuffer);
+                vkFreeCommandBuffers(m_Context->GetDevice(), m_CommandPool, 1, &m_VkCommandBuffer);
             }
         }
 
@@ -274,6 +352,31 @@ namespace FirstEngine {
             m_IsRecording = true;
         }
 
+        void VulkanCommandBuffer::BeginSecondary(RHI::IRenderPass* renderPass, RHI::IFramebuffer* framebuffer) {
+            if (m_Level != VK_COMMAND_BUFFER_LEVEL_SECONDARY) {
+                throw std::runtime_error("BeginSecondary: not a secondary command buffer");
+            }
+            if (!renderPass || !framebuffer) {
+                throw std::runtime_error("BeginSecondary: renderPass and framebuffer are required");
+            }
+
+            VkCommandBufferInheritanceInfo inheritanceInfo{};
+            inheritanceInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_INHERITANCE_INFO;
+            inheritanceInfo.renderPass = static_cast<VulkanRenderPass*>(renderPass)->GetVkRenderPass();
+            inheritanceInfo.subpass = 0;
+            inheritanceInfo.framebuffer = static_cast<VulkanFramebuffer*>(framebuffer)->GetVkFramebuffer();
+
+            VkCommandBufferBeginInfo beginInfo{};
+            beginInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+            beginInfo.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT | VK_COMMAND_BUFFER_USAGE_RENDER_PASS_CONTINUE_BIT;
+            beginInfo.pInheritanceInfo = &inheritanceInfo;
+
+            if (vkBeginCommandBuffer(m_VkCommandBuffer, &beginInfo) != VK_SUCCESS) {
+                throw std::runtime_error("Failed to begin recording secondary command buffer!");
+            }
+            m_IsRecording = true;
+        }
+
         void VulkanCommandBuffer::End() {
             if (vkEndCommandBuffer(m_VkCommandBuffer) != VK_SUCCESS) {
                 throw std::runtime_error("Failed to end recording command buffer!");
@@ -282,7 +385,8 @@ namespace FirstEngine {
         }
 
         void VulkanCommandBuffer::BeginRenderPass(RHI::IRenderPass* renderPass, RHI::IFramebuffer* framebuffer,
-                                                  const std::vector<float>& clearColors, float clearDepth, uint32_t clearStencil) {
+                                                  const std::vector<float>& clearColors, float clearDepth, uint32_t clearStencil,
+                                                  RHI::SubpassContents contents) {
             if (!renderPass) {
                 std::cerr << "Error: VulkanCommandBuffer::BeginRenderPass: renderPass is nullptr" << std::endl;
                 throw std::runtime_error("BeginRenderPass: renderPass is nullptr");
@@ -332,13 +436,29 @@ namespace FirstEngine {
             renderPassInfo.clearValueCount = static_cast<uint32_t>(clearValues.size());
             renderPassInfo.pClearValues = clearValues.data();
 
-            vkCmdBeginRenderPass(m_VkCommandBuffer, &renderPassInfo, VK_SUBPASS_CONTENTS_INLINE);
+            VkSubpassContents subpassContents = contents == RHI::SubpassContents::SecondaryCommandBuffers
+                ? VK_SUBPASS_CONTENTS_SECONDARY_COMMAND_BUFFERS
+                : VK_SUBPASS_CONTENTS_INLINE;
+            vkCmdBeginRenderPass(m_VkCommandBuffer, &renderPassInfo, subpassContents);
         }
 
         void VulkanCommandBuffer::EndRenderPass() {
             vkCmdEndRenderPass(m_VkCommandBuffer);
         }
 
+        void VulkanCommandBuffer::ExecuteCommands(const std::vector<RHI::ICommandBuffer*>& commandBuffers) {
+            std::vector<VkCommandBuffer> vkCommandBuffers;
+            vkCommandBuffers.reserve(commandBuffers.size());
+            for (auto* commandBuffer : commandBuffers) {
+                if (commandBuffer) {
+                    vkCommandBuffers.push_back(static_cast<VulkanCommandBuffer*>(commandBuffer)->GetVkCommandBuffer());
+                }
+            }
+            if (!vkCommandBuffers.empty()) {
+                vkCmdExecuteCommands(m_VkCommandBuffer, static_cast<uint32_t>(vkCommandBuffers.size()), vkCommandBuffers.data());
+            }
+        }
+
         void VulkanCommandBuffer::BindPipeline(RHI::IPipeline* pipeline) {
             if (!pipeline) {
                 return;
@@ -447,234 +567,119 @@ namespace FirstEngine {
             vkCmdSetScissor(m_VkCommandBuffer, 0, 1, &scissor);
         }
 
-        void VulkanCommandBuffer::TransitionImageLayout(RHI::IImage* image, RHI::Format oldLayout, RHI::Format newLayout, uint32_t mipLevels, RHI::ImageAccessMode accessMode) {
+        void VulkanCommandBuffer::TransitionImageLayout(RHI::IImage* image, RHI::ImageLayout newLayout, uint32_t mipLevels) {
             if (!image) return;
 
+            // Transition from the layout tracked on the image
             auto* vkImage = static_cast<VulkanImage*>(image);
-            VkImage vkImg = vkImage->GetVkImage();
-            if (vkImg == VK_NULL_HANDLE) return;
-
-            // Use the actual current layout from the image (this is the correct way)
-            // The oldLayout parameter is ignored - we use the tracked layout instead
-            VkImageLayout trackedLayout = vkImage->GetCurrentLayout();
-            VkImageLayout oldVkLayout = trackedLayout;
-            VkImageLayout newVkLayout;
-            
-            // Get actual image format - needed for aspect mask determination
-            RHI::Format actualImageFormat = vkImage->GetFormat();
-            bool isDepthImage = (actualImageFormat == RHI::Format::D32_SFLOAT || actualImageFormat == RHI::Format::D24_UNORM_S8_UINT);
-            
-            // Determine target layout based on accessMode (set by FrameGraph based on AddReadResource/AddWriteResource)
-            // This eliminates the need for complex guessing logic
-            if (accessMode == RHI::ImageAccessMode::Read) {
-                // Read access: transition to SHADER_READ_ONLY_OPTIMAL
-                newVkLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
-            } else { // Write
-                // Write access: transition to appropriate attachment layout
-                if (isDepthImage) {
-                    newVkLayout = VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL;
-                } else {
-                    newVkLayout = VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL;
-                }
-            }
-            
-            // If old and new layouts are the same, no transition needed
-            if (oldVkLayout == newVkLayout) {
+            if (vkImage->GetCurrentLayout() == ConvertImageLayout(newLayout)) {
                 return;
             }
-            
-            // Handle special case: Swapchain images
-            // Swapchain images should not be transitioned to SHADER_READ_ONLY_OPTIMAL
-            // They should only be used as color attachments (COLOR_ATTACHMENT_OPTIMAL) or for presentation (PRESENT_SRC_KHR)
-            // Check if this is a swapchain image
-            bool isSwapchainImage = vkImage->IsSwapchainImage();
-            
-            if (isSwapchainImage) {
-                // Special handling for swapchain images:
-                // - If transitioning from COLOR_ATTACHMENT_OPTIMAL with Read access mode,
-                //   this means we want to present the image, so transition to PRESENT_SRC_KHR
-                // - Otherwise, swapchain images should not be read as shader resources
-                if (oldVkLayout == VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL && 
-                    accessMode == RHI::ImageAccessMode::Read && 
-                    newVkLayout == VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL) {
-                    // This is a request to present the swapchain image
-                    // Transition to PRESENT_SRC_KHR instead of SHADER_READ_ONLY_OPTIMAL
-                    newVkLayout = VK_IMAGE_LAYOUT_PRESENT_SRC_KHR;
-                } else if (newVkLayout == VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL) {
-                    // Invalid: swapchain images should not be read as shader resources
-                    std::cerr << "Warning: TransitionImageLayout: Attempting to transition swapchain image to SHADER_READ_ONLY_OPTIMAL. "
-                              << "Swapchain images should only be used as color attachments or for presentation. Skipping transition." << std::endl;
-                    return;
-                }
-                
-                // For swapchain images, only allow transitions:
-                // - PRESENT_SRC_KHR <-> COLOR_ATTACHMENT_OPTIMAL
-                // - UNDEFINED -> COLOR_ATTACHMENT_OPTIMAL (first frame)
-                if (oldVkLayout == VK_IMAGE_LAYOUT_PRESENT_SRC_KHR && newVkLayout != VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL) {
-                    std::cerr << "Warning: TransitionImageLayout: Invalid transition for swapchain image from PRESENT_SRC_KHR to " 
-                              << (newVkLayout == VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL ? "DEPTH_STENCIL_ATTACHMENT_OPTIMAL" : "unknown")
-                              << ". Only COLOR_ATTACHMENT_OPTIMAL is allowed. Skipping transition." << std::endl;
-                    return;
-                }
-            }
-            
-            // Determine aspect mask based on actual image format
-            VkImageAspectFlags aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
-            if (isDepthImage) {
-                if (actualImageFormat == RHI::Format::D32_SFLOAT) {
-                    aspectMask = VK_IMAGE_ASPECT_DEPTH_BIT;
-                } else if (actualImageFormat == RHI::Format::D24_UNORM_S8_UINT) {
-                    aspectMask = VK_IMAGE_ASPECT_DEPTH_BIT | VK_IMAGE_ASPECT_STENCIL_BIT;
-                } else {
-                    // Fallback for undefined format
-                    aspectMask = VK_IMAGE_ASPECT_DEPTH_BIT;
-                }
-            }
 
-            VkImageMemoryBarrier barrier{};
-            barrier.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
-            barrier.oldLayout = oldVkLayout;
-            barrier.newLayout = newVkLayout;
-            barrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
-            barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
-            barrier.image = vkImg;
-            barrier.subresourceRange.aspectMask = aspectMask;
-            barrier.subresourceRange.baseMipLevel = 0;
-            barrier.subresourceRange.levelCount = mipLevels;
-            barrier.subresourceRange.baseArrayLayer = 0;
-            barrier.subresourceRange.layerCount = 1;
-
-            // Determine source and destination access masks based on layout transition
-            VkAccessFlags srcAccessMask = 0;
-            VkAccessFlags dstAccessMask = 0;
-
-            // Source access mask based on old layout
-            switch (oldVkLayout) {
-                case VK_IMAGE_LAYOUT_UNDEFINED:
-                    srcAccessMask = 0;
-                    break;
-                case VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL:
-                    srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
-                    break;
-                case VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL:
-                    srcAccessMask = VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT;
-                    break;
-                case VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL:
-                    srcAccessMask = VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_WRITE_BIT;
-                    break;
-                case VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL:
-                    srcAccessMask = VK_ACCESS_SHADER_READ_BIT;
-                    break;
-                case VK_IMAGE_LAYOUT_PRESENT_SRC_KHR:
-                    srcAccessMask = 0; // Present doesn't need access mask
-                    break;
-                default:
-                    srcAccessMask = VK_ACCESS_MEMORY_READ_BIT | VK_ACCESS_MEMORY_WRITE_BIT;
-                    break;
-            }
+            RHI::ImageBarrier imageBarrier;
+            imageBarrier.image = image;
+            imageBarrier.oldLayout = ToRHIImageLayout(vkImage->GetCurrentLayout());
+            imageBarrier.newLayout = newLayout;
+            imageBarrier.mipLevels = mipLevels;
 
-            // Destination access mask based on new layout
-            switch (newVkLayout) {
-                case VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL:
-                    dstAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
-                    break;
-                case VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL:
-                    dstAccessMask = VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT;
-                    break;
-                case VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL:
-                    dstAccessMask = VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_WRITE_BIT;
-                    break;
-                case VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL:
-                    dstAccessMask = VK_ACCESS_SHADER_READ_BIT;
-                    break;
-                case VK_IMAGE_LAYOUT_PRESENT_SRC_KHR:
-                    dstAccessMask = 0; // Present doesn't need access mask
-                    break;
-                default:
-                    dstAccessMask = VK_ACCESS_MEMORY_READ_BIT | VK_ACCESS_MEMORY_WRITE_BIT;
-                    break;
-            }
+            RHI::PipelineBarrierDescription barrier;
+            barrier.imageBarriers.push_back(imageBarrier);
+            PipelineBarrier(barrier);
+        }
 
-            barrier.srcAccessMask = srcAccessMask;
-            barrier.dstAccessMask = dstAccessMask;
+        void VulkanCommandBuffer::PipelineBarrier(const RHI::PipelineBarrierDescription& barrier) {
+            VkPipelineStageFlags sourceStages = 0;
+            VkPipelineStageFlags destinationStages = 0;
 
-            // Determine pipeline stages
-            VkPipelineStageFlags sourceStage = VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT;
-            VkPipelineStageFlags destinationStage = VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT;
+            std::vector<VkImageMemoryBarrier> imageBarriers;
+            imageBarriers.reserve(barrier.imageBarriers.size());
+            for (const RHI::ImageBarrier& transition : barrier.imageBarriers) {
+                auto* vkImage = static_cast<VulkanImage*>(transition.image);
+                if (!vkImage || vkImage->GetVkImage() == VK_NULL_HANDLE) {
+                    continue;
+                }
 
-            // Source stage based on old layout
-            switch (oldVkLayout) {
-                case VK_IMAGE_LAYOUT_UNDEFINED:
-                    sourceStage = VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT;
-                    break;
-                case VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL:
-                    sourceStage = VK_PIPELINE_STAGE_TRANSFER_BIT;
-                    break;
-                case VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL:
-                    sourceStage = VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT;
-                    break;
-                case VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL:
-                    sourceStage = VK_PIPELINE_STAGE_EARLY_FRAGMENT_TESTS_BIT | VK_PIPELINE_STAGE_LATE_FRAGMENT_TESTS_BIT;
-                    break;
-                case VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL:
-                    sourceStage = VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT;
-                    break;
-                case VK_IMAGE_LAYOUT_PRESENT_SRC_KHR:
-                    sourceStage = VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT;
-                    break;
-                default:
-                    sourceStage = VK_PIPELINE_STAGE_ALL_COMMANDS_BIT;
-                    break;
-            }
+                VkImageLayout oldVkLayout = ConvertImageLayout(transition.oldLayout);
+                VkImageLayout newVkLayout = ConvertImageLayout(transition.newLayout);
+                if (vkImage->IsSwapchainImage() && newVkLayout == VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL) {
+                    // Swapchain images are only rendered to and presented
+                    std::cerr << "Warning: PipelineBarrier: Swapchain images can't be transitioned to "
+                              << "SHADER_READ_ONLY_OPTIMAL. Skipping transition." << std::endl;
+                    continue;
+                }
 
-            // Destination stage based on new layout
-            switch (newVkLayout) {
-                case VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL:
-                    destinationStage = VK_PIPELINE_STAGE_TRANSFER_BIT;
-                    break;
-                case VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL:
-                    destinationStage = VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT;
-                    break;
-                case VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL:
-                    destinationStage = VK_PIPELINE_STAGE_EARLY_FRAGMENT_TESTS_BIT | VK_PIPELINE_STAGE_LATE_FRAGMENT_TESTS_BIT;
-                    break;
-                case VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL:
-                    destinationStage = VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT;
-                    break;
-                case VK_IMAGE_LAYOUT_PRESENT_SRC_KHR:
-                    destinationStage = VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT;
-                    break;
-                default:
-                    destinationStage = VK_PIPELINE_STAGE_ALL_COMMANDS_BIT;
-                    break;
+                VkImageMemoryBarrier imageBarrier{};
+                imageBarrier.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
+                imageBarrier.oldLayout = oldVkLayout;
+                imageBarrier.newLayout = newVkLayout;
+                imageBarrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+                imageBarrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+                imageBarrier.image = vkImage->GetVkImage();
+                imageBarrier.subresourceRange.aspectMask = GetImageAspectMask(vkImage->GetFormat());
+                imageBarrier.subresourceRange.baseMipLevel = 0;
+                imageBarrier.subresourceRange.levelCount = transition.mipLevels;
+                imageBarrier.subresourceRange.baseArrayLayer = 0;
+                imageBarrier.subresourceRange.layerCount = 1;
+
+                VkPipelineStageFlags srcStages = 0;
+                VkPipelineStageFlags dstStages = 0;
+                GetLayoutAccess(oldVkLayout, imageBarrier.srcAccessMask, srcStages);
+                GetLayoutAccess(newVkLayout, imageBarrier.dstAccessMask, dstStages);
+                // Only writes need to be made available; reads just have to be finished
+                imageBarrier.srcAccessMask &= VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT | VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_WRITE_BIT |
+                                              VK_ACCESS_TRANSFER_WRITE_BIT | VK_ACCESS_SHADER_WRITE_BIT | VK_ACCESS_MEMORY_WRITE_BIT;
+                sourceStages |= srcStages;
+                destinationStages |= dstStages;
+
+                imageBarriers.push_back(imageBarrier);
+                vkImage->SetCurrentLayout(newVkLayout);
+            }
+
+            // Whatever used the memory before (attachment, shader or transfer writes, or reads) is finished and
+            // its writes are visible before anything after the barrier touches it
+            VkMemoryBarrier memoryBarrier{};
+            memoryBarrier.sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER;
+            if (barrier.memoryBarrier) {
+                memoryBarrier.srcAccessMask = VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT | VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_WRITE_BIT |
+                                              VK_ACCESS_SHADER_WRITE_BIT | VK_ACCESS_TRANSFER_WRITE_BIT;
+                memoryBarrier.dstAccessMask = VK_ACCESS_COLOR_ATTACHMENT_READ_BIT | VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT |
+                                              VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_READ_BIT | VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_WRITE_BIT |
+                                              VK_ACCESS_SHADER_READ_BIT | VK_ACCESS_SHADER_WRITE_BIT |
+                                              VK_ACCESS_TRANSFER_READ_BIT | VK_ACCESS_TRANSFER_WRITE_BIT |
+                                              VK_ACCESS_UNIFORM_READ_BIT | VK_ACCESS_VERTEX_ATTRIBUTE_READ_BIT |
+                                              VK_ACCESS_INDEX_READ_BIT;
+                sourceStages |= VK_PIPELINE_STAGE_ALL_COMMANDS_BIT;
+                destinationStages |= VK_PIPELINE_STAGE_ALL_COMMANDS_BIT;
+            }
+
+            if (imageBarriers.empty() && !barrier.memoryBarrier) {
+                return;
             }
 
-            // Execute barrier if layouts are different
-            // (We already checked for same layout above, so this should always be true here)
             vkCmdPipelineBarrier(
                 m_VkCommandBuffer,
-                sourceStage,
-                destinationStage,
+                sourceStages,
+                destinationStages,
                 0,
+                barrier.memoryBarrier ? 1 : 0, barrier.memoryBarrier ? &memoryBarrier : nullptr,
                 0, nullptr,
-                0, nullptr,
-                1, &barrier
+                static_cast<uint32_t>(imageBarriers.size()), imageBarriers.empty() ? nullptr : imageBarriers.data()
             );
-
-            // Update the tracked layout after successful transition
-            // This ensures our tracking matches the actual Vulkan state
-            vkImage->SetCurrentLayout(newVkLayout);
         }
 
-        void VulkanCommandBuffer::CopyBuffer(RHI::IBuffer* src, RHI::IBuffer* dst, uint64_t size) {
+        void VulkanCommandBuffer::CopyBuffer(RHI::IBuffer* src, RHI::IBuffer* dst, uint64_t size,
+                                             uint64_t srcOffset, uint64_t dstOffset) {
             auto* vkSrc = static_cast<VulkanBuffer*>(src);
             auto* vkDst = static_cast<VulkanBuffer*>(dst);
             VkBufferCopy copyRegion{};
+            copyRegion.srcOffset = srcOffset;
+            copyRegion.dstOffset = dstOffset;
             copyRegion.size = size;
             vkCmdCopyBuffer(m_VkCommandBuffer, vkSrc->GetVkBuffer(), vkDst->GetVkBuffer(), 1, &copyRegion);
         }
 
-        void VulkanCommandBuffer::CopyBufferToImage(RHI::IBuffer* buffer, RHI::IImage* image, uint32_t width, uint32_t height) {
+        void VulkanCommandBuffer::CopyBufferToImage(RHI::IBuffer* buffer, RHI::IImage* image, uint32_t width, uint32_t height,
+                                                    uint64_t bufferOffset, uint32_t mipLevel) {
             if (!buffer || !image) return;
             
             auto* vkBuffer = static_cast<VulkanBuffer*>(buffer);
@@ -769,8 +774,9 @@ namespace FirstEngine {
                 barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
                 barrier.image = vkImg;
                 barrier.subresourceRange.aspectMask = aspectMask;
+                // Layout is tracked per image, so every level moves together
                 barrier.subresourceRange.baseMipLevel = 0;
-                barrier.subresourceRange.levelCount = 1;
+                barrier.subresourceRange.levelCount = vkImage->GetMipLevels();
                 barrier.subresourceRange.baseArrayLayer = 0;
                 barrier.subresourceRange.layerCount = 1;
                 barrier.srcAccessMask = srcAccessMask;
@@ -792,11 +798,11 @@ namespace FirstEngine {
             
             // Now perform the copy operation
             VkBufferImageCopy region{};
-            region.bufferOffset = 0;
+            region.bufferOffset = bufferOffset;
             region.bufferRowLength = 0;
             region.bufferImageHeight = 0;
             region.imageSubresource.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
-            region.imageSubresource.mipLevel = 0;
+            region.imageSubresource.mipLevel = mipLevel;
             region.imageSubresource.baseArrayLayer = 0;
             region.imageSubresource.layerCount = 1;
             region.imageOffset = {0, 0, 0};
@@ -899,6 +905,16 @@ namespace FirstEngine {
             }
         }
 
+        void* VulkanBuffer::GetMappedPointer() const {
+            return m_Buffer ? m_Buffer->GetMappedPointer() : nullptr;
+        }
+
+        void VulkanBuffer::FlushMappedRange(uint64_t offset, uint64_t size) {
+            if (m_Buffer) {
+                m_Buffer->Flush(offset, size);
+            }
+        }
+
         VkBuffer VulkanBuffer::GetVkBuffer() const {
             return m_Buffer ? m_Buffer->GetBuffer() : VK_NULL_HANDLE;
         }
@@ -960,10 +976,22 @@ namespace FirstEngine {
                 case VK_FORMAT_R8G8B8A8_SRGB: return RHI::Format::R8G8B8A8_SRGB;
                 case VK_FORMAT_D32_SFLOAT: return RHI::Format::D32_SFLOAT;
                 case VK_FORMAT_D24_UNORM_S8_UINT: return RHI::Format::D24_UNORM_S8_UINT;
+                case VK_FORMAT_BC1_RGBA_UNORM_BLOCK: return RHI::Format::BC1_RGBA_UNORM;
+                case VK_FORMAT_BC1_RGBA_SRGB_BLOCK: return RHI::Format::BC1_RGBA_SRGB;
+                case VK_FORMAT_BC3_UNORM_BLOCK: return RHI::Format::BC3_UNORM;
+                case VK_FORMAT_BC3_SRGB_BLOCK: return RHI::Format::BC3_SRGB;
+                case VK_FORMAT_BC5_UNORM_BLOCK: return RHI::Format::BC5_UNORM;
+                case VK_FORMAT_BC7_UNORM_BLOCK: return RHI::Format::BC7_UNORM;
+                case VK_FORMAT_BC7_SRGB_BLOCK: return RHI::Format::BC7_SRGB;
                 default: return RHI::Format::Undefined;
             }
         }
 
+        uint32_t VulkanImage::GetMipLevels() const {
+            // Swapchain images have a single level
+            return m_Image ? m_Image->GetMipLevels() : 1;
+        }
+
         RHI::IImageView* VulkanImage::CreateImageView() {
             if (!m_Image) return nullptr;
             
@@ -488,6 +488,16 @@ namespace FirstEngine {
                           << "Descriptor sets must be updated before command buffer recording." << std::endl;
             }
             
+            // Cooked textures are block compressed; every desktop GPU samples BC formats
+            if (features2.features.textureCompressionBC) {
+                deviceFeatures.textureCompressionBC = VK_TRUE;
+                m_TextureCompressionBCSupported = true;
+            } else {
+                m_TextureCompressionBCSupported = false;
+                std::cerr << "Warning: textureCompressionBC feature not supported. "
+                          << "Block-compressed textures will be decoded on the CPU." << std::endl;
+            }
+
             // Set features
             features2.features = deviceFeatures;
 
@@ -749,6 +749,21 @@ void EditorAPI_SetRenderConfig(void* engine, int width, int height, float render
     context->SetRenderConfig(width, height, renderScale);
 }
 
+void EditorAPI_ExportFrameGraph(void* engine, const char* filePath) {
+    std::lock_guard<std::mutex> lock(g_RenderContextMutex);
+    
+    if (!engine || g_GlobalRenderContext != engine || !filePath) {
+        return;
+    }
+    
+    auto* context = static_cast<FirstEngine::Renderer::RenderContext*>(engine);
+    if (!context->IsEngineInitialized()) {
+        return;
+    }
+    
+    context->RequestFrameGraphExport(filePath);
+}
+
 // Console output redirection
 #ifdef _WIN32
 void EditorAPI_SetOutputCallback(void* callback) {
@@ -1,8 +1,12 @@
 #include "FirstEngine/Renderer/CommandRecorder.h"
 #include "FirstEngine/RHI/ICommandBuffer.h"
+#include "FirstEngine/RHI/IDevice.h"
 #include "FirstEngine/RHI/IFramebuffer.h"
+#include "FirstEngine/Core/ThreadManager.h"
+#include <algorithm>
 #include <cstring>
 #include <iostream>
+#include <map>
 
 namespace FirstEngine {
     namespace Renderer {
@@ -10,6 +14,17 @@ namespace FirstEngine {
         CommandRecorder::CommandRecorder() = default;
         CommandRecorder::~CommandRecorder() = default;
 
+        namespace {
+            bool IsDrawCommand(RenderCommandType type) {
+                return type == RenderCommandType::Draw || type == RenderCommandType::DrawIndexed;
+            }
+
+            bool CanRecordSecondary(const RenderCommand::BeginRenderPassParams& params) {
+                return params.renderPass && params.framebuffer &&
+                       params.framebuffer->GetWidth() > 0 && params.framebuffer->GetHeight() > 0;
+            }
+        }
+
         void CommandRecorder::RecordCommands(
             RHI::ICommandBuffer* commandBuffer,
             const RenderCommandList& commandList
@@ -23,7 +38,23 @@ namespace FirstEngine {
             bool skipUntilEndRenderPass = false; // Skip commands if BeginRenderPass failed
 
             const auto& commands = commandList.GetCommands();
-            for (size_t i = 0; i < commands.size(); ++i) {
+            RecordCommandRange(commandBuffer, commands, 0, commands.size(), renderPassDepth, skipUntilEndRenderPass);
+
+            // Warn if render pass depth is not balanced
+            if (renderPassDepth != 0) {
+                std::cerr << "Warning: CommandRecorder: Unbalanced BeginRenderPass/EndRenderPass commands. "
+                          << "Depth: " << renderPassDepth << std::endl;
+            }
+        }
+
+        void CommandRecorder::RecordCommandRange(
+            RHI::ICommandBuffer* commandBuffer,
+            const std::vector<RenderCommand>& commands,
+            size_t first, size_t last,
+            int& renderPassDepth,
+            bool& skipUntilEndRenderPass
+        ) {
+            for (size_t i = first; i < last; ++i) {
                 const auto& command = commands[i];
                 
                 // If we're skipping commands due to a failed BeginRenderPass, only process EndRenderPass
@@ -55,12 +86,244 @@ namespace FirstEngine {
                     }
                 }
             }
+        }
+
+        void CommandRecorder::RecordCommandsParallel(
+            RHI::IDevice* device,
+            RHI::ICommandBuffer* commandBuffer,
+            const RenderCommandList& commandList,
+            std::vector<std::unique_ptr<RHI::ICommandBuffer>>& outSecondaryBuffers
+        ) {
+            if (!commandBuffer) {
+                return;
+            }
+
+            size_t workerCount = Core::ThreadManager::IsInitialized() ? Core::ThreadManager::GetInstance().GetWorkerCount() : 0;
+            if (!device || !m_ParallelRecordingEnabled || workerCount == 0) {
+                RecordCommands(commandBuffer, commandList);
+                return;
+            }
+
+            const auto& commands = commandList.GetCommands();
+
+            // Plan: every render pass with enough draws is cut into draw ranges
+            std::vector<SecondaryRange> ranges;
+            for (size_t i = 0; i < commands.size(); ++i) {
+                if (commands[i].type == RenderCommandType::BeginRenderPass) {
+                    i = PlanRenderPass(commands, i, workerCount, ranges);
+                }
+            }
+
+            if (ranges.empty()) {
+                RecordCommands(commandBuffer, commandList);
+                return;
+            }
+
+            // Record all ranges at once - independent passes and the slices of big passes alike
+            std::vector<std::unique_ptr<RHI::ICommandBuffer>> secondaries(ranges.size());
+            std::vector<Core::Future<void>> futures;
+            futures.reserve(ranges.size());
+            for (size_t r = 0; r < ranges.size(); ++r) {
+                futures.push_back(Core::ThreadManager::GetInstance().InvokeOnWorker([device, &commands, &ranges, &secondaries, r]() {
+                    secondaries[r] = RecordSecondary(device, commands, ranges[r]);
+                }, Core::TaskPriority::High));
+            }
+            for (auto& future : futures) {
+                future.get();
+            }
+
+            // Replay in list order on the primary: split passes run their secondaries, the rest is recorded inline
+            int renderPassDepth = 0;
+            bool skipUntilEndRenderPass = false;
+            size_t next = 0;
+            size_t rangeIndex = 0;
+            while (rangeIndex < ranges.size()) {
+                size_t passBegin = ranges[rangeIndex].beginRenderPass;
+                size_t passRangeEnd = rangeIndex;
+                bool allRecorded = true;
+                while (passRangeEnd < ranges.size() && ranges[passRangeEnd].beginRenderPass == passBegin) {
+                    allRecorded = allRecorded && secondaries[passRangeEnd] != nullptr;
+                    ++passRangeEnd;
+                }
+                // The pass's last range ends at its EndRenderPass
+                size_t passEnd = ranges[passRangeEnd - 1].last;
+
+                RecordCommandRange(commandBuffer, commands, next, passBegin, renderPassDepth, skipUntilEndRenderPass);
+
+                if (!allRecorded) {
+                    std::cerr << "Warning: CommandRecorder: Secondary recording failed, recording pass at command index "
+                              << passBegin << " inline" << std::endl;
+                    RecordCommandRange(commandBuffer, commands, passBegin, passEnd + 1, renderPassDepth, skipUntilEndRenderPass);
+                } else if (RecordBeginRenderPass(commandBuffer, commands[passBegin].params.beginRenderPass,
+                                                 RHI::SubpassContents::SecondaryCommandBuffers)) {
+                    std::vector<RHI::ICommandBuffer*> passSecondaries;
+                    for (size_t r = rangeIndex; r < passRangeEnd; ++r) {
+                        passSecondaries.push_back(secondaries[r].get());
+                    }
+                    commandBuffer->ExecuteCommands(passSecondaries);
+                    commandBuffer->EndRenderPass();
+                } else {
+                    std::cerr << "CommandRecorder: BeginRenderPass FAILED at command index " << passBegin
+                              << ", skipping its secondary command buffers" << std::endl;
+                }
+
+                next = passEnd + 1;
+                rangeIndex = passRangeEnd;
+            }
+            RecordCommandRange(commandBuffer, commands, next, commands.size(), renderPassDepth, skipUntilEndRenderPass);
 
-            // Warn if render pass depth is not balanced
             if (renderPassDepth != 0) {
                 std::cerr << "Warning: CommandRecorder: Unbalanced BeginRenderPass/EndRenderPass commands. "
                           << "Depth: " << renderPassDepth << std::endl;
             }
+
+            for (auto& secondary : secondaries) {
+                if (secondary) {
+                    outSecondaryBuffers.push_back(std::move(secondary));
+                }
+            }
+        }
+
+        size_t CommandRecorder::PlanRenderPass(
+            const std::vector<RenderCommand>& commands,
+            size_t beginIndex,
+            size_t workerCount,
+            std::vector<SecondaryRange>& outRanges
+        ) {
+            // Render passes don't nest; the pass ends at the next EndRenderPass
+            size_t endIndex = beginIndex + 1;
+            uint32_t drawCount = 0;
+            while (endIndex < commands.size() && commands[endIndex].type != RenderCommandType::EndRenderPass) {
+                if (commands[endIndex].type == RenderCommandType::BeginRenderPass) {
+                    return beginIndex; // Malformed list: leave it to the inline path
+                }
+                if (IsDrawCommand(commands[endIndex].type)) {
+                    drawCount++;
+                }
+                endIndex++;
+            }
+            if (endIndex >= commands.size() || drawCount < kMinDrawsForSecondary ||
+                !CanRecordSecondary(commands[beginIndex].params.beginRenderPass)) {
+                return endIndex;
+            }
+
+            uint32_t rangeCount = (drawCount + kDrawsPerSecondary - 1) / kDrawsPerSecondary;
+            rangeCount = std::max(1u, std::min(rangeCount, static_cast<uint32_t>(workerCount)));
+            uint32_t drawsPerRange = (drawCount + rangeCount - 1) / rangeCount;
+
+            // Bound state in effect at the current position, by kind of binding
+            size_t pipeline = SIZE_MAX;
+            std::map<uint32_t, size_t> descriptorSets;   // firstSet -> command
+            std::map<uint32_t, size_t> pushConstants;    // offset -> command
+            size_t vertexBuffers = SIZE_MAX;
+            size_t indexBuffer = SIZE_MAX;
+
+            SecondaryRange range;
+            range.beginRenderPass = beginIndex;
+            range.first = beginIndex + 1;
+            uint32_t rangeDraws = 0;
+
+            for (size_t i = beginIndex + 1; i < endIndex; ++i) {
+                switch (commands[i].type) {
+                    case RenderCommandType::BindPipeline:
+                        pipeline = i;
+                        pushConstants.clear();
+                        break;
+                    case RenderCommandType::BindDescriptorSets:
+                        descriptorSets[commands[i].params.bindDescriptorSets.firstSet] = i;
+                        break;
+                    case RenderCommandType::PushConstants:
+                        pushConstants[commands[i].params.pushConstants.offset] = i;
+                        break;
+                    case RenderCommandType::BindVertexBuffers:
+                        vertexBuffers = i;
+                        break;
+                    case RenderCommandType::BindIndexBuffer:
+                        indexBuffer = i;
+                        break;
+                    default:
+                        break;
+                }
+
+                if (!IsDrawCommand(commands[i].type) || ++rangeDraws < drawsPerRange) {
+                    continue;
+                }
+
+                // Cut after this draw; the next range re-binds the state in effect here
+                range.last = i + 1;
+                outRanges.push_back(range);
+
+                range = SecondaryRange();
+                range.beginRenderPass = beginIndex;
+                range.first = i + 1;
+                if (pipeline != SIZE_MAX) {
+                    range.inheritedState.push_back(pipeline);
+                }
+                for (const auto& entry : descriptorSets) {
+                    range.inheritedState.push_back(entry.second);
+                }
+                for (const auto& entry : pushConstants) {
+                    range.inheritedState.push_back(entry.second);
+                }
+                if (vertexBuffers != SIZE_MAX) {
+                    range.inheritedState.push_back(vertexBuffers);
+                }
+                if (indexBuffer != SIZE_MAX) {
+                    range.inheritedState.push_back(indexBuffer);
+                }
+                rangeDraws = 0;
+            }
+
+            // Remaining draws form the final range; binds after the last draw just go with the previous one
+            if (rangeDraws > 0) {
+                range.last = endIndex;
+                outRanges.push_back(range);
+            } else {
+                outRanges.back().last = endIndex;
+            }
+
+            return endIndex;
+        }
+
+        std::unique_ptr<RHI::ICommandBuffer> CommandRecorder::RecordSecondary(
+            RHI::IDevice* device,
+            const std::vector<RenderCommand>& commands,
+            const SecondaryRange& range
+        ) {
+            const auto& pass = commands[range.beginRenderPass].params.beginRenderPass;
+
+            try {
+                auto secondary = device->CreateSecondaryCommandBuffer();
+                if (!secondary) {
+                    return nullptr;
+                }
+
+                secondary->BeginSecondary(pass.renderPass, pass.framebuffer);
+
+                // Dynamic state isn't inherited from the primary
+                uint32_t width = pass.framebuffer->GetWidth();
+                uint32_t height = pass.framebuffer->GetHeight();
+                secondary->SetViewport(0.0f, 0.0f, static_cast<float>(width), static_cast<float>(height), 0.0f, 1.0f);
+                secondary->SetScissor(0, 0, width, height);
+
+                // Each worker records with its own recorder (it tracks the bound pipeline)
+                CommandRecorder recorder;
+                for (size_t index : range.inheritedState) {
+                    recorder.RecordCommand(secondary.get(), commands[index], 1);
+                }
+                for (size_t i = range.first; i < range.last; ++i) {
+                    recorder.RecordCommand(secondary.get(), commands[i], 1);
+                }
+
+                secondary->End();
+                return secondary;
+            } catch (const std::exception& e) {
+                std::cerr << "Error: CommandRecorder::RecordSecondary: " << e.what() << std::endl;
+                return nullptr;
+            } catch (...) {
+                std::cerr << "Error: CommandRecorder::RecordSecondary: Unknown exception thrown" << std::endl;
+                return nullptr;
+            }
         }
 
         bool CommandRecorder::RecordCommand(
@@ -129,6 +392,14 @@ namespace FirstEngine {
                 case RenderCommandType::PushConstants:
                     RecordPushConstants(commandBuffer, command.params.pushConstants);
                     return true;
+                case RenderCommandType::PipelineBarrier:
+                    // Pipeline barriers are not allowed inside a render pass (FrameGraph emits them before it)
+                    if (renderPassDepth > 0) {
+                        std::cerr << "Error: CommandRecorder: PipelineBarrier inside a render pass" << std::endl;
+                        return false;
+                    }
+                    commandBuffer->PipelineBarrier(command.params.pipelineBarrier.barrier);
+                    return true;
                 default:
                     // Unknown command type, skip
                     return false;
@@ -177,13 +448,12 @@ namespace FirstEngine {
 
         void CommandRecorder::RecordTransitionImageLayout(RHI::ICommandBuffer* cmd, const RenderCommand::TransitionImageLayoutParams& params) {
             if (params.image) {
-                // Use accessMode to determine target layout instead of guessing from format
-                // This is set by FrameGraph based on AddReadResource/AddWriteResource
-                cmd->TransitionImageLayout(params.image, params.formatOld, params.formatNew, params.mipLevels, params.accessMode);
+                cmd->TransitionImageLayout(params.image, params.newLayout, params.mipLevels);
             }
         }
 
-        bool CommandRecorder::RecordBeginRenderPass(RHI::ICommandBuffer* cmd, const RenderCommand::BeginRenderPassParams& params) {
+        bool CommandRecorder::RecordBeginRenderPass(RHI::ICommandBuffer* cmd, const RenderCommand::BeginRenderPassParams& params,
+                                                    RHI::SubpassContents contents) {
             if (!cmd) {
                 std::cerr << "Error: CommandRecorder::RecordBeginRenderPass: commandBuffer is nullptr" << std::endl;
                 return false;
@@ -211,9 +481,15 @@ namespace FirstEngine {
                     params.framebuffer,
                     params.clearColors,
                     params.clearDepth,
-                    params.clearStencil
+                    params.clearStencil,
+                    contents
                 );
                 
+                // Secondary command buffers set their own viewport/scissor (only ExecuteCommands is allowed here)
+                if (contents == RHI::SubpassContents::SecondaryCommandBuffers) {
+                    return true;
+                }
+
                 // Set viewport and scissor after beginning render pass
                 // This is required for pipelines with dynamic viewport/scissor state
                 cmd->SetViewport(0.0f, 0.0f, static_cast<float>(width), static_cast<float>(height), 0.0f, 1.0f);
@@ -29,6 +29,9 @@ namespace FirstEngine {
             m_LightingPass->OnBuild(frameGraph, this);
             m_PostProcessPass->OnBuild(frameGraph, this);
 
+            // What the frame produces; passes that don't contribute to it are culled
+            frameGraph.MarkOutput(frameGraph.FindResource(FrameGraphResourceNameToString(FrameGraphResourceName::PostProcessBuffer)));
+
             return true;
         }
 
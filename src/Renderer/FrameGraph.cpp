@@ -4,6 +4,8 @@
 #include "FirstEngine/Renderer/IRenderPass.h"
 #include "FirstEngine/Renderer/SceneRenderer.h"
 #include "FirstEngine/Renderer/ElementRenderer.h"
+#include "FirstEngine/Renderer/RenderResourceManager.h"
+#include "FirstEngine/Renderer/ShaderLayout.h"
 #include "FirstEngine/Resources/Scene.h"
 #include "FirstEngine/RHI/IDevice.h"
 #include "FirstEngine/RHI/IRenderPass.h"
@@ -11,15 +13,185 @@
 #include "FirstEngine/RHI/IBuffer.h"
 #include "FirstEngine/RHI/IImage.h"
 #include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <iomanip>
 #include <queue>
 #include <stdexcept>
 #include <memory>
 #include <iostream>
+#include <sstream>
 #include <unordered_set>
 
 namespace FirstEngine {
     namespace Renderer {
 
+        namespace {
+            uint64_t AlignUp(uint64_t value, uint64_t alignment) {
+                return alignment > 1 ? (value + alignment - 1) / alignment * alignment : value;
+            }
+
+            bool Contains(const std::vector<FGResourceHandle>& handles, FGResourceHandle handle) {
+                return std::find(handles.begin(), handles.end(), handle) != handles.end();
+            }
+
+            // FNV-1a, for the structural hashes of the graph
+            constexpr uint64_t kHashSeed = 14695981039346656037ull;
+
+            void HashBytes(uint64_t& hash, const void* data, size_t size) {
+                const auto* bytes = static_cast<const uint8_t*>(data);
+                for (size_t i = 0; i < size; ++i) {
+                    hash ^= bytes[i];
+                    hash *= 1099511628211ull;
+                }
+            }
+
+            template <typename T>
+            void HashValue(uint64_t& hash, const T& value) {
+                HashBytes(hash, &value, sizeof(value));
+            }
+
+            void HashString(uint64_t& hash, const std::string& value) {
+                HashValue(hash, value.size());
+                HashBytes(hash, value.data(), value.size());
+            }
+
+            // Bytes a pass touches when it reads or stores the whole resource once
+            uint64_t EstimateResourceBytes(const ResourceDescription& desc) {
+                if (desc.GetType() == ResourceType::Buffer) {
+                    return desc.GetSize();
+                }
+                return static_cast<uint64_t>(desc.GetWidth()) * desc.GetHeight() * ShaderLayout::GetFormatSize(desc.GetFormat());
+            }
+
+            const char* ResourceTypeToString(ResourceType type) {
+                switch (type) {
+                    case ResourceType::Texture: return "texture";
+                    case ResourceType::Buffer: return "buffer";
+                    case ResourceType::Attachment: return "attachment";
+                }
+                return "unknown";
+            }
+
+            // Quoted string for JSON and Graphviz (both use backslash escapes; "\n" breaks Graphviz labels)
+            std::string Quote(const std::string& value) {
+                std::string quoted = "\"";
+                for (char c : value) {
+                    if (c == '\n') {
+                        quoted += "\\n";
+                        continue;
+                    }
+                    if (c == '"' || c == '\\') {
+                        quoted += '\\';
+                    }
+                    quoted += (static_cast<unsigned char>(c) < 0x20) ? ' ' : c;
+                }
+                quoted += '"';
+                return quoted;
+            }
+
+            void HashDescription(uint64_t& hash, const ResourceDescription& desc) {
+                HashValue(hash, desc.GetType());
+                HashValue(hash, desc.GetWidth());
+                HashValue(hash, desc.GetHeight());
+                HashValue(hash, desc.GetFormat());
+                HashValue(hash, desc.HasDepth());
+                HashValue(hash, desc.GetSize());
+                HashValue(hash, desc.GetBufferUsage());
+                HashValue(hash, desc.IsTransient());
+            }
+
+            RHI::ImageDescription BuildImageDescription(const ResourceDescription& desc) {
+                RHI::ImageDescription imageDesc;
+                imageDesc.width = desc.GetWidth();
+                imageDesc.height = desc.GetHeight();
+                imageDesc.format = desc.GetFormat();
+
+                // Determine usage based on resource type and depth flag
+                if (desc.GetType() == ResourceType::Attachment) {
+                    if (desc.HasDepth()) {
+                        imageDesc.usage = RHI::ImageUsageFlags::DepthStencilAttachment;
+                    }
+                    else {
+                        imageDesc.usage = RHI::ImageUsageFlags::ColorAttachment;
+                    }
+                }
+                else {
+                    imageDesc.usage = RHI::ImageUsageFlags::Sampled;
+                }
+                imageDesc.memoryProperties = RHI::MemoryPropertyFlags::DeviceLocal;
+                return imageDesc;
+            }
+
+            // Destroy a resource's image/buffer; deferred: once the frames in flight are done with it
+            void ReleaseRHIObjects(FrameGraphResource* resource, bool deferred) {
+                if (RHI::IImage* image = resource->GetRHIImage()) {
+                    resource->SetRHIResource(static_cast<RHI::IImage*>(nullptr));
+                    if (deferred) {
+                        RenderResourceManager::DeferDelete(std::unique_ptr<RHI::IImage>(image));
+                    } else {
+                        delete image;
+                    }
+                }
+                if (RHI::IBuffer* buffer = resource->GetRHIBuffer()) {
+                    resource->SetRHIResource(static_cast<RHI::IBuffer*>(nullptr));
+                    if (deferred) {
+                        RenderResourceManager::DeferDelete(std::unique_ptr<RHI::IBuffer>(buffer));
+                    } else {
+                        delete buffer;
+                    }
+                }
+            }
+
+            // One transient resource to be placed in a heap; lifetime is [first, last] in execution order
+            struct TransientPlacement {
+                FrameGraphResource* resource = nullptr;
+                FGResourceHandle handle;
+                RHI::MemoryRequirements requirements;
+                uint32_t first = 0;
+                uint32_t last = 0;
+                bool isImage = false;
+                uint64_t offset = 0;
+                bool placed = false;
+            };
+
+            // Interval packing: biggest resources first, each at the lowest aligned offset that doesn't collide with
+            // an already placed resource whose lifetime overlaps its own. Returns the heap size needed.
+            uint64_t PackTransientPlacements(std::vector<TransientPlacement*>& placements) {
+                std::sort(placements.begin(), placements.end(), [](const TransientPlacement* a, const TransientPlacement* b) {
+                    if (a->requirements.size != b->requirements.size) {
+                        return a->requirements.size > b->requirements.size;
+                    }
+                    return a->first < b->first;
+                });
+
+                uint64_t heapSize = 0;
+                std::vector<const TransientPlacement*> packed;
+                std::vector<std::pair<uint64_t, uint64_t>> occupied;
+                for (TransientPlacement* placement : placements) {
+                    occupied.clear();
+                    for (const TransientPlacement* other : packed) {
+                        if (other->first <= placement->last && placement->first <= other->last) {
+                            occupied.emplace_back(other->offset, other->offset + other->requirements.size);
+                        }
+                    }
+                    std::sort(occupied.begin(), occupied.end());
+
+                    uint64_t offset = 0;
+                    for (const auto& [begin, end] : occupied) {
+                        if (AlignUp(offset, placement->requirements.alignment) + placement->requirements.size <= begin) {
+                            break;
+                        }
+                        offset = std::max(offset, end);
+                    }
+                    placement->offset = AlignUp(offset, placement->requirements.alignment);
+                    heapSize = std::max(heapSize, placement->offset + placement->requirements.size);
+                    packed.push_back(placement);
+                }
+                return heapSize;
+            }
+        }
+
         // FrameGraphNode implementation
         FrameGraphNode::FrameGraphNode(const std::string& name, uint32_t index)
             : m_Name(name), m_Index(index), m_Type(RenderPassType::Unknown), m_FrameGraph(nullptr) {
@@ -60,46 +232,71 @@ namespace FirstEngine {
             return nullptr;
         }
 
-        void FrameGraphNode::AddReadResource(const std::string& resourceName, const ResourceDescription* resourceDesc) {
-            m_ReadResources.push_back(resourceName);
+        FGResourceHandle FrameGraphNode::AddReadResource(const std::string& resourceName, const ResourceDescription* resourceDesc) {
+            if (!m_FrameGraph) {
+                std::cerr << "Error: FrameGraphNode::AddReadResource: Node '" << m_Name
+                    << "' is not part of a FrameGraph (resource '" << resourceName << "')" << std::endl;
+                return FGResourceHandle();
+            }
 
-            // If FrameGraph is set and resource description is provided, automatically add and allocate resource
-            // This allows Passes to declare resources they need without manually calling AddResource/AllocateResource
-            if (m_FrameGraph && resourceDesc) {
-                // Check if resource already exists
-                auto* existingResource = m_FrameGraph->GetResource(resourceName);
-                if (!existingResource) {
-                    // Add resource
-                    m_FrameGraph->AddResource(resourceName, *resourceDesc);
-                    // Allocate resource immediately (per-pass resource allocation)
-                    m_FrameGraph->AllocateResource(resourceName);
-                }
+            // If resource description is provided, automatically add the resource
+            // This allows Passes to declare resources they need without manually calling AddResource
+            // Compile allocates it once it knows the pass isn't culled
+            FGResourceHandle handle;
+            if (resourceDesc) {
+                // Adds the resource, or replaces it if the description changed (e.g. after a resize)
+                handle = m_FrameGraph->AddResource(resourceName, *resourceDesc);
+            }
+            else {
+                // Resource should already exist (added by another Pass), or be added later this frame
+                handle = m_FrameGraph->DeclareResource(resourceName);
             }
-            // If resourceDesc is nullptr, resource should already exist (added by another Pass)
+
+            AddReadResource(handle);
+            return handle;
         }
 
-        void FrameGraphNode::AddWriteResource(const std::string& resourceName, const ResourceDescription* resourceDesc) {
+        FGResourceHandle FrameGraphNode::AddWriteResource(const std::string& resourceName, const ResourceDescription* resourceDesc) {
+            if (!m_FrameGraph) {
+                std::cerr << "Error: FrameGraphNode::AddWriteResource: Node '" << m_Name
+                    << "' is not part of a FrameGraph (resource '" << resourceName << "')" << std::endl;
+                return FGResourceHandle();
+            }
+
             // Debug: Check for suspicious resource names
             if (resourceName.length() == 1 && m_WriteResources.size() > 100) {
                 std::cerr << "Warning: Suspicious write resource name detected: '" << resourceName
                     << "' (single character). Current writeResources size: "
                     << m_WriteResources.size() << std::endl;
             }
-            m_WriteResources.push_back(resourceName);
 
-            // If FrameGraph is set and resource description is provided, automatically add and allocate resource
-            // This allows Passes to declare resources they need without manually calling AddResource/AllocateResource
-            if (m_FrameGraph && resourceDesc) {
-                // Check if resource already exists
-                auto* existingResource = m_FrameGraph->GetResource(resourceName);
-                if (!existingResource) {
-                    // Add resource
-                    m_FrameGraph->AddResource(resourceName, *resourceDesc);
-                    // Allocate resource immediately (per-pass resource allocation)
-                    m_FrameGraph->AllocateResource(resourceName);
-                }
+            // If resource description is provided, automatically add the resource
+            // This allows Passes to declare resources they need without manually calling AddResource
+            // Compile allocates it once it knows the pass isn't culled
+            FGResourceHandle handle;
+            if (resourceDesc) {
+                // Adds the resource, or replaces it if the description changed (e.g. after a resize)
+                handle = m_FrameGraph->AddResource(resourceName, *resourceDesc);
+            }
+            else {
+                // Resource should already exist (added by another Pass), or be added later this frame
+                handle = m_FrameGraph->DeclareResource(resourceName);
+            }
+
+            AddWriteResource(handle);
+            return handle;
+        }
+
+        void FrameGraphNode::AddReadResource(FGResourceHandle resource) {
+            if (resource.IsValid()) {
+                m_ReadResources.push_back(resource);
+            }
+        }
+
+        void FrameGraphNode::AddWriteResource(FGResourceHandle resource) {
+            if (resource.IsValid()) {
+                m_WriteResources.push_back(resource);
             }
-            // If resourceDesc is nullptr, resource should already exist (added by another Pass)
         }
 
         void FrameGraphNode::AddDependency(uint32_t nodeIndex) {
@@ -118,8 +315,8 @@ namespace FirstEngine {
             : m_Graph(graph), m_RenderPass(renderPass), m_Framebuffer(framebuffer) {
         }
 
-        RHI::IImage* FrameGraphBuilder::ReadTexture(const std::string& name) {
-            auto* resource = m_Graph->GetResource(name);
+        RHI::IImage* FrameGraphBuilder::ReadTexture(FGResourceHandle handle) {
+            auto* resource = m_Graph->GetResource(handle);
             if (resource) {
                 ResourceType type = resource->GetDescription().GetType();
                 // Both Texture and Attachment resources contain images
@@ -130,16 +327,16 @@ namespace FirstEngine {
             return nullptr;
         }
 
-        RHI::IBuffer* FrameGraphBuilder::ReadBuffer(const std::string& name) {
-            auto* resource = m_Graph->GetResource(name);
+        RHI::IBuffer* FrameGraphBuilder::ReadBuffer(FGResourceHandle handle) {
+            auto* resource = m_Graph->GetResource(handle);
             if (resource && resource->GetDescription().GetType() == ResourceType::Buffer) {
                 return resource->GetRHIBuffer();
             }
             return nullptr;
         }
 
-        RHI::IImage* FrameGraphBuilder::WriteTexture(const std::string& name) {
-            auto* resource = m_Graph->GetResource(name);
+        RHI::IImage* FrameGraphBuilder::WriteTexture(FGResourceHandle handle) {
+            auto* resource = m_Graph->GetResource(handle);
             if (resource) {
                 ResourceType type = resource->GetDescription().GetType();
                 // Both Texture and Attachment resources contain images
@@ -150,22 +347,36 @@ namespace FirstEngine {
             return nullptr;
         }
 
-        RHI::IBuffer* FrameGraphBuilder::WriteBuffer(const std::string& name) {
-            auto* resource = m_Graph->GetResource(name);
+        RHI::IBuffer* FrameGraphBuilder::WriteBuffer(FGResourceHandle handle) {
+            auto* resource = m_Graph->GetResource(handle);
             if (resource && resource->GetDescription().GetType() == ResourceType::Buffer) {
                 return resource->GetRHIBuffer();
             }
             return nullptr;
         }
 
-        std::string FrameGraphBuilder::CreateTexture(const std::string& name, const ResourceDescription& desc) {
-            m_Graph->AddResource(name, desc);
-            return name;
+        RHI::IImage* FrameGraphBuilder::ReadTexture(const std::string& name) {
+            return ReadTexture(m_Graph->FindResource(name));
+        }
+
+        RHI::IBuffer* FrameGraphBuilder::ReadBuffer(const std::string& name) {
+            return ReadBuffer(m_Graph->FindResource(name));
+        }
+
+        RHI::IImage* FrameGraphBuilder::WriteTexture(const std::string& name) {
+            return WriteTexture(m_Graph->FindResource(name));
+        }
+
+        RHI::IBuffer* FrameGraphBuilder::WriteBuffer(const std::string& name) {
+            return WriteBuffer(m_Graph->FindResource(name));
+        }
+
+        FGResourceHandle FrameGraphBuilder::CreateTexture(const std::string& name, const ResourceDescription& desc) {
+            return m_Graph->AddResource(name, desc);
         }
 
-        std::string FrameGraphBuilder::CreateBuffer(const std::string& name, const ResourceDescription& desc) {
-            m_Graph->AddResource(name, desc);
-            return name;
+        FGResourceHandle FrameGraphBuilder::CreateBuffer(const std::string& name, const ResourceDescription& desc) {
+            return m_Graph->AddResource(name, desc);
         }
 
         FrameGraph::FrameGraph(RHI::IDevice* device)
@@ -253,16 +464,40 @@ namespace FirstEngine {
             return node;
         }
 
-        FrameGraphResource* FrameGraph::AddResource(const std::string& name, const ResourceDescription& desc) {
-            auto it = m_Resources.find(name);
-            if (it != m_Resources.end()) {
+        FGResourceHandle FrameGraph::DeclareResource(const std::string& name) {
+            auto it = m_ResourceNameToIndex.find(name);
+            if (it != m_ResourceNameToIndex.end()) {
+                return FGResourceHandle{ it->second };
+            }
+
+            uint32_t index = static_cast<uint32_t>(m_Resources.size());
+            m_Resources.emplace_back();
+            m_ResourceNames.push_back(name);
+            m_ResourceNameToIndex[name] = index;
+            return FGResourceHandle{ index };
+        }
+
+        FGResourceHandle FrameGraph::FindResource(const std::string& name) const {
+            auto it = m_ResourceNameToIndex.find(name);
+            return it != m_ResourceNameToIndex.end() ? FGResourceHandle{ it->second } : FGResourceHandle();
+        }
+
+        const std::string& FrameGraph::GetResourceName(FGResourceHandle handle) const {
+            static const std::string invalidName = "<invalid>";
+            return handle.index < m_ResourceNames.size() ? m_ResourceNames[handle.index] : invalidName;
+        }
+
+        FGResourceHandle FrameGraph::AddResource(const std::string& name, const ResourceDescription& desc) {
+            FGResourceHandle handle = DeclareResource(name);
+            std::unique_ptr<FrameGraphResource>& slot = m_Resources[handle.index];
+            if (slot) {
                 // Resource already exists - check if description has changed
-                auto* existingResource = it->second.get();
+                auto* existingResource = slot.get();
                 const auto& existingDesc = existingResource->GetDescription();
 
                 // Compare resource descriptions to detect changes
                 bool descriptionChanged = false;
-                if (existingDesc.GetType() != desc.GetType()) {
+                if (existingDesc.GetType() != desc.GetType() || existingDesc.IsTransient() != desc.IsTransient()) {
                     descriptionChanged = true;
                 }
                 else if (desc.GetType() == ResourceType::Texture || desc.GetType() == ResourceType::Attachment) {
@@ -282,50 +517,52 @@ namespace FirstEngine {
 
                 if (descriptionChanged) {
                     // Resource description changed - need to recreate
-                    // Release old resource first
-                    ResourceType type = existingDesc.GetType();
-                    if (type == ResourceType::Texture || type == ResourceType::Attachment) {
-                        RHI::IImage* image = existingResource->GetRHIImage();
-                        if (image) {
-                            delete image;
-                            existingResource->SetRHIResource(static_cast<RHI::IImage*>(nullptr));
-                        }
-                    }
-                    else if (type == ResourceType::Buffer) {
-                        RHI::IBuffer* buffer = existingResource->GetRHIBuffer();
-                        if (buffer) {
-                            delete buffer;
-                            existingResource->SetRHIResource(static_cast<RHI::IBuffer*>(nullptr));
-                        }
-                    }
+                    // Release old resource first (frames in flight may still use it)
+                    ReleaseRHIObjects(existingResource, true);
 
-                    // Update description (resource object is reused, only description changes)
+                    // Update description (the handle is kept, only the resource object is replaced)
                     // Note: FrameGraphResource stores description by value, so we need to replace the resource
-                    auto newResource = std::make_unique<FrameGraphResource>(name, desc);
-                    FrameGraphResource* resourcePtr = newResource.get();
-                    m_Resources[name] = std::move(newResource);
-                    return resourcePtr;
-                }
-                else {
-                    // Description unchanged - reuse existing resource
-                    return existingResource;
+                    slot = std::make_unique<FrameGraphResource>(name, desc);
                 }
+                // Description unchanged - reuse existing resource
+                return handle;
             }
 
-            // New resource - create it
-            auto resource = std::make_unique<FrameGraphResource>(name, desc);
-            FrameGraphResource* resourcePtr = resource.get();
-            m_Resources[name] = std::move(resource);
-            return resourcePtr;
+            // New resource (or one that was only declared so far) - create it
+            slot = std::make_unique<FrameGraphResource>(name, desc);
+            return handle;
+        }
+
+        void FrameGraph::MarkOutput(FGResourceHandle handle) {
+            if (handle.IsValid() && !IsOutput(handle)) {
+                m_Outputs.push_back(handle);
+            }
+        }
+
+        bool FrameGraph::IsOutput(FGResourceHandle handle) const {
+            return std::find(m_Outputs.begin(), m_Outputs.end(), handle) != m_Outputs.end();
         }
 
-        bool FrameGraph::AllocateResource(const std::string& resourceName) {
-            auto it = m_Resources.find(resourceName);
-            if (it == m_Resources.end()) {
+        bool FrameGraph::AllocateResource(FGResourceHandle handle) {
+            FrameGraphResource* resource = GetResource(handle);
+            if (!resource) {
                 return false;
             }
 
-            auto* resource = it->second.get();
+            // Transient resources are placed by Compile, once their lifetimes are known
+            if (IsDeferredTransient(resource)) {
+                return true;
+            }
+            return AllocateDedicated(resource);
+        }
+
+        bool FrameGraph::IsDeferredTransient(const FrameGraphResource* resource) const {
+            const auto& desc = resource->GetDescription();
+            return m_TransientAliasing && desc.IsTransient() &&
+                   (desc.GetType() == ResourceType::Attachment || desc.GetType() == ResourceType::Buffer);
+        }
+
+        bool FrameGraph::AllocateDedicated(FrameGraphResource* resource) {
             const auto& desc = resource->GetDescription();
 
             // Check if already allocated
@@ -344,34 +581,16 @@ namespace FirstEngine {
             // Allocate resource
             if (type == ResourceType::Texture || type == ResourceType::Attachment) {
                 // Create image
-                RHI::ImageDescription imageDesc;
-                imageDesc.width = desc.GetWidth();
-                imageDesc.height = desc.GetHeight();
-                imageDesc.format = desc.GetFormat();
-
-                // Determine usage based on resource type and depth flag
-                if (type == ResourceType::Attachment) {
-                    if (desc.HasDepth()) {
-                        imageDesc.usage = RHI::ImageUsageFlags::DepthStencilAttachment;
-                    }
-                    else {
-                        imageDesc.usage = RHI::ImageUsageFlags::ColorAttachment;
-                    }
-                }
-                else {
-                    imageDesc.usage = RHI::ImageUsageFlags::Sampled;
-                }
-                imageDesc.memoryProperties = RHI::MemoryPropertyFlags::DeviceLocal;
-
-                auto image = m_Device->CreateImage(imageDesc);
+                auto image = m_Device->CreateImage(BuildImageDescription(desc));
                 if (!image) {
                     std::cerr << "Error: FrameGraph::AllocateResource: Failed to create image for resource '"
-                        << resourceName << "' (width: " << desc.GetWidth()
+                        << resource->GetName() << "' (width: " << desc.GetWidth()
                         << ", height: " << desc.GetHeight()
                         << ", format: " << static_cast<int>(desc.GetFormat()) << ")" << std::endl;
                     return false;
                 }
 
+                // Store image pointer, FrameGraph manages the lifecycle
                 resource->SetRHIResource(image.release());
             }
             else if (type == ResourceType::Buffer) {
@@ -385,6 +604,7 @@ namespace FirstEngine {
                     return false;
                 }
 
+                // Store buffer pointer, FrameGraph manages the lifecycle
                 resource->SetRHIResource(buffer.release());
             }
 
@@ -396,6 +616,7 @@ namespace FirstEngine {
 
             // Analyze dependencies first
             AnalyzeDependencies();
+            CullPasses();
 
             // Build node plans
             for (const auto& node : m_Nodes) {
@@ -404,14 +625,23 @@ namespace FirstEngine {
                 nodePlan.index = node->GetIndex();
                 nodePlan.type = node->GetType(); // RenderPassType enum
                 nodePlan.typeString = node->GetTypeString(); // String representation
-                nodePlan.readResources = node->GetReadResources();
-                nodePlan.writeResources = node->GetWriteResources();
+                // The plan is serialized, so it refers to resources by name
+                for (FGResourceHandle handle : node->GetReadResources()) {
+                    nodePlan.readResources.push_back(GetResourceName(handle));
+                }
+                for (FGResourceHandle handle : node->GetWriteResources()) {
+                    nodePlan.writeResources.push_back(GetResourceName(handle));
+                }
                 nodePlan.dependencies = node->GetDependencies();
+                nodePlan.culled = node->IsCulled();
                 plan.AddNodePlan(std::move(nodePlan));
             }
 
             // Build resource plans
-            for (const auto& [resourceName, resource] : m_Resources) {
+            for (const auto& resource : m_Resources) {
+                if (!resource) {
+                    continue;
+                }
                 FrameGraphExecutionPlan::ResourcePlan resourcePlan;
                 resourcePlan.name = resource->GetName();
                 const auto& desc = resource->GetDescription();
@@ -439,25 +669,103 @@ namespace FirstEngine {
                     // Fallback: create a basic ResourceDescription
                     resourcePlan.description = std::make_unique<ResourceDescription>(type, desc.GetName());
                 }
+                resourcePlan.description->SetTransient(desc.IsTransient());
 
                 plan.AddResourcePlan(std::move(resourcePlan));
             }
 
             // Calculate execution order (topological sort)
+            // No surviving node depends on a culled one, so dropping them keeps the order valid
             std::vector<uint32_t> executionOrder = TopologicalSort();
+            executionOrder.erase(std::remove_if(executionOrder.begin(), executionOrder.end(), [this](uint32_t index) {
+                return m_Nodes[index]->IsCulled();
+            }), executionOrder.end());
             plan.SetExecutionOrder(executionOrder);
 
             return plan.IsValid();
         }
 
         bool FrameGraph::Compile(const FrameGraphExecutionPlan& plan) {
+            m_CompiledHash = 0;
             if (!plan.IsValid()) {
                 return false;
             }
 
+            // Lifetimes in execution order decide which transient resources can share memory
+            ComputeLifetimes(plan);
+            if (m_TransientAliasing) {
+                PlaceTransientResources(plan);
+            }
+            else if (!m_TransientHeaps.empty()) {
+                // Aliasing was switched off: placed resources get dedicated memory below
+                ReleaseTransientPlacement(true);
+                m_TransientStats = TransientMemoryStats();
+                for (auto& node : m_Nodes) {
+                    node->MarkResourceChanges(true);
+                }
+            }
+
             // Allocate resources based on the execution plan
             // Resources are allocated when needed, not during plan building
-            return AllocateResources();
+            if (!AllocateResources()) {
+                return false;
+            }
+
+            BuildBarriers(plan);
+            EstimatePassBandwidth(plan);
+
+            // Nodes whose attachments didn't change keep their render pass and framebuffer (see Execute)
+            const auto& executionOrder = plan.GetExecutionOrder();
+            m_ExecutionOrder = executionOrder;
+            for (uint32_t position = 0; position < executionOrder.size(); ++position) {
+                FrameGraphNode* node = m_Nodes[executionOrder[position]].get();
+                node->SetCompiledHash(ComputeAttachmentHash(position, node));
+            }
+
+            m_CompiledHash = ComputeStructureHash();
+            return true;
+        }
+
+        uint64_t FrameGraph::ComputeStructureHash() const {
+            uint64_t hash = kHashSeed;
+            HashValue(hash, m_TransientAliasing);
+            HashValue(hash, m_Outputs.size());
+            for (FGResourceHandle output : m_Outputs) {
+                HashValue(hash, output.index);
+            }
+            HashValue(hash, m_Nodes.size());
+            for (const auto& node : m_Nodes) {
+                HashString(hash, node->GetName());
+                HashValue(hash, node->GetType());
+                HashValue(hash, static_cast<bool>(node->GetExecuteCallback()));
+                HashValue(hash, node->HasSideEffects());
+
+                // Edges, with the description of the resource on the other end
+                for (const auto* resources : {&node->GetReadResources(), &node->GetWriteResources()}) {
+                    HashValue(hash, resources->size());
+                    for (FGResourceHandle handle : *resources) {
+                        HashValue(hash, handle.index);
+                        if (const FrameGraphResource* resource = GetResource(handle)) {
+                            HashDescription(hash, resource->GetDescription());
+                        }
+                    }
+                }
+            }
+            return hash;
+        }
+
+        uint64_t FrameGraph::ComputeAttachmentHash(uint32_t position, const FrameGraphNode* node) const {
+            uint64_t hash = kHashSeed;
+            for (FGResourceHandle handle : node->GetWriteResources()) {
+                const FrameGraphResource* resource = GetResource(handle);
+                if (!resource || resource->GetDescription().GetType() != ResourceType::Attachment) {
+                    continue;
+                }
+                HashValue(hash, handle.index);
+                HashDescription(hash, resource->GetDescription());
+                HashValue(hash, GetAttachmentFinalLayout(position, handle));
+            }
+            return hash;
         }
 
         RenderCommandList FrameGraph::Execute(const FrameGraphExecutionPlan& plan, Resources::Scene* scene, const RenderConfig& renderConfig) {
@@ -474,11 +782,12 @@ namespace FirstEngine {
             //   3. Pass SceneRenderCommands to OnDraw() callback
 
             const auto& executionOrder = plan.GetExecutionOrder();
-            for (uint32_t nodeIndex : executionOrder) {
-                auto* node = m_Nodes[nodeIndex].get();
+            for (uint32_t position = 0; position < executionOrder.size(); ++position) {
+                auto* node = m_Nodes[executionOrder[position]].get();
                 if (!node || !node->GetExecuteCallback()) {
                     continue;
                 }
+                auto recordStart = std::chrono::steady_clock::now();
 
                 // Check if we can reuse existing render pass and framebuffer
                 // Only recreate if configuration has changed
@@ -489,6 +798,22 @@ namespace FirstEngine {
                 bool needRecreateRenderPass = true;
                 bool needRecreateFramebuffer = true;
 
+                // Compiled for the same attachments the render pass and framebuffer were created for: reuse them
+                // as they are, without building and comparing a RenderPassDescription
+                bool reuseRenderTargets = node->GetFramebufferHash() != 0 &&
+                                          node->GetFramebufferHash() == node->GetCompiledHash() &&
+                                          !node->HasResourceChanges() &&
+                                          existingRenderPassResource && existingRenderPassResource->IsCreated() &&
+                                          existingFramebufferResource && existingFramebufferResource->IsCreated() &&
+                                          existingRenderPassResource->GetRenderPass() &&
+                                          existingFramebufferResource->GetFramebuffer();
+                if (reuseRenderTargets) {
+                    nodeRenderPass = existingRenderPassResource->GetRenderPass();
+                    nodeFramebuffer = existingFramebufferResource->GetFramebuffer();
+                    needRecreateRenderPass = false;
+                    needRecreateFramebuffer = false;
+                }
+
                 // Create render pass for this node based on its write resources
                 // This render pass will be used for pipeline creation
                 std::vector<RHI::AttachmentDescription> attachments;
@@ -502,30 +827,33 @@ namespace FirstEngine {
                         << " write resources. This is likely a bug." << std::endl;
                     std::cerr << "First 10 write resources: ";
                     for (size_t i = 0; i < std::min(size_t(10), writeResources.size()); ++i) {
-                        std::cerr << "'" << writeResources[i] << "' ";
+                        std::cerr << "'" << GetResourceName(writeResources[i]) << "' ";
                     }
                     std::cerr << std::endl;
                 }
 
-                for (const auto& writeResName : writeResources) {
-                    auto* resource = GetResource(writeResName);
-                    if (resource && resource->GetDescription().GetType() == ResourceType::Attachment) {
-                        const auto& desc = resource->GetDescription();
-                        RHI::AttachmentDescription attachment;
-                        attachment.format = desc.GetFormat();
-                        attachment.samples = 1;
-                        attachment.loadOpClear = true;
-                        attachment.storeOpStore = true;
-                        attachment.stencilLoadOpClear = false;
-                        attachment.stencilStoreOpStore = false;
-                        attachment.initialLayout = RHI::Format::Undefined;
-                        attachment.finalLayout = RHI::Format::Undefined;
+                if (!reuseRenderTargets) {
+                    for (FGResourceHandle writeHandle : writeResources) {
+                        auto* resource = GetResource(writeHandle);
+                        if (resource && resource->GetDescription().GetType() == ResourceType::Attachment) {
+                            const auto& desc = resource->GetDescription();
+                            RHI::AttachmentDescription attachment;
+                            attachment.format = desc.GetFormat();
+                            attachment.samples = 1;
+                            attachment.loadOpClear = true;
+                            attachment.storeOpStore = true;
+                            attachment.stencilLoadOpClear = false;
+                            attachment.stencilStoreOpStore = false;
+                            // Attachments are cleared, so the render pass never has to preserve the old contents
+                            attachment.initialLayout = RHI::ImageLayout::Undefined;
+                            attachment.finalLayout = GetAttachmentFinalLayout(position, writeHandle);
 
-                        if (desc.HasDepth()) {
-                            hasDepth = true;
-                        }
-                        else {
-                            attachments.push_back(attachment);
+                            if (desc.HasDepth()) {
+                                hasDepth = true;
+                            }
+                            else {
+                                attachments.push_back(attachment);
+                            }
                         }
                     }
                 }
@@ -536,8 +864,8 @@ namespace FirstEngine {
                     renderPassDesc.colorAttachments = attachments;
                     if (hasDepth) {
                         // Find depth attachment
-                        for (const auto& writeResName : node->GetWriteResources()) {
-                            auto* resource = GetResource(writeResName);
+                        for (FGResourceHandle writeHandle : writeResources) {
+                            auto* resource = GetResource(writeHandle);
                             if (resource && resource->GetDescription().GetType() == ResourceType::Attachment) {
                                 const auto& desc = resource->GetDescription();
                                 if (desc.HasDepth()) {
@@ -548,8 +876,8 @@ namespace FirstEngine {
                                     depthAttachment.storeOpStore = true;
                                     depthAttachment.stencilLoadOpClear = false;
                                     depthAttachment.stencilStoreOpStore = false;
-                                    depthAttachment.initialLayout = RHI::Format::Undefined;
-                                    depthAttachment.finalLayout = RHI::Format::Undefined;
+                                    depthAttachment.initialLayout = RHI::ImageLayout::Undefined;
+                                    depthAttachment.finalLayout = GetAttachmentFinalLayout(position, writeHandle);
                                     renderPassDesc.depthAttachment = depthAttachment;
                                     renderPassDesc.hasDepthAttachment = true;
                                     break;
@@ -583,7 +911,8 @@ namespace FirstEngine {
                                         if (cached.format != current.format ||
                                             cached.samples != current.samples ||
                                             cached.loadOpClear != current.loadOpClear ||
-                                            cached.storeOpStore != current.storeOpStore) {
+                                            cached.storeOpStore != current.storeOpStore ||
+                                            cached.finalLayout != current.finalLayout) {
                                             configMatches = false;
                                             break;
                                         }
@@ -600,7 +929,8 @@ namespace FirstEngine {
                                         if (cached.format != current.format ||
                                             cached.samples != current.samples ||
                                             cached.loadOpClear != current.loadOpClear ||
-                                            cached.storeOpStore != current.storeOpStore) {
+                                            cached.storeOpStore != current.storeOpStore ||
+                                            cached.finalLayout != current.finalLayout) {
                                             configMatches = false;
                                         }
                                     }
@@ -667,10 +997,10 @@ namespace FirstEngine {
                     uint32_t height = 0;
 
                     // First, collect color attachments (in the same order as attachments vector)
-                    for (const auto& writeResName : writeResources) {
-                        auto* resource = GetResource(writeResName);
+                    for (FGResourceHandle writeHandle : writeResources) {
+                        auto* resource = GetResource(writeHandle);
                         if (!resource) {
-                            std::cerr << "Warning: FrameGraph::Execute: Resource '" << writeResName
+                            std::cerr << "Warning: FrameGraph::Execute: Resource '" << GetResourceName(writeHandle)
                                 << "' not found for node '" << node->GetName() << "'" << std::endl;
                             continue;
                         }
@@ -687,7 +1017,7 @@ namespace FirstEngine {
 
                         RHI::IImage* image = resource->GetRHIImage();
                         if (!image) {
-                            std::cerr << "Warning: FrameGraph::Execute: Resource '" << writeResName
+                            std::cerr << "Warning: FrameGraph::Execute: Resource '" << resource->GetName()
                                 << "' has no RHI Image allocated for node '" << node->GetName() << "'" << std::endl;
                             continue;
                         }
@@ -708,14 +1038,14 @@ namespace FirstEngine {
                         }
                         else {
                             std::cerr << "Warning: FrameGraph::Execute: Failed to create ImageView for resource '"
-                                << writeResName << "' in node '" << node->GetName() << "'" << std::endl;
+                                << resource->GetName() << "' in node '" << node->GetName() << "'" << std::endl;
                         }
                     }
 
                     // Then, collect depth attachment (if exists)
                     if (hasDepth) {
-                        for (const auto& writeResName : writeResources) {
-                            auto* resource = GetResource(writeResName);
+                        for (FGResourceHandle writeHandle : writeResources) {
+                            auto* resource = GetResource(writeHandle);
                             if (!resource) {
                                 continue;
                             }
@@ -728,7 +1058,7 @@ namespace FirstEngine {
                             if (desc.HasDepth()) {
                                 RHI::IImage* image = resource->GetRHIImage();
                                 if (!image) {
-                                    std::cerr << "Warning: FrameGraph::Execute: Depth resource '" << writeResName
+                                    std::cerr << "Warning: FrameGraph::Execute: Depth resource '" << resource->GetName()
                                         << "' has no RHI Image allocated for node '" << node->GetName() << "'" << std::endl;
                                     continue;
                                 }
@@ -743,7 +1073,7 @@ namespace FirstEngine {
                                 }
                                 else {
                                     std::cerr << "Warning: FrameGraph::Execute: Failed to create ImageView for depth resource '"
-                                        << writeResName << "' in node '" << node->GetName() << "'" << std::endl;
+                                        << resource->GetName() << "' in node '" << node->GetName() << "'" << std::endl;
                                 }
                             }
                         }
@@ -770,9 +1100,11 @@ namespace FirstEngine {
                             // Compare framebuffer configuration
                             // Check if width, height, and render pass match
                             // Note: We compare with nodeRenderPass (which may be reused or newly created)
+                            // (HasResourceChanges: the attachments were re-created, e.g. placed in a transient heap)
                             if (existingFramebuffer->GetWidth() == width &&
                                 existingFramebuffer->GetHeight() == height &&
-                                nodeRenderPass != nullptr) {
+                                nodeRenderPass != nullptr &&
+                                !node->HasResourceChanges()) {
                                 // Check if render pass matches
                                 // We need to get the render pass from the existing framebuffer's render pass resource
                                 // For now, we'll assume if width/height match and render pass exists, it's likely the same
@@ -842,62 +1174,36 @@ namespace FirstEngine {
                     // Continue execution but the pass will generate empty command list
                 }
                 
-                // Automatically insert layout transitions based on resource access patterns
-                // This eliminates the need for manual layout transitions in passes
-                // Read resources: transition to SHADER_READ_ONLY_OPTIMAL
-                // Write resources: transition to COLOR_ATTACHMENT_OPTIMAL or DEPTH_STENCIL_ATTACHMENT_OPTIMAL
-                // Note: writeResources is already defined above (line 499), reuse it
-                const auto& readResources = node->GetReadResources();
-                
-                // Create a set of write resource names for quick lookup
-                std::unordered_set<std::string> writeResourceSet(writeResources.begin(), writeResources.end());
-                
-                // Transition read resources to SHADER_READ_ONLY_OPTIMAL
-                // Skip resources that are also write resources (they will be handled in write section)
-                for (const auto& readResName : readResources) {
-                    // If this resource is also a write resource, skip it here
-                    // It will be handled in the write section, and render pass will handle the layout transition
-                    if (writeResourceSet.find(readResName) != writeResourceSet.end()) {
-                        continue;
-                    }
-                    
-                    auto* resource = GetResource(readResName);
-                    if (!resource) continue;
-                    
-                    if (resource->GetDescription().GetType() == ResourceType::Attachment ||
-                        resource->GetDescription().GetType() == ResourceType::Texture) {
-                        RHI::IImage* image = resource->GetRHIImage();
-                        if (image) {
-                            RenderCommand transitionCmd;
-                            transitionCmd.type = RenderCommandType::TransitionImageLayout;
-                            transitionCmd.params.transitionImageLayout.image = image;
-                            transitionCmd.params.transitionImageLayout.formatOld = resource->GetDescription().GetFormat();
-                            transitionCmd.params.transitionImageLayout.formatNew = resource->GetDescription().GetFormat();
-                            transitionCmd.params.transitionImageLayout.mipLevels = 1;
-                            transitionCmd.params.transitionImageLayout.accessMode = RHI::ImageAccessMode::Read;
-                            commandList.AddCommand(transitionCmd);
+                // Barriers derived by Compile: everything this pass waits for goes into one pipeline barrier
+                // (attachment transitions are done by the render pass itself)
+                if (position < m_PassBarriers.size()) {
+                    const PassBarriers& passBarriers = m_PassBarriers[position];
+                    RenderCommand barrierCmd;
+                    barrierCmd.type = RenderCommandType::PipelineBarrier;
+                    RHI::PipelineBarrierDescription& barrier = barrierCmd.params.pipelineBarrier.barrier;
+                    barrier.memoryBarrier = passBarriers.memoryBarrier;
+                    for (const auto& transition : passBarriers.transitions) {
+                        FrameGraphResource* resource = GetResource(transition.resource);
+                        RHI::IImage* image = resource ? resource->GetRHIImage() : nullptr;
+                        if (!image) {
+                            continue;
+                        }
+                        RHI::ImageBarrier imageBarrier;
+                        imageBarrier.image = image;
+                        imageBarrier.oldLayout = transition.fromCurrentLayout ? resource->GetLayout() : transition.oldLayout;
+                        imageBarrier.newLayout = transition.newLayout;
+                        if (transition.fromCurrentLayout && imageBarrier.oldLayout == imageBarrier.newLayout) {
+                            continue;   // Already there since the last frame
                         }
+                        barrier.imageBarriers.push_back(imageBarrier);
+                        resource->SetLayout(transition.newLayout);
                     }
-                }
-                
-                // Transition write resources to appropriate attachment layout
-                // For resources that are both read and write, we only transition to write layout
-                // The render pass will handle the transition from the current layout to attachment layout
-                for (const auto& writeResName : writeResources) {
-                    auto* resource = GetResource(writeResName);
-                    if (!resource) continue;
-                    
-                    if (resource->GetDescription().GetType() == ResourceType::Attachment) {
-                        RHI::IImage* image = resource->GetRHIImage();
-                        if (image) {
-                            RenderCommand transitionCmd;
-                            transitionCmd.type = RenderCommandType::TransitionImageLayout;
-                            transitionCmd.params.transitionImageLayout.image = image;
-                            transitionCmd.params.transitionImageLayout.formatOld = resource->GetDescription().GetFormat();
-                            transitionCmd.params.transitionImageLayout.formatNew = resource->GetDescription().GetFormat();
-                            transitionCmd.params.transitionImageLayout.mipLevels = 1;
-                            transitionCmd.params.transitionImageLayout.accessMode = RHI::ImageAccessMode::Write;
-                            commandList.AddCommand(transitionCmd);
+                    if (!barrier.IsEmpty()) {
+                        commandList.AddCommand(std::move(barrierCmd));
+                    }
+                    for (const auto& attachmentLayout : passBarriers.attachmentLayouts) {
+                        if (FrameGraphResource* resource = GetResource(attachmentLayout.first)) {
+                            resource->SetLayout(attachmentLayout.second);
                         }
                     }
                 }
@@ -995,6 +1301,7 @@ namespace FirstEngine {
                         // Since DoCreate returns true (framebuffer already exists), it will be marked as Created
                     }
                     node->SetFramebufferResource(std::move(framebufferResource));
+                    node->MarkResourceChanges(false);
                 } else if (nodeFramebuffer && existingFramebufferResource) {
                     // Reusing existing framebuffer - ensure device is set
                     if (m_Device && !existingFramebufferResource->GetDevice()) {
@@ -1033,26 +1340,26 @@ namespace FirstEngine {
                     node->SetCachedRenderPassDescription(renderPassDesc);
                 }
 
+                // The render pass and framebuffer now match what the node was compiled for
+                if (nodeRenderPass && nodeFramebuffer) {
+                    node->SetFramebufferHash(node->GetCompiledHash());
+                }
+
                 // Merge node commands into main command list
                 const auto& nodeCmdList = nodeCommands.GetCommands();
                 for (const auto& cmd : nodeCmdList) {
                     commandList.AddCommand(cmd);
                 }
+
+                if (position < m_PassStats.size()) {
+                    m_PassStats[position].cpuRecordMs = std::chrono::duration<double, std::milli>(
+                        std::chrono::steady_clock::now() - recordStart).count();
+                }
             }
 
             return commandList; 
         }
 
-        FrameGraphResource* FrameGraph::GetResource(const std::string& name) {
-            auto it = m_Resources.find(name);
-            return (it != m_Resources.end()) ? it->second.get() : nullptr;
-        }
-
-        const FrameGraphResource* FrameGraph::GetResource(const std::string& name) const {
-            auto it = m_Resources.find(name);
-            return (it != m_Resources.end()) ? it->second.get() : nullptr;
-        }
-
         FrameGraphNode* FrameGraph::GetNode(uint32_t index) {
             if (index < m_Nodes.size()) {
                 return m_Nodes[index].get();
@@ -1079,8 +1386,9 @@ namespace FirstEngine {
             m_Nodes.clear();
             // DO NOT clear m_Resources here - they are reused across frames
             // m_Resources.clear(); // <-- This causes resources to be recreated every frame!
-            m_ResourceNameToIndex.clear();
+            // m_ResourceNameToIndex stays too, so resource handles remain valid across frames
             m_NodeNameToIndex.clear();
+            m_Outputs.clear();
         }
 
         void FrameGraph::MarkRemovedNodesForDestruction() {
@@ -1113,7 +1421,7 @@ namespace FirstEngine {
 
             // Release all allocated RHI resources (Images and Buffers)
             // Resources are managed by unique_ptr, so we need to delete them manually
-            for (auto& [resourceName, resource] : m_Resources) {
+            for (auto& resource : m_Resources) {
                 if (resource) {
                     const auto& desc = resource->GetDescription();
                     ResourceType type = desc.GetType();
@@ -1140,8 +1448,18 @@ namespace FirstEngine {
                 }
             }
 
+            // Transient heaps go after the resources placed in them
+            ReleaseTransientPlacement(false);
+            m_PassBarriers.clear();
+            m_PassStats.clear();
+            m_ExecutionOrder.clear();
+            m_CompiledHash = 0;
+
             // Clear all resources (after releasing RHI objects)
-            m_Resources.clear();
+            // The slots and names are kept: handles stay valid and refer to the resource once it is added again
+            for (auto& resource : m_Resources) {
+                resource.reset();
+            }
 
             // Note: Framebuffers and RenderPasses are now stored in FrameGraphNode
             // They are managed through IRenderResource lifecycle and will be destroyed
@@ -1149,147 +1467,643 @@ namespace FirstEngine {
         }
 
         void FrameGraph::AnalyzeDependencies() {
-
-            for (auto& [resourceName, resource] : m_Resources) {
-                uint32_t firstUse = UINT32_MAX;
-                uint32_t lastUse = 0;
-
-                for (uint32_t i = 0; i < m_Nodes.size(); ++i) {
-                    FrameGraphNode* node = m_Nodes[i].get();
-                    bool used = false;
-
-                    // Check read resources
-                    const std::vector<std::string>& readResources = node->GetReadResources();
-                    for (const std::string& readRes : readResources) {
-                        if (readRes == resourceName) {
-                            used = true;
-                            break;
+            // First and last node using each resource, in declaration order
+            for (auto& resource : m_Resources) {
+                if (resource) {
+                    auto& desc = const_cast<ResourceDescription&>(resource->GetDescription());
+                    desc.SetFirstPass(UINT32_MAX);
+                    desc.SetLastPass(0);
+                }
+            }
+            for (uint32_t i = 0; i < m_Nodes.size(); ++i) {
+                FrameGraphNode* node = m_Nodes[i].get();
+                for (const auto* handles : {&node->GetReadResources(), &node->GetWriteResources()}) {
+                    for (FGResourceHandle handle : *handles) {
+                        if (FrameGraphResource* resource = GetResource(handle)) {
+                            auto& desc = const_cast<ResourceDescription&>(resource->GetDescription());
+                            desc.SetFirstPass(std::min(desc.GetFirstPass(), i));
+                            desc.SetLastPass(std::max(desc.GetLastPass(), i));
                         }
                     }
+                }
+            }
 
-                    // Check write resources
-                    if (!used) {
-                        const std::vector<std::string>& writeResources = node->GetWriteResources();
-                        for (const std::string& writeRes : writeResources) {
-                            if (writeRes == resourceName) {
-                                used = true;
-                                break;
-                            }
+            // Build dependencies between nodes
+            for (uint32_t i = 0; i < m_Nodes.size(); ++i) {
+                auto* node = m_Nodes[i].get();
+
+                // For each written resource, find all subsequent nodes that read it
+                for (FGResourceHandle writeHandle : node->GetWriteResources()) {
+                    if (!GetResource(writeHandle)) {
+                        continue;
+                    }
+                    for (uint32_t j = i + 1; j < m_Nodes.size(); ++j) {
+                        auto* otherNode = m_Nodes[j].get();
+                        if (Contains(otherNode->GetReadResources(), writeHandle)) {
+                            otherNode->AddDependency(i);
                         }
                     }
+                }
+            }
+        }
 
-                    if (used) {
-                        firstUse = std::min(firstUse, i);
-                        lastUse = std::max(lastUse, i);
-                    }
+        bool FrameGraph::AllocateResources() {
+            // Allocate actual RHI resources for each resource
+            // Note: Resources may have already been allocated by individual Passes or placed in a transient heap
+            // AllocateDedicated skips already-allocated resources
+            for (auto& resource : m_Resources) {
+                if (!resource) {
+                    continue;   // Declared, but no pass added it with a description
+                }
+                // Resources nothing executed uses this frame (e.g. only by culled passes) don't need memory until
+                // they are used again
+                if (resource->GetDescription().GetFirstPass() == UINT32_MAX) {
+                    continue;
                 }
 
-                // Update resource description
+                if (!AllocateDedicated(resource.get())) {
+                    return false;
+                }
+            }
 
-                auto& desc = const_cast<ResourceDescription&>(resource->GetDescription());
-                desc.SetFirstPass(firstUse);
-                desc.SetLastPass(lastUse);
+            return true;
+        }
+
+        void FrameGraph::SetTransientAliasing(bool enabled) {
+            // Takes effect at the next Compile (placed resources are swapped for dedicated ones there)
+            m_TransientAliasing = enabled;
+        }
+
+        void FrameGraph::ComputeLifetimes(const FrameGraphExecutionPlan& plan) {
+            for (auto& resource : m_Resources) {
+                if (resource) {
+                    auto& desc = const_cast<ResourceDescription&>(resource->GetDescription());
+                    desc.SetFirstPass(UINT32_MAX);
+                    desc.SetLastPass(0);
+                }
             }
 
-            // Build dependencies between nodes
-            for (uint32_t i = 0; i < m_Nodes.size(); ++i) {
-                auto* node = m_Nodes[i].get();
+            const auto& executionOrder = plan.GetExecutionOrder();
+            for (uint32_t position = 0; position < executionOrder.size(); ++position) {
+                const FrameGraphNode* node = GetNode(executionOrder[position]);
+                if (!node) {
+                    continue;
+                }
 
-                // For each written resource, find the last node that wrote to it
-                for (const auto& writeRes : node->GetWriteResources()) {
-                    auto* resource = GetResource(writeRes);
-                    if (resource) {
-                        // Find all subsequent nodes that read this resource
-                        for (uint32_t j = i + 1; j < m_Nodes.size(); ++j) {
-                            auto* otherNode = m_Nodes[j].get();
-                            for (const auto& readRes : otherNode->GetReadResources()) {
-                                if (readRes == writeRes) {
-                                    otherNode->AddDependency(i);
-                                    break;
-                                }
-                            }
+                for (const auto* handles : {&node->GetReadResources(), &node->GetWriteResources()}) {
+                    for (FGResourceHandle handle : *handles) {
+                        FrameGraphResource* resource = GetResource(handle);
+                        if (!resource) {
+                            continue;
                         }
+                        auto& desc = const_cast<ResourceDescription&>(resource->GetDescription());
+                        desc.SetFirstPass(std::min(desc.GetFirstPass(), position));
+                        desc.SetLastPass(std::max(desc.GetLastPass(), position));
                     }
                 }
             }
         }
 
-        bool FrameGraph::AllocateResources() {
-            // Allocate actual RHI resources for each resource
-            // Note: Resources may have already been allocated by individual Passes
-            // This method will skip already-allocated resources
-            for (auto& [resourceName, resource] : m_Resources) {
+        void FrameGraph::PlaceTransientResources(const FrameGraphExecutionPlan& plan) {
+            const auto& executionOrder = plan.GetExecutionOrder();
+
+            // Collect the resources whose memory may be shared
+            std::vector<TransientPlacement> placements;
+            for (uint32_t index = 0; index < m_Resources.size(); ++index) {
+                FrameGraphResource* resource = m_Resources[index].get();
+                const FGResourceHandle handle{ index };
+                if (!resource || !IsDeferredTransient(resource)) {
+                    continue;
+                }
                 const auto& desc = resource->GetDescription();
-                ResourceType type = desc.GetType();
+                if (desc.GetFirstPass() == UINT32_MAX) {
+                    continue;
+                }
 
-                // Check if already allocated
-                bool alreadyAllocated = false;
-                if (type == ResourceType::Texture || type == ResourceType::Attachment) {
-                    if (resource->GetRHIImage() != nullptr) {
-                        alreadyAllocated = true;
+                // Contents must be produced this frame: the first pass using it writes without reading it
+                const FrameGraphNode* firstNode = GetNode(executionOrder[desc.GetFirstPass()]);
+                if (!firstNode || !Contains(firstNode->GetWriteResources(), handle) ||
+                    Contains(firstNode->GetReadResources(), handle)) {
+                    continue;
+                }
+
+                // Never read inside the graph: an output used after the frame graph, keep it intact
+                bool hasReader = false;
+                for (uint32_t position = desc.GetFirstPass() + 1; position <= desc.GetLastPass() && !hasReader; ++position) {
+                    const FrameGraphNode* node = GetNode(executionOrder[position]);
+                    hasReader = node && Contains(node->GetReadResources(), handle);
+                }
+                if (!hasReader) {
+                    continue;
+                }
+
+                TransientPlacement placement;
+                placement.resource = resource;
+                placement.handle = handle;
+                placement.first = desc.GetFirstPass();
+                placement.last = desc.GetLastPass();
+                placement.isImage = desc.GetType() == ResourceType::Attachment;
+                placements.push_back(placement);
+            }
+            std::sort(placements.begin(), placements.end(), [](const TransientPlacement& a, const TransientPlacement& b) {
+                return a.resource->GetName() < b.resource->GetName();
+            });
+
+            // Same resources with the same lifetimes as last time: keep the current placement
+            std::ostringstream key;
+            for (const TransientPlacement& placement : placements) {
+                const auto& desc = placement.resource->GetDescription();
+                key << placement.resource->GetName() << ':' << static_cast<int>(desc.GetType()) << ','
+                    << desc.GetWidth() << 'x' << desc.GetHeight() << ',' << static_cast<int>(desc.GetFormat()) << ','
+                    << desc.HasDepth() << ',' << desc.GetSize() << ',' << static_cast<uint32_t>(desc.GetBufferUsage())
+                    << ",[" << placement.first << ',' << placement.last << "];";
+            }
+            bool placementIntact = true;
+            for (FGResourceHandle handle : m_AliasedResources) {
+                const FrameGraphResource* resource = GetResource(handle);
+                if (!resource || !resource->IsAliased()) {
+                    placementIntact = false;
+                    break;
+                }
+            }
+            if (placementIntact && key.str() == m_TransientLayoutKey) {
+                return;
+            }
+
+            ReleaseTransientPlacement(true);
+            m_TransientLayoutKey = key.str();
+            m_TransientStats = TransientMemoryStats();
+            m_TransientStats.resourceCount = static_cast<uint32_t>(placements.size());
+
+            for (TransientPlacement& placement : placements) {
+                const auto& desc = placement.resource->GetDescription();
+                placement.requirements = placement.isImage
+                    ? m_Device->GetImageMemoryRequirements(BuildImageDescription(desc))
+                    : m_Device->GetBufferMemoryRequirements(desc.GetSize(), desc.GetBufferUsage());
+                m_TransientStats.bytesWithoutAliasing += placement.requirements.size;
+            }
+            for (uint32_t position = 0; position < executionOrder.size(); ++position) {
+                uint64_t liveBytes = 0;
+                for (const TransientPlacement& placement : placements) {
+                    if (placement.first <= position && position <= placement.last) {
+                        liveBytes += placement.requirements.size;
                     }
                 }
-                else if (type == ResourceType::Buffer) {
-                    if (resource->GetRHIBuffer() != nullptr) {
-                        alreadyAllocated = true;
+                m_TransientStats.peakLiveBytes = std::max(m_TransientStats.peakLiveBytes, liveBytes);
+            }
+
+            // Images and buffers get separate heaps (they must not share bufferImageGranularity pages)
+            uint64_t heapBytes = 0;
+            for (bool images : {true, false}) {
+                std::vector<TransientPlacement*> group;
+                uint32_t memoryTypeBits = ~0u;
+                uint64_t separateBytes = 0;
+                for (TransientPlacement& placement : placements) {
+                    if (placement.isImage != images || placement.requirements.size == 0) {
+                        continue;
                     }
+                    // No memory type in common with the rest of the heap: keeps its own allocation
+                    if ((memoryTypeBits & placement.requirements.memoryTypeBits) == 0) {
+                        continue;
+                    }
+                    memoryTypeBits &= placement.requirements.memoryTypeBits;
+                    separateBytes += placement.requirements.size;
+                    group.push_back(&placement);
+                }
+                if (group.size() < 2) {
+                    continue;
                 }
 
-                if (alreadyAllocated) {
-                    continue; // Skip already allocated resources
+                uint64_t heapSize = PackTransientPlacements(group);
+                if (heapSize >= separateBytes) {
+                    continue; // All lifetimes overlap, nothing to share
                 }
 
-                // Allocate resource
-                if (type == ResourceType::Texture || type == ResourceType::Attachment) {
-                    // Create image
-                    RHI::ImageDescription imageDesc;
-                    imageDesc.width = desc.GetWidth();
-                    imageDesc.height = desc.GetHeight();
-                    imageDesc.format = desc.GetFormat();
-
-                    // Determine usage based on resource type and depth flag
-                    if (type == ResourceType::Attachment) {
-                        if (desc.HasDepth()) {
-                            imageDesc.usage = RHI::ImageUsageFlags::DepthStencilAttachment;
+                RHI::MemoryHeapHandle heap = m_Device->CreateMemoryHeap(heapSize, memoryTypeBits,
+                                                                        RHI::MemoryPropertyFlags::DeviceLocal);
+                if (!heap) {
+                    std::cerr << "Warning: FrameGraph: Failed to create " << heapSize
+                              << " byte transient heap, using dedicated allocations" << std::endl;
+                    continue;
+                }
+                m_TransientHeaps.push_back(heap);
+                heapBytes += heapSize;
+
+                for (TransientPlacement* placement : group) {
+                    FrameGraphResource* resource = placement->resource;
+                    const auto& desc = resource->GetDescription();
+
+                    // A dedicated allocation from before is replaced by the placed one
+                    ReleaseRHIObjects(resource, true);
+                    if (placement->isImage) {
+                        auto image = m_Device->CreatePlacedImage(BuildImageDescription(desc), heap, placement->offset);
+                        if (image) {
+                            resource->SetRHIResource(image.release());
                         }
-                        else {
-                            imageDesc.usage = RHI::ImageUsageFlags::ColorAttachment;
+                    } else {
+                        auto buffer = m_Device->CreatePlacedBuffer(desc.GetSize(), desc.GetBufferUsage(), heap,
+                                                                   placement->offset);
+                        if (buffer) {
+                            resource->SetRHIResource(buffer.release());
                         }
                     }
-                    else {
-                        imageDesc.usage = RHI::ImageUsageFlags::Sampled;
+                    if (!resource->GetRHIImage() && !resource->GetRHIBuffer()) {
+                        // AllocateResources gives it dedicated memory instead
+                        std::cerr << "Warning: FrameGraph: Failed to place transient resource '"
+                                  << resource->GetName() << "'" << std::endl;
+                        continue;
+                    }
+
+                    resource->SetAliased(true);
+                    placement->placed = true;
+                    m_AliasedResources.push_back(placement->handle);
+                }
+            }
+
+            m_TransientStats.heapCount = static_cast<uint32_t>(m_TransientHeaps.size());
+            m_TransientStats.aliasedCount = static_cast<uint32_t>(m_AliasedResources.size());
+            m_TransientStats.bytesWithAliasing = heapBytes;
+            for (const TransientPlacement& placement : placements) {
+                if (!placement.placed) {
+                    m_TransientStats.bytesWithAliasing += placement.requirements.size;
+                }
+            }
+
+            // Framebuffers hold views of the old images
+            for (auto& node : m_Nodes) {
+                node->MarkResourceChanges(true);
+            }
+
+            std::cout << "FrameGraph: transient memory " << m_TransientStats.bytesWithoutAliasing / 1024 << " KB -> "
+                      << m_TransientStats.bytesWithAliasing / 1024 << " KB (" << m_TransientStats.aliasedCount << " of "
+                      << m_TransientStats.resourceCount << " resources aliased in " << m_TransientStats.heapCount
+                      << " heaps, peak live " << m_TransientStats.peakLiveBytes / 1024 << " KB)" << std::endl;
+        }
+
+        void FrameGraph::ReleaseTransientPlacement(bool deferred) {
+            for (FGResourceHandle handle : m_AliasedResources) {
+                FrameGraphResource* resource = GetResource(handle);
+                if (resource && resource->IsAliased()) {
+                    ReleaseRHIObjects(resource, deferred);
+                    resource->SetAliased(false);
+                }
+            }
+            m_AliasedResources.clear();
+
+            // Heaps go after everything placed in them (deferred destructions run in order)
+            RHI::IDevice* device = m_Device;
+            for (RHI::MemoryHeapHandle heap : m_TransientHeaps) {
+                if (deferred) {
+                    RenderResourceManager::DeferDestruction([device, heap]() { device->DestroyMemoryHeap(heap); });
+                } else {
+                    device->DestroyMemoryHeap(heap);
+                }
+            }
+            m_TransientHeaps.clear();
+            m_TransientLayoutKey.clear();
+        }
+
+        void FrameGraph::BuildBarriers(const FrameGraphExecutionPlan& plan) {
+            const auto& executionOrder = plan.GetExecutionOrder();
+            m_PassBarriers.assign(executionOrder.size(), PassBarriers());
+            m_BarrierStats = BarrierStats();
+
+            // State of each resource after the passes visited so far
+            struct ResourceState {
+                RHI::ImageLayout layout = RHI::ImageLayout::Undefined;
+                bool used = false;                  // Accessed by an earlier pass this frame
+                bool written = false;               // The last access was a write
+                uint32_t writerPosition = UINT32_MAX; // Render pass that wrote it last, while its finalLayout is free
+            };
+            std::vector<ResourceState> states(m_Resources.size());
+
+            for (uint32_t position = 0; position < executionOrder.size(); ++position) {
+                const FrameGraphNode* node = m_Nodes[executionOrder[position]].get();
+                if (!node || !node->GetExecuteCallback()) {
+                    continue;   // Not executed, so it doesn't access anything
+                }
+                PassBarriers& pass = m_PassBarriers[position];
+
+                // A resource both read and written by the pass counts as written
+                const auto& writeResources = node->GetWriteResources();
+                std::vector<std::pair<FGResourceHandle, bool>> accesses;
+                for (FGResourceHandle handle : writeResources) {
+                    accesses.emplace_back(handle, true);
+                }
+                for (FGResourceHandle handle : node->GetReadResources()) {
+                    if (!Contains(writeResources, handle)) {
+                        accesses.emplace_back(handle, false);
                     }
-                    imageDesc.memoryProperties = RHI::MemoryPropertyFlags::DeviceLocal;
-
-                    auto image = m_Device->CreateImage(imageDesc);
-                    if (!image) {
-                        std::cerr << "Error: FrameGraph::AllocateResources: Failed to create image for resource '"
-                            << resourceName << "' (width: " << desc.GetWidth()
-                            << ", height: " << desc.GetHeight()
-                            << ", format: " << static_cast<int>(desc.GetFormat()) << ")" << std::endl;
-                        return false;
+                }
+
+                for (const auto& access : accesses) {
+                    const FGResourceHandle handle = access.first;
+                    FrameGraphResource* resource = GetResource(handle);
+                    if (!resource) {
+                        continue;
+                    }
+                    const bool write = access.second;
+                    const ResourceDescription& desc = resource->GetDescription();
+                    ResourceState& state = states[handle.index];
+                    const bool firstUse = !state.used;
+
+                    // Memory that belonged to another transient resource until now
+                    if (firstUse && resource->IsAliased()) {
+                        pass.memoryBarrier = true;
                     }
 
-                    // Store image pointer, FrameGraph manages the lifecycle
-                    resource->SetRHIResource(image.release());
+                    if (desc.GetType() == ResourceType::Buffer) {
+                        // No layouts: only read-after-read is free
+                        if (!firstUse && (state.written || write)) {
+                            pass.memoryBarrier = true;
+                        }
+                        state.used = true;
+                        state.written = write;
+                        continue;
+                    }
+
+                    const bool attachmentWrite = write && desc.GetType() == ResourceType::Attachment;
+                    RHI::ImageLayout layout = RHI::ImageLayout::ShaderReadOnly;
+                    if (attachmentWrite) {
+                        layout = desc.HasDepth() ? RHI::ImageLayout::DepthStencilAttachment : RHI::ImageLayout::ColorAttachment;
+                    }
+                    else if (write) {
+                        layout = RHI::ImageLayout::TransferDst;
+                    }
+
+                    if (attachmentWrite) {
+                        // The attachment is cleared: the render pass starts from UNDEFINED, and its external
+                        // dependency orders the write after everything before it
+                        if (firstUse || state.layout != layout) {
+                            m_BarrierStats.foldedTransitions++;
+                        }
+                        pass.attachmentLayouts.emplace_back(handle, layout);
+                    }
+                    else if (state.writerPosition != UINT32_MAX && layout == RHI::ImageLayout::ShaderReadOnly) {
+                        // First read after a render pass wrote it: the writer ends in SHADER_READ_ONLY instead
+                        for (auto& attachmentLayout : m_PassBarriers[state.writerPosition].attachmentLayouts) {
+                            if (attachmentLayout.first == handle) {
+                                attachmentLayout.second = layout;
+                            }
+                        }
+                        m_BarrierStats.foldedTransitions++;
+                    }
+                    else if (firstUse || state.layout != layout || state.written || write) {
+                        CompiledTransition transition;
+                        transition.resource = handle;
+                        transition.oldLayout = state.layout;
+                        transition.newLayout = layout;
+                        transition.fromCurrentLayout = firstUse;
+                        pass.transitions.push_back(transition);
+                    }
+
+                    state.layout = layout;
+                    state.used = true;
+                    state.written = write;
+                    state.writerPosition = attachmentWrite ? position : UINT32_MAX;
                 }
-                else if (type == ResourceType::Buffer) {
-                    // Create buffer
-                    auto buffer = m_Device->CreateBuffer(
-                        desc.GetSize(),
-                        desc.GetBufferUsage(),
-                        RHI::MemoryPropertyFlags::DeviceLocal
-                    );
-                    if (!buffer) {
-                        return false;
+
+                if (!pass.transitions.empty() || pass.memoryBarrier) {
+                    m_BarrierStats.pipelineBarriers++;
+                }
+                m_BarrierStats.imageBarriers += static_cast<uint32_t>(pass.transitions.size());
+                m_BarrierStats.memoryBarriers += pass.memoryBarrier ? 1 : 0;
+            }
+        }
+
+        RHI::ImageLayout FrameGraph::GetAttachmentFinalLayout(uint32_t position, FGResourceHandle handle) const {
+            if (position < m_PassBarriers.size()) {
+                for (const auto& attachmentLayout : m_PassBarriers[position].attachmentLayouts) {
+                    if (attachmentLayout.first == handle) {
+                        return attachmentLayout.second;
                     }
+                }
+            }
+            const FrameGraphResource* resource = GetResource(handle);
+            return resource && resource->GetDescription().HasDepth() ? RHI::ImageLayout::DepthStencilAttachment
+                                                                      : RHI::ImageLayout::ColorAttachment;
+        }
+
+        void FrameGraph::CullPasses() {
+            for (auto& node : m_Nodes) {
+                node->SetCulled(false);
+            }
+            if (m_Outputs.empty()) {
+                return;
+            }
 
-                    // Store buffer pointer, FrameGraph manages the lifecycle
-                    resource->SetRHIResource(buffer.release());
+            // Reference count of each resource: one per output, plus one per surviving pass reading it
+            // Walking back in declaration order (readers come after writers), a pass survives if it has side
+            // effects or writes a resource that is still referenced; the resources it reads gain a reference.
+            std::vector<uint32_t> refCounts(m_Resources.size(), 0);
+            for (FGResourceHandle output : m_Outputs) {
+                if (output.index < refCounts.size()) {
+                    refCounts[output.index]++;
                 }
             }
 
-            return true;
+            for (uint32_t i = static_cast<uint32_t>(m_Nodes.size()); i-- > 0;) {
+                FrameGraphNode* node = m_Nodes[i].get();
+                bool needed = node->HasSideEffects();
+                for (FGResourceHandle handle : node->GetWriteResources()) {
+                    needed = needed || refCounts[handle.index] > 0;
+                }
+                if (!needed) {
+                    node->SetCulled(true);
+                    continue;
+                }
+                for (FGResourceHandle handle : node->GetReadResources()) {
+                    refCounts[handle.index]++;
+                }
+            }
+        }
+
+        void FrameGraph::EstimatePassBandwidth(const FrameGraphExecutionPlan& plan) {
+            const auto& executionOrder = plan.GetExecutionOrder();
+            m_PassStats.assign(executionOrder.size(), PassStats());
+
+            // Attachments are cleared, not loaded, so a write is one store; a read touches the whole resource
+            for (uint32_t position = 0; position < executionOrder.size(); ++position) {
+                const FrameGraphNode* node = GetNode(executionOrder[position]);
+                if (!node || !node->GetExecuteCallback()) {
+                    continue;
+                }
+                for (const auto* handles : {&node->GetReadResources(), &node->GetWriteResources()}) {
+                    for (FGResourceHandle handle : *handles) {
+                        if (const FrameGraphResource* resource = GetResource(handle)) {
+                            m_PassStats[position].estimatedBytes += EstimateResourceBytes(resource->GetDescription());
+                        }
+                    }
+                }
+            }
+        }
+
+        std::string FrameGraph::ExportGraphviz() const {
+            // Execution position of each node (UINT32_MAX: culled or not compiled)
+            std::vector<uint32_t> positions(m_Nodes.size(), UINT32_MAX);
+            for (uint32_t position = 0; position < m_ExecutionOrder.size(); ++position) {
+                if (m_ExecutionOrder[position] < positions.size()) {
+                    positions[m_ExecutionOrder[position]] = position;
+                }
+            }
+            std::vector<bool> referenced(m_Resources.size(), false);
+
+            std::ostringstream dot;
+            dot << std::fixed << std::setprecision(3);
+            dot << "digraph FrameGraph {\n";
+            dot << "    rankdir=LR;\n";
+            dot << "    node [fontname=\"Helvetica\", fontsize=10];\n";
+
+            for (uint32_t i = 0; i < m_Nodes.size(); ++i) {
+                const FrameGraphNode* node = m_Nodes[i].get();
+                std::ostringstream label;
+                label << std::fixed << std::setprecision(3) << node->GetName() << "\n" << node->GetTypeString();
+                if (positions[i] != UINT32_MAX && positions[i] < m_PassStats.size()) {
+                    const PassStats& stats = m_PassStats[positions[i]];
+                    label << "\n#" << positions[i] << "  " << stats.cpuRecordMs << " ms  "
+                          << stats.estimatedBytes / 1024 << " KB";
+                }
+                else if (node->IsCulled()) {
+                    label << "\nculled";
+                }
+                dot << "    pass" << i << " [shape=box, label=" << Quote(label.str());
+                if (node->IsCulled()) {
+                    dot << ", style=dashed, color=gray50, fontcolor=gray50";
+                }
+                dot << "];\n";
+
+                for (FGResourceHandle handle : node->GetReadResources()) {
+                    referenced[handle.index] = true;
+                    dot << "    res" << handle.index << " -> pass" << i << ";\n";
+                }
+                for (FGResourceHandle handle : node->GetWriteResources()) {
+                    referenced[handle.index] = true;
+                    dot << "    pass" << i << " -> res" << handle.index << " [color=firebrick];\n";
+                }
+            }
+            for (FGResourceHandle output : m_Outputs) {
+                referenced[output.index] = true;
+            }
+
+            for (uint32_t index = 0; index < m_Resources.size(); ++index) {
+                if (!referenced[index]) {
+                    continue;
+                }
+                const FrameGraphResource* resource = m_Resources[index].get();
+                std::ostringstream label;
+                label << m_ResourceNames[index];
+                if (resource) {
+                    const auto& desc = resource->GetDescription();
+                    if (desc.GetType() == ResourceType::Buffer) {
+                        label << "\n" << desc.GetSize() / 1024 << " KB";
+                    } else {
+                        label << "\n" << desc.GetWidth() << "x" << desc.GetHeight() << " fmt " << static_cast<uint32_t>(desc.GetFormat());
+                    }
+                    if (desc.GetFirstPass() != UINT32_MAX) {
+                        label << "\n[" << desc.GetFirstPass() << ", " << desc.GetLastPass() << "]";
+                    }
+                    if (desc.IsTransient()) {
+                        label << (resource->IsAliased() ? " aliased" : " transient");
+                    }
+                }
+                dot << "    res" << index << " [shape=ellipse, label=" << Quote(label.str());
+                if (IsOutput(FGResourceHandle{ index })) {
+                    dot << ", peripheries=2";
+                }
+                dot << "];\n";
+            }
+
+            dot << "}\n";
+            return dot.str();
+        }
+
+        std::string FrameGraph::ExportJson() const {
+            std::vector<uint32_t> positions(m_Nodes.size(), UINT32_MAX);
+            for (uint32_t position = 0; position < m_ExecutionOrder.size(); ++position) {
+                if (m_ExecutionOrder[position] < positions.size()) {
+                    positions[m_ExecutionOrder[position]] = position;
+                }
+            }
+            std::vector<bool> referenced(m_Resources.size(), false);
+
+            std::ostringstream json;
+            json << std::fixed << std::setprecision(3);
+            json << "{\n  \"passes\": [";
+            for (uint32_t i = 0; i < m_Nodes.size(); ++i) {
+                const FrameGraphNode* node = m_Nodes[i].get();
+                const bool executed = positions[i] != UINT32_MAX && positions[i] < m_PassStats.size();
+                json << (i ? "," : "") << "\n    {\"name\": " << Quote(node->GetName())
+                     << ", \"type\": " << Quote(node->GetTypeString())
+                     << ", \"position\": " << (executed ? static_cast<int64_t>(positions[i]) : -1)
+                     << ", \"culled\": " << (node->IsCulled() ? "true" : "false")
+                     << ", \"sideEffects\": " << (node->HasSideEffects() ? "true" : "false")
+                     << ", \"cpuRecordMs\": " << (executed ? m_PassStats[positions[i]].cpuRecordMs : 0.0)
+                     << ", \"estimatedBytes\": " << (executed ? m_PassStats[positions[i]].estimatedBytes : 0);
+
+                const char* separator = "";
+                json << ", \"reads\": [";
+                for (FGResourceHandle handle : node->GetReadResources()) {
+                    referenced[handle.index] = true;
+                    json << separator << Quote(GetResourceName(handle));
+                    separator = ", ";
+                }
+                separator = "";
+                json << "], \"writes\": [";
+                for (FGResourceHandle handle : node->GetWriteResources()) {
+                    referenced[handle.index] = true;
+                    json << separator << Quote(GetResourceName(handle));
+                    separator = ", ";
+                }
+                json << "]}";
+            }
+            for (FGResourceHandle output : m_Outputs) {
+                referenced[output.index] = true;
+            }
+
+            json << "\n  ],\n  \"resources\": [";
+            const char* separator = "";
+            for (uint32_t index = 0; index < m_Resources.size(); ++index) {
+                const FrameGraphResource* resource = m_Resources[index].get();
+                if (!referenced[index] || !resource) {
+                    continue;
+                }
+                const auto& desc = resource->GetDescription();
+                const bool used = desc.GetFirstPass() != UINT32_MAX;
+                json << separator << "\n    {\"name\": " << Quote(m_ResourceNames[index])
+                     << ", \"type\": \"" << ResourceTypeToString(desc.GetType()) << "\""
+                     << ", \"width\": " << desc.GetWidth() << ", \"height\": " << desc.GetHeight()
+                     << ", \"format\": " << static_cast<uint32_t>(desc.GetFormat())
+                     << ", \"size\": " << desc.GetSize()
+                     << ", \"bytes\": " << EstimateResourceBytes(desc)
+                     << ", \"transient\": " << (desc.IsTransient() ? "true" : "false")
+                     << ", \"aliased\": " << (resource->IsAliased() ? "true" : "false")
+                     << ", \"output\": " << (IsOutput(FGResourceHandle{ index }) ? "true" : "false")
+                     << ", \"firstPass\": " << (used ? static_cast<int64_t>(desc.GetFirstPass()) : -1)
+                     << ", \"lastPass\": " << (used ? static_cast<int64_t>(desc.GetLastPass()) : -1) << "}";
+                separator = ",";
+            }
+
+            json << "\n  ],\n  \"transientMemory\": {\"bytesWithoutAliasing\": " << m_TransientStats.bytesWithoutAliasing
+                 << ", \"bytesWithAliasing\": " << m_TransientStats.bytesWithAliasing
+                 << ", \"peakLiveBytes\": " << m_TransientStats.peakLiveBytes
+                 << ", \"heapCount\": " << m_TransientStats.heapCount << "},\n";
+            json << "  \"barriers\": {\"pipelineBarriers\": " << m_BarrierStats.pipelineBarriers
+                 << ", \"imageBarriers\": " << m_BarrierStats.imageBarriers
+                 << ", \"memoryBarriers\": " << m_BarrierStats.memoryBarriers
+                 << ", \"foldedTransitions\": " << m_BarrierStats.foldedTransitions << "}\n}\n";
+            return json.str();
+        }
+
+        bool FrameGraph::ExportToFile(const std::string& path) const {
+            std::ofstream file(path);
+            if (!file.is_open()) {
+                std::cerr << "FrameGraph::ExportToFile: Failed to open '" << path << "'" << std::endl;
+                return false;
+            }
+
+            const bool json = path.size() >= 5 && path.compare(path.size() - 5, 5, ".json") == 0;
+            file << (json ? ExportJson() : ExportGraphviz());
+            return file.good();
         }
 
         std::vector<uint32_t> FrameGraph::TopologicalSort() {
@@ -159,14 +159,18 @@ namespace FirstEngine {
         }
 
         bool FrameGraphExecutionPlan::IsValid() const {
-            // Check if execution order matches node count
-            if (m_ExecutionOrder.size() != m_NodePlans.size()) {
+            // Check if execution order covers every node that isn't culled
+            size_t executedCount = 0;
+            for (const auto& nodePlan : m_NodePlans) {
+                executedCount += nodePlan.culled ? 0 : 1;
+            }
+            if (m_ExecutionOrder.size() != executedCount) {
                 return false;
             }
 
             // Check if all nodes in execution order are valid
             for (uint32_t index : m_ExecutionOrder) {
-                if (index >= m_NodePlans.size()) {
+                if (index >= m_NodePlans.size() || m_NodePlans[index].culled) {
                     return false;
                 }
             }
@@ -1,4 +1,6 @@
 #include "FirstEngine/Renderer/FrameGraphResourceWrappers.h"
+#include "FirstEngine/Renderer/RenderResourceManager.h"
+#include "FirstEngine/Renderer/PipelineCompiler.h"
 #include "FirstEngine/RHI/IDevice.h"
 #include <iostream>
 
@@ -42,8 +44,9 @@ namespace FirstEngine {
         void FramebufferResource::DoDestroy() {
             if (m_Framebuffer) {
                 // Framebuffer is managed by unique_ptr in VulkanDevice, but we got it via release()
-                // So we need to delete it directly - the destructor will handle Vulkan cleanup
-                delete m_Framebuffer;
+                // So we need to delete it ourselves - once the frames that may still use it have completed
+                RHI::IFramebuffer* framebuffer = m_Framebuffer;
+                RenderResourceManager::DeferDestruction([framebuffer]() { delete framebuffer; });
                 m_Framebuffer = nullptr;
             }
         }
@@ -84,8 +87,15 @@ namespace FirstEngine {
         void RenderPassResource::DoDestroy() {
             if (m_RenderPass) {
                 // RenderPass is managed by unique_ptr in VulkanDevice, but we got it via release()
-                // So we need to delete it directly - the destructor will handle Vulkan cleanup
-                delete m_RenderPass;
+                // So we need to delete it ourselves - once the frames that may still use it have completed
+                // and no pipeline compiling on a worker still reads it
+                RHI::IRenderPass* renderPass = m_RenderPass;
+                RenderResourceManager::DeferDestruction([renderPass]() {
+                    if (PipelineCompiler::IsInitialized()) {
+                        PipelineCompiler::GetInstance().WaitForRenderPass(renderPass);
+                    }
+                    delete renderPass;
+                });
                 m_RenderPass = nullptr;
             }
         }
@@ -0,0 +1,138 @@
+#include "FirstEngine/Renderer/FrameUniformRing.h"
+#include "FirstEngine/RHI/IDevice.h"
+#include "FirstEngine/RHI/IBuffer.h"
+#include <iostream>
+
+namespace FirstEngine {
+    namespace Renderer {
+
+        namespace {
+            uint64_t AlignUp(uint64_t value, uint64_t alignment) {
+                return (value + alignment - 1) & ~(alignment - 1);
+            }
+        }
+
+        FrameUniformRing::~FrameUniformRing() {
+            Cleanup();
+        }
+
+        bool FrameUniformRing::Initialize(RHI::IDevice* device, uint32_t segmentCount, uint64_t segmentSize) {
+            if (!device || segmentCount == 0 || segmentSize == 0) {
+                return false;
+            }
+            Cleanup();
+
+            m_Device = device;
+            m_TargetSize = AlignUp(segmentSize, kAlignment);
+            m_Segments.resize(segmentCount);
+            for (Segment& segment : m_Segments) {
+                if (!CreateSegment(segment, m_TargetSize)) {
+                    Cleanup();
+                    return false;
+                }
+            }
+
+            BeginFrame(0);
+            return true;
+        }
+
+        void FrameUniformRing::Cleanup() {
+            m_Segments.clear();
+            m_Device = nullptr;
+            m_FrameSlot = 0;
+            m_FrameSerial = 0;
+            m_Cursor = 0;
+            m_FlushedUpTo = 0;
+            m_FrameDemand = 0;
+            m_TargetSize = 0;
+            m_OverflowLogged = false;
+        }
+
+        bool FrameUniformRing::CreateSegment(Segment& segment, uint64_t size) {
+            auto buffer = m_Device->CreateBuffer(
+                size,
+                RHI::BufferUsageFlags::UniformBuffer,
+                RHI::MemoryPropertyFlags::HostVisible | RHI::MemoryPropertyFlags::HostCoherent
+            );
+            if (!buffer) {
+                std::cerr << "FrameUniformRing::CreateSegment: Failed to create " << size << " byte uniform segment" << std::endl;
+                return false;
+            }
+
+            uint8_t* data = static_cast<uint8_t*>(buffer->GetMappedPointer());
+            if (!data) {
+                std::cerr << "FrameUniformRing::CreateSegment: Failed to map uniform segment" << std::endl;
+                return false;
+            }
+
+            // The new buffer is created before the old one is released, so descriptor sets can tell them apart
+            segment.buffer = std::move(buffer);
+            segment.data = data;
+            segment.size = size;
+            return true;
+        }
+
+        void FrameUniformRing::BeginFrame(uint32_t frameIndex) {
+            if (m_Segments.empty()) {
+                return;
+            }
+
+            // Size for the heaviest frame seen so far, with headroom so a growing scene doesn't regrow every frame
+            if (m_FrameDemand > m_TargetSize) {
+                m_TargetSize = AlignUp(m_FrameDemand + m_FrameDemand / 2, kAlignment);
+            }
+
+            m_FrameSlot = frameIndex % GetSegmentCount();
+            Segment& segment = m_Segments[m_FrameSlot];
+            if (segment.size < m_TargetSize) {
+                // The slot's previous GPU work has completed, so its buffer can be replaced; on failure the
+                // old, smaller one is kept
+                if (CreateSegment(segment, m_TargetSize)) {
+                    std::cout << "FrameUniformRing::BeginFrame: Grew frame slot " << m_FrameSlot << " segment to "
+                              << m_TargetSize << " bytes" << std::endl;
+                }
+            }
+
+            m_FrameSerial++;
+            m_Cursor = 0;
+            m_FlushedUpTo = 0;
+            m_FrameDemand = 0;
+            m_OverflowLogged = false;
+        }
+
+        void FrameUniformRing::FlushFrame() {
+            if (!m_Segments.empty() && m_Cursor > m_FlushedUpTo) {
+                m_Segments[m_FrameSlot].buffer->FlushMappedRange(m_FlushedUpTo, m_Cursor - m_FlushedUpTo);
+                m_FlushedUpTo = m_Cursor;
+            }
+        }
+
+        void* FrameUniformRing::Allocate(uint64_t size, uint64_t& outOffset) {
+            if (m_Segments.empty() || size == 0) {
+                return nullptr;
+            }
+
+            Segment& segment = m_Segments[m_FrameSlot];
+            m_FrameDemand = AlignUp(m_FrameDemand, kAlignment) + size;
+
+            uint64_t offset = AlignUp(m_Cursor, kAlignment);
+            if (offset + size > segment.size) {
+                if (!m_OverflowLogged) {
+                    std::cerr << "FrameUniformRing::Allocate: Frame segment exhausted (" << segment.size
+                              << " bytes); draws without uniform data this frame are skipped" << std::endl;
+                    m_OverflowLogged = true;
+                }
+                return nullptr;
+            }
+
+            m_Cursor = offset + size;
+            outOffset = offset;
+            return segment.data + offset;
+        }
+
+        RHI::IBuffer* FrameUniformRing::GetSegmentBuffer(uint32_t frameSlot) const {
+            return frameSlot < m_Segments.size() ? m_Segments[frameSlot].buffer.get() : nullptr;
+        }
+
+    } // namespace Renderer
+} // namespace FirstEngine
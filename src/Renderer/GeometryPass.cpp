@@ -34,7 +34,7 @@ namespace FirstEngine {
             const auto& resolution = deferredPipeline->GetRenderConfig().GetResolution();
 
             // Add self to FrameGraph (this Pass IS the Node)
-            // After this, AddWriteResource will automatically add and allocate resources
+            // After this, AddWriteResource will automatically add resources
             // Execute callback is automatically set from OnDraw() in AddNode
             if (!frameGraph.AddNode(this)) {
                 return; // Failed to add node
@@ -8,6 +8,7 @@
 #include "FirstEngine/Renderer/Element.h"
 #include "FirstEngine/Renderer/ShadingMaterial.h"
 #include "FirstEngine/Renderer/RenderResourceManager.h"
+#include "FirstEngine/Renderer/UploadManager.h"
 #include "FirstEngine/Resources/BuiltinGeometry.h"
 #include "FirstEngine/RHI/Types.h"
 #include "FirstEngine/RHI/IDevice.h"
@@ -87,10 +88,11 @@ namespace FirstEngine {
 
             // Declare resource access (automatically adds and allocates resources if needed)
             // Read G-Buffer resources (no description needed, they should already exist)
-            AddReadResource(FrameGraphResourceNameToString(GBUFFER_ALBEDO));
-            AddReadResource(FrameGraphResourceNameToString(GBUFFER_MATERIAL));
-            AddReadResource(FrameGraphResourceNameToString(GBUFFER_NORMAL));
-            AddReadResource(FrameGraphResourceNameToString(GBUFFER_DEPTH));
+            // The handles are kept for OnDraw, so it doesn't look the resources up by name
+            m_GBufferAlbedo = AddReadResource(FrameGraphResourceNameToString(GBUFFER_ALBEDO));
+            m_GBufferMaterial = AddReadResource(FrameGraphResourceNameToString(GBUFFER_MATERIAL));
+            m_GBufferNormal = AddReadResource(FrameGraphResourceNameToString(GBUFFER_NORMAL));
+            m_GBufferDepth = AddReadResource(FrameGraphResourceNameToString(GBUFFER_DEPTH));
 
             // Write to final output (with description, will auto-add and allocate if not exists)
             AttachmentResource outputRes(
@@ -129,10 +131,10 @@ namespace FirstEngine {
             // 3. Outputting the lit result to FinalOutput
             
             // Get G-Buffer resources from builder
-            RHI::IImage* gBufferAlbedo = builder.ReadTexture(FrameGraphResourceNameToString(GBUFFER_ALBEDO));
-            RHI::IImage* gBufferNormal = builder.ReadTexture(FrameGraphResourceNameToString(GBUFFER_NORMAL));
-            RHI::IImage* gBufferMaterial = builder.ReadTexture(FrameGraphResourceNameToString(GBUFFER_MATERIAL));
-            RHI::IImage* gBufferDepth = builder.ReadTexture(FrameGraphResourceNameToString(GBUFFER_DEPTH));
+            RHI::IImage* gBufferAlbedo = builder.ReadTexture(m_GBufferAlbedo);
+            RHI::IImage* gBufferNormal = builder.ReadTexture(m_GBufferNormal);
+            RHI::IImage* gBufferMaterial = builder.ReadTexture(m_GBufferMaterial);
+            RHI::IImage* gBufferDepth = builder.ReadTexture(m_GBufferDepth);
             
             if (!gBufferAlbedo || !gBufferNormal || !gBufferDepth || !gBufferMaterial) {
                 std::cerr << "Warning: LightingPass::OnDraw: G-Buffer resources not available" << std::endl;
@@ -167,8 +169,10 @@ namespace FirstEngine {
                 if (frameGraph) {
                     RHI::IDevice* device = frameGraph->GetDevice();
                     if (device) {
-                        // Process resources to create the geometry
+                        // Process resources to create the geometry, then wait for its (tiny) upload
+                        // since this frame's commands need it right away
                         RenderResourceManager::GetInstance().ProcessScheduledResources(device, 0);
+                        UploadManager::GetInstance().WaitIdle();
                     }
                 }
                 
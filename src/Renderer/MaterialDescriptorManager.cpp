@@ -1,6 +1,7 @@
 #include "FirstEngine/Renderer/MaterialDescriptorManager.h"
 #include <map>
 #include "FirstEngine/Renderer/ShadingMaterial.h"
+#include "FirstEngine/Renderer/FrameUniformRing.h"
 #include "FirstEngine/RHI/IDevice.h"
 #include "FirstEngine/Device/VulkanDevice.h"
 #include <iostream>
@@ -33,6 +34,13 @@ namespace FirstEngine {
 
             m_Device = device;
 
+            // Ring-staged materials get one copy of the descriptor sets per frame slot
+            m_UniformRing = material->GetFrameUniformRing();
+            uint32_t frameSlotCount = m_UniformRing ? std::max(m_UniformRing->GetSegmentCount(), 1u) : 1u;
+            m_DescriptorSets.assign(frameSlotCount, {});
+            m_LastTexturePointers.assign(frameSlotCount, {});
+            m_LastUniformBuffers.assign(frameSlotCount, {});
+
             // Create descriptor set layouts
             if (!CreateDescriptorSetLayouts(material, device)) {
                 return false;
@@ -56,7 +64,9 @@ namespace FirstEngine {
             // So it's safe to update them. We use forceUpdateAllBindings=true to ensure all bindings
             // are initialized, but we still respect m_UpdatedThisFrame to avoid updating if somehow
             // the descriptor set was already updated (shouldn't happen in Initialize, but safety check)
-            WriteDescriptorSets(material, device, true, true); // updateUniformBuffers=true, forceUpdateAllBindings=true for initial setup
+            for (uint32_t frameSlot = 0; frameSlot < GetFrameSlotCount(); ++frameSlot) {
+                WriteDescriptorSets(material, device, frameSlot, true, true); // updateUniformBuffers=true, forceUpdateAllBindings=true for initial setup
+            }
 
             m_Initialized = true;
             return true;
@@ -70,10 +80,14 @@ namespace FirstEngine {
             // Free descriptor sets
             if (m_DescriptorPool && !m_DescriptorSets.empty()) {
                 std::vector<RHI::DescriptorSetHandle> sets;
-                for (const auto& pair : m_DescriptorSets) {
-                    sets.push_back(pair.second);
+                for (const auto& frameSets : m_DescriptorSets) {
+                    for (const auto& pair : frameSets) {
+                        sets.push_back(pair.second);
+                    }
+                }
+                if (!sets.empty()) {
+                    device->FreeDescriptorSets(m_DescriptorPool, sets);
                 }
-                device->FreeDescriptorSets(m_DescriptorPool, sets);
             }
 
             // Destroy descriptor pool
@@ -90,7 +104,9 @@ namespace FirstEngine {
 
             m_DescriptorSets.clear();
             m_LastTexturePointers.clear(); // Clear texture pointer cache
+            m_LastUniformBuffers.clear();
             m_UpdatedThisFrame.clear(); // Clear per-frame update tracking
+            m_UniformRing = nullptr;
             m_CurrentFrame = 0;
             
             // Destroy placeholder texture (unique_ptr will handle cleanup)
@@ -110,15 +126,21 @@ namespace FirstEngine {
             // typically don't change between frames. Initial binding is done in Initialize().
             // 
             // IMPORTANT: We only update texture bindings if:
-            // 1. Texture pointer has changed (checked via cache)
-            // 2. Descriptor set hasn't been updated this frame (to avoid updating sets in use by command buffers)
+            // 1. Texture pointer has changed since this frame slot's sets were last written (checked via cache)
+            // 2. Without per-frame-slot sets: descriptor set hasn't been updated yet (to avoid updating sets
+            //    in use by command buffers)
+            //
+            // Only the current frame slot's sets are written. Its previous frame has completed (the slot's fence
+            // was waited on in BeginFrame) and this frame's command buffers are recorded after the flush, so a
+            // texture swap (e.g. streaming residency) never touches a set a frame in flight still uses. The other
+            // slots pick the change up when their frames come around.
             //
             // NOTE: This function may be called multiple times per frame if:
             // - Multiple entities share the same material (each needs per-object data updated)
             // - The same entity has multiple components using the same material
             // - Child entities also use the same material
-            // The per-frame tracking (m_UpdatedThisFrame) prevents duplicate descriptor set updates
-            WriteDescriptorSets(material, device, false);
+            // The texture pointer cache makes the repeated calls no-ops
+            WriteDescriptorSets(material, device, GetFrameSlot(), false);
             return true;
         }
         
@@ -146,20 +168,39 @@ namespace FirstEngine {
             // Clear m_UpdatedThisFrame for all descriptor sets used by this material
             // This allows them to be updated even if they were marked as updated
             const auto& textureBindings = material->GetTextureBindings();
-            for (const auto& tb : textureBindings) {
-                RHI::DescriptorSetHandle set = GetDescriptorSet(tb.set);
-                if (set) {
-                    m_UpdatedThisFrame.erase(set);
+            for (uint32_t frameSlot = 0; frameSlot < GetFrameSlotCount(); ++frameSlot) {
+                for (const auto& tb : textureBindings) {
+                    RHI::DescriptorSetHandle set = FindDescriptorSet(frameSlot, tb.set);
+                    if (set) {
+                        m_UpdatedThisFrame.erase(set);
+                    }
                 }
             }
             
-            // Now update all bindings (textures only, not uniform buffers)
-            WriteDescriptorSets(material, device, false, true);
+            // Now update all bindings of every frame slot (textures only, not uniform buffers)
+            for (uint32_t frameSlot = 0; frameSlot < GetFrameSlotCount(); ++frameSlot) {
+                WriteDescriptorSets(material, device, frameSlot, false, true);
+            }
+        }
+
+        uint32_t MaterialDescriptorManager::GetFrameSlot() const {
+            if (!m_UniformRing || m_DescriptorSets.empty()) {
+                return 0;
+            }
+            return m_UniformRing->GetFrameSlot() % GetFrameSlotCount();
         }
 
         RHI::DescriptorSetHandle MaterialDescriptorManager::GetDescriptorSet(uint32_t setIndex) const {
-            auto it = m_DescriptorSets.find(setIndex);
-            return (it != m_DescriptorSets.end()) ? it->second : nullptr;
+            return FindDescriptorSet(GetFrameSlot(), setIndex);
+        }
+
+        RHI::DescriptorSetHandle MaterialDescriptorManager::FindDescriptorSet(uint32_t frameSlot, uint32_t setIndex) const {
+            if (frameSlot >= m_DescriptorSets.size()) {
+                return nullptr;
+            }
+            const auto& frameSets = m_DescriptorSets[frameSlot];
+            auto it = frameSets.find(setIndex);
+            return (it != frameSets.end()) ? it->second : nullptr;
         }
 
         RHI::DescriptorSetLayoutHandle MaterialDescriptorManager::GetDescriptorSetLayout(uint32_t setIndex) const {
@@ -210,11 +251,12 @@ namespace FirstEngine {
                               << ", trying to add UniformBuffer" << std::endl;
                     return false;
                 }
-                bindings[ub.binding] = RHI::DescriptorType::UniformBuffer;
+                bindings[ub.binding] = RHI::DescriptorType::UniformBufferDynamic;
 
+                // Dynamic: the material's offsets (ShadingMaterial::GetDynamicOffsets) are given at bind time
                 RHI::DescriptorBinding binding;
                 binding.binding = ub.binding;
-                binding.type = RHI::DescriptorType::UniformBuffer;
+                binding.type = RHI::DescriptorType::UniformBufferDynamic;
                 binding.count = 1;
                 // Determine shader stages that use this buffer (default to all graphics stages)
                 binding.stageFlags = static_cast<RHI::ShaderStage>(
@@ -250,7 +292,7 @@ namespace FirstEngine {
                     // Separate samplers (DescriptorType::Sampler) and separate images (SampledImage) can coexist
                     // This is because separate samplers are used with separate images in Vulkan
                     // However, they cannot conflict with uniform buffers
-                    if (existingType == RHI::DescriptorType::UniformBuffer) {
+                    if (existingType == RHI::DescriptorType::UniformBufferDynamic) {
                         std::cerr << "Error: MaterialDescriptorManager::CreateDescriptorSetLayouts: "
                                   << "Binding conflict detected! Set " << tb.set << ", Binding " << tb.binding
                                   << " is already used by UniformBuffer, trying to add texture type " 
@@ -384,7 +426,7 @@ namespace FirstEngine {
             const auto& uniformBuffers = material->GetUniformBuffers();
             uint32_t uniformBufferCount = static_cast<uint32_t>(uniformBuffers.size());
             if (uniformBufferCount > 0) {
-                poolSizes.push_back({RHI::DescriptorType::UniformBuffer, uniformBufferCount});
+                poolSizes.push_back({RHI::DescriptorType::UniformBufferDynamic, uniformBufferCount});
             }
 
             // Count textures by descriptor type
@@ -400,10 +442,14 @@ namespace FirstEngine {
                 }
             }
 
-            // Allocate enough sets for all sets we need
+            // Allocate enough sets for all sets we need, once per frame slot
             // Note: Even if poolSizes is empty (e.g., Set 0 has no resources), we still need a pool
             // if we have descriptor set layouts (e.g., Set 1 exists)
-            uint32_t maxSets = static_cast<uint32_t>(m_DescriptorSetLayouts.size());
+            uint32_t frameSlotCount = std::max(GetFrameSlotCount(), 1u);
+            for (auto& poolSize : poolSizes) {
+                poolSize.second *= frameSlotCount;
+            }
+            uint32_t maxSets = static_cast<uint32_t>(m_DescriptorSetLayouts.size()) * frameSlotCount;
             
             // If poolSizes is empty but we have layouts, create a pool with empty sizes
             // This is valid in Vulkan - empty pools can still allocate empty descriptor sets
@@ -440,32 +486,43 @@ namespace FirstEngine {
             }
             std::sort(setIndices.begin(), setIndices.end());
 
-            for (uint32_t setIndex : setIndices) {
-                layoutsToAllocate.push_back(m_DescriptorSetLayouts[setIndex]);
+            uint32_t frameSlotCount = GetFrameSlotCount();
+            for (uint32_t frameSlot = 0; frameSlot < frameSlotCount; ++frameSlot) {
+                for (uint32_t setIndex : setIndices) {
+                    layoutsToAllocate.push_back(m_DescriptorSetLayouts[setIndex]);
+                }
             }
 
-            // Allocate descriptor sets from pool
+            // Allocate descriptor sets of every frame slot from pool
             std::vector<RHI::DescriptorSetHandle> allocatedSets = 
                 device->AllocateDescriptorSets(m_DescriptorPool, layoutsToAllocate);
 
-            if (allocatedSets.size() != setIndices.size()) {
+            if (allocatedSets.size() != layoutsToAllocate.size()) {
                 std::cerr << "Failed to allocate all descriptor sets!" << std::endl;
                 return false;
             }
 
             // Store allocated descriptor sets
-            for (size_t i = 0; i < setIndices.size(); ++i) {
-                m_DescriptorSets[setIndices[i]] = allocatedSets[i];
+            for (uint32_t frameSlot = 0; frameSlot < frameSlotCount; ++frameSlot) {
+                for (size_t i = 0; i < setIndices.size(); ++i) {
+                    m_DescriptorSets[frameSlot][setIndices[i]] = allocatedSets[frameSlot * setIndices.size() + i];
+                }
             }
 
             return true;
         }
 
-        void MaterialDescriptorManager::WriteDescriptorSets(ShadingMaterial* material, RHI::IDevice* device, bool updateUniformBuffers, bool forceUpdateAllBindings) {
-            if (!material || !device) {
+        void MaterialDescriptorManager::WriteDescriptorSets(ShadingMaterial* material, RHI::IDevice* device, uint32_t frameSlot,
+                                                            bool updateUniformBuffers, bool forceUpdateAllBindings) {
+            if (!material || !device || frameSlot >= m_LastTexturePointers.size()) {
                 return;
             }
 
+            // With per-frame-slot sets the caller only writes a slot no frame in flight uses, so the
+            // "in use" tracking below is only needed for the single copy of a material without a ring
+            const bool trackInUse = (m_UniformRing == nullptr);
+            auto& lastTexturePointers = m_LastTexturePointers[frameSlot];
+
             // IMPORTANT: This function updates descriptor sets, which may be in use by pending command buffers.
             // Even with UPDATE_UNUSED_WHILE_PENDING_BIT, we can only update descriptors that are NOT actually used by shaders.
             // If a descriptor is used (e.g., binding 0 uniform buffer), it cannot be updated while in use.
@@ -474,8 +531,7 @@ namespace FirstEngine {
             // 1. Before command buffer recording (in FlushParametersToGPU, which is called in EntityToRenderItems)
             // 2. Or after waiting for previous command buffers to complete
             //
-            // For per-frame data (like PerFrame uniform buffer), consider using multiple descriptor set instances
-            // (one per frame) to avoid this issue.
+            // Ring-staged materials have one descriptor set instance per frame slot for this reason.
 
             std::vector<RHI::DescriptorWrite> writes;
 
@@ -492,16 +548,26 @@ namespace FirstEngine {
             // 3. Initial binding is done in Initialize() (updateUniformBuffers=true), so bindings are already set up correctly
             //
             // However, we still update texture bindings because textures may change.
-            if (updateUniformBuffers) {
+            // The exception is a ring segment that grew: its slot's sets are rewritten to the new buffer.
+            auto& lastUniformBuffers = m_LastUniformBuffers[frameSlot];
+            {
                 const auto& uniformBuffers = material->GetUniformBuffers();
                 for (const auto& ub : uniformBuffers) {
-                    if (!ub.buffer) {
+                    RHI::IBuffer* buffer = material->GetDescriptorBuffer(ub, frameSlot);
+                    auto cacheKey = std::make_pair(ub.set, ub.binding);
+                    auto cached = lastUniformBuffers.find(cacheKey);
+                    bool bufferChanged = (cached == lastUniformBuffers.end() || cached->second != buffer);
+                    if (!updateUniformBuffers && !bufferChanged) {
+                        continue;
+                    }
+                    if (!buffer) {
                         std::cerr << "Warning: MaterialDescriptorManager::WriteDescriptorSets: Uniform buffer is nullptr for binding " 
                                   << ub.binding << " in set " << ub.set << std::endl;
                         continue;
                     }
+                    lastUniformBuffers[cacheKey] = buffer;
 
-                    RHI::DescriptorSetHandle set = GetDescriptorSet(ub.set);
+                    RHI::DescriptorSetHandle set = FindDescriptorSet(frameSlot, ub.set);
                     if (!set) {
                         std::cerr << "Error: MaterialDescriptorManager::WriteDescriptorSets: Descriptor set " 
                                   << ub.set << " not found for uniform buffer binding " << ub.binding << std::endl;
@@ -512,12 +578,12 @@ namespace FirstEngine {
                     write.dstSet = set;
                     write.dstBinding = ub.binding;
                     write.dstArrayElement = 0;
-                    write.descriptorType = RHI::DescriptorType::UniformBuffer;
+                    write.descriptorType = RHI::DescriptorType::UniformBufferDynamic;
 
                     RHI::DescriptorBufferInfo bufferInfo;
-                    bufferInfo.buffer = ub.buffer.get();
+                    bufferInfo.buffer = buffer;
                     bufferInfo.offset = 0;
-                    bufferInfo.range = ub.size; // Use entire buffer
+                    bufferInfo.range = ub.size; // One copy of the data; the dynamic offset selects which
                     write.bufferInfo.push_back(bufferInfo);
 
                     writes.push_back(write);
@@ -531,7 +597,7 @@ namespace FirstEngine {
             // This avoids validation warnings when descriptor sets are in use by pending command buffers.
             const auto& textureBindings = material->GetTextureBindings();
             for (const auto& tb : textureBindings) {
-                RHI::DescriptorSetHandle set = GetDescriptorSet(tb.set);
+                RHI::DescriptorSetHandle set = FindDescriptorSet(frameSlot, tb.set);
                 if (!set) {
                     std::cerr << "Warning: MaterialDescriptorManager::WriteDescriptorSets: Descriptor set " 
                               << tb.set << " not found for texture binding " << tb.binding << std::endl;
@@ -552,8 +618,8 @@ namespace FirstEngine {
                 bool isPlaceholder = (tb.texture == nullptr || (placeholderTexture && tb.texture == placeholderTexture));
                 
                 if (!forceUpdateAllBindings) {
-                    auto it = m_LastTexturePointers.find(cacheKey);
-                    if (it != m_LastTexturePointers.end()) {
+                    auto it = lastTexturePointers.find(cacheKey);
+                    if (it != lastTexturePointers.end()) {
                         // Check if texture pointer changed
                         if (it->second != tb.texture) {
                             textureChanged = true;
@@ -562,7 +628,7 @@ namespace FirstEngine {
                         } else if (tb.texture != nullptr && !isPlaceholder) {
                             // Texture pointer hasn't changed and it's not a placeholder - skip update
                             // But mark the set as "updated" so we don't try again this frame
-                            if (m_UpdatedThisFrame.find(set) == m_UpdatedThisFrame.end()) {
+                            if (trackInUse && m_UpdatedThisFrame.find(set) == m_UpdatedThisFrame.end()) {
                                 m_UpdatedThisFrame.insert(set);
                             }
                             continue;
@@ -583,13 +649,13 @@ namespace FirstEngine {
                 // Check if this descriptor set has already been updated this frame
                 // Exception: If texture changed from placeholder to real texture, we MUST update
                 // Exception: If forceUpdateAllBindings is true, we MUST update
-                if (m_UpdatedThisFrame.find(set) != m_UpdatedThisFrame.end() && !textureChanged && !forceUpdateAllBindings) {
+                if (trackInUse && m_UpdatedThisFrame.find(set) != m_UpdatedThisFrame.end() && !textureChanged && !forceUpdateAllBindings) {
                     // Descriptor set already updated this frame and texture hasn't changed - skip
                     continue;
                 }
                 
                 // Update cache
-                m_LastTexturePointers[cacheKey] = tb.texture;
+                lastTexturePointers[cacheKey] = tb.texture;
 
                 RHI::DescriptorWrite write;
                 write.dstSet = set;
@@ -690,7 +756,7 @@ namespace FirstEngine {
                 // If so, we should not update it (it's in use by a command buffer)
                 std::vector<RHI::DescriptorWrite> safeWrites;
                 for (const auto& write : writes) {
-                    if (m_UpdatedThisFrame.find(write.dstSet) != m_UpdatedThisFrame.end()) {
+                    if (trackInUse && m_UpdatedThisFrame.find(write.dstSet) != m_UpdatedThisFrame.end()) {
                         continue;
                     }
                     safeWrites.push_back(write);
@@ -701,8 +767,10 @@ namespace FirstEngine {
                     
                     // Mark all updated descriptor sets as "updated this frame"
                     // This prevents them from being updated again in the same frame
-                    for (const auto& write : safeWrites) {
-                        m_UpdatedThisFrame.insert(write.dstSet);
+                    if (trackInUse) {
+                        for (const auto& write : safeWrites) {
+                            m_UpdatedThisFrame.insert(write.dstSet);
+                        }
                     }
                 }
             }
@@ -0,0 +1,129 @@
+#include "FirstEngine/Renderer/PipelineCompiler.h"
+#include "FirstEngine/Core/ThreadManager.h"
+#include "FirstEngine/RHI/IDevice.h"
+#include <algorithm>
+#include <iostream>
+
+namespace FirstEngine {
+    namespace Renderer {
+
+        PipelineCompiler* PipelineCompiler::s_Instance = nullptr;
+
+        PipelineCompiler& PipelineCompiler::GetInstance() {
+            if (!s_Instance) {
+                s_Instance = new PipelineCompiler();
+            }
+            return *s_Instance;
+        }
+
+        void PipelineCompiler::Shutdown() {
+            if (s_Instance) {
+                // Workers hold the device pointer, so drain them before the device goes away
+                s_Instance->WaitForAll();
+                delete s_Instance;
+                s_Instance = nullptr;
+            }
+        }
+
+        std::shared_ptr<PipelineCompiler::CompileRequest> PipelineCompiler::Submit(
+            RHI::IDevice* device,
+            const RHI::GraphicsPipelineDescription& description) {
+
+            auto request = std::make_shared<CompileRequest>();
+            request->device = device;
+            request->description = description;
+            request->submitTime = std::chrono::steady_clock::now();
+
+            m_PendingCount++;
+            if (description.renderPass) {
+                std::lock_guard<std::mutex> lock(m_StatsMutex);
+                m_RenderPassUsers[description.renderPass]++;
+            }
+
+            if (m_AsyncEnabled && Core::ThreadManager::IsInitialized()) {
+                try {
+                    Core::ThreadManager::GetInstance().InvokeOnWorker([this, request]() {
+                        Compile(request);
+                    });
+                    return request;
+                } catch (const std::exception& e) {
+                    std::cerr << "PipelineCompiler: Failed to queue pipeline on worker, compiling inline: "
+                              << e.what() << std::endl;
+                }
+            }
+
+            Compile(request);
+            return request;
+        }
+
+        void PipelineCompiler::Compile(const std::shared_ptr<CompileRequest>& request) {
+            if (request->device) {
+                request->pipeline = request->device->CreateGraphicsPipeline(request->description);
+            }
+            request->succeeded = request->pipeline != nullptr;
+
+            double latencyMs = std::chrono::duration<double, std::milli>(
+                std::chrono::steady_clock::now() - request->submitTime).count();
+
+            // Publish the result after the pipeline is written so the render thread never sees a half-written request
+            request->completed.store(true, std::memory_order_release);
+
+            // Notify under the lock: once WaitForAll() returns, Shutdown() may delete this instance
+            std::lock_guard<std::mutex> lock(m_StatsMutex);
+            if (request->succeeded) {
+                m_CompletedCount++;
+            } else {
+                m_FailedCount++;
+            }
+            m_TotalLatencyMs += latencyMs;
+            m_LastLatencyMs = latencyMs;
+            m_MaxLatencyMs = std::max(m_MaxLatencyMs, latencyMs);
+            auto users = m_RenderPassUsers.find(request->description.renderPass);
+            if (users != m_RenderPassUsers.end() && --users->second == 0) {
+                m_RenderPassUsers.erase(users);
+            }
+            m_PendingCount--;
+            m_IdleCondition.notify_all();
+        }
+
+        void PipelineCompiler::WaitForAll() {
+            std::unique_lock<std::mutex> lock(m_StatsMutex);
+            m_IdleCondition.wait(lock, [this]() { return m_PendingCount.load() == 0; });
+        }
+
+        void PipelineCompiler::Wait(const std::shared_ptr<CompileRequest>& request) {
+            std::unique_lock<std::mutex> lock(m_StatsMutex);
+            m_IdleCondition.wait(lock, [&request]() { return request->IsCompleted(); });
+        }
+
+        void PipelineCompiler::WaitForRenderPass(RHI::IRenderPass* renderPass) {
+            std::unique_lock<std::mutex> lock(m_StatsMutex);
+            m_IdleCondition.wait(lock, [this, renderPass]() {
+                return m_RenderPassUsers.find(renderPass) == m_RenderPassUsers.end();
+            });
+        }
+
+        PipelineCompiler::Stats PipelineCompiler::GetStats() const {
+            std::lock_guard<std::mutex> lock(m_StatsMutex);
+            Stats stats;
+            stats.pendingCompiles = m_PendingCount.load();
+            stats.completedCompiles = m_CompletedCount;
+            stats.failedCompiles = m_FailedCount;
+            stats.lastLatencyMs = m_LastLatencyMs;
+            stats.maxLatencyMs = m_MaxLatencyMs;
+            uint64_t total = m_CompletedCount + m_FailedCount;
+            stats.averageLatencyMs = total > 0 ? m_TotalLatencyMs / static_cast<double>(total) : 0.0;
+            return stats;
+        }
+
+        void PipelineCompiler::ResetStats() {
+            std::lock_guard<std::mutex> lock(m_StatsMutex);
+            m_CompletedCount = 0;
+            m_FailedCount = 0;
+            m_TotalLatencyMs = 0.0;
+            m_LastLatencyMs = 0.0;
+            m_MaxLatencyMs = 0.0;
+        }
+
+    } // namespace Renderer
+} // namespace FirstEngine
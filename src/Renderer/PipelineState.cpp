@@ -1,5 +1,5 @@
 #include "FirstEngine/Renderer/PipelineState.h"
-#include <functional>
+#include "FirstEngine/Core/Hash.h"
 
 namespace FirstEngine {
     namespace Renderer {
@@ -54,46 +54,43 @@ namespace FirstEngine {
         }
 
         size_t PipelineState::GetHash() const {
-            size_t hash = 0;
-            
+            // Fields are fed one by one (no struct padding), with the attachment count in front of the list
+            Core::Hasher128 hasher;
+
             // Hash rasterization state
-            std::hash<bool> boolHash;
-            std::hash<uint32_t> uint32Hash;
-            std::hash<float> floatHash;
-            
-            hash ^= boolHash(rasterizationState.depthClampEnable) << 1;
-            hash ^= boolHash(rasterizationState.rasterizerDiscardEnable) << 2;
-            hash ^= uint32Hash(static_cast<uint32_t>(rasterizationState.cullMode)) << 3;
-            hash ^= boolHash(rasterizationState.frontFaceCounterClockwise) << 4;
-            hash ^= boolHash(rasterizationState.depthBiasEnable) << 5;
-            hash ^= floatHash(rasterizationState.depthBiasConstantFactor) << 6;
-            hash ^= floatHash(rasterizationState.depthBiasClamp) << 7;
-            hash ^= floatHash(rasterizationState.depthBiasSlopeFactor) << 8;
-            hash ^= floatHash(rasterizationState.lineWidth) << 9;
+            hasher.UpdateValue(rasterizationState.depthClampEnable)
+                  .UpdateValue(rasterizationState.rasterizerDiscardEnable)
+                  .UpdateValue(rasterizationState.cullMode)
+                  .UpdateValue(rasterizationState.frontFaceCounterClockwise)
+                  .UpdateValue(rasterizationState.depthBiasEnable)
+                  .UpdateValue(rasterizationState.depthBiasConstantFactor)
+                  .UpdateValue(rasterizationState.depthBiasClamp)
+                  .UpdateValue(rasterizationState.depthBiasSlopeFactor)
+                  .UpdateValue(rasterizationState.lineWidth);
 
             // Hash depth stencil state
-            hash ^= boolHash(depthStencilState.depthTestEnable) << 10;
-            hash ^= boolHash(depthStencilState.depthWriteEnable) << 11;
-            hash ^= uint32Hash(static_cast<uint32_t>(depthStencilState.depthCompareOp)) << 12;
-            hash ^= boolHash(depthStencilState.depthBoundsTestEnable) << 13;
-            hash ^= boolHash(depthStencilState.stencilTestEnable) << 14;
+            hasher.UpdateValue(depthStencilState.depthTestEnable)
+                  .UpdateValue(depthStencilState.depthWriteEnable)
+                  .UpdateValue(depthStencilState.depthCompareOp)
+                  .UpdateValue(depthStencilState.depthBoundsTestEnable)
+                  .UpdateValue(depthStencilState.stencilTestEnable);
 
             // Hash color blend attachments
-            hash ^= uint32Hash(static_cast<uint32_t>(colorBlendAttachments.size())) << 15;
+            hasher.UpdateValue(static_cast<uint32_t>(colorBlendAttachments.size()));
             for (const auto& attachment : colorBlendAttachments) {
-                hash ^= boolHash(attachment.blendEnable) << 16;
-                hash ^= uint32Hash(attachment.srcColorBlendFactor) << 17;
-                hash ^= uint32Hash(attachment.dstColorBlendFactor) << 18;
-                hash ^= uint32Hash(attachment.colorBlendOp) << 19;
-                hash ^= uint32Hash(attachment.srcAlphaBlendFactor) << 20;
-                hash ^= uint32Hash(attachment.dstAlphaBlendFactor) << 21;
-                hash ^= uint32Hash(attachment.alphaBlendOp) << 22;
+                hasher.UpdateValue(attachment.blendEnable)
+                      .UpdateValue(attachment.srcColorBlendFactor)
+                      .UpdateValue(attachment.dstColorBlendFactor)
+                      .UpdateValue(attachment.colorBlendOp)
+                      .UpdateValue(attachment.srcAlphaBlendFactor)
+                      .UpdateValue(attachment.dstAlphaBlendFactor)
+                      .UpdateValue(attachment.alphaBlendOp);
             }
 
             // Hash primitive topology
-            hash ^= uint32Hash(static_cast<uint32_t>(primitiveTopology)) << 23;
+            hasher.UpdateValue(primitiveTopology);
 
-            return hash;
+            return static_cast<size_t>(hasher.Finalize().low);
         }
 
     } // namespace Renderer
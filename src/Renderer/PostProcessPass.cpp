@@ -8,6 +8,7 @@
 #include "FirstEngine/Renderer/Element.h"
 #include "FirstEngine/Renderer/ShadingMaterial.h"
 #include "FirstEngine/Renderer/RenderResourceManager.h"
+#include "FirstEngine/Renderer/UploadManager.h"
 #include "FirstEngine/Resources/BuiltinGeometry.h"
 #include "FirstEngine/RHI/Types.h"
 #include "FirstEngine/RHI/IDevice.h"
@@ -91,7 +92,7 @@ namespace FirstEngine {
             // as both attachment (write) and shader resource (read) in the same render pass
             
             // Read final output from LightingPass (no description needed, it should already exist)
-            AddReadResource(FrameGraphResourceNameToString(FINAL_OUTPUT));
+            m_InputTexture = AddReadResource(FrameGraphResourceNameToString(FINAL_OUTPUT));
             
             // Write to PostProcessBuffer (with description, will auto-add and allocate if not exists)
             AttachmentResource outputRes(
@@ -118,7 +119,7 @@ namespace FirstEngine {
             // 3. Outputting the processed result to PostProcessBuffer (separate from input)
             
             // Get input texture from builder (FINAL_OUTPUT from LightingPass)
-            RHI::IImage* inputTexture = builder.ReadTexture(FrameGraphResourceNameToString(FINAL_OUTPUT));
+            RHI::IImage* inputTexture = builder.ReadTexture(m_InputTexture);
             
             if (!inputTexture) {
                 std::cerr << "Warning: PostProcessPass::OnDraw: FinalOutput input texture not available" << std::endl;
@@ -153,8 +154,10 @@ namespace FirstEngine {
                 if (frameGraph) {
                     RHI::IDevice* device = frameGraph->GetDevice();
                     if (device) {
-                        // Process resources to create the geometry
+                        // Process resources to create the geometry, then wait for its (tiny) upload
+                        // since this frame's commands need it right away
                         RenderResourceManager::GetInstance().ProcessScheduledResources(device, 0);
+                        UploadManager::GetInstance().WaitIdle();
                     }
                 }
                 
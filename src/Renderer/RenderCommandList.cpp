@@ -28,6 +28,9 @@ namespace FirstEngine {
                     // Note: data pointer is not owned, just clear the pointer
                     params.pushConstants.data = nullptr;
                     break;
+                case RenderCommandType::PipelineBarrier:
+                    params.pipelineBarrier.barrier.imageBarriers.clear();
+                    break;
                 default:
                     break;
             }
@@ -104,6 +107,9 @@ namespace FirstEngine {
                     params.pushConstants = other.params.pushConstants;
                     // Note: data pointer is shallow copied (not owned)
                     break;
+                case RenderCommandType::PipelineBarrier:
+                    params.pipelineBarrier = other.params.pipelineBarrier;
+                    break;
                 default:
                     break;
             }
@@ -148,6 +154,9 @@ namespace FirstEngine {
                     params.pushConstants = other.params.pushConstants;
                     other.params.pushConstants.data = nullptr;
                     break;
+                case RenderCommandType::PipelineBarrier:
+                    params.pipelineBarrier = std::move(other.params.pipelineBarrier);
+                    break;
                 default:
                     break;
             }
@@ -2,7 +2,14 @@
 #include "FirstEngine/Renderer/RenderResourceManager.h"
 #include "FirstEngine/Renderer/ShaderCollectionsTools.h"
 #include "FirstEngine/Renderer/ShaderModuleTools.h"
+#include "FirstEngine/Renderer/PipelineCompiler.h"
+#include "FirstEngine/Renderer/TextureStreamer.h"
+#include "FirstEngine/Renderer/UploadManager.h"
+#include "FirstEngine/Renderer/IRenderPass.h"
+#include "FirstEngine/Renderer/SceneRenderer.h"
+#include "FirstEngine/Core/ThreadManager.h"
 #include "FirstEngine/Resources/DefaultTextures.h"
+#include "FirstEngine/Resources/ResourceProvider.h"
 #include "FirstEngine/Device/VulkanDevice.h"
 #include "FirstEngine/Device/VulkanRenderer.h"
 #include <iostream>
@@ -39,32 +46,39 @@ namespace FirstEngine {
                 return false;
             }
 
-            if (!m_InFlightFence) {
-                m_InFlightFence = device->CreateFence(true); // Start signaled
-                if (!m_InFlightFence) {
-                    std::cerr << "Failed to create in-flight fence in RenderContext" << std::endl;
-                    return false;
+            for (uint32_t i = 0; i < m_FramesInFlight; ++i) {
+                FrameContext& frame = m_Frames[i];
+
+                if (!frame.inFlightFence) {
+                    frame.inFlightFence = device->CreateFence(true); // Start signaled
+                    if (!frame.inFlightFence) {
+                        std::cerr << "Failed to create in-flight fence in RenderContext" << std::endl;
+                        DestroySyncObjects(device);
+                        return false;
+                    }
                 }
-            }
 
-            if (!m_ImageAvailableSemaphore) {
-                m_ImageAvailableSemaphore = device->CreateSemaphoreHandle();
-                if (!m_ImageAvailableSemaphore) {
-                    std::cerr << "Failed to create image available semaphore in RenderContext" << std::endl;
-                    DestroySyncObjects(device);
-                    return false;
+                if (!frame.imageAvailableSemaphore) {
+                    frame.imageAvailableSemaphore = device->CreateSemaphoreHandle();
+                    if (!frame.imageAvailableSemaphore) {
+                        std::cerr << "Failed to create image available semaphore in RenderContext" << std::endl;
+                        DestroySyncObjects(device);
+                        return false;
+                    }
                 }
-            }
 
-            if (!m_RenderFinishedSemaphore) {
-                m_RenderFinishedSemaphore = device->CreateSemaphoreHandle();
-                if (!m_RenderFinishedSemaphore) {
-                    std::cerr << "Failed to create render finished semaphore in RenderContext" << std::endl;
-                    DestroySyncObjects(device);
-                    return false;
+                if (!frame.renderFinishedSemaphore) {
+                    frame.renderFinishedSemaphore = device->CreateSemaphoreHandle();
+                    if (!frame.renderFinishedSemaphore) {
+                        std::cerr << "Failed to create render finished semaphore in RenderContext" << std::endl;
+                        DestroySyncObjects(device);
+                        return false;
+                    }
                 }
             }
 
+            m_FrameIndex = 0;
+            m_FrameSlotAcquired = false;
             return true;
         }
 
@@ -73,20 +87,91 @@ namespace FirstEngine {
                 return;
             }
 
-            if (m_InFlightFence) {
-                device->DestroyFence(m_InFlightFence);
-                m_InFlightFence = nullptr;
+            for (FrameContext& frame : m_Frames) {
+                frame.secondaryCommandBuffers.clear();
+                frame.commandBuffer.reset();
+
+                if (frame.inFlightFence) {
+                    device->DestroyFence(frame.inFlightFence);
+                    frame.inFlightFence = nullptr;
+                }
+
+                if (frame.renderFinishedSemaphore) {
+                    device->DestroySemaphore(frame.renderFinishedSemaphore);
+                    frame.renderFinishedSemaphore = nullptr;
+                }
+
+                if (frame.imageAvailableSemaphore) {
+                    device->DestroySemaphore(frame.imageAvailableSemaphore);
+                    frame.imageAvailableSemaphore = nullptr;
+                }
             }
+        }
 
-            if (m_RenderFinishedSemaphore) {
-                device->DestroySemaphore(m_RenderFinishedSemaphore);
-                m_RenderFinishedSemaphore = nullptr;
+        void RenderContext::SetFramesInFlight(uint32_t count) {
+            count = std::max(1u, std::min(count, kMaxFramesInFlight));
+            if (count == m_FramesInFlight) {
+                return;
             }
 
-            if (m_ImageAvailableSemaphore) {
-                device->DestroySemaphore(m_ImageAvailableSemaphore);
-                m_ImageAvailableSemaphore = nullptr;
+            if (!m_EngineInitialized || !m_Device) {
+                m_FramesInFlight = count;
+                return;
             }
+
+            // Per-frame objects are sized for the old count; drain the GPU and rebuild them
+            m_Device->WaitIdle();
+            ReleaseAllFrames();
+            DestroySyncObjects(m_Device);
+            m_FramesInFlight = count;
+            if (!CreateSyncObjects(m_Device)) {
+                std::cerr << "RenderContext::SetFramesInFlight: Failed to recreate frame sync objects" << std::endl;
+            }
+            // The uniform ring has a segment for kMaxFramesInFlight frames and stays: material descriptor sets
+            // reference its buffer
+        }
+
+        void RenderContext::AcquireFrameSlot() {
+            if (m_FrameSlotAcquired || !m_Device) {
+                return;
+            }
+
+            FrameContext& frame = m_Frames[m_FrameIndex];
+            if (!frame.inFlightFence) {
+                return;
+            }
+
+            // The GPU may still be working on this slot's submission from m_FramesInFlight frames ago;
+            // the other slots' frames keep running meanwhile
+            m_Device->WaitForFence(frame.inFlightFence, UINT64_MAX);
+
+            // Its command buffers and everything released before it was submitted are now unused
+            frame.secondaryCommandBuffers.clear();
+            frame.commandBuffer.reset();
+            RunDeferredDestructions(frame);
+            m_UniformRing.BeginFrame(m_FrameIndex);
+
+            m_FrameSlotAcquired = true;
+        }
+
+        void RenderContext::RunDeferredDestructions(FrameContext& frame) {
+            std::vector<std::function<void()>> destructions;
+            destructions.swap(frame.deferredDestructions);
+            for (auto& destroy : destructions) {
+                destroy();
+            }
+        }
+
+        void RenderContext::ReleaseAllFrames() {
+            for (FrameContext& frame : m_Frames) {
+                frame.secondaryCommandBuffers.clear();
+                frame.commandBuffer.reset();
+                RunDeferredDestructions(frame);
+            }
+            if (RenderResourceManager::HasInstance()) {
+                RenderResourceManager::GetInstance().FlushDeferredDestructions();
+            }
+            m_FrameSlotAcquired = false;
         }
 
         bool RenderContext::BeginFrame() {
@@ -96,6 +181,9 @@ namespace FirstEngine {
                 return false;
             }
 
+            // Recycle this frame's slot before anything writes per-frame data into it
+            AcquireFrameSlot();
+
             // Don't immediately release resources - they may still be in use by the previous frame
             // Instead, mark nodes that are being removed for destruction
             // Resources will be destroyed in ProcessResources after the frame is submitted
@@ -109,6 +197,11 @@ namespace FirstEngine {
                 return false;
             }
 
+            // Same graph as last frame: the compiled plan, resources, barriers and framebuffers are still valid
+            if (m_FrameGraph->IsCompiledFor(m_FrameGraph->ComputeStructureHash())) {
+                return true;
+            }
+
             if (!m_RenderPipeline->BuildExecutionPlan(*m_FrameGraph, m_ExecutionPlan)) {
                 std::cerr << "RenderContext::BeginFrame: Failed to build execution plan" << std::endl;
                 return false;
@@ -132,6 +225,13 @@ namespace FirstEngine {
 
             m_RenderCommands = m_FrameGraph->Execute(m_ExecutionPlan, m_Scene, m_RenderConfig);
 
+            if (!m_FrameGraphExportPath.empty()) {
+                if (m_FrameGraph->ExportToFile(m_FrameGraphExportPath)) {
+                    std::cout << "RenderContext: FrameGraph written to " << m_FrameGraphExportPath << std::endl;
+                }
+                m_FrameGraphExportPath.clear();
+            }
+
             // Debug: Check if commands were generated
             if (m_RenderCommands.IsEmpty()) {
                 std::cerr << "Warning: RenderContext::ExecuteFrameGraph: FrameGraph::Execute returned empty command list!" << std::endl;
@@ -154,11 +254,14 @@ namespace FirstEngine {
                 return;
             }
             
-            // IMPORTANT: Process resources in the correct order
-            // 1. First, process create/update operations (these don't require waiting)
-            // 2. Then, wait for GPU to finish before destroying resources
-            // 3. Finally, process destroy operations
+            // Destroy operations don't wait for the GPU: the GPU objects are handed to
+            // RenderResourceManager::DeferDestruction and deleted once the frames that may use them have completed
             
+            // Hand out resources finished on loader threads; the render textures they scheduled are created below
+            if (Resources::ResourceManager::HasInstance()) {
+                Resources::ResourceManager::GetInstance().ProcessAsyncLoads();
+            }
+
             // Process resources managed by RenderResourceManager (create/update operations)
             RenderResourceManager::GetInstance().ProcessScheduledResources(targetDevice, maxResourcesPerFrame);
             
@@ -192,45 +295,13 @@ namespace FirstEngine {
                 }
             }
             
-            // IMPORTANT: Wait for GPU to finish before destroying resources
-            // This ensures that resources marked for destruction are no longer in use by command buffers
-            // Resources scheduled for destruction in MarkRemovedNodesForDestruction() will be destroyed here
-            // but only after the previous frame's command buffer has completed execution
-            // Note: This should be called AFTER frame submission, not before
-            // For now, we'll check if there are any resources scheduled for destruction before waiting
-            bool hasResourcesToDestroy = false;
-            if (m_FrameGraph) {
-                uint32_t nodeCount = m_FrameGraph->GetNodeCount();
-                for (uint32_t i = 0; i < nodeCount; ++i) {
-                    auto* node = m_FrameGraph->GetNode(i);
-                    if (!node) continue;
-                    
-                    auto* framebufferResource = node->GetFramebufferResource();
-                    if (framebufferResource && framebufferResource->GetScheduleState() == ScheduleState::ScheduledDestroy) {
-                        hasResourcesToDestroy = true;
-                        break;
-                    }
-                    
-                    auto* renderPassResource = node->GetRenderPassResource();
-                    if (renderPassResource && renderPassResource->GetScheduleState() == ScheduleState::ScheduledDestroy) {
-                        hasResourcesToDestroy = true;
-                        break;
-                    }
-                }
-            }
-            
-            // Only wait if there are resources to destroy
-            if (hasResourcesToDestroy) {
-                targetDevice->WaitIdle();
-            }
-            
             // Process destroy operations for FrameGraph node resources
             // Only destroy resources that are scheduled for destruction (not resources that are being reused)
             if (m_FrameGraph) {
                 uint32_t nodeCount = m_FrameGraph->GetNodeCount();
                 uint32_t processedCount = 0;
                 
-                for (uint32_t i = 0; i < nodeCount && processedCount < maxResourcesPerFrame; ++i) {
+                for (uint32_t i = 0; i < nodeCount && (maxResourcesPerFrame == 0 || processedCount < maxResourcesPerFrame); ++i) {
                     auto* node = m_FrameGraph->GetNode(i);
                     if (!node) continue;
                     
@@ -271,44 +342,36 @@ namespace FirstEngine {
                 return false;
             }
 
-            if (!m_InFlightFence || !m_ImageAvailableSemaphore || !m_RenderFinishedSemaphore) {
+            FrameContext& frame = m_Frames[m_FrameIndex];
+            if (!frame.inFlightFence || !frame.imageAvailableSemaphore || !frame.renderFinishedSemaphore) {
                 std::cerr << "RenderContext::SubmitFrame: Missing synchronization objects" << std::endl;
                 return false;
             }
 
-            // Wait for previous frame to complete
-            m_Device->WaitForFence(m_InFlightFence, UINT64_MAX);
-            m_Device->ResetFence(m_InFlightFence);
-
-            // Use internally managed command buffer
-            m_CommandBuffer.reset();
+            // Wait for this slot's previous frame only (normally already done in BeginFrame)
+            AcquireFrameSlot();
 
             // Acquire next frame's swapchain image
-            if (!params.swapchain->AcquireNextImage(m_ImageAvailableSemaphore, nullptr, m_CurrentImageIndex)) {
+            if (!params.swapchain->AcquireNextImage(frame.imageAvailableSemaphore, nullptr, m_CurrentImageIndex)) {
                 // Image acquisition failed or need to recreate swapchain
+                // (the fence is still signaled, so the slot can be used again next frame)
                 return false;
             }
 
             // Create command buffer
-            m_CommandBuffer = m_Device->CreateCommandBuffer();
-            if (!m_CommandBuffer) {
+            frame.commandBuffer = m_Device->CreateCommandBuffer();
+            if (!frame.commandBuffer) {
                 return false;
             }
+            RHI::ICommandBuffer* commandBuffer = frame.commandBuffer.get();
 
             // Begin recording
-            m_CommandBuffer->Begin();
+            commandBuffer->Begin();
 
             // Transition swapchain image layout: Undefined → Color Attachment
-            // Use Write access mode to transition to COLOR_ATTACHMENT_OPTIMAL
             auto* swapchainImage = params.swapchain->GetImage(m_CurrentImageIndex);
             if (swapchainImage) {
-                m_CommandBuffer->TransitionImageLayout(
-                    swapchainImage,
-                    RHI::Format::Undefined,
-                    RHI::Format::B8G8R8A8_UNORM,
-                    1,
-                    RHI::ImageAccessMode::Write  // Write mode for color attachment
-                );
+                commandBuffer->TransitionImageLayout(swapchainImage, RHI::ImageLayout::ColorAttachment);
             }
 
             // Record render commands (using internally managed command recorder)
@@ -319,39 +382,45 @@ namespace FirstEngine {
                 std::cout << "[EditorAPI] RenderContext::SubmitFrame: Recording " 
                           << m_RenderCommands.GetCommands().size() << " commands" << std::endl;
 #endif
-                m_CommandRecorder.RecordCommands(m_CommandBuffer.get(), m_RenderCommands);
+                // Large render passes are recorded into secondary command buffers on the worker pool
+                m_CommandRecorder.RecordCommandsParallel(m_Device, commandBuffer, m_RenderCommands,
+                                                         frame.secondaryCommandBuffers);
             }
 
             // Transition swapchain image layout: Color Attachment → Present
-            // Use Read access mode - TransitionImageLayout will detect swapchain image and convert to PRESENT_SRC_KHR
             if (swapchainImage) {
-                m_CommandBuffer->TransitionImageLayout(
-                    swapchainImage,
-                    RHI::Format::B8G8R8A8_UNORM,
-                    RHI::Format::B8G8R8A8_SRGB,
-                    1,
-                    RHI::ImageAccessMode::Read  // Read mode will trigger PRESENT_SRC_KHR for swapchain images
-                );
+                commandBuffer->TransitionImageLayout(swapchainImage, RHI::ImageLayout::Present);
             }
 
             // End recording
-            m_CommandBuffer->End();
+            commandBuffer->End();
 
-            // Submit command buffer
-            std::vector<RHI::SemaphoreHandle> waitSemaphores = {m_ImageAvailableSemaphore};
-            std::vector<RHI::SemaphoreHandle> signalSemaphores = {m_RenderFinishedSemaphore};
-            m_Device->SubmitCommandBuffer(m_CommandBuffer.get(), waitSemaphores, signalSemaphores, m_InFlightFence);
+            m_UniformRing.FlushFrame();
+
+            // Submit command buffer (the fence is reset only now that the submit that signals it is certain)
+            m_Device->ResetFence(frame.inFlightFence);
+            std::vector<RHI::SemaphoreHandle> waitSemaphores = {frame.imageAvailableSemaphore};
+            std::vector<RHI::SemaphoreHandle> signalSemaphores = {frame.renderFinishedSemaphore};
+            m_Device->SubmitCommandBuffer(commandBuffer, waitSemaphores, signalSemaphores, frame.inFlightFence);
 
             // Present image
-            std::vector<RHI::SemaphoreHandle> presentWaitSemaphores = {m_RenderFinishedSemaphore};
+            std::vector<RHI::SemaphoreHandle> presentWaitSemaphores = {frame.renderFinishedSemaphore};
             params.swapchain->Present(m_CurrentImageIndex, presentWaitSemaphores);
 
-            // IMPORTANT: Process resource destruction AFTER frame submission
-            // This ensures resources are destroyed only after the command buffer has been submitted
-            // The fence will ensure GPU completion before destruction in ProcessResources
-            // Note: We process resources here instead of in OnCreateResources to ensure proper timing
+            // Process scheduled destroys after submission; nothing waits on the GPU here
             ProcessResources(nullptr, 0);
 
+            // Everything released up to now may be referenced by this or an earlier frame. The queue executes
+            // in order, so this frame's fence covers all of them: destroy them when the slot comes around again.
+            if (RenderResourceManager::HasInstance()) {
+                auto released = RenderResourceManager::GetInstance().TakeDeferredDestructions();
+                frame.deferredDestructions.insert(frame.deferredDestructions.end(),
+                    std::make_move_iterator(released.begin()), std::make_move_iterator(released.end()));
+            }
+
+            m_FrameIndex = (m_FrameIndex + 1) % m_FramesInFlight;
+            m_FrameSlotAcquired = false;
+
             return true;
         }
 
@@ -410,6 +479,12 @@ namespace FirstEngine {
                 // Initialize ShaderModuleTools with device
                 auto& moduleTools = ShaderModuleTools::GetInstance();
                 moduleTools.Initialize(m_Device);
+
+                // Worker pool for asynchronous pipeline compilation
+                if (!Core::ThreadManager::IsInitialized()) {
+                    Core::ThreadManager::InitializeWorkerPool();
+                    m_OwnsThreadManager = true;
+                }
                 
                 // Initialize DefaultTextureManager with device
                 auto& defaultTextureManager = Resources::DefaultTextureManager::GetInstance();
@@ -423,13 +498,11 @@ namespace FirstEngine {
                 // Create render pipeline
                 m_RenderPipeline = new DeferredRenderPipeline(m_Device);
                 
-                // Create synchronization objects
-                m_ImageAvailableSemaphore = m_Device->CreateSemaphoreHandle();
-                m_RenderFinishedSemaphore = m_Device->CreateSemaphoreHandle();
-                m_InFlightFence = m_Device->CreateFence(true); // Start signaled
-                
-                if (!m_ImageAvailableSemaphore || !m_RenderFinishedSemaphore || !m_InFlightFence) {
+                // Create per-frame synchronization objects and the frame uniform ring
+                if (!CreateSyncObjects(m_Device) || !m_UniformRing.Initialize(m_Device, kMaxFramesInFlight)) {
                     std::cerr << "Failed to create synchronization objects for RenderContext" << std::endl;
+                    DestroySyncObjects(m_Device);
+                    m_UniformRing.Cleanup();
                     delete m_RenderPipeline;
                     m_RenderPipeline = nullptr;
                     delete m_FrameGraph;
@@ -450,6 +523,7 @@ namespace FirstEngine {
                 // Load Package resources through RenderResourceManager
                 // Try to load from config file first, then fallback to default path
                 auto& resourceManager = RenderResourceManager::GetInstance();
+                resourceManager.SetFrameUniformRing(&m_UniformRing);
                 std::string configPath = "engine.ini";
                 if (!resourceManager.LoadPackageResources(configPath)) {
                     // Fallback: try to load from default Package path
@@ -494,16 +568,16 @@ namespace FirstEngine {
             }
             auto& moduleTools = ShaderModuleTools::GetInstance();
             moduleTools.Initialize(m_Device);
+            if (!Core::ThreadManager::IsInitialized()) {
+                Core::ThreadManager::InitializeWorkerPool();
+                m_OwnsThreadManager = true;
+            }
             m_RenderConfig.SetResolution(static_cast<uint32_t>(width), static_cast<uint32_t>(height));
             m_RenderPipeline = new DeferredRenderPipeline(m_Device);
             m_FrameGraph = new FrameGraph(m_Device);
-            m_ImageAvailableSemaphore = m_Device->CreateSemaphoreHandle();
-            m_RenderFinishedSemaphore = m_Device->CreateSemaphoreHandle();
-            m_InFlightFence = m_Device->CreateFence(true);
-            if (!m_ImageAvailableSemaphore || !m_RenderFinishedSemaphore || !m_InFlightFence) {
-                if (m_InFlightFence) m_Device->DestroyFence(m_InFlightFence);
-                if (m_RenderFinishedSemaphore) m_Device->DestroySemaphore(m_RenderFinishedSemaphore);
-                if (m_ImageAvailableSemaphore) m_Device->DestroySemaphore(m_ImageAvailableSemaphore);
+            if (!CreateSyncObjects(m_Device) || !m_UniformRing.Initialize(m_Device, kMaxFramesInFlight)) {
+                DestroySyncObjects(m_Device);
+                m_UniformRing.Cleanup();
                 delete m_RenderPipeline;
                 delete m_FrameGraph;
                 m_Device->Shutdown();
@@ -514,6 +588,7 @@ namespace FirstEngine {
             // Load Package resources through RenderResourceManager
             // Try to load from config file first, then fallback to default path
             auto& resourceManager = RenderResourceManager::GetInstance();
+            resourceManager.SetFrameUniformRing(&m_UniformRing);
             std::string configPath = "engine.ini";
             if (!resourceManager.LoadPackageResources(configPath)) {
                 // Fallback: try to load from default Package path
@@ -535,33 +610,36 @@ namespace FirstEngine {
                 return;
             }
 
+            // Drain pipeline compiles running on worker threads before the device goes away
+            PipelineCompiler::Shutdown();
+
+            // Resource loads run on the same threads and schedule GPU resources
+            if (Resources::ResourceManager::HasInstance()) {
+                Resources::ResourceManager::GetInstance().WaitForAsyncLoads();
+            }
+
             // Wait for GPU to finish
             if (m_Device) {
                 m_Device->WaitIdle();
             }
+
+            // Staging ring and upload fences belong to the device
+            TextureStreamer::Shutdown();
+            UploadManager::Shutdown();
             
             // Cleanup DefaultTextureManager
             auto& defaultTextureManager = Resources::DefaultTextureManager::GetInstance();
             defaultTextureManager.Cleanup();
 
-            // Release command buffer
-            m_CommandBuffer.reset();
+            // The GPU is idle: every frame's command buffer and deferred destructions can go
+            ReleaseAllFrames();
 
             // Destroy synchronization objects
-            if (m_Device) {
-                if (m_InFlightFence) {
-                    m_Device->DestroyFence(m_InFlightFence);
-                    m_InFlightFence = nullptr;
-                }
-                if (m_RenderFinishedSemaphore) {
-                    m_Device->DestroySemaphore(m_RenderFinishedSemaphore);
-                    m_RenderFinishedSemaphore = nullptr;
-                }
-                if (m_ImageAvailableSemaphore) {
-                    m_Device->DestroySemaphore(m_ImageAvailableSemaphore);
-                    m_ImageAvailableSemaphore = nullptr;
-                }
+            DestroySyncObjects(m_Device);
+            if (RenderResourceManager::HasInstance()) {
+                RenderResourceManager::GetInstance().SetFrameUniformRing(nullptr);
             }
+            m_UniformRing.Cleanup();
 
             // Cleanup scene, FrameGraph, Pipeline, Device (RenderContext owns and deletes)
             if (m_Scene) {
@@ -576,6 +654,10 @@ namespace FirstEngine {
                 delete m_RenderPipeline;
                 m_RenderPipeline = nullptr;
             }
+            // FrameGraph nodes deferred their framebuffers/render passes; they must go before the device
+            if (RenderResourceManager::HasInstance()) {
+                RenderResourceManager::GetInstance().FlushDeferredDestructions();
+            }
             if (m_Device) {
                 m_Device->Shutdown();
                 delete m_Device;
@@ -595,6 +677,12 @@ namespace FirstEngine {
             ShaderModuleTools::Shutdown();
             ShaderCollectionsTools::Shutdown();
             RenderResourceManager::Shutdown();
+            PipelineCompiler::Shutdown();
+
+            if (m_OwnsThreadManager) {
+                Core::ThreadManager::Shutdown();
+                m_OwnsThreadManager = false;
+            }
 
             m_EngineInitialized = false;
         }
@@ -622,6 +710,28 @@ namespace FirstEngine {
             return false;
         }
 
+        size_t RenderContext::PrewarmPipelines(bool waitForCompletion) {
+            if (!m_FrameGraph || !m_Scene || !m_Device) {
+                return 0;
+            }
+
+            // Render passes are created during FrameGraph execution, so only passes that have
+            // rendered at least once can be pre-warmed
+            size_t pendingCount = 0;
+            for (uint32_t i = 0; i < m_FrameGraph->GetNodeCount(); ++i) {
+                auto* pass = dynamic_cast<IRenderPass*>(m_FrameGraph->GetNode(i));
+                if (!pass || !pass->HasSceneRenderer() || !pass->GetRenderPass()) {
+                    continue;
+                }
+                pendingCount += pass->GetSceneRenderer()->PrewarmPipelines(m_Scene, pass->GetRenderPass(), pass->GetShaderKeywords());
+            }
+
+            if (waitForCompletion && pendingCount > 0) {
+                PipelineCompiler::GetInstance().WaitForAll();
+            }
+            return pendingCount;
+        }
+
         void RenderContext::UnloadScene() {
             if (m_Scene) {
                 delete m_Scene;
@@ -1,11 +1,11 @@
 #include "FirstEngine/Renderer/RenderGeometry.h"
 #include "FirstEngine/Renderer/RenderResourceManager.h"
+#include "FirstEngine/Renderer/UploadManager.h"
 #include "FirstEngine/Resources/ResourceTypes.h"
 #include "FirstEngine/RHI/IDevice.h"
-#include "FirstEngine/RHI/ICommandBuffer.h"  // Need complete definition for Begin(), CopyBuffer(), End()
 #include "FirstEngine/RHI/IBuffer.h"
 #include "FirstEngine/RHI/Types.h"
-#include <cstring>
+#include <algorithm>
 
 namespace FirstEngine {
     namespace Renderer {
@@ -29,6 +29,7 @@ namespace FirstEngine {
             m_MeshResource = mesh;
             m_VertexCount = mesh->GetVertexCount();
             m_IndexCount = mesh->GetIndexCount();
+            m_IndexSize = mesh->GetIndexSize();
             m_VertexStride = mesh->GetVertexStride();
             m_FirstIndex = 0;
             m_FirstVertex = 0;
@@ -52,18 +53,22 @@ namespace FirstEngine {
                 return false;
             }
 
-            // Destroy old buffers
-            m_VertexBuffer.reset();
-            m_IndexBuffer.reset();
+            // Retire old buffers (frames in flight may still be drawing with them)
+            WaitForUpload();
+            RenderResourceManager::DeferDelete(std::move(m_VertexBuffer));
+            RenderResourceManager::DeferDelete(std::move(m_IndexBuffer));
 
             // Recreate buffers
             return CreateBuffers(device);
         }
 
         void RenderGeometry::DoDestroy() {
-            // Destroy GPU resources
-            m_VertexBuffer.reset();
-            m_IndexBuffer.reset();
+            // The buffers may still be the target of a queued or in-flight copy
+            WaitForUpload();
+
+            // Destroy GPU resources once the frames that may still draw with them have completed
+            RenderResourceManager::DeferDelete(std::move(m_VertexBuffer));
+            RenderResourceManager::DeferDelete(std::move(m_IndexBuffer));
         }
 
         bool RenderGeometry::CreateBuffers(RHI::IDevice* device) {
@@ -78,8 +83,13 @@ namespace FirstEngine {
                 return false;
             }
 
+            UploadManager& uploads = UploadManager::GetInstance();
+            if (!uploads.IsInitialized() && !uploads.Initialize(device)) {
+                return false;
+            }
+
             // Create vertex buffer (device-local, optimal for GPU access)
-            uint64_t vertexBufferSize = m_VertexCount * m_VertexStride;
+            uint64_t vertexBufferSize = static_cast<uint64_t>(m_VertexCount) * m_VertexStride;
             RHI::BufferUsageFlags vertexUsage = static_cast<RHI::BufferUsageFlags>(
                 static_cast<uint32_t>(RHI::BufferUsageFlags::VertexBuffer) |
                 static_cast<uint32_t>(RHI::BufferUsageFlags::TransferDst)
@@ -91,44 +101,16 @@ namespace FirstEngine {
                 return false;
             }
 
-            // Create staging buffer for vertex data upload
-            RHI::BufferUsageFlags stagingUsage = RHI::BufferUsageFlags::TransferSrc;
-            RHI::MemoryPropertyFlags stagingProperties = static_cast<RHI::MemoryPropertyFlags>(
-                static_cast<uint32_t>(RHI::MemoryPropertyFlags::HostVisible) |
-                static_cast<uint32_t>(RHI::MemoryPropertyFlags::HostCoherent)
-            );
-
-            auto stagingVertexBuffer = device->CreateBuffer(vertexBufferSize, stagingUsage, stagingProperties);
-            if (!stagingVertexBuffer) {
-                return false;
-            }
-
-            // Upload vertex data to staging buffer
-            void* mapped = stagingVertexBuffer->Map();
-            if (mapped) {
-                std::memcpy(mapped, vertexData, vertexBufferSize);
-                stagingVertexBuffer->Unmap();
-            } else {
+            // Queue the copy through the staging ring; it is submitted with the rest of this frame's uploads
+            uint64_t vertexTicket = uploads.UploadBuffer(m_VertexBuffer.get(), vertexData, vertexBufferSize);
+            if (vertexTicket == 0) {
                 return false;
             }
-
-            // Copy from staging buffer to device-local buffer
-            auto cmdBuffer = device->CreateCommandBuffer();
-            if (!cmdBuffer) {
-                return false;
-            }
-
-            cmdBuffer->Begin();
-            cmdBuffer->CopyBuffer(stagingVertexBuffer.get(), m_VertexBuffer.get(), vertexBufferSize);
-            cmdBuffer->End();
-
-            // Submit and wait for completion
-            device->SubmitCommandBuffer(cmdBuffer.get(), {}, {}, nullptr);
-            device->WaitIdle();
+            m_UploadTicket = vertexTicket;
 
             // Create index buffer if needed
             if (m_IndexCount > 0 && indexData != nullptr) {
-                uint64_t indexBufferSize = m_IndexCount * sizeof(uint32_t);
+                uint64_t indexBufferSize = static_cast<uint64_t>(m_IndexCount) * m_IndexSize;
                 RHI::BufferUsageFlags indexUsage = static_cast<RHI::BufferUsageFlags>(
                     static_cast<uint32_t>(RHI::BufferUsageFlags::IndexBuffer) |
                     static_cast<uint32_t>(RHI::BufferUsageFlags::TransferDst)
@@ -140,37 +122,30 @@ namespace FirstEngine {
                     return false;
                 }
 
-                // Create staging buffer for index data upload
-                auto stagingIndexBuffer = device->CreateBuffer(indexBufferSize, stagingUsage, stagingProperties);
-                if (!stagingIndexBuffer) {
-                    return false;
-                }
-
-                // Upload index data to staging buffer
-                void* mappedIndex = stagingIndexBuffer->Map();
-                if (mappedIndex) {
-                    std::memcpy(mappedIndex, indexData, indexBufferSize);
-                    stagingIndexBuffer->Unmap();
-                } else {
-                    return false;
-                }
-
-                // Copy from staging buffer to device-local buffer
-                auto indexCmdBuffer = device->CreateCommandBuffer();
-                if (!indexCmdBuffer) {
+                uint64_t indexTicket = uploads.UploadBuffer(m_IndexBuffer.get(), indexData, indexBufferSize);
+                if (indexTicket == 0) {
                     return false;
                 }
+                // A ring stall may have flushed the vertex copy into an earlier batch; wait for the later one
+                m_UploadTicket = std::max(m_UploadTicket, indexTicket);
+            }
 
-                indexCmdBuffer->Begin();
-                indexCmdBuffer->CopyBuffer(stagingIndexBuffer.get(), m_IndexBuffer.get(), indexBufferSize);
-                indexCmdBuffer->End();
+            return true;
+        }
 
-                // Submit and wait for completion
-                device->SubmitCommandBuffer(indexCmdBuffer.get(), {}, {}, nullptr);
-                device->WaitIdle();
+        bool RenderGeometry::IsReady() const {
+            if (!IsCreated()) {
+                return false;
             }
+            return m_UploadTicket == 0 || !UploadManager::HasInstance() ||
+                   UploadManager::GetInstance().IsComplete(m_UploadTicket);
+        }
 
-            return true;
+        void RenderGeometry::WaitForUpload() {
+            if (m_UploadTicket != 0 && UploadManager::HasInstance()) {
+                UploadManager::GetInstance().WaitForTicket(m_UploadTicket);
+            }
+            m_UploadTicket = 0;
         }
 
     } // namespace Renderer
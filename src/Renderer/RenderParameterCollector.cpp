@@ -1,6 +1,8 @@
 #include "FirstEngine/Renderer/RenderParameterCollector.h"
 #include "FirstEngine/Resources/ModelComponent.h"
 #include "FirstEngine/Resources/MaterialResource.h"
+#include "FirstEngine/Resources/MeshResource.h"
+#include "FirstEngine/Resources/VertexQuantizer.h"
 #include "FirstEngine/Resources/Scene.h"
 #include "FirstEngine/Renderer/RenderConfig.h"
 #include "FirstEngine/Renderer/IRenderPass.h"
@@ -177,7 +179,20 @@ namespace FirstEngine {
             // Shader has: modelMatrix, normalMatrix in PerObject cbuffer
             // IMPORTANT: HLSL uses row-major matrices, but GLM uses column-major
             // We need to transpose the matrices before passing to shader
-            SetParameter("modelMatrix", RenderParameterValue(Core::Mat4(glm::transpose(worldMatrix))));
+            // Unorm16 positions arrive in [0, 1] across the mesh bounds: fold the dequantization into the
+            // model matrix so shaders read them like float positions (normals use the unscaled matrix above)
+            glm::mat4 modelMatrix = worldMatrix;
+            Resources::ModelHandle model = component->GetModel();
+            auto* mesh = model && model->GetMeshCount() > 0 ? dynamic_cast<Resources::MeshResource*>(model->GetMesh(0)) : nullptr;
+            const Resources::VertexAttribute* position =
+                mesh ? mesh->GetVertexFormat().GetAttribute(Resources::VertexAttributeType::Position) : nullptr;
+            if (position && position->encoding == Resources::VertexAttributeEncoding::Unorm16) {
+                glm::vec3 scale, offset;
+                Resources::VertexQuantizer::GetPositionDequantization(mesh->GetBoundsMin(), mesh->GetBoundsMax(), scale, offset);
+                modelMatrix = glm::scale(glm::translate(worldMatrix, offset), scale);
+            }
+
+            SetParameter("modelMatrix", RenderParameterValue(Core::Mat4(glm::transpose(modelMatrix))));
             SetParameter("normalMatrix", RenderParameterValue(Core::Mat4(glm::transpose(normalMatrix))));
         }
 
@@ -1,7 +1,10 @@
 #include "FirstEngine/Renderer/RenderResourceManager.h"
 #include "FirstEngine/Core/ConfigFile.h"
 #include "FirstEngine/Resources/ResourceProvider.h"
+#include "FirstEngine/Resources/PackageArchiveFormat.h"
 #include "FirstEngine/Renderer/ShaderCollectionsTools.h"
+#include "FirstEngine/Renderer/TextureStreamer.h"
+#include "FirstEngine/Renderer/UploadManager.h"
 #include <algorithm>
 #include <memory>
 #include <iostream>
@@ -42,10 +45,44 @@ namespace FirstEngine {
 
         void RenderResourceManager::Shutdown() {
             if (s_Instance) {
+                s_Instance->FlushDeferredDestructions();
                 s_Instance.reset();
             }
         }
 
+        void RenderResourceManager::DeferDestruction(std::function<void()> destroy) {
+            if (!destroy) {
+                return;
+            }
+            if (!s_Instance) {
+                destroy();
+                return;
+            }
+
+            std::lock_guard<std::mutex> lock(s_Instance->m_DeferredMutex);
+            s_Instance->m_DeferredDestructions.push_back(std::move(destroy));
+        }
+
+        std::vector<std::function<void()>> RenderResourceManager::TakeDeferredDestructions() {
+            std::lock_guard<std::mutex> lock(m_DeferredMutex);
+            std::vector<std::function<void()>> destructions;
+            destructions.swap(m_DeferredDestructions);
+            return destructions;
+        }
+
+        void RenderResourceManager::FlushDeferredDestructions() {
+            // Destructors may queue further destructions, so drain until nothing is left
+            for (;;) {
+                std::vector<std::function<void()>> destructions = TakeDeferredDestructions();
+                if (destructions.empty()) {
+                    break;
+                }
+                for (auto& destroy : destructions) {
+                    destroy();
+                }
+            }
+        }
+
         void RenderResourceManager::RegisterResource(IRenderResource* resource) {
             if (!resource) {
                 return;
@@ -81,6 +118,14 @@ namespace FirstEngine {
                 return 0;
             }
 
+            // Resources queue their data uploads instead of waiting on the GPU; retire finished batches
+            // first so their staging space is free for this frame
+            UploadManager& uploads = UploadManager::GetInstance();
+            if (!uploads.IsInitialized()) {
+                uploads.Initialize(device);
+            }
+            uploads.Update();
+
             // Get a snapshot of resources (thread-safe)
             std::vector<IRenderResource*> resources;
             {
@@ -114,6 +159,14 @@ namespace FirstEngine {
                 }
             }
 
+            // Streamed textures swap in finished mip transitions and queue new ones with this frame's uploads
+            if (TextureStreamer::HasInstance()) {
+                TextureStreamer::GetInstance().Update();
+            }
+
+            // One transfer submission for everything created or updated this frame
+            uploads.Flush();
+
             return processedCount;
         }
 
@@ -252,6 +305,16 @@ namespace FirstEngine {
                 return false;
             }
 
+            // Optional VRAM budget for streamed textures
+            std::string textureBudget = config.GetValue("TextureStreamingBudgetMB", "");
+            if (!textureBudget.empty()) {
+                try {
+                    TextureStreamer::GetInstance().SetBudget(std::stoull(textureBudget) * 1024ull * 1024ull);
+                } catch (const std::exception&) {
+                    std::cerr << "RenderResourceManager: Invalid TextureStreamingBudgetMB: " << textureBudget << std::endl;
+                }
+            }
+
             // Get Package path from config
             std::string packagePath = config.GetValue("PackagePath", "");
             if (packagePath.empty()) {
@@ -259,9 +322,13 @@ namespace FirstEngine {
                 return false;
             }
 
-            // Resolve Package path (might be relative)
+            // Resolve Package path (might be relative); a packed package may ship without the directory
             std::string resolvedPackagePath = ResolvePath(packagePath);
-            if (!fs::exists(resolvedPackagePath)) {
+            std::string packedPath = resolvedPackagePath;
+            while (!packedPath.empty() && (packedPath.back() == '/' || packedPath.back() == '\\')) {
+                packedPath.pop_back();
+            }
+            if (!fs::exists(resolvedPackagePath) && !fs::exists(packedPath + FirstEngine::Resources::PackageArchiveFormat::kExtension)) {
                 std::cerr << "RenderResourceManager: Package directory not found: " << resolvedPackagePath << std::endl;
                 return false;
             }
@@ -279,15 +346,26 @@ namespace FirstEngine {
                 normalizedPath += '/';
             }
 
-            if (!fs::exists(normalizedPath)) {
-                std::cerr << "RenderResourceManager: Package directory does not exist: " << normalizedPath << std::endl;
-                return false;
-            }
-
             // Initialize ResourceManager if not already initialized
             FirstEngine::Resources::ResourceManager::Initialize();
             FirstEngine::Resources::ResourceManager& resourceManager = FirstEngine::Resources::ResourceManager::GetInstance();
 
+            // Packed package (ResourceImport pack): <package>.fepak next to the directory stands in for it
+            std::string archivePath = normalizedPath.substr(0, normalizedPath.size() - 1) +
+                                      FirstEngine::Resources::PackageArchiveFormat::kExtension;
+            bool packed = false;
+            if (fs::exists(archivePath)) {
+                packed = resourceManager.MountArchive(archivePath, normalizedPath);
+                if (!packed) {
+                    std::cerr << "RenderResourceManager: Failed to mount " << archivePath << ", using the loose package" << std::endl;
+                }
+            }
+
+            if (!packed && !fs::exists(normalizedPath)) {
+                std::cerr << "RenderResourceManager: Package directory does not exist: " << normalizedPath << std::endl;
+                return false;
+            }
+
             // Add Package directory as search path
             resourceManager.AddSearchPath(normalizedPath);
             resourceManager.AddSearchPath(normalizedPath + "Models");
@@ -317,7 +395,7 @@ namespace FirstEngine {
 
             // Load resource manifest
             std::string manifestPath = normalizedPath + "resource_manifest.json";
-            if (fs::exists(manifestPath)) {
+            if (packed || fs::exists(manifestPath)) {
                 if (resourceManager.LoadManifest(manifestPath)) {
                     std::cout << "RenderResourceManager: Loaded resource manifest from: " << manifestPath << std::endl;
                 } else {
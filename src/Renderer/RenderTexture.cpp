@@ -1,14 +1,15 @@
 #include "FirstEngine/Renderer/RenderTexture.h"
 #include "FirstEngine/Renderer/RenderResourceManager.h"
+#include "FirstEngine/Renderer/TextureStreamer.h"
+#include "FirstEngine/Renderer/UploadManager.h"
 #include "FirstEngine/Resources/TextureResource.h"
 #include "FirstEngine/RHI/IDevice.h"
-#include "FirstEngine/RHI/ICommandBuffer.h"
-#include "FirstEngine/RHI/IBuffer.h"
 #include "FirstEngine/RHI/IImage.h"
 #include "FirstEngine/RHI/Types.h"
 #include <algorithm>
 #include <cstring>
 #include <climits>
+#include <iostream>
 
 namespace FirstEngine {
     namespace Renderer {
@@ -35,6 +36,26 @@ namespace FirstEngine {
             m_Width = textureResource->GetWidth();
             m_Height = textureResource->GetHeight();
             m_Channels = textureResource->GetChannels();
+            m_Mips.clear();
+            m_TextureData.clear();
+
+            // Cooked: the levels are already GPU-ready and stay in the TextureResource's mapping (which owns us)
+            // Sampled as UNORM like source textures; the sRGB flag only decided how the mips were filtered
+            if (!textureResource->GetMips().empty()) {
+                m_Mips = textureResource->GetMips();
+                m_Encoding = textureResource->GetEncoding();
+                switch (m_Encoding) {
+                    case Resources::TextureEncoding::RGBA8: m_Format = RHI::Format::R8G8B8A8_UNORM; break;
+                    case Resources::TextureEncoding::BC1:   m_Format = RHI::Format::BC1_RGBA_UNORM; break;
+                    case Resources::TextureEncoding::BC3:   m_Format = RHI::Format::BC3_UNORM; break;
+                    case Resources::TextureEncoding::BC5:   m_Format = RHI::Format::BC5_UNORM; break;
+                    case Resources::TextureEncoding::BC7:   m_Format = RHI::Format::BC7_UNORM; break;
+                    default: return false;
+                }
+                m_Channels = 4;
+                return true;
+            }
+            m_Encoding = Resources::TextureEncoding::RGBA8;
 
             // Determine format from channels
             if (m_Channels == 1) {
@@ -75,6 +96,13 @@ namespace FirstEngine {
                 m_Channels = 4;
             }
 
+            Resources::TextureMip mip;
+            mip.data = m_TextureData.data();
+            mip.size = m_TextureData.size();
+            mip.width = m_Width;
+            mip.height = m_Height;
+            m_Mips.push_back(mip);
+
             return true;
         }
 
@@ -83,7 +111,33 @@ namespace FirstEngine {
                 return false;
             }
 
-            return CreateImage(device) && UploadTextureData(device);
+            if (!DecodeForDevice(device)) {
+                return false;
+            }
+            m_Device = device;
+
+            // Streamed textures start with only their tail levels; TextureStreamer brings in the rest on demand
+            m_ResidentMip = 0;
+            m_TailMip = 0;
+            TextureStreamer& streamer = TextureStreamer::GetInstance();
+            if (streamer.IsEnabled()) {
+                m_TailMip = streamer.GetTailMip(m_Width, m_Height, GetMipCount());
+                m_ResidentMip = m_TailMip;
+            }
+
+            m_Image = CreateImage(device, m_ResidentMip);
+            if (!m_Image) {
+                return false;
+            }
+            m_UploadTicket = UploadTextureData(device, m_Image.get(), m_ResidentMip);
+            if (m_UploadTicket == 0) {
+                return false;
+            }
+
+            if (IsStreamed()) {
+                streamer.Register(this);
+            }
+            return true;
         }
 
         bool RenderTexture::DoUpdate(RHI::IDevice* device) {
@@ -93,129 +147,182 @@ namespace FirstEngine {
             }
 
             // Re-upload texture data if texture resource data changed
-            return UploadTextureData(device);
+            // (the previous upload must land first so the two copies don't race on the image)
+            WaitForUpload();
+            m_UploadTicket = UploadTextureData(device, m_Image.get(), m_ResidentMip);
+            return m_UploadTicket != 0;
         }
 
         void RenderTexture::DoDestroy() {
-            // Destroy GPU resources
-            m_Image.reset();
+            if (IsStreamed() && TextureStreamer::HasInstance()) {
+                TextureStreamer::GetInstance().Unregister(this);
+            }
+
+            // The images may still be the target of a queued or in-flight copy
+            WaitForUpload();
+            if (m_PendingTicket != 0 && UploadManager::HasInstance()) {
+                UploadManager::GetInstance().WaitForTicket(m_PendingTicket);
+            }
+            m_PendingTicket = 0;
+
+            // Destroy GPU resources once the frames that may still sample it have completed
+            RenderResourceManager::DeferDelete(std::move(m_Image));
+            if (m_PendingImage) {
+                RenderResourceManager::DeferDelete(std::move(m_PendingImage));
+            }
             m_TextureData.clear();
+            m_Mips.clear();
+            m_ResidentMip = 0;
+            m_TailMip = 0;
+            m_Device = nullptr;
+        }
+
+        uint64_t RenderTexture::GetMipChainBytes(uint32_t firstMip) const {
+            uint64_t bytes = 0;
+            for (size_t i = firstMip; i < m_Mips.size(); ++i) {
+                bytes += m_Mips[i].size;
+            }
+            return bytes;
+        }
+
+        uint64_t RenderTexture::RequestResidency(uint32_t firstMip) {
+            firstMip = std::min(firstMip, m_TailMip);
+            if (!m_Device || !m_Image || m_PendingImage || firstMip == m_ResidentMip) {
+                return 0;
+            }
+
+            auto image = CreateImage(m_Device, firstMip);
+            if (!image) {
+                return 0;
+            }
+            uint64_t ticket = UploadTextureData(m_Device, image.get(), firstMip);
+            if (ticket == 0) {
+                RenderResourceManager::DeferDelete(std::move(image));
+                return 0;
+            }
+
+            m_PendingImage = std::move(image);
+            m_PendingMip = firstMip;
+            m_PendingTicket = ticket;
+            return GetMipChainBytes(firstMip);
         }
 
-        bool RenderTexture::CreateImage(RHI::IDevice* device) {
-            if (!device || m_Width == 0 || m_Height == 0) {
+        bool RenderTexture::UpdateResidency() {
+            if (!m_PendingImage || !UploadManager::HasInstance() ||
+                !UploadManager::GetInstance().IsComplete(m_PendingTicket)) {
                 return false;
             }
 
-            // Create image description
+            // Materials pick up the new image on their next RefreshTextureBindings; the old one stays alive
+            // until the frames that may still sample it have completed
+            RenderResourceManager::DeferDelete(std::move(m_Image));
+            m_Image = std::move(m_PendingImage);
+            m_ResidentMip = m_PendingMip;
+            m_UploadTicket = m_PendingTicket;
+            m_PendingTicket = 0;
+            return true;
+        }
+
+        bool RenderTexture::DecodeForDevice(RHI::IDevice* device) {
+            if (m_Encoding == Resources::TextureEncoding::RGBA8 || device->GetDeviceInfo().textureCompressionBC) {
+                return true;
+            }
+
+            // No BC sampling on this device: expand every level to RGBA8 (one allocation, mips repointed into it)
+            uint64_t totalSize = 0;
+            for (const auto& mip : m_Mips) {
+                totalSize += static_cast<uint64_t>(mip.width) * mip.height * 4;
+            }
+            m_TextureData.clear();
+            m_TextureData.reserve(static_cast<size_t>(totalSize));
+
+            std::vector<uint64_t> offsets;
+            std::vector<uint8_t> decoded;
+            for (const auto& mip : m_Mips) {
+                if (!Resources::TextureCompressor::Decode(mip.data, mip.width, mip.height, m_Encoding, decoded)) {
+                    std::cerr << "RenderTexture: Failed to decode " << Resources::TextureCompressor::GetEncodingName(m_Encoding)
+                              << " level " << offsets.size() << std::endl;
+                    return false;
+                }
+                offsets.push_back(m_TextureData.size());
+                m_TextureData.insert(m_TextureData.end(), decoded.begin(), decoded.end());
+            }
+            for (size_t i = 0; i < m_Mips.size(); ++i) {
+                m_Mips[i].data = m_TextureData.data() + offsets[i];
+                m_Mips[i].size = static_cast<uint64_t>(m_Mips[i].width) * m_Mips[i].height * 4;
+            }
+
+            m_Encoding = Resources::TextureEncoding::RGBA8;
+            m_Format = RHI::Format::R8G8B8A8_UNORM;
+            return true;
+        }
+
+        std::unique_ptr<RHI::IImage> RenderTexture::CreateImage(RHI::IDevice* device, uint32_t firstMip) const {
+            if (!device || m_Width == 0 || m_Height == 0 || firstMip >= std::max<size_t>(m_Mips.size(), 1)) {
+                return nullptr;
+            }
+
+            // Create image description (level firstMip becomes the image's level 0)
             RHI::ImageDescription imageDesc;
-            imageDesc.width = m_Width;
-            imageDesc.height = m_Height;
+            imageDesc.width = firstMip < m_Mips.size() ? m_Mips[firstMip].width : m_Width;
+            imageDesc.height = firstMip < m_Mips.size() ? m_Mips[firstMip].height : m_Height;
             imageDesc.depth = 1;
-            imageDesc.mipLevels = 1;
+            imageDesc.mipLevels = static_cast<uint32_t>(std::max<size_t>(m_Mips.size(), 1)) - firstMip;
             imageDesc.arrayLayers = 1;
             imageDesc.format = m_Format;
             imageDesc.usage = RHI::ImageUsageFlags::Sampled | RHI::ImageUsageFlags::TransferDst;
             imageDesc.memoryProperties = RHI::MemoryPropertyFlags::DeviceLocal;
 
             // Create GPU image
-            m_Image = device->CreateImage(imageDesc);
-            return m_Image != nullptr;
+            return device->CreateImage(imageDesc);
         }
 
-        bool RenderTexture::UploadTextureData(RHI::IDevice* device) {
-            if (!device || !m_Image || m_TextureData.empty()) {
-                return false;
+        uint64_t RenderTexture::UploadTextureData(RHI::IDevice* device, RHI::IImage* image, uint32_t firstMip) {
+            if (!device || !image || firstMip >= m_Mips.size()) {
+                return 0;
             }
 
-            // Calculate texture data size
-            uint64_t textureSize = static_cast<uint64_t>(m_TextureData.size());
-
-            // 1. Create staging buffer (host-visible and host-coherent for CPU writes)
-            auto stagingBuffer = device->CreateBuffer(
-                textureSize,
-                RHI::BufferUsageFlags::TransferSrc,
-                RHI::MemoryPropertyFlags::HostVisible | RHI::MemoryPropertyFlags::HostCoherent
-            );
-
-            if (!stagingBuffer) {
-                return false;
+            UploadManager& uploads = UploadManager::GetInstance();
+            if (!uploads.IsInitialized() && !uploads.Initialize(device)) {
+                return 0;
             }
 
-            // 2. Copy texture data to staging buffer
-            void* mappedData = stagingBuffer->Map();
-            if (!mappedData) {
-                return false;
+            // Copy into the staging ring and queue UNDEFINED -> TRANSFER_DST -> copy -> SHADER_READ_ONLY;
+            // the commands are recorded with the rest of this frame's uploads and IsReady() flips once they finish
+            // One copy per level; batches retire in order, so the last level's ticket covers the whole chain
+            uint64_t ticket = 0;
+            for (size_t level = firstMip; level < m_Mips.size(); ++level) {
+                const Resources::TextureMip& mip = m_Mips[level];
+                ticket = uploads.UploadImage(
+                    image,
+                    mip.data,
+                    mip.size,
+                    mip.width,
+                    mip.height,
+                    m_Format,
+                    static_cast<uint32_t>(level - firstMip)
+                );
+                if (ticket == 0) {
+                    return 0;
+                }
             }
-            std::memcpy(mappedData, m_TextureData.data(), textureSize);
-            stagingBuffer->Unmap();
 
-            // 3. Create command buffer for transfer operations
-            auto commandBuffer = device->CreateCommandBuffer();
-            if (!commandBuffer) {
-                return false;
-            }
+            return ticket;
+        }
 
-            // 4. Begin recording commands
-            commandBuffer->Begin();
-
-            // 5. Transition image layout from Undefined to TransferDstOptimal
-            // Note: TransitionImageLayout uses Format as a temporary solution for layout
-            // Format::Undefined represents VK_IMAGE_LAYOUT_UNDEFINED
-            // We need to use a format that represents TRANSFER_DST_OPTIMAL
-            // For now, we'll use the image's format and rely on the implementation's heuristic
-            commandBuffer->TransitionImageLayout(
-                m_Image.get(),
-                RHI::Format::Undefined,  // oldLayout: UNDEFINED
-                m_Format,                // newLayout: will be interpreted as TRANSFER_DST_OPTIMAL by implementation
-                1                        // mipLevels
-            );
-
-            // 6. Copy buffer to image
-            commandBuffer->CopyBufferToImage(
-                stagingBuffer.get(),
-                m_Image.get(),
-                m_Width,
-                m_Height
-            );
-
-            // 7. Transition image layout from TransferDstOptimal to ShaderReadOnlyOptimal
-            // For shader read, we'll use the image format again
-            // The implementation should interpret this as SHADER_READ_ONLY_OPTIMAL
-            // Note: This is a workaround - ideally we'd have a proper ImageLayout enum
-            commandBuffer->TransitionImageLayout(
-                m_Image.get(),
-                m_Format,                // oldLayout: TRANSFER_DST_OPTIMAL (heuristic)
-                m_Format,                // newLayout: SHADER_READ_ONLY_OPTIMAL (heuristic)
-                1                        // mipLevels
-            );
-
-            // 8. End recording
-            commandBuffer->End();
-
-            // 9. Submit command buffer and wait for completion
-            // Create a fence to wait for completion
-            auto fence = device->CreateFence(false);
-            if (!fence) {
+        bool RenderTexture::IsReady() const {
+            if (!IsCreated()) {
                 return false;
             }
+            return m_UploadTicket == 0 || !UploadManager::HasInstance() ||
+                   UploadManager::GetInstance().IsComplete(m_UploadTicket);
+        }
 
-            device->SubmitCommandBuffer(
-                commandBuffer.get(),
-                {},  // waitSemaphores
-                {},  // signalSemaphores
-                fence // fence
-            );
-
-            // 10. Wait for fence (ensures upload is complete)
-            device->WaitForFence(fence, UINT64_MAX);
-            device->ResetFence(fence);
-            device->DestroyFence(fence);
-
-            // Staging buffer will be automatically destroyed when unique_ptr goes out of scope
-            // Command buffer will be automatically destroyed when unique_ptr goes out of scope
-
-            return true;
+        void RenderTexture::WaitForUpload() {
+            if (m_UploadTicket != 0 && UploadManager::HasInstance()) {
+                UploadManager::GetInstance().WaitForTicket(m_UploadTicket);
+            }
+            m_UploadTicket = 0;
         }
 
     } // namespace Renderer
@@ -5,20 +5,23 @@
 #include "FirstEngine/Renderer/RenderParameterCollector.h"
 #include "FirstEngine/Renderer/IRenderPass.h"
 #include "FirstEngine/Renderer/ShadingMaterial.h"
+#include "FirstEngine/Renderer/TextureStreamer.h"
 #include "FirstEngine/Resources/Scene.h"
 #include "FirstEngine/Resources/ModelComponent.h"
 #include "FirstEngine/RHI/IDevice.h"
 #include "FirstEngine/RHI/IBuffer.h"
 #include "FirstEngine/RHI/IImage.h"
+#include "FirstEngine/RHI/IPipeline.h"
 #include <algorithm>
 #include <cmath>
 #include <iostream>
+#include <limits>
 
 namespace FirstEngine {
     namespace Renderer {
 
         SceneRenderer::SceneRenderer(RHI::IDevice* device)
-            : IRenderer(device) {}
+            : m_Device(device) {}
 
         SceneRenderer::~SceneRenderer() = default;
 
@@ -57,7 +60,7 @@ namespace FirstEngine {
 
             // Convert render queue to render command list
             // Pass renderPass to ensure pipelines are created
-            m_SceneRenderCommands = IRenderer::SubmitRenderQueue(renderQueue, renderPass);
+            m_SceneRenderCommands = SubmitRenderQueue(renderQueue, renderPass);
         }
 
         void SceneRenderer::BuildRenderQueue(
@@ -78,6 +81,10 @@ namespace FirstEngine {
             glm::mat4 viewProjMatrix = projMatrix * viewMatrix;
             Frustum frustum(viewProjMatrix);
 
+            // Converts tan(angular radius) to pixels for LOD selection
+            float tanHalfFov = std::tan(glm::radians(m_CameraConfig.fov) * 0.5f);
+            m_LodProjectionScale = tanHalfFov > 0.0f ? 0.5f * static_cast<float>(resolutionConfig.height) / tanHalfFov : 0.0f;
+
             // Use render flags from parameter
             bool frustumCulling = renderFlags.frustumCulling && m_FrustumCullingEnabled;
             bool occlusionCulling = renderFlags.occlusionCulling && m_OcclusionCullingEnabled;
@@ -144,6 +151,10 @@ namespace FirstEngine {
             
 
             std::vector<RenderItem> allItems;
+            m_TriangleCount = 0;
+            m_FullDetailTriangleCount = 0;
+            m_NextLodState.clear();
+            m_MaterialScreenSize.clear();
             
             // Get camera matrices once for all entities (per-frame data)
             // These will be used for PerFrame uniform buffer
@@ -167,6 +178,13 @@ namespace FirstEngine {
                 EntityToRenderItems(entity, allItems);
             }
 
+            // Only components drawn this frame keep their LOD history
+            m_LodState.swap(m_NextLodState);
+
+            if (m_TextureStreamingFeedback) {
+                RequestTextureMips();
+            }
+
             // Add all items to render queue (will be batched automatically)
             for (const auto& item : allItems) {
                 renderQueue.AddItem(item);
@@ -229,6 +247,9 @@ namespace FirstEngine {
                     
                     // Apply all collected parameters to material
                     shadingMaterial->ApplyParameters(collector);
+
+                    // Follow texture uploads and streaming residency changes
+                    shadingMaterial->RefreshTextureBindings();
                     
                     // FlushParametersToGPU now handles all parameters (including textures) in a single pass
                     // This applies parameters to CPU-side data and flushes to GPU buffers
@@ -240,6 +261,26 @@ namespace FirstEngine {
                 auto renderItem = component->CreateRenderItem(worldMatrix, m_RenderFlags);
                 if (renderItem) {
                     // Component matched render flags and created a valid render item
+                    // Items come with LOD 0; switch the index range to the selected level
+                    auto& geometry = renderItem->geometryData;
+                    m_FullDetailTriangleCount += geometry.indexCount / 3;
+                    float projectedRadius = ProjectedRadius(*renderItem);
+                    if (m_TextureStreamingFeedback && shadingMaterial) {
+                        float& screenSize = m_MaterialScreenSize[shadingMaterial];
+                        screenSize = std::max(screenSize, 2.0f * projectedRadius);
+                    }
+                    if (m_LodEnabled && geometry.lodCount > 1) {
+                        auto previous = m_LodState.find(component.get());
+                        uint32_t lod = SelectLod(*renderItem, projectedRadius,
+                                                 previous != m_LodState.end() ? previous->second : UINT32_MAX);
+                        m_NextLodState[component.get()] = lod;
+
+                        uint32_t baseIndex = geometry.firstIndex - geometry.lods[0].firstIndex;
+                        geometry.lodIndex = lod;
+                        geometry.firstIndex = baseIndex + geometry.lods[lod].firstIndex;
+                        geometry.indexCount = geometry.lods[lod].indexCount;
+                    }
+                    m_TriangleCount += geometry.indexCount / 3;
                     items.push_back(*renderItem);
                 }
             }
@@ -250,6 +291,187 @@ namespace FirstEngine {
             }
         }
 
+        float SceneRenderer::ProjectedRadius(const RenderItem& item) const {
+            const auto& geometry = item.geometryData;
+
+            // World-space bounding sphere; the radius grows with the largest axis scale
+            glm::vec3 center = glm::vec3(item.worldMatrix * glm::vec4(geometry.boundsCenter, 1.0f));
+            float scale = std::max(glm::length(glm::vec3(item.worldMatrix[0])),
+                                   std::max(glm::length(glm::vec3(item.worldMatrix[1])),
+                                            glm::length(glm::vec3(item.worldMatrix[2]))));
+            float radius = geometry.boundsRadius * scale;
+            float distance = glm::length(center - m_CameraConfig.position);
+            if (distance <= radius || m_LodProjectionScale <= 0.0f) {
+                return std::numeric_limits<float>::infinity();
+            }
+            return m_LodProjectionScale * radius / std::sqrt(distance * distance - radius * radius);
+        }
+
+        uint32_t SceneRenderer::SelectLod(const RenderItem& item, float projectedRadius, uint32_t currentLod) const {
+            const auto& geometry = item.geometryData;
+            if (std::isinf(projectedRadius)) {
+                return 0;
+            }
+
+            // LOD errors are fractions of the bounding sphere radius
+            auto coarsestWithin = [&geometry, projectedRadius](float pixels) {
+                uint32_t lod = 0;
+                for (uint32_t i = 1; i < geometry.lodCount; ++i) {
+                    if (geometry.lods[i].error * projectedRadius <= pixels) {
+                        lod = i;
+                    }
+                }
+                return lod;
+            };
+
+            uint32_t lod = coarsestWithin(m_LodBias);
+            if (currentLod < geometry.lodCount && lod > currentLod) {
+                // Coarsen only once the error is clearly below the threshold
+                lod = std::max(currentLod, coarsestWithin(m_LodBias * (1.0f - m_LodHysteresis)));
+            }
+            return lod;
+        }
+
+        void SceneRenderer::RequestTextureMips() {
+            TextureStreamer& streamer = TextureStreamer::GetInstance();
+            if (!streamer.IsEnabled()) {
+                return;
+            }
+            for (const auto& pair : m_MaterialScreenSize) {
+                for (const auto& textureBinding : pair.first->GetTextureBindings()) {
+                    if (textureBinding.renderTexture) {
+                        streamer.RequestScreenSize(textureBinding.renderTexture, pair.second);
+                    }
+                }
+            }
+        }
+
+        RenderCommandList SceneRenderer::SubmitRenderQueue(const RenderQueue& renderQueue, RHI::IRenderPass* renderPass) {
+            RenderCommandList commandList;
+            m_DrawCallCount = 0;
+            m_SkippedDrawCount = 0;
+
+            // Pass keywords select shader variants of each material (pipelines need a renderPass)
+            Shader::ShaderKeywordSet passKeywords;
+            if (m_CurrentRenderPass && renderPass) {
+                passKeywords = m_CurrentRenderPass->GetShaderKeywords();
+            }
+
+            RHI::IPipeline* boundPipeline = nullptr;
+            ShadingMaterial* boundMaterial = nullptr;
+
+            for (const auto& batch : renderQueue.GetBatches()) {
+                for (const auto& item : batch.GetItems()) {
+                    auto* material = static_cast<ShadingMaterial*>(item.materialData.shadingMaterial);
+                    if (!material || !material->IsCreated() || !item.geometryData.vertexBuffer) {
+                        continue;
+                    }
+
+                    // Pipelines compile asynchronously; skip the item until ready
+                    // Without a renderPass, pipelines must have been created elsewhere
+                    bool pipelineReady = renderPass ? material->EnsurePipelineCreated(m_Device, renderPass, passKeywords)
+                                                    : material->GetShadingState().GetPipeline() != nullptr;
+                    if (!pipelineReady) {
+                        m_SkippedDrawCount++;
+                        continue;
+                    }
+
+                    // Without this frame's uniform data (ring segment full) the draw would read another frame's
+                    if (!material->HasFrameUniforms()) {
+                        m_SkippedDrawCount++;
+                        continue;
+                    }
+
+                    RHI::IPipeline* pipeline = material->GetShadingStateForKeywords(passKeywords)->GetPipeline();
+                    if (pipeline != boundPipeline) {
+                        RenderCommand bindPipeline;
+                        bindPipeline.type = RenderCommandType::BindPipeline;
+                        bindPipeline.params.bindPipeline.pipeline = pipeline;
+                        commandList.AddCommand(std::move(bindPipeline));
+                        boundPipeline = pipeline;
+                        boundMaterial = nullptr; // Rebind descriptor sets after pipeline change
+                    }
+
+                    if (material != boundMaterial) {
+                        size_t setCount = material->GetAllDescriptorSetLayouts().size();
+                        if (setCount > 0) {
+                            RenderCommand bindSets;
+                            bindSets.type = RenderCommandType::BindDescriptorSets;
+                            bindSets.params.bindDescriptorSets.firstSet = 0;
+                            for (uint32_t set = 0; set < setCount; ++set) {
+                                bindSets.params.bindDescriptorSets.descriptorSets.push_back(material->GetDescriptorSet(set));
+                            }
+                            bindSets.params.bindDescriptorSets.dynamicOffsets = material->GetDynamicOffsets();
+                            commandList.AddCommand(std::move(bindSets));
+                        }
+                        boundMaterial = material;
+                    }
+
+                    RenderCommand bindVertex;
+                    bindVertex.type = RenderCommandType::BindVertexBuffers;
+                    bindVertex.params.bindVertexBuffers.firstBinding = 0;
+                    bindVertex.params.bindVertexBuffers.buffers.push_back(static_cast<RHI::IBuffer*>(item.geometryData.vertexBuffer));
+                    bindVertex.params.bindVertexBuffers.offsets.push_back(item.geometryData.vertexBufferOffset);
+                    commandList.AddCommand(std::move(bindVertex));
+
+                    if (item.geometryData.indexBuffer && item.geometryData.indexCount > 0) {
+                        RenderCommand bindIndex;
+                        bindIndex.type = RenderCommandType::BindIndexBuffer;
+                        bindIndex.params.bindIndexBuffer.buffer = static_cast<RHI::IBuffer*>(item.geometryData.indexBuffer);
+                        bindIndex.params.bindIndexBuffer.offset = item.geometryData.indexBufferOffset;
+                        bindIndex.params.bindIndexBuffer.is32Bit = item.geometryData.indexIs32Bit;
+                        commandList.AddCommand(std::move(bindIndex));
+
+                        RenderCommand drawIndexed;
+                        drawIndexed.type = RenderCommandType::DrawIndexed;
+                        drawIndexed.params.drawIndexed.indexCount = item.geometryData.indexCount;
+                        drawIndexed.params.drawIndexed.instanceCount = 1;
+                        drawIndexed.params.drawIndexed.firstIndex = item.geometryData.firstIndex;
+                        drawIndexed.params.drawIndexed.vertexOffset = static_cast<int32_t>(item.geometryData.firstVertex);
+                        drawIndexed.params.drawIndexed.firstInstance = 0;
+                        commandList.AddCommand(std::move(drawIndexed));
+                    } else {
+                        RenderCommand draw;
+                        draw.type = RenderCommandType::Draw;
+                        draw.params.draw.vertexCount = item.geometryData.vertexCount;
+                        draw.params.draw.instanceCount = 1;
+                        draw.params.draw.firstVertex = item.geometryData.firstVertex;
+                        draw.params.draw.firstInstance = 0;
+                        commandList.AddCommand(std::move(draw));
+                    }
+
+                    m_DrawCallCount++;
+                }
+            }
+
+            return commandList;
+        }
+
+        size_t SceneRenderer::PrewarmPipelines(Resources::Scene* scene, RHI::IRenderPass* renderPass,
+                                               const Shader::ShaderKeywordSet& passKeywords) {
+            if (!scene || !renderPass) {
+                return 0;
+            }
+
+            size_t pendingCount = 0;
+            std::set<ShadingMaterial*> visited;
+            for (Resources::Entity* entity : scene->GetAllEntities()) {
+                if (!entity) {
+                    continue;
+                }
+                for (const auto& component : entity->GetComponents()) {
+                    auto* shadingMaterial = component ? component->GetShadingMaterial() : nullptr;
+                    if (!shadingMaterial || !shadingMaterial->IsCreated() || !visited.insert(shadingMaterial).second) {
+                        continue;
+                    }
+                    if (!shadingMaterial->EnsurePipelineCreated(m_Device, renderPass, passKeywords)) {
+                        pendingCount++;
+                    }
+                }
+            }
+            return pendingCount;
+        }
+
         // MatchesRenderFlags is now handled by Components themselves
         // No need for this method in SceneRenderer anymore
 
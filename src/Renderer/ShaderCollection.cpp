@@ -47,25 +47,22 @@ namespace FirstEngine {
             return nullptr;
         }
 
-        void ShaderCollection::SetSPIRVCode(ShaderStage stage, const std::vector<uint32_t>& spirvCode) {
-            m_SPIRVCode[stage] = spirvCode;
+        void ShaderCollection::SetSPIRVCode(ShaderStage stage, std::vector<uint32_t> spirvCode) {
+            m_CodeHashes[stage] = Core::HashBytes128(spirvCode);
+            m_SPIRVCode[stage] = std::move(spirvCode);
         }
 
-        const std::string& ShaderCollection::GetMD5Hash(ShaderStage stage) const {
-            static const std::string empty;
-            auto it = m_MD5Hashes.find(stage);
-            if (it != m_MD5Hashes.end()) {
+        Core::Hash128 ShaderCollection::GetCodeHash(ShaderStage stage) const {
+            auto it = m_CodeHashes.find(stage);
+            if (it != m_CodeHashes.end()) {
                 return it->second;
             }
-            return empty;
-        }
-
-        void ShaderCollection::SetMD5Hash(ShaderStage stage, const std::string& hash) {
-            m_MD5Hashes[stage] = hash;
+            return Core::Hash128();
         }
 
         void ShaderCollection::SetShaderReflection(std::unique_ptr<Shader::ShaderReflection> reflection) {
             m_ShaderReflection = std::move(reflection);
+            m_Layout = m_ShaderReflection ? ShaderLayout::Build(*m_ShaderReflection) : nullptr;
         }
 
         bool ShaderCollection::IsValid() const {
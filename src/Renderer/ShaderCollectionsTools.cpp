@@ -1,12 +1,13 @@
 #include "FirstEngine/Renderer/ShaderCollectionsTools.h"
-#include "FirstEngine/Renderer/ShaderHash.h"
 #include "FirstEngine/Shader/ShaderSourceCompiler.h"
 #include "FirstEngine/Shader/ShaderCompiler.h"
+#include "FirstEngine/Core/ThreadManager.h"
 #include <fstream>
 #include <sstream>
 #include <iostream>
 #include <algorithm>
 #include <map>
+#include <chrono>
 #if __has_include(<filesystem>)
 #include <filesystem>
 namespace fs = std::filesystem;
@@ -18,6 +19,52 @@ namespace fs = std::experimental::filesystem;
 namespace FirstEngine {
     namespace Renderer {
 
+        namespace {
+            // Hash every file 'source' includes, recursively, resolving names against the including file's
+            // directory as the shader cache's compiles do. The scan is lexical, so includes inside keyword
+            // #ifdefs are covered for every variant; 'visited' stops include cycles and repeats.
+            void HashIncludes(const std::string& filepath, const std::string& source, Core::Hasher128& hasher,
+                              std::unordered_set<std::string>& visited) {
+                fs::path directory = fs::path(filepath).parent_path();
+                std::istringstream stream(source);
+                std::string line;
+                while (std::getline(stream, line)) {
+                    size_t pos = line.find_first_not_of(" \t");
+                    if (pos == std::string::npos || line[pos] != '#') {
+                        continue;
+                    }
+                    pos = line.find_first_not_of(" \t", pos + 1);
+                    if (pos == std::string::npos || line.compare(pos, 7, "include") != 0) {
+                        continue;
+                    }
+                    size_t open = line.find_first_of("\"<", pos + 7);
+                    if (open == std::string::npos) {
+                        continue;
+                    }
+                    size_t close = line.find(line[open] == '"' ? '"' : '>', open + 1);
+                    if (close == std::string::npos) {
+                        continue;
+                    }
+
+                    std::string includePath = (directory / line.substr(open + 1, close - open - 1)).string();
+                    if (!visited.insert(includePath).second) {
+                        continue;
+                    }
+                    std::ifstream file(includePath, std::ios::binary);
+                    if (!file.is_open()) {
+                        continue; // The compile reports it
+                    }
+                    std::stringstream buffer;
+                    buffer << file.rdbuf();
+                    std::string included = buffer.str();
+
+                    hasher.UpdateString(includePath);
+                    hasher.UpdateString(included);
+                    HashIncludes(includePath, included, hasher, visited);
+                }
+            }
+        }
+
         ShaderCollectionsTools* ShaderCollectionsTools::s_Instance = nullptr;
 
         ShaderCollectionsTools& ShaderCollectionsTools::GetInstance() {
@@ -42,23 +89,46 @@ namespace FirstEngine {
 
             m_ShaderDirectory = shaderDirectory;
 
+            if (!m_ShaderCacheConfigured) {
+                m_ShaderCache.SetDirectory((fs::path(shaderDirectory) / "Cache").string());
+            }
+
             // Load all shaders from directory
             if (!LoadAllShadersFromDirectory(shaderDirectory)) {
                 return false;
             }
 
+            // Precompile the permutations the package uses (generated by ShaderManager at package build time)
+            std::string manifestPath = shaderDirectory + "/" + kPermutationManifestFile;
+            if (fs::exists(manifestPath) && LoadPermutationManifest(manifestPath)) {
+                PrecompileVariants(m_PermutationManifest);
+            }
+
             m_Initialized = true;
             return true;
         }
 
+        void ShaderCollectionsTools::SetShaderCacheDirectory(const std::string& directory) {
+            m_ShaderCache.SetDirectory(directory);
+            m_ShaderCacheConfigured = true;
+        }
+
         void ShaderCollectionsTools::Cleanup() {
+            // Let in-flight variant compiles finish before their results would be registered
+            std::unique_lock<std::recursive_mutex> lock(m_Mutex);
+            m_VariantCondition.wait(lock, [this]() { return m_PendingVariants.empty(); });
+
             m_Collections.clear();
             m_NameToID.clear();
+            m_SourceInfos.clear();
+            m_VariantCache.clear();
+            m_PermutationManifest.Clear();
             m_ShaderDirectory.clear();
             m_Initialized = false;
         }
 
         ShaderCollection* ShaderCollectionsTools::GetCollection(uint64_t id) const {
+            std::lock_guard<std::recursive_mutex> lock(m_Mutex);
             auto it = m_Collections.find(id);
             if (it != m_Collections.end()) {
                 return it->second.get();
@@ -67,6 +137,7 @@ namespace FirstEngine {
         }
 
         ShaderCollection* ShaderCollectionsTools::GetCollectionByName(const std::string& name) const {
+            std::lock_guard<std::recursive_mutex> lock(m_Mutex);
             auto it = m_NameToID.find(name);
             if (it != m_NameToID.end()) {
                 return GetCollection(it->second);
@@ -79,6 +150,7 @@ namespace FirstEngine {
                 return 0;
             }
 
+            std::lock_guard<std::recursive_mutex> lock(m_Mutex);
             uint64_t id = m_NextID++;
             collection->SetID(id);
             
@@ -91,39 +163,38 @@ namespace FirstEngine {
             return id;
         }
 
-        uint64_t ShaderCollectionsTools::CreateCollectionFromFiles(const std::string& shaderName, const std::string& shaderDirectory) {
-            auto collection = std::make_unique<ShaderCollection>(shaderName, 0);
+        std::unique_ptr<ShaderCollection> ShaderCollectionsTools::BuildCollection(
+            const std::string& shaderName,
+            const std::string& shaderDirectory,
+            const Shader::ShaderKeywordSet& keywords) const {
+
+            // Variants are named "<Base>[KEYWORD_A KEYWORD_B]" so they never collide with base names
+            std::string collectionName = shaderName;
+            if (!keywords.IsEmpty()) {
+                collectionName += "[" + keywords.ToString() + "]";
+            }
+            auto collection = std::make_unique<ShaderCollection>(collectionName, 0);
+            collection->SetVariantInfo(shaderName, keywords);
+            auto defines = keywords.ToDefines();
 
-            std::vector<uint32_t> vertSPIRV;
-            std::vector<uint32_t> fragSPIRV;
+            Shader::ShaderCacheEntry vertEntry;
+            Shader::ShaderCacheEntry fragEntry;
 
             // Try to find and compile vertex shader
             std::string vertPath = shaderDirectory + "/" + shaderName + ".vert.hlsl";
-            if (fs::exists(vertPath)) {
-                vertSPIRV = CompileHLSLToSPIRV(vertPath, ShaderStage::Vertex);
-                if (!vertSPIRV.empty()) {
-                    collection->SetSPIRVCode(ShaderStage::Vertex, vertSPIRV);
-                    // Compute and store MD5 hash
-                    std::string md5Hash = ShaderHash::ComputeMD5(vertSPIRV);
-                    collection->SetMD5Hash(ShaderStage::Vertex, md5Hash);
-                }
+            if (fs::exists(vertPath) && CompileHLSLToSPIRV(vertPath, ShaderStage::Vertex, defines, vertEntry)) {
+                collection->SetSPIRVCode(ShaderStage::Vertex, std::move(vertEntry.spirv));
             }
 
             // Try to find and compile fragment shader
             std::string fragPath = shaderDirectory + "/" + shaderName + ".frag.hlsl";
-            if (fs::exists(fragPath)) {
-                fragSPIRV = CompileHLSLToSPIRV(fragPath, ShaderStage::Fragment);
-                if (!fragSPIRV.empty()) {
-                    collection->SetSPIRVCode(ShaderStage::Fragment, fragSPIRV);
-                    // Compute and store MD5 hash
-                    std::string md5Hash = ShaderHash::ComputeMD5(fragSPIRV);
-                    collection->SetMD5Hash(ShaderStage::Fragment, md5Hash);
-                }
+            if (fs::exists(fragPath) && CompileHLSLToSPIRV(fragPath, ShaderStage::Fragment, defines, fragEntry)) {
+                collection->SetSPIRVCode(ShaderStage::Fragment, std::move(fragEntry.spirv));
             }
 
             // Only add if collection has at least one shader
             if (collection->GetAvailableStages().empty()) {
-                return 0;
+                return nullptr;
             }
 
             // Parse shader reflection - merge vertex and fragment shader reflections
@@ -133,71 +204,61 @@ namespace FirstEngine {
             bool reflectionSuccess = false;
             
             // Get reflection from fragment shader (for textures and other resources)
-            if (!fragSPIRV.empty()) {
-                if (fragSPIRV.size() >= 5 && fragSPIRV[0] == 0x07230203) {
-                    try {
-                        Shader::ShaderCompiler fragCompiler(fragSPIRV);
-                        auto fragReflection = fragCompiler.GetReflection();
-                        
-                        // Copy texture-related resources from fragment shader
-                        mergedReflection.uniform_buffers = fragReflection.uniform_buffers; // Will be merged with vertex shader
-                        mergedReflection.samplers = fragReflection.samplers;
-                        mergedReflection.images = fragReflection.images;
-                        mergedReflection.storage_buffers = fragReflection.storage_buffers;
-                        mergedReflection.sampled_images = fragReflection.sampled_images;
-                        mergedReflection.separate_images = fragReflection.separate_images;
-                        mergedReflection.separate_samplers = fragReflection.separate_samplers;
-                        mergedReflection.push_constant_size = fragReflection.push_constant_size;
-                        mergedReflection.entry_point = fragReflection.entry_point;
-                        mergedReflection.language = fragReflection.language;
-                        
-                        reflectionSuccess = true;
-                    } catch (...) {
-                        // Failed to parse fragment shader reflection
-                    }
-                }
+            // Reflection comes from the shader cache as a cooked view; material code uses the classic
+            // structure, so each stage is materialized once here and its lists moved into the merged result
+            if (fragEntry.hasReflection) {
+                Shader::ShaderReflection fragReflection;
+                fragEntry.reflection.ToReflection(fragReflection);
+                
+                // Take texture-related resources from fragment shader
+                mergedReflection.uniform_buffers = std::move(fragReflection.uniform_buffers); // Will be merged with vertex shader
+                mergedReflection.samplers = std::move(fragReflection.samplers);
+                mergedReflection.images = std::move(fragReflection.images);
+                mergedReflection.storage_buffers = std::move(fragReflection.storage_buffers);
+                mergedReflection.sampled_images = std::move(fragReflection.sampled_images);
+                mergedReflection.separate_images = std::move(fragReflection.separate_images);
+                mergedReflection.separate_samplers = std::move(fragReflection.separate_samplers);
+                mergedReflection.push_constant_size = fragReflection.push_constant_size;
+                mergedReflection.entry_point = std::move(fragReflection.entry_point);
+                mergedReflection.language = fragReflection.language;
+                
+                reflectionSuccess = true;
             }
             
             // Get vertex inputs and uniform buffers from vertex shader
             // CRITICAL: vertex inputs must come from vertex shader, not fragment shader
             // Also merge uniform buffers from vertex shader (e.g., PerObject, PerFrame in Set 1)
-            if (!vertSPIRV.empty()) {
-                if (vertSPIRV.size() >= 5 && vertSPIRV[0] == 0x07230203) {
-                    try {
-                        Shader::ShaderCompiler vertCompiler(vertSPIRV);
-                        auto vertReflection = vertCompiler.GetReflection();
-                        
-                        // Copy vertex inputs from vertex shader (these are the actual vertex attributes)
-                        mergedReflection.stage_inputs = vertReflection.stage_inputs;
-                        
-                        // Also copy vertex shader outputs (for reference, though typically not used for vertex input parsing)
-                        mergedReflection.stage_outputs = vertReflection.stage_outputs;
-                        
-                        // Merge uniform buffers from vertex shader (e.g., PerObject, PerFrame)
-                        // Use a map to avoid duplicates (same set and binding)
-                        std::map<std::pair<uint32_t, uint32_t>, Shader::UniformBuffer> uniformBufferMap;
-                        
-                        // Add fragment shader uniform buffers first
-                        for (const auto& ub : mergedReflection.uniform_buffers) {
-                            uniformBufferMap[{ub.set, ub.binding}] = ub;
-                        }
-                        
-                        // Add vertex shader uniform buffers (will overwrite if same set/binding, which is correct)
-                        for (const auto& ub : vertReflection.uniform_buffers) {
-                            uniformBufferMap[{ub.set, ub.binding}] = ub;
-                        }
-                        
-                        // Convert map back to vector
-                        mergedReflection.uniform_buffers.clear();
-                        for (const auto& [_, ub] : uniformBufferMap) {
-                            mergedReflection.uniform_buffers.push_back(ub);
-                        }
-                        
-                        reflectionSuccess = true;
-                    } catch (...) {
-                        // Failed to parse vertex shader reflection
-                    }
+            if (vertEntry.hasReflection) {
+                Shader::ShaderReflection vertReflection;
+                vertEntry.reflection.ToReflection(vertReflection);
+                
+                // Take vertex inputs from vertex shader (these are the actual vertex attributes)
+                mergedReflection.stage_inputs = std::move(vertReflection.stage_inputs);
+                
+                // Also take vertex shader outputs (for reference, though typically not used for vertex input parsing)
+                mergedReflection.stage_outputs = std::move(vertReflection.stage_outputs);
+                
+                // Merge uniform buffers from vertex shader (e.g., PerObject, PerFrame)
+                // Use a map to avoid duplicates (same set and binding)
+                std::map<std::pair<uint32_t, uint32_t>, Shader::UniformBuffer> uniformBufferMap;
+                
+                // Add fragment shader uniform buffers first
+                for (auto& ub : mergedReflection.uniform_buffers) {
+                    uniformBufferMap[{ub.set, ub.binding}] = std::move(ub);
                 }
+                
+                // Add vertex shader uniform buffers (will overwrite if same set/binding, which is correct)
+                for (auto& ub : vertReflection.uniform_buffers) {
+                    uniformBufferMap[{ub.set, ub.binding}] = std::move(ub);
+                }
+                
+                // Convert map back to vector
+                mergedReflection.uniform_buffers.clear();
+                for (auto& [_, ub] : uniformBufferMap) {
+                    mergedReflection.uniform_buffers.push_back(std::move(ub));
+                }
+                
+                reflectionSuccess = true;
             }
             
             // Store merged reflection in collection
@@ -209,7 +270,241 @@ namespace FirstEngine {
                 // Failed to parse reflection, but collection is still valid without reflection
             }
 
-            return AddCollection(std::move(collection));
+            return collection;
+        }
+
+        ShaderCollectionsTools::ShaderSourceInfo ShaderCollectionsTools::BuildSourceInfo(
+            const std::string& shaderName,
+            const std::string& shaderDirectory) const {
+            // Remember where the sources live and which keywords they declare, for compiling permutations later
+            ShaderSourceInfo sourceInfo;
+            sourceInfo.directory = shaderDirectory;
+            // Included files are part of the hash, so editing one gives its users new variant keys
+            Core::Hasher128 hasher;
+            std::unordered_set<std::string> visitedIncludes;
+            for (const char* stageSuffix : {".vert.hlsl", ".frag.hlsl"}) {
+                std::string path = shaderDirectory + "/" + shaderName + stageSuffix;
+                std::string source = LoadShaderFile(path);
+                hasher.UpdateString(source);
+                HashIncludes(path, source, hasher, visitedIncludes);
+                sourceInfo.declaredKeywords.Merge(Shader::ParseDeclaredKeywords(source));
+            }
+            sourceInfo.sourceHash = hasher.Finalize().low;
+            return sourceInfo;
+        }
+
+        uint64_t ShaderCollectionsTools::RegisterBaseCollection(
+            const std::string& shaderName,
+            const ShaderSourceInfo& sourceInfo,
+            std::unique_ptr<ShaderCollection> collection) {
+            if (!collection) {
+                return 0;
+            }
+
+            std::lock_guard<std::recursive_mutex> lock(m_Mutex);
+            m_SourceInfos[shaderName] = sourceInfo;
+            uint64_t id = AddCollection(std::move(collection));
+            m_VariantCache[{sourceInfo.sourceHash, Shader::ShaderKeywordSet().GetHash()}] = id;
+            return id;
+        }
+
+        uint64_t ShaderCollectionsTools::CreateCollectionFromFiles(const std::string& shaderName, const std::string& shaderDirectory) {
+            auto collection = BuildCollection(shaderName, shaderDirectory, Shader::ShaderKeywordSet());
+            if (!collection) {
+                return 0;
+            }
+            return RegisterBaseCollection(shaderName, BuildSourceInfo(shaderName, shaderDirectory), std::move(collection));
+        }
+
+        bool ShaderCollectionsTools::ResolveVariant(
+            uint64_t baseCollectionID,
+            const Shader::ShaderKeywordSet& keywords,
+            std::string& outBaseName,
+            Shader::ShaderKeywordSet& outEffectiveKeywords,
+            VariantKey& outKey) const {
+
+            std::lock_guard<std::recursive_mutex> lock(m_Mutex);
+            auto* base = GetCollection(baseCollectionID);
+            if (!base) {
+                return false;
+            }
+
+            outBaseName = base->GetBaseName();
+            auto infoIt = m_SourceInfos.find(outBaseName);
+            if (infoIt == m_SourceInfos.end()) {
+                return false;
+            }
+
+            // Variants of variants are resolved from the base sources with the combined keywords
+            outEffectiveKeywords = base->GetKeywords();
+            outEffectiveKeywords.Merge(keywords);
+            outEffectiveKeywords = outEffectiveKeywords.Filtered(infoIt->second.declaredKeywords);
+
+            // Stripped permutation: fall back to the base shader
+            if (!outEffectiveKeywords.IsEmpty() && !m_PermutationManifest.IsEmpty() &&
+                !m_PermutationManifest.Contains(outBaseName, outEffectiveKeywords)) {
+                std::cerr << "ShaderCollectionsTools: Permutation " << outBaseName << " [" << outEffectiveKeywords.ToString()
+                          << "] was stripped from the package, using base shader" << std::endl;
+                outEffectiveKeywords.Clear();
+            }
+
+            outKey.sourceHash = infoIt->second.sourceHash;
+            outKey.keywordHash = outEffectiveKeywords.GetHash();
+            return true;
+        }
+
+        uint64_t ShaderCollectionsTools::RegisterVariant(const VariantKey& key, std::unique_ptr<ShaderCollection> variant) {
+            uint64_t id = variant ? AddCollection(std::move(variant)) : 0;
+            m_VariantCache[key] = id;
+            return id;
+        }
+
+        uint64_t ShaderCollectionsTools::GetOrCreateVariant(uint64_t baseCollectionID, const Shader::ShaderKeywordSet& keywords) {
+            std::string baseName;
+            Shader::ShaderKeywordSet effectiveKeywords;
+            VariantKey key;
+            if (!ResolveVariant(baseCollectionID, keywords, baseName, effectiveKeywords, key)) {
+                return 0;
+            }
+
+            std::string directory;
+            {
+                std::lock_guard<std::recursive_mutex> lock(m_Mutex);
+                auto it = m_VariantCache.find(key);
+                if (it != m_VariantCache.end()) {
+                    return it->second;
+                }
+                directory = m_SourceInfos[baseName].directory;
+            }
+
+            // Wait for a worker that is already compiling this variant instead of compiling it twice
+            {
+                std::unique_lock<std::recursive_mutex> lock(m_Mutex);
+                m_VariantCondition.wait(lock, [this, &key]() { return m_PendingVariants.find(key) == m_PendingVariants.end(); });
+                auto it = m_VariantCache.find(key);
+                if (it != m_VariantCache.end()) {
+                    return it->second;
+                }
+            }
+
+            // Compile outside the lock (slow), then register
+            auto variant = BuildCollection(baseName, directory, effectiveKeywords);
+            if (!variant) {
+                std::cerr << "ShaderCollectionsTools: Failed to compile variant " << baseName
+                          << " [" << effectiveKeywords.ToString() << "]" << std::endl;
+            }
+
+            std::lock_guard<std::recursive_mutex> lock(m_Mutex);
+            auto it = m_VariantCache.find(key);
+            if (it != m_VariantCache.end()) {
+                return it->second;
+            }
+            return RegisterVariant(key, std::move(variant));
+        }
+
+        uint64_t ShaderCollectionsTools::RequestVariant(uint64_t baseCollectionID, const Shader::ShaderKeywordSet& keywords) {
+            std::string baseName;
+            Shader::ShaderKeywordSet effectiveKeywords;
+            VariantKey key;
+            if (!ResolveVariant(baseCollectionID, keywords, baseName, effectiveKeywords, key)) {
+                return 0;
+            }
+
+            // No worker pool: compile synchronously
+            if (!Core::ThreadManager::IsInitialized()) {
+                return GetOrCreateVariant(baseCollectionID, keywords);
+            }
+
+            std::string directory;
+            {
+                std::lock_guard<std::recursive_mutex> lock(m_Mutex);
+                auto it = m_VariantCache.find(key);
+                if (it != m_VariantCache.end()) {
+                    return it->second;
+                }
+                if (m_PendingVariants.find(key) != m_PendingVariants.end()) {
+                    return 0;
+                }
+                directory = m_SourceInfos[baseName].directory;
+                m_PendingVariants.insert(key);
+            }
+
+            // The key must leave m_PendingVariants on every path, or GetOrCreateVariant and Cleanup wait forever
+            try {
+                Core::ThreadManager::GetInstance().InvokeOnWorker([this, key, baseName, directory, effectiveKeywords]() {
+                    std::unique_ptr<ShaderCollection> variant;
+                    try {
+                        variant = BuildCollection(baseName, directory, effectiveKeywords);
+                    } catch (const std::exception& e) {
+                        std::cerr << "ShaderCollectionsTools: Failed to compile variant " << baseName
+                                  << " [" << effectiveKeywords.ToString() << "]: " << e.what() << std::endl;
+                    }
+                    // A failed compile is registered as 0 so it is not retried every frame
+                    FinishPendingVariant(key, std::move(variant));
+                });
+            } catch (const std::exception& e) {
+                std::cerr << "ShaderCollectionsTools::RequestVariant: Cannot queue variant " << baseName
+                          << " on a worker (" << e.what() << "), compiling it synchronously" << std::endl;
+                {
+                    std::lock_guard<std::recursive_mutex> lock(m_Mutex);
+                    m_PendingVariants.erase(key);
+                }
+                m_VariantCondition.notify_all();
+                return GetOrCreateVariant(baseCollectionID, keywords);
+            }
+            return 0;
+        }
+
+        void ShaderCollectionsTools::FinishPendingVariant(const VariantKey& key, std::unique_ptr<ShaderCollection> variant) {
+            {
+                std::lock_guard<std::recursive_mutex> lock(m_Mutex);
+                m_PendingVariants.erase(key);
+                RegisterVariant(key, std::move(variant));
+            }
+            m_VariantCondition.notify_all();
+        }
+
+        size_t ShaderCollectionsTools::PrecompileVariants(const Shader::ShaderPermutationManifest& manifest) {
+            // Queue every permutation on the worker pool, then wait for all of them
+            std::vector<std::pair<uint64_t, Shader::ShaderKeywordSet>> requests;
+            for (const auto& entry : manifest.GetEntries()) {
+                auto* base = GetCollectionByName(entry.shaderName);
+                if (!base) {
+                    std::cerr << "ShaderCollectionsTools: Permutation references unknown shader: " << entry.shaderName << std::endl;
+                    continue;
+                }
+                requests.push_back({base->GetID(), entry.keywords});
+                RequestVariant(base->GetID(), entry.keywords);
+            }
+
+            size_t available = 0;
+            for (const auto& request : requests) {
+                // Blocks until the queued compile has been registered
+                if (GetOrCreateVariant(request.first, request.second) != 0) {
+                    available++;
+                }
+            }
+            return available;
+        }
+
+        bool ShaderCollectionsTools::LoadPermutationManifest(const std::string& filepath) {
+            Shader::ShaderPermutationManifest manifest;
+            if (!manifest.LoadFromFile(filepath)) {
+                return false;
+            }
+            std::lock_guard<std::recursive_mutex> lock(m_Mutex);
+            m_PermutationManifest = std::move(manifest);
+            return true;
+        }
+
+        Shader::ShaderKeywordSet ShaderCollectionsTools::GetDeclaredKeywords(uint64_t collectionID) const {
+            std::lock_guard<std::recursive_mutex> lock(m_Mutex);
+            auto* collection = GetCollection(collectionID);
+            if (!collection) {
+                return Shader::ShaderKeywordSet();
+            }
+            auto it = m_SourceInfos.find(collection->GetBaseName());
+            return it != m_SourceInfos.end() ? it->second.declaredKeywords : Shader::ShaderKeywordSet();
         }
 
         bool ShaderCollectionsTools::LoadAllShadersFromDirectory(const std::string& shaderDirectory) {
@@ -241,16 +536,60 @@ namespace FirstEngine {
                 }
             }
 
-            // Create collections for each shader name
+            // Sorted names keep collection IDs stable between runs
+            std::vector<std::string> shaderNames;
             for (const auto& pair : shaderFiles) {
-                const std::string& shaderName = pair.first;
-                CreateCollectionFromFiles(shaderName, shaderDirectory);
+                shaderNames.push_back(pair.first);
+            }
+            std::sort(shaderNames.begin(), shaderNames.end());
+
+            // Build collections in parallel (cache hits only read from disk, misses compile on a worker)
+            struct BuiltShader {
+                std::unique_ptr<ShaderCollection> collection;
+                ShaderSourceInfo sourceInfo;
+            };
+            std::vector<BuiltShader> built(shaderNames.size());
+            auto buildShader = [this, &built, &shaderNames, &shaderDirectory](size_t index) {
+                built[index].collection = BuildCollection(shaderNames[index], shaderDirectory, Shader::ShaderKeywordSet());
+                built[index].sourceInfo = BuildSourceInfo(shaderNames[index], shaderDirectory);
+            };
+
+            auto startTime = std::chrono::steady_clock::now();
+            auto statsBefore = m_ShaderCache.GetStats();
+
+            if (Core::ThreadManager::IsInitialized() && shaderNames.size() > 1) {
+                std::vector<Core::Future<void>> futures;
+                futures.reserve(shaderNames.size());
+                for (size_t i = 0; i < shaderNames.size(); ++i) {
+                    futures.push_back(Core::ThreadManager::GetInstance().InvokeOnWorker([&buildShader, i]() {
+                        buildShader(i);
+                    }));
+                }
+                for (auto& future : futures) {
+                    future.get();
+                }
+            } else {
+                for (size_t i = 0; i < shaderNames.size(); ++i) {
+                    buildShader(i);
+                }
+            }
+
+            // Register on the calling thread, in name order
+            for (size_t i = 0; i < shaderNames.size(); ++i) {
+                RegisterBaseCollection(shaderNames[i], built[i].sourceInfo, std::move(built[i].collection));
             }
 
+            auto statsAfter = m_ShaderCache.GetStats();
+            double elapsedMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - startTime).count();
+            std::cout << "ShaderCollectionsTools: Loaded " << shaderNames.size() << " shaders in " << elapsedMs << " ms ("
+                      << (statsAfter.hits - statsBefore.hits) << " cached, "
+                      << (statsAfter.misses - statsBefore.misses) << " compiled)" << std::endl;
+
             return true;
         }
 
         std::vector<uint64_t> ShaderCollectionsTools::GetAllCollectionIDs() const {
+            std::lock_guard<std::recursive_mutex> lock(m_Mutex);
             std::vector<uint64_t> ids;
             ids.reserve(m_Collections.size());
             for (const auto& pair : m_Collections) {
@@ -267,12 +606,12 @@ namespace FirstEngine {
             return nullptr;
         }
 
-        std::string ShaderCollectionsTools::GetShaderMD5(uint64_t collectionID, ShaderStage stage) const {
+        Core::Hash128 ShaderCollectionsTools::GetShaderCodeHash(uint64_t collectionID, ShaderStage stage) const {
             auto* collection = GetCollection(collectionID);
             if (collection) {
-                return collection->GetMD5Hash(stage);
+                return collection->GetCodeHash(stage);
             }
-            return "";
+            return Core::Hash128();
         }
 
         ShaderStage ShaderCollectionsTools::DetectShaderStage(const std::string& filename) const {
@@ -296,54 +635,33 @@ namespace FirstEngine {
             return ShaderStage::Vertex; // Default
         }
 
-        std::vector<uint32_t> ShaderCollectionsTools::CompileHLSLToSPIRV(const std::string& filepath, ShaderStage stage) const {
-            FirstEngine::Shader::ShaderSourceCompiler compiler;
-            
-            // Set compile options
-            FirstEngine::Shader::CompileOptions options;
-            options.language = FirstEngine::Shader::ShaderSourceLanguage::HLSL;
-            
+        bool ShaderCollectionsTools::CompileHLSLToSPIRV(
+            const std::string& filepath,
+            ShaderStage stage,
+            const std::vector<std::pair<std::string, std::string>>& defines,
+            Shader::ShaderCacheEntry& outEntry) const {
             // Map Renderer::ShaderStage to Shader::ShaderStage
+            FirstEngine::Shader::ShaderStage shaderStage = FirstEngine::Shader::ShaderStage::Vertex;
             switch (stage) {
-                case ShaderStage::Vertex:
-                    options.stage = FirstEngine::Shader::ShaderStage::Vertex;
-                    options.target_profile = "vs_6_0";
-                    break;
-                case ShaderStage::Fragment:
-                    options.stage = FirstEngine::Shader::ShaderStage::Fragment;
-                    options.target_profile = "ps_6_0";
-                    break;
-                case ShaderStage::Geometry:
-                    options.stage = FirstEngine::Shader::ShaderStage::Geometry;
-                    options.target_profile = "gs_6_0";
-                    break;
-                case ShaderStage::Compute:
-                    options.stage = FirstEngine::Shader::ShaderStage::Compute;
-                    options.target_profile = "cs_6_0";
-                    break;
-                case ShaderStage::TessellationControl:
-                    options.stage = FirstEngine::Shader::ShaderStage::TessellationControl;
-                    options.target_profile = "hs_6_0";
-                    break;
-                case ShaderStage::TessellationEvaluation:
-                    options.stage = FirstEngine::Shader::ShaderStage::TessellationEvaluation;
-                    options.target_profile = "ds_6_0";
-                    break;
+                case ShaderStage::Vertex: shaderStage = FirstEngine::Shader::ShaderStage::Vertex; break;
+                case ShaderStage::Fragment: shaderStage = FirstEngine::Shader::ShaderStage::Fragment; break;
+                case ShaderStage::Geometry: shaderStage = FirstEngine::Shader::ShaderStage::Geometry; break;
+                case ShaderStage::Compute: shaderStage = FirstEngine::Shader::ShaderStage::Compute; break;
+                case ShaderStage::TessellationControl: shaderStage = FirstEngine::Shader::ShaderStage::TessellationControl; break;
+                case ShaderStage::TessellationEvaluation: shaderStage = FirstEngine::Shader::ShaderStage::TessellationEvaluation; break;
             }
-            
-            options.entry_point = "main";
-            options.optimization_level = 1;
 
-            // Compile from file
-            auto result = compiler.CompileFromFileAuto(filepath, options);
-            
-            if (result.success) {
-                return result.spirv_code;
-            } else {
+            // Same options as the ShaderManager cook command, so cooked cache entries are hits here
+            FirstEngine::Shader::CompileOptions options = Shader::ShaderCache::GetEngineCompileOptions(shaderStage, defines);
+
+            // Compile from file (or load SPIR-V + reflection from the shader cache)
+            std::string errorMessage;
+            if (!m_ShaderCache.CompileFile(filepath, options, outEntry, &errorMessage)) {
                 std::cerr << "Failed to compile shader: " << filepath << std::endl;
-                std::cerr << "Error: " << result.error_message << std::endl;
-                return std::vector<uint32_t>();
+                std::cerr << "Error: " << errorMessage << std::endl;
+                return false;
             }
+            return !outEntry.spirv.empty();
         }
 
         std::string ShaderCollectionsTools::LoadShaderFile(const std::string& filepath) const {
@@ -0,0 +1,480 @@
+#include "FirstEngine/Renderer/ShaderLayout.h"
+
+namespace FirstEngine {
+    namespace Renderer {
+
+        // ============================================================================
+        // Helper function: Map SPIR-V types to RHI Format
+        // ============================================================================
+        // 
+        // Parameter description:
+        //   - basetype: SPIRType base type
+        //     * 3 = Int (signed integer)
+        //     * 4 = UInt (unsigned integer)
+        //     * 5 = Float (floating point)
+        //   - width: Type width (bits)
+        //     * 8 = 8 bits (int8, uint8, float8)
+        //     * 16 = 16 bits (int16, uint16, float16/half)
+        //     * 32 = 32 bits (int32, uint32, float32)
+        //     * 64 = 64 bits (int64, uint64, float64/double)
+        //   - vecsize: Vector size
+        //     * 1 = scalar (e.g., float, int)
+        //     * 2 = vec2 (2-component vector, e.g., vec2, float2)
+        //     * 3 = vec3 (3-component vector, e.g., vec3, float3)
+        //     * 4 = vec4 (4-component vector, e.g., vec4, float4)
+        //
+        // Return value:
+        //   RHI::Format - Corresponding vertex attribute format
+        //
+        // Format usage:
+        //   - Determines vertex attribute layout and size in memory
+        //   - Used to create VkVertexInputAttributeDescription
+        //   - Affects how vertex data is read and interpreted
+        //   - Example: vec3 float32 -> 12 bytes, vec4 float32 -> 16 bytes
+        //
+        // Note:
+        //   Current implementation uses R8G8B8A8_UNORM as a generic format (4 bytes),
+        //   For non-4-byte aligned types like vec3 (12 bytes), may need adjustment
+        // ============================================================================
+        static RHI::Format MapTypeToFormat(uint32_t basetype, uint32_t width, uint32_t vecsize) {
+            // basetype: SPIRType::BaseType enum values
+            // width: 8, 16, 32, 64 bits
+            // vecsize: 1=scalar, 2=vec2, 3=vec3, 4=vec4
+            //
+            // SPIRType::BaseType enum:
+            //   0=Unknown, 1=Void, 2=Boolean, 3=SByte, 4=UByte, 5=Short, 6=UShort,
+            //   7=Int, 8=UInt, 9=Int64, 10=UInt64, 11=AtomicCounter,
+            //   12=Half, 13=Float, 14=Double, ...
+            
+            // ============================================================================
+            // Float types (13=Float, 12=Half, 14=Double)
+            // ============================================================================
+            if (basetype == 13) { // SPIRType::Float (32-bit float)
+                if (width == 32) {
+                    switch (vecsize) {
+                        case 1: return RHI::Format::R32_SFLOAT;
+                        case 2: return RHI::Format::R32G32_SFLOAT;
+                        case 3: return RHI::Format::R32G32B32_SFLOAT;
+                        case 4: return RHI::Format::R32G32B32A32_SFLOAT;
+                        default: return RHI::Format::R32_SFLOAT;
+                    }
+                } else if (width == 16) {
+                    // 32-bit float type but 16-bit width (unusual, treat as half)
+                    switch (vecsize) {
+                        case 1: return RHI::Format::R16_SFLOAT;
+                        case 2: return RHI::Format::R16G16_SFLOAT;
+                        case 3: return RHI::Format::R16G16B16_SFLOAT;
+                        case 4: return RHI::Format::R16G16B16A16_SFLOAT;
+                        default: return RHI::Format::R16_SFLOAT;
+                    }
+                } else if (width == 64) {
+                    // 64-bit float (double precision)
+                    switch (vecsize) {
+                        case 1: return RHI::Format::R64_SFLOAT;
+                        case 2: return RHI::Format::R64G64_SFLOAT;
+                        case 3: return RHI::Format::R64G64B64_SFLOAT;
+                        case 4: return RHI::Format::R64G64B64A64_SFLOAT;
+                        default: return RHI::Format::R64_SFLOAT;
+                    }
+                } else {
+                    // Unknown width: Default to 16-bit (2 bytes per component)
+                    switch (vecsize) {
+                        case 1: return RHI::Format::R16_SFLOAT;
+                        case 2: return RHI::Format::R16G16_SFLOAT;
+                        case 3: return RHI::Format::R16G16B16_SFLOAT;
+                        case 4: return RHI::Format::R16G16B16A16_SFLOAT;
+                        default: return RHI::Format::R16_SFLOAT;
+                    }
+                }
+            } else if (basetype == 12) { // SPIRType::Half (16-bit float)
+                switch (vecsize) {
+                    case 1: return RHI::Format::R16_SFLOAT;
+                    case 2: return RHI::Format::R16G16_SFLOAT;
+                    case 3: return RHI::Format::R16G16B16_SFLOAT;
+                    case 4: return RHI::Format::R16G16B16A16_SFLOAT;
+                    default: return RHI::Format::R16_SFLOAT;
+                }
+            } else if (basetype == 14) { // SPIRType::Double (64-bit float)
+                switch (vecsize) {
+                    case 1: return RHI::Format::R64_SFLOAT;
+                    case 2: return RHI::Format::R64G64_SFLOAT;
+                    case 3: return RHI::Format::R64G64B64_SFLOAT;
+                    case 4: return RHI::Format::R64G64B64A64_SFLOAT;
+                    default: return RHI::Format::R64_SFLOAT;
+                }
+            }
+            // ============================================================================
+            // Signed Integer types (7=Int, 5=Short, 3=SByte, 9=Int64)
+            // ============================================================================
+            else if (basetype == 7) { // SPIRType::Int (32-bit signed integer)
+                if (width == 32) {
+                    switch (vecsize) {
+                        case 1: return RHI::Format::R32_SINT;
+                        case 2: return RHI::Format::R32G32_SINT;
+                        case 3: return RHI::Format::R32G32B32_SINT;
+                        case 4: return RHI::Format::R32G32B32A32_SINT;
+                        default: return RHI::Format::R32_SINT;
+                    }
+                } else if (width == 16) {
+                    switch (vecsize) {
+                        case 1: return RHI::Format::R16_SINT;
+                        case 2: return RHI::Format::R16G16_SINT;
+                        case 3: return RHI::Format::R16G16B16_SINT;
+                        case 4: return RHI::Format::R16G16B16A16_SINT;
+                        default: return RHI::Format::R16_SINT;
+                    }
+                } else if (width == 8) {
+                    switch (vecsize) {
+                        case 1: return RHI::Format::R8_SINT;
+                        case 2: return RHI::Format::R8G8_SINT;
+                        case 3: return RHI::Format::R8G8B8A8_SINT; // vec3 uses vec4 format
+                        case 4: return RHI::Format::R8G8B8A8_SINT;
+                        default: return RHI::Format::R8_SINT;
+                    }
+                } else if (width == 64) {
+                    switch (vecsize) {
+                        case 1: return RHI::Format::R64_SINT;
+                        case 2: return RHI::Format::R64G64_SINT;
+                        case 3: return RHI::Format::R64G64B64_SINT;
+                        case 4: return RHI::Format::R64G64B64A64_SINT;
+                        default: return RHI::Format::R64_SINT;
+                    }
+                } else {
+                    // Unknown width: Default to 32-bit
+                    switch (vecsize) {
+                        case 1: return RHI::Format::R32_SINT;
+                        case 2: return RHI::Format::R32G32_SINT;
+                        case 3: return RHI::Format::R32G32B32_SINT;
+                        case 4: return RHI::Format::R32G32B32A32_SINT;
+                        default: return RHI::Format::R32_SINT;
+                    }
+                }
+            } else if (basetype == 5) { // SPIRType::Short (16-bit signed integer)
+                switch (vecsize) {
+                    case 1: return RHI::Format::R16_SINT;
+                    case 2: return RHI::Format::R16G16_SINT;
+                    case 3: return RHI::Format::R16G16B16_SINT;
+                    case 4: return RHI::Format::R16G16B16A16_SINT;
+                    default: return RHI::Format::R16_SINT;
+                }
+            } else if (basetype == 3) { // SPIRType::SByte (8-bit signed integer)
+                switch (vecsize) {
+                    case 1: return RHI::Format::R8_SINT;
+                    case 2: return RHI::Format::R8G8_SINT;
+                    case 3: return RHI::Format::R8G8B8A8_SINT; // vec3 uses vec4 format
+                    case 4: return RHI::Format::R8G8B8A8_SINT;
+                    default: return RHI::Format::R8_SINT;
+                }
+            } else if (basetype == 9) { // SPIRType::Int64 (64-bit signed integer)
+                switch (vecsize) {
+                    case 1: return RHI::Format::R64_SINT;
+                    case 2: return RHI::Format::R64G64_SINT;
+                    case 3: return RHI::Format::R64G64B64_SINT;
+                    case 4: return RHI::Format::R64G64B64A64_SINT;
+                    default: return RHI::Format::R64_SINT;
+                }
+            }
+            // ============================================================================
+            // Unsigned Integer types (8=UInt, 6=UShort, 4=UByte, 10=UInt64)
+            // ============================================================================
+            else if (basetype == 8) { // SPIRType::UInt (32-bit unsigned integer)
+                if (width == 32) {
+                    switch (vecsize) {
+                        case 1: return RHI::Format::R32_UINT;
+                        case 2: return RHI::Format::R32G32_UINT;
+                        case 3: return RHI::Format::R32G32B32_UINT;
+                        case 4: return RHI::Format::R32G32B32A32_UINT;
+                        default: return RHI::Format::R32_UINT;
+                    }
+                } else if (width == 16) {
+                    switch (vecsize) {
+                        case 1: return RHI::Format::R16_UINT;
+                        case 2: return RHI::Format::R16G16_UINT;
+                        case 3: return RHI::Format::R16G16B16_UINT;
+                        case 4: return RHI::Format::R16G16B16A16_UINT;
+                        default: return RHI::Format::R16_UINT;
+                    }
+                } else if (width == 8) {
+                    switch (vecsize) {
+                        case 1: return RHI::Format::R8_UINT;
+                        case 2: return RHI::Format::R8G8_UINT;
+                        case 3: return RHI::Format::R8G8B8A8_UINT; // vec3 uses vec4 format
+                        case 4: return RHI::Format::R8G8B8A8_UINT;
+                        default: return RHI::Format::R8_UINT;
+                    }
+                } else if (width == 64) {
+                    switch (vecsize) {
+                        case 1: return RHI::Format::R64_UINT;
+                        case 2: return RHI::Format::R64G64_UINT;
+                        case 3: return RHI::Format::R64G64B64_UINT;
+                        case 4: return RHI::Format::R64G64B64A64_UINT;
+                        default: return RHI::Format::R64_UINT;
+                    }
+                } else {
+                    // Unknown width: Default to 32-bit
+                    switch (vecsize) {
+                        case 1: return RHI::Format::R32_UINT;
+                        case 2: return RHI::Format::R32G32_UINT;
+                        case 3: return RHI::Format::R32G32B32_UINT;
+                        case 4: return RHI::Format::R32G32B32A32_UINT;
+                        default: return RHI::Format::R32_UINT;
+                    }
+                }
+            } else if (basetype == 6) { // SPIRType::UShort (16-bit unsigned integer)
+                switch (vecsize) {
+                    case 1: return RHI::Format::R16_UINT;
+                    case 2: return RHI::Format::R16G16_UINT;
+                    case 3: return RHI::Format::R16G16B16_UINT;
+                    case 4: return RHI::Format::R16G16B16A16_UINT;
+                    default: return RHI::Format::R16_UINT;
+                }
+            } else if (basetype == 4) { // SPIRType::UByte (8-bit unsigned integer)
+                switch (vecsize) {
+                    case 1: return RHI::Format::R8_UINT;
+                    case 2: return RHI::Format::R8G8_UINT;
+                    case 3: return RHI::Format::R8G8B8A8_UINT; // vec3 uses vec4 format
+                    case 4: return RHI::Format::R8G8B8A8_UINT;
+                    default: return RHI::Format::R8_UINT;
+                }
+            } else if (basetype == 10) { // SPIRType::UInt64 (64-bit unsigned integer)
+                switch (vecsize) {
+                    case 1: return RHI::Format::R64_UINT;
+                    case 2: return RHI::Format::R64G64_UINT;
+                    case 3: return RHI::Format::R64G64B64_UINT;
+                    case 4: return RHI::Format::R64G64B64A64_UINT;
+                    default: return RHI::Format::R64_UINT;
+                }
+            }
+            
+            // ============================================================================
+            // Default fallback: use 16-bit float (2 bytes per component)
+            // This matches typical geometry data and provides good precision/performance balance
+            // ============================================================================
+            switch (vecsize) {
+                case 1: return RHI::Format::R16_SFLOAT;
+                case 2: return RHI::Format::R16G16_SFLOAT;
+                case 3: return RHI::Format::R16G16B16_SFLOAT;
+                case 4: return RHI::Format::R16G16B16A16_SFLOAT;
+                default: return RHI::Format::R16_SFLOAT;
+            }
+        }
+
+        // ============================================================================
+        // Helper function: Calculate format byte size
+        // ============================================================================
+        // 
+        // Parameter description:
+        //   - format: RHI::Format enum value, represents vertex attribute data format
+        //
+        // Return value:
+        //   uint32_t - Number of bytes occupied by the format
+        //
+        // Format description:
+        //   - R8G8B8A8_UNORM: 4 8-bit unsigned normalized channels (R, G, B, A) = 4 bytes
+        //   - R8G8B8A8_SRGB: 4 8-bit sRGB channels (R, G, B, A) = 4 bytes
+        //   - B8G8R8A8_UNORM: 4 8-bit unsigned normalized channels (B, G, R, A) = 4 bytes
+        //   - B8G8R8A8_SRGB: 4 8-bit sRGB channels (B, G, R, A) = 4 bytes
+        //   - D32_SFLOAT: 32-bit depth floating point = 4 bytes
+        //   - D24_UNORM_S8_UINT: 24-bit depth + 8-bit stencil = 4 bytes (packed)
+        //
+        // Size usage:
+        //   - Used to calculate vertex attribute offset in buffer
+        //   - Used to calculate vertex data stride
+        //   - Ensures GPU can correctly read and interpret vertex data
+        //   - Affects memory alignment and performance (some formats may require specific alignment)
+        //
+        // Note:
+        //   - Format size must match actual vertex data layout
+        //   - Some formats may need to consider alignment requirements (e.g., 16-byte alignment)
+        //   - Current implementation returns 4 bytes for all formats (simplified implementation)
+        //     Real projects may need to support more formats (e.g., R32G32B32_SFLOAT = 12 bytes)
+        // ============================================================================
+        static uint32_t CalculateFormatSize(RHI::Format format) {
+            switch (format) {
+                // 8-bit formats
+                case RHI::Format::R8_UNORM:
+                case RHI::Format::R8_SNORM:
+                case RHI::Format::R8_UINT:
+                case RHI::Format::R8_SINT:
+                    return 1;
+                case RHI::Format::R8G8_UNORM:
+                case RHI::Format::R8G8_SNORM:
+                case RHI::Format::R8G8_UINT:
+                case RHI::Format::R8G8_SINT:
+                    return 2;
+                case RHI::Format::R8G8B8A8_UNORM:
+                case RHI::Format::R8G8B8A8_SNORM:
+                case RHI::Format::R8G8B8A8_UINT:
+                case RHI::Format::R8G8B8A8_SINT:
+                case RHI::Format::R8G8B8A8_SRGB:
+                case RHI::Format::B8G8R8A8_UNORM:
+                case RHI::Format::B8G8R8A8_SRGB:
+                    return 4;
+                
+                // 16-bit integer formats
+                case RHI::Format::R16_UINT:
+                case RHI::Format::R16_SINT:
+                case RHI::Format::R16_UNORM:
+                case RHI::Format::R16_SNORM:
+                case RHI::Format::R16_SFLOAT:
+                    return 2;
+                case RHI::Format::R16G16_UINT:
+                case RHI::Format::R16G16_SINT:
+                case RHI::Format::R16G16_UNORM:
+                case RHI::Format::R16G16_SNORM:
+                case RHI::Format::R16G16_SFLOAT:
+                    return 4;
+                case RHI::Format::R16G16B16_UINT:
+                case RHI::Format::R16G16B16_SINT:
+                case RHI::Format::R16G16B16_UNORM:
+                case RHI::Format::R16G16B16_SNORM:
+                case RHI::Format::R16G16B16_SFLOAT:
+                    return 6;
+                case RHI::Format::R16G16B16A16_UINT:
+                case RHI::Format::R16G16B16A16_SINT:
+                case RHI::Format::R16G16B16A16_UNORM:
+                case RHI::Format::R16G16B16A16_SNORM:
+                case RHI::Format::R16G16B16A16_SFLOAT:
+                    return 8;
+                
+                // 32-bit integer formats
+                case RHI::Format::R32_UINT:
+                case RHI::Format::R32_SINT:
+                case RHI::Format::R32_SFLOAT:
+                    return 4;
+                case RHI::Format::R32G32_UINT:
+                case RHI::Format::R32G32_SINT:
+                case RHI::Format::R32G32_SFLOAT:
+                    return 8;
+                case RHI::Format::R32G32B32_UINT:
+                case RHI::Format::R32G32B32_SINT:
+                case RHI::Format::R32G32B32_SFLOAT:
+                    return 12;
+                case RHI::Format::R32G32B32A32_UINT:
+                case RHI::Format::R32G32B32A32_SINT:
+                case RHI::Format::R32G32B32A32_SFLOAT:
+                    return 16;
+                
+                // 64-bit integer formats
+                case RHI::Format::R64_UINT:
+                case RHI::Format::R64_SINT:
+                case RHI::Format::R64_SFLOAT:
+                    return 8;
+                case RHI::Format::R64G64_UINT:
+                case RHI::Format::R64G64_SINT:
+                case RHI::Format::R64G64_SFLOAT:
+                    return 16;
+                case RHI::Format::R64G64B64_UINT:
+                case RHI::Format::R64G64B64_SINT:
+                case RHI::Format::R64G64B64_SFLOAT:
+                    return 24;
+                case RHI::Format::R64G64B64A64_UINT:
+                case RHI::Format::R64G64B64A64_SINT:
+                case RHI::Format::R64G64B64A64_SFLOAT:
+                    return 32;
+                
+                // Depth formats
+                case RHI::Format::D32_SFLOAT:               // 32-bit depth = 4 bytes
+                    return 4;
+                case RHI::Format::D24_UNORM_S8_UINT:        // 24-bit depth + 8-bit stencil = 4 bytes (packed)
+                    return 4;
+                
+                default:
+                    return 4; // Default fallback: 4 bytes
+            }
+        }
+
+        std::shared_ptr<const ShaderLayout> ShaderLayout::Build(const Shader::ShaderReflection& reflection) {
+            auto layout = std::make_shared<ShaderLayout>();
+
+            // Vertex inputs: one interleaved vertex buffer (binding 0), attributes packed in declaration order
+            uint32_t currentOffset = 0;
+            layout->m_VertexInputs.reserve(reflection.stage_inputs.size());
+            for (const auto& input : reflection.stage_inputs) {
+                VertexInput vertexInput;
+                vertexInput.location = input.location;
+                vertexInput.name = input.name;
+                vertexInput.format = MapTypeToFormat(input.basetype, input.width, input.vecsize);
+                vertexInput.offset = currentOffset;
+                vertexInput.binding = 0;
+                currentOffset += CalculateFormatSize(vertexInput.format);
+                layout->m_VertexInputs.push_back(std::move(vertexInput));
+            }
+            layout->m_VertexStride = currentOffset;
+
+            layout->m_PushConstantSize = reflection.push_constant_size;
+
+            // Uniform buffers and the offsets parameters are written at
+            layout->m_UniformBuffers.reserve(reflection.uniform_buffers.size());
+            for (const auto& ub : reflection.uniform_buffers) {
+                uint32_t index = static_cast<uint32_t>(layout->m_UniformBuffers.size());
+
+                UniformBuffer buffer;
+                buffer.set = ub.set;
+                buffer.binding = ub.binding;
+                buffer.name = ub.name;
+                buffer.size = ub.size;
+                buffer.members.reserve(ub.members.size());
+
+                // First match wins, like the reflection-order search materials used to do per parameter
+                layout->m_Parameters.emplace(ub.name, ParameterLocation{index, 0, true});
+
+                for (const auto& member : ub.members) {
+                    uint32_t memberOffset = member.offset;
+
+                    // If offset is 0 (not set by compiler), calculate it from previous members (std140 alignment)
+                    if (memberOffset == 0) {
+                        uint32_t calculatedOffset = 0;
+                        for (const auto& prevMember : ub.members) {
+                            if (prevMember.name == member.name) {
+                                break;
+                            }
+                            uint32_t prevSize = prevMember.size > 0 ? prevMember.size : 64; // Default to 64 for mat4
+                            calculatedOffset = (calculatedOffset + 15) & ~15u;
+                            calculatedOffset += prevSize;
+                        }
+                        memberOffset = (calculatedOffset + 15) & ~15u;
+                    }
+
+                    buffer.members.push_back({member.name, memberOffset, member.size});
+                    layout->m_Parameters.emplace(member.name, ParameterLocation{index, memberOffset, false});
+                }
+
+                layout->m_UniformBuffers.push_back(std::move(buffer));
+            }
+
+            // Texture slots
+            // If the new fields are empty but legacy fields have data, use legacy fields
+            // (reflection produced before sampled/separate images were split out)
+            auto addSlots = [&layout](const std::vector<Shader::ShaderResource>& resources, RHI::DescriptorType type) {
+                for (const auto& resource : resources) {
+                    layout->m_TextureSlots.push_back({resource.set, resource.binding, resource.name, type});
+                }
+            };
+            bool useLegacyFields = reflection.sampled_images.empty() &&
+                                   reflection.separate_images.empty() &&
+                                   reflection.separate_samplers.empty() &&
+                                   (!reflection.samplers.empty() || !reflection.images.empty());
+            if (useLegacyFields) {
+                addSlots(reflection.samplers, RHI::DescriptorType::CombinedImageSampler);
+                addSlots(reflection.images, RHI::DescriptorType::SampledImage);
+            } else {
+                addSlots(reflection.sampled_images, RHI::DescriptorType::CombinedImageSampler); // sampler2D
+                addSlots(reflection.separate_images, RHI::DescriptorType::SampledImage);       // texture2D
+                addSlots(reflection.separate_samplers, RHI::DescriptorType::Sampler);          // sampler
+            }
+
+            return layout;
+        }
+
+        const ShaderLayout::ParameterLocation* ShaderLayout::FindParameter(const std::string& name) const {
+            auto it = m_Parameters.find(name);
+            return it != m_Parameters.end() ? &it->second : nullptr;
+        }
+
+        uint32_t ShaderLayout::GetFormatSize(RHI::Format format) {
+            return CalculateFormatSize(format);
+        }
+
+    } // namespace Renderer
+} // namespace FirstEngine
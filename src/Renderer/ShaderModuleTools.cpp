@@ -34,11 +34,11 @@ namespace FirstEngine {
 
         RHI::IShaderModule* ShaderModuleTools::GetOrCreateShaderModule(
             uint64_t shaderID,
-            const std::string& md5Hash,
+            const Core::Hash128& codeHash,
             const std::vector<uint32_t>& spirvCode,
             ShaderStage stage) {
             
-            if (!m_Device || spirvCode.empty() || md5Hash.empty()) {
+            if (!m_Device || spirvCode.empty() || codeHash.IsZero()) {
                 return nullptr;
             }
 
@@ -46,7 +46,7 @@ namespace FirstEngine {
             CacheKey key;
             key.shaderID = shaderID;
             key.stage = static_cast<uint32_t>(stage);
-            key.md5Hash = md5Hash;
+            key.codeHash = codeHash;
 
             auto it = m_ShaderCache.find(key);
             if (it != m_ShaderCache.end()) {
@@ -68,11 +68,11 @@ namespace FirstEngine {
             return modulePtr;
         }
 
-        RHI::IShaderModule* ShaderModuleTools::GetShaderModule(uint64_t shaderID, const std::string& md5Hash, ShaderStage stage) const {
+        RHI::IShaderModule* ShaderModuleTools::GetShaderModule(uint64_t shaderID, const Core::Hash128& codeHash, ShaderStage stage) const {
             CacheKey key;
             key.shaderID = shaderID;
             key.stage = static_cast<uint32_t>(stage);
-            key.md5Hash = md5Hash;
+            key.codeHash = codeHash;
 
             auto it = m_ShaderCache.find(key);
             if (it != m_ShaderCache.end()) {
@@ -81,11 +81,11 @@ namespace FirstEngine {
             return nullptr;
         }
 
-        bool ShaderModuleTools::HasShaderModule(uint64_t shaderID, const std::string& md5Hash, ShaderStage stage) const {
+        bool ShaderModuleTools::HasShaderModule(uint64_t shaderID, const Core::Hash128& codeHash, ShaderStage stage) const {
             CacheKey key;
             key.shaderID = shaderID;
             key.stage = static_cast<uint32_t>(stage);
-            key.md5Hash = md5Hash;
+            key.codeHash = codeHash;
             return m_ShaderCache.find(key) != m_ShaderCache.end();
         }
 
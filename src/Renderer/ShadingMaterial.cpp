@@ -1,4 +1,5 @@
 #include "FirstEngine/Renderer/ShadingMaterial.h"
+#include "FirstEngine/Renderer/FrameUniformRing.h"
 #include "FirstEngine/Renderer/MaterialDescriptorManager.h"
 #include "FirstEngine/Renderer/RenderResourceManager.h"
 #include "FirstEngine/Renderer/RenderParameterCollector.h"
@@ -6,6 +7,7 @@
 #include "FirstEngine/Renderer/ShaderModuleTools.h"
 #include "FirstEngine/Renderer/ShaderCollection.h"
 #include "FirstEngine/Renderer/RenderGeometry.h"
+#include "FirstEngine/Renderer/RenderTexture.h"
 #include "FirstEngine/Core/MathTypes.h"
 #include "FirstEngine/Resources/MaterialResource.h"
 #include "FirstEngine/RHI/IDevice.h"
@@ -48,15 +50,12 @@ namespace FirstEngine {
             }
 
             auto* collection = static_cast<ShaderCollection*>(shaderCollection);
-            const Shader::ShaderReflection* reflection = collection->GetShaderReflection();
-            if (!reflection) {
+            if (!ApplyShaderLayout(collection)) {
                 return false;
             }
 
             m_ShaderCollection = collection;
             m_ShaderCollectionID = collection->GetID();
-            m_ShaderReflection = *reflection;
-            ParseShaderReflection(m_ShaderReflection);
 
             // Initialize textures and buffers from MaterialResource
             InitializeFromMaterialResource(materialResource);
@@ -73,81 +72,11 @@ namespace FirstEngine {
             // This initializes the CPU-side data, which will be uploaded to GPU in DoCreate
             const auto& parameters = materialResource->GetParameters();
             
-            // Get shader reflection to access uniform buffer member information
-            const auto& reflection = m_ShaderReflection;
-            
             for (const auto& [paramName, paramValue] : parameters) {
-                bool parameterSet = false;
-                
-                // First, try to match parameter to uniform buffer members using shader reflection
-                for (const auto& ubReflection : reflection.uniform_buffers) {
-                    // Find the corresponding UniformBufferBinding
-                    UniformBufferBinding* ub = GetUniformBuffer(ubReflection.set, ubReflection.binding);
-                    if (!ub) {
-                        continue;
-                    }
-                    
-                    // Check if parameter name matches uniform buffer name
-                    if (ubReflection.name == paramName) {
-                        // Parameter name matches buffer name - copy entire buffer data
-                        // Note: paramValue is MaterialParameterValue, which has GetData() and GetDataSize()
-                        const void* data = paramValue.GetData();
-                        uint32_t size = paramValue.GetDataSize();
-                        if (data && size > 0 && size <= ub->size) {
-                            std::memcpy(ub->data.data(), data, std::min(size, ub->size));
-                            parameterSet = true;
-                            break;
-                        }
-                    }
-                    
-                    // Try to match parameter to uniform buffer members
-                    // Use actual member offsets from shader reflection if available
-                    for (const auto& member : ubReflection.members) {
-                        // Check if parameter name matches member name
-                        if (member.name == paramName) {
-                            // Get actual member offset from reflection
-                            uint32_t memberOffset = member.offset;
-                            
-                            // If offset is 0 (not set by compiler), calculate it from previous members
-                            // This handles std140 layout alignment
-                            if (memberOffset == 0 && !ubReflection.members.empty()) {
-                                uint32_t calculatedOffset = 0;
-                                for (const auto& prevMember : ubReflection.members) {
-                                    if (prevMember.name == member.name) {
-                                        break; // Found the target member
-                                    }
-                                    // Add size of previous member (with std140 alignment)
-                                    // std140: scalars/vectors aligned to 16 bytes, matrices aligned to 16 bytes
-                                    uint32_t prevSize = prevMember.size > 0 ? prevMember.size : 64; // Default to 64 for mat4
-                                    // Align to 16-byte boundary (std140 layout)
-                                    calculatedOffset = (calculatedOffset + 15) & ~15;
-                                    calculatedOffset += prevSize;
-                                }
-                                // Align final offset to 16-byte boundary
-                                memberOffset = (calculatedOffset + 15) & ~15;
-                            }
-                            
-                            // Note: paramValue is MaterialParameterValue, which has GetData() and GetDataSize()
-                            const void* data = paramValue.GetData();
-                            uint32_t size = paramValue.GetDataSize();
-                            
-                            // Ensure we don't overflow the buffer
-                            if (memberOffset + size <= ub->size) {
-                                std::memcpy(ub->data.data() + memberOffset, data, size);
-                                parameterSet = true;
-                                break;
-                            } else {
-                                std::cerr << "Warning: ShadingMaterial::ApplyRenderParameter: Parameter '" << paramName 
-                                          << "' size " << size << " exceeds buffer size at offset " << memberOffset 
-                                          << " (buffer size: " << ub->size << ")" << std::endl;
-                            }
-                        }
-                    }
-                    
-                    if (parameterSet) {
-                        break;
-                    }
-                }
+                // Match parameter to a uniform buffer or buffer member using the shared layout
+                // Note: paramValue is MaterialParameterValue, which has GetData() and GetDataSize()
+                bool parameterSet = paramValue.GetData() && paramValue.GetDataSize() > 0 &&
+                                    WriteUniformParameter(paramName, paramValue.GetData(), paramValue.GetDataSize());
                 
                 // Fallback: If not matched to any uniform buffer member, try simple name matching
                 if (!parameterSet) {
@@ -184,677 +113,128 @@ namespace FirstEngine {
                 return false;
             }
 
+            // Use the layout cached on the collection (derived once during loading)
+            if (!ApplyShaderLayout(collection)) {
+                return false;
+            }
+
             m_ShaderCollection = collection;
             m_ShaderCollectionID = collectionID;
 
-            // Get shader reflection from collection (already parsed during loading)
+            return true;
+        }
+
+        bool ShadingMaterial::ApplyShaderLayout(void* shaderCollection) {
+            auto* collection = static_cast<ShaderCollection*>(shaderCollection);
             const Shader::ShaderReflection* reflection = collection->GetShaderReflection();
-            if (!reflection) {
+            std::shared_ptr<const ShaderLayout> layout = collection->GetLayout();
+            if (!reflection || !layout) {
                 return false;
             }
 
-            // Use cached reflection from collection
-            m_ShaderReflection = *reflection;
-            ParseShaderReflection(m_ShaderReflection);
+            // The layout (vertex inputs, buffer sizes, member offsets, texture slots) is derived once per
+            // collection; a material instance only allocates its own CPU-side data from it
+            m_ShaderReflection = reflection;
+            m_Layout = std::move(layout);
+
+            m_PushConstantData.assign(m_Layout->GetPushConstantSize(), 0);
+
+            m_UniformBuffers.clear();
+            m_UniformBuffers.reserve(m_Layout->GetUniformBuffers().size());
+            for (const auto& ubLayout : m_Layout->GetUniformBuffers()) {
+                UniformBufferBinding binding;
+                binding.set = ubLayout.set;
+                binding.binding = ubLayout.binding;
+                binding.name = ubLayout.name;
+                binding.size = ubLayout.size;
+                binding.data.assign(ubLayout.size, 0);
+                m_UniformBuffers.push_back(std::move(binding));
+            }
+
+            // Vulkan takes dynamic offsets in set, then binding order
+            m_DynamicOffsetOrder.resize(m_UniformBuffers.size());
+            for (size_t i = 0; i < m_DynamicOffsetOrder.size(); ++i) {
+                m_DynamicOffsetOrder[i] = i;
+            }
+            std::sort(m_DynamicOffsetOrder.begin(), m_DynamicOffsetOrder.end(), [this](size_t a, size_t b) {
+                const UniformBufferBinding& ubA = m_UniformBuffers[a];
+                const UniformBufferBinding& ubB = m_UniformBuffers[b];
+                return ubA.set != ubB.set ? ubA.set < ubB.set : ubA.binding < ubB.binding;
+            });
+            m_DynamicOffsets.assign(m_UniformBuffers.size(), 0);
+
+            m_TextureBindings.clear();
+            m_TextureBindings.reserve(m_Layout->GetTextureSlots().size());
+            for (const auto& slot : m_Layout->GetTextureSlots()) {
+                TextureBinding binding;
+                binding.set = slot.set;
+                binding.binding = slot.binding;
+                binding.name = slot.name;
+                binding.texture = nullptr; // Set at runtime via SetTexture
+                binding.descriptorType = slot.descriptorType;
+                m_TextureBindings.push_back(binding);
+            }
 
             return true;
         }
 
-        // ============================================================================
-        // Helper function: Map SPIR-V types to RHI Format
-        // ============================================================================
-        // 
-        // Parameter description:
-        //   - basetype: SPIRType base type
-        //     * 3 = Int (signed integer)
-        //     * 4 = UInt (unsigned integer)
-        //     * 5 = Float (floating point)
-        //   - width: Type width (bits)
-        //     * 8 = 8 bits (int8, uint8, float8)
-        //     * 16 = 16 bits (int16, uint16, float16/half)
-        //     * 32 = 32 bits (int32, uint32, float32)
-        //     * 64 = 64 bits (int64, uint64, float64/double)
-        //   - vecsize: Vector size
-        //     * 1 = scalar (e.g., float, int)
-        //     * 2 = vec2 (2-component vector, e.g., vec2, float2)
-        //     * 3 = vec3 (3-component vector, e.g., vec3, float3)
-        //     * 4 = vec4 (4-component vector, e.g., vec4, float4)
-        //
-        // Return value:
-        //   RHI::Format - Corresponding vertex attribute format
-        //
-        // Format usage:
-        //   - Determines vertex attribute layout and size in memory
-        //   - Used to create VkVertexInputAttributeDescription
-        //   - Affects how vertex data is read and interpreted
-        //   - Example: vec3 float32 -> 12 bytes, vec4 float32 -> 16 bytes
-        //
-        // Note:
-        //   Current implementation uses R8G8B8A8_UNORM as a generic format (4 bytes),
-        //   For non-4-byte aligned types like vec3 (12 bytes), may need adjustment
-        // ============================================================================
-        static RHI::Format MapTypeToFormat(uint32_t basetype, uint32_t width, uint32_t vecsize) {
-            // basetype: SPIRType::BaseType enum values
-            // width: 8, 16, 32, 64 bits
-            // vecsize: 1=scalar, 2=vec2, 3=vec3, 4=vec4
-            //
-            // SPIRType::BaseType enum:
-            //   0=Unknown, 1=Void, 2=Boolean, 3=SByte, 4=UByte, 5=Short, 6=UShort,
-            //   7=Int, 8=UInt, 9=Int64, 10=UInt64, 11=AtomicCounter,
-            //   12=Half, 13=Float, 14=Double, ...
-            
-            // ============================================================================
-            // Float types (13=Float, 12=Half, 14=Double)
-            // ============================================================================
-            if (basetype == 13) { // SPIRType::Float (32-bit float)
-                if (width == 32) {
-                    switch (vecsize) {
-                        case 1: return RHI::Format::R32_SFLOAT;
-                        case 2: return RHI::Format::R32G32_SFLOAT;
-                        case 3: return RHI::Format::R32G32B32_SFLOAT;
-                        case 4: return RHI::Format::R32G32B32A32_SFLOAT;
-                        default: return RHI::Format::R32_SFLOAT;
-                    }
-                } else if (width == 16) {
-                    // 32-bit float type but 16-bit width (unusual, treat as half)
-                    switch (vecsize) {
-                        case 1: return RHI::Format::R16_SFLOAT;
-                        case 2: return RHI::Format::R16G16_SFLOAT;
-                        case 3: return RHI::Format::R16G16B16_SFLOAT;
-                        case 4: return RHI::Format::R16G16B16A16_SFLOAT;
-                        default: return RHI::Format::R16_SFLOAT;
-                    }
-                } else if (width == 64) {
-                    // 64-bit float (double precision)
-                    switch (vecsize) {
-                        case 1: return RHI::Format::R64_SFLOAT;
-                        case 2: return RHI::Format::R64G64_SFLOAT;
-                        case 3: return RHI::Format::R64G64B64_SFLOAT;
-                        case 4: return RHI::Format::R64G64B64A64_SFLOAT;
-                        default: return RHI::Format::R64_SFLOAT;
-                    }
-                } else {
-                    // Unknown width: Default to 16-bit (2 bytes per component)
-                    switch (vecsize) {
-                        case 1: return RHI::Format::R16_SFLOAT;
-                        case 2: return RHI::Format::R16G16_SFLOAT;
-                        case 3: return RHI::Format::R16G16B16_SFLOAT;
-                        case 4: return RHI::Format::R16G16B16A16_SFLOAT;
-                        default: return RHI::Format::R16_SFLOAT;
-                    }
-                }
-            } else if (basetype == 12) { // SPIRType::Half (16-bit float)
-                switch (vecsize) {
-                    case 1: return RHI::Format::R16_SFLOAT;
-                    case 2: return RHI::Format::R16G16_SFLOAT;
-                    case 3: return RHI::Format::R16G16B16_SFLOAT;
-                    case 4: return RHI::Format::R16G16B16A16_SFLOAT;
-                    default: return RHI::Format::R16_SFLOAT;
-                }
-            } else if (basetype == 14) { // SPIRType::Double (64-bit float)
-                switch (vecsize) {
-                    case 1: return RHI::Format::R64_SFLOAT;
-                    case 2: return RHI::Format::R64G64_SFLOAT;
-                    case 3: return RHI::Format::R64G64B64_SFLOAT;
-                    case 4: return RHI::Format::R64G64B64A64_SFLOAT;
-                    default: return RHI::Format::R64_SFLOAT;
-                }
+        bool ShadingMaterial::WriteUniformParameter(const std::string& name, const void* data, uint32_t size) {
+            if (!m_Layout) {
+                return false;
             }
-            // ============================================================================
-            // Signed Integer types (7=Int, 5=Short, 3=SByte, 9=Int64)
-            // ============================================================================
-            else if (basetype == 7) { // SPIRType::Int (32-bit signed integer)
-                if (width == 32) {
-                    switch (vecsize) {
-                        case 1: return RHI::Format::R32_SINT;
-                        case 2: return RHI::Format::R32G32_SINT;
-                        case 3: return RHI::Format::R32G32B32_SINT;
-                        case 4: return RHI::Format::R32G32B32A32_SINT;
-                        default: return RHI::Format::R32_SINT;
-                    }
-                } else if (width == 16) {
-                    switch (vecsize) {
-                        case 1: return RHI::Format::R16_SINT;
-                        case 2: return RHI::Format::R16G16_SINT;
-                        case 3: return RHI::Format::R16G16B16_SINT;
-                        case 4: return RHI::Format::R16G16B16A16_SINT;
-                        default: return RHI::Format::R16_SINT;
-                    }
-                } else if (width == 8) {
-                    switch (vecsize) {
-                        case 1: return RHI::Format::R8_SINT;
-                        case 2: return RHI::Format::R8G8_SINT;
-                        case 3: return RHI::Format::R8G8B8A8_SINT; // vec3 uses vec4 format
-                        case 4: return RHI::Format::R8G8B8A8_SINT;
-                        default: return RHI::Format::R8_SINT;
-                    }
-                } else if (width == 64) {
-                    switch (vecsize) {
-                        case 1: return RHI::Format::R64_SINT;
-                        case 2: return RHI::Format::R64G64_SINT;
-                        case 3: return RHI::Format::R64G64B64_SINT;
-                        case 4: return RHI::Format::R64G64B64A64_SINT;
-                        default: return RHI::Format::R64_SINT;
-                    }
-                } else {
-                    // Unknown width: Default to 32-bit
-                    switch (vecsize) {
-                        case 1: return RHI::Format::R32_SINT;
-                        case 2: return RHI::Format::R32G32_SINT;
-                        case 3: return RHI::Format::R32G32B32_SINT;
-                        case 4: return RHI::Format::R32G32B32A32_SINT;
-                        default: return RHI::Format::R32_SINT;
-                    }
-                }
-            } else if (basetype == 5) { // SPIRType::Short (16-bit signed integer)
-                switch (vecsize) {
-                    case 1: return RHI::Format::R16_SINT;
-                    case 2: return RHI::Format::R16G16_SINT;
-                    case 3: return RHI::Format::R16G16B16_SINT;
-                    case 4: return RHI::Format::R16G16B16A16_SINT;
-                    default: return RHI::Format::R16_SINT;
-                }
-            } else if (basetype == 3) { // SPIRType::SByte (8-bit signed integer)
-                switch (vecsize) {
-                    case 1: return RHI::Format::R8_SINT;
-                    case 2: return RHI::Format::R8G8_SINT;
-                    case 3: return RHI::Format::R8G8B8A8_SINT; // vec3 uses vec4 format
-                    case 4: return RHI::Format::R8G8B8A8_SINT;
-                    default: return RHI::Format::R8_SINT;
-                }
-            } else if (basetype == 9) { // SPIRType::Int64 (64-bit signed integer)
-                switch (vecsize) {
-                    case 1: return RHI::Format::R64_SINT;
-                    case 2: return RHI::Format::R64G64_SINT;
-                    case 3: return RHI::Format::R64G64B64_SINT;
-                    case 4: return RHI::Format::R64G64B64A64_SINT;
-                    default: return RHI::Format::R64_SINT;
-                }
+            const ShaderLayout::ParameterLocation* location = m_Layout->FindParameter(name);
+            if (!location || location->uniformBuffer >= m_UniformBuffers.size()) {
+                return false;
             }
-            // ============================================================================
-            // Unsigned Integer types (8=UInt, 6=UShort, 4=UByte, 10=UInt64)
-            // ============================================================================
-            else if (basetype == 8) { // SPIRType::UInt (32-bit unsigned integer)
-                if (width == 32) {
-                    switch (vecsize) {
-                        case 1: return RHI::Format::R32_UINT;
-                        case 2: return RHI::Format::R32G32_UINT;
-                        case 3: return RHI::Format::R32G32B32_UINT;
-                        case 4: return RHI::Format::R32G32B32A32_UINT;
-                        default: return RHI::Format::R32_UINT;
-                    }
-                } else if (width == 16) {
-                    switch (vecsize) {
-                        case 1: return RHI::Format::R16_UINT;
-                        case 2: return RHI::Format::R16G16_UINT;
-                        case 3: return RHI::Format::R16G16B16_UINT;
-                        case 4: return RHI::Format::R16G16B16A16_UINT;
-                        default: return RHI::Format::R16_UINT;
-                    }
-                } else if (width == 8) {
-                    switch (vecsize) {
-                        case 1: return RHI::Format::R8_UINT;
-                        case 2: return RHI::Format::R8G8_UINT;
-                        case 3: return RHI::Format::R8G8B8A8_UINT; // vec3 uses vec4 format
-                        case 4: return RHI::Format::R8G8B8A8_UINT;
-                        default: return RHI::Format::R8_UINT;
-                    }
-                } else if (width == 64) {
-                    switch (vecsize) {
-                        case 1: return RHI::Format::R64_UINT;
-                        case 2: return RHI::Format::R64G64_UINT;
-                        case 3: return RHI::Format::R64G64B64_UINT;
-                        case 4: return RHI::Format::R64G64B64A64_UINT;
-                        default: return RHI::Format::R64_UINT;
-                    }
-                } else {
-                    // Unknown width: Default to 32-bit
-                    switch (vecsize) {
-                        case 1: return RHI::Format::R32_UINT;
-                        case 2: return RHI::Format::R32G32_UINT;
-                        case 3: return RHI::Format::R32G32B32_UINT;
-                        case 4: return RHI::Format::R32G32B32A32_UINT;
-                        default: return RHI::Format::R32_UINT;
-                    }
-                }
-            } else if (basetype == 6) { // SPIRType::UShort (16-bit unsigned integer)
-                switch (vecsize) {
-                    case 1: return RHI::Format::R16_UINT;
-                    case 2: return RHI::Format::R16G16_UINT;
-                    case 3: return RHI::Format::R16G16B16_UINT;
-                    case 4: return RHI::Format::R16G16B16A16_UINT;
-                    default: return RHI::Format::R16_UINT;
-                }
-            } else if (basetype == 4) { // SPIRType::UByte (8-bit unsigned integer)
-                switch (vecsize) {
-                    case 1: return RHI::Format::R8_UINT;
-                    case 2: return RHI::Format::R8G8_UINT;
-                    case 3: return RHI::Format::R8G8B8A8_UINT; // vec3 uses vec4 format
-                    case 4: return RHI::Format::R8G8B8A8_UINT;
-                    default: return RHI::Format::R8_UINT;
-                }
-            } else if (basetype == 10) { // SPIRType::UInt64 (64-bit unsigned integer)
-                switch (vecsize) {
-                    case 1: return RHI::Format::R64_UINT;
-                    case 2: return RHI::Format::R64G64_UINT;
-                    case 3: return RHI::Format::R64G64B64_UINT;
-                    case 4: return RHI::Format::R64G64B64A64_UINT;
-                    default: return RHI::Format::R64_UINT;
+
+            UniformBufferBinding& ub = m_UniformBuffers[location->uniformBuffer];
+            if (location->wholeBuffer) {
+                // Parameter name matches buffer name - copy entire buffer data
+                if (size > ub.size) {
+                    return false;
                 }
+                std::memcpy(ub.data.data(), data, size);
+                return true;
             }
-            
-            // ============================================================================
-            // Default fallback: use 16-bit float (2 bytes per component)
-            // This matches typical geometry data and provides good precision/performance balance
-            // ============================================================================
-            switch (vecsize) {
-                case 1: return RHI::Format::R16_SFLOAT;
-                case 2: return RHI::Format::R16G16_SFLOAT;
-                case 3: return RHI::Format::R16G16B16_SFLOAT;
-                case 4: return RHI::Format::R16G16B16A16_SFLOAT;
-                default: return RHI::Format::R16_SFLOAT;
+
+            // Ensure we don't overflow the buffer
+            if (location->offset + size > ub.size) {
+                std::cerr << "Warning: ShadingMaterial: Parameter '" << name
+                          << "' size " << size << " exceeds buffer size at offset " << location->offset
+                          << " (buffer size: " << ub.size << ")" << std::endl;
+                return false;
             }
+            std::memcpy(ub.data.data() + location->offset, data, size);
+            return true;
         }
 
-        // ============================================================================
-        // Helper function: Calculate format byte size
-        // ============================================================================
-        // 
-        // Parameter description:
-        //   - format: RHI::Format enum value, represents vertex attribute data format
-        //
-        // Return value:
-        //   uint32_t - Number of bytes occupied by the format
-        //
-        // Format description:
-        //   - R8G8B8A8_UNORM: 4 8-bit unsigned normalized channels (R, G, B, A) = 4 bytes
-        //   - R8G8B8A8_SRGB: 4 8-bit sRGB channels (R, G, B, A) = 4 bytes
-        //   - B8G8R8A8_UNORM: 4 8-bit unsigned normalized channels (B, G, R, A) = 4 bytes
-        //   - B8G8R8A8_SRGB: 4 8-bit sRGB channels (B, G, R, A) = 4 bytes
-        //   - D32_SFLOAT: 32-bit depth floating point = 4 bytes
-        //   - D24_UNORM_S8_UINT: 24-bit depth + 8-bit stencil = 4 bytes (packed)
-        //
-        // Size usage:
-        //   - Used to calculate vertex attribute offset in buffer
-        //   - Used to calculate vertex data stride
-        //   - Ensures GPU can correctly read and interpret vertex data
-        //   - Affects memory alignment and performance (some formats may require specific alignment)
-        //
-        // Note:
-        //   - Format size must match actual vertex data layout
-        //   - Some formats may need to consider alignment requirements (e.g., 16-byte alignment)
-        //   - Current implementation returns 4 bytes for all formats (simplified implementation)
-        //     Real projects may need to support more formats (e.g., R32G32B32_SFLOAT = 12 bytes)
-        // ============================================================================
-        static uint32_t CalculateFormatSize(RHI::Format format) {
-            switch (format) {
-                // 8-bit formats
-                case RHI::Format::R8_UNORM:
-                case RHI::Format::R8_SNORM:
-                case RHI::Format::R8_UINT:
-                case RHI::Format::R8_SINT:
-                    return 1;
-                case RHI::Format::R8G8_UNORM:
-                case RHI::Format::R8G8_SNORM:
-                case RHI::Format::R8G8_UINT:
-                case RHI::Format::R8G8_SINT:
-                    return 2;
-                case RHI::Format::R8G8B8A8_UNORM:
-                case RHI::Format::R8G8B8A8_SNORM:
-                case RHI::Format::R8G8B8A8_UINT:
-                case RHI::Format::R8G8B8A8_SINT:
-                case RHI::Format::R8G8B8A8_SRGB:
-                case RHI::Format::B8G8R8A8_UNORM:
-                case RHI::Format::B8G8R8A8_SRGB:
-                    return 4;
-                
-                // 16-bit integer formats
-                case RHI::Format::R16_UINT:
-                case RHI::Format::R16_SINT:
-                case RHI::Format::R16_UNORM:
-                case RHI::Format::R16_SNORM:
-                case RHI::Format::R16_SFLOAT:
-                    return 2;
-                case RHI::Format::R16G16_UINT:
-                case RHI::Format::R16G16_SINT:
-                case RHI::Format::R16G16_UNORM:
-                case RHI::Format::R16G16_SNORM:
-                case RHI::Format::R16G16_SFLOAT:
-                    return 4;
-                case RHI::Format::R16G16B16_UINT:
-                case RHI::Format::R16G16B16_SINT:
-                case RHI::Format::R16G16B16_UNORM:
-                case RHI::Format::R16G16B16_SNORM:
-                case RHI::Format::R16G16B16_SFLOAT:
-                    return 6;
-                case RHI::Format::R16G16B16A16_UINT:
-                case RHI::Format::R16G16B16A16_SINT:
-                case RHI::Format::R16G16B16A16_UNORM:
-                case RHI::Format::R16G16B16A16_SNORM:
-                case RHI::Format::R16G16B16A16_SFLOAT:
-                    return 8;
-                
-                // 32-bit integer formats
-                case RHI::Format::R32_UINT:
-                case RHI::Format::R32_SINT:
-                case RHI::Format::R32_SFLOAT:
-                    return 4;
-                case RHI::Format::R32G32_UINT:
-                case RHI::Format::R32G32_SINT:
-                case RHI::Format::R32G32_SFLOAT:
-                    return 8;
-                case RHI::Format::R32G32B32_UINT:
-                case RHI::Format::R32G32B32_SINT:
-                case RHI::Format::R32G32B32_SFLOAT:
-                    return 12;
-                case RHI::Format::R32G32B32A32_UINT:
-                case RHI::Format::R32G32B32A32_SINT:
-                case RHI::Format::R32G32B32A32_SFLOAT:
-                    return 16;
-                
-                // 64-bit integer formats
-                case RHI::Format::R64_UINT:
-                case RHI::Format::R64_SINT:
-                case RHI::Format::R64_SFLOAT:
-                    return 8;
-                case RHI::Format::R64G64_UINT:
-                case RHI::Format::R64G64_SINT:
-                case RHI::Format::R64G64_SFLOAT:
-                    return 16;
-                case RHI::Format::R64G64B64_UINT:
-                case RHI::Format::R64G64B64_SINT:
-                case RHI::Format::R64G64B64_SFLOAT:
-                    return 24;
-                case RHI::Format::R64G64B64A64_UINT:
-                case RHI::Format::R64G64B64A64_SINT:
-                case RHI::Format::R64G64B64A64_SFLOAT:
-                    return 32;
-                
-                // Depth formats
-                case RHI::Format::D32_SFLOAT:               // 32-bit depth = 4 bytes
-                    return 4;
-                case RHI::Format::D24_UNORM_S8_UINT:        // 24-bit depth + 8-bit stencil = 4 bytes (packed)
-                    return 4;
-                
-                default:
-                    return 4; // Default fallback: 4 bytes
-            }
+        const std::vector<ShadingMaterial::VertexInput>& ShadingMaterial::GetVertexInputs() const {
+            static const std::vector<VertexInput> empty;
+            return m_Layout ? m_Layout->GetVertexInputs() : empty;
         }
 
-        void ShadingMaterial::ParseShaderReflection(const Shader::ShaderReflection& reflection) {
-            // ============================================================================
-            // Parse Shader Reflection data, convert shader resource declarations to rendering pipeline configuration
-            // ============================================================================
-            // 
-            // Shader Reflection is metadata extracted from compiled SPIR-V code,
-            // contains all resources declared in shader: inputs, outputs, uniform buffers, textures, etc.
-            // 
-            // Corresponding Shader syntax example:
-            // - Vertex Input:    layout(location = 0) in vec3 inPosition;
-            // - Uniform Buffer:  layout(set = 0, binding = 0) uniform UniformBuffer { ... };
-            // - Sampler:         layout(set = 0, binding = 1) uniform sampler2D texSampler;
-            // - Image:           layout(set = 0, binding = 2) uniform texture2D texImage;
-            // - Push Constant:   layout(push_constant) uniform PushConstants { ... };
-            // ============================================================================
-
-            // ----------------------------------------------------------------------------
-            // 1. Parse Vertex Inputs (vertex input attributes)
-            // ----------------------------------------------------------------------------
-            // Corresponding Shader syntax:
-            //   layout(location = 0) in vec3 inPosition;
-            //   layout(location = 1) in vec2 inTexCoord;
-            //   layout(location = 2) in vec3 inNormal;
-            //
-            // Parameter description:
-            //   - location: Vertex attribute location index, corresponds to layout(location = N) in shader
-            //     Used to identify different attributes in vertex buffer (position, normal, texture coordinates, etc.)
-            //   - name: Attribute variable name in shader (e.g., "inPosition", "inTexCoord")
-            //   - format: Vertex attribute data format (e.g., R8G8B8A8_UNORM means 4-byte RGBA)
-            //     Format determines how vertex data is read and interpreted from memory
-            //   - offset: Byte offset of this attribute in vertex buffer
-            //     Used to calculate attribute start position in vertex data (calculated in BuildVertexInputsFromShader)
-            //   - binding: Vertex buffer binding index (usually 0, means using first vertex buffer)
-            //
-            // Format and size usage:
-            //   - format determines bytes occupied by each attribute (e.g., R8G8B8A8_UNORM = 4 bytes)
-            //   - offset is used to correctly position each attribute's data in vertex buffer
-            //   - All attributes' offset + format size = vertex data stride
-            //   - This information is used to create VkVertexInputAttributeDescription and VkVertexInputBindingDescription
-            // ----------------------------------------------------------------------------
-            m_VertexInputs.clear();
-            for (const auto& input : reflection.stage_inputs) {
-                VertexInput vertexInput;
-                vertexInput.location = input.location; // layout(location = N) value in shader
-                vertexInput.name = input.name;        // Shader variable name (e.g., "inPosition")
-                
-                // Map shader type to RHI Format
-                // input.basetype: SPIRType basetype (3=Int, 4=UInt, 5=Float)
-                // input.width: Type width (8, 16, 32, 64 bits)
-                // input.vecsize: Vector size (1=scalar, 2=vec2, 3=vec3, 4=vec4)
-                // Example: vec3 float32 -> basetype=5, width=32, vecsize=3
-                vertexInput.format = MapTypeToFormat(input.basetype, input.width, input.vecsize);
-                
-                vertexInput.offset = 0;    // Will be calculated based on format size in BuildVertexInputsFromShader
-                vertexInput.binding = 0;   // Default to use binding 0 vertex buffer
-                m_VertexInputs.push_back(vertexInput);
-            }
-
-            // ----------------------------------------------------------------------------
-            // 2. Parse Push Constants
-            // ----------------------------------------------------------------------------
-            // Corresponding Shader syntax:
-            //   layout(push_constant) uniform PushConstants {
-            //       mat4 mvpMatrix;
-            //       vec4 color;
-            //   } pushConstants;
-            //
-            // Parameter description:
-            //   - push_constant_size: Total bytes of push constant data
-            //     Contains size of all push constant members (considering alignment)
-            //
-            // Format and size usage:
-            //   - Push constant is a small data block for fast updates (usually < 128 bytes)
-            //   - Doesn't need descriptor set, updated directly in command buffer
-            //   - Used for frequently changing data (e.g., per-frame MVP matrix)
-            // ----------------------------------------------------------------------------
-            m_PushConstantData.resize(reflection.push_constant_size);
-            std::memset(m_PushConstantData.data(), 0, m_PushConstantData.size());
-
-            // ----------------------------------------------------------------------------
-            // 3. Parse Uniform Buffers
-            // ----------------------------------------------------------------------------
-            // Corresponding Shader syntax:
-            //   layout(set = 0, binding = 0) uniform UniformBufferObject {
-            //       mat4 model;
-            //       mat4 view;
-            //       mat4 proj;
-            //   } ubo;
-            //
-            // Parameter description:
-            //   - set: Descriptor set index, corresponds to layout(set = N) in shader
-            //     Used to organize related resources (e.g., set 0 for per-object, set 1 for per-frame)
-            //   - binding: Binding index in descriptor set, corresponds to layout(binding = N) in shader
-            //     Used to distinguish different resources in the same set
-            //   - name: Uniform buffer name in shader (e.g., "UniformBufferObject")
-            //   - size: Total bytes of uniform buffer (contains all members, considering alignment)
-            //     Used to create GPU buffer and allocate memory
-            //
-            // Format and size usage:
-            //   - size determines GPU buffer size to create
-            //   - set and binding are used to create descriptor set layout
-            //   - data stores CPU-side data, used to update GPU buffer
-            //   - Alignment rules: In GLSL/Vulkan, uniform buffer members need 16-byte alignment
-            //     Example: vec3 occupies 12 bytes, but needs to be aligned to 16 bytes
-            // ----------------------------------------------------------------------------
-            m_UniformBuffers.clear();
-            for (const auto& ub : reflection.uniform_buffers) {
-                UniformBufferBinding binding;
-                binding.set = ub.set;      // layout(set = N) in shader
-                binding.binding = ub.binding; // layout(binding = N) in shader
-                binding.name = ub.name;    // Uniform buffer name in shader
-                binding.size = ub.size;    // Uniform buffer total bytes (considering alignment)
-                
-                // Allocate CPU-side data buffer for storing and updating uniform buffer data
-                binding.data.resize(ub.size);
-                std::memset(binding.data.data(), 0, binding.data.size());
-                m_UniformBuffers.push_back(std::move(binding));
-                
-                // Debug: Print uniform buffer information
-            }
-
-            // ----------------------------------------------------------------------------
-            // 4. Parse Texture Bindings (Samplers and Images)
-            // ----------------------------------------------------------------------------
-            // Corresponding Shader syntax:
-            //   // Combined Image Sampler (GLSL)
-            //   layout(set = 0, binding = 1) uniform sampler2D texSampler;
-            //   
-            //   // Separate Image and Sampler (HLSL/Vulkan)
-            //   layout(set = 0, binding = 1) uniform texture2D texImage;
-            //   layout(set = 0, binding = 2) uniform sampler texSampler;
-            //
-            // Parameter description:
-            //   - samplers: Combined image sampler or separate sampler
-            //     Corresponds to GLSL's sampler2D, samplerCube, etc.
-            //   - images: Separate texture image (doesn't include sampler)
-            //     Corresponds to HLSL's texture2D, textureCube, etc.
-            //   - set: Descriptor set index, corresponds to layout(set = N) in shader
-            //   - binding: Binding index in descriptor set, corresponds to layout(binding = N) in shader
-            //   - name: Texture variable name in shader (e.g., "texSampler", "albedoMap")
-            //
-            // Format and size usage:
-            //   - set and binding are used to create descriptor set layout
-            //   - Used to bind correct texture to shader during rendering
-            //   - texture pointer is set at runtime (via SetTexture method)
-            //   - Supports binding multiple textures in same descriptor set (via different bindings)
-            // ----------------------------------------------------------------------------
-            m_TextureBindings.clear();
-            
-            // Debug: Print reflection information
-            // IMPORTANT: If new fields are empty but legacy fields have data, use legacy fields
-            // This handles the case where ShaderCollection was cached before we added the new fields
-            bool useLegacyFields = reflection.sampled_images.empty() && 
-                                   reflection.separate_images.empty() && 
-                                   reflection.separate_samplers.empty() &&
-                                   (!reflection.samplers.empty() || !reflection.images.empty());
-            
-            if (useLegacyFields) {
-                
-                // Use legacy samplers list (contains both sampled_images and separate_samplers)
-                // We'll treat them all as COMBINED_IMAGE_SAMPLER for now
-                for (const auto& sampler : reflection.samplers) {
-                    TextureBinding binding;
-                    binding.set = sampler.set;
-                    binding.binding = sampler.binding;
-                    binding.name = sampler.name;
-                    binding.texture = nullptr;
-                    binding.descriptorType = RHI::DescriptorType::CombinedImageSampler;
-                    m_TextureBindings.push_back(binding);
-                }
-                
-                // Use legacy images list (contains both separate_images and storage_images)
-                // We'll treat them as SAMPLED_IMAGE for now
-                for (const auto& image : reflection.images) {
-                    TextureBinding binding;
-                    binding.set = image.set;
-                    binding.binding = image.binding;
-                    binding.name = image.name;
-                    binding.texture = nullptr;
-                    binding.descriptorType = RHI::DescriptorType::SampledImage;
-                    m_TextureBindings.push_back(binding);
-                }
-            } else {
-                // Use new fields (preferred)
-                // Parse Combined Image Samplers (sampler2D in GLSL)
-                // These use COMBINED_IMAGE_SAMPLER descriptor type
-                for (const auto& sampler : reflection.sampled_images) {
-                TextureBinding binding;
-                binding.set = sampler.set;      // layout(set = N) in shader
-                binding.binding = sampler.binding; // layout(binding = N) in shader
-                binding.name = sampler.name;     // Sampler variable name in shader
-                binding.texture = nullptr;       // Texture pointer, set at runtime via SetTexture
-                binding.descriptorType = RHI::DescriptorType::CombinedImageSampler;
-                m_TextureBindings.push_back(binding);
-            }
-            
-            // Parse Separate Images (texture2D in HLSL/Vulkan, used with separate samplers)
-            // These use SAMPLED_IMAGE descriptor type
-            for (const auto& image : reflection.separate_images) {
-                TextureBinding binding;
-                binding.set = image.set;         // layout(set = N) in shader
-                binding.binding = image.binding; // layout(binding = N) in shader
-                binding.name = image.name;       // Image variable name in shader
-                binding.texture = nullptr;       // Texture pointer, set at runtime via SetTexture
-                binding.descriptorType = RHI::DescriptorType::SampledImage;
-                m_TextureBindings.push_back(binding);
-            }
-            
-            // Parse Separate Samplers (sampler in HLSL/Vulkan, used with separate images)
-            // Note: Separate samplers don't have a texture, they're just sampler states
-            // For now, we'll create a binding entry but it won't have a texture pointer
-            // The descriptor type should be SAMPLER, but our RHI layer might not support it yet
-            // So we'll use CombinedImageSampler as a fallback, but this might need to be fixed
-            for (const auto& sampler : reflection.separate_samplers) {
-                TextureBinding binding;
-                binding.set = sampler.set;      // layout(set = N) in shader
-                binding.binding = sampler.binding; // layout(binding = N) in shader
-                binding.name = sampler.name;     // Sampler variable name in shader
-                binding.texture = nullptr;       // Separate samplers don't have textures
-                // Use DescriptorType::Sampler for separate samplers (RHI now supports it)
-                binding.descriptorType = RHI::DescriptorType::Sampler;
-                m_TextureBindings.push_back(binding);
-            }
+        void ShadingMaterial::SetVertexLayout(uint32_t stride, const std::vector<RHI::VertexInputAttribute>& attributes) {
+            m_HasVertexLayout = true;
+            m_VertexLayoutStride = stride;
+            m_VertexLayoutAttributes = attributes;
+
+            // Vertex input state is baked into the pipelines
+            m_ShadingState.MarkPipelineDirty();
+            for (auto& variant : m_PassVariantStates) {
+                variant.second->MarkPipelineDirty();
             }
         }
 
-        void ShadingMaterial::BuildVertexInputsFromShader() {
-            // ============================================================================
-            // Calculate vertex input attribute offsets (Offset)
-            // ============================================================================
-            // 
-            // Purpose:
-            //   In vertex buffer, multiple attributes (position, normal, texture coordinates, etc.) are usually packed in the same buffer.
-            //   Each attribute needs to know its start position (offset) in the buffer to correctly read data.
-            //
-            // Example vertex data layout:
-            //   struct Vertex {
-            //       vec3 position;   // offset = 0,   size = 12 bytes (3 * float)
-            //       vec3 normal;     // offset = 12,  size = 12 bytes (3 * float)
-            //       vec2 texCoord;   // offset = 24,  size = 8 bytes  (2 * float)
-            //   };
-            //   Total stride = 32 bytes
-            //
-            // Calculation process:
-            //   1. First attribute's offset = 0
-            //   2. Subsequent attributes' offset = previous attribute's offset + previous attribute's format size
-            //   3. Last attribute's offset + format size = vertex data stride
-            //
-            // Format size usage:
-            //   - Determines bytes occupied by each attribute in memory
-            //   - Used to calculate offsets between attributes
-            //   - Used to calculate total vertex data stride
-            //   - Ensures GPU can correctly read each attribute's data from vertex buffer
-            //
-            // Note:
-            //   - Format size must match actual vertex data layout
-            //   - If shader declares vec3 but actual data is vec4, need to adjust format
-            //   - Alignment rules: Some formats may require specific alignment (e.g., 16-byte alignment)
-            // ============================================================================
-            uint32_t currentOffset = 0;
-            for (auto& input : m_VertexInputs) {
-                // Set current attribute's offset
-                input.offset = currentOffset;
-                
-                // Calculate current attribute's format size (bytes)
-                // Example: R8G8B8A8_UNORM = 4 bytes, D32_SFLOAT = 4 bytes
-                uint32_t formatSize = CalculateFormatSize(input.format);
-                
-                // Update next attribute's offset
-                currentOffset += formatSize;
+        uint32_t ShadingMaterial::GetVertexStride() const {
+            if (m_HasVertexLayout) {
+                return m_VertexLayoutStride;
             }
-            
-            // At this point currentOffset is the vertex data stride
-            // 用于创建 VkVertexInputBindingDescription 中的 stride 字段
+            return m_Layout ? m_Layout->GetVertexStride() : 0;
+        }
+
+        const Shader::ShaderReflection& ShadingMaterial::GetShaderReflection() const {
+            static const Shader::ShaderReflection empty = {};
+            return m_ShaderReflection ? *m_ShaderReflection : empty;
         }
 
         bool ShadingMaterial::DoCreate(RHI::IDevice* device) {
@@ -865,101 +245,156 @@ namespace FirstEngine {
             // Store device reference for cleanup
             m_Device = device;
 
+            // Stage uniform data in the frame uniform ring when a RenderContext provides one
+            m_UniformRing = RenderResourceManager::HasInstance()
+                ? RenderResourceManager::GetInstance().GetFrameUniformRing() : nullptr;
+            if (m_UniformRing && !m_UniformRing->IsInitialized()) {
+                m_UniformRing = nullptr;
+            }
+
             if (!m_ShaderCollection) {
                 return false;
             }
 
             // Create shader modules using ShaderModuleTools (separates Device from ShaderCollection)
-            m_ShadingState.shaderModules.clear();
+            if (!CreateShaderModules(m_ShaderCollection, m_ShaderCollectionID, m_ShadingState)) {
+                return false;
+            }
+
+            // Create uniform buffers
+            if (!CreateUniformBuffers(device)) {
+                return false;
+            }
+
+            // Create and initialize descriptor manager
+            m_DescriptorManager = std::make_unique<MaterialDescriptorManager>();
+            if (!m_DescriptorManager->Initialize(this, device)) {
+                std::cerr << "Failed to initialize MaterialDescriptorManager!" << std::endl;
+                m_DescriptorManager.reset();
+                return false;
+            }
+
+            // Note: Pipeline creation is deferred until EnsurePipelineCreated() is called
+            // This is because pipeline creation requires a renderPass, which may not be available yet
+            // Pipeline will be created lazily when first needed
+
+            // Set textures from MaterialResource if available
+            // This is done after ShadingMaterial is created so GPU resources are available
+            if (m_MaterialResource) {
+                m_MaterialResource->SetTexturesToShadingMaterial(this);
+                
+                // IMPORTANT: After setting textures, we need to update descriptor sets
+                // Since we just created the ShadingMaterial, the descriptor sets are not in use yet
+                // So we can safely force update them with the new texture pointers
+                if (m_DescriptorManager) {
+                    m_DescriptorManager->ForceUpdateAllBindings(this, device);
+                }
+            }
+
+            return true;
+        }
+
+        bool ShadingMaterial::CreateShaderModules(void* shaderCollection, uint64_t collectionID, ShadingState& state) {
+            state.shaderModules.clear();
             
-            auto* collection = static_cast<ShaderCollection*>(m_ShaderCollection);
+            auto* collection = static_cast<ShaderCollection*>(shaderCollection);
             auto& moduleTools = ShaderModuleTools::GetInstance();
             
             // Initialize ShaderModuleTools with device if not already initialized
             if (!moduleTools.IsInitialized()) {
-                moduleTools.Initialize(device);
+                moduleTools.Initialize(m_Device);
             }
 
             // Get available stages from collection
             auto stages = collection->GetAvailableStages();
             for (ShaderStage stage : stages) {
-                // Get SPIR-V code and MD5 hash from collection
+                // Get SPIR-V code and code hash from collection
                 const std::vector<uint32_t>* spirvCode = collection->GetSPIRVCode(stage);
                 if (!spirvCode || spirvCode->empty()) {
                     continue;
                 }
                 
-                // Get MD5 hash for this stage
-                const std::string& md5Hash = collection->GetMD5Hash(stage);
-                if (md5Hash.empty()) {
+                // Get code hash for this stage
+                Core::Hash128 codeHash = collection->GetCodeHash(stage);
+                if (codeHash.IsZero()) {
                     continue;
                 }
                 
-                // Get or create shader module from ShaderModuleTools using shaderID + MD5
+                // Get or create shader module from ShaderModuleTools using shaderID + code hash
                 RHI::IShaderModule* shaderModule = moduleTools.GetOrCreateShaderModule(
-                    m_ShaderCollectionID,
-                    md5Hash,
+                    collectionID,
+                    codeHash,
                     *spirvCode,
                     stage
                 );
                 
                 if (shaderModule) {
-                    m_ShadingState.shaderModules.push_back(shaderModule);
+                    state.shaderModules.push_back(shaderModule);
                 }
             }
             
-            if (m_ShadingState.shaderModules.empty()) {
-                return false;
-            }
+            return !state.shaderModules.empty();
+        }
 
-            // Build vertex inputs with calculated offsets
-            BuildVertexInputsFromShader();
+        ShadingState* ShadingMaterial::GetShadingStateForKeywords(const Shader::ShaderKeywordSet& passKeywords) {
+            if (passKeywords.IsEmpty() || m_ShaderCollectionID == 0) {
+                return &m_ShadingState;
+            }
 
-            // Create uniform buffers
-            if (!CreateUniformBuffers(device)) {
-                return false;
+            // Keywords the shader doesn't declare resolve to this material's own collection
+            auto& collectionsTools = ShaderCollectionsTools::GetInstance();
+            uint64_t variantID = collectionsTools.RequestVariant(m_ShaderCollectionID, passKeywords);
+            if (variantID == 0) {
+                return nullptr; // Still compiling (or failed)
+            }
+            if (variantID == m_ShaderCollectionID) {
+                return &m_ShadingState;
             }
 
-            // Create and initialize descriptor manager
-            m_DescriptorManager = std::make_unique<MaterialDescriptorManager>();
-            if (!m_DescriptorManager->Initialize(this, device)) {
-                std::cerr << "Failed to initialize MaterialDescriptorManager!" << std::endl;
-                m_DescriptorManager.reset();
-                return false;
+            auto it = m_PassVariantStates.find(variantID);
+            if (it != m_PassVariantStates.end()) {
+                return it->second.get();
             }
 
-            // Note: Pipeline creation is deferred until EnsurePipelineCreated() is called
-            // This is because pipeline creation requires a renderPass, which may not be available yet
-            // Pipeline will be created lazily when first needed
+            auto* variant = collectionsTools.GetCollection(variantID);
+            if (!variant || !m_Device) {
+                return nullptr;
+            }
 
-            // Set textures from MaterialResource if available
-            // This is done after ShadingMaterial is created so GPU resources are available
-            if (m_MaterialResource) {
-                m_MaterialResource->SetTexturesToShadingMaterial(this);
-                
-                // IMPORTANT: After setting textures, we need to update descriptor sets
-                // Since we just created the ShadingMaterial, the descriptor sets are not in use yet
-                // So we can safely force update them with the new texture pointers
-                if (m_DescriptorManager) {
-                    m_DescriptorManager->ForceUpdateAllBindings(this, device);
-                }
+            // Same fixed-function state as the base, variant shader modules
+            auto state = std::make_unique<ShadingState>();
+            state->pipelineState = m_ShadingState.pipelineState;
+            if (!CreateShaderModules(variant, variantID, *state)) {
+                std::cerr << "ShadingMaterial: Failed to create shader modules for variant " << variant->GetName() << std::endl;
+                return nullptr;
             }
 
-            return true;
+            ShadingState* result = state.get();
+            m_PassVariantStates[variantID] = std::move(state);
+            return result;
         }
 
         bool ShadingMaterial::EnsurePipelineCreated(RHI::IDevice* device, RHI::IRenderPass* renderPass) {
+            return EnsurePipelineCreated(device, renderPass, Shader::ShaderKeywordSet());
+        }
+
+        bool ShadingMaterial::EnsurePipelineCreated(RHI::IDevice* device, RHI::IRenderPass* renderPass, const Shader::ShaderKeywordSet& passKeywords) {
             if (!device || !renderPass) {
                 return false;
             }
 
-            // If pipeline already exists and is not dirty, return success
-            if (m_ShadingState.GetPipeline() && !m_ShadingState.IsPipelineDirty()) {
+            ShadingState* state = GetShadingStateForKeywords(passKeywords);
+            if (!state) {
+                return false;
+            }
+
+            // If pipeline already exists for this render pass and is not dirty, return success
+            if (state->IsPipelineReady(renderPass)) {
                 return true;
             }
 
             // Ensure shader modules are created
-            if (m_ShadingState.shaderModules.empty()) {
+            if (state->shaderModules.empty()) {
                 return false;
             }
 
@@ -967,24 +402,24 @@ namespace FirstEngine {
             std::vector<RHI::VertexInputBinding> vertexBindings;
             std::vector<RHI::VertexInputAttribute> vertexAttributes;
             
-            // Create a single vertex binding (binding 0) with calculated stride
-            if (!m_VertexInputs.empty()) {
-                // Calculate stride from last input offset + format size
-                uint32_t stride = 0;
-                if (!m_VertexInputs.empty()) {
-                    const auto& lastInput = m_VertexInputs.back();
-                    uint32_t formatSize = CalculateFormatSize(lastInput.format);
-                    stride = lastInput.offset + formatSize;
-                }
-                
+            // Create a single vertex binding (binding 0) with the layout's stride
+            const auto& vertexInputs = GetVertexInputs();
+            if (m_HasVertexLayout) {
+                RHI::VertexInputBinding binding;
+                binding.binding = 0;
+                binding.stride = m_VertexLayoutStride;
+                binding.instanced = false;
+                vertexBindings.push_back(binding);
+                vertexAttributes = m_VertexLayoutAttributes;
+            } else if (!vertexInputs.empty()) {
                 RHI::VertexInputBinding binding;
                 binding.binding = 0;
-                binding.stride = stride;
+                binding.stride = m_Layout->GetVertexStride();
                 binding.instanced = false;
                 vertexBindings.push_back(binding);
                 
                 // Convert vertex inputs to attributes
-                for (const auto& input : m_VertexInputs) {
+                for (const auto& input : vertexInputs) {
                     RHI::VertexInputAttribute attr;
                     attr.location = input.location;
                     attr.binding = input.binding;
@@ -1001,12 +436,8 @@ namespace FirstEngine {
                 descriptorSetLayouts = layouts;
             }
 
-            // Create pipeline from shading state (with descriptor set layouts)
-            if (!m_ShadingState.CreatePipeline(device, renderPass, vertexBindings, vertexAttributes, descriptorSetLayouts)) {
-                return false;
-            }
-
-            return true;
+            // Queue (or poll) asynchronous pipeline compilation from shading state (with descriptor set layouts)
+            return state->CreatePipelineAsync(device, renderPass, vertexBindings, vertexAttributes, descriptorSetLayouts);
         }
 
         bool ShadingMaterial::DoUpdate(RHI::IDevice* device) {
@@ -1016,19 +447,41 @@ namespace FirstEngine {
 
             // Update uniform buffers if data changed
             // This is called from FlushParametersToGPU to transfer CPU data to GPU buffers
-            // Note: Per-frame updates should use UpdateUniformBuffer() which handles this automatically
+            // With a ring every flush takes a fresh copy in this frame's segment; earlier frames still in
+            // flight keep reading theirs. If the segment is full the offsets are left marked stale (they point
+            // into another frame's data) and the material is not drawn this frame
+            m_DynamicOffsetsFrame = 0;
             for (auto& ub : m_UniformBuffers) {
-                if (ub.buffer && !ub.data.empty()) {
-                    // Update buffer data using RHI interface
+                if (ub.data.empty()) {
+                    continue;
+                }
+                if (m_UniformRing) {
+                    uint64_t offset = 0;
+                    void* dst = m_UniformRing->Allocate(ub.data.size(), offset);
+                    if (!dst) {
+                        return false;
+                    }
+                    std::memcpy(dst, ub.data.data(), ub.data.size());
+                    ub.dynamicOffset = static_cast<uint32_t>(offset);
+                } else if (ub.buffer) {
+                    // Writes straight into the persistent mapping (no map/unmap per update)
                     ub.buffer->UpdateData(ub.data.data(), ub.data.size(), 0);
                 }
             }
 
+            for (size_t i = 0; i < m_DynamicOffsetOrder.size(); ++i) {
+                m_DynamicOffsets[i] = m_UniformBuffers[m_DynamicOffsetOrder[i]].dynamicOffset;
+            }
+            if (m_UniformRing) {
+                m_DynamicOffsetsFrame = m_UniformRing->GetFrameSerial();
+            }
+
             return true;
         }
 
         void ShadingMaterial::DoDestroy() {
             // Destroy shader modules
+            m_PassVariantStates.clear();
             m_OwnedShaderModules.clear();
             m_ShadingState.shaderModules.clear();
 
@@ -1037,6 +490,10 @@ namespace FirstEngine {
                 ub.buffer.reset();
             }
             m_UniformBuffers.clear();
+            m_DynamicOffsetOrder.clear();
+            m_DynamicOffsets.clear();
+            m_DynamicOffsetsFrame = 0;
+            m_UniformRing = nullptr;
 
             // Clear texture bindings (textures are not owned)
             m_TextureBindings.clear();
@@ -1068,6 +525,17 @@ namespace FirstEngine {
             return nullptr;
         }
 
+        RHI::IBuffer* ShadingMaterial::GetDescriptorBuffer(const UniformBufferBinding& ub, uint32_t frameSlot) const {
+            return m_UniformRing ? m_UniformRing->GetSegmentBuffer(frameSlot) : ub.buffer.get();
+        }
+
+        bool ShadingMaterial::HasFrameUniforms() const {
+            if (!m_UniformRing || m_DynamicOffsetOrder.empty()) {
+                return true;
+            }
+            return m_DynamicOffsetsFrame == m_UniformRing->GetFrameSerial();
+        }
+
         ShadingMaterial::TextureBinding* ShadingMaterial::GetTextureBinding(uint32_t set, uint32_t binding) {
             for (auto& tb : m_TextureBindings) {
                 if (tb.set == set && tb.binding == binding) {
@@ -1081,6 +549,25 @@ namespace FirstEngine {
             TextureBinding* bindingPtr = GetTextureBinding(set, binding);
             if (bindingPtr) {
                 bindingPtr->texture = texture;
+                bindingPtr->renderTexture = nullptr;
+            }
+        }
+
+        void ShadingMaterial::BindRenderTexture(uint32_t set, uint32_t binding, RenderTexture* renderTexture) {
+            TextureBinding* bindingPtr = GetTextureBinding(set, binding);
+            if (bindingPtr) {
+                bindingPtr->renderTexture = renderTexture;
+                bindingPtr->texture = renderTexture && renderTexture->IsReady() ? renderTexture->GetImage() : nullptr;
+            }
+        }
+
+        void ShadingMaterial::RefreshTextureBindings() {
+            // The descriptor manager writes bindings whose image pointer changed into this frame slot's sets on the
+            // next flush; frames still in flight keep their own sets
+            for (auto& tb : m_TextureBindings) {
+                if (tb.renderTexture) {
+                    tb.texture = tb.renderTexture->IsReady() ? tb.renderTexture->GetImage() : nullptr;
+                }
             }
         }
 
@@ -1112,6 +599,11 @@ namespace FirstEngine {
         }
 
         bool ShadingMaterial::CreateUniformBuffers(RHI::IDevice* device) {
+            // Ring-backed materials copy their data into the ring on every flush
+            if (m_UniformRing) {
+                return true;
+            }
+
             for (auto& ub : m_UniformBuffers) {
                 if (ub.size == 0) {
                     continue;
@@ -1133,14 +625,9 @@ namespace FirstEngine {
                     return false;
                 }
 
-                // Upload initial data (now safe to map since we use HostVisible memory)
+                // Upload initial data (HostVisible buffers are persistently mapped, so this is a plain memcpy)
                 if (!ub.data.empty()) {
-                    void* mapped = ub.buffer->Map();
-                    if (mapped) {
-                        std::memcpy(mapped, ub.data.data(), ub.data.size());
-                        ub.buffer->Unmap();
-                    } else {
-                    }
+                    ub.buffer->UpdateData(ub.data.data(), ub.data.size(), 0);
                 }
             }
 
@@ -1182,7 +669,7 @@ namespace FirstEngine {
             }
 
             UniformBufferBinding* ub = GetUniformBuffer(update.set, update.binding);
-            if (!ub || !ub->buffer) {
+            if (!ub || (!ub->buffer && !m_UniformRing)) {
                 return false;
             }
 
@@ -1197,8 +684,10 @@ namespace FirstEngine {
             }
             std::memcpy(ub->data.data() + update.offset, update.data, update.size);
 
-            // Update GPU buffer
-            ub->buffer->UpdateData(update.data, update.size, update.offset);
+            // Update GPU buffer (ring-backed data is copied into the ring on the next flush)
+            if (ub->buffer) {
+                ub->buffer->UpdateData(update.data, update.size, update.offset);
+            }
             return true;
         }
 
@@ -1252,14 +741,8 @@ namespace FirstEngine {
                 return false;
             }
 
-            // Calculate expected stride from vertex inputs
-            uint32_t expectedStride = 0;
-            if (!m_VertexInputs.empty()) {
-                const ShadingMaterial::VertexInput& lastInput = m_VertexInputs.back();
-                // Calculate format size (simplified - assumes standard formats)
-                uint32_t formatSize = CalculateFormatSize(lastInput.format);
-                expectedStride = lastInput.offset + formatSize;
-            }
+            // Expected stride from vertex inputs (or the geometry-provided layout)
+            uint32_t expectedStride = GetVertexStride();
 
             // Check if strides match
             if (expectedStride != geometryStride) {
@@ -1375,69 +858,8 @@ namespace FirstEngine {
                         return false;
                     }
                     
-                    bool parameterSet = false;
-                    const auto& reflection = m_ShaderReflection;
-                    
-                    // Try to match parameter to uniform buffer members using shader reflection
-                    for (const auto& ubReflection : reflection.uniform_buffers) {
-                        // Find the corresponding UniformBufferBinding
-                        UniformBufferBinding* ub = GetUniformBuffer(ubReflection.set, ubReflection.binding);
-                        if (!ub) {
-                            continue;
-                        }
-                        
-                        // Check if parameter name matches uniform buffer name
-                        if (ubReflection.name == key) {
-                            // Parameter name matches buffer name - copy entire buffer data
-                            if (size <= ub->size) {
-                                std::memcpy(ub->data.data(), data, std::min(size, ub->size));
-                                parameterSet = true;
-                                
-                                break;
-                            }
-                        }
-                        
-                        // Try to match parameter to uniform buffer members
-                        for (const auto& member : ubReflection.members) {
-                            // Check if parameter name matches member name
-                            if (member.name == key) {
-                                // Get actual member offset from reflection
-                                uint32_t memberOffset = member.offset;
-                                
-                                // If offset is 0 (not set by compiler), calculate it from previous members
-                                if (memberOffset == 0 && !ubReflection.members.empty()) {
-                                    uint32_t calculatedOffset = 0;
-                                    for (const auto& prevMember : ubReflection.members) {
-                                        if (prevMember.name == member.name) {
-                                            break; // Found the target member
-                                        }
-                                        // Add size of previous member (with std140 alignment)
-                                        uint32_t prevSize = prevMember.size > 0 ? prevMember.size : 64; // Default to 64 for mat4
-                                        // Align to 16-byte boundary (std140 layout)
-                                        calculatedOffset = (calculatedOffset + 15) & ~15;
-                                        calculatedOffset += prevSize;
-                                    }
-                                    // Align final offset to 16-byte boundary
-                                    memberOffset = (calculatedOffset + 15) & ~15;
-                                }
-                                
-                                // Ensure we don't overflow the buffer
-                                if (memberOffset + size <= ub->size) {
-                                    std::memcpy(ub->data.data() + memberOffset, data, size);
-                                    parameterSet = true;
-                                    break;
-                                } else {
-                                    std::cerr << "Warning: ShadingMaterial::ApplyRenderParameter: Parameter '" << key 
-                                              << "' size " << size << " exceeds buffer size at offset " << memberOffset 
-                                              << " (buffer size: " << ub->size << ")" << std::endl;
-                                }
-                            }
-                        }
-                        
-                        if (parameterSet) {
-                            break;
-                        }
-                    }
+                    // Parameter locations (buffer or member name -> offset) come from the shared layout
+                    bool parameterSet = WriteUniformParameter(key, data, size);
                     
                     // Fallback: If not matched to any uniform buffer member, try UpdateUniformBufferByName
                     // This handles cases where the parameter name matches the buffer name
@@ -10,21 +10,23 @@ namespace FirstEngine {
         ShadingState::ShadingState() = default;
 
         ShadingState::~ShadingState() {
+            // An in-flight compile owns its own result, wait for it so the worker doesn't outlive the shader modules
+            // Only this request: other materials' compiles have nothing to do with ours
+            if (m_PendingCompile && !m_PendingCompile->IsCompleted()) {
+                PipelineCompiler::GetInstance().Wait(m_PendingCompile);
+            }
+            m_PendingCompile.reset();
+
             // Pipeline is managed by unique_ptr, will be destroyed automatically
             m_Pipeline.reset();
         }
 
-        bool ShadingState::CreatePipeline(
-            RHI::IDevice* device, 
+        RHI::GraphicsPipelineDescription ShadingState::BuildPipelineDescription(
             RHI::IRenderPass* renderPass,
             const std::vector<RHI::VertexInputBinding>& vertexBindings,
             const std::vector<RHI::VertexInputAttribute>& vertexAttributes,
             const std::vector<RHI::DescriptorSetLayoutHandle>& descriptorSetLayouts
-        ) {
-            if (!device || !renderPass) {
-                return false;
-            }
-
+        ) const {
             // Build GraphicsPipelineDescription from PipelineState and shader modules
             RHI::GraphicsPipelineDescription pipelineDesc;
             pipelineDesc.renderPass = renderPass;
@@ -65,15 +67,86 @@ namespace FirstEngine {
             // Copy color blend attachments
             pipelineDesc.colorBlendAttachments = pipelineState.colorBlendAttachments;
 
+            return pipelineDesc;
+        }
+
+        bool ShadingState::CreatePipeline(
+            RHI::IDevice* device, 
+            RHI::IRenderPass* renderPass,
+            const std::vector<RHI::VertexInputBinding>& vertexBindings,
+            const std::vector<RHI::VertexInputAttribute>& vertexAttributes,
+            const std::vector<RHI::DescriptorSetLayoutHandle>& descriptorSetLayouts
+        ) {
+            if (!device || !renderPass) {
+                return false;
+            }
+
+            RHI::GraphicsPipelineDescription pipelineDesc = BuildPipelineDescription(
+                renderPass, vertexBindings, vertexAttributes, descriptorSetLayouts);
+
             // Create pipeline
             m_Pipeline = device->CreateGraphicsPipeline(pipelineDesc);
             if (!m_Pipeline) {
                 return false;
             }
 
+            m_PipelineRenderPass = renderPass;
             m_PipelineDirty = false;
             return true;
         }
 
+        bool ShadingState::CreatePipelineAsync(
+            RHI::IDevice* device,
+            RHI::IRenderPass* renderPass,
+            const std::vector<RHI::VertexInputBinding>& vertexBindings,
+            const std::vector<RHI::VertexInputAttribute>& vertexAttributes,
+            const std::vector<RHI::DescriptorSetLayoutHandle>& descriptorSetLayouts
+        ) {
+            if (!device || !renderPass) {
+                return false;
+            }
+
+            if (IsPipelineReady(renderPass)) {
+                return true;
+            }
+
+            // Poll the in-flight request
+            if (m_PendingCompile) {
+                if (!m_PendingCompile->IsCompleted()) {
+                    return false;
+                }
+
+                auto request = std::move(m_PendingCompile);
+                m_PendingCompile.reset();
+
+                // Result was compiled against an older render pass, drop it and recompile below
+                if (request->description.renderPass == renderPass) {
+                    if (!request->succeeded) {
+                        m_PipelineCompileFailed = true;
+                        return false;
+                    }
+                    m_Pipeline = std::move(request->pipeline);
+                    m_PipelineRenderPass = renderPass;
+                    m_PipelineDirty = false;
+                    return true;
+                }
+            }
+
+            // Don't resubmit a pipeline that is known to fail every frame
+            if (m_PipelineCompileFailed) {
+                return false;
+            }
+
+            m_PendingCompile = PipelineCompiler::GetInstance().Submit(
+                device,
+                BuildPipelineDescription(renderPass, vertexBindings, vertexAttributes, descriptorSetLayouts));
+
+            // Synchronous fallback (no worker pool) completes inside Submit
+            if (m_PendingCompile->IsCompleted()) {
+                return CreatePipelineAsync(device, renderPass, vertexBindings, vertexAttributes, descriptorSetLayouts);
+            }
+            return false;
+        }
+
     } // namespace Renderer
 } // namespace FirstEngine
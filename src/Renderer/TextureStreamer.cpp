@@ -0,0 +1,217 @@
+#include "FirstEngine/Renderer/TextureStreamer.h"
+#include "FirstEngine/Renderer/RenderTexture.h"
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+namespace FirstEngine {
+    namespace Renderer {
+
+        namespace {
+            struct Candidate {
+                RenderTexture* texture = nullptr;
+                uint64_t lastRequestFrame = 0;
+                uint32_t target = 0;
+
+                uint64_t TopLevelBytes() const {
+                    return texture->GetMipChainBytes(target) - texture->GetMipChainBytes(target + 1);
+                }
+            };
+        }
+
+        TextureStreamer* TextureStreamer::s_Instance = nullptr;
+
+        TextureStreamer& TextureStreamer::GetInstance() {
+            if (!s_Instance) {
+                s_Instance = new TextureStreamer();
+            }
+            return *s_Instance;
+        }
+
+        void TextureStreamer::Shutdown() {
+            if (s_Instance) {
+                delete s_Instance;
+                s_Instance = nullptr;
+            }
+        }
+
+        uint32_t TextureStreamer::GetTailMip(uint32_t width, uint32_t height, uint32_t mipCount) const {
+            uint32_t mip = 0;
+            while (mip + 1 < mipCount && std::max(width >> mip, height >> mip) > m_TailSize) {
+                ++mip;
+            }
+            return mip;
+        }
+
+        void TextureStreamer::Register(RenderTexture* texture) {
+            if (!texture) {
+                return;
+            }
+            std::lock_guard<std::mutex> lock(m_Mutex);
+            Entry entry;
+            entry.requestedMip = texture->GetTailMip();
+            entry.wantedMip = texture->GetTailMip();
+            m_Entries[texture] = entry;
+        }
+
+        void TextureStreamer::Unregister(RenderTexture* texture) {
+            std::lock_guard<std::mutex> lock(m_Mutex);
+            m_Entries.erase(texture);
+        }
+
+        void TextureStreamer::RequestScreenSize(RenderTexture* texture, float screenPixels) {
+            if (!texture || !texture->IsStreamed()) {
+                return;
+            }
+
+            // About one texel per pixel: each level halves the texels across the texture
+            float texels = static_cast<float>(std::max(texture->GetWidth(), texture->GetHeight()));
+            float mipLevel = std::log2(texels / std::max(screenPixels, 1e-6f)) + m_MipBias;
+            uint32_t mip = texture->GetTailMip();
+            if (mipLevel < static_cast<float>(mip)) {
+                mip = mipLevel <= 0.0f ? 0 : static_cast<uint32_t>(mipLevel);
+            }
+
+            std::lock_guard<std::mutex> lock(m_Mutex);
+            auto it = m_Entries.find(texture);
+            if (it == m_Entries.end()) {
+                return;
+            }
+            Entry& entry = it->second;
+            if (entry.lastRequestFrame != m_Frame) {
+                entry.lastRequestFrame = m_Frame;
+                entry.requestedMip = mip;
+            } else {
+                entry.requestedMip = std::min(entry.requestedMip, mip);
+            }
+        }
+
+        void TextureStreamer::Update() {
+            std::lock_guard<std::mutex> lock(m_Mutex);
+
+            Statistics stats;
+            stats.streamedTextures = static_cast<uint32_t>(m_Entries.size());
+            stats.budgetBytes = m_Budget;
+            stats.bytesStreamed = m_Stats.bytesStreamed;
+            stats.promotions = m_Stats.promotions;
+            stats.evictions = m_Stats.evictions;
+
+            // Textures drawn last frame want their density mip; the others keep what they have (or are
+            // transitioning to) until the budget needs the space
+            std::vector<Candidate> candidates;
+            candidates.reserve(m_Entries.size());
+            uint64_t totalBytes = 0;
+            for (auto& pair : m_Entries) {
+                RenderTexture* texture = pair.first;
+                Entry& entry = pair.second;
+                texture->UpdateResidency();
+
+                bool drawn = entry.lastRequestFrame == m_Frame;
+                entry.wantedMip = drawn ? std::min(entry.requestedMip, texture->GetTailMip()) : texture->GetTailMip();
+                if (drawn) {
+                    stats.requestedTextures++;
+                }
+
+                Candidate candidate;
+                candidate.texture = texture;
+                candidate.lastRequestFrame = entry.lastRequestFrame;
+                candidate.target = drawn ? entry.wantedMip : texture->GetTargetMip();
+                totalBytes += texture->GetMipChainBytes(candidate.target);
+                stats.wantedBytes += texture->GetMipChainBytes(entry.wantedMip);
+                candidates.push_back(candidate);
+            }
+
+            // Over budget: drop the finest level of the least recently drawn texture, the largest level first
+            // among textures drawn in the same frame, until the targets fit
+            if (totalBytes > m_Budget) {
+                auto evictLater = [&candidates](size_t a, size_t b) {
+                    const Candidate& ca = candidates[a];
+                    const Candidate& cb = candidates[b];
+                    if (ca.lastRequestFrame != cb.lastRequestFrame) {
+                        return ca.lastRequestFrame > cb.lastRequestFrame;
+                    }
+                    return ca.TopLevelBytes() < cb.TopLevelBytes();
+                };
+                std::vector<size_t> heap;
+                for (size_t i = 0; i < candidates.size(); ++i) {
+                    if (candidates[i].target < candidates[i].texture->GetTailMip()) {
+                        heap.push_back(i);
+                    }
+                }
+                std::make_heap(heap.begin(), heap.end(), evictLater);
+                while (totalBytes > m_Budget && !heap.empty()) {
+                    std::pop_heap(heap.begin(), heap.end(), evictLater);
+                    size_t index = heap.back();
+                    heap.pop_back();
+
+                    Candidate& candidate = candidates[index];
+                    totalBytes -= candidate.TopLevelBytes();
+                    candidate.target++;
+                    if (candidate.target < candidate.texture->GetTailMip()) {
+                        heap.push_back(index);
+                        std::push_heap(heap.begin(), heap.end(), evictLater);
+                    }
+                }
+            }
+
+            // Start transitions: evictions first (they make room), then the textures furthest from their target
+            auto transitionOrder = [](const Candidate& a, const Candidate& b) {
+                int64_t deltaA = static_cast<int64_t>(a.texture->GetTargetMip()) - static_cast<int64_t>(a.target);
+                int64_t deltaB = static_cast<int64_t>(b.texture->GetTargetMip()) - static_cast<int64_t>(b.target);
+                bool evictA = deltaA < 0;
+                bool evictB = deltaB < 0;
+                if (evictA != evictB) {
+                    return evictA;
+                }
+                return deltaA > deltaB;
+            };
+            std::sort(candidates.begin(), candidates.end(), transitionOrder);
+
+            uint64_t uploadedBytes = 0;
+            for (const Candidate& candidate : candidates) {
+                RenderTexture* texture = candidate.texture;
+                uint32_t current = texture->GetTargetMip();
+                if (candidate.target == current || texture->IsResidencyChangePending()) {
+                    continue;
+                }
+                uint64_t bytes = texture->GetMipChainBytes(candidate.target);
+                if (uploadedBytes > 0 && uploadedBytes + bytes > m_MaxUploadBytesPerFrame) {
+                    continue;
+                }
+
+                bytes = texture->RequestResidency(candidate.target);
+                if (bytes == 0) {
+                    continue;
+                }
+                uploadedBytes += bytes;
+                stats.bytesStreamed += bytes;
+                if (candidate.target < current) {
+                    stats.promotions++;
+                } else {
+                    stats.evictions++;
+                }
+            }
+
+            for (const auto& pair : m_Entries) {
+                const RenderTexture* texture = pair.first;
+                stats.residentBytes += texture->GetMipChainBytes(texture->GetResidentMip());
+                if (texture->IsResidencyChangePending()) {
+                    stats.pendingTransitions++;
+                }
+                if (texture->GetResidentMip() > pair.second.wantedMip) {
+                    stats.texturesBelowWanted++;
+                }
+            }
+            m_Stats = stats;
+
+            // Requests from now on belong to the next frame
+            m_Frame++;
+        }
+
+        TextureStreamer::Statistics TextureStreamer::GetStatistics() const {
+            std::lock_guard<std::mutex> lock(m_Mutex);
+            return m_Stats;
+        }
+
+    } // namespace Renderer
+} // namespace FirstEngine
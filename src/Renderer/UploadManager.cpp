@@ -0,0 +1,369 @@
+#include "FirstEngine/Renderer/UploadManager.h"
+#include "FirstEngine/RHI/IDevice.h"
+#include "FirstEngine/RHI/ICommandBuffer.h"
+#include "FirstEngine/RHI/IBuffer.h"
+#include "FirstEngine/RHI/IImage.h"
+#include <algorithm>
+#include <cstring>
+#include <iostream>
+
+namespace FirstEngine {
+    namespace Renderer {
+
+        namespace {
+            constexpr uint64_t kBufferCopyAlignment = 16;
+            // Covers texel/block sizes and optimalBufferCopyOffsetAlignment on common hardware
+            constexpr uint64_t kImageCopyAlignment = 256;
+
+            uint64_t AlignUp(uint64_t value, uint64_t alignment) {
+                return (value + alignment - 1) & ~(alignment - 1);
+            }
+
+            RHI::MemoryPropertyFlags StagingMemoryProperties() {
+                return RHI::MemoryPropertyFlags::HostVisible | RHI::MemoryPropertyFlags::HostCoherent;
+            }
+        }
+
+        UploadManager* UploadManager::s_Instance = nullptr;
+
+        UploadManager& UploadManager::GetInstance() {
+            if (!s_Instance) {
+                s_Instance = new UploadManager();
+            }
+            return *s_Instance;
+        }
+
+        void UploadManager::Shutdown() {
+            if (s_Instance) {
+                s_Instance->Cleanup();
+                delete s_Instance;
+                s_Instance = nullptr;
+            }
+        }
+
+        UploadManager::~UploadManager() {
+            Cleanup();
+        }
+
+        bool UploadManager::Initialize(RHI::IDevice* device, uint64_t ringSize) {
+            if (!device || ringSize == 0) {
+                return false;
+            }
+            if (m_Device == device) {
+                return true;
+            }
+            if (m_Device) {
+                Cleanup();
+            }
+
+            std::lock_guard<std::mutex> lock(m_Mutex);
+
+            ringSize = AlignUp(ringSize, kImageCopyAlignment);
+            m_RingBuffer = device->CreateBuffer(ringSize, RHI::BufferUsageFlags::TransferSrc, StagingMemoryProperties());
+            if (!m_RingBuffer) {
+                std::cerr << "UploadManager::Initialize: Failed to create " << ringSize << " byte staging ring" << std::endl;
+                return false;
+            }
+
+            // Host-visible buffers are persistently mapped; the pointer stays valid until the buffer dies
+            m_RingData = static_cast<uint8_t*>(m_RingBuffer->GetMappedPointer());
+            if (!m_RingData) {
+                std::cerr << "UploadManager::Initialize: Failed to map staging ring" << std::endl;
+                m_RingBuffer.reset();
+                return false;
+            }
+
+            m_Device = device;
+            m_RingSize = ringSize;
+            m_RingHead = 0;
+            m_RingTail = 0;
+            return true;
+        }
+
+        void UploadManager::Cleanup() {
+            std::lock_guard<std::mutex> lock(m_Mutex);
+            if (!m_Device) {
+                return;
+            }
+
+            // Whatever is still queued gets submitted, so resources waiting on it become ready
+            FlushLocked();
+            RetireLocked(true);
+
+            for (RHI::FenceHandle fence : m_FreeFences) {
+                m_Device->DestroyFence(fence);
+            }
+            m_FreeFences.clear();
+
+            m_RingBuffer.reset();
+            m_RingData = nullptr;
+            m_RingSize = 0;
+            m_RingHead = 0;
+            m_RingTail = 0;
+            m_Device = nullptr;
+        }
+
+        uint64_t UploadManager::UploadBuffer(RHI::IBuffer* dst, const void* data, uint64_t size, uint64_t dstOffset) {
+            if (!dst || !data || size == 0) {
+                return 0;
+            }
+
+            std::lock_guard<std::mutex> lock(m_Mutex);
+            if (!m_Device) {
+                std::cerr << "UploadManager::UploadBuffer: Not initialized" << std::endl;
+                return 0;
+            }
+
+            PendingCopy copy;
+            copy.type = CopyType::Buffer;
+            copy.dstBuffer = dst;
+            copy.dstOffset = dstOffset;
+            copy.size = size;
+            if (!AllocateStaging(data, size, kBufferCopyAlignment, copy)) {
+                return 0;
+            }
+
+            m_Pending.push_back(copy);
+            m_Stats.bytesUploaded += size;
+            return m_CurrentTicket;
+        }
+
+        uint64_t UploadManager::UploadImage(RHI::IImage* dst, const void* data, uint64_t size,
+                                            uint32_t width, uint32_t height, RHI::Format format, uint32_t mipLevel) {
+            if (!dst || !data || size == 0 || width == 0 || height == 0) {
+                return 0;
+            }
+
+            std::lock_guard<std::mutex> lock(m_Mutex);
+            if (!m_Device) {
+                std::cerr << "UploadManager::UploadImage: Not initialized" << std::endl;
+                return 0;
+            }
+
+            PendingCopy copy;
+            copy.type = CopyType::Image;
+            copy.dstImage = dst;
+            copy.size = size;
+            copy.width = width;
+            copy.height = height;
+            copy.format = format;
+            copy.mipLevel = mipLevel;
+            if (!AllocateStaging(data, size, kImageCopyAlignment, copy)) {
+                return 0;
+            }
+
+            m_Pending.push_back(copy);
+            m_Stats.bytesUploaded += size;
+            return m_CurrentTicket;
+        }
+
+        uint64_t UploadManager::Flush() {
+            std::lock_guard<std::mutex> lock(m_Mutex);
+            return FlushLocked();
+        }
+
+        void UploadManager::Update() {
+            std::lock_guard<std::mutex> lock(m_Mutex);
+            if (m_Device) {
+                RetireLocked(false);
+            }
+        }
+
+        bool UploadManager::IsComplete(uint64_t ticket) const {
+            std::lock_guard<std::mutex> lock(m_Mutex);
+            return ticket <= m_CompletedTicket;
+        }
+
+        void UploadManager::WaitForTicket(uint64_t ticket) {
+            std::lock_guard<std::mutex> lock(m_Mutex);
+            if (!m_Device || ticket <= m_CompletedTicket) {
+                return;
+            }
+
+            if (ticket >= m_CurrentTicket) {
+                FlushLocked();
+            }
+
+            while (!m_InFlight.empty() && m_InFlight.front().ticket <= ticket) {
+                if (m_InFlight.front().fence) {
+                    m_Device->WaitForFence(m_InFlight.front().fence, UINT64_MAX);
+                }
+                RetireLocked(false);
+            }
+        }
+
+        void UploadManager::WaitIdle() {
+            std::lock_guard<std::mutex> lock(m_Mutex);
+            if (!m_Device) {
+                return;
+            }
+            FlushLocked();
+            RetireLocked(true);
+        }
+
+        UploadManager::Statistics UploadManager::GetStatistics() const {
+            std::lock_guard<std::mutex> lock(m_Mutex);
+            Statistics stats = m_Stats;
+            stats.batchesInFlight = static_cast<uint32_t>(m_InFlight.size());
+            return stats;
+        }
+
+        bool UploadManager::TryAllocateRing(uint64_t size, uint64_t alignment, uint64_t& outOffset) {
+            if (size > m_RingSize) {
+                return false;
+            }
+
+            uint64_t position = m_RingHead % m_RingSize;
+            uint64_t start = AlignUp(position, alignment);
+            uint64_t padding = start - position;
+            if (start + size > m_RingSize) {
+                // Doesn't fit before the end: skip the tail of the ring and start over at 0
+                padding = m_RingSize - position;
+                start = 0;
+            }
+
+            // [m_RingTail, m_RingHead) is still owned by queued or in-flight copies
+            if (m_RingHead + padding + size - m_RingTail > m_RingSize) {
+                return false;
+            }
+
+            m_RingHead += padding + size;
+            outOffset = start;
+            return true;
+        }
+
+        bool UploadManager::AllocateStaging(const void* data, uint64_t size, uint64_t alignment, PendingCopy& copy) {
+            // Big uploads (e.g. large textures) would drain the whole ring; give them their own staging buffer
+            if (size > m_RingSize / 2) {
+                auto staging = m_Device->CreateBuffer(size, RHI::BufferUsageFlags::TransferSrc, StagingMemoryProperties());
+                if (!staging) {
+                    std::cerr << "UploadManager: Failed to create " << size << " byte staging buffer" << std::endl;
+                    return false;
+                }
+                void* mapped = staging->GetMappedPointer();
+                if (!mapped) {
+                    return false;
+                }
+                std::memcpy(mapped, data, size);
+                staging->FlushMappedRange(0, size);
+
+                copy.src = staging.get();
+                copy.srcOffset = 0;
+                m_PendingOversized.push_back(std::move(staging));
+                m_Stats.oversizedUploads++;
+                return true;
+            }
+
+            uint64_t offset = 0;
+            while (!TryAllocateRing(size, alignment, offset)) {
+                // Ring full: submit what is queued and wait for the oldest batch to hand its space back
+                m_Stats.ringStalls++;
+                FlushLocked();
+                if (m_InFlight.empty()) {
+                    std::cerr << "UploadManager: Staging ring exhausted with nothing in flight" << std::endl;
+                    return false;
+                }
+                if (m_InFlight.front().fence) {
+                    m_Device->WaitForFence(m_InFlight.front().fence, UINT64_MAX);
+                }
+                RetireLocked(false);
+            }
+
+            std::memcpy(m_RingData + offset, data, size);
+            m_RingBuffer->FlushMappedRange(offset, size);
+            copy.src = m_RingBuffer.get();
+            copy.srcOffset = offset;
+            return true;
+        }
+
+        uint64_t UploadManager::FlushLocked() {
+            if (!m_Device || m_Pending.empty()) {
+                return 0;
+            }
+
+            auto commandBuffer = m_Device->CreateCommandBuffer();
+            if (!commandBuffer) {
+                std::cerr << "UploadManager::Flush: Failed to create command buffer" << std::endl;
+                return 0;
+            }
+
+            // Images get one UNDEFINED -> TRANSFER_DST barrier over all their levels, every copy, then one
+            // TRANSFER_DST -> SHADER_READ_ONLY barrier, however many levels this batch writes
+            std::vector<RHI::IImage*> images;
+            for (const PendingCopy& copy : m_Pending) {
+                if (copy.type == CopyType::Image &&
+                    std::find(images.begin(), images.end(), copy.dstImage) == images.end()) {
+                    images.push_back(copy.dstImage);
+                }
+            }
+
+            commandBuffer->Begin();
+            for (RHI::IImage* image : images) {
+                commandBuffer->TransitionImageLayout(image, RHI::ImageLayout::TransferDst, image->GetMipLevels());
+            }
+            for (const PendingCopy& copy : m_Pending) {
+                if (copy.type == CopyType::Buffer) {
+                    commandBuffer->CopyBuffer(copy.src, copy.dstBuffer, copy.size, copy.srcOffset, copy.dstOffset);
+                } else {
+                    commandBuffer->CopyBufferToImage(copy.src, copy.dstImage, copy.width, copy.height, copy.srcOffset,
+                                                     copy.mipLevel);
+                }
+            }
+            for (RHI::IImage* image : images) {
+                commandBuffer->TransitionImageLayout(image, RHI::ImageLayout::ShaderReadOnly, image->GetMipLevels());
+            }
+            commandBuffer->End();
+
+            Batch batch;
+            batch.ticket = m_CurrentTicket;
+            batch.ringEnd = m_RingHead;
+            batch.commandBuffer = std::move(commandBuffer);
+            batch.fence = AcquireFence();
+            batch.oversizedBuffers = std::move(m_PendingOversized);
+
+            m_Device->SubmitCommandBuffer(batch.commandBuffer.get(), {}, {}, batch.fence);
+            if (!batch.fence) {
+                // No fence to poll; fall back to draining the queue so the batch can retire right away
+                m_Device->WaitIdle();
+            }
+
+            m_Stats.submissions++;
+            m_Stats.copiesRecorded += static_cast<uint32_t>(m_Pending.size());
+            m_Pending.clear();
+            m_PendingOversized.clear();
+            m_InFlight.push_back(std::move(batch));
+
+            return m_CurrentTicket++;
+        }
+
+        void UploadManager::RetireLocked(bool wait) {
+            // Batches go to one queue, so they complete in submission order
+            while (!m_InFlight.empty()) {
+                Batch& batch = m_InFlight.front();
+                if (batch.fence) {
+                    if (wait) {
+                        m_Device->WaitForFence(batch.fence, UINT64_MAX);
+                    } else if (!m_Device->IsFenceSignaled(batch.fence)) {
+                        break;
+                    }
+                    m_Device->ResetFence(batch.fence);
+                    m_FreeFences.push_back(batch.fence);
+                }
+
+                m_RingTail = batch.ringEnd;
+                m_CompletedTicket = batch.ticket;
+                m_InFlight.pop_front();
+            }
+        }
+
+        RHI::FenceHandle UploadManager::AcquireFence() {
+            if (!m_FreeFences.empty()) {
+                RHI::FenceHandle fence = m_FreeFences.back();
+                m_FreeFences.pop_back();
+                return fence;
+            }
+            return m_Device->CreateFence(false);
+        }
+
+    } // namespace Renderer
+} // namespace FirstEngine
@@ -0,0 +1,445 @@
+#include "FirstEngine/Resources/CompiledManifest.h"
+#include <algorithm>
+#include <fstream>
+#include <iostream>
+#include <numeric>
+#include <unordered_map>
+#if __has_include(<filesystem>)
+#include <filesystem>
+namespace fs = std::filesystem;
+#else
+#include <experimental/filesystem>
+namespace fs = std::experimental::filesystem;
+#endif
+
+namespace FirstEngine {
+    namespace Resources {
+
+        namespace {
+            constexpr uint32_t kMaxDisplacement = 1u << 16;
+            constexpr uint32_t kMaxSeeds = 16;
+
+            // Reads a path the way ResourceIDManager::NormalizePath rewrites it, one character at a time
+            struct NormalizedPathReader {
+                const char* it;
+                const char* end;
+                bool lastWasSlash = false;
+
+                NormalizedPathReader(const char* path, size_t length) : it(path), end(path + length) {}
+
+                bool Next(char& c) {
+                    while (it < end) {
+                        char ch = *it++;
+                        if (ch == '\\') {
+                            ch = '/';
+                        }
+                        if (ch == '/') {
+                            if (lastWasSlash) {
+                                continue;
+                            }
+                            lastWasSlash = true;
+                        } else {
+                            lastWasSlash = false;
+                        }
+                        c = (ch >= 'A' && ch <= 'Z') ? static_cast<char>(ch - 'A' + 'a') : ch;
+                        return true;
+                    }
+                    return false;
+                }
+            };
+
+            uint64_t Mix(uint64_t value) {
+                value ^= value >> 30;
+                value *= 0xBF58476D1CE4E5B9ull;
+                value ^= value >> 27;
+                value *= 0x94D049BB133111EBull;
+                value ^= value >> 31;
+                return value;
+            }
+
+            uint64_t HashID(ResourceID id, uint64_t seed) {
+                return Mix(id ^ Mix(seed + 1));
+            }
+
+            // FNV-1a of the normalized path
+            uint64_t HashPath(const char* path, size_t length, uint64_t seed) {
+                uint64_t hash = 14695981039346656037ull ^ seed;
+                NormalizedPathReader reader(path, length);
+                char c;
+                while (reader.Next(c)) {
+                    hash ^= static_cast<uint8_t>(c);
+                    hash *= 1099511628211ull;
+                }
+                return Mix(hash);
+            }
+
+            bool PathEquals(const char* stored, size_t storedLength, const char* key, size_t keyLength) {
+                NormalizedPathReader a(stored, storedLength);
+                NormalizedPathReader b(key, keyLength);
+                char ca;
+                char cb;
+                for (;;) {
+                    bool hasA = a.Next(ca);
+                    bool hasB = b.Next(cb);
+                    if (hasA != hasB) {
+                        return false;
+                    }
+                    if (!hasA) {
+                        return true;
+                    }
+                    if (ca != cb) {
+                        return false;
+                    }
+                }
+            }
+
+            std::string NormalizedPath(const std::string& path) {
+                std::string normalized;
+                normalized.reserve(path.size());
+                NormalizedPathReader reader(path.data(), path.size());
+                char c;
+                while (reader.Next(c)) {
+                    normalized += c;
+                }
+                return normalized;
+            }
+
+            uint32_t GetBucket(uint64_t hash, uint32_t bucketCount) {
+                return static_cast<uint32_t>((hash >> 32) % bucketCount);
+            }
+
+            uint32_t GetSlot(uint64_t hash, uint32_t displacement, uint32_t slotCount) {
+                return static_cast<uint32_t>(Mix(hash + (static_cast<uint64_t>(displacement) + 1) * 0x9E3779B97F4A7C15ull) % slotCount);
+            }
+
+            // Hash and displace: place the largest buckets first, trying displacements until every key of
+            // the bucket lands on a free slot. Fails only if two keys share a hash.
+            bool BuildIndex(const std::vector<uint64_t>& hashes, uint32_t bucketCount, uint32_t slotCount,
+                            std::vector<uint32_t>& index) {
+                index.assign(static_cast<size_t>(bucketCount) + slotCount, 0);
+                uint32_t* displacements = index.data();
+                uint32_t* slots = index.data() + bucketCount;
+                std::fill(slots, slots + slotCount, CompiledManifestFormat::kEmptySlot);
+
+                std::vector<uint32_t> bucketStart(static_cast<size_t>(bucketCount) + 1, 0);
+                for (uint64_t hash : hashes) {
+                    bucketStart[GetBucket(hash, bucketCount) + 1]++;
+                }
+                std::partial_sum(bucketStart.begin(), bucketStart.end(), bucketStart.begin());
+                std::vector<uint32_t> keys(hashes.size());
+                std::vector<uint32_t> cursor(bucketStart.begin(), bucketStart.end() - 1);
+                for (uint32_t i = 0; i < static_cast<uint32_t>(hashes.size()); ++i) {
+                    keys[cursor[GetBucket(hashes[i], bucketCount)]++] = i;
+                }
+
+                std::vector<uint32_t> order(bucketCount);
+                std::iota(order.begin(), order.end(), 0u);
+                std::sort(order.begin(), order.end(), [&bucketStart](uint32_t a, uint32_t b) {
+                    return bucketStart[a + 1] - bucketStart[a] > bucketStart[b + 1] - bucketStart[b];
+                });
+
+                std::vector<uint32_t> placed;
+                for (uint32_t bucket : order) {
+                    uint32_t begin = bucketStart[bucket];
+                    uint32_t end = bucketStart[bucket + 1];
+                    if (begin == end) {
+                        break;    // The rest are empty too
+                    }
+
+                    bool done = false;
+                    for (uint32_t displacement = 0; displacement < kMaxDisplacement && !done; ++displacement) {
+                        placed.clear();
+                        for (uint32_t k = begin; k < end; ++k) {
+                            uint32_t slot = GetSlot(hashes[keys[k]], displacement, slotCount);
+                            if (slots[slot] != CompiledManifestFormat::kEmptySlot ||
+                                std::find(placed.begin(), placed.end(), slot) != placed.end()) {
+                                break;
+                            }
+                            placed.push_back(slot);
+                        }
+                        if (placed.size() == end - begin) {
+                            for (uint32_t k = begin; k < end; ++k) {
+                                slots[placed[k - begin]] = keys[k];
+                            }
+                            displacements[bucket] = displacement;
+                            done = true;
+                        }
+                    }
+                    if (!done) {
+                        return false;
+                    }
+                }
+                return true;
+            }
+        }
+
+        bool CompiledManifest::Open(const std::string& filepath) {
+            auto file = std::make_shared<MappedFile>();
+            if (!file->Open(filepath)) {
+                return false;
+            }
+            return Open(std::move(file), filepath);
+        }
+
+        bool CompiledManifest::Open(std::shared_ptr<MappedFile> file, const std::string& name) {
+            Close();
+
+            if (!file || !file->IsOpen()) {
+                return false;
+            }
+
+            const uint8_t* data = file->GetData();
+            uint64_t size = file->GetSize();
+            auto fail = [&name](const char* reason) {
+                std::cerr << "CompiledManifest::Open: " << name << ": " << reason << std::endl;
+                return false;
+            };
+            auto inRange = [size](uint64_t offset, uint64_t bytes) {
+                return offset <= size && bytes <= size - offset;
+            };
+
+            if (size < sizeof(CompiledManifestHeader)) {
+                return fail("File too small");
+            }
+            const auto* header = reinterpret_cast<const CompiledManifestHeader*>(data);
+            if (header->magic != CompiledManifestFormat::kMagic) {
+                return fail("Not a compiled manifest");
+            }
+            if (header->version != CompiledManifestFormat::kVersion) {
+                return fail("Unsupported version, save the manifest again");
+            }
+
+            uint64_t indexSize = (static_cast<uint64_t>(header->bucketCount) + header->slotCount) * sizeof(uint32_t);
+            auto indexValid = [&inRange, indexSize](uint64_t offset) {
+                return offset % sizeof(uint32_t) == 0 && inRange(offset, indexSize);
+            };
+            if (header->fileSize != size || header->bucketCount == 0 || header->slotCount < header->entryCount ||
+                header->slotCount == 0 || header->entriesOffset % alignof(CompiledManifestEntry) != 0 ||
+                !inRange(header->entriesOffset, static_cast<uint64_t>(header->entryCount) * sizeof(CompiledManifestEntry)) ||
+                !indexValid(header->idIndexOffset) || !indexValid(header->pathIndexOffset) ||
+                !indexValid(header->virtualPathIndexOffset) || !inRange(header->stringsOffset, header->stringsSize)) {
+                return fail("Truncated or corrupt");
+            }
+
+            // Entries and slots are checked when they are used, so opening does not touch every page
+            m_Name = name;
+            m_File = std::move(file);
+            m_Header = header;
+            m_Entries = reinterpret_cast<const CompiledManifestEntry*>(data + header->entriesOffset);
+            m_IDIndex = reinterpret_cast<const uint32_t*>(data + header->idIndexOffset);
+            m_PathIndex = reinterpret_cast<const uint32_t*>(data + header->pathIndexOffset);
+            m_VirtualPathIndex = reinterpret_cast<const uint32_t*>(data + header->virtualPathIndexOffset);
+            m_Strings = reinterpret_cast<const char*>(data + header->stringsOffset);
+            return true;
+        }
+
+        void CompiledManifest::Close() {
+            m_Header = nullptr;
+            m_Entries = nullptr;
+            m_IDIndex = nullptr;
+            m_PathIndex = nullptr;
+            m_VirtualPathIndex = nullptr;
+            m_Strings = nullptr;
+            m_File.reset();
+            m_Name.clear();
+        }
+
+        std::string CompiledManifest::GetString(uint32_t offset, uint32_t length) const {
+            if (static_cast<uint64_t>(offset) + length > m_Header->stringsSize) {
+                std::cerr << "CompiledManifest: " << m_Name << ": Corrupt string pool" << std::endl;
+                return std::string();
+            }
+            return std::string(m_Strings + offset, length);
+        }
+
+        std::string CompiledManifest::GetPath(uint32_t index) const {
+            return GetString(m_Entries[index].pathOffset, m_Entries[index].pathLength);
+        }
+
+        std::string CompiledManifest::GetVirtualPath(uint32_t index) const {
+            return GetString(m_Entries[index].virtualPathOffset, m_Entries[index].virtualPathLength);
+        }
+
+        uint32_t CompiledManifest::Probe(const uint32_t* index, uint64_t hash) const {
+            uint32_t displacement = index[GetBucket(hash, m_Header->bucketCount)];
+            uint32_t entry = index[m_Header->bucketCount + GetSlot(hash, displacement, m_Header->slotCount)];
+            return entry < m_Header->entryCount ? entry : kInvalidEntry;
+        }
+
+        uint32_t CompiledManifest::FindID(ResourceID id) const {
+            if (!m_Header || id == InvalidResourceID) {
+                return kInvalidEntry;
+            }
+            uint32_t entry = Probe(m_IDIndex, HashID(id, m_Header->seed));
+            return (entry != kInvalidEntry && m_Entries[entry].id == id) ? entry : kInvalidEntry;
+        }
+
+        uint32_t CompiledManifest::FindString(const uint32_t* index, const std::string& key, bool virtualPath) const {
+            if (!m_Header || key.empty()) {
+                return kInvalidEntry;
+            }
+            uint32_t entry = Probe(index, HashPath(key.data(), key.size(), m_Header->seed));
+            if (entry == kInvalidEntry) {
+                return kInvalidEntry;
+            }
+
+            const CompiledManifestEntry& stored = m_Entries[entry];
+            uint32_t offset = virtualPath ? stored.virtualPathOffset : stored.pathOffset;
+            uint32_t length = virtualPath ? stored.virtualPathLength : stored.pathLength;
+            if (static_cast<uint64_t>(offset) + length > m_Header->stringsSize) {
+                return kInvalidEntry;
+            }
+            return PathEquals(m_Strings + offset, length, key.data(), key.size()) ? entry : kInvalidEntry;
+        }
+
+        uint32_t CompiledManifest::FindPath(const std::string& path) const {
+            return FindString(m_PathIndex, path, false);
+        }
+
+        uint32_t CompiledManifest::FindVirtualPath(const std::string& virtualPath) const {
+            return FindString(m_VirtualPathIndex, virtualPath, true);
+        }
+
+        bool CompiledManifest::Write(const std::string& filepath, std::vector<CompiledManifestResource> resources, ResourceID nextID) {
+            std::sort(resources.begin(), resources.end(), [](const CompiledManifestResource& a, const CompiledManifestResource& b) {
+                return a.id < b.id;
+            });
+
+            uint32_t entryCount = static_cast<uint32_t>(resources.size());
+            std::vector<CompiledManifestEntry> entries(entryCount);
+            std::string strings;
+            // The same normalized key twice would only be found after every seed failed; catch it here
+            std::unordered_map<std::string, ResourceID> pathOwners;
+            std::unordered_map<std::string, ResourceID> virtualPathOwners;
+            pathOwners.reserve(entryCount);
+            virtualPathOwners.reserve(entryCount);
+            for (uint32_t i = 0; i < entryCount; ++i) {
+                const CompiledManifestResource& resource = resources[i];
+                if (resource.id == InvalidResourceID || resource.path.empty() ||
+                    (i > 0 && resource.id == resources[i - 1].id)) {
+                    std::cerr << "CompiledManifest::Write: Invalid or duplicate resource ID " << resource.id << std::endl;
+                    return false;
+                }
+
+                auto pathOwner = pathOwners.emplace(NormalizedPath(resource.path), resource.id);
+                if (!pathOwner.second) {
+                    std::cerr << "CompiledManifest::Write: Resources " << pathOwner.first->second << " and " << resource.id
+                              << " share the path " << resource.path << std::endl;
+                    return false;
+                }
+                const std::string& virtualPath = resource.virtualPath.empty() ? resource.path : resource.virtualPath;
+                auto virtualPathOwner = virtualPathOwners.emplace(NormalizedPath(virtualPath), resource.id);
+                if (!virtualPathOwner.second) {
+                    std::cerr << "CompiledManifest::Write: Resources " << virtualPathOwner.first->second << " and " << resource.id
+                              << " share the virtual path " << virtualPath << std::endl;
+                    return false;
+                }
+
+                CompiledManifestEntry& entry = entries[i];
+                entry.id = resource.id;
+                entry.type = static_cast<uint32_t>(resource.type);
+                entry.pathOffset = static_cast<uint32_t>(strings.size());
+                entry.pathLength = static_cast<uint32_t>(resource.path.size());
+                strings += resource.path;
+                if (resource.virtualPath.empty() || resource.virtualPath == resource.path) {
+                    entry.virtualPathOffset = entry.pathOffset;
+                    entry.virtualPathLength = entry.pathLength;
+                } else {
+                    entry.virtualPathOffset = static_cast<uint32_t>(strings.size());
+                    entry.virtualPathLength = static_cast<uint32_t>(resource.virtualPath.size());
+                    strings += resource.virtualPath;
+                }
+                if (strings.size() > 0xFFFFFFFFull) {
+                    std::cerr << "CompiledManifest::Write: String pool exceeds 4 GiB" << std::endl;
+                    return false;
+                }
+                nextID = std::max(nextID, resource.id + 1);
+            }
+
+            CompiledManifestHeader header = {};
+            header.magic = CompiledManifestFormat::kMagic;
+            header.version = CompiledManifestFormat::kVersion;
+            header.entryCount = entryCount;
+            header.bucketCount = std::max<uint32_t>(1, (entryCount + CompiledManifestFormat::kKeysPerBucket - 1) /
+                                                       CompiledManifestFormat::kKeysPerBucket);
+            header.slotCount = std::max<uint32_t>(1, entryCount + entryCount / 4);
+            header.nextID = nextID;
+
+            // A seed fails only when two keys hash alike (the same key twice was rejected above)
+            std::vector<uint64_t> hashes(entryCount);
+            std::vector<uint32_t> idIndex;
+            std::vector<uint32_t> pathIndex;
+            std::vector<uint32_t> virtualPathIndex;
+            bool built = false;
+            for (uint64_t seed = 0; seed < kMaxSeeds && !built; ++seed) {
+                for (uint32_t i = 0; i < entryCount; ++i) {
+                    hashes[i] = HashID(entries[i].id, seed);
+                }
+                if (!BuildIndex(hashes, header.bucketCount, header.slotCount, idIndex)) {
+                    continue;
+                }
+                for (uint32_t i = 0; i < entryCount; ++i) {
+                    hashes[i] = HashPath(strings.data() + entries[i].pathOffset, entries[i].pathLength, seed);
+                }
+                if (!BuildIndex(hashes, header.bucketCount, header.slotCount, pathIndex)) {
+                    continue;
+                }
+                for (uint32_t i = 0; i < entryCount; ++i) {
+                    hashes[i] = HashPath(strings.data() + entries[i].virtualPathOffset, entries[i].virtualPathLength, seed);
+                }
+                if (!BuildIndex(hashes, header.bucketCount, header.slotCount, virtualPathIndex)) {
+                    continue;
+                }
+                header.seed = seed;
+                built = true;
+            }
+            if (!built) {
+                std::cerr << "CompiledManifest::Write: No hash seed places every key" << std::endl;
+                return false;
+            }
+
+            uint64_t indexSize = idIndex.size() * sizeof(uint32_t);
+            header.entriesOffset = sizeof(CompiledManifestHeader);
+            header.idIndexOffset = header.entriesOffset + static_cast<uint64_t>(entryCount) * sizeof(CompiledManifestEntry);
+            header.pathIndexOffset = header.idIndexOffset + indexSize;
+            header.virtualPathIndexOffset = header.pathIndexOffset + indexSize;
+            header.stringsOffset = header.virtualPathIndexOffset + indexSize;
+            header.stringsSize = strings.size();
+            header.fileSize = header.stringsOffset + header.stringsSize;
+
+            // Written to a temp file and renamed: a crash mid-write must not leave a file newer than the JSON
+            // manifest, which LoadManifest would prefer
+            std::string tempPath = filepath + ".tmp";
+            std::error_code error;
+            {
+                std::ofstream file(tempPath, std::ios::binary | std::ios::trunc);
+                if (!file) {
+                    std::cerr << "CompiledManifest::Write: Failed to open " << tempPath << " for writing" << std::endl;
+                    return false;
+                }
+                file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+                file.write(reinterpret_cast<const char*>(entries.data()),
+                           static_cast<std::streamsize>(entries.size() * sizeof(CompiledManifestEntry)));
+                file.write(reinterpret_cast<const char*>(idIndex.data()), static_cast<std::streamsize>(indexSize));
+                file.write(reinterpret_cast<const char*>(pathIndex.data()), static_cast<std::streamsize>(indexSize));
+                file.write(reinterpret_cast<const char*>(virtualPathIndex.data()), static_cast<std::streamsize>(indexSize));
+                file.write(strings.data(), static_cast<std::streamsize>(strings.size()));
+                file.close();
+                if (!file) {
+                    std::cerr << "CompiledManifest::Write: Failed to write " << tempPath << std::endl;
+                    fs::remove(tempPath, error);
+                    return false;
+                }
+            }
+
+            fs::rename(tempPath, filepath, error);
+            if (error) {
+                std::cerr << "CompiledManifest::Write: Failed to replace " << filepath << " (" << error.message() << ")" << std::endl;
+                fs::remove(tempPath, error);
+                return false;
+            }
+            return true;
+        }
+
+    } // namespace Resources
+} // namespace FirstEngine
@@ -60,6 +60,32 @@ namespace FirstEngine {
             return result;
         }
 
+        ImageData ImageLoader::LoadFromMemory(const uint8_t* data, size_t size, const std::string& sourceName) {
+            ImageData result{};
+            result.width = 0;
+            result.height = 0;
+            result.channels = 0;
+            result.hasAlpha = false;
+
+            int width, height, channels;
+            unsigned char* pixels = stbi_load_from_memory(data, static_cast<int>(size), &width, &height, &channels, 0);
+            if (!pixels) {
+                const char* failureReason = stbi_failure_reason();
+                std::cerr << "ImageLoader::LoadFromMemory: Failed to load image: " << sourceName << " - "
+                          << (failureReason ? failureReason : "Unknown error") << std::endl;
+                return result;
+            }
+
+            result.width = static_cast<uint32_t>(width);
+            result.height = static_cast<uint32_t>(height);
+            result.channels = static_cast<uint32_t>(channels);
+            result.hasAlpha = (channels == 4);
+            result.data.assign(pixels, pixels + static_cast<size_t>(width) * height * channels);
+            stbi_image_free(pixels);
+
+            return result;
+        }
+
         ImageFormat ImageLoader::DetectFormat(const std::string& filepath) {
             std::ifstream file(filepath, std::ios::binary);
             if (!file.is_open()) {
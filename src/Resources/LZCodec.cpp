@@ -0,0 +1,193 @@
+#include "FirstEngine/Resources/LZCodec.h"
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
+namespace FirstEngine {
+    namespace Resources {
+
+        namespace {
+            // Block format: sequences of [token][literal length+][literals][offset:16][match length+]
+            // token = literal length (high nibble) | match length - 4 (low nibble), 15 = more bytes follow.
+            // The last sequence is literals only.
+            constexpr size_t kMinMatch = 4;
+            constexpr size_t kLastLiterals = 5;         // A block always ends with at least this many literals
+            constexpr size_t kMatchStartLimit = 12;     // No match starts in the last 12 bytes
+            constexpr size_t kMaxOffset = 65535;
+            constexpr uint32_t kHashBits = 16;
+            constexpr uint32_t kSkipShift = 6;          // Probe less often the longer nothing matches
+
+            uint32_t Read32(const uint8_t* p) {
+                uint32_t value;
+                std::memcpy(&value, p, sizeof(value));
+                return value;
+            }
+
+            uint32_t Hash(uint32_t sequence) {
+                return (sequence * 2654435761u) >> (32 - kHashBits);
+            }
+
+            uint8_t* WriteLength(uint8_t* out, size_t length) {
+                while (length >= 255) {
+                    *out++ = 255;
+                    length -= 255;
+                }
+                *out++ = static_cast<uint8_t>(length);
+                return out;
+            }
+
+            uint8_t* WriteLiterals(uint8_t* out, uint8_t token, const uint8_t* literals, size_t literalLength) {
+                *out++ = static_cast<uint8_t>((std::min<size_t>(literalLength, 15) << 4) | token);
+                if (literalLength >= 15) {
+                    out = WriteLength(out, literalLength - 15);
+                }
+                if (literalLength > 0) {
+                    std::memcpy(out, literals, literalLength);
+                }
+                return out + literalLength;
+            }
+        }
+
+        size_t LZCodec::GetMaxCompressedSize(size_t sourceSize) {
+            return sourceSize + sourceSize / 255 + 16;
+        }
+
+        size_t LZCodec::Compress(const uint8_t* source, size_t sourceSize, uint8_t* dst, size_t dstCapacity) {
+            if (dstCapacity < GetMaxCompressedSize(sourceSize)) {
+                return 0;
+            }
+
+            uint8_t* out = dst;
+            const uint8_t* anchor = source;
+            const uint8_t* end = source + sourceSize;
+
+            if (sourceSize > kMatchStartLimit) {
+                // Last position seen for each hashed 4-byte sequence
+                std::vector<uint32_t> table(size_t(1) << kHashBits, 0);
+                const uint8_t* matchStartLimit = end - kMatchStartLimit;
+                const uint8_t* matchEndLimit = end - kLastLiterals;
+
+                const uint8_t* ip = source;
+                uint32_t misses = 0;
+                while (ip < matchStartLimit) {
+                    uint32_t sequence = Read32(ip);
+                    uint32_t& slot = table[Hash(sequence)];
+                    const uint8_t* candidate = source + slot;
+                    slot = static_cast<uint32_t>(ip - source);
+
+                    if (candidate >= ip || static_cast<size_t>(ip - candidate) > kMaxOffset || Read32(candidate) != sequence) {
+                        ip += 1 + (misses++ >> kSkipShift);
+                        continue;
+                    }
+                    misses = 0;
+
+                    // Grow the match backwards into pending literals, then forwards
+                    while (ip > anchor && candidate > source && ip[-1] == candidate[-1]) {
+                        --ip;
+                        --candidate;
+                    }
+                    const uint8_t* matchEnd = ip + kMinMatch;
+                    const uint8_t* reference = candidate + kMinMatch;
+                    while (matchEnd < matchEndLimit && *matchEnd == *reference) {
+                        ++matchEnd;
+                        ++reference;
+                    }
+
+                    size_t matchLength = static_cast<size_t>(matchEnd - ip) - kMinMatch;
+                    size_t offset = static_cast<size_t>(ip - candidate);
+                    out = WriteLiterals(out, static_cast<uint8_t>(std::min<size_t>(matchLength, 15)),
+                                        anchor, static_cast<size_t>(ip - anchor));
+                    *out++ = static_cast<uint8_t>(offset & 0xFF);
+                    *out++ = static_cast<uint8_t>(offset >> 8);
+                    if (matchLength >= 15) {
+                        out = WriteLength(out, matchLength - 15);
+                    }
+
+                    ip = matchEnd;
+                    anchor = ip;
+                    // Index a position inside the match so repeats of its tail are found
+                    if (ip < matchStartLimit) {
+                        table[Hash(Read32(ip - 2))] = static_cast<uint32_t>(ip - 2 - source);
+                    }
+                }
+            }
+
+            out = WriteLiterals(out, 0, anchor, static_cast<size_t>(end - anchor));
+            return static_cast<size_t>(out - dst);
+        }
+
+        bool LZCodec::Decompress(const uint8_t* source, size_t sourceSize, uint8_t* dst, size_t dstSize) {
+            const uint8_t* ip = source;
+            const uint8_t* ipEnd = source + sourceSize;
+            uint8_t* op = dst;
+            uint8_t* opEnd = dst + dstSize;
+
+            auto readLength = [&ip, ipEnd](size_t& length) {
+                uint8_t byte;
+                do {
+                    if (ip >= ipEnd) {
+                        return false;
+                    }
+                    byte = *ip++;
+                    length += byte;
+                } while (byte == 255);
+                return true;
+            };
+
+            while (ip < ipEnd) {
+                uint8_t token = *ip++;
+
+                size_t literalLength = token >> 4;
+                if (literalLength == 15 && !readLength(literalLength)) {
+                    return false;
+                }
+                if (literalLength > static_cast<size_t>(ipEnd - ip) || literalLength > static_cast<size_t>(opEnd - op)) {
+                    return false;
+                }
+                if (literalLength > 0) {
+                    std::memcpy(op, ip, literalLength);
+                }
+                op += literalLength;
+                ip += literalLength;
+                if (ip == ipEnd) {
+                    break;    // Last sequence
+                }
+
+                if (ipEnd - ip < 2) {
+                    return false;
+                }
+                size_t offset = static_cast<size_t>(ip[0]) | (static_cast<size_t>(ip[1]) << 8);
+                ip += 2;
+                if (offset == 0 || offset > static_cast<size_t>(op - dst)) {
+                    return false;
+                }
+
+                size_t matchLength = token & 15;
+                if (matchLength == 15 && !readLength(matchLength)) {
+                    return false;
+                }
+                matchLength += kMinMatch;
+                if (matchLength > static_cast<size_t>(opEnd - op)) {
+                    return false;
+                }
+
+                const uint8_t* match = op - offset;
+                if (offset >= matchLength) {
+                    std::memcpy(op, match, matchLength);
+                } else {
+                    // Overlapping match repeats the last 'offset' bytes: copy whole periods, doubling each time
+                    size_t copied = 0;
+                    while (copied < matchLength) {
+                        size_t count = std::min(copied + offset, matchLength - copied);
+                        std::memcpy(op + copied, match, count);
+                        copied += count;
+                    }
+                }
+                op += matchLength;
+            }
+
+            return op == opEnd;
+        }
+
+    } // namespace Resources
+} // namespace FirstEngine
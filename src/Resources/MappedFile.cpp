@@ -0,0 +1,153 @@
+#include "FirstEngine/Resources/MappedFile.h"
+#include <iostream>
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace FirstEngine {
+    namespace Resources {
+
+        MappedFile::~MappedFile() {
+            Close();
+        }
+
+        bool MappedFile::OpenView(std::shared_ptr<const MappedFile> source, uint64_t offset, uint64_t size) {
+            Close();
+
+            if (!source || !source->IsOpen() || offset > source->GetSize() || size > source->GetSize() - offset || size == 0) {
+                std::cerr << "MappedFile::OpenView: Range is outside the source mapping" << std::endl;
+                return false;
+            }
+
+            m_Data = source->GetData() + offset;
+            m_Size = size;
+            m_Source = std::move(source);
+            return true;
+        }
+
+        bool MappedFile::OpenBuffer(std::vector<uint8_t> bytes) {
+            Close();
+
+            if (bytes.empty()) {
+                return false;
+            }
+
+            m_Buffer = std::move(bytes);
+            m_Data = m_Buffer.data();
+            m_Size = m_Buffer.size();
+            return true;
+        }
+
+#ifdef _WIN32
+        bool MappedFile::Open(const std::string& filepath) {
+            Close();
+
+            HANDLE file = CreateFileA(filepath.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+                                      FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+            if (file == INVALID_HANDLE_VALUE) {
+                std::cerr << "MappedFile::Open: Failed to open " << filepath << std::endl;
+                return false;
+            }
+
+            LARGE_INTEGER size;
+            if (!GetFileSizeEx(file, &size) || size.QuadPart == 0) {
+                std::cerr << "MappedFile::Open: Empty or unreadable file " << filepath << std::endl;
+                CloseHandle(file);
+                return false;
+            }
+
+            HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+            if (!mapping) {
+                std::cerr << "MappedFile::Open: Failed to create mapping for " << filepath << std::endl;
+                CloseHandle(file);
+                return false;
+            }
+
+            void* data = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+            if (!data) {
+                std::cerr << "MappedFile::Open: Failed to map " << filepath << std::endl;
+                CloseHandle(mapping);
+                CloseHandle(file);
+                return false;
+            }
+
+            m_File = file;
+            m_Mapping = mapping;
+            m_Data = static_cast<const uint8_t*>(data);
+            m_Size = static_cast<uint64_t>(size.QuadPart);
+            m_Mapped = true;
+            return true;
+        }
+
+        void MappedFile::Close() {
+            if (m_Mapped) {
+                UnmapViewOfFile(m_Data);
+            }
+            if (m_Mapping) {
+                CloseHandle(static_cast<HANDLE>(m_Mapping));
+            }
+            if (m_File) {
+                CloseHandle(static_cast<HANDLE>(m_File));
+            }
+            m_Data = nullptr;
+            m_Size = 0;
+            m_Mapped = false;
+            m_Source.reset();
+            m_Buffer.clear();
+            m_Buffer.shrink_to_fit();
+            m_Mapping = nullptr;
+            m_File = nullptr;
+        }
+#else
+        bool MappedFile::Open(const std::string& filepath) {
+            Close();
+
+            int fd = open(filepath.c_str(), O_RDONLY);
+            if (fd < 0) {
+                std::cerr << "MappedFile::Open: Failed to open " << filepath << std::endl;
+                return false;
+            }
+
+            struct stat info;
+            if (fstat(fd, &info) != 0 || info.st_size == 0) {
+                std::cerr << "MappedFile::Open: Empty or unreadable file " << filepath << std::endl;
+                close(fd);
+                return false;
+            }
+
+            void* data = mmap(nullptr, static_cast<size_t>(info.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+            // The mapping keeps its own reference to the file
+            close(fd);
+            if (data == MAP_FAILED) {
+                std::cerr << "MappedFile::Open: Failed to map " << filepath << std::endl;
+                return false;
+            }
+
+            m_Data = static_cast<const uint8_t*>(data);
+            m_Size = static_cast<uint64_t>(info.st_size);
+            m_Mapped = true;
+            return true;
+        }
+
+        void MappedFile::Close() {
+            if (m_Mapped) {
+                munmap(const_cast<uint8_t*>(m_Data), static_cast<size_t>(m_Size));
+            }
+            m_Data = nullptr;
+            m_Size = 0;
+            m_Mapped = false;
+            m_Source.reset();
+            m_Buffer.clear();
+            m_Buffer.shrink_to_fit();
+        }
+#endif
+
+    } // namespace Resources
+} // namespace FirstEngine
@@ -44,9 +44,9 @@ namespace FirstEngine {
                 xmlFilePath = fs::path(xmlFilePath).replace_extension(".xml").string();
             }
 
-            // Parse XML file
+            // Parse XML file (from the package archive if one is mounted)
             ResourceXMLParser parser;
-            if (!parser.ParseFromFile(xmlFilePath)) {
+            if (!resourceManager.ParseDescriptor(xmlFilePath, parser)) {
                 return result;
             }
 
@@ -65,6 +65,7 @@ namespace FirstEngine {
 
             // Set Handle data (only current resource data, not dependencies)
             result.shaderName = materialData.shaderName;
+            result.keywords = materialData.keywords;
             result.parameters = materialData.parameters;
 
             // Convert textureSlots to dependencies (texture slots are stored in Textures node)
@@ -89,9 +90,11 @@ namespace FirstEngine {
                                   const std::string& shaderName,
                                   const std::unordered_map<std::string, MaterialParameterValue>& parameters,
                                   const std::unordered_map<std::string, ResourceID>& textureSlots,
-                                  const std::vector<ResourceDependency>& dependencies) {
+                                  const std::vector<ResourceDependency>& dependencies,
+                                  const std::vector<std::string>& keywords) {
             ResourceXMLParser::MaterialData materialData;
             materialData.shaderName = shaderName;
+            materialData.keywords = keywords;
             materialData.parameters = parameters;
             
             // Convert texture slots map to vector
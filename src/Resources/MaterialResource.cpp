@@ -2,6 +2,7 @@
 #include "FirstEngine/Renderer/ShadingMaterial.h"
 #include "FirstEngine/Renderer/ShaderCollectionsTools.h"
 #include "FirstEngine/Renderer/ShaderCollection.h"
+#include "FirstEngine/Renderer/RenderTexture.h"
 #include "FirstEngine/Resources/ResourceTypes.h"
 #include "FirstEngine/Resources/ResourceProvider.h"
 #include "FirstEngine/Resources/ResourceDependency.h"
@@ -73,6 +74,7 @@ namespace FirstEngine {
 
             // Use returned Handle data to initialize resource
             m_ShaderName = loadResult.shaderName;
+            m_ShaderKeywords = loadResult.keywords;
             m_Parameters = loadResult.parameters;
             m_ParameterDataDirty = true;
 
@@ -94,6 +96,18 @@ namespace FirstEngine {
                 if (collection) {
                     m_ShaderCollectionID = collection->GetID();
                     m_ShaderCollection = collection;
+
+                    // Select the permutation for this material's keywords (precompiled if listed in the package manifest)
+                    if (!m_ShaderKeywords.empty()) {
+                        uint64_t variantID = collectionsTools.GetOrCreateVariant(
+                            m_ShaderCollectionID, Shader::ShaderKeywordSet(m_ShaderKeywords));
+                        if (variantID != 0) {
+                            SetShaderCollectionID(variantID);
+                        } else {
+                            std::cerr << "MaterialResource: Failed to get shader variant for " << m_ShaderName
+                                      << ", using base shader" << std::endl;
+                        }
+                    }
                 }
             }
             
@@ -372,20 +386,16 @@ namespace FirstEngine {
                 // Ensure texture GPU resource is created
                 textureResource->CreateRenderTexture();
                 
-                // Get GPU texture data
-                TextureResource::RenderData textureData;
-                if (!textureResource->GetRenderData(textureData)) {
-                    continue;
-                }
-                
-                if (!textureData.image) {
+                // Bind the RenderTexture rather than its image: it may still be uploading, and streaming swaps
+                // its image when the mip residency changes (the material follows in RefreshTextureBindings)
+                auto* gpuTexture = static_cast<Renderer::RenderTexture*>(textureResource->GetRenderTexture());
+                if (!gpuTexture) {
                     continue;
                 }
                 
                 // Find texture binding in shader by slot name
                 // Search through shader reflection to find matching texture binding
                 const auto& reflection = shadingMaterial->GetShaderReflection();
-                RHI::IImage* gpuTexture = static_cast<RHI::IImage*>(textureData.image);
                 
                 bool textureSet = false;
                 
@@ -408,7 +418,7 @@ namespace FirstEngine {
                 // These use SAMPLED_IMAGE descriptor type
                 for (const auto& image : reflection.separate_images) {
                     if (matchTextureName(slotName, image.name)) {
-                        shadingMaterial->SetTexture(image.set, image.binding, gpuTexture);
+                        shadingMaterial->BindRenderTexture(image.set, image.binding, gpuTexture);
                         textureSet = true;
                         break;
                     }
@@ -419,7 +429,7 @@ namespace FirstEngine {
                 if (!textureSet) {
                     for (const auto& sampler : reflection.sampled_images) {
                         if (matchTextureName(slotName, sampler.name)) {
-                            shadingMaterial->SetTexture(sampler.set, sampler.binding, gpuTexture);
+                            shadingMaterial->BindRenderTexture(sampler.set, sampler.binding, gpuTexture);
                             textureSet = true;
                             break;
                         }
@@ -430,7 +440,7 @@ namespace FirstEngine {
                 if (!textureSet) {
                     for (const auto& image : reflection.images) {
                         if (matchTextureName(slotName, image.name)) {
-                            shadingMaterial->SetTexture(image.set, image.binding, gpuTexture);
+                            shadingMaterial->BindRenderTexture(image.set, image.binding, gpuTexture);
                             textureSet = true;
                             break;
                         }
@@ -441,7 +451,7 @@ namespace FirstEngine {
                 if (!textureSet) {
                     for (const auto& sampler : reflection.samplers) {
                         if (matchTextureName(slotName, sampler.name)) {
-                            shadingMaterial->SetTexture(sampler.set, sampler.binding, gpuTexture);
+                            shadingMaterial->BindRenderTexture(sampler.set, sampler.binding, gpuTexture);
                             textureSet = true;
                             break;
                         }
@@ -3,12 +3,17 @@
 #include "FirstEngine/Resources/ModelLoader.h" // For Bone struct
 #include "FirstEngine/Resources/ResourceProvider.h"
 #include "FirstEngine/Resources/VertexFormat.h"
+#include "FirstEngine/Resources/CookedMeshFormat.h"
+#include "FirstEngine/Resources/MeshOptimizer.h"
+#include "FirstEngine/Resources/MeshSimplifier.h"
+#include "FirstEngine/Resources/VertexQuantizer.h"
 #include <assimp/Importer.hpp>
 #include <assimp/scene.h>
 #include <assimp/postprocess.h>
 #include <glm/glm.hpp>
 #include <fstream>
 #include <iostream>
+#include <iomanip>
 #include <cstring>
 #if __has_include(<filesystem>)
 #include <filesystem>
@@ -23,6 +28,42 @@ namespace fs = std::experimental::filesystem;
 namespace FirstEngine {
     namespace Resources {
 
+        namespace {
+            uint64_t AlignUp(uint64_t value) {
+                return (value + CookedMesh::kAlignment - 1) & ~(CookedMesh::kAlignment - 1);
+            }
+
+            void ComputeBounds(MeshLoader::LoadResult& mesh) {
+                const VertexAttribute* position = mesh.vertexFormat.GetAttribute(VertexAttributeType::Position);
+                const uint8_t* vertexData = mesh.GetVertexData();
+                if (!position || !vertexData || mesh.vertexCount == 0) {
+                    return;
+                }
+
+                uint32_t stride = mesh.vertexFormat.GetStride();
+                glm::vec3 value;
+                std::memcpy(&value, vertexData + position->offset, sizeof(glm::vec3));
+                mesh.boundsMin = value;
+                mesh.boundsMax = value;
+                for (uint32_t i = 1; i < mesh.vertexCount; ++i) {
+                    std::memcpy(&value, vertexData + i * stride + position->offset, sizeof(glm::vec3));
+                    mesh.boundsMin = glm::min(mesh.boundsMin, value);
+                    mesh.boundsMax = glm::max(mesh.boundsMax, value);
+                }
+            }
+
+            // Branch-free max, so the loop vectorizes; the cost stays small next to the upload
+            template <typename Index>
+            bool IndicesInRange(const uint8_t* data, uint32_t indexCount, uint32_t vertexCount) {
+                const auto* indices = reinterpret_cast<const Index*>(data);
+                uint32_t maxIndex = 0;
+                for (uint32_t i = 0; i < indexCount; ++i) {
+                    maxIndex = std::max<uint32_t>(maxIndex, indices[i]);
+                }
+                return indexCount == 0 || maxIndex < vertexCount;
+            }
+        }
+
         MeshLoader::LoadResult MeshLoader::Load(ResourceID id) {
             LoadResult result;
             result.success = false;
@@ -51,9 +92,9 @@ namespace FirstEngine {
                 xmlFilePath = fs::path(xmlFilePath).replace_extension(".xml").string();
             }
 
-            // Parse XML file
+            // Parse XML file (from the package archive if one is mounted)
             ResourceXMLParser parser;
-            if (!parser.ParseFromFile(xmlFilePath)) {
+            if (!resourceManager.ParseDescriptor(xmlFilePath, parser)) {
                 return result;
             }
 
@@ -70,222 +111,554 @@ namespace FirstEngine {
                 return result;
             }
 
-            // Load actual mesh geometry data from source file (fbx, obj, etc.)
-            if (!meshData.meshFile.empty()) {
-                // Store source mesh file path (relative path from XML)
-                result.meshFile = meshData.meshFile;
-                
-                // Resolve mesh file path relative to XML file directory
-                std::string xmlDir = fs::path(xmlFilePath).parent_path().string();
-                std::string meshPath = meshData.meshFile;
-                
-                if (!fs::path(meshPath).is_absolute()) {
-                    meshPath = (fs::path(xmlDir) / meshPath).string();
+            // Resolve cooked/source file paths relative to XML file directory
+            std::string xmlDir = fs::path(xmlFilePath).parent_path().string();
+            auto resolveRelative = [&xmlDir](const std::string& path) {
+                return fs::path(path).is_absolute() ? path : (fs::path(xmlDir) / path).string();
+            };
+
+            // Store source and cooked file paths (relative paths from XML, for saving)
+            result.meshFile = meshData.meshFile;
+            result.cookedFile = meshData.cookedFile;
+
+            if (!meshData.cookedFile.empty()) {
+                // Cooked mesh: map the file, geometry is used in place
+                if (!ReadCooked(resolveRelative(meshData.cookedFile), result)) {
+                    return result;
                 }
+            } else if (!meshData.meshFile.empty()) {
+                // Package imported before meshes were cooked: fall back to importing the source file
+                std::cerr << "MeshLoader::Load: Mesh ID " << id << " has no cooked .femesh, importing "
+                          << meshData.meshFile << " with Assimp (re-import it with ResourceImport to cook it)" << std::endl;
+                if (!ImportFromSource(resolveRelative(meshData.meshFile), result)) {
+                    return result;
+                }
+            } else {
+                // No mesh file specified, return empty result
+                return result;
+            }
 
-                // Load mesh data directly using Assimp (not through ModelLoader)
-                // MeshLoader loads a single mesh from the file
-                Assimp::Importer importer;
-                const aiScene* scene = importer.ReadFile(
-                    meshPath,
-                    aiProcess_Triangulate |
-                    aiProcess_GenSmoothNormals |
-                    aiProcess_FlipUVs |
-                    aiProcess_CalcTangentSpace
-                );
-
-                if (!scene || scene->mFlags & AI_SCENE_FLAGS_INCOMPLETE || !scene->mRootNode) {
-                    return result; // Failed to load mesh file
+            result.metadata.isLoaded = true;
+            result.success = true;
+            return result;
+        }
+
+        bool MeshLoader::Cook(const std::string& sourcePath, const std::string& cookedPath, const MeshCookOptions& options) {
+            LoadResult mesh;
+            if (!ImportFromSource(sourcePath, mesh)) {
+                return false;
+            }
+
+            MeshOptimizer::Options optimizerOptions;
+            if (options.optimize) {
+                MeshOptimizer::Report report;
+                if (!MeshOptimizer::Optimize(mesh, optimizerOptions, &report)) {
+                    std::cerr << "MeshLoader::Cook: Failed to optimize " << sourcePath << std::endl;
+                    return false;
                 }
 
-                // Load the first mesh from the file (Mesh resource contains a single mesh)
-                if (scene->mNumMeshes > 0) {
-                    aiMesh* aiMesh = scene->mMeshes[0];
-
-                    // Detect available vertex attributes from mesh file
-                    bool hasNormals = (aiMesh->mNormals != nullptr);
-                    bool hasTexCoords0 = (aiMesh->mTextureCoords[0] != nullptr);
-                    bool hasTexCoords1 = (aiMesh->mTextureCoords[1] != nullptr);
-                    bool hasTangents = (aiMesh->mTangents != nullptr);
-                    bool hasColors0 = (aiMesh->mColors[0] != nullptr);
-
-                    // Create vertex format based on available data
-                    result.vertexFormat = VertexFormat::CreateFromMeshData(
-                        hasNormals, hasTexCoords0, hasTexCoords1, hasTangents, hasColors0);
-
-                    result.vertexCount = aiMesh->mNumVertices;
-                    uint32_t vertexStride = result.vertexFormat.GetStride();
-                    result.vertexData.resize(result.vertexCount * vertexStride);
-
-                    // Load vertices into flexible format
-                    for (unsigned int j = 0; j < aiMesh->mNumVertices; j++) {
-                        uint8_t* vertexPtr = result.vertexData.data() + (j * vertexStride);
-
-                        // Write attributes based on format
-                        const auto& attributes = result.vertexFormat.GetAttributes();
-                        for (const auto& attr : attributes) {
-                            uint8_t* attrPtr = vertexPtr + attr.offset;
-                            
-                            switch (attr.type) {
-                                case VertexAttributeType::Position: {
-                                    glm::vec3 pos(
-                                        aiMesh->mVertices[j].x,
-                                        aiMesh->mVertices[j].y,
-                                        aiMesh->mVertices[j].z
+                auto print = [](const char* label, const MeshOptimizer::Statistics& stats) {
+                    std::cout << "  " << label << ": " << stats.vertexCount << " vertices, " << stats.triangleCount
+                              << " triangles, ACMR " << std::fixed << std::setprecision(3) << stats.acmr
+                              << ", ATVR " << stats.atvr << std::defaultfloat << std::endl;
+                };
+                std::cout << "MeshLoader::Cook: " << fs::path(sourcePath).filename().string() << " (FIFO cache "
+                          << MeshOptimizer::kStatisticsCacheSize << ")" << std::endl;
+                print("Before", report.before);
+                print("After ", report.after);
+            }
+
+            // LODs share the optimized vertex buffer, each level adds an index range
+            if (options.lodLevels > 0) {
+                if (!MeshSimplifier::GenerateLods(mesh, options.lodLevels, options.lodRatio, options.lodMaxError)) {
+                    std::cerr << "MeshLoader::Cook: Failed to generate LODs for " << sourcePath << std::endl;
+                    return false;
+                }
+                for (size_t i = 1; i < mesh.lods.size(); ++i) {
+                    std::cout << "  LOD " << i << ": " << mesh.lods[i].indexCount / 3 << " triangles, error "
+                              << mesh.lods[i].error << std::endl;
+                }
+            }
+
+            // Quantize last: the optimizer, the simplifier and the bounds work on float positions
+            if (options.quantize) {
+                VertexFormat quantized = VertexQuantizer::ChooseFormat(mesh.vertexFormat, mesh.vertexData.data(),
+                                                                       mesh.vertexCount, options.quantization);
+                std::vector<uint8_t> quantizedData;
+                if (!VertexQuantizer::Encode(mesh.vertexFormat, mesh.vertexData.data(), mesh.vertexCount, quantized,
+                                             mesh.boundsMin, mesh.boundsMax, quantizedData)) {
+                    std::cerr << "MeshLoader::Cook: Failed to quantize " << sourcePath << std::endl;
+                    return false;
+                }
+                std::cout << "  Vertex: " << mesh.vertexFormat.GetStride() << " -> " << quantized.GetStride()
+                          << " bytes " << quantized.ToString() << std::endl;
+                mesh.vertexFormat = quantized;
+                mesh.vertexData = std::move(quantizedData);
+            }
+
+            return WriteCooked(cookedPath, mesh, options.optimize && optimizerOptions.allow16BitIndices);
+        }
+
+        bool MeshLoader::ImportFromSource(const std::string& sourcePath, LoadResult& result) {
+            Assimp::Importer importer;
+            const aiScene* scene = importer.ReadFile(
+                sourcePath,
+                aiProcess_Triangulate |
+                aiProcess_GenSmoothNormals |
+                aiProcess_FlipUVs |
+                aiProcess_CalcTangentSpace
+            );
+
+            if (!scene || scene->mFlags & AI_SCENE_FLAGS_INCOMPLETE || !scene->mRootNode) {
+                std::cerr << "MeshLoader::ImportFromSource: Failed to import " << sourcePath << ": "
+                          << importer.GetErrorString() << std::endl;
+                return false;
+            }
+
+            // Load the first mesh from the file (Mesh resource contains a single mesh)
+            if (scene->mNumMeshes == 0) {
+                std::cerr << "MeshLoader::ImportFromSource: No meshes in " << sourcePath << std::endl;
+                return false;
+            }
+
+            aiMesh* aiMesh = scene->mMeshes[0];
+
+            // Detect available vertex attributes from mesh file
+            bool hasNormals = (aiMesh->mNormals != nullptr);
+            bool hasTexCoords0 = (aiMesh->mTextureCoords[0] != nullptr);
+            bool hasTexCoords1 = (aiMesh->mTextureCoords[1] != nullptr);
+            bool hasTangents = (aiMesh->mTangents != nullptr);
+            bool hasColors0 = (aiMesh->mColors[0] != nullptr);
+
+            // Create vertex format based on available data
+            result.vertexFormat = VertexFormat::CreateFromMeshData(
+                hasNormals, hasTexCoords0, hasTexCoords1, hasTangents, hasColors0);
+
+            result.vertexCount = aiMesh->mNumVertices;
+            uint32_t vertexStride = result.vertexFormat.GetStride();
+            result.vertexData.resize(result.vertexCount * vertexStride);
+
+            // Load vertices into flexible format
+            for (unsigned int j = 0; j < aiMesh->mNumVertices; j++) {
+                uint8_t* vertexPtr = result.vertexData.data() + (j * vertexStride);
+
+                // Write attributes based on format
+                const auto& attributes = result.vertexFormat.GetAttributes();
+                for (const auto& attr : attributes) {
+                    uint8_t* attrPtr = vertexPtr + attr.offset;
+                    
+                    switch (attr.type) {
+                        case VertexAttributeType::Position: {
+                            glm::vec3 pos(
+                                aiMesh->mVertices[j].x,
+                                aiMesh->mVertices[j].y,
+                                aiMesh->mVertices[j].z
+                            );
+                            std::memcpy(attrPtr, &pos, sizeof(glm::vec3));
+                            break;
+                        }
+                        case VertexAttributeType::Normal: {
+                            glm::vec3 normal;
+                            if (aiMesh->mNormals) {
+                                normal = glm::vec3(
+                                    aiMesh->mNormals[j].x,
+                                    aiMesh->mNormals[j].y,
+                                    aiMesh->mNormals[j].z
+                                );
+                            } else {
+                                normal = glm::vec3(0.0f, 1.0f, 0.0f); // Default
+                            }
+                            std::memcpy(attrPtr, &normal, sizeof(glm::vec3));
+                            break;
+                        }
+                        case VertexAttributeType::TexCoord0: {
+                            glm::vec2 texCoord;
+                            if (aiMesh->mTextureCoords[0]) {
+                                texCoord = glm::vec2(
+                                    aiMesh->mTextureCoords[0][j].x,
+                                    aiMesh->mTextureCoords[0][j].y
+                                );
+                            } else {
+                                texCoord = glm::vec2(0.0f, 0.0f); // Default
+                            }
+                            std::memcpy(attrPtr, &texCoord, sizeof(glm::vec2));
+                            break;
+                        }
+                        case VertexAttributeType::TexCoord1: {
+                            glm::vec2 texCoord;
+                            if (aiMesh->mTextureCoords[1]) {
+                                texCoord = glm::vec2(
+                                    aiMesh->mTextureCoords[1][j].x,
+                                    aiMesh->mTextureCoords[1][j].y
+                                );
+                            } else {
+                                texCoord = glm::vec2(0.0f, 0.0f); // Default
+                            }
+                            std::memcpy(attrPtr, &texCoord, sizeof(glm::vec2));
+                            break;
+                        }
+                        case VertexAttributeType::Tangent: {
+                            glm::vec4 tangent;
+                            if (aiMesh->mTangents) {
+                                tangent = glm::vec4(
+                                    aiMesh->mTangents[j].x,
+                                    aiMesh->mTangents[j].y,
+                                    aiMesh->mTangents[j].z,
+                                    1.0f  // Default handedness
+                                );
+                                
+                                // Use bitangent to determine handedness if available
+                                if (aiMesh->mBitangents) {
+                                    glm::vec3 normal = aiMesh->mNormals ? 
+                                        glm::vec3(aiMesh->mNormals[j].x, aiMesh->mNormals[j].y, aiMesh->mNormals[j].z) :
+                                        glm::vec3(0.0f, 1.0f, 0.0f);
+                                    glm::vec3 tan = glm::vec3(tangent);
+                                    glm::vec3 bitangent = glm::vec3(
+                                        aiMesh->mBitangents[j].x,
+                                        aiMesh->mBitangents[j].y,
+                                        aiMesh->mBitangents[j].z
                                     );
-                                    std::memcpy(attrPtr, &pos, sizeof(glm::vec3));
-                                    break;
-                                }
-                                case VertexAttributeType::Normal: {
-                                    glm::vec3 normal;
-                                    if (aiMesh->mNormals) {
-                                        normal = glm::vec3(
-                                            aiMesh->mNormals[j].x,
-                                            aiMesh->mNormals[j].y,
-                                            aiMesh->mNormals[j].z
-                                        );
-                                    } else {
-                                        normal = glm::vec3(0.0f, 1.0f, 0.0f); // Default
-                                    }
-                                    std::memcpy(attrPtr, &normal, sizeof(glm::vec3));
-                                    break;
-                                }
-                                case VertexAttributeType::TexCoord0: {
-                                    glm::vec2 texCoord;
-                                    if (aiMesh->mTextureCoords[0]) {
-                                        texCoord = glm::vec2(
-                                            aiMesh->mTextureCoords[0][j].x,
-                                            aiMesh->mTextureCoords[0][j].y
-                                        );
-                                    } else {
-                                        texCoord = glm::vec2(0.0f, 0.0f); // Default
-                                    }
-                                    std::memcpy(attrPtr, &texCoord, sizeof(glm::vec2));
-                                    break;
+                                    
+                                    glm::vec3 calculatedBitangent = glm::cross(normal, tan);
+                                    float handedness = (glm::dot(calculatedBitangent, bitangent) < 0.0f) ? -1.0f : 1.0f;
+                                    tangent.w = handedness;
                                 }
-                                case VertexAttributeType::TexCoord1: {
-                                    glm::vec2 texCoord;
-                                    if (aiMesh->mTextureCoords[1]) {
-                                        texCoord = glm::vec2(
-                                            aiMesh->mTextureCoords[1][j].x,
-                                            aiMesh->mTextureCoords[1][j].y
-                                        );
-                                    } else {
-                                        texCoord = glm::vec2(0.0f, 0.0f); // Default
-                                    }
-                                    std::memcpy(attrPtr, &texCoord, sizeof(glm::vec2));
-                                    break;
+                            } else {
+                                // Calculate tangent if not present
+                                glm::vec3 normal = aiMesh->mNormals ? 
+                                    glm::vec3(aiMesh->mNormals[j].x, aiMesh->mNormals[j].y, aiMesh->mNormals[j].z) :
+                                    glm::vec3(0.0f, 1.0f, 0.0f);
+                                glm::vec3 tan = glm::vec3(1.0f, 0.0f, 0.0f);
+                                
+                                if (glm::abs(glm::dot(normal, tan)) > 0.9f) {
+                                    tan = glm::vec3(0.0f, 1.0f, 0.0f);
                                 }
-                                case VertexAttributeType::Tangent: {
-                                    glm::vec4 tangent;
-                                    if (aiMesh->mTangents) {
-                                        tangent = glm::vec4(
-                                            aiMesh->mTangents[j].x,
-                                            aiMesh->mTangents[j].y,
-                                            aiMesh->mTangents[j].z,
-                                            1.0f  // Default handedness
-                                        );
-                                        
-                                        // Use bitangent to determine handedness if available
-                                        if (aiMesh->mBitangents) {
-                                            glm::vec3 normal = aiMesh->mNormals ? 
-                                                glm::vec3(aiMesh->mNormals[j].x, aiMesh->mNormals[j].y, aiMesh->mNormals[j].z) :
-                                                glm::vec3(0.0f, 1.0f, 0.0f);
-                                            glm::vec3 tan = glm::vec3(tangent);
-                                            glm::vec3 bitangent = glm::vec3(
-                                                aiMesh->mBitangents[j].x,
-                                                aiMesh->mBitangents[j].y,
-                                                aiMesh->mBitangents[j].z
-                                            );
-                                            
-                                            glm::vec3 calculatedBitangent = glm::cross(normal, tan);
-                                            float handedness = (glm::dot(calculatedBitangent, bitangent) < 0.0f) ? -1.0f : 1.0f;
-                                            tangent.w = handedness;
-                                        }
-                                    } else {
-                                        // Calculate tangent if not present
-                                        glm::vec3 normal = aiMesh->mNormals ? 
-                                            glm::vec3(aiMesh->mNormals[j].x, aiMesh->mNormals[j].y, aiMesh->mNormals[j].z) :
-                                            glm::vec3(0.0f, 1.0f, 0.0f);
-                                        glm::vec3 tan = glm::vec3(1.0f, 0.0f, 0.0f);
-                                        
-                                        if (glm::abs(glm::dot(normal, tan)) > 0.9f) {
-                                            tan = glm::vec3(0.0f, 1.0f, 0.0f);
-                                        }
-                                        tan = glm::normalize(tan - glm::dot(tan, normal) * normal);
-                                        tangent = glm::vec4(tan, 1.0f);
-                                    }
-                                    std::memcpy(attrPtr, &tangent, sizeof(glm::vec4));
-                                    break;
-                                }
-                                case VertexAttributeType::Color0: {
-                                    glm::vec4 color;
-                                    if (aiMesh->mColors[0]) {
-                                        color = glm::vec4(
-                                            aiMesh->mColors[0][j].r,
-                                            aiMesh->mColors[0][j].g,
-                                            aiMesh->mColors[0][j].b,
-                                            aiMesh->mColors[0][j].a
-                                        );
-                                    } else {
-                                        color = glm::vec4(1.0f, 1.0f, 1.0f, 1.0f); // Default white
-                                    }
-                                    std::memcpy(attrPtr, &color, sizeof(glm::vec4));
-                                    break;
-                                }
-                                default:
-                                    break;
+                                tan = glm::normalize(tan - glm::dot(tan, normal) * normal);
+                                tangent = glm::vec4(tan, 1.0f);
                             }
+                            std::memcpy(attrPtr, &tangent, sizeof(glm::vec4));
+                            break;
                         }
-                    }
-
-                    // Load indices
-                    for (unsigned int j = 0; j < aiMesh->mNumFaces; j++) {
-                        aiFace face = aiMesh->mFaces[j];
-                        for (unsigned int k = 0; k < face.mNumIndices; k++) {
-                            result.indices.push_back(face.mIndices[k]);
+                        case VertexAttributeType::Color0: {
+                            glm::vec4 color;
+                            if (aiMesh->mColors[0]) {
+                                color = glm::vec4(
+                                    aiMesh->mColors[0][j].r,
+                                    aiMesh->mColors[0][j].g,
+                                    aiMesh->mColors[0][j].b,
+                                    aiMesh->mColors[0][j].a
+                                );
+                            } else {
+                                color = glm::vec4(1.0f, 1.0f, 1.0f, 1.0f); // Default white
+                            }
+                            std::memcpy(attrPtr, &color, sizeof(glm::vec4));
+                            break;
                         }
+                        default:
+                            break;
                     }
+                }
+            }
 
-                    // Load bone data from this mesh
-                    if (aiMesh->mBones) {
-                        for (unsigned int j = 0; j < aiMesh->mNumBones; j++) {
-                            aiBone* aiBone = aiMesh->mBones[j];
-                            Bone bone;
-                            bone.name = aiBone->mName.C_Str();
-
-                            // Convert offset matrix
-                            aiMatrix4x4 offsetMatrix = aiBone->mOffsetMatrix;
-                            bone.offsetMatrix = glm::mat4(
-                                offsetMatrix.a1, offsetMatrix.b1, offsetMatrix.c1, offsetMatrix.d1,
-                                offsetMatrix.a2, offsetMatrix.b2, offsetMatrix.c2, offsetMatrix.d2,
-                                offsetMatrix.a3, offsetMatrix.b3, offsetMatrix.c3, offsetMatrix.d3,
-                                offsetMatrix.a4, offsetMatrix.b4, offsetMatrix.c4, offsetMatrix.d4
-                            );
+            // Load indices
+            for (unsigned int j = 0; j < aiMesh->mNumFaces; j++) {
+                aiFace face = aiMesh->mFaces[j];
+                for (unsigned int k = 0; k < face.mNumIndices; k++) {
+                    result.indices.push_back(face.mIndices[k]);
+                }
+            }
 
-                            bone.parentIndex = -1; // Need to determine from scene graph
-                            result.bones.push_back(bone);
-                        }
-                    }
+            // Load bone data from this mesh
+            if (aiMesh->mBones) {
+                for (unsigned int j = 0; j < aiMesh->mNumBones; j++) {
+                    aiBone* aiBone = aiMesh->mBones[j];
+                    Bone bone;
+                    bone.name = aiBone->mName.C_Str();
+
+                    // Convert offset matrix
+                    aiMatrix4x4 offsetMatrix = aiBone->mOffsetMatrix;
+                    bone.offsetMatrix = glm::mat4(
+                        offsetMatrix.a1, offsetMatrix.b1, offsetMatrix.c1, offsetMatrix.d1,
+                        offsetMatrix.a2, offsetMatrix.b2, offsetMatrix.c2, offsetMatrix.d2,
+                        offsetMatrix.a3, offsetMatrix.b3, offsetMatrix.c3, offsetMatrix.d3,
+                        offsetMatrix.a4, offsetMatrix.b4, offsetMatrix.c4, offsetMatrix.d4
+                    );
+
+                    bone.parentIndex = -1; // Need to determine from scene graph
+                    result.bones.push_back(bone);
                 }
-            } else {
-                // No mesh file specified, return empty result
-                return result;
             }
 
-            result.metadata.isLoaded = true;
-            result.success = true;
-            return result;
+            result.indexCount = static_cast<uint32_t>(result.indices.size());
+            ComputeBounds(result);
+            return true;
+        }
+
+        bool MeshLoader::WriteCooked(const std::string& cookedPath, const LoadResult& mesh, bool allow16BitIndices) {
+            const uint8_t* vertexData = mesh.GetVertexData();
+            uint32_t vertexStride = mesh.vertexFormat.GetStride();
+            if (!vertexData || mesh.vertexCount == 0 || vertexStride == 0) {
+                std::cerr << "MeshLoader::WriteCooked: No vertex data for " << cookedPath << std::endl;
+                return false;
+            }
+
+            std::vector<CookedMeshAttribute> attributes;
+            for (const VertexAttribute& attr : mesh.vertexFormat.GetAttributes()) {
+                CookedMeshAttribute cooked = {};
+                cooked.type = static_cast<uint32_t>(attr.type);
+                cooked.offset = attr.offset;
+                cooked.size = static_cast<uint16_t>(attr.size);
+                cooked.encoding = static_cast<uint16_t>(attr.encoding);
+                cooked.location = attr.location;
+                attributes.push_back(cooked);
+            }
+
+            std::vector<CookedMeshBone> bones;
+            std::string boneNames;
+            for (const Bone& bone : mesh.bones) {
+                CookedMeshBone cooked = {};
+                std::memcpy(cooked.offsetMatrix, &bone.offsetMatrix[0][0], sizeof(cooked.offsetMatrix));
+                cooked.parentIndex = bone.parentIndex;
+                cooked.nameOffset = static_cast<uint32_t>(boneNames.size());
+                cooked.nameLength = static_cast<uint32_t>(bone.name.size());
+                boneNames += bone.name;
+                bones.push_back(cooked);
+            }
+
+            // 0xFFFF stays free, it is the primitive restart value for 16-bit indices
+            bool index16 = allow16BitIndices && mesh.vertexCount <= 0xFFFF;
+            std::vector<uint8_t> indexData(static_cast<size_t>(mesh.indexCount) * (index16 ? sizeof(uint16_t) : sizeof(uint32_t)));
+            const uint8_t* sourceIndices = static_cast<const uint8_t*>(mesh.GetIndexData());
+            for (uint32_t i = 0; i < mesh.indexCount; ++i) {
+                uint32_t index = 0;
+                if (mesh.indexSize == sizeof(uint16_t)) {
+                    uint16_t value;
+                    std::memcpy(&value, sourceIndices + i * sizeof(uint16_t), sizeof(value));
+                    index = value;
+                } else {
+                    std::memcpy(&index, sourceIndices + i * sizeof(uint32_t), sizeof(index));
+                }
+
+                if (index16) {
+                    uint16_t value = static_cast<uint16_t>(index);
+                    std::memcpy(indexData.data() + i * sizeof(uint16_t), &value, sizeof(value));
+                } else {
+                    std::memcpy(indexData.data() + i * sizeof(uint32_t), &index, sizeof(index));
+                }
+            }
+
+            // Meshes without LODs get a single level over every index
+            std::vector<CookedMeshLod> lods;
+            for (const MeshLod& lod : mesh.lods) {
+                CookedMeshLod cooked = {};
+                cooked.firstIndex = lod.firstIndex;
+                cooked.indexCount = lod.indexCount;
+                cooked.error = lod.error;
+                lods.push_back(cooked);
+            }
+            if (lods.empty()) {
+                CookedMeshLod cooked = {};
+                cooked.indexCount = mesh.indexCount;
+                lods.push_back(cooked);
+            }
+            if (lods.size() > CookedMesh::kMaxLods) {
+                std::cerr << "MeshLoader::WriteCooked: Too many LODs for " << cookedPath << std::endl;
+                return false;
+            }
+
+            uint64_t vertexBytes = static_cast<uint64_t>(mesh.vertexCount) * vertexStride;
+            uint64_t indexBytes = indexData.size();
+
+            CookedMeshHeader header = {};
+            header.magic = CookedMesh::kMagic;
+            header.version = CookedMesh::kVersion;
+            header.vertexCount = mesh.vertexCount;
+            header.indexCount = mesh.indexCount;
+            header.vertexStride = vertexStride;
+            header.attributeCount = static_cast<uint32_t>(attributes.size());
+            header.boneCount = static_cast<uint32_t>(bones.size());
+            header.flags = index16 ? CookedMesh::kFlagIndex16 : 0;
+            std::memcpy(header.boundsMin, &mesh.boundsMin[0], sizeof(header.boundsMin));
+            std::memcpy(header.boundsMax, &mesh.boundsMax[0], sizeof(header.boundsMax));
+            header.lodCount = static_cast<uint32_t>(lods.size());
+            header.attributesOffset = sizeof(CookedMeshHeader);
+            header.lodsOffset = AlignUp(header.attributesOffset + attributes.size() * sizeof(CookedMeshAttribute));
+            header.vertexDataOffset = AlignUp(header.lodsOffset + lods.size() * sizeof(CookedMeshLod));
+            header.indexDataOffset = AlignUp(header.vertexDataOffset + vertexBytes);
+            header.bonesOffset = AlignUp(header.indexDataOffset + indexBytes);
+            header.boneNamesOffset = header.bonesOffset + bones.size() * sizeof(CookedMeshBone);
+            header.fileSize = AlignUp(header.boneNamesOffset + boneNames.size());
+
+            std::ofstream file(cookedPath, std::ios::binary | std::ios::trunc);
+            if (!file) {
+                std::cerr << "MeshLoader::WriteCooked: Failed to open " << cookedPath << " for writing" << std::endl;
+                return false;
+            }
+
+            auto padTo = [&file](uint64_t offset) {
+                static const char zeros[CookedMesh::kAlignment] = {};
+                uint64_t position = static_cast<uint64_t>(file.tellp());
+                if (offset > position) {
+                    file.write(zeros, static_cast<std::streamsize>(offset - position));
+                }
+            };
+
+            file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+            file.write(reinterpret_cast<const char*>(attributes.data()),
+                       static_cast<std::streamsize>(attributes.size() * sizeof(CookedMeshAttribute)));
+            padTo(header.lodsOffset);
+            file.write(reinterpret_cast<const char*>(lods.data()),
+                       static_cast<std::streamsize>(lods.size() * sizeof(CookedMeshLod)));
+            padTo(header.vertexDataOffset);
+            file.write(reinterpret_cast<const char*>(vertexData), static_cast<std::streamsize>(vertexBytes));
+            padTo(header.indexDataOffset);
+            file.write(reinterpret_cast<const char*>(indexData.data()), static_cast<std::streamsize>(indexBytes));
+            padTo(header.bonesOffset);
+            file.write(reinterpret_cast<const char*>(bones.data()),
+                       static_cast<std::streamsize>(bones.size() * sizeof(CookedMeshBone)));
+            file.write(boneNames.data(), static_cast<std::streamsize>(boneNames.size()));
+            padTo(header.fileSize);
+
+            if (!file) {
+                std::cerr << "MeshLoader::WriteCooked: Failed to write " << cookedPath << std::endl;
+                return false;
+            }
+            return true;
+        }
+
+        bool MeshLoader::ReadCooked(const std::string& cookedPath, LoadResult& result) {
+            // Mapped from disk, or a view of the mounted package archive
+            std::shared_ptr<MappedFile> file = ResourceManager::GetInstance().OpenFile(cookedPath);
+            if (!file) {
+                return false;
+            }
+
+            const uint8_t* data = file->GetData();
+            uint64_t size = file->GetSize();
+            auto fail = [&cookedPath](const char* reason) {
+                std::cerr << "MeshLoader::ReadCooked: " << cookedPath << ": " << reason << std::endl;
+                return false;
+            };
+            auto inRange = [size](uint64_t offset, uint64_t bytes) {
+                return offset % CookedMesh::kAlignment == 0 && offset <= size && bytes <= size - offset;
+            };
+
+            if (size < sizeof(CookedMeshHeader)) {
+                return fail("File too small");
+            }
+            CookedMeshHeader header;
+            std::memcpy(&header, data, sizeof(header));
+            if (header.magic != CookedMesh::kMagic) {
+                return fail("Not a cooked mesh");
+            }
+            if (header.version != CookedMesh::kVersion) {
+                return fail("Unsupported version, re-import the mesh");
+            }
+
+            uint64_t vertexBytes = static_cast<uint64_t>(header.vertexCount) * header.vertexStride;
+            uint32_t indexSize = (header.flags & CookedMesh::kFlagIndex16) ? sizeof(uint16_t) : sizeof(uint32_t);
+            uint64_t indexBytes = static_cast<uint64_t>(header.indexCount) * indexSize;
+            uint64_t boneBytes = static_cast<uint64_t>(header.boneCount) * sizeof(CookedMeshBone);
+            if (header.fileSize != size ||
+                !inRange(header.attributesOffset, static_cast<uint64_t>(header.attributeCount) * sizeof(CookedMeshAttribute)) ||
+                !inRange(header.lodsOffset, static_cast<uint64_t>(header.lodCount) * sizeof(CookedMeshLod)) ||
+                !inRange(header.vertexDataOffset, vertexBytes) ||
+                !inRange(header.indexDataOffset, indexBytes) ||
+                !inRange(header.bonesOffset, boneBytes) ||
+                header.boneNamesOffset > size) {
+                return fail("Truncated or corrupt");
+            }
+            if (header.vertexCount == 0) {
+                return fail("No vertices");
+            }
+            if (header.lodCount == 0 || header.lodCount > CookedMesh::kMaxLods) {
+                return fail("Invalid LOD count");
+            }
+
+            const auto* lods = reinterpret_cast<const CookedMeshLod*>(data + header.lodsOffset);
+            result.lods.clear();
+            for (uint32_t i = 0; i < header.lodCount; ++i) {
+                if (static_cast<uint64_t>(lods[i].firstIndex) + lods[i].indexCount > header.indexCount) {
+                    return fail("LOD index range out of bounds");
+                }
+                MeshLod lod;
+                lod.firstIndex = lods[i].firstIndex;
+                lod.indexCount = lods[i].indexCount;
+                lod.error = lods[i].error;
+                result.lods.push_back(lod);
+            }
+
+            // The section ranges above say nothing about the values; an index past the last vertex would reach
+            // the GPU as an out-of-bounds vertex fetch
+            const uint8_t* indexData = data + header.indexDataOffset;
+            bool indicesValid = indexSize == sizeof(uint16_t)
+                ? IndicesInRange<uint16_t>(indexData, header.indexCount, header.vertexCount)
+                : IndicesInRange<uint32_t>(indexData, header.indexCount, header.vertexCount);
+            if (!indicesValid) {
+                return fail("Index out of vertex range");
+            }
+
+            // Rebuild the vertex format; it must come out with the layout the data was cooked with
+            const auto* attributes = reinterpret_cast<const CookedMeshAttribute*>(data + header.attributesOffset);
+            VertexFormat format;
+            for (uint32_t i = 0; i < header.attributeCount; ++i) {
+                if (!format.AddAttribute(static_cast<VertexAttributeType>(attributes[i].type), attributes[i].location,
+                                         static_cast<VertexAttributeEncoding>(attributes[i].encoding))) {
+                    return fail("Unsupported vertex attribute encoding");
+                }
+            }
+            if (format.GetStride() != header.vertexStride || format.GetAttributeCount() != header.attributeCount) {
+                return fail("Vertex format does not match the cooked layout");
+            }
+            for (uint32_t i = 0; i < header.attributeCount; ++i) {
+                const VertexAttribute& attr = format.GetAttributes()[i];
+                if (attr.offset != attributes[i].offset || attr.size != attributes[i].size) {
+                    return fail("Vertex format does not match the cooked layout");
+                }
+            }
+
+            const auto* bones = reinterpret_cast<const CookedMeshBone*>(data + header.bonesOffset);
+            const char* boneNames = reinterpret_cast<const char*>(data + header.boneNamesOffset);
+            uint64_t boneNamesSize = size - header.boneNamesOffset;
+            result.bones.clear();
+            result.bones.reserve(header.boneCount);
+            for (uint32_t i = 0; i < header.boneCount; ++i) {
+                if (static_cast<uint64_t>(bones[i].nameOffset) + bones[i].nameLength > boneNamesSize) {
+                    return fail("Bone name out of range");
+                }
+                Bone bone;
+                bone.name.assign(boneNames + bones[i].nameOffset, bones[i].nameLength);
+                std::memcpy(&bone.offsetMatrix[0][0], bones[i].offsetMatrix, sizeof(bones[i].offsetMatrix));
+                bone.parentIndex = bones[i].parentIndex;
+                result.bones.push_back(bone);
+            }
+
+            // Vertex and index data stay in the mapping; sections are 16-byte aligned and the mapping
+            // is page aligned, so the pointers can be used directly
+            result.vertexFormat = format;
+            result.vertexCount = header.vertexCount;
+            result.indexCount = header.indexCount;
+            result.indexSize = indexSize;
+            result.boundsMin = glm::vec3(header.boundsMin[0], header.boundsMin[1], header.boundsMin[2]);
+            result.boundsMax = glm::vec3(header.boundsMax[0], header.boundsMax[1], header.boundsMax[2]);
+            result.vertexData.clear();
+            result.indices.clear();
+            result.mappedVertexData = data + header.vertexDataOffset;
+            result.mappedIndexData = header.indexCount > 0 ? data + header.indexDataOffset : nullptr;
+            result.mappedFile = std::move(file);
+            return true;
         }
 
         bool MeshLoader::Save(const std::string& xmlFilePath,
                              const std::string& name,
                              ResourceID id,
-                             const std::string& meshFile) {
+                             const std::string& meshFile,
+                             const std::string& cookedFile) {
             // Save XML with mesh file path (similar to TextureLoader::Save)
             // Note: vertexStride is no longer stored - it's calculated from mesh file
             ResourceXMLParser::MeshData meshData;
             meshData.meshFile = meshFile;  // Source mesh file path (relative or absolute)
+            meshData.cookedFile = cookedFile;
 
             return ResourceXMLParser::SaveMeshToXML(xmlFilePath, name, id, meshData);
         }
@@ -293,8 +666,9 @@ namespace FirstEngine {
         std::vector<Vertex> MeshLoader::LoadResult::GetLegacyVertices() const {
             std::vector<Vertex> legacyVertices;
             
-            // Only convert if format matches legacy Vertex structure
-            if (!vertexFormat.HasAttribute(VertexAttributeType::Position) ||
+            // Only convert if format matches legacy Vertex structure (all float)
+            if (vertexFormat.IsQuantized() ||
+                !vertexFormat.HasAttribute(VertexAttributeType::Position) ||
                 !vertexFormat.HasAttribute(VertexAttributeType::Normal) ||
                 !vertexFormat.HasAttribute(VertexAttributeType::TexCoord0) ||
                 !vertexFormat.HasAttribute(VertexAttributeType::Tangent)) {
@@ -306,7 +680,7 @@ namespace FirstEngine {
             legacyVertices.resize(vertexCount);
 
             for (uint32_t i = 0; i < vertexCount; ++i) {
-                const uint8_t* vertexPtr = vertexData.data() + (i * stride);
+                const uint8_t* vertexPtr = GetVertexData() + (i * stride);
                 
                 // Extract position
                 if (const auto* posAttr = vertexFormat.GetAttribute(VertexAttributeType::Position)) {
@@ -0,0 +1,445 @@
+#include "FirstEngine/Resources/MeshOptimizer.h"
+#include <glm/glm.hpp>
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+namespace FirstEngine {
+    namespace Resources {
+
+        namespace {
+            constexpr uint32_t kInvalidIndex = UINT32_MAX;
+
+            // Forsyth scoring parameters (from the original write-up)
+            constexpr uint32_t kForsythCacheSize = 32;
+            constexpr float kCacheDecayPower = 1.5f;
+            constexpr float kLastTriangleScore = 0.75f;
+            constexpr float kValenceBoostScale = 2.0f;
+            constexpr float kValenceBoostPower = 0.5f;
+
+            float ForsythVertexScore(int cachePosition, uint32_t remainingTriangles) {
+                if (remainingTriangles == 0) {
+                    return -1.0f;
+                }
+
+                float score = 0.0f;
+                if (cachePosition >= 0) {
+                    if (cachePosition < 3) {
+                        // Vertices of the triangle just emitted: fixed score so the next one doesn't just reuse them
+                        score = kLastTriangleScore;
+                    } else {
+                        float scaler = 1.0f / static_cast<float>(kForsythCacheSize - 3);
+                        score = std::pow(1.0f - static_cast<float>(cachePosition - 3) * scaler, kCacheDecayPower);
+                    }
+                }
+
+                // Favour vertices with few triangles left, so they get finished off and don't linger
+                score += kValenceBoostScale * std::pow(static_cast<float>(remainingTriangles), -kValenceBoostPower);
+                return score;
+            }
+
+            glm::vec3 ReadPosition(const uint8_t* vertexData, uint32_t vertexStride, uint32_t positionOffset, uint32_t index) {
+                glm::vec3 position;
+                std::memcpy(&position, vertexData + static_cast<size_t>(index) * vertexStride + positionOffset, sizeof(glm::vec3));
+                return position;
+            }
+
+            uint64_t HashVertex(const uint8_t* data, uint32_t size) {
+                // FNV-1a
+                uint64_t hash = 14695981039346656037ull;
+                for (uint32_t i = 0; i < size; ++i) {
+                    hash = (hash ^ data[i]) * 1099511628211ull;
+                }
+                return hash;
+            }
+
+            // FIFO post-transform cache simulation: a vertex is cached if fewer than cacheSize misses happened since
+            // it was last transformed
+            class FifoCache {
+            public:
+                FifoCache(uint32_t vertexCount, uint32_t cacheSize)
+                    : m_Timestamps(vertexCount, 0), m_CacheSize(cacheSize), m_Time(cacheSize + 1) {}
+
+                // Returns true on a miss
+                bool Access(uint32_t vertex) {
+                    if (m_Time - m_Timestamps[vertex] > m_CacheSize) {
+                        m_Timestamps[vertex] = m_Time++;
+                        return true;
+                    }
+                    return false;
+                }
+
+                void Flush() { m_Time += m_CacheSize + 1; }
+
+            private:
+                std::vector<uint32_t> m_Timestamps;
+                uint32_t m_CacheSize;
+                uint32_t m_Time;
+            };
+        }
+
+        bool MeshOptimizer::Optimize(MeshLoader::LoadResult& mesh, const Options& options, Report* report) {
+            if (mesh.mappedFile) {
+                // Mapped data is read-only; optimize before cooking
+                return false;
+            }
+
+            uint32_t vertexStride = mesh.vertexFormat.GetStride();
+            if (mesh.vertexCount == 0 || vertexStride == 0 || mesh.indices.size() % 3 != 0 ||
+                mesh.vertexData.size() < static_cast<size_t>(mesh.vertexCount) * vertexStride) {
+                return false;
+            }
+
+            if (report) {
+                report->before = Analyze(mesh.indices, mesh.vertexCount);
+            }
+
+            // Non-indexed meshes have nothing to reorder
+            if (!mesh.indices.empty()) {
+                uint32_t vertexCount = mesh.vertexCount;
+                if (options.weld) {
+                    vertexCount = WeldVertices(mesh.vertexData, vertexStride, mesh.indices);
+                }
+                if (options.optimizeVertexCache) {
+                    OptimizeVertexCache(mesh.indices, vertexCount);
+                }
+                const VertexAttribute* position = mesh.vertexFormat.GetAttribute(VertexAttributeType::Position);
+                if (options.optimizeOverdraw && position) {
+                    OptimizeOverdraw(mesh.indices, mesh.vertexData.data(), vertexCount, vertexStride, position->offset,
+                                     options.overdrawThreshold);
+                }
+                if (options.optimizeVertexFetch) {
+                    vertexCount = OptimizeVertexFetch(mesh.vertexData, vertexStride, mesh.indices);
+                }
+
+                mesh.vertexCount = vertexCount;
+                mesh.indexCount = static_cast<uint32_t>(mesh.indices.size());
+            }
+
+            if (report) {
+                report->after = Analyze(mesh.indices, mesh.vertexCount);
+            }
+            return true;
+        }
+
+        MeshOptimizer::Statistics MeshOptimizer::Analyze(const std::vector<uint32_t>& indices, uint32_t vertexCount,
+                                                         uint32_t cacheSize) {
+            Statistics stats;
+            stats.vertexCount = vertexCount;
+            stats.triangleCount = static_cast<uint32_t>(indices.size() / 3);
+            if (stats.triangleCount == 0 || vertexCount == 0) {
+                return stats;
+            }
+
+            FifoCache cache(vertexCount, cacheSize);
+            std::vector<bool> referenced(vertexCount, false);
+            uint32_t uniqueVertices = 0;
+            uint32_t misses = 0;
+            for (uint32_t index : indices) {
+                if (index >= vertexCount) {
+                    continue;
+                }
+                if (!referenced[index]) {
+                    referenced[index] = true;
+                    uniqueVertices++;
+                }
+                if (cache.Access(index)) {
+                    misses++;
+                }
+            }
+
+            stats.acmr = static_cast<float>(misses) / static_cast<float>(stats.triangleCount);
+            stats.atvr = uniqueVertices > 0 ? static_cast<float>(misses) / static_cast<float>(uniqueVertices) : 0.0f;
+            return stats;
+        }
+
+        uint32_t MeshOptimizer::WeldVertices(std::vector<uint8_t>& vertexData, uint32_t vertexStride,
+                                             std::vector<uint32_t>& indices) {
+            uint32_t vertexCount = static_cast<uint32_t>(vertexData.size() / vertexStride);
+
+            // Open addressing table of first occurrences, at most half full
+            size_t tableSize = 16;
+            while (tableSize < static_cast<size_t>(vertexCount) * 2) {
+                tableSize *= 2;
+            }
+            std::vector<uint32_t> table(tableSize, kInvalidIndex);
+            std::vector<uint32_t> remap(vertexCount, kInvalidIndex);
+            std::vector<uint8_t> welded;
+            welded.reserve(vertexData.size());
+            uint32_t weldedCount = 0;
+
+            for (uint32_t v = 0; v < vertexCount; ++v) {
+                const uint8_t* vertex = vertexData.data() + static_cast<size_t>(v) * vertexStride;
+                size_t slot = HashVertex(vertex, vertexStride) & (tableSize - 1);
+                while (true) {
+                    uint32_t existing = table[slot];
+                    if (existing == kInvalidIndex) {
+                        table[slot] = v;
+                        remap[v] = weldedCount++;
+                        welded.insert(welded.end(), vertex, vertex + vertexStride);
+                        break;
+                    }
+                    if (std::memcmp(vertexData.data() + static_cast<size_t>(existing) * vertexStride, vertex, vertexStride) == 0) {
+                        remap[v] = remap[existing];
+                        break;
+                    }
+                    slot = (slot + 1) & (tableSize - 1);
+                }
+            }
+
+            for (uint32_t& index : indices) {
+                index = remap[index];
+            }
+            vertexData.swap(welded);
+            return weldedCount;
+        }
+
+        void MeshOptimizer::OptimizeVertexCache(std::vector<uint32_t>& indices, uint32_t vertexCount) {
+            uint32_t triangleCount = static_cast<uint32_t>(indices.size() / 3);
+            if (triangleCount == 0 || vertexCount == 0) {
+                return;
+            }
+
+            // Vertex -> triangle adjacency; each vertex's list shrinks as its triangles are emitted
+            std::vector<uint32_t> remaining(vertexCount, 0);
+            for (uint32_t index : indices) {
+                remaining[index]++;
+            }
+            std::vector<uint32_t> offsets(vertexCount + 1, 0);
+            for (uint32_t v = 0; v < vertexCount; ++v) {
+                offsets[v + 1] = offsets[v] + remaining[v];
+            }
+            std::vector<uint32_t> adjacency(indices.size());
+            {
+                std::vector<uint32_t> fill(offsets.begin(), offsets.end() - 1);
+                for (uint32_t t = 0; t < triangleCount; ++t) {
+                    for (uint32_t k = 0; k < 3; ++k) {
+                        adjacency[fill[indices[t * 3 + k]]++] = t;
+                    }
+                }
+            }
+
+            std::vector<int> cachePosition(vertexCount, -1);
+            std::vector<float> vertexScore(vertexCount);
+            for (uint32_t v = 0; v < vertexCount; ++v) {
+                vertexScore[v] = ForsythVertexScore(-1, remaining[v]);
+            }
+
+            std::vector<float> triangleScore(triangleCount);
+            std::vector<bool> emitted(triangleCount, false);
+            uint32_t bestTriangle = kInvalidIndex;
+            float bestScore = -1.0f;
+            for (uint32_t t = 0; t < triangleCount; ++t) {
+                triangleScore[t] = vertexScore[indices[t * 3]] + vertexScore[indices[t * 3 + 1]] + vertexScore[indices[t * 3 + 2]];
+                if (triangleScore[t] > bestScore) {
+                    bestScore = triangleScore[t];
+                    bestTriangle = t;
+                }
+            }
+
+            std::vector<uint32_t> output;
+            output.reserve(indices.size());
+            std::vector<uint32_t> cache;
+            std::vector<uint32_t> newCache;
+            cache.reserve(kForsythCacheSize + 3);
+            newCache.reserve(kForsythCacheSize + 3);
+            uint32_t fallbackCursor = 0;
+
+            for (uint32_t emittedCount = 0; emittedCount < triangleCount; ++emittedCount) {
+                if (bestTriangle == kInvalidIndex) {
+                    // Nothing adjacent to the cache is left: continue with the next unemitted triangle
+                    while (emitted[fallbackCursor]) {
+                        fallbackCursor++;
+                    }
+                    bestTriangle = fallbackCursor;
+                }
+
+                uint32_t t = bestTriangle;
+                const uint32_t triangle[3] = { indices[t * 3], indices[t * 3 + 1], indices[t * 3 + 2] };
+                output.insert(output.end(), triangle, triangle + 3);
+                emitted[t] = true;
+
+                for (uint32_t v : triangle) {
+                    uint32_t* begin = adjacency.data() + offsets[v];
+                    uint32_t* end = begin + remaining[v];
+                    uint32_t* found = std::find(begin, end, t);
+                    if (found != end) {
+                        std::swap(*found, *(end - 1));
+                        remaining[v]--;
+                    }
+                }
+
+                // Emitted triangle's vertices go to the front; everything else shifts back (LRU)
+                newCache.assign(triangle, triangle + 3);
+                for (uint32_t v : cache) {
+                    if (v != triangle[0] && v != triangle[1] && v != triangle[2]) {
+                        newCache.push_back(v);
+                    }
+                }
+
+                // Rescore every vertex whose cache position changed, including those falling out of the cache
+                for (size_t i = 0; i < newCache.size(); ++i) {
+                    uint32_t v = newCache[i];
+                    cachePosition[v] = i < kForsythCacheSize ? static_cast<int>(i) : -1;
+                    float score = ForsythVertexScore(cachePosition[v], remaining[v]);
+                    float delta = score - vertexScore[v];
+                    vertexScore[v] = score;
+                    for (uint32_t a = 0; a < remaining[v]; ++a) {
+                        triangleScore[adjacency[offsets[v] + a]] += delta;
+                    }
+                }
+                if (newCache.size() > kForsythCacheSize) {
+                    newCache.resize(kForsythCacheSize);
+                }
+                cache.swap(newCache);
+
+                // Next triangle: the best one touching the cache
+                bestTriangle = kInvalidIndex;
+                bestScore = -1.0f;
+                for (uint32_t v : cache) {
+                    for (uint32_t a = 0; a < remaining[v]; ++a) {
+                        uint32_t candidate = adjacency[offsets[v] + a];
+                        if (triangleScore[candidate] > bestScore) {
+                            bestScore = triangleScore[candidate];
+                            bestTriangle = candidate;
+                        }
+                    }
+                }
+            }
+
+            indices.swap(output);
+        }
+
+        void MeshOptimizer::OptimizeOverdraw(std::vector<uint32_t>& indices, const uint8_t* vertexData, uint32_t vertexCount,
+                                             uint32_t vertexStride, uint32_t positionOffset, float threshold) {
+            uint32_t triangleCount = static_cast<uint32_t>(indices.size() / 3);
+            if (triangleCount < 2 || !vertexData || vertexCount == 0) {
+                return;
+            }
+
+            // Hard boundaries: triangles where the cache-optimized order restarts (all three vertices miss)
+            std::vector<uint32_t> hardClusters;
+            uint32_t totalMisses = 0;
+            {
+                FifoCache cache(vertexCount, kStatisticsCacheSize);
+                for (uint32_t t = 0; t < triangleCount; ++t) {
+                    uint32_t misses = 0;
+                    for (uint32_t k = 0; k < 3; ++k) {
+                        misses += cache.Access(indices[t * 3 + k]) ? 1 : 0;
+                    }
+                    if (t == 0 || misses == 3) {
+                        hardClusters.push_back(t);
+                    }
+                    totalMisses += misses;
+                }
+            }
+            hardClusters.push_back(triangleCount);
+
+            // Soft boundaries: split further wherever restarting the cache keeps ACMR within the threshold
+            float targetAcmr = threshold * static_cast<float>(totalMisses) / static_cast<float>(triangleCount);
+            std::vector<uint32_t> clusters;
+            {
+                FifoCache cache(vertexCount, kStatisticsCacheSize);
+                for (size_t c = 0; c + 1 < hardClusters.size(); ++c) {
+                    uint32_t start = hardClusters[c];
+                    uint32_t end = hardClusters[c + 1];
+                    clusters.push_back(start);
+                    cache.Flush();
+
+                    uint32_t misses = 0;
+                    for (uint32_t t = start; t < end; ++t) {
+                        for (uint32_t k = 0; k < 3; ++k) {
+                            misses += cache.Access(indices[t * 3 + k]) ? 1 : 0;
+                        }
+                        uint32_t clusterTriangles = t - clusters.back() + 1;
+                        if (t + 1 < end && static_cast<float>(misses) <= targetAcmr * static_cast<float>(clusterTriangles)) {
+                            clusters.push_back(t + 1);
+                            cache.Flush();
+                            misses = 0;
+                        }
+                    }
+                }
+            }
+            clusters.push_back(triangleCount);
+
+            // Sort clusters so the ones facing away from the mesh centre (likely occluders) draw first
+            struct ClusterKey {
+                uint32_t start;
+                uint32_t end;
+                float sortKey;
+            };
+            std::vector<ClusterKey> keys;
+            keys.reserve(clusters.size() - 1);
+
+            glm::vec3 meshCentroid(0.0f);
+            float meshArea = 0.0f;
+            std::vector<glm::vec3> clusterCentroids;
+            std::vector<glm::vec3> clusterNormals;
+            for (size_t c = 0; c + 1 < clusters.size(); ++c) {
+                glm::vec3 centroid(0.0f);
+                glm::vec3 normal(0.0f);
+                float area = 0.0f;
+                for (uint32_t t = clusters[c]; t < clusters[c + 1]; ++t) {
+                    glm::vec3 p0 = ReadPosition(vertexData, vertexStride, positionOffset, indices[t * 3]);
+                    glm::vec3 p1 = ReadPosition(vertexData, vertexStride, positionOffset, indices[t * 3 + 1]);
+                    glm::vec3 p2 = ReadPosition(vertexData, vertexStride, positionOffset, indices[t * 3 + 2]);
+                    glm::vec3 faceNormal = glm::cross(p1 - p0, p2 - p0);
+                    float faceArea = glm::length(faceNormal);
+                    centroid += (p0 + p1 + p2) * (faceArea / 3.0f);
+                    normal += faceNormal;
+                    area += faceArea;
+                }
+                meshCentroid += centroid;
+                meshArea += area;
+                clusterCentroids.push_back(area > 0.0f ? centroid / area : centroid);
+                clusterNormals.push_back(normal);
+            }
+            if (meshArea > 0.0f) {
+                meshCentroid /= meshArea;
+            }
+
+            for (size_t c = 0; c + 1 < clusters.size(); ++c) {
+                ClusterKey key;
+                key.start = clusters[c];
+                key.end = clusters[c + 1];
+                float normalLength = glm::length(clusterNormals[c]);
+                key.sortKey = normalLength > 0.0f
+                    ? glm::dot(clusterCentroids[c] - meshCentroid, clusterNormals[c] / normalLength)
+                    : 0.0f;
+                keys.push_back(key);
+            }
+            std::stable_sort(keys.begin(), keys.end(), [](const ClusterKey& a, const ClusterKey& b) {
+                return a.sortKey > b.sortKey;
+            });
+
+            std::vector<uint32_t> output;
+            output.reserve(indices.size());
+            for (const ClusterKey& key : keys) {
+                output.insert(output.end(), indices.begin() + key.start * 3, indices.begin() + key.end * 3);
+            }
+            indices.swap(output);
+        }
+
+        uint32_t MeshOptimizer::OptimizeVertexFetch(std::vector<uint8_t>& vertexData, uint32_t vertexStride,
+                                                    std::vector<uint32_t>& indices) {
+            uint32_t vertexCount = static_cast<uint32_t>(vertexData.size() / vertexStride);
+            std::vector<uint32_t> remap(vertexCount, kInvalidIndex);
+            std::vector<uint8_t> reordered;
+            reordered.reserve(vertexData.size());
+            uint32_t nextIndex = 0;
+
+            for (uint32_t& index : indices) {
+                if (remap[index] == kInvalidIndex) {
+                    remap[index] = nextIndex++;
+                    const uint8_t* vertex = vertexData.data() + static_cast<size_t>(index) * vertexStride;
+                    reordered.insert(reordered.end(), vertex, vertex + vertexStride);
+                }
+                index = remap[index];
+            }
+
+            vertexData.swap(reordered);
+            return nextIndex;
+        }
+
+    } // namespace Resources
+} // namespace FirstEngine
@@ -30,6 +30,7 @@ namespace FirstEngine {
 
             m_VertexCount = static_cast<uint32_t>(vertices.size());
             m_IndexCount = static_cast<uint32_t>(indices.size());
+            m_IndexSize = sizeof(uint32_t);
             m_VertexStride = vertexStride > 0 ? vertexStride : sizeof(Vertex);
 
             // Copy vertex data
@@ -42,6 +43,19 @@ namespace FirstEngine {
                 std::memcpy(m_IndexData.data(), indices.data(), m_IndexCount * sizeof(uint32_t));
             }
 
+            m_VertexFormat = VertexFormat::CreatePositionNormalTexCoordTangent();
+            m_Lods.clear();
+            m_MappedFile.reset();
+            m_VertexPtr = m_VertexData.data();
+            m_IndexPtr = m_IndexData.empty() ? nullptr : m_IndexData.data();
+
+            m_BoundsMin = vertices[0].position;
+            m_BoundsMax = vertices[0].position;
+            for (const Vertex& vertex : vertices) {
+                m_BoundsMin = glm::min(m_BoundsMin, vertex.position);
+                m_BoundsMax = glm::max(m_BoundsMax, vertex.position);
+            }
+
             m_Metadata.isLoaded = true;
             m_Metadata.fileSize = m_VertexData.size() + m_IndexData.size();
 
@@ -77,30 +91,46 @@ namespace FirstEngine {
             m_Metadata = loadResult.metadata;
             m_Metadata.resourceID = id; // Ensure ID matches
 
-            // Store source mesh file path (for saving)
+            // Store source and cooked mesh file paths (for saving)
             m_SourceMeshFile = loadResult.meshFile;
+            m_CookedMeshFile = loadResult.cookedFile;
 
             // Use returned Handle data (vertexData, vertexFormat, indices) to initialize resource
-            if (!loadResult.vertexData.empty() && loadResult.vertexCount > 0) {
+            if (loadResult.GetVertexData() && loadResult.vertexCount > 0) {
                 // Initialize from flexible vertex format
                 m_VertexCount = loadResult.vertexCount;
-                m_IndexCount = static_cast<uint32_t>(loadResult.indices.size());
+                m_IndexCount = loadResult.indexCount;
+                m_IndexSize = loadResult.indexSize;
                 m_VertexStride = loadResult.vertexFormat.GetStride();
-                
-                // Copy vertex data
-                m_VertexData = loadResult.vertexData;
-                
-                // Copy index data
-                if (!loadResult.indices.empty()) {
-                    m_IndexData.resize(m_IndexCount * sizeof(uint32_t));
-                    std::memcpy(m_IndexData.data(), loadResult.indices.data(), m_IndexCount * sizeof(uint32_t));
+                m_VertexFormat = loadResult.vertexFormat;
+                m_BoundsMin = loadResult.boundsMin;
+                m_BoundsMax = loadResult.boundsMax;
+                m_Lods = std::move(loadResult.lods);
+
+                if (loadResult.mappedFile) {
+                    // Cooked mesh: keep the mapping alive and read vertex/index data from it in place
+                    m_MappedFile = loadResult.mappedFile;
+                    m_VertexPtr = loadResult.mappedVertexData;
+                    m_IndexPtr = loadResult.mappedIndexData;
+                } else {
+                    // Take over the vertex data
+                    m_VertexData = std::move(loadResult.vertexData);
+
+                    // Copy index data
+                    if (!loadResult.indices.empty()) {
+                        m_IndexData.resize(m_IndexCount * sizeof(uint32_t));
+                        std::memcpy(m_IndexData.data(), loadResult.indices.data(), m_IndexCount * sizeof(uint32_t));
+                    }
+                    m_VertexPtr = m_VertexData.data();
+                    m_IndexPtr = m_IndexData.empty() ? nullptr : m_IndexData.data();
                 }
             } else {
                 return ResourceLoadResult::InvalidFormat;
             }
             
             m_Metadata.isLoaded = true;
-            m_Metadata.fileSize = m_VertexData.size() + m_IndexData.size();
+            m_Metadata.fileSize = static_cast<uint64_t>(m_VertexCount) * m_VertexStride +
+                                  static_cast<uint64_t>(m_IndexCount) * m_IndexSize;
 
             return ResourceLoadResult::Success;
         }
@@ -114,7 +144,7 @@ namespace FirstEngine {
             // Save XML with source mesh file path (similar to TextureResource::Save)
             // Note: vertexStride is no longer stored in XML - it's calculated from mesh file
             return MeshLoader::Save(xmlFilePath, m_Metadata.name, m_Metadata.resourceID,
-                                   m_SourceMeshFile);
+                                   m_SourceMeshFile, m_CookedMeshFile);
         }
 
         // Render resource management implementation (internal)
@@ -146,7 +176,7 @@ namespace FirstEngine {
                 return false;
             }
             auto* geometry = static_cast<Renderer::RenderGeometry*>(m_RenderGeometry);
-            return geometry && geometry->IsCreated();
+            return geometry && geometry->IsReady();
         }
 
         bool MeshResource::GetRenderData(RenderData& outData) const {
@@ -154,7 +184,7 @@ namespace FirstEngine {
                 return false;
             }
             auto* geometry = static_cast<Renderer::RenderGeometry*>(m_RenderGeometry);
-            if (!geometry || !geometry->IsCreated()) {
+            if (!geometry || !geometry->IsReady()) {
                 return false;
             }
 
@@ -165,6 +195,15 @@ namespace FirstEngine {
             outData.firstIndex = geometry->GetFirstIndex();
             outData.firstVertex = geometry->GetFirstVertex();
             outData.vertexStride = geometry->GetVertexStride(); // Include vertex stride for validation
+            outData.indexSize = geometry->GetIndexSize();
+
+            // The index buffer holds every LOD; draw LOD 0 unless the renderer picks another level
+            if (!m_Lods.empty()) {
+                outData.firstIndex += m_Lods[0].firstIndex;
+                outData.indexCount = m_Lods[0].indexCount;
+                outData.lods = m_Lods.data();
+                outData.lodCount = static_cast<uint32_t>(m_Lods.size());
+            }
             return true;
         }
 
@@ -0,0 +1,338 @@
+#include "FirstEngine/Resources/MeshSimplifier.h"
+#include "FirstEngine/Resources/MeshOptimizer.h"
+#include <glm/glm.hpp>
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <iostream>
+#include <numeric>
+#include <unordered_map>
+
+namespace FirstEngine {
+    namespace Resources {
+
+        namespace {
+            // Sum of squared distances to a set of planes, weighted by triangle area: p^T A p + 2 b.p + c
+            struct Quadric {
+                double a00 = 0.0, a11 = 0.0, a22 = 0.0, a01 = 0.0, a02 = 0.0, a12 = 0.0;
+                double b0 = 0.0, b1 = 0.0, b2 = 0.0;
+                double c = 0.0;
+                double weight = 0.0;
+
+                void AddPlane(const glm::dvec3& n, double d, double w) {
+                    a00 += w * n.x * n.x;
+                    a11 += w * n.y * n.y;
+                    a22 += w * n.z * n.z;
+                    a01 += w * n.x * n.y;
+                    a02 += w * n.x * n.z;
+                    a12 += w * n.y * n.z;
+                    b0 += w * n.x * d;
+                    b1 += w * n.y * d;
+                    b2 += w * n.z * d;
+                    c += w * d * d;
+                    weight += w;
+                }
+
+                void Add(const Quadric& other) {
+                    a00 += other.a00; a11 += other.a11; a22 += other.a22;
+                    a01 += other.a01; a02 += other.a02; a12 += other.a12;
+                    b0 += other.b0; b1 += other.b1; b2 += other.b2;
+                    c += other.c;
+                    weight += other.weight;
+                }
+
+                // Area-weighted mean squared distance of 'p' to the planes
+                double Error(const glm::vec3& p) const {
+                    double x = p.x, y = p.y, z = p.z;
+                    double e = x * (a00 * x + a01 * y + a02 * z) +
+                               y * (a01 * x + a11 * y + a12 * z) +
+                               z * (a02 * x + a12 * y + a22 * z) +
+                               2.0 * (b0 * x + b1 * y + b2 * z) + c;
+                    return weight > 0.0 ? std::max(e, 0.0) / weight : 0.0;
+                }
+            };
+
+            struct Collapse {
+                uint32_t from;
+                uint32_t to;
+                double error;
+            };
+
+            uint64_t EdgeKey(uint32_t a, uint32_t b) {
+                return (static_cast<uint64_t>(a) << 32) | b;
+            }
+        }
+
+        float MeshSimplifier::Simplify(const std::vector<uint32_t>& indices, const uint8_t* vertexData, uint32_t vertexCount,
+                                       uint32_t vertexStride, uint32_t positionOffset, size_t targetIndexCount,
+                                       float maxError, std::vector<uint32_t>& outIndices) {
+            outIndices = indices;
+            if (!vertexData || vertexCount == 0 || indices.size() % 3 != 0 || targetIndexCount >= indices.size()) {
+                return 0.0f;
+            }
+
+            std::vector<glm::vec3> positions(vertexCount);
+            for (uint32_t i = 0; i < vertexCount; ++i) {
+                std::memcpy(&positions[i], vertexData + static_cast<size_t>(i) * vertexStride + positionOffset, sizeof(glm::vec3));
+            }
+
+            glm::vec3 boundsMin = positions[0];
+            glm::vec3 boundsMax = positions[0];
+            for (const glm::vec3& position : positions) {
+                boundsMin = glm::min(boundsMin, position);
+                boundsMax = glm::max(boundsMax, position);
+            }
+            double radius = 0.5 * glm::length(boundsMax - boundsMin);
+            if (radius <= 0.0) {
+                return 0.0f;
+            }
+            double errorLimit = static_cast<double>(maxError) * radius;
+            double errorLimitSquared = errorLimit * errorLimit;
+
+            // One canonical vertex per position; vertices sharing it differ only in attributes (seams)
+            std::vector<uint32_t> order(vertexCount);
+            std::iota(order.begin(), order.end(), 0u);
+            std::sort(order.begin(), order.end(), [&positions](uint32_t a, uint32_t b) {
+                const glm::vec3& pa = positions[a];
+                const glm::vec3& pb = positions[b];
+                if (pa.x != pb.x) return pa.x < pb.x;
+                if (pa.y != pb.y) return pa.y < pb.y;
+                if (pa.z != pb.z) return pa.z < pb.z;
+                return a < b;
+            });
+            std::vector<uint32_t> remap(vertexCount);
+            std::vector<uint32_t> wedgeCount(vertexCount, 0);
+            for (uint32_t i = 0; i < vertexCount; ++i) {
+                uint32_t vertex = order[i];
+                bool samePosition = i > 0 && positions[vertex] == positions[order[i - 1]];
+                remap[vertex] = samePosition ? remap[order[i - 1]] : vertex;
+                wedgeCount[remap[vertex]]++;
+            }
+
+            // Lock seams, borders and non-manifold edges: collapsing those would tear the surface or its UVs
+            std::vector<uint8_t> locked(vertexCount, 0);
+            for (uint32_t i = 0; i < vertexCount; ++i) {
+                if (wedgeCount[remap[i]] > 1) {
+                    locked[remap[i]] = 1;
+                }
+            }
+            std::unordered_map<uint64_t, uint32_t> edges;
+            edges.reserve(indices.size());
+            for (size_t t = 0; t < indices.size(); t += 3) {
+                for (int k = 0; k < 3; ++k) {
+                    uint32_t a = remap[indices[t + k]];
+                    uint32_t b = remap[indices[t + (k + 1) % 3]];
+                    edges[EdgeKey(a, b)]++;
+                }
+            }
+            for (const auto& edge : edges) {
+                uint32_t a = static_cast<uint32_t>(edge.first >> 32);
+                uint32_t b = static_cast<uint32_t>(edge.first & 0xFFFFFFFFu);
+                auto reverse = edges.find(EdgeKey(b, a));
+                if (edge.second != 1 || reverse == edges.end() || reverse->second != 1) {
+                    locked[a] = 1;
+                    locked[b] = 1;
+                }
+            }
+
+            std::vector<Quadric> quadrics(vertexCount);
+            for (size_t t = 0; t < indices.size(); t += 3) {
+                glm::dvec3 p0 = positions[remap[indices[t]]];
+                glm::dvec3 p1 = positions[remap[indices[t + 1]]];
+                glm::dvec3 p2 = positions[remap[indices[t + 2]]];
+                glm::dvec3 normal = glm::cross(p1 - p0, p2 - p0);
+                double length = glm::length(normal);
+                if (length <= 0.0) {
+                    continue;
+                }
+                normal /= length;
+                double distance = -glm::dot(normal, p0);
+                for (int k = 0; k < 3; ++k) {
+                    quadrics[remap[indices[t + k]]].AddPlane(normal, distance, 0.5 * length);
+                }
+            }
+
+            std::vector<uint32_t> collapseRemap(vertexCount);
+            std::vector<uint8_t> touched(vertexCount);
+            std::vector<uint32_t> triangleOffsets(vertexCount + 1);
+            std::vector<uint32_t> vertexTriangles;
+            std::vector<Collapse> collapses;
+            double resultError = 0.0;
+
+            // Moving 'from' onto 'to' must not turn any surviving triangle around 'from' over
+            auto flipsTriangles = [&](uint32_t from, uint32_t to) {
+                for (uint32_t i = triangleOffsets[from]; i < triangleOffsets[from + 1]; ++i) {
+                    size_t t = static_cast<size_t>(vertexTriangles[i]) * 3;
+                    uint32_t corners[3];
+                    bool degenerate = false;
+                    for (int k = 0; k < 3; ++k) {
+                        corners[k] = collapseRemap[outIndices[t + k]];
+                        degenerate = degenerate || remap[corners[k]] == remap[to];
+                    }
+                    if (degenerate) {
+                        continue;
+                    }
+
+                    glm::vec3 before[3];
+                    glm::vec3 after[3];
+                    for (int k = 0; k < 3; ++k) {
+                        before[k] = positions[corners[k]];
+                        after[k] = remap[corners[k]] == from ? positions[to] : before[k];
+                    }
+                    glm::vec3 normalBefore = glm::cross(before[1] - before[0], before[2] - before[0]);
+                    glm::vec3 normalAfter = glm::cross(after[1] - after[0], after[2] - after[0]);
+                    if (glm::dot(normalBefore, normalAfter) <= 0.25f * glm::length(normalBefore) * glm::length(normalAfter)) {
+                        return true;
+                    }
+                }
+                return false;
+            };
+
+            // Passes of independent collapses, cheapest first; each vertex moves or receives at most once per pass
+            while (outIndices.size() > targetIndexCount) {
+                size_t triangleCount = outIndices.size() / 3;
+
+                std::fill(triangleOffsets.begin(), triangleOffsets.end(), 0u);
+                for (size_t i = 0; i < outIndices.size(); ++i) {
+                    triangleOffsets[remap[outIndices[i]] + 1]++;
+                }
+                for (uint32_t i = 0; i < vertexCount; ++i) {
+                    triangleOffsets[i + 1] += triangleOffsets[i];
+                }
+                vertexTriangles.resize(outIndices.size());
+                std::vector<uint32_t> fill(triangleOffsets.begin(), triangleOffsets.end() - 1);
+                for (size_t i = 0; i < outIndices.size(); ++i) {
+                    vertexTriangles[fill[remap[outIndices[i]]]++] = static_cast<uint32_t>(i / 3);
+                }
+
+                collapses.clear();
+                for (size_t t = 0; t < outIndices.size(); t += 3) {
+                    for (int k = 0; k < 3; ++k) {
+                        uint32_t a = outIndices[t + k];
+                        uint32_t b = outIndices[t + (k + 1) % 3];
+                        if (remap[a] == remap[b]) {
+                            continue;
+                        }
+                        // Unlocked vertices have a single wedge, so the vertex is its own canonical vertex
+                        if (!locked[remap[a]]) {
+                            double error = quadrics[a].Error(positions[b]);
+                            if (error <= errorLimitSquared) {
+                                collapses.push_back({ a, b, error });
+                            }
+                        }
+                        if (!locked[remap[b]]) {
+                            double error = quadrics[b].Error(positions[a]);
+                            if (error <= errorLimitSquared) {
+                                collapses.push_back({ b, a, error });
+                            }
+                        }
+                    }
+                }
+                if (collapses.empty()) {
+                    break;
+                }
+                std::sort(collapses.begin(), collapses.end(), [](const Collapse& a, const Collapse& b) {
+                    return a.error < b.error;
+                });
+
+                std::iota(collapseRemap.begin(), collapseRemap.end(), 0u);
+                std::fill(touched.begin(), touched.end(), 0);
+                size_t trianglesToRemove = triangleCount - targetIndexCount / 3;
+                size_t removed = 0;
+                for (const Collapse& collapse : collapses) {
+                    if (removed >= trianglesToRemove) {
+                        break;
+                    }
+                    uint32_t from = collapse.from;
+                    uint32_t to = remap[collapse.to];
+                    if (touched[from] || touched[to] || flipsTriangles(from, collapse.to)) {
+                        continue;
+                    }
+
+                    // Triangles sharing the edge degenerate and drop out
+                    for (uint32_t i = triangleOffsets[from]; i < triangleOffsets[from + 1]; ++i) {
+                        size_t t = static_cast<size_t>(vertexTriangles[i]) * 3;
+                        for (int k = 0; k < 3; ++k) {
+                            if (remap[collapseRemap[outIndices[t + k]]] == to) {
+                                removed++;
+                                break;
+                            }
+                        }
+                    }
+
+                    collapseRemap[from] = collapse.to;
+                    quadrics[to].Add(quadrics[from]);
+                    touched[from] = 1;
+                    touched[to] = 1;
+                    resultError = std::max(resultError, collapse.error);
+                }
+                if (removed == 0) {
+                    break;
+                }
+
+                size_t write = 0;
+                for (size_t t = 0; t < outIndices.size(); t += 3) {
+                    uint32_t a = collapseRemap[outIndices[t]];
+                    uint32_t b = collapseRemap[outIndices[t + 1]];
+                    uint32_t c = collapseRemap[outIndices[t + 2]];
+                    if (remap[a] == remap[b] || remap[b] == remap[c] || remap[a] == remap[c]) {
+                        continue;
+                    }
+                    outIndices[write++] = a;
+                    outIndices[write++] = b;
+                    outIndices[write++] = c;
+                }
+                outIndices.resize(write);
+            }
+
+            return static_cast<float>(std::sqrt(resultError) / radius);
+        }
+
+        bool MeshSimplifier::GenerateLods(MeshLoader::LoadResult& mesh, uint32_t levels, float ratio, float maxError) {
+            const VertexAttribute* position = mesh.vertexFormat.GetAttribute(VertexAttributeType::Position);
+            if (!position || position->encoding != VertexAttributeEncoding::Float || mesh.mappedFile ||
+                mesh.indices.size() != mesh.indexCount || mesh.indexCount % 3 != 0) {
+                std::cerr << "MeshSimplifier::GenerateLods: Needs an in-memory triangle list with float positions" << std::endl;
+                return false;
+            }
+
+            std::vector<uint32_t> lod0(mesh.indices.begin(), mesh.indices.begin() + mesh.indexCount);
+            std::vector<uint32_t> allIndices = lod0;
+            mesh.lods.clear();
+            mesh.lods.push_back({ 0, mesh.indexCount, 0.0f });
+
+            uint32_t vertexStride = mesh.vertexFormat.GetStride();
+            size_t previousCount = lod0.size();
+            float previousError = 0.0f;
+            double target = static_cast<double>(lod0.size() / 3);
+            for (uint32_t level = 1; level <= levels; ++level) {
+                target *= ratio;
+                size_t targetIndexCount = static_cast<size_t>(target) * 3;
+                if (targetIndexCount == 0) {
+                    break;
+                }
+
+                // Always from LOD 0, so the error is measured against the original surface
+                std::vector<uint32_t> lod;
+                float error = Simplify(lod0, mesh.vertexData.data(), mesh.vertexCount, vertexStride, position->offset,
+                                       targetIndexCount, maxError, lod);
+
+                // Not worth a level unless it drops at least 10% of the previous one
+                if (lod.empty() || lod.size() * 10 > previousCount * 9) {
+                    break;
+                }
+
+                MeshOptimizer::OptimizeVertexCache(lod, mesh.vertexCount);
+                previousError = std::max(previousError, error);
+                mesh.lods.push_back({ static_cast<uint32_t>(allIndices.size()), static_cast<uint32_t>(lod.size()), previousError });
+                allIndices.insert(allIndices.end(), lod.begin(), lod.end());
+                previousCount = lod.size();
+            }
+
+            mesh.indices = std::move(allIndices);
+            mesh.indexCount = static_cast<uint32_t>(mesh.indices.size());
+            return true;
+        }
+
+    } // namespace Resources
+} // namespace FirstEngine
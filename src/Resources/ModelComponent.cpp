@@ -4,6 +4,7 @@
 #include "FirstEngine/Resources/Scene.h"
 #include "FirstEngine/Resources/MeshResource.h"
 #include "FirstEngine/Resources/MaterialResource.h"
+#include "FirstEngine/Resources/VertexShaderMatcher.h"
 #include "FirstEngine/Renderer/RenderBatch.h"
 #include "FirstEngine/Renderer/RenderFlags.h"
 #include "FirstEngine/Renderer/RenderGeometry.h"
@@ -12,6 +13,8 @@
 #include "FirstEngine/RHI/Types.h"
 #include "FirstEngine/RHI/IImage.h"
 #include <glm/glm.hpp>
+#include <algorithm>
+#include <iostream>
 #include <memory>
 #include <vector>
 #if __has_include(<filesystem>)
@@ -63,6 +66,13 @@ namespace FirstEngine {
                 return AABB();
             }
 
+            // Loaded meshes carry their bounds (positions may be stored quantized)
+            if (auto* meshResource = dynamic_cast<MeshResource*>(mesh)) {
+                if (meshResource->GetVertexFormat().GetAttributeCount() > 0) {
+                    return AABB(meshResource->GetBoundsMin(), meshResource->GetBoundsMax());
+                }
+            }
+
             // Calculate bounds from mesh data
             const void* vertexData = mesh->GetVertexData();
             if (!vertexData) {
@@ -220,6 +230,18 @@ namespace FirstEngine {
             item->geometryData.firstVertex = geometryData.firstVertex;
             item->geometryData.vertexBufferOffset = 0;
             item->geometryData.indexBufferOffset = 0;
+            item->geometryData.indexIs32Bit = geometryData.indexSize == sizeof(uint32_t);
+
+            // LOD table and bounding sphere for LOD selection (SceneRenderer)
+            uint32_t lodCount = std::min(geometryData.lodCount, Renderer::RenderItem::GeometryData::kMaxLods);
+            for (uint32_t i = 0; i < lodCount; ++i) {
+                item->geometryData.lods[i].firstIndex = geometryData.lods[i].firstIndex;
+                item->geometryData.lods[i].indexCount = geometryData.lods[i].indexCount;
+                item->geometryData.lods[i].error = geometryData.lods[i].error;
+            }
+            item->geometryData.lodCount = lodCount;
+            item->geometryData.boundsCenter = 0.5f * (meshResource->GetBoundsMin() + meshResource->GetBoundsMax());
+            item->geometryData.boundsRadius = 0.5f * glm::length(meshResource->GetBoundsMax() - meshResource->GetBoundsMin());
 
             // Get ShadingMaterial from Component (owned by Component, not MaterialResource)
             if (m_ShadingMaterial && m_ShadingMaterial->IsCreated()) {
@@ -304,6 +326,21 @@ namespace FirstEngine {
                 }
             }
             
+            // Quantized meshes aren't laid out like the shader's float inputs; build the pipeline's vertex
+            // formats from the mesh instead
+            auto* meshResource = dynamic_cast<MeshResource*>(m_Model ? m_Model->GetMesh(0) : nullptr);
+            if (meshResource && meshResource->GetVertexFormat().IsQuantized()) {
+                const VertexFormat& vertexFormat = meshResource->GetVertexFormat();
+                std::vector<RHI::VertexInputAttribute> attributes;
+                VertexShaderMatcher::MatchResult match;
+                if (VertexShaderMatcher::BuildVertexInputs(vertexFormat, m_ShadingMaterial->GetShaderReflection(),
+                                                           attributes, &match)) {
+                    m_ShadingMaterial->SetVertexLayout(vertexFormat.GetStride(), attributes);
+                } else {
+                    std::cerr << "ModelComponent: " << match.errorMessage << std::endl;
+                }
+            }
+
             // Schedule creation (will be processed in OnCreateResources)
             m_ShadingMaterial->ScheduleCreate();
             
@@ -58,7 +58,7 @@ namespace FirstEngine {
             // Parse XML file
             ResourceXMLParser parser;
             try {
-                if (!parser.ParseFromFile(xmlFilePath)) {
+                if (!resourceManager.ParseDescriptor(xmlFilePath, parser)) {
                     std::cerr << "ModelLoader::Load: Failed to parse XML file: " << xmlFilePath << " for model ID " << id << std::endl;
                     return result;
                 }
@@ -0,0 +1,365 @@
+#include "FirstEngine/Resources/PackageArchive.h"
+#include "FirstEngine/Resources/LZCodec.h"
+#include <algorithm>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <unordered_set>
+#if __has_include(<filesystem>)
+#include <filesystem>
+namespace fs = std::filesystem;
+#else
+#include <experimental/filesystem>
+namespace fs = std::experimental::filesystem;
+#endif
+
+namespace FirstEngine {
+    namespace Resources {
+
+        namespace {
+            char FoldPathChar(char c) {
+                if (c == '\\') {
+                    return '/';
+                }
+                return (c >= 'A' && c <= 'Z') ? static_cast<char>(c - 'A' + 'a') : c;
+            }
+
+            uint64_t AlignUp(uint64_t value) {
+                return (value + PackageArchiveFormat::kAlignment - 1) & ~(PackageArchiveFormat::kAlignment - 1);
+            }
+
+            // Removes a partially written file unless Commit() was called
+            struct TempFileGuard {
+                explicit TempFileGuard(std::string filePath) : path(std::move(filePath)) {}
+                ~TempFileGuard() {
+                    if (!committed) {
+                        std::error_code error;
+                        fs::remove(path, error);
+                    }
+                }
+                void Commit() { committed = true; }
+
+                std::string path;
+                bool committed = false;
+            };
+        }
+
+        uint64_t PackageArchive::HashPath(const char* path, size_t length) {
+            uint64_t hash = 14695981039346656037ull;
+            for (size_t i = 0; i < length; ++i) {
+                hash ^= static_cast<uint8_t>(FoldPathChar(path[i]));
+                hash *= 1099511628211ull;
+            }
+            return hash;
+        }
+
+        bool PackageArchive::Open(const std::string& archivePath) {
+            Close();
+
+            auto file = std::make_shared<MappedFile>();
+            if (!file->Open(archivePath)) {
+                return false;
+            }
+
+            const uint8_t* data = file->GetData();
+            uint64_t size = file->GetSize();
+            auto fail = [&archivePath](const char* reason) {
+                std::cerr << "PackageArchive::Open: " << archivePath << ": " << reason << std::endl;
+                return false;
+            };
+            auto inRange = [size](uint64_t offset, uint64_t bytes) {
+                return offset <= size && bytes <= size - offset;
+            };
+
+            if (size < sizeof(PackageArchiveHeader)) {
+                return fail("File too small");
+            }
+            const auto* header = reinterpret_cast<const PackageArchiveHeader*>(data);
+            if (header->magic != PackageArchiveFormat::kMagic) {
+                return fail("Not a package archive");
+            }
+            if (header->version != PackageArchiveFormat::kVersion) {
+                return fail("Unsupported version, re-pack the package");
+            }
+            if (header->fileSize != size || header->idCount > header->entryCount ||
+                header->tocOffset % PackageArchiveFormat::kAlignment != 0 ||
+                !inRange(header->tocOffset, static_cast<uint64_t>(header->entryCount) * sizeof(PackageArchiveEntry)) ||
+                header->idIndexOffset % sizeof(uint32_t) != 0 ||
+                !inRange(header->idIndexOffset, static_cast<uint64_t>(header->idCount) * sizeof(uint32_t)) ||
+                header->pathIndexOffset % sizeof(uint32_t) != 0 ||
+                !inRange(header->pathIndexOffset, static_cast<uint64_t>(header->entryCount) * sizeof(uint32_t)) ||
+                !inRange(header->pathsOffset, header->pathsSize)) {
+                return fail("Truncated or corrupt");
+            }
+
+            const auto* entries = reinterpret_cast<const PackageArchiveEntry*>(data + header->tocOffset);
+            const auto* idIndex = reinterpret_cast<const uint32_t*>(data + header->idIndexOffset);
+            const auto* pathIndex = reinterpret_cast<const uint32_t*>(data + header->pathIndexOffset);
+            for (uint32_t i = 0; i < header->entryCount; ++i) {
+                const PackageArchiveEntry& entry = entries[i];
+                bool stored = entry.compression == static_cast<uint32_t>(PackageCompression::None);
+                if (entry.offset % PackageArchiveFormat::kAlignment != 0 || !inRange(entry.offset, entry.storedSize) ||
+                    entry.offset + entry.storedSize > header->tocOffset ||
+                    static_cast<uint64_t>(entry.pathOffset) + entry.pathLength > header->pathsSize ||
+                    (stored && entry.storedSize != entry.size) ||
+                    (!stored && entry.compression != static_cast<uint32_t>(PackageCompression::LZ)) ||
+                    pathIndex[i] >= header->entryCount ||
+                    (i < header->idCount && idIndex[i] >= header->entryCount)) {
+                    return fail("Corrupt table of contents");
+                }
+            }
+
+            m_Path = archivePath;
+            m_File = std::move(file);
+            m_Header = header;
+            m_Entries = entries;
+            m_IDIndex = idIndex;
+            m_PathIndex = pathIndex;
+            m_Paths = reinterpret_cast<const char*>(data + header->pathsOffset);
+            return true;
+        }
+
+        void PackageArchive::Close() {
+            m_Header = nullptr;
+            m_Entries = nullptr;
+            m_IDIndex = nullptr;
+            m_PathIndex = nullptr;
+            m_Paths = nullptr;
+            m_File.reset();
+            m_Path.clear();
+        }
+
+        std::string PackageArchive::GetEntryPath(uint32_t index) const {
+            const PackageArchiveEntry& entry = m_Entries[index];
+            return std::string(m_Paths + entry.pathOffset, entry.pathLength);
+        }
+
+        bool PackageArchive::PathEquals(uint32_t index, const char* path, size_t length) const {
+            const PackageArchiveEntry& entry = m_Entries[index];
+            if (entry.pathLength != length) {
+                return false;
+            }
+            const char* stored = m_Paths + entry.pathOffset;
+            for (size_t i = 0; i < length; ++i) {
+                if (FoldPathChar(stored[i]) != FoldPathChar(path[i])) {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        uint32_t PackageArchive::FindPath(const std::string& path) const {
+            if (!m_Header) {
+                return kInvalidEntry;
+            }
+
+            uint64_t hash = HashPath(path.data(), path.size());
+            const uint32_t* end = m_PathIndex + m_Header->entryCount;
+            const uint32_t* it = std::lower_bound(m_PathIndex, end, hash, [this](uint32_t index, uint64_t value) {
+                return m_Entries[index].pathHash < value;
+            });
+            for (; it != end && m_Entries[*it].pathHash == hash; ++it) {
+                if (PathEquals(*it, path.data(), path.size())) {
+                    return *it;
+                }
+            }
+            return kInvalidEntry;
+        }
+
+        uint32_t PackageArchive::FindResource(ResourceID id) const {
+            if (!m_Header || id == InvalidResourceID) {
+                return kInvalidEntry;
+            }
+
+            const uint32_t* end = m_IDIndex + m_Header->idCount;
+            const uint32_t* it = std::lower_bound(m_IDIndex, end, id, [this](uint32_t index, ResourceID value) {
+                return m_Entries[index].resourceID < value;
+            });
+            return (it != end && m_Entries[*it].resourceID == id) ? *it : kInvalidEntry;
+        }
+
+        std::shared_ptr<MappedFile> PackageArchive::OpenEntry(uint32_t index) const {
+            if (!m_Header || index >= m_Header->entryCount) {
+                return nullptr;
+            }
+
+            const PackageArchiveEntry& entry = m_Entries[index];
+            auto file = std::make_shared<MappedFile>();
+            if (entry.compression == static_cast<uint32_t>(PackageCompression::None)) {
+                if (!file->OpenView(m_File, entry.offset, entry.size)) {
+                    return nullptr;
+                }
+                return file;
+            }
+
+            std::vector<uint8_t> bytes(static_cast<size_t>(entry.size));
+            if (!LZCodec::Decompress(m_File->GetData() + entry.offset, static_cast<size_t>(entry.storedSize),
+                                     bytes.data(), bytes.size())) {
+                std::cerr << "PackageArchive::OpenEntry: " << m_Path << ": Corrupt entry " << GetEntryPath(index) << std::endl;
+                return nullptr;
+            }
+            if (!file->OpenBuffer(std::move(bytes))) {
+                return nullptr;
+            }
+            return file;
+        }
+
+        bool PackageArchive::Write(const std::string& archivePath, const std::vector<PackageArchiveFile>& files,
+                                   const PackageWriteOptions& options, WriteReport* report) {
+            // Packages are mounted automatically, so a failed or interrupted pack must never leave a truncated
+            // archive at archivePath: write a temp file and rename it once it is complete
+            // (the guard is declared first so the stream is closed before the temp file is removed)
+            TempFileGuard tempFile(archivePath + ".tmp");
+            std::ofstream file(tempFile.path, std::ios::binary | std::ios::trunc);
+            if (!file) {
+                std::cerr << "PackageArchive::Write: Failed to open " << tempFile.path << " for writing" << std::endl;
+                return false;
+            }
+
+            auto padTo = [&file](uint64_t target) {
+                static const char zeros[PackageArchiveFormat::kAlignment] = {};
+                uint64_t position = static_cast<uint64_t>(file.tellp());
+                if (target > position) {
+                    file.write(zeros, static_cast<std::streamsize>(target - position));
+                }
+            };
+
+            // Entries are streamed after a placeholder header, which is rewritten once the tables are placed
+            PackageArchiveHeader header = {};
+            file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+
+            WriteReport result;
+            std::vector<PackageArchiveEntry> entries;
+            entries.reserve(files.size());
+            std::string paths;
+            std::unordered_set<ResourceID> packedIDs;
+            uint64_t offset = AlignUp(sizeof(PackageArchiveHeader));
+            std::vector<uint8_t> compressed;
+
+            for (const PackageArchiveFile& source : files) {
+                std::ifstream input(source.sourcePath, std::ios::binary);
+                if (!input) {
+                    std::cerr << "PackageArchive::Write: Failed to open " << source.sourcePath << std::endl;
+                    return false;
+                }
+                std::vector<uint8_t> bytes((std::istreambuf_iterator<char>(input)), std::istreambuf_iterator<char>());
+                if (bytes.empty()) {
+                    // Entries are opened as mappings, and an empty mapping is an error
+                    std::cerr << "PackageArchive::Write: Skipping empty file " << source.sourcePath << std::endl;
+                    continue;
+                }
+                if (source.resourceID != InvalidResourceID && !packedIDs.insert(source.resourceID).second) {
+                    std::cerr << "PackageArchive::Write: Resource ID " << source.resourceID << " is packed twice ("
+                              << source.path << ")" << std::endl;
+                    return false;
+                }
+
+                PackageArchiveEntry entry = {};
+                entry.offset = offset;
+                entry.size = bytes.size();
+                entry.storedSize = bytes.size();
+                entry.pathHash = HashPath(source.path.data(), source.path.size());
+                entry.resourceID = source.resourceID;
+                entry.pathOffset = static_cast<uint32_t>(paths.size());
+                entry.pathLength = static_cast<uint32_t>(source.path.size());
+                entry.compression = static_cast<uint32_t>(PackageCompression::None);
+                paths += source.path;
+
+                const uint8_t* stored = bytes.data();
+                if (options.compress && source.allowCompression) {
+                    compressed.resize(LZCodec::GetMaxCompressedSize(bytes.size()));
+                    size_t compressedSize = LZCodec::Compress(bytes.data(), bytes.size(), compressed.data(), compressed.size());
+                    if (compressedSize > 0 && compressedSize <= static_cast<size_t>(bytes.size() * options.maxCompressedRatio)) {
+                        stored = compressed.data();
+                        entry.storedSize = compressedSize;
+                        entry.compression = static_cast<uint32_t>(PackageCompression::LZ);
+                        result.compressedCount++;
+                    }
+                }
+
+                padTo(entry.offset);
+                file.write(reinterpret_cast<const char*>(stored), static_cast<std::streamsize>(entry.storedSize));
+                offset = AlignUp(offset + entry.storedSize);
+                result.sourceBytes += entry.size;
+                entries.push_back(entry);
+            }
+
+            uint32_t entryCount = static_cast<uint32_t>(entries.size());
+            std::vector<uint32_t> idIndex;
+            std::vector<uint32_t> pathIndex(entryCount);
+            for (uint32_t i = 0; i < entryCount; ++i) {
+                pathIndex[i] = i;
+                if (entries[i].resourceID != InvalidResourceID) {
+                    idIndex.push_back(i);
+                }
+            }
+            std::sort(idIndex.begin(), idIndex.end(), [&entries](uint32_t a, uint32_t b) {
+                return entries[a].resourceID < entries[b].resourceID;
+            });
+
+            auto foldedPath = [&entries, &paths](uint32_t index) {
+                std::string path = paths.substr(entries[index].pathOffset, entries[index].pathLength);
+                std::transform(path.begin(), path.end(), path.begin(), FoldPathChar);
+                return path;
+            };
+            std::sort(pathIndex.begin(), pathIndex.end(), [&entries, &foldedPath](uint32_t a, uint32_t b) {
+                if (entries[a].pathHash != entries[b].pathHash) {
+                    return entries[a].pathHash < entries[b].pathHash;
+                }
+                return foldedPath(a) < foldedPath(b);
+            });
+            for (uint32_t i = 1; i < entryCount; ++i) {
+                if (entries[pathIndex[i]].pathHash == entries[pathIndex[i - 1]].pathHash &&
+                    foldedPath(pathIndex[i]) == foldedPath(pathIndex[i - 1])) {
+                    std::cerr << "PackageArchive::Write: " << foldedPath(pathIndex[i]) << " is packed twice" << std::endl;
+                    return false;
+                }
+            }
+
+            header.magic = PackageArchiveFormat::kMagic;
+            header.version = PackageArchiveFormat::kVersion;
+            header.entryCount = entryCount;
+            header.idCount = static_cast<uint32_t>(idIndex.size());
+            header.tocOffset = offset;
+            header.idIndexOffset = header.tocOffset + static_cast<uint64_t>(entryCount) * sizeof(PackageArchiveEntry);
+            header.pathIndexOffset = header.idIndexOffset + idIndex.size() * sizeof(uint32_t);
+            header.pathsOffset = header.pathIndexOffset + pathIndex.size() * sizeof(uint32_t);
+            header.pathsSize = paths.size();
+            header.fileSize = header.pathsOffset + header.pathsSize;
+
+            padTo(header.tocOffset);
+            file.write(reinterpret_cast<const char*>(entries.data()),
+                       static_cast<std::streamsize>(entries.size() * sizeof(PackageArchiveEntry)));
+            file.write(reinterpret_cast<const char*>(idIndex.data()),
+                       static_cast<std::streamsize>(idIndex.size() * sizeof(uint32_t)));
+            file.write(reinterpret_cast<const char*>(pathIndex.data()),
+                       static_cast<std::streamsize>(pathIndex.size() * sizeof(uint32_t)));
+            file.write(paths.data(), static_cast<std::streamsize>(paths.size()));
+            file.seekp(0);
+            file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+            file.close();
+
+            if (!file) {
+                std::cerr << "PackageArchive::Write: Failed to write " << tempFile.path << std::endl;
+                return false;
+            }
+
+            std::error_code error;
+            fs::rename(tempFile.path, archivePath, error);
+            if (error) {
+                std::cerr << "PackageArchive::Write: Failed to replace " << archivePath << " (" << error.message()
+                          << ")" << std::endl;
+                return false;
+            }
+            tempFile.Commit();
+
+            result.entryCount = entryCount;
+            result.archiveBytes = header.fileSize;
+            if (report) {
+                *report = result;
+            }
+            return true;
+        }
+
+    } // namespace Resources
+} // namespace FirstEngine
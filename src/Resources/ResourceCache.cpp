@@ -0,0 +1,193 @@
+#include "FirstEngine/Resources/ResourceCache.h"
+
+namespace FirstEngine {
+    namespace Resources {
+
+        ResourceCache::Shard& ResourceCache::GetShard(ResourceID id) const {
+            // IDs are often sequential; mix them so neighbours land in different shards
+            uint64_t mixed = static_cast<uint64_t>(id) * 0x9E3779B97F4A7C15ull;
+            return m_Shards[(mixed >> 32) % kShardCount];
+        }
+
+        bool ResourceCache::IsVisible(const Entry& entry) {
+            return entry.published || entry.loader == std::this_thread::get_id();
+        }
+
+        ResourceHandle ResourceCache::Find(ResourceID id) const {
+            Shard& shard = GetShard(id);
+            std::shared_lock<std::shared_mutex> lock(shard.mutex);
+            auto it = shard.entries.find(id);
+            if (it == shard.entries.end() || !IsVisible(it->second)) {
+                return ResourceHandle();
+            }
+            return it->second.handle;
+        }
+
+        bool ResourceCache::TryAcquire(ResourceID id, bool addRef, ResourceHandle& outHandle) {
+            Shard& shard = GetShard(id);
+            std::shared_lock<std::shared_mutex> lock(shard.mutex);
+            auto it = shard.entries.find(id);
+            if (it == shard.entries.end() || !IsVisible(it->second)) {
+                return false;
+            }
+            if (addRef) {
+                it->second.resource->AddRef();
+            }
+            outHandle = it->second.handle;
+            return true;
+        }
+
+        bool ResourceCache::Acquire(ResourceID id, bool addRef, ResourceHandle& outHandle) {
+            Shard& shard = GetShard(id);
+
+            // Fast path: already published, shared lock only
+            // AddRef happens under the lock so a concurrent Release can't delete the resource in between
+            {
+                std::shared_lock<std::shared_mutex> lock(shard.mutex);
+                auto it = shard.entries.find(id);
+                if (it == shard.entries.end()) {
+                    return false;
+                }
+                if (IsVisible(it->second)) {
+                    if (addRef) {
+                        it->second.resource->AddRef();
+                    }
+                    outHandle = it->second.handle;
+                    return true;
+                }
+            }
+
+            // Another thread is loading it: wait for Publish or Abandon
+            std::unique_lock<std::shared_mutex> lock(shard.mutex);
+            while (true) {
+                auto it = shard.entries.find(id);
+                if (it == shard.entries.end()) {
+                    return false;
+                }
+
+                Entry& entry = it->second;
+                if (IsVisible(entry) || !BeginWait(entry.loader)) {
+                    if (addRef) {
+                        entry.resource->AddRef();
+                    }
+                    outHandle = entry.handle;
+                    return true;
+                }
+
+                shard.publishedCondition.wait(lock);
+                EndWait();
+            }
+        }
+
+        bool ResourceCache::Claim(ResourceID id, ResourceType type, IResource* resource, ResourceHandle handle) {
+            Shard& shard = GetShard(id);
+            std::unique_lock<std::shared_mutex> lock(shard.mutex);
+
+            Entry entry;
+            entry.resource = resource;
+            entry.handle = handle;
+            entry.type = type;
+            entry.loader = std::this_thread::get_id();
+            return shard.entries.emplace(id, entry).second;
+        }
+
+        void ResourceCache::Publish(ResourceID id) {
+            Shard& shard = GetShard(id);
+            {
+                std::unique_lock<std::shared_mutex> lock(shard.mutex);
+                auto it = shard.entries.find(id);
+                if (it != shard.entries.end()) {
+                    it->second.published = true;
+                    it->second.loader = std::thread::id();
+                }
+            }
+            shard.publishedCondition.notify_all();
+        }
+
+        void ResourceCache::Abandon(ResourceID id) {
+            Shard& shard = GetShard(id);
+            {
+                std::unique_lock<std::shared_mutex> lock(shard.mutex);
+                shard.entries.erase(id);
+            }
+            shard.publishedCondition.notify_all();
+        }
+
+        IResource* ResourceCache::Release(ResourceID id, bool evictUnreferenced) {
+            Shard& shard = GetShard(id);
+            std::unique_lock<std::shared_mutex> lock(shard.mutex);
+            auto it = shard.entries.find(id);
+            if (it == shard.entries.end() || !it->second.published) {
+                return nullptr;
+            }
+
+            // Prefetched resources are cached without references; an Unload that nobody took one for must not
+            // wrap the count around
+            IResource* resource = it->second.resource;
+            if (resource->GetRefCount() == 0) {
+                return nullptr;
+            }
+            resource->Release();
+            if (resource->GetRefCount() != 0 || !evictUnreferenced) {
+                return nullptr;
+            }
+            shard.entries.erase(it);
+            return resource;
+        }
+
+        std::vector<IResource*> ResourceCache::TakeAll() {
+            std::vector<IResource*> resources;
+            for (Shard& shard : m_Shards) {
+                {
+                    std::unique_lock<std::shared_mutex> lock(shard.mutex);
+                    for (auto& pair : shard.entries) {
+                        resources.push_back(pair.second.resource);
+                    }
+                    shard.entries.clear();
+                }
+                shard.publishedCondition.notify_all();
+            }
+            return resources;
+        }
+
+        size_t ResourceCache::GetCount(ResourceType type) const {
+            size_t count = 0;
+            for (const Shard& shard : m_Shards) {
+                std::shared_lock<std::shared_mutex> lock(shard.mutex);
+                for (const auto& pair : shard.entries) {
+                    if (pair.second.type == type) {
+                        count++;
+                    }
+                }
+            }
+            return count;
+        }
+
+        bool ResourceCache::BeginWait(std::thread::id loader) {
+            std::lock_guard<std::mutex> lock(m_WaitMutex);
+            std::thread::id self = std::this_thread::get_id();
+
+            // Follow the chain of waits starting at the loader; reaching ourselves means a cycle
+            std::thread::id current = loader;
+            for (size_t steps = 0; steps <= m_WaitingFor.size(); ++steps) {
+                if (current == self) {
+                    return false;
+                }
+                auto it = m_WaitingFor.find(current);
+                if (it == m_WaitingFor.end()) {
+                    break;
+                }
+                current = it->second;
+            }
+
+            m_WaitingFor[self] = loader;
+            return true;
+        }
+
+        void ResourceCache::EndWait() {
+            std::lock_guard<std::mutex> lock(m_WaitMutex);
+            m_WaitingFor.erase(std::this_thread::get_id());
+        }
+
+    } // namespace Resources
+} // namespace FirstEngine
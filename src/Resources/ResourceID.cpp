@@ -1,4 +1,5 @@
 #include "FirstEngine/Resources/ResourceID.h"
+#include "FirstEngine/Resources/CompiledManifest.h"
 #include "FirstEngine/Resources/ResourceTypes.h"
 #include "FirstEngine/Resources/ResourceDependency.h"
 #include <algorithm>
@@ -35,21 +36,29 @@ namespace FirstEngine {
         }
 
         ResourceID ResourceIDManager::RegisterResource(const std::string& filepath, ResourceType type, const std::string& virtualPath) {
-            std::string normalized = NormalizePath(filepath);
-            
             // Check if already registered
-            auto it = m_PathToID.find(normalized);
-            if (it != m_PathToID.end()) {
-                return it->second;
+            ResourceID existing = GetIDFromPath(filepath);
+            if (existing != InvalidResourceID) {
+                return existing;
             }
 
-            // Generate new ID and register
-            ResourceID id = GenerateID();
-            m_IDToPath[id] = filepath; // Store original path
-            
+            std::string normalized = NormalizePath(filepath);
+
             // Set virtual path (use filepath if not provided)
             std::string vpath = virtualPath.empty() ? filepath : virtualPath;
             std::string normalizedVPath = NormalizePath(vpath);
+
+            // A virtual path names one resource; a second owner would make lookups ambiguous and the
+            // manifest unsaveable
+            if (GetIDFromVirtualPath(vpath) != InvalidResourceID) {
+                std::cerr << "ResourceIDManager::RegisterResource: Virtual path " << vpath
+                          << " is already registered to another resource, not registering " << filepath << std::endl;
+                return InvalidResourceID;
+            }
+
+            // Generate new ID and register
+            ResourceID id = GenerateID();
+            m_IDToPath[id] = filepath; // Store original path
             m_IDToVirtualPath[id] = vpath;
             m_VirtualPathToID[normalizedVPath] = id;
             
@@ -65,14 +74,15 @@ namespace FirstEngine {
             }
 
             // Check if ID already exists
-            if (m_IDToPath.find(id) != m_IDToPath.end()) {
+            if (IsRegistered(id)) {
                 return false; // ID already registered
             }
 
             std::string normalized = NormalizePath(filepath);
             
             // Check if path already registered with different ID
-            if (m_PathToID.find(normalized) != m_PathToID.end()) {
+            if (m_PathToID.find(normalized) != m_PathToID.end() ||
+                (m_Compiled && m_Compiled->FindPath(filepath) != CompiledManifest::kInvalidEntry)) {
                 return false; // Path already registered
             }
 
@@ -81,7 +91,8 @@ namespace FirstEngine {
             std::string normalizedVPath = NormalizePath(vpath);
             
             // Check if virtual path already registered with different ID
-            if (m_VirtualPathToID.find(normalizedVPath) != m_VirtualPathToID.end()) {
+            if (m_VirtualPathToID.find(normalizedVPath) != m_VirtualPathToID.end() ||
+                (m_Compiled && m_Compiled->FindVirtualPath(vpath) != CompiledManifest::kInvalidEntry)) {
                 return false; // Virtual path already registered
             }
 
@@ -102,20 +113,40 @@ namespace FirstEngine {
         }
 
         ResourceID ResourceIDManager::GetIDFromPath(const std::string& filepath) const {
+            if (m_Compiled) {
+                uint32_t entry = m_Compiled->FindPath(filepath);
+                if (entry != CompiledManifest::kInvalidEntry) {
+                    return m_Compiled->GetID(entry);
+                }
+            }
+            if (m_PathToID.empty()) {
+                return InvalidResourceID;
+            }
             std::string normalized = NormalizePath(filepath);
             auto it = m_PathToID.find(normalized);
             return (it != m_PathToID.end()) ? it->second : InvalidResourceID;
         }
 
         std::string ResourceIDManager::GetPathFromID(ResourceID id) const {
+            if (m_Compiled) {
+                uint32_t entry = m_Compiled->FindID(id);
+                if (entry != CompiledManifest::kInvalidEntry) {
+                    return m_Compiled->GetPath(entry);
+                }
+            }
             auto it = m_IDToPath.find(id);
             if (it == m_IDToPath.end()) {
+                uint32_t compiledCount = m_Compiled ? m_Compiled->GetEntryCount() : 0;
                 std::cerr << "ResourceIDManager::GetPathFromID: Resource ID " << id << " not found in manifest." << std::endl;
-                std::cerr << "  Total registered resources: " << m_IDToPath.size() << std::endl;
-                if (m_IDToPath.size() > 0) {
-                    // Find min and max IDs
+                std::cerr << "  Total registered resources: " << m_IDToPath.size() + compiledCount << std::endl;
+                if (m_IDToPath.size() + compiledCount > 0) {
+                    // Find min and max IDs (compiled entries are sorted)
                     ResourceID minID = std::numeric_limits<ResourceID>::max();
                     ResourceID maxID = 0;
+                    if (compiledCount > 0) {
+                        minID = m_Compiled->GetID(0);
+                        maxID = m_Compiled->GetID(compiledCount - 1);
+                    }
                     for (const auto& pair : m_IDToPath) {
                         if (pair.first < minID) minID = pair.first;
                         if (pair.first > maxID) maxID = pair.first;
@@ -128,12 +159,27 @@ namespace FirstEngine {
         }
 
         ResourceID ResourceIDManager::GetIDFromVirtualPath(const std::string& virtualPath) const {
+            if (m_Compiled) {
+                uint32_t entry = m_Compiled->FindVirtualPath(virtualPath);
+                if (entry != CompiledManifest::kInvalidEntry) {
+                    return m_Compiled->GetID(entry);
+                }
+            }
+            if (m_VirtualPathToID.empty()) {
+                return InvalidResourceID;
+            }
             std::string normalized = NormalizePath(virtualPath);
             auto it = m_VirtualPathToID.find(normalized);
             return (it != m_VirtualPathToID.end()) ? it->second : InvalidResourceID;
         }
 
         std::string ResourceIDManager::GetVirtualPathFromID(ResourceID id) const {
+            if (m_Compiled) {
+                uint32_t entry = m_Compiled->FindID(id);
+                if (entry != CompiledManifest::kInvalidEntry) {
+                    return m_Compiled->GetVirtualPath(entry);
+                }
+            }
             auto it = m_IDToVirtualPath.find(id);
             return (it != m_IDToVirtualPath.end()) ? it->second : std::string();
         }
@@ -147,25 +193,33 @@ namespace FirstEngine {
         }
 
         bool ResourceIDManager::IsVirtualPathRegistered(const std::string& virtualPath) const {
-            std::string normalized = NormalizePath(virtualPath);
-            return m_VirtualPathToID.find(normalized) != m_VirtualPathToID.end();
+            return GetIDFromVirtualPath(virtualPath) != InvalidResourceID;
         }
 
         ResourceType ResourceIDManager::GetTypeFromID(ResourceID id) const {
+            if (m_Compiled) {
+                uint32_t entry = m_Compiled->FindID(id);
+                if (entry != CompiledManifest::kInvalidEntry) {
+                    return m_Compiled->GetType(entry);
+                }
+            }
             auto it = m_IDToType.find(id);
             return (it != m_IDToType.end()) ? it->second : ResourceType::Unknown;
         }
 
         bool ResourceIDManager::IsRegistered(ResourceID id) const {
+            if (m_Compiled && m_Compiled->FindID(id) != CompiledManifest::kInvalidEntry) {
+                return true;
+            }
             return m_IDToPath.find(id) != m_IDToPath.end();
         }
 
         bool ResourceIDManager::IsPathRegistered(const std::string& filepath) const {
-            std::string normalized = NormalizePath(filepath);
-            return m_PathToID.find(normalized) != m_PathToID.end();
+            return GetIDFromPath(filepath) != InvalidResourceID;
         }
 
         void ResourceIDManager::Clear() {
+            m_Compiled.reset();
             m_IDToPath.clear();
             m_IDToVirtualPath.clear();
             m_PathToID.clear();
@@ -176,6 +230,12 @@ namespace FirstEngine {
 
         std::vector<ResourceID> ResourceIDManager::GetIDsByType(ResourceType type) const {
             std::vector<ResourceID> result;
+            uint32_t compiledCount = m_Compiled ? m_Compiled->GetEntryCount() : 0;
+            for (uint32_t i = 0; i < compiledCount; ++i) {
+                if (m_Compiled->GetType(i) == type) {
+                    result.push_back(m_Compiled->GetID(i));
+                }
+            }
             for (const auto& pair : m_IDToType) {
                 if (pair.second == type) {
                     result.push_back(pair.first);
@@ -229,6 +289,64 @@ namespace FirstEngine {
             return ResourceType::Unknown;
         }
 
+        void ResourceIDManager::CollectResources(std::vector<CompiledManifestResource>& resources) const {
+            uint32_t compiledCount = m_Compiled ? m_Compiled->GetEntryCount() : 0;
+            resources.reserve(compiledCount + m_IDToPath.size());
+            for (uint32_t i = 0; i < compiledCount; ++i) {
+                CompiledManifestResource resource;
+                resource.id = m_Compiled->GetID(i);
+                resource.path = m_Compiled->GetPath(i);
+                resource.virtualPath = m_Compiled->GetVirtualPath(i);
+                resource.type = m_Compiled->GetType(i);
+                resources.push_back(std::move(resource));
+            }
+            for (const auto& pair : m_IDToPath) {
+                CompiledManifestResource resource;
+                resource.id = pair.first;
+                resource.path = pair.second;
+
+                auto typeIt = m_IDToType.find(pair.first);
+                resource.type = (typeIt != m_IDToType.end()) ? typeIt->second : ResourceType::Unknown;
+
+                auto virtualPathIt = m_IDToVirtualPath.find(pair.first);
+                resource.virtualPath = (virtualPathIt != m_IDToVirtualPath.end()) ? virtualPathIt->second : pair.second;
+                resources.push_back(std::move(resource));
+            }
+        }
+
+        std::string ResourceIDManager::GetCompiledManifestPath(const std::string& manifestPath) {
+            return fs::path(manifestPath).replace_extension(CompiledManifestFormat::kExtension).string();
+        }
+
+        bool ResourceIDManager::SaveCompiledManifest(const std::string& compiledPath) const {
+            std::vector<CompiledManifestResource> resources;
+            CollectResources(resources);
+            return CompiledManifest::Write(compiledPath, std::move(resources), m_NextID);
+        }
+
+        bool ResourceIDManager::LoadCompiledManifest(const std::string& compiledPath) {
+            auto file = std::make_shared<MappedFile>();
+            if (!file->Open(compiledPath)) {
+                return false;
+            }
+            return LoadCompiledManifest(std::move(file), compiledPath);
+        }
+
+        bool ResourceIDManager::LoadCompiledManifest(std::shared_ptr<MappedFile> file, const std::string& name) {
+            Clear();
+
+            auto compiled = std::make_unique<CompiledManifest>();
+            if (!compiled->Open(std::move(file), name)) {
+                return false;
+            }
+            m_NextID = compiled->GetNextID();
+            m_Compiled = std::move(compiled);
+
+            std::cout << "ResourceIDManager::LoadCompiledManifest: Mapped " << m_Compiled->GetEntryCount()
+                      << " resources from " << name << std::endl;
+            return true;
+        }
+
         bool ResourceIDManager::SaveManifest(const std::string& manifestPath) const {
             try {
                 // Create directory if it doesn't exist
@@ -249,16 +367,14 @@ namespace FirstEngine {
                 file << "  \"resources\": [\n";
 
                 // Write all resource entries
+                std::vector<CompiledManifestResource> resources;
+                CollectResources(resources);
                 bool first = true;
-                for (const auto& pair : m_IDToPath) {
-                    ResourceID id = pair.first;
-                    const std::string& path = pair.second;
-                    
-                    auto typeIt = m_IDToType.find(id);
-                    ResourceType type = (typeIt != m_IDToType.end()) ? typeIt->second : ResourceType::Unknown;
-                    
-                    auto virtualPathIt = m_IDToVirtualPath.find(id);
-                    const std::string& virtualPath = (virtualPathIt != m_IDToVirtualPath.end()) ? virtualPathIt->second : path;
+                for (const CompiledManifestResource& resource : resources) {
+                    ResourceID id = resource.id;
+                    const std::string& path = resource.path;
+                    ResourceType type = resource.type;
+                    const std::string& virtualPath = resource.virtualPath;
 
                     if (!first) {
                         file << ",\n";
@@ -277,6 +393,19 @@ namespace FirstEngine {
                 file << "}\n";
 
                 file.close();
+                if (!file) {
+                    return false;
+                }
+
+                // Written after the JSON so it is never older than it. The JSON is the source of truth: if the
+                // compiled manifest can't be written, drop any stale one so the next load parses the JSON
+                std::string compiledPath = GetCompiledManifestPath(manifestPath);
+                if (!CompiledManifest::Write(compiledPath, std::move(resources), m_NextID)) {
+                    std::cerr << "ResourceIDManager::SaveManifest: Failed to write compiled manifest " << compiledPath
+                              << ", loads will use " << manifestPath << std::endl;
+                    std::error_code error;
+                    fs::remove(compiledPath, error);
+                }
                 return true;
             } catch (...) {
                 return false;
@@ -284,20 +413,33 @@ namespace FirstEngine {
         }
 
         bool ResourceIDManager::LoadManifest(const std::string& manifestPath) {
-            try {
-                std::ifstream file(manifestPath, std::ios::in);
-                if (!file.is_open()) {
-                    std::cerr << "ResourceIDManager::LoadManifest: Failed to open manifest file: " << manifestPath << std::endl;
-                    return false;
-                }
-                
-                std::cout << "ResourceIDManager::LoadManifest: Loading manifest from: " << manifestPath << std::endl;
+            // The compiled manifest is rewritten with every save; an older one means the JSON was edited by hand
+            std::string compiledPath = GetCompiledManifestPath(manifestPath);
+            std::error_code error;
+            if (fs::exists(compiledPath, error) &&
+                fs::last_write_time(compiledPath, error) >= fs::last_write_time(manifestPath, error) &&
+                LoadCompiledManifest(compiledPath)) {
+                return true;
+            }
 
-                // Read entire file into string
-                std::string content((std::istreambuf_iterator<char>(file)),
-                                    std::istreambuf_iterator<char>());
-                file.close();
+            std::ifstream file(manifestPath, std::ios::in);
+            if (!file.is_open()) {
+                std::cerr << "ResourceIDManager::LoadManifest: Failed to open manifest file: " << manifestPath << std::endl;
+                return false;
+            }
+
+            std::cout << "ResourceIDManager::LoadManifest: Loading manifest from: " << manifestPath << std::endl;
 
+            // Read entire file into string
+            std::string content((std::istreambuf_iterator<char>(file)),
+                                std::istreambuf_iterator<char>());
+            file.close();
+
+            return LoadManifestFromString(content);
+        }
+
+        bool ResourceIDManager::LoadManifestFromString(const std::string& content) {
+            try {
                 // Simple JSON parser (handles the specific format we generate)
                 // This is a basic parser - for production use, consider a proper JSON library
                 
@@ -331,6 +473,7 @@ namespace FirstEngine {
                     size_t arrayStart = content.find('[', resourcesPos);
                     if (arrayStart != std::string::npos) {
                         size_t pos = arrayStart + 1;
+                        size_t arrayEnd = content.find(']', arrayStart);
                         
                         while (pos < content.length()) {
                             // Find next resource object
@@ -433,7 +576,7 @@ namespace FirstEngine {
                             
                             // Check if there are more objects
                             size_t nextObj = content.find('{', pos);
-                            if (nextObj == std::string::npos || nextObj > content.find(']', arrayStart)) {
+                            if (nextObj == std::string::npos || nextObj > arrayEnd) {
                                 break;
                             }
                         }
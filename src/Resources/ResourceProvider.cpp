@@ -6,6 +6,11 @@
 #include "FirstEngine/Resources/TextureResource.h"
 #include "FirstEngine/Resources/MeshResource.h"
 #include "FirstEngine/Resources/ModelResource.h"
+#include "FirstEngine/Resources/ResourceXMLParser.h"
+#include "FirstEngine/Resources/MappedFile.h"
+#include "FirstEngine/Resources/PackageArchive.h"
+#include "FirstEngine/Core/ThreadManager.h"
+#include <shared_mutex>
 #include <algorithm>
 #include <string>
 #include <vector>
@@ -23,6 +28,27 @@ namespace fs = std::experimental::filesystem;
 namespace FirstEngine {
     namespace Resources {
 
+        namespace {
+            // XML descriptor of a resource (the same file its loader parses before reading the payload)
+            std::string GetDescriptorPath(const std::string& resolvedPath) {
+                std::string ext = fs::path(resolvedPath).extension().string();
+                std::transform(ext.begin(), ext.end(), ext.begin(), ::tolower);
+                if (ext == ".xml" || ext == ".mesh" || ext == ".tex" || ext == ".mat") {
+                    return resolvedPath;
+                }
+                return fs::path(resolvedPath).replace_extension(".xml").string();
+            }
+
+            std::shared_ptr<AsyncResourceLoad> MakePublishedLoad(ResourceID id, ResourceHandle handle) {
+                auto load = std::make_shared<AsyncResourceLoad>();
+                load->id = id;
+                load->handle = handle;
+                load->decoded = true;
+                load->published.store(true, std::memory_order_release);
+                return load;
+            }
+        }
+
         // Singleton instance
         std::unique_ptr<ResourceManager> ResourceManager::s_Instance = nullptr;
 
@@ -42,6 +68,8 @@ namespace FirstEngine {
 
         void ResourceManager::Shutdown() {
             if (s_Instance) {
+                // Loader threads write into the caches, so let them finish first
+                s_Instance->WaitForAsyncLoads();
                 s_Instance->Clear();
                 s_Instance.reset();
             }
@@ -100,6 +128,14 @@ namespace FirstEngine {
                 return path;
             }
 
+            // Packed package: answered from the archive's table of contents instead of probing the disk
+            if (m_Archive) {
+                std::string archived = ResolveArchivePath(path, basePath);
+                if (!archived.empty()) {
+                    return archived;
+                }
+            }
+
             // If path is absolute, return as-is
             if (ResourcePathResolver::IsAbsolutePath(path)) {
                 return ResourcePathResolver::NormalizePath(path);
@@ -126,6 +162,91 @@ namespace FirstEngine {
             return ResourcePathResolver::NormalizePath(path);
         }
 
+        bool ResourceManager::MountArchive(const std::string& archivePath, const std::string& packageRoot) {
+            auto archive = std::make_unique<PackageArchive>();
+            if (!archive->Open(archivePath)) {
+                return false;
+            }
+
+            std::string root = fs::absolute(fs::path(packageRoot)).lexically_normal().generic_string();
+            if (root.empty() || root.back() != '/') {
+                root += '/';
+            }
+
+            m_Archive = std::move(archive);
+            m_ArchiveRoot = root;
+            std::cout << "ResourceManager: Mounted " << archivePath << " (" << m_Archive->GetEntryCount()
+                      << " files) at " << m_ArchiveRoot << std::endl;
+            return true;
+        }
+
+        void ResourceManager::UnmountArchive() {
+            // Loaded resources keep their views of the mapping alive
+            m_Archive.reset();
+            m_ArchiveRoot.clear();
+        }
+
+        std::string ResourceManager::GetArchiveRelativePath(const std::string& path) const {
+            fs::path absolute = fs::path(path);
+            if (!absolute.is_absolute()) {
+                absolute = fs::absolute(absolute);
+            }
+            std::string normalized = absolute.lexically_normal().generic_string();
+            if (normalized.size() <= m_ArchiveRoot.size() || normalized.compare(0, m_ArchiveRoot.size(), m_ArchiveRoot) != 0) {
+                return "";
+            }
+            return normalized.substr(m_ArchiveRoot.size());
+        }
+
+        std::string ResourceManager::ResolveArchivePath(const std::string& path, const std::string& basePath) const {
+            // Same candidates as the loose layout: next to basePath (a file, so its directory), then the
+            // search paths, which all resolve from the package root
+            std::vector<std::string> candidates;
+            std::string normalized = ResourcePathResolver::NormalizePath(path);
+            if (ResourcePathResolver::IsAbsolutePath(normalized)) {
+                candidates.push_back(GetArchiveRelativePath(normalized));
+            } else {
+                if (!basePath.empty()) {
+                    fs::path baseDirectory = fs::path(ResourcePathResolver::NormalizePath(basePath)).parent_path();
+                    candidates.push_back(GetArchiveRelativePath((baseDirectory / normalized).string()));
+                }
+                candidates.push_back(fs::path(normalized).lexically_normal().generic_string());
+            }
+
+            for (const std::string& candidate : candidates) {
+                uint32_t entry = candidate.empty() ? PackageArchive::kInvalidEntry : m_Archive->FindPath(candidate);
+                if (entry != PackageArchive::kInvalidEntry) {
+                    return m_ArchiveRoot + m_Archive->GetEntryPath(entry);
+                }
+            }
+            return "";
+        }
+
+        std::shared_ptr<MappedFile> ResourceManager::OpenFile(const std::string& path) const {
+            if (m_Archive) {
+                std::string relative = GetArchiveRelativePath(path);
+                uint32_t entry = relative.empty() ? PackageArchive::kInvalidEntry : m_Archive->FindPath(relative);
+                if (entry != PackageArchive::kInvalidEntry) {
+                    return m_Archive->OpenEntry(entry);
+                }
+            }
+
+            auto file = std::make_shared<MappedFile>();
+            if (!file->Open(path)) {
+                return nullptr;
+            }
+            return file;
+        }
+
+        bool ResourceManager::ParseDescriptor(const std::string& xmlFilePath, ResourceXMLParser& parser) const {
+            std::shared_ptr<MappedFile> file = OpenFile(xmlFilePath);
+            if (!file) {
+                std::cerr << "ResourceManager::ParseDescriptor: XML file does not exist: " << xmlFilePath << std::endl;
+                return false;
+            }
+            return parser.ParseFromMemory(file->GetData(), static_cast<size_t>(file->GetSize()), xmlFilePath);
+        }
+
         // Primary load method using ResourceID
         // This method internally creates the appropriate Resource instance (ModelResource, MeshResource, etc.)
         // and calls the Resource's Load method (e.g., ModelResource::Load) for unified loading interface
@@ -134,18 +255,15 @@ namespace FirstEngine {
                 return ResourceHandle();
             }
 
-            // Check cache first - if resource already loaded, return it
-            ResourceHandle cached = Get(id);
-            if (cached.ptr) {
-                // Increment reference count and return cached resource
-                // NOTE: Even if resource is not fully loaded yet (isLoaded=false),
-                // we return it because:
-                // 1. Loader::Load (e.g., ModelLoader::Load) no longer checks cache,
-                //    so it will always load from file and return complete metadata
-                // 2. Resource::Load will use the complete metadata to load dependencies
-                // 3. This prevents infinite recursion during circular dependency resolution
-                IResource* resource = static_cast<IResource*>(cached.ptr);
-                resource->AddRef();
+            // Check cache first - if resource already loaded, return it with its reference count incremented
+            // If another thread is loading it, this waits until that load is published (see ResourceCache)
+            // NOTE: A resource the calling thread is still loading (isLoaded=false) is returned as well, because:
+            // 1. Loader::Load (e.g., ModelLoader::Load) no longer checks cache,
+            //    so it will always load from file and return complete metadata
+            // 2. Resource::Load will use the complete metadata to load dependencies
+            // 3. This prevents infinite recursion during circular dependency resolution
+            ResourceHandle cached;
+            if (m_Cache.Acquire(id, true, cached)) {
                 return cached;
             }
 
@@ -154,6 +272,14 @@ namespace FirstEngine {
         }
 
         std::string ResourceManager::GetResolvedPath(ResourceID id) const {
+            // The archive indexes descriptors by ID
+            if (m_Archive) {
+                uint32_t entry = m_Archive->FindResource(id);
+                if (entry != PackageArchive::kInvalidEntry) {
+                    return m_ArchiveRoot + m_Archive->GetEntryPath(entry);
+                }
+            }
+
             std::string filepath = m_IDManager.GetPathFromID(id);
             if (filepath.empty()) {
                 return "";
@@ -161,7 +287,7 @@ namespace FirstEngine {
             return ResolveResourcePath(filepath);
         }
 
-        ResourceHandle ResourceManager::LoadInternal(ResourceID id) {
+        ResourceHandle ResourceManager::LoadInternal(ResourceID id, bool addRef) {
             // Get resource path from ID
             std::string filepath = m_IDManager.GetPathFromID(id);
             if (filepath.empty()) {
@@ -212,44 +338,38 @@ namespace FirstEngine {
             // Set resource ID in metadata before Load (so resource can access its ID)
             resource->GetMetadata().resourceID = id;
 
-            // Store in cache BEFORE calling Load to prevent circular dependency issues
-            // This ensures that if a dependency tries to load this resource, it will get the cached (loading) instance
-            // Initial reference count is 0, will be incremented after successful load
-            resource->AddRef(); // Initial reference count for cache
-            
-            bool cacheStored = false;
+            ResourceHandle handle;
             switch (type) {
-                case ResourceType::Texture: {
-                    ITexture* texture = static_cast<ITexture*>(resource);
-                    m_LoadedTextures[id] = texture;
-                    cacheStored = true;
+                case ResourceType::Texture:
+                    handle = ResourceHandle(static_cast<TextureHandle>(static_cast<ITexture*>(resource)));
                     break;
-                }
-                case ResourceType::Mesh: {
-                    IMesh* mesh = static_cast<IMesh*>(resource);
-                    m_LoadedMeshes[id] = mesh;
-                    cacheStored = true;
+                case ResourceType::Mesh:
+                    handle = ResourceHandle(static_cast<MeshHandle>(static_cast<IMesh*>(resource)));
                     break;
-                }
-                case ResourceType::Material: {
-                    IMaterial* material = static_cast<IMaterial*>(resource);
-                    m_LoadedMaterials[id] = material;
-                    cacheStored = true;
+                case ResourceType::Material:
+                    handle = ResourceHandle(static_cast<MaterialHandle>(static_cast<IMaterial*>(resource)));
                     break;
-                }
-                case ResourceType::Model: {
-                    IModel* model = static_cast<IModel*>(resource);
-                    m_LoadedModels[id] = model;
-                    cacheStored = true;
+                case ResourceType::Model:
+                    handle = ResourceHandle(static_cast<ModelHandle>(static_cast<IModel*>(resource)));
                     break;
-                }
                 default:
-                    break;
+                    delete resource;
+                    return ResourceHandle();
             }
 
-            if (!cacheStored) {
+            if (addRef) {
+                resource->AddRef(); // Initial reference count for cache
+            }
+
+            // Store in cache BEFORE calling Load to prevent circular dependency issues
+            // This ensures that if a dependency tries to load this resource, it will get the cached (loading) instance
+            // Other threads don't see it until it is published below
+            if (!m_Cache.Claim(id, type, resource, handle)) {
+                // Another thread got there first: use its result (waits if it is still loading)
                 delete resource;
-                return ResourceHandle();
+                ResourceHandle existing;
+                m_Cache.Acquire(id, addRef, existing);
+                return existing;
             }
 
             // Now call Resource's Load method (e.g., ModelResource::Load, MeshResource::Load)
@@ -259,51 +379,307 @@ namespace FirstEngine {
             // If a dependency tries to load this resource during Load(), it will get the cached instance
             ResourceLoadResult result = resourceProvider->Load(id);
             if (result != ResourceLoadResult::Success) {
-                // Load failed, remove from cache and cleanup
-                switch (type) {
-                    case ResourceType::Texture:
-                        m_LoadedTextures.erase(id);
-                        break;
-                    case ResourceType::Mesh:
-                        m_LoadedMeshes.erase(id);
-                        break;
-                    case ResourceType::Material:
-                        m_LoadedMaterials.erase(id);
-                        break;
-                    case ResourceType::Model:
-                        m_LoadedModels.erase(id);
-                        break;
-                    default:
-                        break;
+                // Load failed, remove from cache (waking threads waiting for it) and cleanup
+                m_Cache.Abandon(id);
+                if (addRef) {
+                    resource->Release(); // Release the ref count we added
                 }
-                resource->Release(); // Release the ref count we added
                 delete resource;
                 return ResourceHandle();
             }
 
-            // Load successful, return cached resource
-            switch (type) {
-                case ResourceType::Texture: {
-                    ITexture* texture = static_cast<ITexture*>(resource);
-                    return ResourceHandle(static_cast<TextureHandle>(texture));
+            // Load successful, make it visible to other threads and return cached resource
+            m_Cache.Publish(id);
+            return handle;
+        }
+
+        ResourceFuture ResourceManager::LoadAsync(ResourceID id, std::function<void(ResourceHandle)> onLoaded) {
+            return RequestAsync(id, true, std::move(onLoaded));
+        }
+
+        ResourceFuture ResourceManager::Prefetch(ResourceID id) {
+            return RequestAsync(id, false, nullptr);
+        }
+
+        ResourceFuture ResourceManager::RequestAsync(ResourceID id, bool takeReference,
+                                                     std::function<void(ResourceHandle)> onLoaded) {
+            if (id == InvalidResourceID) {
+                return ResourceFuture();
+            }
+
+            if (!m_AsyncEnabled || !Core::ThreadManager::IsInitialized()) {
+                ResourceHandle handle = takeReference ? Load(id) : Get(id);
+                if (!handle.ptr && !takeReference) {
+                    handle = LoadInternal(id, false);
                 }
-                case ResourceType::Mesh: {
-                    IMesh* mesh = static_cast<IMesh*>(resource);
-                    return ResourceHandle(static_cast<MeshHandle>(mesh));
+                if (onLoaded) {
+                    onLoaded(handle);
                 }
-                case ResourceType::Material: {
-                    IMaterial* material = static_cast<IMaterial*>(resource);
-                    return ResourceHandle(static_cast<MaterialHandle>(material));
+                return ResourceFuture(MakePublishedLoad(id, handle));
+            }
+
+            std::shared_ptr<AsyncResourceLoad> load;
+            ResourceHandle cached;
+            bool start = false;
+            {
+                std::lock_guard<std::mutex> lock(m_AsyncMutex);
+                // In-flight first: a load being decoded is claimed in the cache but not published yet
+                auto it = m_AsyncLoads.find(id);
+                if (it != m_AsyncLoads.end()) {
+                    load = it->second;
+                } else {
+                    // The reference is taken under the shard lock, before a concurrent Unload can delete it
+                    if (!m_Cache.TryAcquire(id, takeReference, cached)) {
+                        load = std::make_shared<AsyncResourceLoad>();
+                        load->id = id;
+                        m_AsyncLoads[id] = load;
+                        start = true;
+                    }
+                }
+
+                if (load) {
+                    if (takeReference) {
+                        load->requesters++;
+                    }
+                    if (onLoaded) {
+                        load->callbacks.push_back(std::move(onLoaded));
+                    }
                 }
-                case ResourceType::Model: {
-                    IModel* model = static_cast<IModel*>(resource);
-                    return ResourceHandle(static_cast<ModelHandle>(model));
+            }
+
+            if (!load) {
+                // Already loaded (and referenced above): complete right away
+                if (onLoaded) {
+                    onLoaded(cached);
                 }
-                default:
-                    return ResourceHandle();
+                return ResourceFuture(MakePublishedLoad(id, cached));
+            }
+
+            if (start) {
+                StartScan(load);
+            }
+            return ResourceFuture(load);
+        }
+
+        void ResourceManager::StartScan(const std::shared_ptr<AsyncResourceLoad>& load) {
+            try {
+                // The IO thread only exists once the engine threads are started; the worker pool always is
+                Core::ThreadManager& threadManager = Core::ThreadManager::GetInstance();
+                if (threadManager.GetThread(Core::ThreadType::IO)) {
+                    threadManager.InvokeOnThread(Core::ThreadType::IO, [this, load]() {
+                        ScanDependencies(load);
+                    });
+                } else {
+                    threadManager.InvokeOnWorker([this, load]() {
+                        ScanDependencies(load);
+                    });
+                }
+                return;
+            } catch (const std::exception& e) {
+                std::cerr << "ResourceManager: Failed to queue resource ID " << load->id
+                          << " on a loader thread, scanning inline: " << e.what() << std::endl;
+            }
+            ScanDependencies(load);
+        }
+
+        void ResourceManager::ScanDependencies(const std::shared_ptr<AsyncResourceLoad>& load) {
+            // Only the dependency list is needed here; errors are reported by the regular load in DecodeAsync
+            std::vector<ResourceDependency> dependencies;
+            std::string resolvedPath = GetResolvedPath(load->id);
+            if (!resolvedPath.empty()) {
+                ResourceXMLParser parser;
+                if (ParseDescriptor(GetDescriptorPath(resolvedPath), parser)) {
+                    dependencies = parser.GetDependencies();
+                }
+            }
+
+            std::vector<std::shared_ptr<AsyncResourceLoad>> started;
+            {
+                std::lock_guard<std::mutex> lock(m_AsyncMutex);
+                // Held until every dependency is requested, so an early finisher can't start the decode
+                load->pendingDependencies = 1;
+                for (const auto& dep : dependencies) {
+                    if (dep.resourceID != InvalidResourceID && dep.resourceID != load->id) {
+                        RequestDependencyLocked(load, dep.resourceID, started);
+                    }
+                }
+            }
+
+            // Independent dependencies run in parallel: each one scans and decodes on its own
+            for (const auto& dependency : started) {
+                StartScan(dependency);
+            }
+            DependencyFinished(load);
+        }
+
+        void ResourceManager::RequestDependencyLocked(const std::shared_ptr<AsyncResourceLoad>& parent, ResourceID id,
+                                                      std::vector<std::shared_ptr<AsyncResourceLoad>>& outStarted) {
+            std::shared_ptr<AsyncResourceLoad> dependency;
+            auto it = m_AsyncLoads.find(id);
+            if (it != m_AsyncLoads.end()) {
+                dependency = it->second;
+                if (dependency->decoded) {
+                    return;
+                }
+                // Circular dependency: Resource::Load resolves it through the cache, waiting would deadlock
+                if (WaitsOnLocked(id, parent->id)) {
+                    return;
+                }
+            } else {
+                if (Get(id).ptr) {
+                    return;
+                }
+                dependency = std::make_shared<AsyncResourceLoad>();
+                dependency->id = id;
+                m_AsyncLoads[id] = dependency;
+                outStarted.push_back(dependency);
+            }
+
+            dependency->dependents.push_back(parent);
+            parent->waitingOn.push_back(id);
+            parent->pendingDependencies++;
+        }
+
+        bool ResourceManager::WaitsOnLocked(ResourceID from, ResourceID target) const {
+            std::vector<ResourceID> stack = { from };
+            std::vector<ResourceID> visited;
+            while (!stack.empty()) {
+                ResourceID id = stack.back();
+                stack.pop_back();
+                if (id == target) {
+                    return true;
+                }
+                if (std::find(visited.begin(), visited.end(), id) != visited.end()) {
+                    continue;
+                }
+                visited.push_back(id);
+
+                auto it = m_AsyncLoads.find(id);
+                if (it != m_AsyncLoads.end() && !it->second->decoded) {
+                    stack.insert(stack.end(), it->second->waitingOn.begin(), it->second->waitingOn.end());
+                }
+            }
+            return false;
+        }
+
+        void ResourceManager::DependencyFinished(const std::shared_ptr<AsyncResourceLoad>& load) {
+            bool ready = false;
+            {
+                std::lock_guard<std::mutex> lock(m_AsyncMutex);
+                ready = --load->pendingDependencies == 0;
+            }
+            if (ready) {
+                StartDecode(load);
             }
         }
 
+        void ResourceManager::StartDecode(const std::shared_ptr<AsyncResourceLoad>& load) {
+            try {
+                Core::ThreadManager::GetInstance().InvokeOnWorker([this, load]() {
+                    DecodeAsync(load);
+                });
+                return;
+            } catch (const std::exception& e) {
+                std::cerr << "ResourceManager: Failed to queue resource ID " << load->id
+                          << " on a worker, loading inline: " << e.what() << std::endl;
+            }
+            DecodeAsync(load);
+        }
+
+        void ResourceManager::DecodeAsync(const std::shared_ptr<AsyncResourceLoad>& load) {
+            // Dependencies are cached by now, so Resource::LoadDependencies only picks them up.
+            // The load holds a reference from before the resource is published until ProcessAsyncLoads has given
+            // the requesters theirs, so a Load/Unload pair on another thread can't delete it in between.
+            ResourceHandle handle;
+            try {
+                if (!m_Cache.Acquire(load->id, true, handle)) {
+                    handle = LoadInternal(load->id, true);
+                }
+            } catch (const std::exception& e) {
+                std::cerr << "ResourceManager: Exception loading resource ID " << load->id << ": " << e.what() << std::endl;
+                handle = ResourceHandle();
+            }
+            load->handle = handle;
+
+            std::vector<std::shared_ptr<AsyncResourceLoad>> dependents;
+            {
+                std::lock_guard<std::mutex> lock(m_AsyncMutex);
+                load->decoded = true;
+                dependents.swap(load->dependents);
+                m_FinishedLoads.push_back(load);
+            }
+            m_AsyncCondition.notify_all();
+
+            for (const auto& dependent : dependents) {
+                DependencyFinished(dependent);
+            }
+        }
+
+        void ResourceManager::ProcessAsyncLoads() {
+            std::vector<std::shared_ptr<AsyncResourceLoad>> finished;
+            {
+                std::lock_guard<std::mutex> lock(m_AsyncMutex);
+                finished.swap(m_FinishedLoads);
+                // Once out of the map nobody can join a load, so its requesters and callbacks are final
+                for (const auto& load : finished) {
+                    auto it = m_AsyncLoads.find(load->id);
+                    if (it != m_AsyncLoads.end() && it->second == load) {
+                        m_AsyncLoads.erase(it);
+                    }
+                }
+            }
+
+            for (const auto& load : finished) {
+                if (load->handle.ptr) {
+                    IResource* resource = static_cast<IResource*>(load->handle.ptr);
+                    for (uint32_t i = 0; i < load->requesters; ++i) {
+                        resource->AddRef();
+                    }
+                }
+                load->published.store(true, std::memory_order_release);
+
+                for (const auto& callback : load->callbacks) {
+                    callback(load->handle);
+                }
+                load->callbacks.clear();
+
+                // Drop the load's own reference; a prefetch nobody asked for stays cached without references
+                if (load->handle.ptr) {
+                    m_Cache.Release(load->id, false);
+                }
+            }
+        }
+
+        ResourceHandle ResourceManager::Wait(const ResourceFuture& future) {
+            if (!future.IsValid()) {
+                return ResourceHandle();
+            }
+
+            std::unique_lock<std::mutex> lock(m_AsyncMutex);
+            while (!future.IsReady()) {
+                m_AsyncCondition.wait(lock, [this]() { return !m_FinishedLoads.empty(); });
+                lock.unlock();
+                ProcessAsyncLoads();
+                lock.lock();
+            }
+            return future.GetHandle();
+        }
+
+        void ResourceManager::WaitForAsyncLoads() {
+            std::unique_lock<std::mutex> lock(m_AsyncMutex);
+            while (!m_AsyncLoads.empty() || !m_FinishedLoads.empty()) {
+                m_AsyncCondition.wait(lock, [this]() { return !m_FinishedLoads.empty(); });
+                lock.unlock();
+                ProcessAsyncLoads();
+                lock.lock();
+            }
+        }
+
+        uint32_t ResourceManager::GetAsyncLoadCount() const {
+            std::lock_guard<std::mutex> lock(m_AsyncMutex);
+            return static_cast<uint32_t>(m_AsyncLoads.size());
+        }
+
         // Legacy path-based load methods (for backward compatibility - auto-registers path and gets ID)
         // NOTE: These methods are kept for backward compatibility. New code should use ResourceID-based API.
         // TODO: Consider deprecating these methods in a future version
@@ -325,7 +701,10 @@ namespace FirstEngine {
             }
 
             // Cache path to ID mapping
-            m_PathToIDCache[resolvedPath] = id;
+            {
+                std::unique_lock<std::shared_mutex> lock(m_PathCacheMutex);
+                m_PathToIDCache[resolvedPath] = id;
+            }
 
             // Load using ID
             return Load(id);
@@ -337,37 +716,8 @@ namespace FirstEngine {
                 return ResourceHandle();
             }
 
-            // Check all resource caches
-            // Mesh
-            {
-                auto it = m_LoadedMeshes.find(id);
-                if (it != m_LoadedMeshes.end()) {
-                    return ResourceHandle(it->second);
-                }
-            }
-            // Material
-            {
-                auto it = m_LoadedMaterials.find(id);
-                if (it != m_LoadedMaterials.end()) {
-                    return ResourceHandle(it->second);
-                }
-            }
-            // Texture
-            {
-                auto it = m_LoadedTextures.find(id);
-                if (it != m_LoadedTextures.end()) {
-                    return ResourceHandle(it->second);
-                }
-            }
-            // Model
-            {
-                auto it = m_LoadedModels.find(id);
-                if (it != m_LoadedModels.end()) {
-                    return ResourceHandle(it->second);
-                }
-            }
-
-            return ResourceHandle();
+            // Published resources (and the ones this thread is loading); never waits for another thread's load
+            return m_Cache.Find(id);
         }
 
         // Legacy path-based get methods (for backward compatibility)
@@ -382,16 +732,7 @@ namespace FirstEngine {
         }
 
         ResourceHandle ResourceManager::Get(ResourceType type, const std::string& filepath) const {
-            std::string resolvedPath = ResolveResourcePath(filepath, "");
-            
-            // Try to get ID from cache first
-            auto cacheIt = m_PathToIDCache.find(resolvedPath);
-            if (cacheIt != m_PathToIDCache.end()) {
-                return Get(cacheIt->second);
-            }
-
-            // Try to get ID from IDManager
-            ResourceID id = m_IDManager.GetIDFromPath(resolvedPath);
+            ResourceID id = GetCachedPathID(ResolveResourcePath(filepath, ""));
             if (id != InvalidResourceID) {
                 return Get(id);
             }
@@ -399,66 +740,29 @@ namespace FirstEngine {
             return ResourceHandle();
         }
 
+        ResourceID ResourceManager::GetCachedPathID(const std::string& resolvedPath) const {
+            // Try to get ID from cache first
+            {
+                std::shared_lock<std::shared_mutex> lock(m_PathCacheMutex);
+                auto cacheIt = m_PathToIDCache.find(resolvedPath);
+                if (cacheIt != m_PathToIDCache.end()) {
+                    return cacheIt->second;
+                }
+            }
+
+            // Try to get ID from IDManager
+            return m_IDManager.GetIDFromPath(resolvedPath);
+        }
+
         // Unload by ID
         void ResourceManager::Unload(ResourceID id) {
             if (id == InvalidResourceID) {
                 return;
             }
 
-            ResourceType type = m_IDManager.GetTypeFromID(id);
-            
-            switch (type) {
-                case ResourceType::Mesh: {
-                    auto it = m_LoadedMeshes.find(id);
-                    if (it != m_LoadedMeshes.end()) {
-                        IMesh* mesh = it->second;
-                        mesh->Release();
-                        if (mesh->GetRefCount() == 0) {
-                            delete mesh;
-                            m_LoadedMeshes.erase(it);
-                        }
-                    }
-                    break;
-                }
-                case ResourceType::Material: {
-                    auto it = m_LoadedMaterials.find(id);
-                    if (it != m_LoadedMaterials.end()) {
-                        IMaterial* material = it->second;
-                        material->Release();
-                        if (material->GetRefCount() == 0) {
-                            delete material;
-                            m_LoadedMaterials.erase(it);
-                        }
-                    }
-                    break;
-                }
-                case ResourceType::Texture: {
-                    auto it = m_LoadedTextures.find(id);
-                    if (it != m_LoadedTextures.end()) {
-                        ITexture* texture = it->second;
-                        texture->Release();
-                        if (texture->GetRefCount() == 0) {
-                            delete texture;
-                            m_LoadedTextures.erase(it);
-                        }
-                    }
-                    break;
-                }
-                case ResourceType::Model: {
-                    auto it = m_LoadedModels.find(id);
-                    if (it != m_LoadedModels.end()) {
-                        IModel* model = it->second;
-                        model->Release();
-                        if (model->GetRefCount() == 0) {
-                            delete model;
-                            m_LoadedModels.erase(it);
-                        }
-                    }
-                    break;
-                }
-                default:
-                    break;
-            }
+            // The last reference takes the resource out of the cache; delete it outside the shard lock
+            IResource* resource = m_Cache.Release(id);
+            delete resource;
         }
 
         void ResourceManager::Unload(ResourceHandle handle) {
@@ -483,17 +787,8 @@ namespace FirstEngine {
         }
 
         void ResourceManager::Unload(ResourceType type, const std::string& filepath) {
-            std::string resolvedPath = ResolveResourcePath(filepath, "");
-            
             // Get ID from cache or IDManager
-            ResourceID id = InvalidResourceID;
-            auto cacheIt = m_PathToIDCache.find(resolvedPath);
-            if (cacheIt != m_PathToIDCache.end()) {
-                id = cacheIt->second;
-            } else {
-                id = m_IDManager.GetIDFromPath(resolvedPath);
-            }
-
+            ResourceID id = GetCachedPathID(ResolveResourcePath(filepath, ""));
             if (id != InvalidResourceID) {
                 Unload(id);
             }
@@ -535,11 +830,37 @@ namespace FirstEngine {
             return m_IDManager.IsRegistered(id);
         }
 
+        std::vector<ResourceID> ResourceManager::GetIDsByType(ResourceType type) const {
+            return m_IDManager.GetIDsByType(type);
+        }
+
         bool ResourceManager::IsPathRegistered(const std::string& filepath) const {
             return m_IDManager.IsPathRegistered(filepath);
         }
 
         bool ResourceManager::LoadManifest(const std::string& manifestPath) {
+            if (m_Archive) {
+                std::string relative = GetArchiveRelativePath(manifestPath);
+
+                // Packed together with the JSON, so the compiled manifest is never stale
+                std::string compiledRelative = relative.empty() ? std::string() : ResourceIDManager::GetCompiledManifestPath(relative);
+                uint32_t compiledEntry = compiledRelative.empty() ? PackageArchive::kInvalidEntry : m_Archive->FindPath(compiledRelative);
+                if (compiledEntry != PackageArchive::kInvalidEntry &&
+                    m_IDManager.LoadCompiledManifest(m_Archive->OpenEntry(compiledEntry), m_Archive->GetPath() + ":" + compiledRelative)) {
+                    return true;
+                }
+
+                uint32_t entry = relative.empty() ? PackageArchive::kInvalidEntry : m_Archive->FindPath(relative);
+                if (entry != PackageArchive::kInvalidEntry) {
+                    std::shared_ptr<MappedFile> file = m_Archive->OpenEntry(entry);
+                    if (!file) {
+                        return false;
+                    }
+                    std::cout << "ResourceManager: Loading manifest " << relative << " from " << m_Archive->GetPath() << std::endl;
+                    return m_IDManager.LoadManifestFromString(
+                        std::string(reinterpret_cast<const char*>(file->GetData()), static_cast<size_t>(file->GetSize())));
+                }
+            }
             return m_IDManager.LoadManifest(manifestPath);
         }
 
@@ -548,30 +869,11 @@ namespace FirstEngine {
         }
 
         void ResourceManager::Clear() {
-            // Delete all meshes
-            for (auto& pair : m_LoadedMeshes) {
-                delete pair.second;
-            }
-            m_LoadedMeshes.clear();
-            
-            // Delete all materials
-            for (auto& pair : m_LoadedMaterials) {
-                delete pair.second;
-            }
-            m_LoadedMaterials.clear();
-            
-            // Delete all textures
-            for (auto& pair : m_LoadedTextures) {
-                delete pair.second;
-            }
-            m_LoadedTextures.clear();
-            
-            // Delete all models
-            for (auto& pair : m_LoadedModels) {
-                delete pair.second;
+            for (IResource* resource : m_Cache.TakeAll()) {
+                delete resource;
             }
-            m_LoadedModels.clear();
-            
+
+            std::unique_lock<std::shared_mutex> lock(m_PathCacheMutex);
             m_PathToIDCache.clear();
         }
 
@@ -1,6 +1,7 @@
 #include "FirstEngine/Resources/ResourceXMLParser.h"
 #include "FirstEngine/Resources/ResourceDependency.h"
 #include "FirstEngine/Resources/MaterialParameter.h"
+#include "FirstEngine/Shader/ShaderKeywords.h"
 #include "../../third_party/assimp/contrib/pugixml/src/pugixml.hpp"
 #include <fstream>
 #include <sstream>
@@ -58,6 +59,27 @@ namespace FirstEngine {
             }
         }
 
+        bool ResourceXMLParser::ParseFromMemory(const void* data, size_t size, const std::string& sourceName) {
+            pugi::xml_parse_result result = m_Document->load_buffer(data, size);
+            if (!result) {
+                std::cerr << "ResourceXMLParser::ParseFromMemory: Failed to parse XML file: " << sourceName << std::endl;
+                std::cerr << "  Error: " << result.description() << " at offset " << result.offset << std::endl;
+                return false;
+            }
+
+            // Get the document element (root element, not the document node itself)
+            m_RootNode = m_Document->document_element();
+            if (m_RootNode.empty()) {
+                // Fallback to root() if document_element() is empty
+                m_RootNode = m_Document->root();
+            }
+            if (m_RootNode.empty()) {
+                std::cerr << "ResourceXMLParser::ParseFromMemory: XML file has no root node: " << sourceName << std::endl;
+                return false;
+            }
+            return true;
+        }
+
         bool ResourceXMLParser::ParseFromString(const std::string& xmlContent) {
             pugi::xml_parse_result result = m_Document->load_string(xmlContent.c_str());
             if (!result) {
@@ -164,6 +186,11 @@ namespace FirstEngine {
                 outData.imageFile = imageFileNode.text().as_string();
             }
 
+            auto cookedFileNode = m_RootNode.child("CookedFile");
+            if (cookedFileNode) {
+                outData.cookedFile = cookedFileNode.text().as_string();
+            }
+
             auto widthNode = m_RootNode.child("Width");
             if (widthNode) {
                 outData.width = widthNode.text().as_uint(0);
@@ -197,6 +224,12 @@ namespace FirstEngine {
                 outData.shaderName = shaderNode.text().as_string();
             }
 
+            // Shader permutation keywords (space or comma separated, tokenized like every other keyword list)
+            auto keywordsNode = m_RootNode.child("Keywords");
+            if (keywordsNode) {
+                outData.keywords = Shader::ShaderKeywordSet::FromString(keywordsNode.text().as_string()).GetKeywords();
+            }
+
             // Parse parameters
             auto paramsNode = m_RootNode.child("Parameters");
             if (!paramsNode.empty()) {
@@ -237,6 +270,11 @@ namespace FirstEngine {
                 outData.meshFile = meshFileNode.text().as_string();
             }
 
+            auto cookedFileNode = m_RootNode.child("CookedFile");
+            if (!cookedFileNode.empty()) {
+                outData.cookedFile = cookedFileNode.text().as_string();
+            }
+
             // Note: vertexStride is no longer stored in XML - it's calculated from mesh file
 
             return true;
@@ -412,6 +450,9 @@ namespace FirstEngine {
             root.append_child("Name").text().set(name.c_str());
             root.append_child("ResourceID").text().set(std::to_string(id).c_str());
             root.append_child("ImageFile").text().set(data.imageFile.c_str());
+            if (!data.cookedFile.empty()) {
+                root.append_child("CookedFile").text().set(data.cookedFile.c_str());
+            }
             root.append_child("Width").text().set(data.width);
             root.append_child("Height").text().set(data.height);
             root.append_child("Channels").text().set(data.channels);
@@ -427,6 +468,16 @@ namespace FirstEngine {
             root.append_child("Name").text().set(name.c_str());
             root.append_child("ResourceID").text().set(std::to_string(id).c_str());
             root.append_child("Shader").text().set(data.shaderName.c_str());
+            if (!data.keywords.empty()) {
+                std::string keywords;
+                for (const auto& keyword : data.keywords) {
+                    if (!keywords.empty()) {
+                        keywords += " ";
+                    }
+                    keywords += keyword;
+                }
+                root.append_child("Keywords").text().set(keywords.c_str());
+            }
 
             // Save parameters
             auto paramsNode = root.append_child("Parameters");
@@ -543,6 +594,9 @@ namespace FirstEngine {
             root.append_child("Name").text().set(name.c_str());
             root.append_child("ResourceID").text().set(std::to_string(id).c_str());
             root.append_child("MeshFile").text().set(data.meshFile.c_str());
+            if (!data.cookedFile.empty()) {
+                root.append_child("CookedFile").text().set(data.cookedFile.c_str());
+            }
             // Note: vertexStride is no longer stored in XML - it's calculated from mesh file
 
             return doc.save_file(xmlFilePath.c_str());
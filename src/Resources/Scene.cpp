@@ -5,6 +5,7 @@
 #include "FirstEngine/Resources/ModelComponent.h"
 #include "FirstEngine/Resources/CameraComponent.h"
 #include "FirstEngine/Resources/ResourceProvider.h"
+#include "FirstEngine/Resources/MappedFile.h"
 #include <algorithm>
 #include <cmath>
 #include <limits>
@@ -908,15 +909,12 @@ namespace FirstEngine {
 
         bool SceneLoader::LoadFromJSON(const std::string& filepath, Scene& scene) {
             try {
-                std::ifstream file(filepath, std::ios::in);
-                if (!file.is_open()) {
+                // Read entire file (from the package archive if one is mounted)
+                std::shared_ptr<MappedFile> file = ResourceManager::GetInstance().OpenFile(filepath);
+                if (!file) {
                     return false;
                 }
-
-                // Read entire file
-                std::string content((std::istreambuf_iterator<char>(file)),
-                                    std::istreambuf_iterator<char>());
-                file.close();
+                std::string content(reinterpret_cast<const char*>(file->GetData()), static_cast<size_t>(file->GetSize()));
 
                 // Simple JSON parser
                 // Find scene name
@@ -946,6 +944,23 @@ namespace FirstEngine {
                 size_t pos = arrayStart + 1;
                 ResourceManager& resourceManager = ResourceManager::GetInstance();
 
+                // Load every referenced model (and its meshes, materials and textures) in parallel up front;
+                // the Load calls while building entities below then come straight from the cache
+                for (size_t idPos = content.find("\"modelID\"", arrayStart); idPos != std::string::npos;
+                     idPos = content.find("\"modelID\"", idPos + 1)) {
+                    size_t valueStart = content.find_first_not_of(" \t\n\r:", idPos + 9);
+                    if (valueStart == std::string::npos) {
+                        break;
+                    }
+                    try {
+                        ResourceID modelID = std::stoull(content.substr(valueStart, 24));
+                        if (modelID != InvalidResourceID && !resourceManager.GetResolvedPath(modelID).empty()) {
+                            resourceManager.Prefetch(modelID);
+                        }
+                    } catch (...) {}
+                }
+                resourceManager.WaitForAsyncLoads();
+
                 while (pos < content.length()) {
                     size_t levelStart = content.find('{', pos);
                     if (levelStart == std::string::npos) break;
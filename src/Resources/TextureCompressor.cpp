@@ -0,0 +1,996 @@
+#include "FirstEngine/Resources/TextureCompressor.h"
+#include <algorithm>
+#include <atomic>
+#include <cfloat>
+#include <cmath>
+#include <cstring>
+#include <thread>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define FE_TEXTURE_COMPRESSOR_SSE2 1
+#include <emmintrin.h>
+#endif
+
+namespace FirstEngine {
+    namespace Resources {
+
+        namespace {
+            constexpr uint32_t kBlockTexels = 16;
+
+            // Kaiser window parameters (same as the NVIDIA texture tools defaults)
+            constexpr float kKaiserAlpha = 4.0f;
+            constexpr float kKaiserHalfWidth = 1.5f;    // In destination texels
+
+            // BC7 4-bit index weights (out of 64)
+            constexpr int kBC7Weights4[16] = { 0, 4, 9, 13, 17, 21, 26, 30, 34, 38, 43, 47, 51, 55, 60, 64 };
+
+            // Run fn(row) for every row in [0, count); rows are handed out one at a time so uneven rows balance
+            template <typename Fn>
+            void ParallelFor(uint32_t count, uint32_t threadCount, const Fn& fn) {
+                if (threadCount == 0) {
+                    threadCount = std::max(1u, std::thread::hardware_concurrency());
+                }
+                threadCount = std::min(threadCount, count);
+                if (threadCount <= 1) {
+                    for (uint32_t row = 0; row < count; ++row) {
+                        fn(row);
+                    }
+                    return;
+                }
+
+                std::atomic<uint32_t> next(0);
+                auto worker = [&]() {
+                    for (uint32_t row = next++; row < count; row = next++) {
+                        fn(row);
+                    }
+                };
+                std::vector<std::thread> threads;
+                threads.reserve(threadCount - 1);
+                for (uint32_t i = 1; i < threadCount; ++i) {
+                    threads.emplace_back(worker);
+                }
+                worker();
+                for (std::thread& thread : threads) {
+                    thread.join();
+                }
+            }
+
+            // --- Color space ---
+
+            const float* SRGBToLinearTable() {
+                static const std::vector<float> table = [] {
+                    std::vector<float> values(256);
+                    for (int i = 0; i < 256; ++i) {
+                        float c = i / 255.0f;
+                        values[i] = c <= 0.04045f ? c / 12.92f : std::pow((c + 0.055f) / 1.055f, 2.4f);
+                    }
+                    return values;
+                }();
+                return table.data();
+            }
+
+            uint8_t ToUnorm8(float value) {
+                value = value > 0.0f ? (value < 1.0f ? value : 1.0f) : 0.0f;
+                return static_cast<uint8_t>(value * 255.0f + 0.5f);
+            }
+
+            uint8_t LinearToSRGB8(float value) {
+                value = value > 0.0f ? (value < 1.0f ? value : 1.0f) : 0.0f;
+                float c = value <= 0.0031308f ? value * 12.92f : 1.055f * std::pow(value, 1.0f / 2.4f) - 0.055f;
+                return ToUnorm8(c);
+            }
+
+            // --- Mip filtering ---
+
+            float BesselI0(float x) {
+                float sum = 1.0f;
+                float term = 1.0f;
+                float halfX = x * 0.5f;
+                for (int k = 1; k < 32; ++k) {
+                    term *= (halfX / k) * (halfX / k);
+                    sum += term;
+                    if (term < sum * 1e-8f) {
+                        break;
+                    }
+                }
+                return sum;
+            }
+
+            float KaiserSinc(float x) {
+                float t = x / kKaiserHalfWidth;
+                if (std::fabs(t) >= 1.0f) {
+                    return 0.0f;
+                }
+                float sinc = x == 0.0f ? 1.0f : std::sin(3.14159265f * x) / (3.14159265f * x);
+                return sinc * BesselI0(kKaiserAlpha * std::sqrt(1.0f - t * t)) / BesselI0(kKaiserAlpha);
+            }
+
+            // 2:1 reduction kernel: destination texel x reads source texels first + 2x .. first + 2x + taps - 1
+            struct Kernel {
+                float weights[6];
+                uint32_t taps;
+                int first;
+            };
+
+            Kernel MakeKernel(MipFilter filter) {
+                Kernel kernel = {};
+                if (filter == MipFilter::Box) {
+                    kernel.weights[0] = 0.5f;
+                    kernel.weights[1] = 0.5f;
+                    kernel.taps = 2;
+                    kernel.first = 0;
+                    return kernel;
+                }
+
+                // Source texel centers sit at +-0.25, +-0.75, +-1.25 destination texels from the destination center
+                kernel.taps = 6;
+                kernel.first = -2;
+                float sum = 0.0f;
+                for (uint32_t i = 0; i < kernel.taps; ++i) {
+                    kernel.weights[i] = KaiserSinc((static_cast<float>(i) - 2.5f) * 0.5f);
+                    sum += kernel.weights[i];
+                }
+                for (uint32_t i = 0; i < kernel.taps; ++i) {
+                    kernel.weights[i] /= sum;
+                }
+                return kernel;
+            }
+
+            // Halve one axis of a float RGBA image (clamped addressing); an axis of size 1 is copied
+            void Reduce(const std::vector<float>& source, uint32_t width, uint32_t height, bool horizontal,
+                        const Kernel& kernel, uint32_t threadCount, std::vector<float>& destination) {
+                uint32_t sourceSize = horizontal ? width : height;
+                uint32_t targetWidth = horizontal ? std::max(1u, width >> 1) : width;
+                uint32_t targetHeight = horizontal ? height : std::max(1u, height >> 1);
+                destination.assign(static_cast<size_t>(targetWidth) * targetHeight * 4, 0.0f);
+                if (sourceSize == 1) {
+                    destination = source;
+                    return;
+                }
+
+                ParallelFor(targetHeight, threadCount, [&](uint32_t y) {
+                    for (uint32_t x = 0; x < targetWidth; ++x) {
+                        float sum[4] = {};
+                        int center = static_cast<int>(horizontal ? x : y) * 2 + kernel.first;
+                        for (uint32_t tap = 0; tap < kernel.taps; ++tap) {
+                            int s = std::min(std::max(center + static_cast<int>(tap), 0), static_cast<int>(sourceSize) - 1);
+                            size_t texel = horizontal ? static_cast<size_t>(y) * width + s
+                                                      : static_cast<size_t>(s) * width + x;
+                            const float* value = &source[texel * 4];
+                            for (int c = 0; c < 4; ++c) {
+                                sum[c] += kernel.weights[tap] * value[c];
+                            }
+                        }
+                        float* out = &destination[(static_cast<size_t>(y) * targetWidth + x) * 4];
+                        for (int c = 0; c < 4; ++c) {
+                            // Negative lobes can overshoot; clamp so it doesn't build up over the chain
+                            out[c] = sum[c] > 0.0f ? (sum[c] < 1.0f ? sum[c] : 1.0f) : 0.0f;
+                        }
+                    }
+                });
+            }
+
+            // --- Block encoding ---
+
+            // Nearest palette entry per texel over the first channelCount channels (SSE2 where available, scalar
+            // otherwise; both evaluate the same operations in the same order)
+            // texels: channel c of texel i at texels[c * 16 + i]; palette: entry e channel c at palette[e * 4 + c]
+            // Returns the squared error, weighted per texel if weights is set
+            float FitIndices(const float* texels, uint32_t channelCount, const float* palette, uint32_t paletteSize,
+                             const float* weights, uint8_t* indices) {
+                float lanes[4] = {};
+#ifdef FE_TEXTURE_COMPRESSOR_SSE2
+                __m128 total = _mm_setzero_ps();
+                for (uint32_t i = 0; i < kBlockTexels; i += 4) {
+                    __m128 best = _mm_set1_ps(FLT_MAX);
+                    __m128i bestIndex = _mm_setzero_si128();
+                    for (uint32_t e = 0; e < paletteSize; ++e) {
+                        __m128 distance = _mm_setzero_ps();
+                        for (uint32_t c = 0; c < channelCount; ++c) {
+                            __m128 d = _mm_sub_ps(_mm_loadu_ps(texels + c * kBlockTexels + i), _mm_set1_ps(palette[e * 4 + c]));
+                            distance = _mm_add_ps(distance, _mm_mul_ps(d, d));
+                        }
+                        __m128i closer = _mm_castps_si128(_mm_cmplt_ps(distance, best));
+                        best = _mm_min_ps(distance, best);
+                        bestIndex = _mm_or_si128(_mm_and_si128(closer, _mm_set1_epi32(static_cast<int>(e))),
+                                                 _mm_andnot_si128(closer, bestIndex));
+                    }
+                    if (weights) {
+                        best = _mm_mul_ps(best, _mm_loadu_ps(weights + i));
+                    }
+                    total = _mm_add_ps(total, best);
+
+                    int32_t lane[4];
+                    _mm_storeu_si128(reinterpret_cast<__m128i*>(lane), bestIndex);
+                    for (uint32_t k = 0; k < 4; ++k) {
+                        indices[i + k] = static_cast<uint8_t>(lane[k]);
+                    }
+                }
+                _mm_storeu_ps(lanes, total);
+#else
+                for (uint32_t i = 0; i < kBlockTexels; ++i) {
+                    float best = FLT_MAX;
+                    uint32_t bestIndex = 0;
+                    for (uint32_t e = 0; e < paletteSize; ++e) {
+                        float distance = 0.0f;
+                        for (uint32_t c = 0; c < channelCount; ++c) {
+                            float d = texels[c * kBlockTexels + i] - palette[e * 4 + c];
+                            distance += d * d;
+                        }
+                        if (distance < best) {
+                            best = distance;
+                            bestIndex = e;
+                        }
+                    }
+                    if (weights) {
+                        best *= weights[i];
+                    }
+                    lanes[i % 4] += best;
+                    indices[i] = static_cast<uint8_t>(bestIndex);
+                }
+#endif
+                return (lanes[0] + lanes[1]) + (lanes[2] + lanes[3]);
+            }
+
+            // Weighted mean and principal axis (power iteration on the covariance); the axis is zero for flat blocks
+            void PrincipalAxis(const float* texels, uint32_t channelCount, const float* weights, float* mean, float* axis) {
+                float totalWeight = 0.0f;
+                for (uint32_t c = 0; c < channelCount; ++c) {
+                    mean[c] = 0.0f;
+                    axis[c] = 0.0f;
+                }
+                for (uint32_t i = 0; i < kBlockTexels; ++i) {
+                    float w = weights ? weights[i] : 1.0f;
+                    totalWeight += w;
+                    for (uint32_t c = 0; c < channelCount; ++c) {
+                        mean[c] += w * texels[c * kBlockTexels + i];
+                    }
+                }
+                if (totalWeight <= 0.0f) {
+                    return;
+                }
+                for (uint32_t c = 0; c < channelCount; ++c) {
+                    mean[c] /= totalWeight;
+                }
+
+                float covariance[4][4] = {};
+                for (uint32_t i = 0; i < kBlockTexels; ++i) {
+                    float w = weights ? weights[i] : 1.0f;
+                    for (uint32_t a = 0; a < channelCount; ++a) {
+                        float da = texels[a * kBlockTexels + i] - mean[a];
+                        for (uint32_t b = a; b < channelCount; ++b) {
+                            covariance[a][b] += w * da * (texels[b * kBlockTexels + i] - mean[b]);
+                        }
+                    }
+                }
+
+                // Start from the row of the largest variance so the start vector can't be orthogonal to the axis
+                uint32_t start = 0;
+                for (uint32_t a = 0; a < channelCount; ++a) {
+                    for (uint32_t b = 0; b < a; ++b) {
+                        covariance[a][b] = covariance[b][a];
+                    }
+                    if (covariance[a][a] > covariance[start][start]) {
+                        start = a;
+                    }
+                }
+                if (covariance[start][start] < 1e-4f) {
+                    return;
+                }
+
+                float vector[4];
+                for (uint32_t c = 0; c < channelCount; ++c) {
+                    vector[c] = covariance[start][c];
+                }
+                for (int iteration = 0; iteration < 8; ++iteration) {
+                    float next[4] = {};
+                    float largest = 0.0f;
+                    for (uint32_t a = 0; a < channelCount; ++a) {
+                        for (uint32_t b = 0; b < channelCount; ++b) {
+                            next[a] += covariance[a][b] * vector[b];
+                        }
+                        largest = std::max(largest, std::fabs(next[a]));
+                    }
+                    if (largest <= 0.0f) {
+                        return;
+                    }
+                    for (uint32_t c = 0; c < channelCount; ++c) {
+                        vector[c] = next[c] / largest;
+                    }
+                }
+
+                float length = 0.0f;
+                for (uint32_t c = 0; c < channelCount; ++c) {
+                    length += vector[c] * vector[c];
+                }
+                length = std::sqrt(length);
+                for (uint32_t c = 0; c < channelCount; ++c) {
+                    axis[c] = vector[c] / length;
+                }
+            }
+
+            // Endpoints at the extremes of the texels projected on the principal axis
+            void FitEndpoints(const float* texels, uint32_t channelCount, const float* weights, float* low, float* high) {
+                float mean[4];
+                float axis[4];
+                PrincipalAxis(texels, channelCount, weights, mean, axis);
+
+                float minT = 0.0f;
+                float maxT = 0.0f;
+                bool first = true;
+                for (uint32_t i = 0; i < kBlockTexels; ++i) {
+                    if (weights && weights[i] <= 0.0f) {
+                        continue;
+                    }
+                    float t = 0.0f;
+                    for (uint32_t c = 0; c < channelCount; ++c) {
+                        t += (texels[c * kBlockTexels + i] - mean[c]) * axis[c];
+                    }
+                    minT = first ? t : std::min(minT, t);
+                    maxT = first ? t : std::max(maxT, t);
+                    first = false;
+                }
+                for (uint32_t c = 0; c < channelCount; ++c) {
+                    low[c] = std::min(std::max(mean[c] + axis[c] * minT, 0.0f), 255.0f);
+                    high[c] = std::min(std::max(mean[c] + axis[c] * maxT, 0.0f), 255.0f);
+                }
+            }
+
+            // Least-squares endpoints for fixed indices: texel i ~ blend[i] * a + (1 - blend[i]) * b
+            // Returns false if the system is degenerate (all texels on one index)
+            bool SolveEndpoints(const float* texels, uint32_t channelCount, const float* weights, const float* blend,
+                                float* a, float* b) {
+                float aa = 0.0f;
+                float ab = 0.0f;
+                float bb = 0.0f;
+                float ax[4] = {};
+                float bx[4] = {};
+                for (uint32_t i = 0; i < kBlockTexels; ++i) {
+                    float w = weights ? weights[i] : 1.0f;
+                    float alpha = blend[i];
+                    float beta = 1.0f - alpha;
+                    aa += w * alpha * alpha;
+                    ab += w * alpha * beta;
+                    bb += w * beta * beta;
+                    for (uint32_t c = 0; c < channelCount; ++c) {
+                        ax[c] += w * alpha * texels[c * kBlockTexels + i];
+                        bx[c] += w * beta * texels[c * kBlockTexels + i];
+                    }
+                }
+
+                float determinant = aa * bb - ab * ab;
+                if (std::fabs(determinant) < 1e-6f) {
+                    return false;
+                }
+                float inverse = 1.0f / determinant;
+                for (uint32_t c = 0; c < channelCount; ++c) {
+                    a[c] = std::min(std::max((ax[c] * bb - bx[c] * ab) * inverse, 0.0f), 255.0f);
+                    b[c] = std::min(std::max((bx[c] * aa - ax[c] * ab) * inverse, 0.0f), 255.0f);
+                }
+                return true;
+            }
+
+            void LoadBlock(const uint8_t* rgba, float* texels) {
+                for (uint32_t i = 0; i < kBlockTexels; ++i) {
+                    for (uint32_t c = 0; c < 4; ++c) {
+                        texels[c * kBlockTexels + i] = rgba[i * 4 + c];
+                    }
+                }
+            }
+
+            uint16_t Pack565(const float* color) {
+                uint32_t r = static_cast<uint32_t>(color[0] * (31.0f / 255.0f) + 0.5f);
+                uint32_t g = static_cast<uint32_t>(color[1] * (63.0f / 255.0f) + 0.5f);
+                uint32_t b = static_cast<uint32_t>(color[2] * (31.0f / 255.0f) + 0.5f);
+                return static_cast<uint16_t>((std::min(r, 31u) << 11) | (std::min(g, 63u) << 5) | std::min(b, 31u));
+            }
+
+            void Unpack565(uint16_t value, int* color) {
+                int r = (value >> 11) & 31;
+                int g = (value >> 5) & 63;
+                int b = value & 31;
+                color[0] = (r << 3) | (r >> 2);
+                color[1] = (g << 2) | (g >> 4);
+                color[2] = (b << 3) | (b >> 2);
+            }
+
+            // BC1 palette as the decoder builds it (4 entries of RGBA); 3-color mode has transparent black last
+            void ColorPalette(uint16_t c0, uint16_t c1, bool fourColor, int* palette) {
+                int a[3];
+                int b[3];
+                Unpack565(c0, a);
+                Unpack565(c1, b);
+                for (int c = 0; c < 3; ++c) {
+                    palette[0 * 4 + c] = a[c];
+                    palette[1 * 4 + c] = b[c];
+                    palette[2 * 4 + c] = fourColor ? (2 * a[c] + b[c]) / 3 : (a[c] + b[c]) / 2;
+                    palette[3 * 4 + c] = fourColor ? (a[c] + 2 * b[c]) / 3 : 0;
+                }
+                palette[0 * 4 + 3] = 255;
+                palette[1 * 4 + 3] = 255;
+                palette[2 * 4 + 3] = 255;
+                palette[3 * 4 + 3] = fourColor ? 255 : 0;
+            }
+
+            // BC1 color block; weights mark the texels that count (3-color mode leaves the others transparent)
+            void EncodeColor(const float* texels, const float* weights, bool threeColor, uint8_t* block) {
+                float active = 0.0f;
+                for (uint32_t i = 0; i < kBlockTexels; ++i) {
+                    active += weights[i];
+                }
+                if (active <= 0.0f) {
+                    // Fully transparent: c0 <= c1 selects 3-color mode, index 3 is transparent black
+                    std::memset(block, 0, 4);
+                    std::memset(block + 4, 0xFF, 4);
+                    return;
+                }
+
+                static const float kFourColorBlend[4] = { 1.0f, 0.0f, 2.0f / 3.0f, 1.0f / 3.0f };
+                static const float kThreeColorBlend[4] = { 1.0f, 0.0f, 0.5f, 0.0f };
+                const float* blendTable = threeColor ? kThreeColorBlend : kFourColorBlend;
+                uint32_t paletteSize = threeColor ? 3 : 4;
+
+                float high[4];
+                float low[4];
+                FitEndpoints(texels, 3, weights, low, high);
+
+                float bestError = FLT_MAX;
+                uint16_t best0 = 0;
+                uint16_t best1 = 0;
+                uint8_t bestIndices[kBlockTexels] = {};
+                for (int iteration = 0; iteration < 3; ++iteration) {
+                    uint16_t c0 = Pack565(high);
+                    uint16_t c1 = Pack565(low);
+                    int palette[16];
+                    ColorPalette(c0, c1, !threeColor, palette);
+                    float paletteF[16];
+                    for (int i = 0; i < 16; ++i) {
+                        paletteF[i] = static_cast<float>(palette[i]);
+                    }
+
+                    uint8_t indices[kBlockTexels];
+                    float error = FitIndices(texels, 3, paletteF, paletteSize, weights, indices);
+                    if (error < bestError) {
+                        bestError = error;
+                        best0 = c0;
+                        best1 = c1;
+                        std::memcpy(bestIndices, indices, sizeof(indices));
+                    }
+                    if (error == 0.0f) {
+                        break;
+                    }
+
+                    // Refit the endpoints to the chosen indices
+                    float blend[kBlockTexels];
+                    for (uint32_t i = 0; i < kBlockTexels; ++i) {
+                        blend[i] = blendTable[indices[i]];
+                    }
+                    if (!SolveEndpoints(texels, 3, weights, blend, high, low)) {
+                        break;
+                    }
+                }
+
+                // Mode comes from the endpoint order: c0 > c1 is 4-color, c0 <= c1 is 3-color
+                if (threeColor) {
+                    if (best0 > best1) {
+                        std::swap(best0, best1);
+                        for (uint8_t& index : bestIndices) {
+                            index = index < 2 ? index ^ 1 : index;
+                        }
+                    }
+                    for (uint32_t i = 0; i < kBlockTexels; ++i) {
+                        if (weights[i] <= 0.0f) {
+                            bestIndices[i] = 3;
+                        }
+                    }
+                } else if (best0 < best1) {
+                    std::swap(best0, best1);
+                    for (uint8_t& index : bestIndices) {
+                        index ^= 1;
+                    }
+                } else if (best0 == best1) {
+                    // Every palette entry is the same color
+                    std::memset(bestIndices, 0, sizeof(bestIndices));
+                }
+
+                uint32_t bits = 0;
+                for (uint32_t i = 0; i < kBlockTexels; ++i) {
+                    bits |= static_cast<uint32_t>(bestIndices[i]) << (i * 2);
+                }
+                block[0] = static_cast<uint8_t>(best0);
+                block[1] = static_cast<uint8_t>(best0 >> 8);
+                block[2] = static_cast<uint8_t>(best1);
+                block[3] = static_cast<uint8_t>(best1 >> 8);
+                std::memcpy(block + 4, &bits, sizeof(bits));
+            }
+
+            // BC4 palette (8 entries, value in [e * 4]); a0 > a1 interpolates 6 values, otherwise 4 plus 0 and 255
+            void SingleChannelPalette(int a0, int a1, int* palette) {
+                palette[0] = a0;
+                palette[4] = a1;
+                if (a0 > a1) {
+                    for (int i = 2; i < 8; ++i) {
+                        palette[i * 4] = ((8 - i) * a0 + (i - 1) * a1 + 3) / 7;
+                    }
+                } else {
+                    for (int i = 2; i < 6; ++i) {
+                        palette[i * 4] = ((6 - i) * a0 + (i - 1) * a1 + 2) / 5;
+                    }
+                    palette[6 * 4] = 0;
+                    palette[7 * 4] = 255;
+                }
+            }
+
+            void EncodeSingleChannel(const float* values, uint8_t* block) {
+                float minValue = values[0];
+                float maxValue = values[0];
+                float innerMin = 255.0f;
+                float innerMax = 0.0f;
+                for (uint32_t i = 0; i < kBlockTexels; ++i) {
+                    minValue = std::min(minValue, values[i]);
+                    maxValue = std::max(maxValue, values[i]);
+                    if (values[i] > 0.0f && values[i] < 255.0f) {
+                        innerMin = std::min(innerMin, values[i]);
+                        innerMax = std::max(innerMax, values[i]);
+                    }
+                }
+
+                // Candidate 1: 8-value ramp over the full range; candidate 2: 6-value ramp over the texels that
+                // aren't exactly 0 or 255, which the palette has for free
+                int candidates[2][2] = {
+                    { static_cast<int>(maxValue + 0.5f), static_cast<int>(minValue + 0.5f) },
+                    { static_cast<int>(std::min(innerMin, innerMax) + 0.5f), static_cast<int>(innerMax + 0.5f) }
+                };
+                float bestError = FLT_MAX;
+                int best0 = 0;
+                int best1 = 0;
+                uint8_t bestIndices[kBlockTexels] = {};
+                for (const auto& candidate : candidates) {
+                    int palette[32] = {};
+                    SingleChannelPalette(candidate[0], candidate[1], palette);
+                    float paletteF[32];
+                    for (int i = 0; i < 32; ++i) {
+                        paletteF[i] = static_cast<float>(palette[i]);
+                    }
+                    uint8_t indices[kBlockTexels];
+                    float error = FitIndices(values, 1, paletteF, 8, nullptr, indices);
+                    if (error < bestError) {
+                        bestError = error;
+                        best0 = candidate[0];
+                        best1 = candidate[1];
+                        std::memcpy(bestIndices, indices, sizeof(indices));
+                    }
+                }
+
+                uint64_t bits = 0;
+                for (uint32_t i = 0; i < kBlockTexels; ++i) {
+                    bits |= static_cast<uint64_t>(bestIndices[i]) << (i * 3);
+                }
+                block[0] = static_cast<uint8_t>(best0);
+                block[1] = static_cast<uint8_t>(best1);
+                for (int i = 0; i < 6; ++i) {
+                    block[2 + i] = static_cast<uint8_t>(bits >> (i * 8));
+                }
+            }
+
+            // Little-endian bit stream over a 16-byte block
+            struct BitWriter {
+                uint8_t* data;
+                uint32_t position = 0;
+
+                void Write(uint32_t value, uint32_t bits) {
+                    for (uint32_t i = 0; i < bits; ++i, ++position) {
+                        if ((value >> i) & 1) {
+                            data[position >> 3] |= static_cast<uint8_t>(1u << (position & 7));
+                        }
+                    }
+                }
+            };
+
+            struct BitReader {
+                const uint8_t* data;
+                uint32_t position = 0;
+
+                uint32_t Read(uint32_t bits) {
+                    uint32_t value = 0;
+                    for (uint32_t i = 0; i < bits; ++i, ++position) {
+                        value |= static_cast<uint32_t>((data[position >> 3] >> (position & 7)) & 1) << i;
+                    }
+                    return value;
+                }
+            };
+
+            struct BC7Endpoints {
+                int quantized[2][4];    // 7 bits per channel
+                int pbit[2];
+            };
+
+            // Mode 6: one subset, RGBA endpoints of 7 bits + a p-bit each, 4-bit indices
+            float EvaluateBC7(const float* texels, const float* low, const float* high, BC7Endpoints& outEndpoints,
+                              uint8_t* outIndices) {
+                float bestError = FLT_MAX;
+                for (int p = 0; p < 4; ++p) {
+                    BC7Endpoints endpoints;
+                    endpoints.pbit[0] = p & 1;
+                    endpoints.pbit[1] = p >> 1;
+                    int decoded[2][4];
+                    for (int e = 0; e < 2; ++e) {
+                        const float* source = e == 0 ? low : high;
+                        for (int c = 0; c < 4; ++c) {
+                            int q = static_cast<int>((source[c] - endpoints.pbit[e]) * 0.5f + 0.5f);
+                            q = std::min(std::max(q, 0), 127);
+                            endpoints.quantized[e][c] = q;
+                            decoded[e][c] = (q << 1) | endpoints.pbit[e];
+                        }
+                    }
+
+                    float palette[64];
+                    for (int i = 0; i < 16; ++i) {
+                        for (int c = 0; c < 4; ++c) {
+                            palette[i * 4 + c] = static_cast<float>(
+                                ((64 - kBC7Weights4[i]) * decoded[0][c] + kBC7Weights4[i] * decoded[1][c] + 32) >> 6);
+                        }
+                    }
+
+                    uint8_t indices[kBlockTexels];
+                    float error = FitIndices(texels, 4, palette, 16, nullptr, indices);
+                    if (error < bestError) {
+                        bestError = error;
+                        outEndpoints = endpoints;
+                        std::memcpy(outIndices, indices, sizeof(indices));
+                    }
+                }
+                return bestError;
+            }
+
+            void DecodeColor(const uint8_t* block, bool allowThreeColor, uint8_t* rgba) {
+                uint16_t c0 = static_cast<uint16_t>(block[0] | (block[1] << 8));
+                uint16_t c1 = static_cast<uint16_t>(block[2] | (block[3] << 8));
+                int palette[16];
+                ColorPalette(c0, c1, !allowThreeColor || c0 > c1, palette);
+                uint32_t bits;
+                std::memcpy(&bits, block + 4, sizeof(bits));
+                for (uint32_t i = 0; i < kBlockTexels; ++i) {
+                    uint32_t index = (bits >> (i * 2)) & 3;
+                    for (int c = 0; c < 4; ++c) {
+                        rgba[i * 4 + c] = static_cast<uint8_t>(palette[index * 4 + c]);
+                    }
+                }
+            }
+
+            void DecodeSingleChannel(const uint8_t* block, uint8_t* rgba, uint32_t channel) {
+                int palette[32] = {};
+                SingleChannelPalette(block[0], block[1], palette);
+                uint64_t bits = 0;
+                for (int i = 0; i < 6; ++i) {
+                    bits |= static_cast<uint64_t>(block[2 + i]) << (i * 8);
+                }
+                for (uint32_t i = 0; i < kBlockTexels; ++i) {
+                    rgba[i * 4 + channel] = static_cast<uint8_t>(palette[((bits >> (i * 3)) & 7) * 4]);
+                }
+            }
+
+            bool DecodeBC7(const uint8_t* block, uint8_t* rgba) {
+                BitReader reader{ block };
+                if (reader.Read(7) != (1u << 6)) {
+                    return false;    // Only mode 6 is written by the encoder
+                }
+                int endpoints[2][4];
+                for (int c = 0; c < 4; ++c) {
+                    endpoints[0][c] = static_cast<int>(reader.Read(7));
+                    endpoints[1][c] = static_cast<int>(reader.Read(7));
+                }
+                for (int e = 0; e < 2; ++e) {
+                    int pbit = static_cast<int>(reader.Read(1));
+                    for (int c = 0; c < 4; ++c) {
+                        endpoints[e][c] = (endpoints[e][c] << 1) | pbit;
+                    }
+                }
+                for (uint32_t i = 0; i < kBlockTexels; ++i) {
+                    int weight = kBC7Weights4[reader.Read(i == 0 ? 3 : 4)];
+                    for (int c = 0; c < 4; ++c) {
+                        rgba[i * 4 + c] = static_cast<uint8_t>(((64 - weight) * endpoints[0][c] + weight * endpoints[1][c] + 32) >> 6);
+                    }
+                }
+                return true;
+            }
+        }
+
+        void TextureCompressor::EncodeBC1Block(const uint8_t* rgba, uint8_t* block, bool allowAlpha) {
+            float texels[4 * kBlockTexels];
+            LoadBlock(rgba, texels);
+
+            float weights[kBlockTexels];
+            bool threeColor = false;
+            for (uint32_t i = 0; i < kBlockTexels; ++i) {
+                bool transparent = allowAlpha && rgba[i * 4 + 3] < 128;
+                weights[i] = transparent ? 0.0f : 1.0f;
+                threeColor = threeColor || transparent;
+            }
+            EncodeColor(texels, weights, threeColor, block);
+        }
+
+        void TextureCompressor::EncodeBC3Block(const uint8_t* rgba, uint8_t* block) {
+            float texels[4 * kBlockTexels];
+            LoadBlock(rgba, texels);
+
+            static const float kOpaque[kBlockTexels] = { 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1 };
+            EncodeSingleChannel(texels + 3 * kBlockTexels, block);
+            EncodeColor(texels, kOpaque, false, block + 8);
+        }
+
+        void TextureCompressor::EncodeBC5Block(const uint8_t* rgba, uint8_t* block) {
+            float texels[4 * kBlockTexels];
+            LoadBlock(rgba, texels);
+
+            EncodeSingleChannel(texels, block);
+            EncodeSingleChannel(texels + kBlockTexels, block + 8);
+        }
+
+        void TextureCompressor::EncodeBC7Block(const uint8_t* rgba, uint8_t* block) {
+            float texels[4 * kBlockTexels];
+            LoadBlock(rgba, texels);
+
+            float low[4];
+            float high[4];
+            FitEndpoints(texels, 4, nullptr, low, high);
+
+            BC7Endpoints endpoints = {};
+            uint8_t indices[kBlockTexels] = {};
+            float bestError = EvaluateBC7(texels, low, high, endpoints, indices);
+            for (int iteration = 0; iteration < 2 && bestError > 0.0f; ++iteration) {
+                float blend[kBlockTexels];
+                for (uint32_t i = 0; i < kBlockTexels; ++i) {
+                    blend[i] = 1.0f - kBC7Weights4[indices[i]] / 64.0f;
+                }
+                if (!SolveEndpoints(texels, 4, nullptr, blend, low, high)) {
+                    break;
+                }
+
+                BC7Endpoints refined;
+                uint8_t refinedIndices[kBlockTexels];
+                float error = EvaluateBC7(texels, low, high, refined, refinedIndices);
+                if (error >= bestError) {
+                    break;
+                }
+                bestError = error;
+                endpoints = refined;
+                std::memcpy(indices, refinedIndices, sizeof(indices));
+            }
+
+            // The anchor (first) index has an implicit 0 top bit; the weights are symmetric, so swapping the
+            // endpoints and mirroring the indices encodes the same colors
+            if (indices[0] & 8) {
+                std::swap(endpoints.quantized[0], endpoints.quantized[1]);
+                std::swap(endpoints.pbit[0], endpoints.pbit[1]);
+                for (uint8_t& index : indices) {
+                    index = static_cast<uint8_t>(15 - index);
+                }
+            }
+
+            std::memset(block, 0, 16);
+            BitWriter writer{ block };
+            writer.Write(1u << 6, 7);
+            for (int c = 0; c < 4; ++c) {
+                writer.Write(static_cast<uint32_t>(endpoints.quantized[0][c]), 7);
+                writer.Write(static_cast<uint32_t>(endpoints.quantized[1][c]), 7);
+            }
+            writer.Write(static_cast<uint32_t>(endpoints.pbit[0]), 1);
+            writer.Write(static_cast<uint32_t>(endpoints.pbit[1]), 1);
+            for (uint32_t i = 0; i < kBlockTexels; ++i) {
+                writer.Write(indices[i], i == 0 ? 3 : 4);
+            }
+        }
+
+        bool TextureCompressor::ExpandToRGBA8(const uint8_t* pixels, uint32_t width, uint32_t height, uint32_t channels,
+                                              std::vector<uint8_t>& outRGBA) {
+            if (!pixels || width == 0 || height == 0 || channels == 0 || channels > 4) {
+                return false;
+            }
+
+            size_t texelCount = static_cast<size_t>(width) * height;
+            outRGBA.resize(texelCount * 4);
+            for (size_t i = 0; i < texelCount; ++i) {
+                const uint8_t* in = pixels + i * channels;
+                uint8_t* out = &outRGBA[i * 4];
+                switch (channels) {
+                    case 1: out[0] = out[1] = out[2] = in[0]; out[3] = 255; break;
+                    case 2: out[0] = out[1] = out[2] = in[0]; out[3] = in[1]; break;
+                    case 3: out[0] = in[0]; out[1] = in[1]; out[2] = in[2]; out[3] = 255; break;
+                    default: std::memcpy(out, in, 4); break;
+                }
+            }
+            return true;
+        }
+
+        TextureEncoding TextureCompressor::ChooseEncoding(const uint8_t* rgba, uint32_t width, uint32_t height) {
+            size_t texelCount = static_cast<size_t>(width) * height;
+            for (size_t i = 0; i < texelCount; ++i) {
+                if (rgba[i * 4 + 3] != 255) {
+                    return TextureEncoding::BC7;
+                }
+            }
+            return TextureEncoding::BC1;
+        }
+
+        void TextureCompressor::GenerateMips(const uint8_t* rgba, uint32_t width, uint32_t height, bool srgb,
+                                             MipFilter filter, uint32_t threadCount, std::vector<Level>& outLevels) {
+            outLevels.clear();
+            if (!rgba || width == 0 || height == 0) {
+                return;
+            }
+
+            Level base;
+            base.width = width;
+            base.height = height;
+            base.data.assign(rgba, rgba + static_cast<size_t>(width) * height * 4);
+            outLevels.push_back(std::move(base));
+
+            // Filter in linear light; each level is reduced from the float copy of the one above it, so 8-bit
+            // rounding doesn't accumulate down the chain
+            const float* toLinear = SRGBToLinearTable();
+            std::vector<float> current(static_cast<size_t>(width) * height * 4);
+            for (size_t i = 0; i < current.size(); ++i) {
+                bool color = srgb && (i & 3) != 3;
+                current[i] = color ? toLinear[rgba[i]] : rgba[i] / 255.0f;
+            }
+
+            Kernel kernel = MakeKernel(filter);
+            std::vector<float> reducedRows;
+            std::vector<float> next;
+            uint32_t mipCount = GetMipCount(width, height);
+            for (uint32_t level = 1; level < mipCount; ++level) {
+                Reduce(current, width, height, true, kernel, threadCount, reducedRows);
+                width = std::max(1u, width >> 1);
+                Reduce(reducedRows, width, height, false, kernel, threadCount, next);
+                height = std::max(1u, height >> 1);
+
+                Level mip;
+                mip.width = width;
+                mip.height = height;
+                mip.data.resize(next.size());
+                for (size_t i = 0; i < next.size(); ++i) {
+                    bool color = srgb && (i & 3) != 3;
+                    mip.data[i] = color ? LinearToSRGB8(next[i]) : ToUnorm8(next[i]);
+                }
+                outLevels.push_back(std::move(mip));
+                current.swap(next);
+            }
+        }
+
+        bool TextureCompressor::Encode(const uint8_t* rgba, uint32_t width, uint32_t height, TextureEncoding encoding,
+                                       uint32_t threadCount, std::vector<uint8_t>& outData) {
+            if (!rgba || width == 0 || height == 0) {
+                return false;
+            }
+            if (encoding == TextureEncoding::RGBA8) {
+                outData.assign(rgba, rgba + static_cast<size_t>(width) * height * 4);
+                return true;
+            }
+
+            uint32_t blockBytes = GetBlockBytes(encoding);
+            if (blockBytes == 0) {
+                return false;
+            }
+
+            uint32_t blocksX = (width + 3) / 4;
+            uint32_t blocksY = (height + 3) / 4;
+            outData.resize(static_cast<size_t>(blocksX) * blocksY * blockBytes);
+            ParallelFor(blocksY, threadCount, [&](uint32_t by) {
+                uint8_t texels[kBlockTexels * 4];
+                for (uint32_t bx = 0; bx < blocksX; ++bx) {
+                    for (uint32_t i = 0; i < kBlockTexels; ++i) {
+                        uint32_t x = std::min(bx * 4 + (i & 3), width - 1);
+                        uint32_t y = std::min(by * 4 + (i >> 2), height - 1);
+                        std::memcpy(texels + i * 4, rgba + (static_cast<size_t>(y) * width + x) * 4, 4);
+                    }
+
+                    uint8_t* block = &outData[(static_cast<size_t>(by) * blocksX + bx) * blockBytes];
+                    switch (encoding) {
+                        case TextureEncoding::BC1: EncodeBC1Block(texels, block, true); break;
+                        case TextureEncoding::BC3: EncodeBC3Block(texels, block); break;
+                        case TextureEncoding::BC5: EncodeBC5Block(texels, block); break;
+                        default: EncodeBC7Block(texels, block); break;
+                    }
+                }
+            });
+            return true;
+        }
+
+        bool TextureCompressor::Decode(const uint8_t* data, uint32_t width, uint32_t height, TextureEncoding encoding,
+                                       std::vector<uint8_t>& outRGBA) {
+            if (!data || width == 0 || height == 0) {
+                return false;
+            }
+            if (encoding == TextureEncoding::RGBA8) {
+                outRGBA.assign(data, data + static_cast<size_t>(width) * height * 4);
+                return true;
+            }
+
+            uint32_t blockBytes = GetBlockBytes(encoding);
+            if (blockBytes == 0) {
+                return false;
+            }
+
+            uint32_t blocksX = (width + 3) / 4;
+            uint32_t blocksY = (height + 3) / 4;
+            outRGBA.resize(static_cast<size_t>(width) * height * 4);
+            for (uint32_t by = 0; by < blocksY; ++by) {
+                for (uint32_t bx = 0; bx < blocksX; ++bx) {
+                    const uint8_t* block = data + (static_cast<size_t>(by) * blocksX + bx) * blockBytes;
+                    uint8_t texels[kBlockTexels * 4];
+                    switch (encoding) {
+                        case TextureEncoding::BC1:
+                            DecodeColor(block, true, texels);
+                            break;
+                        case TextureEncoding::BC3:
+                            DecodeColor(block + 8, false, texels);
+                            DecodeSingleChannel(block, texels, 3);
+                            break;
+                        case TextureEncoding::BC5:
+                            DecodeSingleChannel(block, texels, 0);
+                            DecodeSingleChannel(block + 8, texels, 1);
+                            for (uint32_t i = 0; i < kBlockTexels; ++i) {
+                                texels[i * 4 + 2] = 0;
+                                texels[i * 4 + 3] = 255;
+                            }
+                            break;
+                        default:
+                            if (!DecodeBC7(block, texels)) {
+                                return false;
+                            }
+                            break;
+                    }
+
+                    for (uint32_t i = 0; i < kBlockTexels; ++i) {
+                        uint32_t x = bx * 4 + (i & 3);
+                        uint32_t y = by * 4 + (i >> 2);
+                        if (x < width && y < height) {
+                            std::memcpy(&outRGBA[(static_cast<size_t>(y) * width + x) * 4], texels + i * 4, 4);
+                        }
+                    }
+                }
+            }
+            return true;
+        }
+
+        uint32_t TextureCompressor::GetBlockBytes(TextureEncoding encoding) {
+            switch (encoding) {
+                case TextureEncoding::BC1: return 8;
+                case TextureEncoding::BC3:
+                case TextureEncoding::BC5:
+                case TextureEncoding::BC7: return 16;
+                default: return 0;
+            }
+        }
+
+        uint64_t TextureCompressor::GetEncodedSize(uint32_t width, uint32_t height, TextureEncoding encoding) {
+            uint32_t blockBytes = GetBlockBytes(encoding);
+            if (blockBytes == 0) {
+                return static_cast<uint64_t>(width) * height * 4;
+            }
+            return static_cast<uint64_t>((width + 3) / 4) * ((height + 3) / 4) * blockBytes;
+        }
+
+        uint32_t TextureCompressor::GetMipCount(uint32_t width, uint32_t height) {
+            uint32_t count = 1;
+            for (uint32_t size = std::max(width, height); size > 1; size >>= 1) {
+                ++count;
+            }
+            return count;
+        }
+
+        const char* TextureCompressor::GetEncodingName(TextureEncoding encoding) {
+            switch (encoding) {
+                case TextureEncoding::RGBA8: return "RGBA8";
+                case TextureEncoding::BC1: return "BC1";
+                case TextureEncoding::BC3: return "BC3";
+                case TextureEncoding::BC5: return "BC5";
+                case TextureEncoding::BC7: return "BC7";
+                case TextureEncoding::Auto: return "Auto";
+                default: return "Unknown";
+            }
+        }
+
+    } // namespace Resources
+} // namespace FirstEngine
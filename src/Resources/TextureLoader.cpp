@@ -1,6 +1,7 @@
 #include "FirstEngine/Resources/TextureLoader.h"
 #include "FirstEngine/Resources/ResourceXMLParser.h"
 #include "FirstEngine/Resources/ResourceProvider.h"
+#include "FirstEngine/Resources/CookedTextureFormat.h"
 #if __has_include(<filesystem>)
 #include <filesystem>
 namespace fs = std::filesystem;
@@ -8,11 +9,23 @@ namespace fs = std::filesystem;
 #include <experimental/filesystem>
 namespace fs = std::experimental::filesystem;
 #endif
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
 #include <iostream>
+#include <thread>
 
 namespace FirstEngine {
     namespace Resources {
 
+        namespace {
+            uint64_t AlignUp(uint64_t value) {
+                return (value + CookedTexture::kAlignment - 1) & ~(CookedTexture::kAlignment - 1);
+            }
+        }
+
         TextureLoader::LoadResult TextureLoader::Load(ResourceID id) {
             LoadResult result;
             result.success = false;
@@ -41,9 +54,9 @@ namespace FirstEngine {
                 xmlFilePath = fs::path(xmlFilePath).replace_extension(".xml").string();
             }
 
-            // Parse XML file
+            // Parse XML file (from the package archive if one is mounted)
             ResourceXMLParser parser;
-            if (!parser.ParseFromFile(xmlFilePath)) {
+            if (!resourceManager.ParseDescriptor(xmlFilePath, parser)) {
                 return result;
             }
 
@@ -63,21 +76,38 @@ namespace FirstEngine {
             // Resolve image file path relative to XML file directory
             std::string xmlDir = fs::path(xmlFilePath).parent_path().string();
             std::string imagePath = textureData.imageFile;
+            result.cookedFile = textureData.cookedFile;
+
+            if (!textureData.cookedFile.empty()) {
+                // Cooked texture: map the file, mips are used in place
+                std::string cookedPath = textureData.cookedFile;
+                if (!fs::path(cookedPath).is_absolute()) {
+                    cookedPath = (fs::path(xmlDir) / cookedPath).string();
+                }
+                if (!ReadCooked(cookedPath, result)) {
+                    return result;
+                }
+
+                result.metadata.isLoaded = true;
+                result.success = true;
+                return result;
+            }
             
             // If image path is relative, resolve it relative to XML file
             if (!fs::path(imagePath).is_absolute()) {
                 imagePath = (fs::path(xmlDir) / imagePath).string();
             }
 
-            // Check if image file exists
-            if (!fs::exists(imagePath)) {
+            // Read the image file (from the package archive if one is mounted)
+            std::shared_ptr<MappedFile> imageFile = resourceManager.OpenFile(imagePath);
+            if (!imageFile) {
                 std::cerr << "TextureLoader::Load: Image file not found: " << imagePath << std::endl;
                 std::cerr << "  Texture ID: " << id << ", XML file: " << xmlFilePath << std::endl;
                 return result;
             }
             
             // Load image data using ImageLoader
-            result.imageData = ImageLoader::LoadFromFile(imagePath);
+            result.imageData = ImageLoader::LoadFromMemory(imageFile->GetData(), static_cast<size_t>(imageFile->GetSize()), imagePath);
             if (result.imageData.data.empty()) {
                 std::cerr << "TextureLoader::Load: Failed to load image data from: " << imagePath << std::endl;
                 std::cerr << "  Texture ID: " << id << std::endl;
@@ -105,7 +135,8 @@ namespace FirstEngine {
                                        uint32_t width,
                                        uint32_t height,
                                        uint32_t channels,
-                                       bool hasAlpha) {
+                                       bool hasAlpha,
+                                       const std::string& cookedFile) {
             // Create relative path from XML file to image file
             std::string xmlDir = fs::path(xmlFilePath).parent_path().string();
             std::string imageDir = fs::path(imageFilePath).parent_path().string();
@@ -143,6 +174,7 @@ namespace FirstEngine {
 
             ResourceXMLParser::TextureData textureData;
             textureData.imageFile = relativeImagePath;
+            textureData.cookedFile = cookedFile;
             textureData.width = width;
             textureData.height = height;
             textureData.channels = channels;
@@ -151,6 +183,204 @@ namespace FirstEngine {
             return ResourceXMLParser::SaveTextureToXML(xmlFilePath, name, id, textureData);
         }
 
+        bool TextureLoader::Cook(const std::string& sourcePath, const std::string& cookedPath, const TextureCookOptions& options) {
+            ImageData image = ImageLoader::LoadFromFile(sourcePath);
+            if (image.data.empty()) {
+                std::cerr << "TextureLoader::Cook: Failed to load " << sourcePath << std::endl;
+                return false;
+            }
+
+            std::vector<uint8_t> rgba;
+            bool expanded = TextureCompressor::ExpandToRGBA8(image.data.data(), image.width, image.height, image.channels, rgba);
+            uint32_t width = image.width;
+            uint32_t height = image.height;
+            uint32_t channels = image.channels;
+            bool hasAlpha = image.hasAlpha || image.channels == 2;
+            ImageLoader::FreeImageData(image);
+            if (!expanded) {
+                std::cerr << "TextureLoader::Cook: Unsupported channel count " << channels << " in " << sourcePath << std::endl;
+                return false;
+            }
+            if (TextureCompressor::GetMipCount(width, height) > CookedTexture::kMaxMips) {
+                std::cerr << "TextureLoader::Cook: " << sourcePath << " is too large (" << width << "x" << height << ")" << std::endl;
+                return false;
+            }
+
+            TextureEncoding encoding = options.encoding;
+            if (encoding == TextureEncoding::Auto) {
+                encoding = TextureCompressor::ChooseEncoding(rgba.data(), width, height);
+            }
+            // Two-channel data (normal map XY) is never color
+            bool srgb = options.srgb && encoding != TextureEncoding::BC5;
+            uint32_t threadCount = options.threadCount != 0 ? options.threadCount
+                                                            : std::max(1u, std::thread::hardware_concurrency());
+
+            auto start = std::chrono::steady_clock::now();
+            std::vector<TextureCompressor::Level> levels;
+            if (options.generateMips) {
+                TextureCompressor::GenerateMips(rgba.data(), width, height, srgb, options.mipFilter, threadCount, levels);
+            } else {
+                TextureCompressor::Level level;
+                level.width = width;
+                level.height = height;
+                level.data = std::move(rgba);
+                levels.push_back(std::move(level));
+            }
+
+            uint64_t uncompressedBytes = static_cast<uint64_t>(width) * height * 4;
+            uint64_t cookedBytes = 0;
+            for (TextureCompressor::Level& level : levels) {
+                std::vector<uint8_t> encoded;
+                if (!TextureCompressor::Encode(level.data.data(), level.width, level.height, encoding, threadCount, encoded)) {
+                    std::cerr << "TextureLoader::Cook: Failed to encode " << sourcePath << std::endl;
+                    return false;
+                }
+                level.data = std::move(encoded);
+                cookedBytes += level.data.size();
+            }
+            double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+            std::cout << "TextureLoader::Cook: " << fs::path(sourcePath).filename().string() << " " << width << "x" << height
+                      << ", " << levels.size() << " mips, " << TextureCompressor::GetEncodingName(encoding)
+                      << (srgb ? " (sRGB)" : " (linear)") << std::endl;
+            std::cout << "  Size: " << uncompressedBytes << " bytes RGBA8 (mip 0) -> " << cookedBytes << " bytes ("
+                      << std::fixed << std::setprecision(2)
+                      << static_cast<double>(uncompressedBytes) / static_cast<double>(std::max<uint64_t>(cookedBytes, 1))
+                      << "x), " << std::setprecision(1) << seconds * 1000.0 << " ms on " << threadCount << " threads"
+                      << std::defaultfloat << std::endl;
+
+            return WriteCooked(cookedPath, levels, encoding, srgb, channels, hasAlpha);
+        }
+
+        bool TextureLoader::WriteCooked(const std::string& cookedPath, const std::vector<TextureCompressor::Level>& levels,
+                                        TextureEncoding encoding, bool srgb, uint32_t channels, bool hasAlpha) {
+            if (levels.empty() || levels.size() > CookedTexture::kMaxMips || encoding == TextureEncoding::Auto) {
+                std::cerr << "TextureLoader::WriteCooked: Invalid mip chain for " << cookedPath << std::endl;
+                return false;
+            }
+
+            CookedTextureHeader header = {};
+            header.magic = CookedTexture::kMagic;
+            header.version = CookedTexture::kVersion;
+            header.width = levels[0].width;
+            header.height = levels[0].height;
+            header.mipCount = static_cast<uint32_t>(levels.size());
+            header.encoding = static_cast<uint32_t>(encoding);
+            header.flags = (srgb ? CookedTexture::kFlagSRGB : 0) | (hasAlpha ? CookedTexture::kFlagAlpha : 0);
+            header.channels = channels;
+            header.mipsOffset = sizeof(CookedTextureHeader);
+
+            std::vector<CookedTextureMip> mips(levels.size());
+            uint64_t offset = AlignUp(header.mipsOffset + mips.size() * sizeof(CookedTextureMip));
+            for (size_t i = 0; i < levels.size(); ++i) {
+                mips[i] = {};
+                mips[i].offset = offset;
+                mips[i].size = levels[i].data.size();
+                mips[i].width = levels[i].width;
+                mips[i].height = levels[i].height;
+                offset = AlignUp(offset + mips[i].size);
+            }
+            header.fileSize = offset;
+
+            std::ofstream file(cookedPath, std::ios::binary | std::ios::trunc);
+            if (!file) {
+                std::cerr << "TextureLoader::WriteCooked: Failed to open " << cookedPath << " for writing" << std::endl;
+                return false;
+            }
+
+            auto padTo = [&file](uint64_t target) {
+                static const char zeros[CookedTexture::kAlignment] = {};
+                uint64_t position = static_cast<uint64_t>(file.tellp());
+                if (target > position) {
+                    file.write(zeros, static_cast<std::streamsize>(target - position));
+                }
+            };
+
+            file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+            file.write(reinterpret_cast<const char*>(mips.data()),
+                       static_cast<std::streamsize>(mips.size() * sizeof(CookedTextureMip)));
+            for (size_t i = 0; i < levels.size(); ++i) {
+                padTo(mips[i].offset);
+                file.write(reinterpret_cast<const char*>(levels[i].data.data()), static_cast<std::streamsize>(mips[i].size));
+            }
+            padTo(header.fileSize);
+
+            if (!file) {
+                std::cerr << "TextureLoader::WriteCooked: Failed to write " << cookedPath << std::endl;
+                return false;
+            }
+            return true;
+        }
+
+        bool TextureLoader::ReadCooked(const std::string& cookedPath, LoadResult& result) {
+            // Mapped from disk, or a view of the mounted package archive
+            std::shared_ptr<MappedFile> file = ResourceManager::GetInstance().OpenFile(cookedPath);
+            if (!file) {
+                return false;
+            }
+
+            const uint8_t* data = file->GetData();
+            uint64_t size = file->GetSize();
+            auto fail = [&cookedPath](const char* reason) {
+                std::cerr << "TextureLoader::ReadCooked: " << cookedPath << ": " << reason << std::endl;
+                return false;
+            };
+            auto inRange = [size](uint64_t offset, uint64_t bytes) {
+                return offset % CookedTexture::kAlignment == 0 && offset <= size && bytes <= size - offset;
+            };
+
+            if (size < sizeof(CookedTextureHeader)) {
+                return fail("File too small");
+            }
+            CookedTextureHeader header;
+            std::memcpy(&header, data, sizeof(header));
+            if (header.magic != CookedTexture::kMagic) {
+                return fail("Not a cooked texture");
+            }
+            if (header.version != CookedTexture::kVersion) {
+                return fail("Unsupported version, re-import the texture");
+            }
+            if (header.fileSize != size || header.mipCount == 0 || header.mipCount > CookedTexture::kMaxMips ||
+                !inRange(header.mipsOffset, static_cast<uint64_t>(header.mipCount) * sizeof(CookedTextureMip))) {
+                return fail("Truncated or corrupt");
+            }
+
+            TextureEncoding encoding = static_cast<TextureEncoding>(header.encoding);
+            if (encoding != TextureEncoding::RGBA8 && TextureCompressor::GetBlockBytes(encoding) == 0) {
+                return fail("Unknown encoding");
+            }
+
+            const auto* mips = reinterpret_cast<const CookedTextureMip*>(data + header.mipsOffset);
+            result.mips.clear();
+            uint32_t width = header.width;
+            uint32_t height = header.height;
+            for (uint32_t i = 0; i < header.mipCount; ++i) {
+                if (mips[i].width != width || mips[i].height != height ||
+                    mips[i].size != TextureCompressor::GetEncodedSize(width, height, encoding) ||
+                    !inRange(mips[i].offset, mips[i].size)) {
+                    return fail("Mip table does not match the texture size");
+                }
+                TextureMip mip;
+                mip.data = data + mips[i].offset;
+                mip.size = mips[i].size;
+                mip.width = width;
+                mip.height = height;
+                result.mips.push_back(mip);
+                width = std::max(1u, width >> 1);
+                height = std::max(1u, height >> 1);
+            }
+
+            result.imageData.data.clear();
+            result.imageData.width = header.width;
+            result.imageData.height = header.height;
+            result.imageData.channels = header.channels;
+            result.imageData.hasAlpha = (header.flags & CookedTexture::kFlagAlpha) != 0;
+            result.encoding = encoding;
+            result.srgb = (header.flags & CookedTexture::kFlagSRGB) != 0;
+            result.mappedFile = std::move(file);
+            return true;
+        }
+
         bool TextureLoader::IsFormatSupported(const std::string& filepath) {
             std::string ext = fs::path(filepath).extension().string();
             std::transform(ext.begin(), ext.end(), ext.begin(), ::tolower);
@@ -46,6 +46,28 @@ namespace FirstEngine {
             return true;
         }
 
+        bool TextureResource::InitializeCooked(std::shared_ptr<MappedFile> mappedFile, const std::vector<TextureMip>& mips,
+                                               TextureEncoding encoding, bool srgb, uint32_t channels, bool hasAlpha) {
+            if (!mappedFile || mips.empty() || mips[0].width == 0 || mips[0].height == 0) {
+                return false;
+            }
+
+            m_Data.clear();
+            m_MappedFile = std::move(mappedFile);
+            m_Mips = mips;
+            m_Encoding = encoding;
+            m_SRGB = srgb;
+            m_Width = mips[0].width;
+            m_Height = mips[0].height;
+            m_Channels = channels;
+            m_HasAlpha = hasAlpha;
+
+            m_Metadata.isLoaded = true;
+            m_Metadata.fileSize = m_MappedFile->GetSize();
+
+            return true;
+        }
+
         // IResourceProvider interface implementation
         bool TextureResource::IsFormatSupported(const std::string& filepath) const {
             // First check by file extension (faster and more reliable)
@@ -113,18 +135,27 @@ namespace FirstEngine {
             // Use returned Metadata
             m_Metadata = loadResult.metadata;
             m_Metadata.resourceID = id; // Ensure ID matches
+            m_CookedFile = loadResult.cookedFile;
 
-            // Use returned Handle data (imageData) to initialize resource
-            if (!Initialize(loadResult.imageData.data, 
-                          loadResult.imageData.width, 
-                          loadResult.imageData.height, 
-                          loadResult.imageData.channels, 
-                          loadResult.imageData.hasAlpha)) {
+            if (loadResult.mappedFile) {
+                // Cooked texture: keep the mapping, RenderTexture uploads the mips straight from it
+                if (!InitializeCooked(loadResult.mappedFile, loadResult.mips, loadResult.encoding, loadResult.srgb,
+                                      loadResult.imageData.channels, loadResult.imageData.hasAlpha)) {
+                    return ResourceLoadResult::InvalidFormat;
+                }
+            } else {
+                // Use returned Handle data (imageData) to initialize resource
+                bool initialized = Initialize(loadResult.imageData.data, 
+                                              loadResult.imageData.width, 
+                                              loadResult.imageData.height, 
+                                              loadResult.imageData.channels, 
+                                              loadResult.imageData.hasAlpha);
                 ImageLoader::FreeImageData(loadResult.imageData);
-                return ResourceLoadResult::InvalidFormat;
+                if (!initialized) {
+                    return ResourceLoadResult::InvalidFormat;
+                }
             }
 
-            ImageLoader::FreeImageData(loadResult.imageData);
             m_Metadata.isLoaded = true;
 
             // Create RenderTexture after texture data is loaded
@@ -145,7 +176,7 @@ namespace FirstEngine {
             imageFilePath = fs::path(imageFilePath).replace_extension(".png").string(); // Default to PNG
 
             return TextureLoader::Save(xmlFilePath, m_Metadata.name, m_Metadata.resourceID,
-                                      imageFilePath, m_Width, m_Height, m_Channels, m_HasAlpha);
+                                      imageFilePath, m_Width, m_Height, m_Channels, m_HasAlpha, m_CookedFile);
         }
 
         bool TextureResource::CreateRenderTexture() {
@@ -158,7 +189,7 @@ namespace FirstEngine {
             }
 
             // Check if texture data is loaded
-            if (m_Data.empty() || m_Width == 0 || m_Height == 0) {
+            if ((m_Data.empty() && m_Mips.empty()) || m_Width == 0 || m_Height == 0) {
                 return false;
             }
 
@@ -181,7 +212,7 @@ namespace FirstEngine {
                 return false;
             }
             auto* renderTexture = static_cast<Renderer::RenderTexture*>(m_RenderTexture);
-            return renderTexture && renderTexture->IsCreated();
+            return renderTexture && renderTexture->IsReady();
         }
 
         bool TextureResource::GetRenderData(RenderData& outData) const {
@@ -189,7 +220,7 @@ namespace FirstEngine {
                 return false;
             }
             auto* renderTexture = static_cast<Renderer::RenderTexture*>(m_RenderTexture);
-            if (!renderTexture || !renderTexture->IsCreated()) {
+            if (!renderTexture || !renderTexture->IsReady()) {
                 return false;
             }
 
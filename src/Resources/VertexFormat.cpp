@@ -5,22 +5,29 @@
 namespace FirstEngine {
     namespace Resources {
 
-        void VertexFormat::AddAttribute(VertexAttributeType type, uint32_t location) {
+        bool VertexFormat::AddAttribute(VertexAttributeType type, uint32_t location, VertexAttributeEncoding encoding) {
             // Check if attribute already exists
             for (const auto& attr : m_Attributes) {
                 if (attr.type == type) {
-                    return; // Already exists
+                    return true; // Already exists
                 }
             }
 
+            uint32_t size = GetVertexAttributeSize(type, encoding);
+            if (size == 0) {
+                return false;
+            }
+
             VertexAttribute attr;
             attr.type = type;
             attr.offset = m_Stride;
-            attr.size = GetVertexAttributeSize(type);
+            attr.size = size;
             attr.location = (location != UINT32_MAX) ? location : static_cast<uint32_t>(m_Attributes.size());
+            attr.encoding = encoding;
 
             m_Attributes.push_back(attr);
             UpdateStride();
+            return true;
         }
 
         bool VertexFormat::HasAttribute(VertexAttributeType type) const {
@@ -41,6 +48,15 @@ namespace FirstEngine {
             return nullptr;
         }
 
+        bool VertexFormat::IsQuantized() const {
+            for (const auto& attr : m_Attributes) {
+                if (attr.encoding != VertexAttributeEncoding::Float) {
+                    return true;
+                }
+            }
+            return false;
+        }
+
         bool VertexFormat::MatchesShaderInputs(const std::vector<VertexAttributeType>& requiredAttributes) const {
             for (VertexAttributeType required : requiredAttributes) {
                 if (!HasAttribute(required)) {
@@ -191,6 +207,9 @@ namespace FirstEngine {
             for (size_t i = 0; i < m_Attributes.size(); ++i) {
                 if (i > 0) oss << ", ";
                 oss << GetVertexAttributeTypeName(m_Attributes[i].type);
+                if (m_Attributes[i].encoding != VertexAttributeEncoding::Float) {
+                    oss << ":" << GetVertexAttributeEncodingName(m_Attributes[i].encoding);
+                }
             }
             oss << "])";
             return oss.str();
@@ -208,7 +227,41 @@ namespace FirstEngine {
             }
         }
 
-        uint32_t GetVertexAttributeSize(VertexAttributeType type) {
+        const char* GetVertexAttributeEncodingName(VertexAttributeEncoding encoding) {
+            switch (encoding) {
+                case VertexAttributeEncoding::Float: return "Float";
+                case VertexAttributeEncoding::Snorm16: return "Snorm16";
+                case VertexAttributeEncoding::Octahedral: return "Octahedral";
+                case VertexAttributeEncoding::Half: return "Half";
+                case VertexAttributeEncoding::Unorm16: return "Unorm16";
+                case VertexAttributeEncoding::Unorm8: return "Unorm8";
+                default: return "Unknown";
+            }
+        }
+
+        uint32_t GetVertexAttributeSize(VertexAttributeType type, VertexAttributeEncoding encoding) {
+            bool isDirection = type == VertexAttributeType::Normal || type == VertexAttributeType::Tangent;
+            bool isTexCoord = type == VertexAttributeType::TexCoord0 || type == VertexAttributeType::TexCoord1;
+            switch (encoding) {
+                case VertexAttributeEncoding::Float:
+                    break;
+                case VertexAttributeEncoding::Snorm16:
+                    return isDirection ? 4 * sizeof(int16_t) : 0;
+                case VertexAttributeEncoding::Octahedral:
+                    return isDirection ? 2 * sizeof(int16_t) : 0;
+                case VertexAttributeEncoding::Half:
+                    return isTexCoord ? 2 * sizeof(uint16_t) : 0;
+                case VertexAttributeEncoding::Unorm16:
+                    if (isTexCoord) {
+                        return 2 * sizeof(uint16_t);
+                    }
+                    return type == VertexAttributeType::Position ? 4 * sizeof(uint16_t) : 0;
+                case VertexAttributeEncoding::Unorm8:
+                    return type == VertexAttributeType::Color0 ? 4 * sizeof(uint8_t) : 0;
+                default:
+                    return 0;
+            }
+
             switch (type) {
                 case VertexAttributeType::Position: return sizeof(glm::vec3);  // 12 bytes
                 case VertexAttributeType::Normal: return sizeof(glm::vec3);    // 12 bytes
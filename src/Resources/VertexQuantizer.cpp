@@ -0,0 +1,427 @@
+#include "FirstEngine/Resources/VertexQuantizer.h"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <iostream>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define FE_VERTEX_QUANTIZER_SSE2 1
+#include <emmintrin.h>
+#endif
+
+namespace FirstEngine {
+    namespace Resources {
+
+        namespace {
+            constexpr float kSnorm16Max = 32767.0f;
+            constexpr float kUnorm16Max = 65535.0f;
+            constexpr float kUnorm8Max = 255.0f;
+            // Octahedral tangents give up the low bit of y to the handedness sign
+            constexpr float kTangentYMax = 16383.0f;
+
+            float Clamp(float value, float low, float high) {
+                // Written so NaN ends up at 'low'
+                return value > low ? (value < high ? value : high) : low;
+            }
+
+            // Round to nearest even, like _mm_cvtps_epi32 in the default rounding mode
+            int32_t RoundToInt(float value) {
+                return static_cast<int32_t>(std::nearbyint(value));
+            }
+
+            uint32_t FloatBits(float value) {
+                uint32_t bits;
+                std::memcpy(&bits, &value, sizeof(bits));
+                return bits;
+            }
+
+            float BitsToFloat(uint32_t bits) {
+                float value;
+                std::memcpy(&value, &bits, sizeof(value));
+                return value;
+            }
+
+            // float -> half, rounding to nearest (ties away from zero); overflow goes to infinity, NaN stays NaN
+            // Scalar twin of the SSE2 kernel below, so both paths produce identical bits
+            uint16_t FloatToHalf(float value) {
+                const uint32_t f32Infinity = 255u << 23;
+                const uint32_t f16Infinity = 31u << 23;
+                const uint32_t roundMask = ~0xFFFu;
+                const float magic = BitsToFloat(15u << 23);
+
+                uint32_t bits = FloatBits(value);
+                uint32_t sign = bits & 0x80000000u;
+                bits ^= sign;
+
+                uint32_t half;
+                if (bits >= f32Infinity) {
+                    half = bits > f32Infinity ? 0x7E00u : 0x7C00u;
+                } else {
+                    // Rebias the exponent by multiplying, then round on the 13 bits that are shifted out
+                    uint32_t scaled = FloatBits(BitsToFloat(bits & roundMask) * magic) - roundMask;
+                    half = std::min(scaled, f16Infinity) >> 13;
+                }
+                return static_cast<uint16_t>(half | (sign >> 16));
+            }
+
+#ifdef FE_VERTEX_QUANTIZER_SSE2
+            __m128 Clamp4(__m128 value, __m128 low, __m128 high) {
+                return _mm_min_ps(_mm_max_ps(value, low), high);
+            }
+
+            // 8 int32 lanes in [0, 65535] -> 8 uint16 (SSE2 only has a signed saturating pack)
+            __m128i PackUnsigned16(__m128i low, __m128i high) {
+                const __m128i bias32 = _mm_set1_epi32(0x8000);
+                const __m128i bias16 = _mm_set1_epi16(static_cast<int16_t>(0x8000));
+                __m128i packed = _mm_packs_epi32(_mm_sub_epi32(low, bias32), _mm_sub_epi32(high, bias32));
+                return _mm_xor_si128(packed, bias16);
+            }
+
+            __m128i FloatToHalf4(__m128 value) {
+                const __m128i signMask = _mm_set1_epi32(static_cast<int32_t>(0x80000000u));
+                const __m128i roundMask = _mm_set1_epi32(~0xFFF);
+                const __m128i f32Infinity = _mm_set1_epi32(255 << 23);
+                const __m128i magic = _mm_set1_epi32(15 << 23);
+                const __m128i nanBit = _mm_set1_epi32(0x200);
+                const __m128i f16Infinity = _mm_set1_epi32(0x7C00);
+                // Largest pre-rounding value that still rounds to a finite half or to infinity exactly
+                const __m128i clampValue = _mm_set1_epi32((31 << 23) - 0x1000);
+
+                __m128 sign = _mm_and_ps(value, _mm_castsi128_ps(signMask));
+                __m128 absolute = _mm_xor_ps(value, sign);
+                __m128i absoluteBits = _mm_castps_si128(absolute);
+
+                __m128i isNaN = _mm_cmpgt_epi32(absoluteBits, f32Infinity);
+                __m128i isFinite = _mm_cmpgt_epi32(f32Infinity, absoluteBits);
+                __m128i infOrNaN = _mm_or_si128(_mm_and_si128(isNaN, nanBit), f16Infinity);
+
+                __m128 truncated = _mm_and_ps(absolute, _mm_castsi128_ps(roundMask));
+                __m128 scaled = _mm_mul_ps(truncated, _mm_castsi128_ps(magic));
+                __m128 clamped = _mm_min_ps(scaled, _mm_castsi128_ps(clampValue));
+                __m128i rounded = _mm_sub_epi32(_mm_castps_si128(clamped), roundMask);
+                __m128i finite = _mm_and_si128(_mm_srli_epi32(rounded, 13), isFinite);
+                __m128i special = _mm_andnot_si128(isFinite, infOrNaN);
+
+                __m128i signBits = _mm_srli_epi32(_mm_castps_si128(sign), 16);
+                return _mm_or_si128(_mm_or_si128(finite, special), signBits);
+            }
+#endif
+
+            // Attribute data is gathered into a contiguous float array, encoded by a kernel into a contiguous
+            // typed array and then scattered into the interleaved vertices
+            void Scatter(const void* encoded, uint32_t elementSize, uint32_t vertexCount,
+                         uint8_t* vertices, uint32_t stride, uint32_t offset) {
+                const uint8_t* source = static_cast<const uint8_t*>(encoded);
+                for (uint32_t i = 0; i < vertexCount; ++i) {
+                    std::memcpy(vertices + static_cast<size_t>(i) * stride + offset, source + static_cast<size_t>(i) * elementSize,
+                                elementSize);
+                }
+            }
+
+            void Gather(const uint8_t* vertices, uint32_t stride, uint32_t offset, uint32_t componentCount,
+                        uint32_t vertexCount, uint32_t outComponentCount, std::vector<float>& outComponents) {
+                outComponents.assign(static_cast<size_t>(vertexCount) * outComponentCount, 0.0f);
+                uint32_t copied = std::min(componentCount, outComponentCount);
+                for (uint32_t i = 0; i < vertexCount; ++i) {
+                    std::memcpy(&outComponents[static_cast<size_t>(i) * outComponentCount],
+                                vertices + static_cast<size_t>(i) * stride + offset, copied * sizeof(float));
+                }
+            }
+
+            bool TexCoordsInUnitRange(const uint8_t* vertices, uint32_t stride, uint32_t offset, uint32_t vertexCount) {
+                for (uint32_t i = 0; i < vertexCount; ++i) {
+                    float uv[2];
+                    std::memcpy(uv, vertices + static_cast<size_t>(i) * stride + offset, sizeof(uv));
+                    if (!(uv[0] >= 0.0f && uv[0] <= 1.0f && uv[1] >= 0.0f && uv[1] <= 1.0f)) {
+                        return false;
+                    }
+                }
+                return true;
+            }
+        }
+
+        VertexFormat VertexQuantizer::ChooseFormat(const VertexFormat& source, const uint8_t* vertexData,
+                                                   uint32_t vertexCount, const Options& options) {
+            VertexFormat target;
+            for (const VertexAttribute& attr : source.GetAttributes()) {
+                VertexAttributeEncoding encoding = VertexAttributeEncoding::Float;
+                if (attr.encoding == VertexAttributeEncoding::Float) {
+                    switch (attr.type) {
+                        case VertexAttributeType::Position:
+                            if (options.quantizePositions) {
+                                encoding = VertexAttributeEncoding::Unorm16;
+                            }
+                            break;
+                        case VertexAttributeType::Normal:
+                        case VertexAttributeType::Tangent:
+                            if (options.octahedralNormals) {
+                                encoding = VertexAttributeEncoding::Octahedral;
+                            } else if (options.compressNormals) {
+                                encoding = VertexAttributeEncoding::Snorm16;
+                            }
+                            break;
+                        case VertexAttributeType::TexCoord0:
+                        case VertexAttributeType::TexCoord1:
+                            if (options.compressTexCoords) {
+                                // Tiling UVs don't fit unorm16; half keeps ~11 bits of precision up to +-2048
+                                bool unitRange = vertexData &&
+                                                 TexCoordsInUnitRange(vertexData, source.GetStride(), attr.offset, vertexCount);
+                                encoding = unitRange ? VertexAttributeEncoding::Unorm16 : VertexAttributeEncoding::Half;
+                            }
+                            break;
+                        case VertexAttributeType::Color0:
+                            if (options.compressColors) {
+                                encoding = VertexAttributeEncoding::Unorm8;
+                            }
+                            break;
+                        default:
+                            break;
+                    }
+                } else {
+                    encoding = attr.encoding;
+                }
+                target.AddAttribute(attr.type, attr.location, encoding);
+            }
+            return target;
+        }
+
+        bool VertexQuantizer::Encode(const VertexFormat& source, const uint8_t* vertexData, uint32_t vertexCount,
+                                     const VertexFormat& target, const glm::vec3& boundsMin, const glm::vec3& boundsMax,
+                                     std::vector<uint8_t>& outVertexData) {
+            if (!vertexData || vertexCount == 0 || target.GetStride() == 0) {
+                return false;
+            }
+
+            uint32_t sourceStride = source.GetStride();
+            uint32_t targetStride = target.GetStride();
+            outVertexData.assign(static_cast<size_t>(vertexCount) * targetStride, 0);
+
+            std::vector<float> components;
+            std::vector<float> octahedral;
+            std::vector<uint8_t> encoded;
+
+            for (const VertexAttribute& attr : target.GetAttributes()) {
+                const VertexAttribute* from = source.GetAttribute(attr.type);
+                if (!from || from->encoding != VertexAttributeEncoding::Float) {
+                    std::cerr << "VertexQuantizer::Encode: " << GetVertexAttributeTypeName(attr.type)
+                              << " is not stored as float in the source format" << std::endl;
+                    return false;
+                }
+
+                uint32_t floatCount = from->size / sizeof(float);
+                switch (attr.encoding) {
+                    case VertexAttributeEncoding::Float:
+                        for (uint32_t i = 0; i < vertexCount; ++i) {
+                            std::memcpy(outVertexData.data() + static_cast<size_t>(i) * targetStride + attr.offset,
+                                        vertexData + static_cast<size_t>(i) * sourceStride + from->offset, from->size);
+                        }
+                        continue;
+
+                    case VertexAttributeEncoding::Unorm16: {
+                        uint32_t outCount = attr.size / sizeof(uint16_t);
+                        Gather(vertexData, sourceStride, from->offset, floatCount, vertexCount, outCount, components);
+                        if (attr.type == VertexAttributeType::Position) {
+                            glm::vec3 scale, offset;
+                            GetPositionDequantization(boundsMin, boundsMax, scale, offset);
+                            for (uint32_t i = 0; i < vertexCount; ++i) {
+                                float* p = &components[static_cast<size_t>(i) * outCount];
+                                for (int axis = 0; axis < 3; ++axis) {
+                                    p[axis] = (p[axis] - offset[axis]) / scale[axis];
+                                }
+                                p[3] = 0.0f;
+                            }
+                        }
+                        encoded.resize(components.size() * sizeof(uint16_t));
+                        EncodeUnorm16(components.data(), reinterpret_cast<uint16_t*>(encoded.data()), components.size());
+                        break;
+                    }
+
+                    case VertexAttributeEncoding::Snorm16:
+                        // Normal w stays 0; tangent w is the +-1 handedness and survives exactly
+                        Gather(vertexData, sourceStride, from->offset, floatCount, vertexCount, 4, components);
+                        encoded.resize(components.size() * sizeof(int16_t));
+                        EncodeSnorm16(components.data(), reinterpret_cast<int16_t*>(encoded.data()), components.size());
+                        break;
+
+                    case VertexAttributeEncoding::Octahedral: {
+                        Gather(vertexData, sourceStride, from->offset, floatCount, vertexCount, 4, components);
+                        std::vector<float> xyz(static_cast<size_t>(vertexCount) * 3);
+                        for (uint32_t i = 0; i < vertexCount; ++i) {
+                            std::memcpy(&xyz[static_cast<size_t>(i) * 3], &components[static_cast<size_t>(i) * 4], 3 * sizeof(float));
+                        }
+                        octahedral.resize(static_cast<size_t>(vertexCount) * 2);
+                        EncodeOctahedral(xyz.data(), octahedral.data(), vertexCount);
+
+                        encoded.resize(octahedral.size() * sizeof(int16_t));
+                        int16_t* packed = reinterpret_cast<int16_t*>(encoded.data());
+                        EncodeSnorm16(octahedral.data(), packed, octahedral.size());
+                        if (attr.type == VertexAttributeType::Tangent) {
+                            // y keeps 15 bits; bit 0 set means negative handedness (decoded in the shader)
+                            for (uint32_t i = 0; i < vertexCount; ++i) {
+                                int32_t y = RoundToInt(Clamp(octahedral[static_cast<size_t>(i) * 2 + 1], -1.0f, 1.0f) * kTangentYMax);
+                                int32_t handedness = components[static_cast<size_t>(i) * 4 + 3] < 0.0f ? 1 : 0;
+                                packed[static_cast<size_t>(i) * 2 + 1] = static_cast<int16_t>(y * 2 + handedness);
+                            }
+                        }
+                        break;
+                    }
+
+                    case VertexAttributeEncoding::Half:
+                        Gather(vertexData, sourceStride, from->offset, floatCount, vertexCount, 2, components);
+                        encoded.resize(components.size() * sizeof(uint16_t));
+                        EncodeHalf(components.data(), reinterpret_cast<uint16_t*>(encoded.data()), components.size());
+                        break;
+
+                    case VertexAttributeEncoding::Unorm8:
+                        Gather(vertexData, sourceStride, from->offset, floatCount, vertexCount, 4, components);
+                        encoded.resize(components.size());
+                        EncodeUnorm8(components.data(), encoded.data(), components.size());
+                        break;
+
+                    default:
+                        std::cerr << "VertexQuantizer::Encode: Unknown encoding for "
+                                  << GetVertexAttributeTypeName(attr.type) << std::endl;
+                        return false;
+                }
+
+                Scatter(encoded.data(), attr.size, vertexCount, outVertexData.data(), targetStride, attr.offset);
+            }
+            return true;
+        }
+
+        void VertexQuantizer::GetPositionDequantization(const glm::vec3& boundsMin, const glm::vec3& boundsMax,
+                                                        glm::vec3& outScale, glm::vec3& outOffset) {
+            outOffset = boundsMin;
+            outScale = boundsMax - boundsMin;
+            for (int axis = 0; axis < 3; ++axis) {
+                // Flat axis: every vertex quantizes to 0, any scale reproduces it
+                if (!(outScale[axis] > 0.0f)) {
+                    outScale[axis] = 1.0f;
+                }
+            }
+        }
+
+        void VertexQuantizer::EncodeSnorm16(const float* source, int16_t* destination, size_t count) {
+            size_t i = 0;
+#ifdef FE_VERTEX_QUANTIZER_SSE2
+            const __m128 low = _mm_set1_ps(-1.0f);
+            const __m128 high = _mm_set1_ps(1.0f);
+            const __m128 scale = _mm_set1_ps(kSnorm16Max);
+            for (; i + 8 <= count; i += 8) {
+                __m128i a = _mm_cvtps_epi32(_mm_mul_ps(Clamp4(_mm_loadu_ps(source + i), low, high), scale));
+                __m128i b = _mm_cvtps_epi32(_mm_mul_ps(Clamp4(_mm_loadu_ps(source + i + 4), low, high), scale));
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(destination + i), _mm_packs_epi32(a, b));
+            }
+#endif
+            for (; i < count; ++i) {
+                destination[i] = static_cast<int16_t>(RoundToInt(Clamp(source[i], -1.0f, 1.0f) * kSnorm16Max));
+            }
+        }
+
+        void VertexQuantizer::EncodeUnorm16(const float* source, uint16_t* destination, size_t count) {
+            size_t i = 0;
+#ifdef FE_VERTEX_QUANTIZER_SSE2
+            const __m128 low = _mm_setzero_ps();
+            const __m128 high = _mm_set1_ps(1.0f);
+            const __m128 scale = _mm_set1_ps(kUnorm16Max);
+            for (; i + 8 <= count; i += 8) {
+                __m128i a = _mm_cvtps_epi32(_mm_mul_ps(Clamp4(_mm_loadu_ps(source + i), low, high), scale));
+                __m128i b = _mm_cvtps_epi32(_mm_mul_ps(Clamp4(_mm_loadu_ps(source + i + 4), low, high), scale));
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(destination + i), PackUnsigned16(a, b));
+            }
+#endif
+            for (; i < count; ++i) {
+                destination[i] = static_cast<uint16_t>(RoundToInt(Clamp(source[i], 0.0f, 1.0f) * kUnorm16Max));
+            }
+        }
+
+        void VertexQuantizer::EncodeUnorm8(const float* source, uint8_t* destination, size_t count) {
+            size_t i = 0;
+#ifdef FE_VERTEX_QUANTIZER_SSE2
+            const __m128 low = _mm_setzero_ps();
+            const __m128 high = _mm_set1_ps(1.0f);
+            const __m128 scale = _mm_set1_ps(kUnorm8Max);
+            for (; i + 16 <= count; i += 16) {
+                __m128i a = _mm_cvtps_epi32(_mm_mul_ps(Clamp4(_mm_loadu_ps(source + i), low, high), scale));
+                __m128i b = _mm_cvtps_epi32(_mm_mul_ps(Clamp4(_mm_loadu_ps(source + i + 4), low, high), scale));
+                __m128i c = _mm_cvtps_epi32(_mm_mul_ps(Clamp4(_mm_loadu_ps(source + i + 8), low, high), scale));
+                __m128i d = _mm_cvtps_epi32(_mm_mul_ps(Clamp4(_mm_loadu_ps(source + i + 12), low, high), scale));
+                __m128i packed = _mm_packus_epi16(_mm_packs_epi32(a, b), _mm_packs_epi32(c, d));
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(destination + i), packed);
+            }
+#endif
+            for (; i < count; ++i) {
+                destination[i] = static_cast<uint8_t>(RoundToInt(Clamp(source[i], 0.0f, 1.0f) * kUnorm8Max));
+            }
+        }
+
+        void VertexQuantizer::EncodeHalf(const float* source, uint16_t* destination, size_t count) {
+            size_t i = 0;
+#ifdef FE_VERTEX_QUANTIZER_SSE2
+            for (; i + 8 <= count; i += 8) {
+                __m128i a = FloatToHalf4(_mm_loadu_ps(source + i));
+                __m128i b = FloatToHalf4(_mm_loadu_ps(source + i + 4));
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(destination + i), PackUnsigned16(a, b));
+            }
+#endif
+            for (; i < count; ++i) {
+                destination[i] = FloatToHalf(source[i]);
+            }
+        }
+
+        void VertexQuantizer::EncodeOctahedral(const float* xyz, float* destinationXY, size_t count) {
+            size_t i = 0;
+#ifdef FE_VERTEX_QUANTIZER_SSE2
+            const __m128 signMask = _mm_set1_ps(-0.0f);
+            const __m128 one = _mm_set1_ps(1.0f);
+            const __m128 zero = _mm_setzero_ps();
+            for (; i + 4 <= count; i += 4) {
+                const float* v = xyz + i * 3;
+                __m128 x = _mm_setr_ps(v[0], v[3], v[6], v[9]);
+                __m128 y = _mm_setr_ps(v[1], v[4], v[7], v[10]);
+                __m128 z = _mm_setr_ps(v[2], v[5], v[8], v[11]);
+
+                // Project onto the octahedron |x| + |y| + |z| = 1 (zero vectors stay at the origin)
+                __m128 l1 = _mm_add_ps(_mm_add_ps(_mm_andnot_ps(signMask, x), _mm_andnot_ps(signMask, y)),
+                                       _mm_andnot_ps(signMask, z));
+                __m128 nonZero = _mm_cmpgt_ps(l1, zero);
+                __m128 inverse = _mm_and_ps(_mm_div_ps(one, _mm_max_ps(l1, _mm_set1_ps(1e-30f))), nonZero);
+                __m128 px = _mm_mul_ps(x, inverse);
+                __m128 py = _mm_mul_ps(y, inverse);
+
+                // Lower hemisphere folds over the diagonals: (1 - |y|, 1 - |x|) with the signs of x and y
+                __m128 signX = _mm_or_ps(_mm_and_ps(px, signMask), one);
+                __m128 signY = _mm_or_ps(_mm_and_ps(py, signMask), one);
+                __m128 foldX = _mm_mul_ps(_mm_sub_ps(one, _mm_andnot_ps(signMask, py)), signX);
+                __m128 foldY = _mm_mul_ps(_mm_sub_ps(one, _mm_andnot_ps(signMask, px)), signY);
+                __m128 lower = _mm_cmplt_ps(z, zero);
+                px = _mm_or_ps(_mm_and_ps(lower, foldX), _mm_andnot_ps(lower, px));
+                py = _mm_or_ps(_mm_and_ps(lower, foldY), _mm_andnot_ps(lower, py));
+
+                __m128 lo = _mm_unpacklo_ps(px, py);
+                __m128 hi = _mm_unpackhi_ps(px, py);
+                _mm_storeu_ps(destinationXY + i * 2, lo);
+                _mm_storeu_ps(destinationXY + i * 2 + 4, hi);
+            }
+#endif
+            for (; i < count; ++i) {
+                float x = xyz[i * 3 + 0];
+                float y = xyz[i * 3 + 1];
+                float z = xyz[i * 3 + 2];
+                float l1 = std::fabs(x) + std::fabs(y) + std::fabs(z);
+                float inverse = l1 > 0.0f ? 1.0f / l1 : 0.0f;
+                float px = x * inverse;
+                float py = y * inverse;
+                if (z < 0.0f) {
+                    float foldX = (1.0f - std::fabs(py)) * std::copysign(1.0f, px);
+                    float foldY = (1.0f - std::fabs(px)) * std::copysign(1.0f, py);
+                    px = foldX;
+                    py = foldY;
+                }
+                destinationXY[i * 2 + 0] = px;
+                destinationXY[i * 2 + 1] = py;
+            }
+        }
+
+    } // namespace Resources
+} // namespace FirstEngine
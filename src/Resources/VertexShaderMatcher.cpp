@@ -146,6 +146,83 @@ namespace FirstEngine {
             return type;
         }
 
+        RHI::Format VertexShaderMatcher::GetAttributeFormat(const VertexAttribute& attribute) {
+            switch (attribute.encoding) {
+                case VertexAttributeEncoding::Snorm16:
+                    return RHI::Format::R16G16B16A16_SNORM;
+                case VertexAttributeEncoding::Octahedral:
+                    return RHI::Format::R16G16_SNORM;
+                case VertexAttributeEncoding::Half:
+                    return RHI::Format::R16G16_SFLOAT;
+                case VertexAttributeEncoding::Unorm16:
+                    return attribute.type == VertexAttributeType::Position ? RHI::Format::R16G16B16A16_UNORM
+                                                                           : RHI::Format::R16G16_UNORM;
+                case VertexAttributeEncoding::Unorm8:
+                    return RHI::Format::R8G8B8A8_UNORM;
+                case VertexAttributeEncoding::Float:
+                default:
+                    break;
+            }
+
+            switch (attribute.type) {
+                case VertexAttributeType::Position:
+                case VertexAttributeType::Normal:
+                    return RHI::Format::R32G32B32_SFLOAT;
+                case VertexAttributeType::TexCoord0:
+                case VertexAttributeType::TexCoord1:
+                    return RHI::Format::R32G32_SFLOAT;
+                case VertexAttributeType::Tangent:
+                case VertexAttributeType::Color0:
+                    return RHI::Format::R32G32B32A32_SFLOAT;
+                default:
+                    return RHI::Format::Undefined;
+            }
+        }
+
+        bool VertexShaderMatcher::BuildVertexInputs(const VertexFormat& vertexFormat,
+                                                    const Shader::ShaderReflection& shaderReflection,
+                                                    std::vector<RHI::VertexInputAttribute>& outAttributes,
+                                                    MatchResult* outResult) {
+            outAttributes.clear();
+            MatchResult result;
+            result.isCompatible = true;
+
+            for (const auto& input : shaderReflection.stage_inputs) {
+                VertexAttributeType type = InferAttributeTypeFromShaderResource(input);
+                const VertexAttribute* attribute = vertexFormat.GetAttribute(type);
+                if (!attribute) {
+                    result.isCompatible = false;
+                    result.missingAttributes.push_back(GetVertexAttributeTypeName(type));
+                    continue;
+                }
+
+                RHI::VertexInputAttribute vertexInput;
+                vertexInput.location = input.location;
+                vertexInput.binding = 0;
+                vertexInput.format = GetAttributeFormat(*attribute);
+                vertexInput.offset = attribute->offset;
+                outAttributes.push_back(vertexInput);
+                result.locationMapping.push_back(input.location);
+            }
+
+            if (!result.isCompatible) {
+                std::ostringstream oss;
+                oss << "Vertex format " << vertexFormat.ToString() << " lacks shader inputs: ";
+                for (size_t i = 0; i < result.missingAttributes.size(); ++i) {
+                    if (i > 0) oss << ", ";
+                    oss << result.missingAttributes[i];
+                }
+                result.errorMessage = oss.str();
+                outAttributes.clear();
+            }
+
+            bool compatible = result.isCompatible;
+            if (outResult) {
+                *outResult = std::move(result);
+            }
+            return compatible;
+        }
+
         bool VertexShaderMatcher::NameMatchesAttributeType(const std::string& name, VertexAttributeType type) {
             std::string lowerName = name;
             std::transform(lowerName.begin(), lowerName.end(), lowerName.begin(), ::tolower);
@@ -0,0 +1,269 @@
+#include "FirstEngine/Shader/ShaderCache.h"
+#include "FirstEngine/Shader/ShaderReflectionSerializer.h"
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <sstream>
+#include <thread>
+#include <filesystem>
+
+namespace FirstEngine {
+    namespace Shader {
+
+        namespace {
+
+            constexpr uint32_t kCacheMagic = 0x43534546;  // "FESC"
+            constexpr uint32_t kCacheFormatVersion = 2;
+
+            struct CacheFileHeader {
+                uint32_t magic;
+                uint32_t formatVersion;
+                uint32_t spirvWordCount;
+                uint32_t reflectionSize;  // 0 = no reflection
+            };
+
+        } // namespace
+
+        ShaderCache::ShaderCache(const std::string& directory) {
+            SetDirectory(directory);
+        }
+
+        void ShaderCache::SetDirectory(const std::string& directory) {
+            m_Directory = directory;
+        }
+
+        Core::Hash128 ShaderCache::ComputeKey(const std::string& preprocessedSource, const CompileOptions& options) {
+            Core::Hasher128 hasher;
+            hasher.UpdateString(ShaderSourceCompiler::GetCompilerVersion());
+            hasher.UpdateString(preprocessedSource);
+
+            uint32_t settings[] = {
+                static_cast<uint32_t>(options.stage),
+                static_cast<uint32_t>(options.language),
+                static_cast<uint32_t>(options.optimization_level),
+                options.generate_debug_info ? 1u : 0u,
+                ShaderReflectionSerializer::kVersion
+            };
+            hasher.Update(settings, sizeof(settings));
+            hasher.UpdateString(options.entry_point);
+            hasher.UpdateString(options.target_profile);
+
+            // Defines are already applied in the preprocessed source, but an unused define
+            // can still matter to the compiler front-end, so key on them too
+            for (const auto& define : options.defines) {
+                hasher.UpdateString(define.first);
+                hasher.UpdateString(define.second);
+            }
+            return hasher.Finalize();
+        }
+
+        CompileOptions ShaderCache::GetEngineCompileOptions(ShaderStage stage,
+                                                            const std::vector<std::pair<std::string, std::string>>& defines) {
+            CompileOptions options;
+            options.language = ShaderSourceLanguage::HLSL;
+            options.stage = stage;
+            switch (stage) {
+                case ShaderStage::Vertex: options.target_profile = "vs_6_0"; break;
+                case ShaderStage::Fragment: options.target_profile = "ps_6_0"; break;
+                case ShaderStage::Geometry: options.target_profile = "gs_6_0"; break;
+                case ShaderStage::Compute: options.target_profile = "cs_6_0"; break;
+                case ShaderStage::TessellationControl: options.target_profile = "hs_6_0"; break;
+                case ShaderStage::TessellationEvaluation: options.target_profile = "ds_6_0"; break;
+                default: break;
+            }
+            options.entry_point = "main";
+            options.optimization_level = 1;
+            options.defines = defines;
+            return options;
+        }
+
+        std::string ShaderCache::GetEntryPath(const Core::Hash128& key) const {
+            return (std::filesystem::path(m_Directory) / (key.ToString() + ".fesc")).string();
+        }
+
+        bool ShaderCache::Load(const Core::Hash128& key, ShaderCacheEntry& outEntry) const {
+            if (!IsEnabled()) {
+                return false;
+            }
+
+            std::ifstream file(GetEntryPath(key), std::ios::binary | std::ios::ate);
+            if (!file.is_open()) {
+                return false;
+            }
+
+            std::streamoff fileSize = file.tellg();
+            CacheFileHeader header = {};
+            file.seekg(0);
+            if (fileSize < static_cast<std::streamoff>(sizeof(CacheFileHeader)) ||
+                !file.read(reinterpret_cast<char*>(&header), sizeof(header))) {
+                return false;
+            }
+            uint64_t payloadSize = static_cast<uint64_t>(header.spirvWordCount) * 4 + header.reflectionSize;
+            if (header.magic != kCacheMagic || header.formatVersion != kCacheFormatVersion ||
+                header.spirvWordCount == 0 || header.reflectionSize % 4 != 0 ||
+                payloadSize > static_cast<uint64_t>(fileSize) - sizeof(CacheFileHeader)) {
+                return false;
+            }
+
+            // SPIR-V and the reflection blob are read straight into the buffers the entry hands out;
+            // the SPIR-V moves on into the ShaderCollection and the blob is used in place through the view
+            ShaderCacheEntry entry;
+            entry.spirv.resize(header.spirvWordCount);
+            if (!file.read(reinterpret_cast<char*>(entry.spirv.data()), static_cast<std::streamsize>(header.spirvWordCount) * 4)) {
+                return false;
+            }
+
+            if (header.reflectionSize > 0) {
+                auto reflectionData = std::make_shared<std::vector<uint32_t>>(header.reflectionSize / 4);
+                if (!file.read(reinterpret_cast<char*>(reflectionData->data()), header.reflectionSize) ||
+                    !entry.reflection.Open(reflectionData->data(), header.reflectionSize)) {
+                    return false;
+                }
+                entry.reflectionData = std::move(reflectionData);
+                entry.hasReflection = true;
+            }
+
+            outEntry = std::move(entry);
+            return true;
+        }
+
+        bool ShaderCache::Store(const Core::Hash128& key, const ShaderCacheEntry& entry) const {
+            if (!IsEnabled() || entry.spirv.empty()) {
+                return false;
+            }
+
+            std::error_code ec;
+            std::filesystem::create_directories(m_Directory, ec);
+
+            // Reflection blob (a multiple of 4 bytes, so it stays word-aligned after the SPIR-V)
+            size_t reflectionSize = 0;
+            if (entry.hasReflection && entry.reflectionData) {
+                reflectionSize = entry.reflectionData->size() * sizeof(uint32_t);
+            }
+
+            CacheFileHeader header = {};
+            header.magic = kCacheMagic;
+            header.formatVersion = kCacheFormatVersion;
+            header.spirvWordCount = static_cast<uint32_t>(entry.spirv.size());
+            header.reflectionSize = static_cast<uint32_t>(reflectionSize);
+
+            // Write to a per-thread temp file and rename, so readers never see a partial entry
+            std::string path = GetEntryPath(key);
+            std::ostringstream tempPath;
+            tempPath << path << "." << std::hash<std::thread::id>()(std::this_thread::get_id()) << ".tmp";
+            {
+                std::ofstream file(tempPath.str(), std::ios::binary | std::ios::trunc);
+                if (!file.is_open()) {
+                    m_WriteErrors++;
+                    return false;
+                }
+                file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+                file.write(reinterpret_cast<const char*>(entry.spirv.data()), entry.spirv.size() * sizeof(uint32_t));
+                if (reflectionSize > 0) {
+                    file.write(reinterpret_cast<const char*>(entry.reflectionData->data()), reflectionSize);
+                }
+                if (!file) {
+                    file.close();
+                    std::filesystem::remove(tempPath.str(), ec);
+                    m_WriteErrors++;
+                    return false;
+                }
+            }
+
+            std::filesystem::rename(tempPath.str(), path, ec);
+            if (ec) {
+                // Another thread may have stored the same key first (rename over an open file fails on Windows)
+                std::filesystem::remove(tempPath.str(), ec);
+                if (!std::filesystem::exists(path)) {
+                    m_WriteErrors++;
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        bool ShaderCache::CompileFile(const std::string& filepath, const CompileOptions& options,
+                                      ShaderCacheEntry& outEntry, std::string* outError) {
+            std::ifstream file(filepath);
+            if (!file.is_open()) {
+                if (outError) {
+                    *outError = "Failed to open file: " + filepath;
+                }
+                return false;
+            }
+            std::stringstream buffer;
+            buffer << file.rdbuf();
+            std::string source = buffer.str();
+
+            // Includes resolve relative to the source file as well
+            CompileOptions opts = options;
+            opts.include_directories.push_back(std::filesystem::path(filepath).parent_path().string());
+
+            ShaderSourceCompiler compiler;
+
+            // Preprocessing is cheap compared to compilation + reflection and keys the cache on what the compiler sees
+            std::string preprocessed;
+            if (!compiler.Preprocess(source, opts, preprocessed, outError)) {
+                m_CompileErrors++;
+                return false;
+            }
+
+            Core::Hash128 key = ComputeKey(preprocessed, opts);
+            if (Load(key, outEntry)) {
+                m_Hits++;
+                return true;
+            }
+
+            m_Misses++;
+            CompileResult result = opts.language == ShaderSourceLanguage::HLSL
+                ? compiler.CompileHLSL(source, opts)
+                : compiler.CompileGLSL(source, opts);
+            if (!result.success) {
+                m_CompileErrors++;
+                if (outError) {
+                    *outError = result.error_message;
+                }
+                return false;
+            }
+
+            // Reflection is cooked right away, so a miss hands out the same form as a hit
+            ShaderCacheEntry entry;
+            entry.spirv = std::move(result.spirv_code);
+            try {
+                ShaderCompiler reflector(entry.spirv);
+                std::vector<uint8_t> blob;
+                ShaderReflectionSerializer::Serialize(reflector.GetReflection(), blob);
+                auto reflectionData = std::make_shared<std::vector<uint32_t>>(blob.size() / 4);
+                std::memcpy(reflectionData->data(), blob.data(), reflectionData->size() * sizeof(uint32_t));
+                if (entry.reflection.Open(reflectionData->data(), blob.size())) {
+                    entry.reflectionData = std::move(reflectionData);
+                    entry.hasReflection = true;
+                }
+            } catch (const std::exception& e) {
+                std::cerr << "ShaderCache: Reflection failed for " << filepath << ": " << e.what() << std::endl;
+            }
+
+            Store(key, entry);
+            outEntry = std::move(entry);
+            return true;
+        }
+
+        ShaderCache::Stats ShaderCache::GetStats() const {
+            Stats stats;
+            stats.hits = m_Hits.load();
+            stats.misses = m_Misses.load();
+            stats.compileErrors = m_CompileErrors.load();
+            stats.writeErrors = m_WriteErrors.load();
+            return stats;
+        }
+
+        void ShaderCache::ResetStats() {
+            m_Hits = 0;
+            m_Misses = 0;
+            m_CompileErrors = 0;
+            m_WriteErrors = 0;
+        }
+
+    } // namespace Shader
+} // namespace FirstEngine
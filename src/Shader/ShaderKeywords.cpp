@@ -0,0 +1,182 @@
+#include "FirstEngine/Shader/ShaderKeywords.h"
+#include "FirstEngine/Core/Hash.h"
+#include <algorithm>
+#include <fstream>
+#include <sstream>
+#include <iostream>
+
+namespace FirstEngine {
+    namespace Shader {
+
+        ShaderKeywordSet::ShaderKeywordSet(const std::vector<std::string>& keywords) {
+            for (const auto& keyword : keywords) {
+                Add(keyword);
+            }
+        }
+
+        void ShaderKeywordSet::Add(const std::string& keyword) {
+            if (keyword.empty()) {
+                return;
+            }
+            auto it = std::lower_bound(m_Keywords.begin(), m_Keywords.end(), keyword);
+            if (it == m_Keywords.end() || *it != keyword) {
+                m_Keywords.insert(it, keyword);
+            }
+        }
+
+        void ShaderKeywordSet::Remove(const std::string& keyword) {
+            auto it = std::lower_bound(m_Keywords.begin(), m_Keywords.end(), keyword);
+            if (it != m_Keywords.end() && *it == keyword) {
+                m_Keywords.erase(it);
+            }
+        }
+
+        bool ShaderKeywordSet::Has(const std::string& keyword) const {
+            return std::binary_search(m_Keywords.begin(), m_Keywords.end(), keyword);
+        }
+
+        void ShaderKeywordSet::Merge(const ShaderKeywordSet& other) {
+            for (const auto& keyword : other.m_Keywords) {
+                Add(keyword);
+            }
+        }
+
+        ShaderKeywordSet ShaderKeywordSet::Filtered(const ShaderKeywordSet& allowed) const {
+            ShaderKeywordSet result;
+            std::set_intersection(m_Keywords.begin(), m_Keywords.end(),
+                                  allowed.m_Keywords.begin(), allowed.m_Keywords.end(),
+                                  std::back_inserter(result.m_Keywords));
+            return result;
+        }
+
+        std::vector<std::pair<std::string, std::string>> ShaderKeywordSet::ToDefines() const {
+            std::vector<std::pair<std::string, std::string>> defines;
+            defines.reserve(m_Keywords.size());
+            for (const auto& keyword : m_Keywords) {
+                defines.push_back({keyword, "1"});
+            }
+            return defines;
+        }
+
+        uint64_t ShaderKeywordSet::GetHash() const {
+            // Keywords are length-prefixed so {"AB"} != {"A", "B"}
+            Core::Hasher128 hasher;
+            for (const auto& keyword : m_Keywords) {
+                hasher.UpdateString(keyword);
+            }
+            return hasher.Finalize().low;
+        }
+
+        std::string ShaderKeywordSet::ToString() const {
+            std::string result;
+            for (size_t i = 0; i < m_Keywords.size(); ++i) {
+                if (i > 0) {
+                    result += ' ';
+                }
+                result += m_Keywords[i];
+            }
+            return result;
+        }
+
+        ShaderKeywordSet ShaderKeywordSet::FromString(const std::string& str) {
+            ShaderKeywordSet result;
+            std::istringstream stream(str);
+            std::string keyword;
+            while (stream >> keyword) {
+                // Allow comma separated lists as well
+                size_t start = 0;
+                size_t comma;
+                while ((comma = keyword.find(',', start)) != std::string::npos) {
+                    result.Add(keyword.substr(start, comma - start));
+                    start = comma + 1;
+                }
+                result.Add(keyword.substr(start));
+            }
+            return result;
+        }
+
+        ShaderKeywordSet ParseDeclaredKeywords(const std::string& sourceCode) {
+            static const std::string kMarker = "@keywords";
+
+            ShaderKeywordSet declared;
+            std::istringstream stream(sourceCode);
+            std::string line;
+            while (std::getline(stream, line)) {
+                size_t comment = line.find("//");
+                if (comment == std::string::npos) {
+                    continue;
+                }
+                size_t marker = line.find(kMarker, comment);
+                if (marker == std::string::npos) {
+                    continue;
+                }
+                declared.Merge(ShaderKeywordSet::FromString(line.substr(marker + kMarker.size())));
+            }
+            return declared;
+        }
+
+        void ShaderPermutationManifest::Add(const std::string& shaderName, const ShaderKeywordSet& keywords) {
+            if (shaderName.empty() || Contains(shaderName, keywords)) {
+                return;
+            }
+            m_Entries.push_back({shaderName, keywords});
+        }
+
+        bool ShaderPermutationManifest::Contains(const std::string& shaderName, const ShaderKeywordSet& keywords) const {
+            for (const auto& entry : m_Entries) {
+                if (entry.shaderName == shaderName && entry.keywords == keywords) {
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        bool ShaderPermutationManifest::LoadFromFile(const std::string& filepath) {
+            std::ifstream file(filepath);
+            if (!file.is_open()) {
+                return false;
+            }
+
+            m_Entries.clear();
+            std::string line;
+            while (std::getline(file, line)) {
+                size_t comment = line.find('#');
+                if (comment != std::string::npos) {
+                    line = line.substr(0, comment);
+                }
+                size_t colon = line.find(':');
+                std::string name = line.substr(0, colon);
+                name.erase(0, name.find_first_not_of(" \t\r"));
+                name.erase(name.find_last_not_of(" \t\r") + 1);
+                if (name.empty()) {
+                    continue;
+                }
+                ShaderKeywordSet keywords;
+                if (colon != std::string::npos) {
+                    keywords = ShaderKeywordSet::FromString(line.substr(colon + 1));
+                }
+                Add(name, keywords);
+            }
+            return true;
+        }
+
+        bool ShaderPermutationManifest::SaveToFile(const std::string& filepath) const {
+            std::ofstream file(filepath);
+            if (!file.is_open()) {
+                std::cerr << "ShaderPermutationManifest: Failed to write " << filepath << std::endl;
+                return false;
+            }
+
+            file << "# Shader permutations used by this package (generated by ShaderManager)\n";
+            for (const auto& entry : m_Entries) {
+                file << entry.shaderName << ":";
+                if (!entry.keywords.IsEmpty()) {
+                    file << " " << entry.keywords.ToString();
+                }
+                file << "\n";
+            }
+            return true;
+        }
+
+    } // namespace Shader
+} // namespace FirstEngine
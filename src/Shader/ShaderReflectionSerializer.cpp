@@ -0,0 +1,391 @@
+#include "FirstEngine/Shader/ShaderReflectionSerializer.h"
+#include <cstring>
+#include <string>
+#include <unordered_map>
+
+namespace FirstEngine {
+    namespace Shader {
+
+        namespace {
+
+            constexpr uint32_t kBlobMagic = 0x42524546;  // "FERB"
+
+            using ResourceRecord = ShaderReflectionView::Resource;
+            using UniformBufferRecord = ShaderReflectionView::UniformBuffer;
+            using ResourceList = ShaderReflectionView::ResourceList;
+
+            constexpr uint32_t kResourceListCount = static_cast<uint32_t>(ResourceList::Count);
+
+            struct BlobRange {
+                uint32_t offset;  // Byte offset from the start of the blob
+                uint32_t count;   // Element count (bytes for the string table)
+            };
+
+            struct BlobHeader {
+                uint32_t magic;
+                uint32_t version;
+                uint32_t totalSize;
+                uint32_t language;
+                uint32_t entryPoint;
+                uint32_t pushConstantSize;
+                BlobRange uniformBuffers;
+                BlobRange members;
+                BlobRange resources[kResourceListCount];
+                BlobRange arraySizes;
+                BlobRange strings;
+            };
+
+            static_assert(sizeof(BlobHeader) % 4 == 0, "Blob header must keep the tables 4-byte aligned");
+            static_assert(sizeof(ResourceRecord) == 16 * 4, "Resource record must be tightly packed");
+            static_assert(sizeof(UniformBufferRecord) == 7 * 4, "Uniform buffer record must be tightly packed");
+
+            const std::vector<ShaderResource>& GetList(const ShaderReflection& reflection, ResourceList list) {
+                switch (list) {
+                    case ResourceList::Samplers: return reflection.samplers;
+                    case ResourceList::Images: return reflection.images;
+                    case ResourceList::StorageBuffers: return reflection.storage_buffers;
+                    case ResourceList::StageInputs: return reflection.stage_inputs;
+                    case ResourceList::StageOutputs: return reflection.stage_outputs;
+                    case ResourceList::SampledImages: return reflection.sampled_images;
+                    case ResourceList::SeparateImages: return reflection.separate_images;
+                    default: return reflection.separate_samplers;
+                }
+            }
+
+            std::vector<ShaderResource>& GetList(ShaderReflection& reflection, ResourceList list) {
+                return const_cast<std::vector<ShaderResource>&>(
+                    GetList(static_cast<const ShaderReflection&>(reflection), list));
+            }
+
+            // Deduplicated, NUL-terminated string table (offset 0 is the empty string)
+            class StringTable {
+            public:
+                StringTable() { m_Data.push_back('\0'); m_Offsets[std::string()] = 0; }
+
+                uint32_t Add(const std::string& value) {
+                    auto it = m_Offsets.find(value);
+                    if (it != m_Offsets.end()) {
+                        return it->second;
+                    }
+                    uint32_t offset = static_cast<uint32_t>(m_Data.size());
+                    m_Data.insert(m_Data.end(), value.begin(), value.end());
+                    m_Data.push_back('\0');
+                    m_Offsets[value] = offset;
+                    return offset;
+                }
+
+                const std::vector<char>& GetData() const { return m_Data; }
+
+            private:
+                std::vector<char> m_Data;
+                std::unordered_map<std::string, uint32_t> m_Offsets;
+            };
+
+            class BlobBuilder {
+            public:
+                ResourceRecord AddResource(const ShaderResource& resource) {
+                    ResourceRecord record = {};
+                    record.name = m_Strings.Add(resource.name);
+                    record.id = resource.id;
+                    record.type_id = resource.type_id;
+                    record.base_type_id = resource.base_type_id;
+                    record.set = resource.set;
+                    record.binding = resource.binding;
+                    record.size = resource.size;
+                    record.offset = resource.offset;
+                    record.location = resource.location;
+                    record.component = resource.component;
+                    record.basetype = resource.basetype;
+                    record.width = resource.width;
+                    record.vecsize = resource.vecsize;
+                    record.columns = resource.columns;
+                    record.arrayFirst = static_cast<uint32_t>(m_ArraySizes.size());
+                    record.arrayCount = static_cast<uint32_t>(resource.array_size.size());
+                    m_ArraySizes.insert(m_ArraySizes.end(), resource.array_size.begin(), resource.array_size.end());
+                    return record;
+                }
+
+                void Build(const ShaderReflection& reflection, std::vector<uint8_t>& out) {
+                    BlobHeader header = {};
+                    header.magic = kBlobMagic;
+                    header.version = ShaderReflectionSerializer::kVersion;
+                    header.language = static_cast<uint32_t>(reflection.language);
+                    header.entryPoint = m_Strings.Add(reflection.entry_point);
+                    header.pushConstantSize = reflection.push_constant_size;
+
+                    for (const auto& ub : reflection.uniform_buffers) {
+                        UniformBufferRecord record = {};
+                        record.name = m_Strings.Add(ub.name);
+                        record.id = ub.id;
+                        record.set = ub.set;
+                        record.binding = ub.binding;
+                        record.size = ub.size;
+                        record.memberFirst = static_cast<uint32_t>(m_Members.size());
+                        record.memberCount = static_cast<uint32_t>(ub.members.size());
+                        for (const auto& member : ub.members) {
+                            m_Members.push_back(AddResource(member));
+                        }
+                        m_UniformBuffers.push_back(record);
+                    }
+
+                    for (uint32_t list = 0; list < kResourceListCount; ++list) {
+                        for (const auto& resource : GetList(reflection, static_cast<ResourceList>(list))) {
+                            m_Resources[list].push_back(AddResource(resource));
+                        }
+                    }
+
+                    // Lay out: header, record tables, array sizes, strings (padded to 4 bytes)
+                    uint32_t offset = sizeof(BlobHeader);
+                    auto place = [&offset](BlobRange& range, size_t count, size_t elementSize) {
+                        range.offset = offset;
+                        range.count = static_cast<uint32_t>(count);
+                        offset += static_cast<uint32_t>((count * elementSize + 3) & ~size_t(3));
+                    };
+                    place(header.uniformBuffers, m_UniformBuffers.size(), sizeof(UniformBufferRecord));
+                    place(header.members, m_Members.size(), sizeof(ResourceRecord));
+                    for (uint32_t list = 0; list < kResourceListCount; ++list) {
+                        place(header.resources[list], m_Resources[list].size(), sizeof(ResourceRecord));
+                    }
+                    place(header.arraySizes, m_ArraySizes.size(), sizeof(uint32_t));
+                    place(header.strings, m_Strings.GetData().size(), 1);
+                    header.totalSize = offset;
+
+                    size_t base = out.size();
+                    out.resize(base + header.totalSize, 0);
+                    uint8_t* blob = out.data() + base;
+                    auto copy = [blob](const BlobRange& range, const void* data, size_t bytes) {
+                        if (bytes > 0) {
+                            std::memcpy(blob + range.offset, data, bytes);
+                        }
+                    };
+                    std::memcpy(blob, &header, sizeof(header));
+                    copy(header.uniformBuffers, m_UniformBuffers.data(), m_UniformBuffers.size() * sizeof(UniformBufferRecord));
+                    copy(header.members, m_Members.data(), m_Members.size() * sizeof(ResourceRecord));
+                    for (uint32_t list = 0; list < kResourceListCount; ++list) {
+                        copy(header.resources[list], m_Resources[list].data(), m_Resources[list].size() * sizeof(ResourceRecord));
+                    }
+                    copy(header.arraySizes, m_ArraySizes.data(), m_ArraySizes.size() * sizeof(uint32_t));
+                    copy(header.strings, m_Strings.GetData().data(), m_Strings.GetData().size());
+                }
+
+            private:
+                StringTable m_Strings;
+                std::vector<UniformBufferRecord> m_UniformBuffers;
+                std::vector<ResourceRecord> m_Members;
+                std::vector<ResourceRecord> m_Resources[kResourceListCount];
+                std::vector<uint32_t> m_ArraySizes;
+            };
+
+            const BlobHeader& GetHeader(const uint8_t* data) {
+                return *reinterpret_cast<const BlobHeader*>(data);
+            }
+
+            template <typename T>
+            const T* GetTable(const uint8_t* data, const BlobRange& range) {
+                return reinterpret_cast<const T*>(data + range.offset);
+            }
+
+            bool IsRangeValid(const BlobRange& range, size_t elementSize, uint32_t totalSize) {
+                if (range.offset % 4 != 0 || range.offset > totalSize) {
+                    return false;
+                }
+                return static_cast<uint64_t>(range.count) * elementSize <= totalSize - range.offset;
+            }
+
+            bool IsSubRangeValid(uint32_t first, uint32_t count, uint32_t tableCount) {
+                return static_cast<uint64_t>(first) + count <= tableCount;
+            }
+
+            void ToResource(const ShaderReflectionView& view, const ResourceRecord& record, ShaderResource& out) {
+                out.name = view.GetString(record.name);
+                out.id = record.id;
+                out.type_id = record.type_id;
+                out.base_type_id = record.base_type_id;
+                out.set = record.set;
+                out.binding = record.binding;
+                out.size = record.size;
+                out.offset = record.offset;
+                const uint32_t* arraySizes = view.GetArraySizes(record);
+                out.array_size.assign(arraySizes, arraySizes + record.arrayCount);
+                out.location = record.location;
+                out.component = record.component;
+                out.basetype = record.basetype;
+                out.width = record.width;
+                out.vecsize = record.vecsize;
+                out.columns = record.columns;
+            }
+
+        } // namespace
+
+        bool ShaderReflectionView::Open(const void* data, size_t size) {
+            m_Data = nullptr;
+            m_Size = 0;
+
+            const auto* bytes = static_cast<const uint8_t*>(data);
+            if (!bytes || size < sizeof(BlobHeader) || reinterpret_cast<uintptr_t>(bytes) % 4 != 0) {
+                return false;
+            }
+
+            const BlobHeader& header = GetHeader(bytes);
+            if (header.magic != kBlobMagic || header.version != ShaderReflectionSerializer::kVersion ||
+                header.totalSize < sizeof(BlobHeader) || header.totalSize > size) {
+                return false;
+            }
+
+            const uint32_t total = header.totalSize;
+            if (!IsRangeValid(header.uniformBuffers, sizeof(UniformBufferRecord), total) ||
+                !IsRangeValid(header.members, sizeof(ResourceRecord), total) ||
+                !IsRangeValid(header.arraySizes, sizeof(uint32_t), total) ||
+                !IsRangeValid(header.strings, 1, total)) {
+                return false;
+            }
+            for (uint32_t list = 0; list < kResourceListCount; ++list) {
+                if (!IsRangeValid(header.resources[list], sizeof(ResourceRecord), total)) {
+                    return false;
+                }
+            }
+
+            // Strings are read as C strings, so the table must end in a terminator
+            const uint32_t stringsSize = header.strings.count;
+            if (stringsSize == 0 || bytes[header.strings.offset + stringsSize - 1] != '\0' ||
+                header.entryPoint >= stringsSize) {
+                return false;
+            }
+
+            auto isResourceValid = [&](const ResourceRecord& record) {
+                return record.name < stringsSize &&
+                       IsSubRangeValid(record.arrayFirst, record.arrayCount, header.arraySizes.count);
+            };
+
+            const auto* members = GetTable<ResourceRecord>(bytes, header.members);
+            for (uint32_t i = 0; i < header.members.count; ++i) {
+                if (!isResourceValid(members[i])) {
+                    return false;
+                }
+            }
+            const auto* uniformBuffers = GetTable<UniformBufferRecord>(bytes, header.uniformBuffers);
+            for (uint32_t i = 0; i < header.uniformBuffers.count; ++i) {
+                const auto& ub = uniformBuffers[i];
+                if (ub.name >= stringsSize || !IsSubRangeValid(ub.memberFirst, ub.memberCount, header.members.count)) {
+                    return false;
+                }
+            }
+            for (uint32_t list = 0; list < kResourceListCount; ++list) {
+                const auto* resources = GetTable<ResourceRecord>(bytes, header.resources[list]);
+                for (uint32_t i = 0; i < header.resources[list].count; ++i) {
+                    if (!isResourceValid(resources[i])) {
+                        return false;
+                    }
+                }
+            }
+
+            m_Data = bytes;
+            m_Size = total;
+            return true;
+        }
+
+        ShaderLanguage ShaderReflectionView::GetLanguage() const {
+            return static_cast<ShaderLanguage>(GetHeader(m_Data).language);
+        }
+
+        const char* ShaderReflectionView::GetEntryPoint() const {
+            return GetString(GetHeader(m_Data).entryPoint);
+        }
+
+        uint32_t ShaderReflectionView::GetPushConstantSize() const {
+            return GetHeader(m_Data).pushConstantSize;
+        }
+
+        uint32_t ShaderReflectionView::GetUniformBufferCount() const {
+            return GetHeader(m_Data).uniformBuffers.count;
+        }
+
+        const ShaderReflectionView::UniformBuffer& ShaderReflectionView::GetUniformBuffer(uint32_t index) const {
+            return GetTable<UniformBuffer>(m_Data, GetHeader(m_Data).uniformBuffers)[index];
+        }
+
+        const ShaderReflectionView::Resource& ShaderReflectionView::GetMember(const UniformBuffer& buffer, uint32_t index) const {
+            return GetTable<Resource>(m_Data, GetHeader(m_Data).members)[buffer.memberFirst + index];
+        }
+
+        uint32_t ShaderReflectionView::GetResourceCount(ResourceList list) const {
+            return GetHeader(m_Data).resources[static_cast<uint32_t>(list)].count;
+        }
+
+        const ShaderReflectionView::Resource& ShaderReflectionView::GetResource(ResourceList list, uint32_t index) const {
+            return GetTable<Resource>(m_Data, GetHeader(m_Data).resources[static_cast<uint32_t>(list)])[index];
+        }
+
+        const char* ShaderReflectionView::GetString(uint32_t offset) const {
+            return reinterpret_cast<const char*>(m_Data + GetHeader(m_Data).strings.offset + offset);
+        }
+
+        const uint32_t* ShaderReflectionView::GetArraySizes(const Resource& resource) const {
+            return GetTable<uint32_t>(m_Data, GetHeader(m_Data).arraySizes) + resource.arrayFirst;
+        }
+
+        void ShaderReflectionView::ToReflection(ShaderReflection& out) const {
+            ShaderReflection reflection;
+            reflection.language = GetLanguage();
+            reflection.entry_point = GetEntryPoint();
+            reflection.push_constant_size = GetPushConstantSize();
+
+            uint32_t ubCount = GetUniformBufferCount();
+            reflection.uniform_buffers.resize(ubCount);
+            for (uint32_t i = 0; i < ubCount; ++i) {
+                const UniformBuffer& record = GetUniformBuffer(i);
+                Shader::UniformBuffer& ub = reflection.uniform_buffers[i];
+                ub.name = GetString(record.name);
+                ub.id = record.id;
+                ub.set = record.set;
+                ub.binding = record.binding;
+                ub.size = record.size;
+                ub.members.resize(record.memberCount);
+                for (uint32_t m = 0; m < record.memberCount; ++m) {
+                    ToResource(*this, GetMember(record, m), ub.members[m]);
+                }
+            }
+
+            for (uint32_t list = 0; list < kResourceListCount; ++list) {
+                auto listType = static_cast<ResourceList>(list);
+                auto& resources = GetList(reflection, listType);
+                resources.resize(GetResourceCount(listType));
+                for (uint32_t i = 0; i < resources.size(); ++i) {
+                    ToResource(*this, GetResource(listType, i), resources[i]);
+                }
+            }
+
+            out = std::move(reflection);
+        }
+
+        void ShaderReflectionSerializer::Serialize(const ShaderReflection& reflection, std::vector<uint8_t>& out) {
+            BlobBuilder builder;
+            builder.Build(reflection, out);
+        }
+
+        bool ShaderReflectionSerializer::Deserialize(const uint8_t* data, size_t size, ShaderReflection& out) {
+            if (!data) {
+                return false;
+            }
+
+            ShaderReflectionView view;
+            if (reinterpret_cast<uintptr_t>(data) % 4 == 0) {
+                if (!view.Open(data, size)) {
+                    return false;
+                }
+                view.ToReflection(out);
+                return true;
+            }
+
+            // The view needs aligned records; realign a copy
+            std::vector<uint32_t> aligned((size + 3) / 4);
+            std::memcpy(aligned.data(), data, size);
+            if (!view.Open(aligned.data(), size)) {
+                return false;
+            }
+            view.ToReflection(out);
+            return true;
+        }
+
+    } // namespace Shader
+} // namespace FirstEngine
@@ -9,6 +9,7 @@
 #include <vector>
 #include <string>
 #include <memory>
+#include <cstring>
 
 namespace FirstEngine {
     namespace Shader {
@@ -117,6 +118,68 @@ namespace FirstEngine {
             return resources;
         }
         
+        namespace {
+            std::string BuildDefinePreamble(const CompileOptions& options) {
+                std::string preamble;
+                for (const auto& define : options.defines) {
+                    preamble += "#define " + define.first;
+                    if (!define.second.empty()) {
+                        preamble += " " + define.second;
+                    }
+                    preamble += "\n";
+                }
+                return preamble;
+            }
+        }
+        
+        // Resolves #include "file" relative to the including file, then the include directories
+        class FileIncluder : public glslang::TShader::Includer {
+        public:
+            explicit FileIncluder(const std::vector<std::string>& include_directories)
+                : m_IncludeDirectories(include_directories) {
+            }
+            
+            IncludeResult* includeLocal(const char* header_name, const char* includer_name, size_t depth) override {
+                std::filesystem::path includer_dir = std::filesystem::path(includer_name ? includer_name : "").parent_path();
+                if (!includer_dir.empty()) {
+                    if (auto* result = TryOpen((includer_dir / header_name).string())) {
+                        return result;
+                    }
+                }
+                return includeSystem(header_name, includer_name, depth);
+            }
+            
+            IncludeResult* includeSystem(const char* header_name, const char* /*includer_name*/, size_t /*depth*/) override {
+                for (const auto& dir : m_IncludeDirectories) {
+                    if (auto* result = TryOpen((std::filesystem::path(dir) / header_name).string())) {
+                        return result;
+                    }
+                }
+                return nullptr;
+            }
+            
+            void releaseInclude(IncludeResult* result) override {
+                if (result) {
+                    delete static_cast<std::string*>(result->userData);
+                    delete result;
+                }
+            }
+            
+        private:
+            IncludeResult* TryOpen(const std::string& path) {
+                std::ifstream file(path, std::ios::binary);
+                if (!file.is_open()) {
+                    return nullptr;
+                }
+                std::stringstream buffer;
+                buffer << file.rdbuf();
+                auto* content = new std::string(buffer.str());
+                return new IncludeResult(path, content->data(), content->size(), content);
+            }
+            
+            const std::vector<std::string>& m_IncludeDirectories;
+        };
+        
         CompileResult CompileGLSLToSPIRV(const std::string& source_code, EShLanguage stage, 
                                          const CompileOptions& options, TBuiltInResource& resources) {
             CompileResult result;
@@ -130,18 +193,18 @@ namespace FirstEngine {
             shader.setSourceEntryPoint(options.entry_point.c_str());
             
             // Set defines/macros
-            for (const auto& define : options.defines) {
-                std::string def_str = define.first;
-                if (!define.second.empty()) {
-                    def_str += "=" + define.second;
-                }
-                shader.setPreamble((def_str + "\n").c_str());
+            // glslang keeps only one preamble and stores the pointer, so build all
+            // "#define" lines into a single string that outlives parse()
+            std::string preamble = BuildDefinePreamble(options);
+            if (!preamble.empty()) {
+                shader.setPreamble(preamble.c_str());
             }
             
             // Parse shader
             EShMessages messages = (EShMessages)(EShMsgSpvRules | EShMsgVulkanRules);
             
-            if (!shader.parse(&resources, 100, false, messages)) {
+            FileIncluder includer(options.include_directories);
+            if (!shader.parse(&resources, 100, false, messages, includer)) {
                 result.success = false;
                 result.error_message = shader.getInfoLog();
                 result.error_message += "\n";
@@ -215,18 +278,16 @@ namespace FirstEngine {
             shader.setEnvClient(glslang::EShClientVulkan, glslang::EShTargetVulkan_1_0);
             shader.setEnvTarget(glslang::EShTargetSpv, glslang::EShTargetSpv_1_0);
             
-            // Set defines
-            for (const auto& define : options.defines) {
-                std::string def_str = define.first;
-                if (!define.second.empty()) {
-                    def_str += "=" + define.second;
-                }
-                shader.setPreamble((def_str + "\n").c_str());
+            // Set defines (single preamble, see CompileGLSLToSPIRV)
+            std::string preamble = BuildDefinePreamble(options);
+            if (!preamble.empty()) {
+                shader.setPreamble(preamble.c_str());
             }
             
             EShMessages messages = (EShMessages)(EShMsgSpvRules | EShMsgVulkanRules);
             
-            if (!shader.parse(&resources, 100, false, messages)) {
+            FileIncluder includer(options.include_directories);
+            if (!shader.parse(&resources, 100, false, messages, includer)) {
                 result.success = false;
                 result.error_message = shader.getInfoLog();
                 result.error_message += "\n";
@@ -284,11 +345,15 @@ namespace FirstEngine {
                 std::string source_code = buffer.str();
                 file.close();
                 
+                // Includes resolve relative to the source file as well
+                CompileOptions opts = options;
+                opts.include_directories.push_back(std::filesystem::path(filepath).parent_path().string());
+                
                 // Determine language from options
-                if (options.language == ShaderSourceLanguage::GLSL) {
-                    return CompileGLSL(source_code, options);
+                if (opts.language == ShaderSourceLanguage::GLSL) {
+                    return CompileGLSL(source_code, opts);
                 } else {
-                    return CompileHLSL(source_code, options);
+                    return CompileHLSL(source_code, opts);
                 }
                 
             } catch (const std::exception& e) {
@@ -342,6 +407,45 @@ namespace FirstEngine {
             }
         }
         
+        bool ShaderSourceCompiler::Preprocess(const std::string& source_code, const CompileOptions& options,
+                                              std::string& out_preprocessed, std::string* out_error) {
+            EShLanguage stage = GetGlslangStage(options.stage);
+            TBuiltInResource resources = GetDefaultResources();
+            
+            glslang::TShader shader(stage);
+            const char* shader_strings = source_code.c_str();
+            shader.setStrings(&shader_strings, 1);
+            shader.setEntryPoint(options.entry_point.c_str());
+            shader.setSourceEntryPoint(options.entry_point.c_str());
+            
+            if (options.language == ShaderSourceLanguage::HLSL) {
+                shader.setEnvInput(glslang::EShSourceHlsl, stage, glslang::EShClientVulkan, 100);
+                shader.setEnvClient(glslang::EShClientVulkan, glslang::EShTargetVulkan_1_0);
+                shader.setEnvTarget(glslang::EShTargetSpv, glslang::EShTargetSpv_1_0);
+            }
+            
+            std::string preamble = BuildDefinePreamble(options);
+            if (!preamble.empty()) {
+                shader.setPreamble(preamble.c_str());
+            }
+            
+            EShMessages messages = (EShMessages)(EShMsgSpvRules | EShMsgVulkanRules);
+            FileIncluder includer(options.include_directories);
+            if (!shader.preprocess(&resources, 100, ENoProfile, false, false, messages, &out_preprocessed, includer)) {
+                if (out_error) {
+                    *out_error = shader.getInfoLog();
+                }
+                return false;
+            }
+            return true;
+        }
+        
+        std::string ShaderSourceCompiler::GetCompilerVersion() {
+            // glslang front-end version + our SPIR-V generation settings (bump the suffix when they change)
+            return std::string("glslang ") + glslang::GetGlslVersionString() + " / " +
+                   glslang::GetEsslVersionString() + " / fe-spv-1";
+        }
+        
         bool ShaderSourceCompiler::SaveSPIRV(const std::vector<uint32_t>& spirv, const std::string& output_filepath) {
             try {
                 std::ofstream file(output_filepath, std::ios::binary);
@@ -4,11 +4,19 @@
 #include "FirstEngine/Resources/ModelLoader.h"
 #include "FirstEngine/Resources/MeshLoader.h"
 #include "FirstEngine/Resources/MaterialLoader.h"
+#include "FirstEngine/Resources/CookedMeshFormat.h"
+#include "FirstEngine/Resources/CookedTextureFormat.h"
+#include "FirstEngine/Resources/CompiledManifestFormat.h"
+#include "FirstEngine/Resources/PackageArchive.h"
+#include "FirstEngine/Resources/TextureLoader.h"
 #include <iostream>
 #include <fstream>
 #include <algorithm>
 #include <iomanip>
 #include <sstream>
+#include <atomic>
+#include <chrono>
+#include <thread>
 #if __has_include(<filesystem>)
 #include <filesystem>
 namespace fs = std::filesystem;
@@ -36,6 +44,10 @@ namespace FirstEngine {
 
             if (command_str == "import" || command_str == "i") {
                 m_Command = Command::Import;
+            } else if (command_str == "pack") {
+                m_Command = Command::Pack;
+            } else if (command_str == "bench-cache") {
+                m_Command = Command::BenchCache;
             } else if (command_str == "help" || command_str == "h" || command_str == "-h" || command_str == "--help") {
                 m_Command = Command::Help;
                 return true;
@@ -49,6 +61,34 @@ namespace FirstEngine {
             for (int i = 2; i < argc; i++) {
                 std::string arg = argv[i];
 
+                if (m_Command == Command::Pack) {
+                    if ((arg == "-p" || arg == "--package") && i + 1 < argc) {
+                        m_PackOptions.package_dir = argv[++i];
+                    } else if ((arg == "-o" || arg == "--output") && i + 1 < argc) {
+                        m_PackOptions.output_file = argv[++i];
+                    } else if (arg == "--no-compress") {
+                        m_PackOptions.compress = false;
+                    } else {
+                        std::cerr << "Unknown argument: " << arg << std::endl;
+                        return false;
+                    }
+                    continue;
+                }
+
+                if (m_Command == Command::BenchCache) {
+                    if ((arg == "-p" || arg == "--package") && i + 1 < argc) {
+                        m_BenchCacheOptions.package_dir = argv[++i];
+                    } else if ((arg == "-j" || arg == "--threads") && i + 1 < argc) {
+                        m_BenchCacheOptions.threads = static_cast<uint32_t>(std::max(1, std::stoi(argv[++i])));
+                    } else if ((arg == "-s" || arg == "--seconds") && i + 1 < argc) {
+                        m_BenchCacheOptions.seconds = std::max(0.1, std::stod(argv[++i]));
+                    } else {
+                        std::cerr << "Unknown argument: " << arg << std::endl;
+                        return false;
+                    }
+                    continue;
+                }
+
                 if (arg == "-i" || arg == "--input") {
                     if (i + 1 < argc) {
                         m_Options.input_file = argv[++i];
@@ -101,6 +141,52 @@ namespace FirstEngine {
                     m_Options.overwrite = true;
                 } else if (arg == "--no-manifest") {
                     m_Options.update_manifest = false;
+                } else if (arg == "--no-optimize") {
+                    m_Options.optimize_mesh = false;
+                } else if (arg == "--no-quantize") {
+                    m_Options.quantize_mesh = false;
+                } else if (arg == "--quantize-positions") {
+                    m_Options.quantize_positions = true;
+                } else if (arg == "--octahedral-normals") {
+                    m_Options.octahedral_normals = true;
+                } else if (arg == "--lods") {
+                    if (i + 1 < argc) {
+                        m_Options.mesh_lods = static_cast<uint32_t>(std::max(0, std::stoi(argv[++i])));
+                    } else {
+                        std::cerr << "Error: --lods requires a count (0 disables LOD generation)" << std::endl;
+                        return false;
+                    }
+                } else if (arg == "--texture-format") {
+                    if (i + 1 < argc) {
+                        m_Options.texture_format = argv[++i];
+                        std::transform(m_Options.texture_format.begin(), m_Options.texture_format.end(),
+                                       m_Options.texture_format.begin(), ::tolower);
+                        const std::string& f = m_Options.texture_format;
+                        if (f != "auto" && f != "rgba8" && f != "bc1" && f != "bc3" && f != "bc5" && f != "bc7") {
+                            std::cerr << "Error: Unknown texture format: " << f << " (auto, rgba8, bc1, bc3, bc5, bc7)" << std::endl;
+                            return false;
+                        }
+                    } else {
+                        std::cerr << "Error: --texture-format requires a format (auto, rgba8, bc1, bc3, bc5, bc7)" << std::endl;
+                        return false;
+                    }
+                } else if (arg == "--linear") {
+                    m_Options.texture_srgb = false;
+                } else if (arg == "--no-mips") {
+                    m_Options.texture_mips = false;
+                } else if (arg == "--mip-filter") {
+                    if (i + 1 < argc) {
+                        m_Options.mip_filter = argv[++i];
+                        std::transform(m_Options.mip_filter.begin(), m_Options.mip_filter.end(),
+                                       m_Options.mip_filter.begin(), ::tolower);
+                        if (m_Options.mip_filter != "box" && m_Options.mip_filter != "kaiser") {
+                            std::cerr << "Error: Unknown mip filter: " << m_Options.mip_filter << " (box, kaiser)" << std::endl;
+                            return false;
+                        }
+                    } else {
+                        std::cerr << "Error: --mip-filter requires a filter (box, kaiser)" << std::endl;
+                        return false;
+                    }
                 } else {
                     std::cerr << "Unknown argument: " << arg << std::endl;
                     return false;
@@ -128,6 +214,14 @@ namespace FirstEngine {
                 return 0;
             }
 
+            if (m_Command == Command::Pack) {
+                return ExecutePack();
+            }
+
+            if (m_Command == Command::BenchCache) {
+                return ExecuteBenchCache();
+            }
+
             if (m_Command == Command::Import) {
                 // Load existing manifest if it exists
                 std::string manifestPath = m_Options.output_dir + "/resource_manifest.json";
@@ -203,6 +297,8 @@ namespace FirstEngine {
             std::cout << "Usage: ResourceImport <command> [options]\n\n";
             std::cout << "Commands:\n";
             std::cout << "  import, i    Import a resource file\n";
+            std::cout << "  pack         Pack a package directory into a single .fepak archive\n";
+            std::cout << "  bench-cache  Stress the ResourceManager cache from many threads\n";
             std::cout << "  help, h      Show this help message\n\n";
             std::cout << "Import Options:\n";
             std::cout << "  -i, --input <file>          Input file to import (required)\n";
@@ -211,11 +307,30 @@ namespace FirstEngine {
             std::cout << "  -v, --virtual-path <path>   Virtual path for the resource\n";
             std::cout << "  -n, --name <name>           Resource name (default: filename without extension)\n";
             std::cout << "  --overwrite                 Overwrite existing files\n";
-            std::cout << "  --no-manifest               Don't update resource manifest\n\n";
+            std::cout << "  --no-manifest               Don't update resource manifest\n";
+            std::cout << "  --no-optimize               Cook meshes as imported (no weld/reorder, 32-bit indices)\n";
+            std::cout << "  --no-quantize               Keep cooked vertex attributes as 32-bit floats\n";
+            std::cout << "  --quantize-positions        Store positions as unorm16 across the mesh bounds\n";
+            std::cout << "  --octahedral-normals        Octahedral normals/tangents (material needs OCTAHEDRAL_NORMALS)\n";
+            std::cout << "  --lods <count>              Simplified mesh LODs to generate (default: 4, max: 7, 0 = none)\n";
+            std::cout << "  --texture-format <format>   Cooked texture format: auto, rgba8, bc1, bc3, bc5, bc7 (default: auto)\n";
+            std::cout << "  --linear                    Texture holds linear data (masks, roughness): filter mips without sRGB\n";
+            std::cout << "  --no-mips                   Cook only the top texture level\n";
+            std::cout << "  --mip-filter <filter>       Mip downsampling filter: box, kaiser (default: kaiser)\n\n";
+            std::cout << "Pack Options:\n";
+            std::cout << "  -p, --package <dir>         Package directory to pack (default: build/Package)\n";
+            std::cout << "  -o, --output <file>         Archive to write (default: <package>.fepak)\n";
+            std::cout << "  --no-compress               Store every file uncompressed\n\n";
+            std::cout << "Bench-cache Options:\n";
+            std::cout << "  -p, --package <dir>         Package with resource_manifest.json (default: build/Package)\n";
+            std::cout << "  -j, --threads <count>       Worker threads (default: 16)\n";
+            std::cout << "  -s, --seconds <seconds>     Duration of each run (default: 3)\n\n";
             std::cout << "Examples:\n";
             std::cout << "  ResourceImport import -i texture.png -t texture\n";
             std::cout << "  ResourceImport import -i model.fbx -t model -n MyModel\n";
             std::cout << "  ResourceImport import -i mesh.obj -t mesh -o build/Package/Meshes\n";
+            std::cout << "  ResourceImport pack -p build/Package\n";
+            std::cout << "  ResourceImport bench-cache -p build/Package -j 16\n";
         }
 
         ResourceImport::ResourceType ResourceImport::DetectResourceType(const std::string& filepath) const {
@@ -311,6 +426,27 @@ namespace FirstEngine {
                     return false;
                 }
 
+                // Cook mips + block compression next to the source; runtime loads map the .fetex and upload it as is
+                std::string cookedFilename = fs::path(filename).replace_extension(FirstEngine::Resources::CookedTexture::kExtension).string();
+                std::string cookedPath = (fs::path(outputPath).parent_path() / cookedFilename).string();
+                std::replace(cookedPath.begin(), cookedPath.end(), '\\', '/');
+                FirstEngine::Resources::TextureCookOptions cookOptions;
+                const std::string& format = options.texture_format;
+                using FirstEngine::Resources::TextureEncoding;
+                cookOptions.encoding = format == "rgba8" ? TextureEncoding::RGBA8 :
+                                       format == "bc1" ? TextureEncoding::BC1 :
+                                       format == "bc3" ? TextureEncoding::BC3 :
+                                       format == "bc5" ? TextureEncoding::BC5 :
+                                       format == "bc7" ? TextureEncoding::BC7 : TextureEncoding::Auto;
+                cookOptions.srgb = options.texture_srgb;
+                cookOptions.generateMips = options.texture_mips;
+                cookOptions.mipFilter = options.mip_filter == "box" ? FirstEngine::Resources::MipFilter::Box :
+                                                                      FirstEngine::Resources::MipFilter::Kaiser;
+                if (!FirstEngine::Resources::TextureLoader::Cook(inputPath, cookedPath, cookOptions)) {
+                    std::cerr << "Error: Failed to cook texture: " << cookedPath << std::endl;
+                    return false;
+                }
+
                 // Convert ResourceType
                 FirstEngine::Resources::ResourceType resourceType = FirstEngine::Resources::ResourceType::Texture;
 
@@ -325,6 +461,7 @@ namespace FirstEngine {
                 textureData.height = imageData.height;
                 textureData.channels = imageData.channels;
                 textureData.hasAlpha = (imageData.channels == 4);
+                textureData.cookedFile = cookedFilename;
 
                 // Save XML
                 if (!FirstEngine::Resources::ResourceXMLParser::SaveTextureToXML(xmlPath, options.name, id, textureData)) {
@@ -334,6 +471,7 @@ namespace FirstEngine {
 
                 std::cout << "Imported texture: " << options.name << " (ID: " << id << ")" << std::endl;
                 std::cout << "  File: " << outputPath << std::endl;
+                std::cout << "  Cooked: " << cookedPath << std::endl;
                 std::cout << "  XML: " << xmlPath << std::endl;
                 std::cout << "  Size: " << imageData.width << "x" << imageData.height << " (" << imageData.channels << " channels)" << std::endl;
 
@@ -375,6 +513,21 @@ namespace FirstEngine {
                     return false;
                 }
 
+                // Cook the mesh next to the source; runtime loads map the .femesh and never run Assimp
+                std::string cookedFilename = fs::path(filename).replace_extension(FirstEngine::Resources::CookedMesh::kExtension).string();
+                std::string cookedPath = (fs::path(outputPath).parent_path() / cookedFilename).string();
+                std::replace(cookedPath.begin(), cookedPath.end(), '\\', '/');
+                FirstEngine::Resources::MeshCookOptions cookOptions;
+                cookOptions.optimize = options.optimize_mesh;
+                cookOptions.quantize = options.quantize_mesh;
+                cookOptions.quantization.quantizePositions = options.quantize_positions;
+                cookOptions.quantization.octahedralNormals = options.octahedral_normals;
+                cookOptions.lodLevels = std::min(options.mesh_lods, FirstEngine::Resources::CookedMesh::kMaxLods - 1);
+                if (!FirstEngine::Resources::MeshLoader::Cook(inputPath, cookedPath, cookOptions)) {
+                    std::cerr << "Error: Failed to cook mesh: " << cookedPath << std::endl;
+                    return false;
+                }
+
                 // Convert ResourceType
                 FirstEngine::Resources::ResourceType resourceType = FirstEngine::Resources::ResourceType::Mesh;
 
@@ -384,6 +537,7 @@ namespace FirstEngine {
                 // Create MeshData
                 FirstEngine::Resources::ResourceXMLParser::MeshData meshData;
                 meshData.meshFile = filename;
+                meshData.cookedFile = cookedFilename;
 
                 // Save XML
                 if (!FirstEngine::Resources::ResourceXMLParser::SaveMeshToXML(xmlPath, options.name, id, meshData)) {
@@ -393,6 +547,7 @@ namespace FirstEngine {
 
                 std::cout << "Imported mesh: " << options.name << " (ID: " << id << ")" << std::endl;
                 std::cout << "  File: " << outputPath << std::endl;
+                std::cout << "  Cooked: " << cookedPath << std::endl;
                 std::cout << "  XML: " << xmlPath << std::endl;
 
                 return true;
@@ -618,5 +773,256 @@ namespace FirstEngine {
             return result;
         }
 
+        int ResourceImport::ExecutePack() {
+            using Clock = std::chrono::steady_clock;
+
+            const PackOptions& options = m_PackOptions;
+            fs::path packageDir = fs::path(options.package_dir).lexically_normal();
+            if (!packageDir.has_filename()) {
+                packageDir = packageDir.parent_path();
+            }
+            fs::path manifestPath = packageDir / "resource_manifest.json";
+            if (!fs::exists(manifestPath)) {
+                std::cerr << "Error: Manifest not found: " << manifestPath.string() << std::endl;
+                return 1;
+            }
+            if (!LoadManifest(manifestPath.string())) {
+                std::cerr << "Error: Failed to load manifest: " << manifestPath.string() << std::endl;
+                return 1;
+            }
+
+            // The runtime reads the compiled manifest from the archive; rebuild it so it matches the JSON
+            std::string compiledManifestPath = Resources::ResourceIDManager::GetCompiledManifestPath(manifestPath.string());
+            if (!m_IDManager.SaveCompiledManifest(compiledManifestPath)) {
+                std::cerr << "Error: Failed to write compiled manifest: " << compiledManifestPath << std::endl;
+                return 1;
+            }
+
+            fs::path outputPath = options.output_file.empty()
+                ? fs::path(packageDir.string() + Resources::PackageArchiveFormat::kExtension)
+                : fs::path(options.output_file);
+
+            // Everything the runtime reads through ResourceManager; shaders are compiled from the
+            // Shaders directory by ShaderCollectionsTools and stay loose
+            std::vector<Resources::PackageArchiveFile> files;
+            for (const auto& item : fs::recursive_directory_iterator(packageDir)) {
+                if (!item.is_regular_file()) {
+                    continue;
+                }
+                std::string relative = fs::relative(item.path(), packageDir).generic_string();
+                std::error_code error;
+                if (relative.rfind("Shaders/", 0) == 0 || fs::equivalent(item.path(), outputPath, error)) {
+                    continue;
+                }
+
+                std::string ext = item.path().extension().string();
+                std::transform(ext.begin(), ext.end(), ext.begin(), ::tolower);
+
+                Resources::PackageArchiveFile file;
+                file.path = relative;
+                file.sourcePath = item.path().string();
+                file.resourceID = m_IDManager.GetIDFromPath(relative);
+                // Cooked payloads and the compiled manifest are used in place from the mapping, so they are never compressed
+                file.allowCompression = ext != Resources::CookedMesh::kExtension && ext != Resources::CookedTexture::kExtension &&
+                                        ext != Resources::CompiledManifestFormat::kExtension;
+                files.push_back(file);
+            }
+
+            // Sorted paths keep each resource's descriptor and payloads next to each other
+            std::sort(files.begin(), files.end(), [](const Resources::PackageArchiveFile& a, const Resources::PackageArchiveFile& b) {
+                return a.path < b.path;
+            });
+
+            Resources::PackageWriteOptions writeOptions;
+            writeOptions.compress = options.compress;
+            Resources::PackageArchive::WriteReport report;
+            auto start = Clock::now();
+            if (!Resources::PackageArchive::Write(outputPath.string(), files, writeOptions, &report)) {
+                std::cerr << "Error: Failed to pack " << packageDir.string() << std::endl;
+                return 1;
+            }
+            double seconds = std::chrono::duration<double>(Clock::now() - start).count();
+
+            // Read every entry back once, so a bad archive fails here rather than at runtime
+            Resources::PackageArchive archive;
+            if (!archive.Open(outputPath.string())) {
+                return 1;
+            }
+            for (uint32_t i = 0; i < archive.GetEntryCount(); ++i) {
+                std::shared_ptr<Resources::MappedFile> entry = archive.OpenEntry(i);
+                if (!entry || entry->GetSize() != archive.GetEntry(i).size) {
+                    std::cerr << "Error: Entry " << archive.GetEntryPath(i) << " does not read back" << std::endl;
+                    return 1;
+                }
+            }
+
+            std::cout << "Packed " << report.entryCount << " files (" << report.compressedCount << " compressed) into "
+                      << outputPath.string() << "\n";
+            std::cout << "  " << report.sourceBytes << " -> " << report.archiveBytes << " bytes ("
+                      << std::fixed << std::setprecision(1)
+                      << (report.sourceBytes > 0 ? 100.0 * report.archiveBytes / report.sourceBytes : 0.0) << "%) in "
+                      << std::setprecision(2) << seconds << "s\n";
+            return 0;
+        }
+
+        int ResourceImport::ExecuteBenchCache() {
+            using Resources::ResourceManager;
+            using Clock = std::chrono::steady_clock;
+
+            const BenchCacheOptions& options = m_BenchCacheOptions;
+            fs::path packageDir(options.package_dir);
+            fs::path manifestPath = packageDir / "resource_manifest.json";
+            if (!fs::exists(manifestPath)) {
+                std::cerr << "Error: Manifest not found: " << manifestPath.string() << std::endl;
+                return 1;
+            }
+
+            ResourceManager::Initialize();
+            ResourceManager& manager = ResourceManager::GetInstance();
+            manager.AddSearchPath(packageDir.string());
+            for (const char* subdir : { "Textures", "Materials", "Meshes", "Models" }) {
+                manager.AddSearchPath((packageDir / subdir).string());
+            }
+            if (!manager.LoadManifest(manifestPath.string())) {
+                std::cerr << "Error: Failed to load manifest: " << manifestPath.string() << std::endl;
+                ResourceManager::Shutdown();
+                return 1;
+            }
+
+            // Warm up: load everything once and keep that reference so the runs below never drop a resource
+            // entirely (they measure the cache, not the loaders)
+            std::vector<Resources::ResourceID> ids;
+            for (Resources::ResourceType type : { Resources::ResourceType::Texture, Resources::ResourceType::Material,
+                                                  Resources::ResourceType::Mesh, Resources::ResourceType::Model }) {
+                for (Resources::ResourceID id : manager.GetIDsByType(type)) {
+                    if (manager.Load(id).ptr) {
+                        ids.push_back(id);
+                    }
+                }
+            }
+            if (ids.empty()) {
+                std::cerr << "Error: No resources could be loaded from " << options.package_dir << std::endl;
+                ResourceManager::Shutdown();
+                return 1;
+            }
+
+            struct RunResult {
+                uint64_t gets = 0;
+                uint64_t loads = 0;
+                uint64_t unloads = 0;
+                uint64_t failures = 0;
+                double seconds = 0.0;
+            };
+
+            // Each thread mixes 60% Get, 25% Load and 15% Unload of random IDs, unloading only what it loaded
+            auto run = [&](uint32_t threadCount) {
+                std::atomic<bool> stop(false);
+                std::atomic<uint32_t> ready(0);
+                std::vector<RunResult> perThread(threadCount);
+                std::vector<std::thread> threads;
+
+                for (uint32_t t = 0; t < threadCount; t++) {
+                    threads.emplace_back([&, t]() {
+                        RunResult& result = perThread[t];
+                        std::vector<Resources::ResourceID> held;
+                        uint64_t state = 0x2545F4914F6CDD1Dull ^ (static_cast<uint64_t>(t + 1) * 0x9E3779B97F4A7C15ull);
+                        auto next = [&state]() {
+                            state ^= state << 13;
+                            state ^= state >> 7;
+                            state ^= state << 17;
+                            return state;
+                        };
+
+                        ready++;
+                        while (ready.load() < threadCount) {
+                            std::this_thread::yield();
+                        }
+
+                        while (!stop.load(std::memory_order_relaxed)) {
+                            uint64_t random = next();
+                            Resources::ResourceID id = ids[(random >> 8) % ids.size()];
+                            uint32_t op = static_cast<uint32_t>(random % 100);
+                            if (op < 60) {
+                                if (!manager.Get(id).ptr) {
+                                    result.failures++;
+                                }
+                                result.gets++;
+                            } else if (op < 85 || held.empty()) {
+                                if (manager.Load(id).ptr) {
+                                    held.push_back(id);
+                                } else {
+                                    result.failures++;
+                                }
+                                result.loads++;
+                            } else {
+                                manager.Unload(held.back());
+                                held.pop_back();
+                                result.unloads++;
+                            }
+                        }
+
+                        for (Resources::ResourceID id : held) {
+                            manager.Unload(id);
+                        }
+                    });
+                }
+
+                while (ready.load() < threadCount) {
+                    std::this_thread::yield();
+                }
+                auto start = Clock::now();
+                std::this_thread::sleep_for(std::chrono::duration<double>(options.seconds));
+                stop = true;
+                for (std::thread& thread : threads) {
+                    thread.join();
+                }
+
+                RunResult total;
+                total.seconds = std::chrono::duration<double>(Clock::now() - start).count();
+                for (const RunResult& result : perThread) {
+                    total.gets += result.gets;
+                    total.loads += result.loads;
+                    total.unloads += result.unloads;
+                    total.failures += result.failures;
+                }
+                return total;
+            };
+
+            auto report = [](const char* label, uint32_t threadCount, const RunResult& result) {
+                uint64_t ops = result.gets + result.loads + result.unloads;
+                double opsPerSecond = result.seconds > 0.0 ? ops / result.seconds : 0.0;
+                std::cout << "  " << label << " (" << threadCount << " thread" << (threadCount == 1 ? "" : "s") << "): "
+                          << std::fixed << std::setprecision(2) << opsPerSecond / 1.0e6 << " Mops/s"
+                          << "  [get " << result.gets << ", load " << result.loads << ", unload " << result.unloads
+                          << ", failed " << result.failures << "]\n";
+                return opsPerSecond;
+            };
+
+            size_t loadedBefore = manager.GetLoadedTextureCount() + manager.GetLoadedMaterialCount() +
+                                  manager.GetLoadedMeshCount() + manager.GetLoadedModelCount();
+
+            std::cout << "ResourceManager cache benchmark: " << ids.size() << " resources, "
+                      << options.seconds << "s per run\n";
+            double single = report("Baseline", 1, run(1));
+            double multi = report("Stress", options.threads, run(options.threads));
+            std::cout << "  Scaling: " << std::fixed << std::setprecision(2)
+                      << (single > 0.0 ? multi / single : 0.0) << "x\n";
+
+            // Every Load in the runs was matched by an Unload, so only the warm-up references should remain
+            size_t loadedAfter = manager.GetLoadedTextureCount() + manager.GetLoadedMaterialCount() +
+                                 manager.GetLoadedMeshCount() + manager.GetLoadedModelCount();
+            for (Resources::ResourceID id : ids) {
+                manager.Unload(id);
+            }
+            ResourceManager::Shutdown();
+
+            if (loadedAfter != loadedBefore) {
+                std::cerr << "Error: Reference counts out of balance (" << loadedBefore << " resources cached before, "
+                          << loadedAfter << " after)" << std::endl;
+                return 1;
+            }
+            return 0;
+        }
+
     } // namespace Tools
 } // namespace FirstEngine
@@ -1,9 +1,15 @@
 #include "FirstEngine/ShaderManager/ShaderManager.h"
+#include "FirstEngine/Shader/ShaderKeywords.h"
+#include "FirstEngine/Shader/ShaderCache.h"
+#include "FirstEngine/Resources/ResourceXMLParser.h"
+#include "FirstEngine/Core/Hash.h"
 #include <iostream>
 #include <fstream>
 #include <sstream>
 #include <algorithm>
 #include <filesystem>
+#include <chrono>
+#include <iomanip>
 
 namespace FirstEngine {
     namespace ShaderManager {
@@ -26,6 +32,12 @@ namespace FirstEngine {
                 m_Command = Command::Convert;
             } else if (command_str == "reflect" || command_str == "r") {
                 m_Command = Command::Reflect;
+            } else if (command_str == "permutations" || command_str == "p") {
+                m_Command = Command::Permutations;
+            } else if (command_str == "cook" || command_str == "k") {
+                m_Command = Command::Cook;
+            } else if (command_str == "bench-hash") {
+                m_Command = Command::BenchHash;
             } else if (command_str == "help" || command_str == "h" || command_str == "-h" || command_str == "--help") {
                 m_Command = Command::Help;
                 return true;
@@ -39,6 +51,45 @@ namespace FirstEngine {
             for (int i = 2; i < argc; i++) {
                 std::string arg = argv[i];
                 
+                if (m_Command == Command::Permutations) {
+                    if ((arg == "--shaders") && i + 1 < argc) {
+                        m_PermutationOptions.shader_directory = argv[++i];
+                    } else if ((arg == "--materials") && i + 1 < argc) {
+                        m_PermutationOptions.material_directory = argv[++i];
+                    } else if ((arg == "-o" || arg == "--output") && i + 1 < argc) {
+                        m_PermutationOptions.output_file = argv[++i];
+                    } else if ((arg == "-p" || arg == "--pass") && i + 1 < argc) {
+                        m_PermutationOptions.pass_keywords.push_back(argv[++i]);
+                    } else {
+                        std::cerr << "Unknown option: " << arg << std::endl;
+                    }
+                    continue;
+                }
+                
+                if (m_Command == Command::Cook) {
+                    if ((arg == "--shaders") && i + 1 < argc) {
+                        m_CookOptions.shader_directory = argv[++i];
+                    } else if ((arg == "--cache") && i + 1 < argc) {
+                        m_CookOptions.cache_directory = argv[++i];
+                    } else if ((arg == "-m" || arg == "--manifest") && i + 1 < argc) {
+                        m_CookOptions.manifest_file = argv[++i];
+                    } else {
+                        std::cerr << "Unknown option: " << arg << std::endl;
+                    }
+                    continue;
+                }
+                
+                if (m_Command == Command::BenchHash) {
+                    if ((arg == "-n" || arg == "--iterations") && i + 1 < argc) {
+                        m_BenchHashOptions.iterations = std::max(1, std::stoi(argv[++i]));
+                    } else if (!arg.empty() && arg[0] != '-') {
+                        m_BenchHashOptions.inputs.push_back(arg);
+                    } else {
+                        std::cerr << "Unknown option: " << arg << std::endl;
+                    }
+                    continue;
+                }
+                
                 if (arg == "-i" || arg == "--input") {
                     if (i + 1 < argc) {
                         if (m_Command == Command::Compile) {
@@ -134,6 +185,12 @@ namespace FirstEngine {
                     return ExecuteConvert();
                 case Command::Reflect:
                     return ExecuteReflect();
+                case Command::Permutations:
+                    return ExecutePermutations();
+                case Command::Cook:
+                    return ExecuteCook();
+                case Command::BenchHash:
+                    return ExecuteBenchHash();
                 case Command::Help:
                     PrintHelp();
                     return 0;
@@ -363,6 +420,269 @@ namespace FirstEngine {
             }
         }
         
+        int ShaderManager::ExecutePermutations() {
+            const auto& options = m_PermutationOptions;
+            if (options.shader_directory.empty() || !std::filesystem::is_directory(options.shader_directory)) {
+                std::cerr << "Error: Shader directory not specified or not found: " << options.shader_directory << std::endl;
+                return 1;
+            }
+            if (options.material_directory.empty() || !std::filesystem::is_directory(options.material_directory)) {
+                std::cerr << "Error: Material directory not specified or not found: " << options.material_directory << std::endl;
+                return 1;
+            }
+            
+            std::cout << "Collecting shader permutations..." << std::endl;
+            std::cout << "  Shaders: " << options.shader_directory << std::endl;
+            std::cout << "  Materials: " << options.material_directory << std::endl;
+            
+            // Keywords declared by each shader (// @keywords ... in any stage source)
+            std::map<std::string, FirstEngine::Shader::ShaderKeywordSet> declared;
+            for (const auto& entry : std::filesystem::directory_iterator(options.shader_directory)) {
+                if (!entry.is_regular_file() || entry.path().extension() != ".hlsl") {
+                    continue;
+                }
+                std::string filename = entry.path().filename().string();
+                std::string base_name = filename.substr(0, filename.find('.'));
+                
+                std::ifstream file(entry.path());
+                std::stringstream buffer;
+                buffer << file.rdbuf();
+                declared[base_name].Merge(FirstEngine::Shader::ParseDeclaredKeywords(buffer.str()));
+            }
+            
+            std::vector<FirstEngine::Shader::ShaderKeywordSet> pass_sets;
+            for (const auto& pass : options.pass_keywords) {
+                pass_sets.push_back(FirstEngine::Shader::ShaderKeywordSet::FromString(pass));
+            }
+            
+            // Every (material keywords [+ pass keywords]) combination, reduced to the keywords the shader reacts to
+            // The base permutation (no keywords) is always compiled and is not listed
+            FirstEngine::Shader::ShaderPermutationManifest manifest;
+            size_t material_count = 0;
+            for (const auto& entry : std::filesystem::directory_iterator(options.material_directory)) {
+                if (!entry.is_regular_file() || entry.path().extension() != ".xml") {
+                    continue;
+                }
+                
+                FirstEngine::Resources::ResourceXMLParser parser;
+                FirstEngine::Resources::ResourceXMLParser::MaterialData material;
+                if (!parser.ParseFromFile(entry.path().string()) || !parser.GetMaterialData(material)) {
+                    continue;
+                }
+                
+                auto it = declared.find(material.shaderName);
+                if (it == declared.end()) {
+                    std::cerr << "Warning: " << entry.path().filename().string()
+                              << " uses unknown shader: " << material.shaderName << std::endl;
+                    continue;
+                }
+                material_count++;
+                
+                FirstEngine::Shader::ShaderKeywordSet material_keywords(material.keywords);
+                auto keywords = material_keywords.Filtered(it->second);
+                if (!keywords.IsEmpty()) {
+                    manifest.Add(material.shaderName, keywords);
+                }
+                for (const auto& pass_set : pass_sets) {
+                    auto combined = material_keywords;
+                    combined.Merge(pass_set);
+                    combined = combined.Filtered(it->second);
+                    if (!combined.IsEmpty()) {
+                        manifest.Add(material.shaderName, combined);
+                    }
+                }
+            }
+            
+            std::string output_file = options.output_file;
+            if (output_file.empty()) {
+                output_file = (std::filesystem::path(options.shader_directory) / "ShaderPermutations.txt").string();
+            }
+            
+            if (!manifest.SaveToFile(output_file)) {
+                std::cerr << "Error: Failed to save output file" << std::endl;
+                return 1;
+            }
+            
+            std::cout << "Success! Output: " << output_file << std::endl;
+            std::cout << "  Materials: " << material_count << std::endl;
+            std::cout << "  Permutations: " << manifest.GetEntries().size() << std::endl;
+            return 0;
+        }
+        
+        int ShaderManager::ExecuteCook() {
+            const auto& options = m_CookOptions;
+            if (options.shader_directory.empty() || !std::filesystem::is_directory(options.shader_directory)) {
+                std::cerr << "Error: Shader directory not specified or not found: " << options.shader_directory << std::endl;
+                return 1;
+            }
+            
+            std::filesystem::path shader_dir(options.shader_directory);
+            std::string cache_dir = options.cache_directory.empty() ? (shader_dir / "Cache").string() : options.cache_directory;
+            std::string manifest_file = options.manifest_file.empty()
+                ? (shader_dir / "ShaderPermutations.txt").string() : options.manifest_file;
+            
+            std::cout << "Cooking shaders..." << std::endl;
+            std::cout << "  Shaders: " << options.shader_directory << std::endl;
+            std::cout << "  Cache: " << cache_dir << std::endl;
+            
+            // Base shaders (<Name>.<stage>.hlsl) and the stage of each source
+            struct StageSource {
+                std::string path;
+                FirstEngine::Shader::ShaderStage stage;
+            };
+            std::map<std::string, std::vector<StageSource>> shaders;
+            for (const auto& entry : std::filesystem::directory_iterator(shader_dir)) {
+                if (!entry.is_regular_file() || entry.path().extension() != ".hlsl") {
+                    continue;
+                }
+                std::string filename = entry.path().filename().string();
+                std::string base_name = filename.substr(0, filename.find('.'));
+                if (filename == base_name + ".vert.hlsl") {
+                    shaders[base_name].push_back({entry.path().string(), FirstEngine::Shader::ShaderStage::Vertex});
+                } else if (filename == base_name + ".frag.hlsl") {
+                    shaders[base_name].push_back({entry.path().string(), FirstEngine::Shader::ShaderStage::Fragment});
+                }
+            }
+            
+            // Permutations the package uses (the base permutation is always cooked)
+            FirstEngine::Shader::ShaderPermutationManifest manifest;
+            if (std::filesystem::exists(manifest_file)) {
+                if (!manifest.LoadFromFile(manifest_file)) {
+                    std::cerr << "Error: Failed to read permutation manifest: " << manifest_file << std::endl;
+                    return 1;
+                }
+                std::cout << "  Manifest: " << manifest_file << std::endl;
+            }
+            
+            std::vector<std::pair<std::string, FirstEngine::Shader::ShaderKeywordSet>> permutations;
+            for (const auto& shader : shaders) {
+                permutations.push_back({shader.first, {}});
+            }
+            for (const auto& entry : manifest.GetEntries()) {
+                if (shaders.find(entry.shaderName) == shaders.end()) {
+                    std::cerr << "Warning: Manifest lists unknown shader: " << entry.shaderName << std::endl;
+                    continue;
+                }
+                permutations.push_back({entry.shaderName, entry.keywords});
+            }
+            
+            // Compile each stage through the engine's shader cache: every entry holds SPIR-V plus the
+            // reflection blob, so the engine loads both without compiling or running SPIRV-Cross
+            FirstEngine::Shader::ShaderCache cache(cache_dir);
+            size_t failed = 0;
+            size_t stages = 0;
+            for (const auto& permutation : permutations) {
+                auto defines = permutation.second.ToDefines();
+                for (const auto& source : shaders[permutation.first]) {
+                    auto compile_options = FirstEngine::Shader::ShaderCache::GetEngineCompileOptions(source.stage, defines);
+                    FirstEngine::Shader::ShaderCacheEntry entry;
+                    std::string error;
+                    if (!cache.CompileFile(source.path, compile_options, entry, &error)) {
+                        std::cerr << "Error: " << source.path;
+                        if (!permutation.second.IsEmpty()) {
+                            std::cerr << " [" << permutation.second.ToString() << "]";
+                        }
+                        std::cerr << ": " << error << std::endl;
+                        failed++;
+                        continue;
+                    }
+                    if (!entry.hasReflection) {
+                        // Materials can't be created from a collection without reflection
+                        std::cerr << "Warning: No reflection for " << source.path << std::endl;
+                    }
+                    stages++;
+                }
+            }
+            
+            auto stats = cache.GetStats();
+            std::cout << (failed == 0 ? "Success!" : "Finished with errors.") << std::endl;
+            std::cout << "  Shaders: " << shaders.size() << ", permutations: " << permutations.size()
+                      << ", stages: " << stages << std::endl;
+            std::cout << "  Compiled: " << stats.misses << ", up to date: " << stats.hits
+                      << ", failed: " << failed << ", write errors: " << stats.writeErrors << std::endl;
+            return (failed == 0 && stats.writeErrors == 0) ? 0 : 1;
+        }
+        
+        int ShaderManager::ExecuteBenchHash() {
+            const auto& options = m_BenchHashOptions;
+            
+            // Gather blobs (cache entries are hashed whole: header + SPIR-V + reflection)
+            std::vector<std::string> files;
+            for (const auto& input : options.inputs) {
+                if (std::filesystem::is_directory(input)) {
+                    for (const auto& entry : std::filesystem::recursive_directory_iterator(input)) {
+                        auto extension = entry.path().extension();
+                        if (entry.is_regular_file() && (extension == ".spv" || extension == ".fesc")) {
+                            files.push_back(entry.path().string());
+                        }
+                    }
+                } else if (std::filesystem::is_regular_file(input)) {
+                    files.push_back(input);
+                } else {
+                    std::cerr << "Warning: Input not found: " << input << std::endl;
+                }
+            }
+            
+            std::vector<std::vector<uint8_t>> blobs;
+            size_t total_bytes = 0;
+            for (const auto& path : files) {
+                std::ifstream file(path, std::ios::binary);
+                std::vector<uint8_t> data((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+                if (!data.empty()) {
+                    total_bytes += data.size();
+                    blobs.push_back(std::move(data));
+                }
+            }
+            if (blobs.empty()) {
+                std::cerr << "Error: No SPIR-V (.spv) or shader cache (.fesc) files to hash" << std::endl;
+                return 1;
+            }
+            
+            std::cout << "Hashing " << blobs.size() << " blobs (" << total_bytes << " bytes) x "
+                      << options.iterations << " iterations" << std::endl;
+            
+            // The checksum keeps the optimizer from dropping the work and shows both runs saw the same data
+            auto run = [&](const char* name, auto hash_function) {
+                uint64_t checksum = 0;
+                auto start = std::chrono::steady_clock::now();
+                for (int iteration = 0; iteration < options.iterations; ++iteration) {
+                    for (const auto& blob : blobs) {
+                        checksum += hash_function(blob.data(), blob.size());
+                    }
+                }
+                double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+                double bytes = static_cast<double>(total_bytes) * options.iterations;
+                double hashes = static_cast<double>(blobs.size()) * options.iterations;
+                std::cout << "  " << std::left << std::setw(12) << name << std::right << std::fixed << std::setprecision(2)
+                          << std::setw(9) << bytes / seconds / 1.0e9 << " GB/s"
+                          << std::setw(10) << seconds * 1.0e9 / hashes << " ns/blob"
+                          << "   (checksum " << std::hex << checksum << std::dec << ")" << std::endl;
+            };
+            
+            run("Hash128", [](const uint8_t* data, size_t size) {
+                return FirstEngine::Core::HashBytes128(data, size).low;
+            });
+            run("Hasher128", [](const uint8_t* data, size_t size) {
+                // Streaming in SPIR-V-instruction-sized pieces, as composite keys are built
+                FirstEngine::Core::Hasher128 hasher;
+                size_t offset = 0;
+                for (; offset + 16 <= size; offset += 16) {
+                    hasher.Update(data + offset, 16);
+                }
+                hasher.Update(data + offset, size - offset);
+                return hasher.Finalize().low;
+            });
+            run("FNV-1a 64", [](const uint8_t* data, size_t size) {
+                uint64_t hash = 14695981039346656037ull;
+                for (size_t i = 0; i < size; ++i) {
+                    hash ^= data[i];
+                    hash *= 1099511628211ull;
+                }
+                return hash;
+            });
+            return 0;
+        }
+        
         void ShaderManager::PrintHelp() const {
             std::cout << "ShaderManager - Shader Compilation and Conversion Tool" << std::endl;
             std::cout << std::endl;
@@ -372,6 +692,9 @@ namespace FirstEngine {
             std::cout << "  compile, c    Compile GLSL/HLSL source to SPIR-V" << std::endl;
             std::cout << "  convert, conv Convert SPIR-V to GLSL/HLSL/MSL" << std::endl;
             std::cout << "  reflect, r    Show shader reflection information" << std::endl;
+            std::cout << "  permutations, p  Write the shader permutation manifest for a package" << std::endl;
+            std::cout << "  cook, k       Precompile shaders + reflection into the engine's shader cache" << std::endl;
+            std::cout << "  bench-hash    Measure hashing throughput on SPIR-V / shader cache files" << std::endl;
             std::cout << "  help, h       Show this help message" << std::endl;
             std::cout << std::endl;
             std::cout << "Compile Options:" << std::endl;
@@ -398,10 +721,28 @@ namespace FirstEngine {
             std::cout << "  --no-images               Hide images" << std::endl;
             std::cout << "  --no-storage              Hide storage buffers" << std::endl;
             std::cout << std::endl;
+            std::cout << "Permutations Options:" << std::endl;
+            std::cout << "  --shaders <dir>           Shader source directory" << std::endl;
+            std::cout << "  --materials <dir>         Material XML directory" << std::endl;
+            std::cout << "  -p, --pass <keywords>     Keywords of a render pass (repeat per pass)" << std::endl;
+            std::cout << "  -o, --output <file>       Output manifest (default: <shaders>/ShaderPermutations.txt)" << std::endl;
+            std::cout << std::endl;
+            std::cout << "Cook Options:" << std::endl;
+            std::cout << "  --shaders <dir>           Shader source directory" << std::endl;
+            std::cout << "  --cache <dir>             Cache directory (default: <shaders>/Cache)" << std::endl;
+            std::cout << "  -m, --manifest <file>     Permutation manifest (default: <shaders>/ShaderPermutations.txt)" << std::endl;
+            std::cout << std::endl;
+            std::cout << "Bench-hash Options:" << std::endl;
+            std::cout << "  <path>...                 .spv / .fesc files or directories containing them" << std::endl;
+            std::cout << "  -n, --iterations <count>  Passes over all inputs (default: 200)" << std::endl;
+            std::cout << std::endl;
             std::cout << "Examples:" << std::endl;
             std::cout << "  ShaderManager compile -i vertex.vert -o vertex.spv" << std::endl;
             std::cout << "  ShaderManager convert -i shader.spv -f glsl -o shader.glsl" << std::endl;
             std::cout << "  ShaderManager reflect -i shader.spv" << std::endl;
+            std::cout << "  ShaderManager permutations --shaders Package/Shaders --materials Package/Materials -p DEPTH_ONLY" << std::endl;
+            std::cout << "  ShaderManager cook --shaders Package/Shaders" << std::endl;
+            std::cout << "  ShaderManager bench-hash Package/Shaders/Cache" << std::endl;
             std::cout << std::endl;
         }
         